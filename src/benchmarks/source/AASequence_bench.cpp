@@ -0,0 +1,57 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <OpenMS/CHEMISTRY/AASequence.h>
+
+using namespace OpenMS;
+
+static void AASequence_fromString(benchmark::State& state)
+{
+  const String sequence = "DFPIANGERQSPVDIDTHTAK";
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(AASequence::fromString(sequence));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(AASequence_fromString);
+
+static void AASequence_fromString_modified(benchmark::State& state)
+{
+  const String sequence = "DFPIANGERQSPVDIDTHTAM(Oxidation)C(Carbamidomethyl)K";
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(AASequence::fromString(sequence));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(AASequence_fromString_modified);
+
+static void AASequence_getMonoWeight(benchmark::State& state)
+{
+  const AASequence seq = AASequence::fromString("DFPIANGERQSPVDIDTHTAK");
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(seq.getMonoWeight());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(AASequence_getMonoWeight);
+
+static void AASequence_toString(benchmark::State& state)
+{
+  const AASequence seq = AASequence::fromString("DFPIANGERQSPVDIDTHTAM(Oxidation)K");
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(seq.toString());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(AASequence_toString);
@@ -0,0 +1,79 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <OpenMS/FORMAT/Base64.h>
+
+#include <random>
+
+using namespace OpenMS;
+
+// Base64 en/decoding of peak data is the inner loop of MzMLHandler; these
+// benchmarks cover it without the XML overhead.
+
+namespace
+{
+  std::vector<double> randomPeakData(Size size)
+  {
+    std::mt19937 rng(4711);
+    std::uniform_real_distribution<double> value(0.0, 2000.0);
+    std::vector<double> data(size);
+    for (double& v : data)
+    {
+      v = value(rng);
+    }
+    return data;
+  }
+}
+
+static void Base64_encode_double(benchmark::State& state)
+{
+  const std::vector<double> data = randomPeakData(state.range(0));
+  String out;
+  for (auto _ : state)
+  {
+    std::vector<double> in = data; // encode() may modify its input in place
+    Base64::encode(in, Base64::BYTEORDER_LITTLEENDIAN, out);
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(double));
+}
+BENCHMARK(Base64_encode_double)->Arg(10000)->Arg(100000);
+
+static void Base64_decode_double(benchmark::State& state)
+{
+  std::vector<double> data = randomPeakData(state.range(0));
+  String encoded;
+  Base64::encode(data, Base64::BYTEORDER_LITTLEENDIAN, encoded);
+
+  std::vector<double> out;
+  for (auto _ : state)
+  {
+    Base64::decode(encoded, Base64::BYTEORDER_LITTLEENDIAN, out);
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(double));
+}
+BENCHMARK(Base64_decode_double)->Arg(10000)->Arg(100000);
+
+static void Base64_decode_double_zlib(benchmark::State& state)
+{
+  std::vector<double> data = randomPeakData(state.range(0));
+  String encoded;
+  Base64::encode(data, Base64::BYTEORDER_LITTLEENDIAN, encoded, true);
+
+  std::vector<double> out;
+  for (auto _ : state)
+  {
+    Base64::decode(encoded, Base64::BYTEORDER_LITTLEENDIAN, out, true);
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(double));
+}
+BENCHMARK(Base64_decode_double_zlib)->Arg(10000)->Arg(100000);
@@ -0,0 +1,112 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <OpenMS/ANALYSIS/OPENSWATH/IonMobilityScoring.h>
+#include <OpenMS/KERNEL/RangeManager.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace OpenMS;
+
+namespace
+{
+  // Ion mobility scoring runs once per candidate peak group in diaPASEF
+  // OpenSWATH runs, so the per-call cost (mobilogram extraction, grid
+  // alignment, cross-correlation) is what matters here.
+
+  std::vector<OpenSwath::LightTransition> makeTransitions(std::size_t n)
+  {
+    std::vector<OpenSwath::LightTransition> transitions(n);
+    for (std::size_t k = 0; k < n; ++k)
+    {
+      transitions[k].product_mz = 400.0 + 100.0 * double(k);
+      transitions[k].precursor_mz = 700.2;
+      transitions[k].fragment_charge = 1;
+      transitions[k].transition_name = "tr" + std::to_string(k);
+    }
+    return transitions;
+  }
+
+  // a frame with 'peaks_per_mz' ion mobility data points around each target m/z
+  OpenSwath::SpectrumPtr makeFrame(const std::vector<double>& target_mzs, std::size_t peaks_per_mz, unsigned seed)
+  {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> mz_jitter(-0.05, 0.05);
+    std::uniform_real_distribution<double> im_dist(0.5, 1.5);
+    std::uniform_real_distribution<double> int_dist(10.0, 1000.0);
+
+    OpenSwath::SpectrumPtr spec(new OpenSwath::Spectrum());
+    OpenSwath::BinaryDataArrayPtr mass(new OpenSwath::BinaryDataArray);
+    OpenSwath::BinaryDataArrayPtr intensity(new OpenSwath::BinaryDataArray);
+    OpenSwath::BinaryDataArrayPtr ion_mobility(new OpenSwath::BinaryDataArray);
+    ion_mobility->description = "Ion Mobility";
+
+    for (double target : target_mzs)
+    {
+      std::vector<double> mzs(peaks_per_mz);
+      for (auto& mz : mzs) mz = target + mz_jitter(rng);
+      std::sort(mzs.begin(), mzs.end()); // spectra are expected to be sorted by m/z
+      for (double mz : mzs)
+      {
+        mass->data.push_back(mz);
+        intensity->data.push_back(int_dist(rng));
+        ion_mobility->data.push_back(im_dist(rng));
+      }
+    }
+    spec->setMZArray(mass);
+    spec->setIntensityArray(intensity);
+    spec->getDataArrays().push_back(ion_mobility);
+    return spec;
+  }
+}
+
+static void IonMobilityScoring_driftScoring(benchmark::State& state)
+{
+  const std::size_t peaks_per_mz = state.range(0);
+  const auto transitions = makeTransitions(6);
+  std::vector<double> product_mzs;
+  for (const auto& tr : transitions) product_mzs.push_back(tr.product_mz);
+  std::vector<OpenSwath::SpectrumPtr> spectra{makeFrame(product_mzs, peaks_per_mz, 4711)};
+
+  RangeMobility im_range(1.0);
+  im_range.minSpanIfSingular(1.0);
+
+  for (auto _ : state)
+  {
+    OpenSwath_Scores scores;
+    IonMobilityScoring::driftScoring(spectra, transitions, scores, 1.0, im_range, 0.3, false, false, 0.25);
+    benchmark::DoNotOptimize(scores.im_xcorr_shape_score);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(IonMobilityScoring_driftScoring)->Arg(50)->Arg(200)->Arg(1000);
+
+static void IonMobilityScoring_driftScoringMS1Contrast(benchmark::State& state)
+{
+  const std::size_t peaks_per_mz = state.range(0);
+  const auto transitions = makeTransitions(6);
+  std::vector<double> product_mzs;
+  for (const auto& tr : transitions) product_mzs.push_back(tr.product_mz);
+  std::vector<OpenSwath::SpectrumPtr> spectra{makeFrame(product_mzs, peaks_per_mz, 4711)};
+  std::vector<OpenSwath::SpectrumPtr> ms1spectrum{makeFrame({transitions[0].precursor_mz}, peaks_per_mz, 815)};
+
+  RangeMobility im_range(1.0);
+  im_range.minSpanIfSingular(1.0);
+
+  for (auto _ : state)
+  {
+    OpenSwath_Scores scores;
+    IonMobilityScoring::driftScoringMS1Contrast(spectra, ms1spectrum, transitions, scores, im_range, 0.3, false, 0.25);
+    benchmark::DoNotOptimize(scores.im_ms1_contrast_shape);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(IonMobilityScoring_driftScoringMS1Contrast)->Arg(50)->Arg(200)->Arg(1000);
@@ -0,0 +1,76 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <OpenMS/KERNEL/MSSpectrum.h>
+
+#include <random>
+
+using namespace OpenMS;
+
+namespace
+{
+  // fixed seed: results must be comparable across runs and releases
+  MSSpectrum randomSpectrum(Size size)
+  {
+    std::mt19937 rng(4711);
+    std::uniform_real_distribution<double> mz(100.0, 2000.0);
+    std::uniform_real_distribution<float> intensity(0.0f, 1e6f);
+
+    MSSpectrum spec;
+    spec.resize(size);
+    for (Size i = 0; i < size; ++i)
+    {
+      spec[i].setMZ(mz(rng));
+      spec[i].setIntensity(intensity(rng));
+    }
+    return spec;
+  }
+}
+
+static void MSSpectrum_sortByPosition(benchmark::State& state)
+{
+  const MSSpectrum spec = randomSpectrum(state.range(0));
+  for (auto _ : state)
+  {
+    MSSpectrum copy = spec;
+    copy.sortByPosition();
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(MSSpectrum_sortByPosition)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void MSSpectrum_sortByIntensity(benchmark::State& state)
+{
+  const MSSpectrum spec = randomSpectrum(state.range(0));
+  for (auto _ : state)
+  {
+    MSSpectrum copy = spec;
+    copy.sortByIntensity();
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(MSSpectrum_sortByIntensity)->Arg(1000)->Arg(100000);
+
+static void MSSpectrum_findNearest(benchmark::State& state)
+{
+  MSSpectrum spec = randomSpectrum(state.range(0));
+  spec.sortByPosition();
+
+  std::mt19937 rng(815);
+  std::uniform_real_distribution<double> mz(100.0, 2000.0);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(spec.findNearest(mz(rng)));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(MSSpectrum_findNearest)->Arg(1000)->Arg(100000);
@@ -0,0 +1,65 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <OpenMS/OPENSWATHALGO/ALGO/Scoring.h>
+
+#include <cmath>
+#include <random>
+
+using namespace OpenSwath;
+
+namespace
+{
+  // two overlapping, noisy chromatogram-like traces of typical OpenSWATH length
+  std::vector<double> noisyPeak(std::size_t size, double apex_pos, unsigned seed)
+  {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> noise(0.0, 10.0);
+    std::vector<double> data(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      const double d = (double(i) - apex_pos) / (double(size) * 0.1);
+      data[i] = 1000.0 * std::exp(-d * d) + noise(rng);
+    }
+    return data;
+  }
+}
+
+static void Scoring_normalizedCrossCorrelation(benchmark::State& state)
+{
+  const std::size_t size = state.range(0);
+  const std::vector<double> data1 = noisyPeak(size, size * 0.5, 4711);
+  const std::vector<double> data2 = noisyPeak(size, size * 0.55, 815);
+  const int maxdelay = int(size) / 2;
+
+  for (auto _ : state)
+  {
+    std::vector<double> d1 = data1; // normalized in place
+    std::vector<double> d2 = data2;
+    benchmark::DoNotOptimize(Scoring::normalizedCrossCorrelation(d1, d2, maxdelay, 1));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Scoring_normalizedCrossCorrelation)->Arg(50)->Arg(200)->Arg(1000);
+
+static void Scoring_calculateCrossCorrelation(benchmark::State& state)
+{
+  const std::size_t size = state.range(0);
+  const std::vector<double> data1 = noisyPeak(size, size * 0.5, 4711);
+  const std::vector<double> data2 = noisyPeak(size, size * 0.55, 815);
+  const int maxdelay = int(size) / 2;
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(Scoring::calculateCrossCorrelation(data1, data2, maxdelay, 1));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Scoring_calculateCrossCorrelation)->Arg(50)->Arg(200)->Arg(1000);
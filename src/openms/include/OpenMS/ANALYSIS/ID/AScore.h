@@ -16,6 +16,9 @@
 #include <OpenMS/ANALYSIS/ID/PScore.h>
 
 #include <limits>
+#include <map>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 namespace OpenMS
@@ -64,7 +67,42 @@ namespace OpenMS
     */
     PeptideHit compute(const PeptideHit& hit, PeakSpectrum& real_spectrum);
 
+    /**
+        @brief Computes the AScore for a batch of PSMs in parallel (openMP).
+
+        Equivalent to calling compute() for every hit/spectrum pair, but the PSMs are
+        distributed over threads and the theoretical spectra of the phospho-site
+        permutations are generated only once per peptide and phospho count and shared
+        across all PSMs of that peptide (see permutationSpectra_()).
+
+        @param hits the PeptideHits to score
+        @param real_spectra one spectrum pointer per hit; several hits may point to the
+               same spectrum. The spectra are sorted by position up front and are not
+               modified afterwards.
+    */
+    std::vector<PeptideHit> compute(const std::vector<PeptideHit>& hits, const std::vector<PeakSpectrum*>& real_spectra);
+
   protected:
+    /// Permutations of one peptide and the theoretical spectra generated from them
+    struct PermutationSpectra_
+    {
+      std::vector<std::vector<Size>> permutations;
+      std::vector<PeakSpectrum> th_spectra; ///< left empty if the number of permutations exceeds 'max_num_perm'
+    };
+
+    /// Scores one PSM against its (sorted) spectrum; thread-safe workhorse behind both compute() variants
+    PeptideHit computeHit_(const PeptideHit& hit, const PeakSpectrum& real_spectrum) const;
+
+    /**
+        @brief Returns the permutations and theoretical spectra for one peptide, memoized across calls.
+
+        The entry is built on first use and shared by all PSMs of the same peptide
+        (without phospho) and phospho count, so the theoretical spectra are generated
+        only once per peptide instead of once per PSM. Thread-safe; the returned
+        reference stays valid until the parameters change (see updateMembers_()).
+    */
+    const PermutationSpectra_& permutationSpectra_(const AASequence& seq_without_phospho, const std::vector<Size>& sites, Size number_of_phosphorylation_events) const;
+
     int compareMZ_(double mz1, double mz2) const;
     
     /// getSpectrumDifference_ works similar as the method std::set_difference (http://en.cppreference.com/w/cpp/algorithm/set_difference). 
@@ -157,10 +195,10 @@ namespace OpenMS
     std::vector<PeakSpectrum> createTheoreticalSpectra_(const std::vector<std::vector<Size>>& permutations, const AASequence& seq_without_phospho) const;
     
     /// Pick top 10 intensity peaks for each 100 Da windows
-    std::vector<PeakSpectrum> peakPickingPerWindowsInSpectrum_(PeakSpectrum& real_spectrum) const;
-    
+    std::vector<PeakSpectrum> peakPickingPerWindowsInSpectrum_(const PeakSpectrum& real_spectrum) const;
+
     /// Create 10 scores for each theoretical spectrum (permutation), according to Beausoleil et al. Figure 3 b
-    std::vector<std::vector<double>> calculatePermutationPeptideScores_(std::vector<PeakSpectrum>& th_spectra, const std::vector<PeakSpectrum>& windows_top10) const;
+    std::vector<std::vector<double>> calculatePermutationPeptideScores_(const std::vector<PeakSpectrum>& th_spectra, const std::vector<PeakSpectrum>& windows_top10, double base_match_probability) const;
     
     /// Rank weighted permutation scores ascending
     std::multimap<double, Size> rankWeightedPermutationPeptideScores_(const std::vector<std::vector<double>>& peptide_site_scores) const;
@@ -174,7 +212,9 @@ namespace OpenMS
     Size max_peptide_length_; ///< Limit for peptide lengths that can be analyzed
     Size max_permutations_; ///< Limit for number of sequence permutations that can be handled
     double unambiguous_score_; ///< Score for unambiguous assignments (all sites phosphorylated)
-    double base_match_probability_; ///< Probability of a match at a peak depth of 1
+
+    mutable std::map<std::pair<String, Size>, PermutationSpectra_> permutation_cache_; ///< Memoized permutation spectra, keyed by peptide (without phospho) and phospho count
+    mutable std::mutex permutation_cache_mutex_; ///< Guards permutation_cache_
   };
 
 } // namespace OpenMS
@@ -310,6 +310,10 @@ private:
     };
     std::vector<MappingEntry_> mass_mappings_;
 
+    /// flat copy of the (sorted) masses in mass_mappings_; binary search on a
+    /// contiguous array of doubles avoids pulling the string-heavy entries into cache
+    std::vector<double> mass_flat_;
+
     struct CompareEntryAndMass_ // defined here to allow for inlining by compiler
     {
       double asMass(const MappingEntry_& v) const
@@ -352,6 +352,39 @@ namespace OpenMS
     */
     void compressTrie();
 
+    /**
+      @brief Writes the compressed (BFS) trie to a binary file
+
+      The file contains a format version, an endianness and layout guard and
+      the @p source_checksum, so a cached trie can be validated by load()
+      before it is used. The node array is written as one contiguous block.
+
+      Call compressTrie() before storing; the naive (uncompressed) trie cannot be stored.
+
+      @param filename Output file
+      @param source_checksum Free-form string identifying the needle source (e.g. a FASTA checksum plus digestion parameters)
+      @throw Exception::Precondition if the trie is empty or not compressed
+      @throw Exception::UnableToCreateFile if the file cannot be written
+    */
+    void store(const String& filename, const String& source_checksum) const;
+
+    /**
+      @brief Loads a compressed (BFS) trie from a binary file written by store()
+
+      On success, the trie is ready for searching (no call to compressTrie()
+      needed) and any previous content is discarded. If the checksum stored in
+      the file differs from @p expected_source_checksum, the trie is left
+      unchanged and false is returned (i.e. the cache is stale and the caller
+      should rebuild).
+
+      @param filename Input file
+      @param expected_source_checksum The checksum the cached trie must have been built from
+      @return true if the trie was loaded; false on checksum mismatch
+      @throw Exception::FileNotFound if the file cannot be opened
+      @throw Exception::ParseError if the file is corrupt or was written by an incompatible version/platform
+    */
+    bool load(const String& filename, const String& expected_source_checksum);
+
     /// How many needles were added to the trie?
     size_t getNeedleCount() const;
 
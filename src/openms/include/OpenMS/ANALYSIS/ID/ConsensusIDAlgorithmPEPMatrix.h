@@ -35,6 +35,9 @@ namespace OpenMS
     /// object for alignment score calculation
     NeedlemanWunsch alignment_;
 
+    /// Cache for self-alignment scores of unmodified sequences (needed for normalization)
+    std::map<String, double> self_scores_;
+
     /// Not implemented
     ConsensusIDAlgorithmPEPMatrix(const ConsensusIDAlgorithmPEPMatrix&);
 
@@ -44,6 +47,13 @@ namespace OpenMS
     /// Sequence similarity based on substitution matrix (ignores PTMs)
     double getSimilarity_(AASequence seq1, AASequence seq2) override;
 
+    /// Batch-compute (in parallel) and cache the similarities of all cross-run sequence pairs
+    void prepareSimilarities_(
+      const std::vector<PeptideIdentification>& ids) override;
+
+    /// Self-alignment score of an unmodified sequence, using/updating the cache
+    double selfScore_(const String& unmod_seq);
+
     // Docu in base class
     void updateMembers_() override;
   };
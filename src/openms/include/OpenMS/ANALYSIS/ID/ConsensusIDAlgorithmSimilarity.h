@@ -47,6 +47,14 @@ namespace OpenMS
     */
     virtual double getSimilarity_(AASequence seq1, AASequence seq2) = 0;
 
+    /**
+       @brief Hook for batch-computing similarities before consensus scoring starts.
+
+       Called once per group of identifications, before getSimilarity_() is queried for individual pairs. Subclasses with expensive similarity calculations can override this to fill the cache for all required sequence pairs in one go (e.g. in parallel). The default implementation does nothing.
+    */
+    virtual void prepareSimilarities_(
+      const std::vector<PeptideIdentification>& ids);
+
   private:
     /// Not implemented
     ConsensusIDAlgorithmSimilarity(const ConsensusIDAlgorithmSimilarity&);
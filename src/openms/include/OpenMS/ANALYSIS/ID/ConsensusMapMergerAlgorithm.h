@@ -64,6 +64,17 @@ namespace OpenMS
     void mergeProteinIDRuns(ConsensusMap &cmap,
                             const std::map<unsigned, unsigned>& mapIdx_to_new_protIDRun) const;
 
+    /// Merges several consensusXML files into one output file without holding all inputs in
+    /// memory at the same time: inputs are loaded one after another and their columns are moved
+    /// into the output map, so peak memory is bounded by the output plus a single input instead
+    /// of the whole cohort. The merged features are sorted by position (RT, m/z), which allows
+    /// downstream tools to process the result with a bounded RT window.
+    /// @note Column (map) indices of later inputs are shifted behind the ones of earlier inputs,
+    ///       as in ConsensusMap::appendColumns(). Protein ID runs are concatenated; apply
+    ///       mergeAllIDRuns() or mergeProteinIDRuns() on the result if a merged run is needed.
+    /// @throws MissingInformationException if @p in_files is empty
+    void mergeConsensusMaps(const StringList& in_files, const String& out_file) const;
+
   private:
 
     /// Checks consistency of search engines and settings across runs before merging.
@@ -51,13 +51,81 @@ struct OPENMS_DLLAPI HyperScore
     double mean_error = 0.0;
   };
 
-  static double computeWithDetail(double fragment_mass_tolerance, 
-                        bool fragment_mass_tolerance_unit_ppm, 
-                        const PeakSpectrum& exp_spectrum, 
+  static double computeWithDetail(double fragment_mass_tolerance,
+                        bool fragment_mass_tolerance_unit_ppm,
+                        const PeakSpectrum& exp_spectrum,
                         const PeakSpectrum& theo_spectrum,
                         PSMDetail& d
                        );
 
+  /** @brief compute the (ln transformed) X!Tandem HyperScore from plain fragment m/z arrays
+   *  Overload for bulk scoring: instead of a theoretical PeakSpectrum with ion name
+   *  annotations, the singly charged b- and y-ion m/z values are passed as sorted arrays
+   *  (e.g. filled by TheoreticalSpectrumGenerator::getBYIonMZs() into reused buffers).
+   *  All theoretical peaks are assumed to have unit intensity, so the result is identical
+   *  to scoring the default b/y spectrum of TheoreticalSpectrumGenerator, without
+   *  constructing a spectrum or string annotations per candidate.
+   * @param fragment_mass_tolerance mass tolerance applied left and right of the theoretical peak position
+   * @param fragment_mass_tolerance_unit_ppm Unit of the mass tolerance is: Thomson if false, ppm if true
+   * @param exp_spectrum measured spectrum (sorted by m/z)
+   * @param b_ion_mzs m/z values of the singly charged b-ions, sorted ascending
+   * @param y_ion_mzs m/z values of the singly charged y-ions, sorted ascending
+   * @param d additional information on the match
+   */
+  static double computeWithDetail(double fragment_mass_tolerance,
+                        bool fragment_mass_tolerance_unit_ppm,
+                        const PeakSpectrum& exp_spectrum,
+                        const std::vector<double>& b_ion_mzs,
+                        const std::vector<double>& y_ion_mzs,
+                        PSMDetail& d
+                       );
+
+  /** @brief Theoretical b-/y-ion m/z values of many candidates, packed into flat arrays
+   *  Candidate i owns the ranges [b_offsets[i], b_offsets[i+1]) and
+   *  [y_offsets[i], y_offsets[i+1]) of the concatenated m/z arrays (each range
+   *  sorted ascending, e.g. filled via TheoreticalSpectrumGenerator::getBYIonMZs()).
+   *  This layout keeps the batch scoring loop on plain contiguous doubles.
+   */
+  struct OPENMS_DLLAPI PackedCandidates
+  {
+    std::vector<double> b_ion_mzs; ///< concatenated b-ion m/z values of all candidates
+    std::vector<double> y_ion_mzs; ///< concatenated y-ion m/z values of all candidates
+    std::vector<Size> b_offsets;   ///< size() + 1 range delimiters into b_ion_mzs
+    std::vector<Size> y_offsets;   ///< size() + 1 range delimiters into y_ion_mzs
+
+    /// number of packed candidates
+    Size size() const
+    {
+      return b_offsets.empty() ? 0 : b_offsets.size() - 1;
+    }
+
+    /// removes all candidates (keeps the allocated memory)
+    void clear();
+
+    /// appends one candidate given its sorted b-/y-ion m/z arrays
+    void addCandidate(const std::vector<double>& b_mzs, const std::vector<double>& y_mzs);
+  };
+
+  /** @brief score many candidates against one observed spectrum in a single call
+   *  Scores are identical to calling computeWithDetail() with the same ion arrays
+   *  per candidate (unit theoretical intensities). The observed spectrum is unpacked
+   *  into flat m/z / intensity arrays once and the candidate loop runs only on plain
+   *  doubles, parallelized over candidates with OpenMP; the same structure admits a
+   *  SIMD or offload backend later.
+   * @param fragment_mass_tolerance mass tolerance applied left and right of the theoretical peak position
+   * @param fragment_mass_tolerance_unit_ppm Unit of the mass tolerance is: Thomson if false, ppm if true
+   * @param exp_spectrum measured spectrum (sorted by m/z)
+   * @param candidates packed theoretical ions of all candidates
+   * @param scores output, one score per candidate (resized to candidates.size())
+   * @param details optional output of per-candidate match details
+   */
+  static void computeBatch(double fragment_mass_tolerance,
+                           bool fragment_mass_tolerance_unit_ppm,
+                           const PeakSpectrum& exp_spectrum,
+                           const PackedCandidates& candidates,
+                           std::vector<double>& scores,
+                           std::vector<PSMDetail>* details = nullptr);
+
   private:
     /// helper to compute the log factorial
     static double logfactorial_(const int x, int base = 2);
@@ -104,6 +104,33 @@ public:
     */
     void annotate(FeatureMap& map, const std::vector<PeptideIdentification>& ids, const std::vector<ProteinIdentification>& protein_ids, bool use_centroid_rt = false, bool use_centroid_mz = false, const PeakMap& spectra = PeakMap());
 
+    /**
+      @brief Mapping method for feature maps using IdentificationData
+
+      Variant of the FeatureMap-based annotate() method that operates directly on the compact
+      IdentificationData representation, in which sequences and evidence are stored only once
+      (use IdentificationDataConverter to convert from the legacy identification classes at the
+      edges). The identifications in @p id_data are merged into the IdentificationData embedded
+      in @p map, and matching features are annotated with references to the observation matches
+      (BaseFeature::addIDMatch) - no PeptideIdentification/PeptideHit objects are created.
+      Matches that do not fit any feature simply remain unassigned; they can be retrieved with
+      FeatureMap::getUnassignedIDMatches().
+
+      Matching works as in the legacy method: against the (tolerance-extended) convex hull
+      bounding boxes, or the feature centroids if @p use_centroid_rt/@p use_centroid_mz are set
+      or convex hulls are missing. The m/z of a match is taken from its observation (parameter
+      @p mz_reference "precursor") or computed from the identified molecule and the match charge
+      (@p mz_reference "peptide").
+
+      @param map FeatureMap to receive the identifications
+      @param id_data Identification data to map (merged into the feature map)
+      @param use_centroid_rt Whether to use the RT value of feature centroids even if convex hulls are present
+      @param use_centroid_mz Whether to use the m/z value of feature centroids even if convex hulls are present
+
+      @exception Exception::MissingInformation is thrown if observations in @p id_data do not contain RT and m/z information.
+    */
+    void annotate(FeatureMap& map, const IdentificationData& id_data, bool use_centroid_rt = false, bool use_centroid_mz = false);
+
     /**
       @brief Mapping method for consensus maps
 
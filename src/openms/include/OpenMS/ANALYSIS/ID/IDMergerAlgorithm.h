@@ -29,6 +29,13 @@ namespace OpenMS
    * in that it is an algorithm class and it allows inserting multiple peptide hits per
    * peptide sequence (not only the first occurrence).
    *
+   * For merges which do not fit into memory (e.g. whole cohorts), set the
+   * 'max_psms_in_memory' parameter: accumulated peptide identifications are then spilled
+   * to sorted, gzip-compressed temporary idXML blocks on disk and merged again when the
+   * results are requested, so the memory footprint stays bounded by the block size
+   * (plus the protein union, which is always kept as a streaming accession set).
+   * In this mode the resulting peptide identifications are sorted by RT and m/z.
+   *
    * @todo allow filtering for peptide sequence to supersede the IDMerger tool.
    *       Make it keep the best PSMs though.
    */
@@ -107,6 +114,18 @@ namespace OpenMS
         std::vector<ProteinIdentification>&& old_protRuns
     );
 
+    /// Orders peptide identifications by RT, then m/z (IDs without RT/m/z sort to the front).
+    /// Used for the sorted spill blocks and the final merge.
+    static bool pepIDLess_(const PeptideIdentification& a, const PeptideIdentification& b);
+
+    /// Sorts the in-memory peptide IDs and spills them to a gzip-compressed temporary
+    /// idXML block; called whenever 'max_psms_in_memory' is exceeded
+    void spillPepIDsToDisk_();
+
+    /// Loads the spilled blocks one at a time and merges them (and the already sorted
+    /// in-memory rest in @p peps) into @p peps, keeping the sort order
+    void mergeSpilledPepIDs_(std::vector<PeptideIdentification>& peps);
+
     /// the resulting new Protein IDs
     ProteinIdentification prot_result_;
 
@@ -129,6 +148,9 @@ namespace OpenMS
     /// to keep track of the mzML origins of spectra
     std::map<String, Size> file_origin_to_idx_;
 
+    /// gzip-compressed temporary idXML blocks written by spillPepIDsToDisk_()
+    StringList spill_files_;
+
     /// the new identifier string
     String id_;
   };
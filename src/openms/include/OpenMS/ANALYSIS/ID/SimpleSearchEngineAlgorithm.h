@@ -9,7 +9,10 @@
 #include <OpenMS/CONCEPT/ProgressLogger.h>
 #include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
 
+#include <OpenMS/CHEMISTRY/DigestCache.h>
 #include <OpenMS/CHEMISTRY/ModifiedPeptideGenerator.h>
+#include <OpenMS/CHEMISTRY/ProteaseDigestion.h>
+#include <OpenMS/FORMAT/FASTAFile.h>
 #include <OpenMS/KERNEL/MSExperiment.h>
 #include <OpenMS/DATASTRUCTURES/StringView.h>
 
@@ -67,6 +70,25 @@ class OPENMS_DLLAPI SimpleSearchEngineAlgorithm :
     /// @brief filter, deisotope, decharge spectra
     static void preprocessSpectra_(PeakMap& exp, double fragment_mass_tolerance, bool fragment_mass_tolerance_unit_ppm);
 
+    /** @brief spectrum-centric search using a fragment-ion index
+
+        All theoretical b/y fragments of the (modified) candidate peptides are
+        binned into a flat, m/z-sorted index (built in parallel). Each spectrum
+        then looks up its peaks in the index to collect the candidates it shares
+        at least one fragment with; only those are scored with the regular
+        hyperscore, so the reported scores are identical to the ones of the
+        protein-centric search. Used if the 'fragment_index' parameter is set.
+    */
+    void searchWithFragmentIndex_(const PeakMap& spectra,
+      const std::vector<FASTAFile::FASTAEntry>& fasta_db,
+      ProteaseDigestion& digestor,
+      const DigestCache& digest_cache,
+      const ModifiedPeptideGenerator::MapToResidueType& fixed_modifications,
+      const ModifiedPeptideGenerator::MapToResidueType& variable_modifications,
+      bool precursor_mass_tolerance_unit_ppm,
+      bool fragment_mass_tolerance_unit_ppm,
+      std::vector<std::vector<AnnotatedHit_> >& annotated_hits) const;
+
     /// @brief filter and annotate search results
     /// most of the parameters are used to properly add meta data to the id objects
     void postProcessHits_(const PeakMap& exp, 
@@ -111,6 +133,10 @@ class OPENMS_DLLAPI SimpleSearchEngineAlgorithm :
 
     bool decoys_;
 
+    bool fragment_index_;
+
+    String digest_cache_dir_;
+
     StringList annotate_psm_;
 
     Size peptide_min_size_;
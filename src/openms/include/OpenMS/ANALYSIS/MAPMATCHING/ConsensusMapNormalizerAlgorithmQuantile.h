@@ -39,6 +39,22 @@ public:
      */
     static void normalizeMaps(ConsensusMap & map);
 
+    /**
+     * @brief approximate quantile normalization with bounded memory
+     *
+     * Streaming alternative to normalizeMaps() for very large maps: instead of
+     * materializing and sorting the full intensity vector of every map, a
+     * streaming quantile sketch (Math::QuantileSketch) is built per map in a
+     * single pass. Each intensity is then mapped onto the averaged reference
+     * quantile function of all sketches, so memory usage is independent of the
+     * number of features. The remapping pass runs in parallel over the
+     * consensus features.
+     *
+     * @param map ConsensusMap
+     * @param sketch_accuracy accuracy/memory trade-off of the per-map sketches (rank error ~ 1/sketch_accuracy)
+     */
+    static void normalizeMapsApproximate(ConsensusMap & map, Size sketch_accuracy = 200);
+
     /**
      * @brief resamples data_in and writes the results to data_out
      * @param data_in the data to be resampled
@@ -20,6 +20,10 @@ namespace OpenMS
 
     This particular algorithm accumulates the features from all input maps, then applies a variant of QT clustering to find groups of corresponding features. For more details, see QTClusterFinder.
 
+    In addition to the one-shot group() interface, the algorithm supports incremental sessions
+    (beginIncremental()/addMap()/retireMap()) in which single maps can be added to or removed from
+    an existing consensus without relinking the complete data set.
+
     @htmlinclude OpenMS_FeatureGroupingAlgorithmQT.parameters
 
     @ingroup FeatureGrouping
@@ -50,9 +54,59 @@ public:
 
         @exception IllegalArgument is thrown if less than two input maps are given.
     */
-    void group(const std::vector<ConsensusMap>& maps, 
+    void group(const std::vector<ConsensusMap>& maps,
                        ConsensusMap& out) override;
-                       
+
+    /**
+        @brief Starts an incremental grouping session on feature maps
+
+        Performs a full grouping of @p maps (equivalent to group()) and retains copies of the
+        input maps together with the resulting consensus map, so that single maps can later be
+        added (addMap()) or retired (retireMap()) without relinking the complete data set -
+        useful e.g. for rolling QC windows where one run enters and one leaves every day.
+
+        Features without valid unique ids are assigned new ones, since the session uses unique
+        ids to map consensus features back to their original features.
+
+        @pre The data ranges of the input maps have to be up-to-date (use FeatureMap::updateRanges).
+
+        @exception IllegalArgument is thrown if less than two input maps are given.
+    */
+    void beginIncremental(const std::vector<FeatureMap>& maps, ConsensusMap& out);
+
+    /**
+        @brief Adds one feature map to a running incremental session
+
+        Only consensus features in the vicinity of the new features are dissolved and relinked
+        (see relinkIncremental_()); the rest of the consensus map is kept as is. Protein
+        identifications and unassigned peptide identifications of @p map are appended to the
+        result, as in a full grouping run.
+
+        The result is identical to a full rerun on all maps of the session, except when
+        @p use_identifications is set: the RT linking tolerances are then re-estimated from the
+        relinked region only.
+
+        @pre The data range of @p map has to be up-to-date (use FeatureMap::updateRanges).
+
+        @return the map index assigned to the new map
+
+        @exception IllegalArgument is thrown if no session was started with beginIncremental().
+    */
+    Size addMap(const FeatureMap& map, ConsensusMap& out);
+
+    /**
+        @brief Retires one map from a running incremental session
+
+        All consensus features containing a feature of the retired map are dissolved and their
+        remaining features relinked locally. Unassigned peptide identifications of the retired
+        map are removed from the result; its protein identification runs are kept. Map indices
+        of the session are stable, i.e. the indices of the remaining maps do not change.
+
+        @exception IllegalArgument is thrown if no session was started with beginIncremental(),
+        or if @p map_index is invalid or already retired.
+    */
+    void retireMap(Size map_index, ConsensusMap& out);
+
 private:
 
     /// Copy constructor intentionally not implemented -> private
@@ -70,6 +124,32 @@ private:
     */
     template <typename MapType>
     void group_(const std::vector<MapType>& maps, ConsensusMap& out);
+
+    /**
+        @brief Dissolves and relinks the neighborhood of changed features in the incremental session
+
+        Computes the transitive closure of all consensus features within the linking tolerances
+        (@p distance_RT:max_difference / @p distance_MZ:max_difference) of a feature of
+        @p changed, removes them from the session result, and reruns the QT clustering on the
+        affected original features (plus all of @p changed itself, if @p is_new). Since no
+        cluster can reach across the closure boundary, relinking the dissolved region in
+        isolation yields the same consensus features as a full rerun - the same argument that
+        allows QTClusterFinder to process m/z partitions independently.
+
+        @param changed features that were added to (@p is_new) or removed from the session
+        @param changed_index map index of @p changed in the session
+        @param is_new whether @p changed is a newly added map (it is then included in the relinking)
+    */
+    void relinkIncremental_(const FeatureMap& changed, Size changed_index, bool is_new);
+
+    /// Input maps retained by the incremental session (retired maps are emptied; indices are stable)
+    std::vector<FeatureMap> session_maps_;
+
+    /// Current consensus map of the incremental session
+    ConsensusMap session_result_;
+
+    /// Whether an incremental session has been started
+    bool session_active_;
   };
 
 } // namespace OpenMS
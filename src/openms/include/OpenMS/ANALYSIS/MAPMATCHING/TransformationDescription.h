@@ -95,6 +95,14 @@ public:
     */
     double apply(double value) const;
 
+    /**
+      @brief Applies the transformation to all @p values, in place.
+
+      Batch version of apply(); evaluates the fitted model with a single
+      virtual call for the whole contiguous range.
+    */
+    void apply(std::vector<double>& values) const;
+
     /// Gets the type of the fitted model
     const String& getModelType() const;
 
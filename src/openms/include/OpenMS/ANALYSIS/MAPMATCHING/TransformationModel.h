@@ -76,7 +76,16 @@ namespace OpenMS
 
     /// Evaluates the model at the given value
     virtual double evaluate(double value) const;
-    
+
+    /**
+      @brief Evaluates the model at the given values, in place
+
+      Equivalent to calling evaluate() on every element of @p values, but a
+      single virtual call per batch; derived classes override this to avoid
+      the per-value dispatch.
+    */
+    virtual void evaluate(std::vector<double>& values) const;
+
     /**
     @brief Weight the data by the given weight function
 
@@ -68,6 +68,9 @@ public:
      */
     double evaluate(double value) const override;
 
+    /// Evaluates the model at the given values, in place
+    void evaluate(std::vector<double>& values) const override;
+
     /// Gets the default parameters
     static void getDefaultParameters(Param& params);
 
@@ -10,6 +10,7 @@
 
 #include <OpenMS/ANALYSIS/OPENSWATH/ChromatogramExtractorAlgorithm.h>
 
+#include <OpenMS/KERNEL/ChromatogramBundle.h>
 #include <OpenMS/KERNEL/MSExperiment.h>
 #include <OpenMS/ANALYSIS/TARGETED/TargetedExperiment.h>
 #include <OpenMS/ANALYSIS/MAPMATCHING/TransformationDescription.h>
@@ -201,10 +202,34 @@ public:
                               double im_extraction_window,
                               const String& filter) 
     {
-      ChromatogramExtractorAlgorithm().extractChromatograms(input, output, 
+      ChromatogramExtractorAlgorithm().extractChromatograms(input, output,
           extraction_coordinates, mz_extraction_window, ppm, im_extraction_window, filter);
     }
 
+    /**
+     * @brief Extract chromatograms into a contiguous ChromatogramBundle.
+     *
+     * Same extraction as above, but the result is stored as a single
+     * ChromatogramBundle (shared RT axis, one contiguous intensity matrix)
+     * instead of one heap allocation per chromatogram, which is much more
+     * cache friendly for the downstream scoring of many small chromatograms.
+     * Native ID, precursor m/z and product m/z of each chromatogram are
+     * filled from its extraction coordinates.
+     *
+     * All coordinates must span the same RT range (e.g. prepared with a
+     * negative rt_extraction_window), so that every chromatogram samples
+     * the same retention times.
+     *
+     * @throw Exception::InvalidParameter if the extracted chromatograms do not share one RT axis
+    */
+    void extractChromatograms(const OpenSwath::SpectrumAccessPtr input,
+                              ChromatogramBundle& output,
+                              const std::vector<ExtractionCoordinates>& extraction_coordinates,
+                              double mz_extraction_window,
+                              bool ppm,
+                              double im_extraction_window,
+                              const String& filter);
+
     /**
      * @brief Prepare the extraction coordinates from a TargetedExperiment
      *
@@ -73,6 +73,11 @@ public:
      * @param im_extraction_window Full window width (i.e. twice the tolerance) for IM extraction. Must be positive.
      * @param filter Which function to apply in m/z space (currently "tophat" only)
      *
+     * @note If all coordinates carry an RT restriction, spectra outside every
+     * restriction are skipped based on their meta data alone, i.e. their peak
+     * data is never requested from @p input. For on-disc input this reduces
+     * the I/O of targeted extraction to the relevant RT ranges of the file.
+     *
     */
     void extractChromatograms(const OpenSwath::SpectrumAccessPtr& input,
         std::vector< OpenSwath::ChromatogramPtr >& output,
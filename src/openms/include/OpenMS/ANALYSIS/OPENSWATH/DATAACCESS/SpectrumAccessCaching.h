@@ -0,0 +1,87 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/ANALYSIS/OPENSWATH/DATAACCESS/SpectrumAccessTransforming.h>
+#include <OpenMS/CONCEPT/Types.h>
+
+#include <map>
+
+namespace OpenMS
+{
+
+  /**
+   * @brief A caching decorator around any spectrum access implementation
+   *
+   * Wraps an ISpectrumAccess and keeps the most recently fetched spectra in a
+   * bounded cache. This is the middle ground between re-reading every
+   * spectrum from the underlying access (which OpenSWATH scoring does
+   * repeatedly for overlapping candidate peak groups) and loading the whole
+   * map into memory with SpectrumAccessOpenMSInMemory.
+   *
+   * The eviction is tuned to the scoring access pattern rather than plain
+   * LRU: scoring walks forward through the run in retention time but
+   * re-reads spectra close to the current position (neighboring candidates
+   * share DIA spectra). Since spectrum indices follow retention time, the
+   * cache therefore keeps a contiguous neighborhood of indices around the
+   * most recent request and evicts whichever cached spectrum is furthest
+   * from it - spectra far behind the moving RT window are dropped first,
+   * while local re-reads stay cached.
+   *
+   * Hit/miss counts are tracked and can be queried to tune the cache size.
+   *
+   * @note Like the other spectrum access implementations this class is not
+   * thread-safe; use lightClone() to give each thread its own cache over a
+   * clone of the underlying access.
+   */
+  class OPENMS_DLLAPI SpectrumAccessCaching :
+    public SpectrumAccessTransforming
+  {
+public:
+
+    /**
+      @brief Constructor
+
+      @param sptr The spectrum access to decorate
+      @param cache_size Maximal number of spectra to keep cached (0 disables caching)
+    */
+    explicit SpectrumAccessCaching(OpenSwath::SpectrumAccessPtr sptr, Size cache_size = 512);
+
+    /// Destructor
+    ~SpectrumAccessCaching() override;
+
+    /// Light clone operator (creates an empty cache over a clone of the underlying access)
+    boost::shared_ptr<OpenSwath::ISpectrumAccess> lightClone() const override;
+
+    /// Return the spectrum, from the cache if possible
+    OpenSwath::SpectrumPtr getSpectrumById(int id) override;
+
+    /// Number of requests served from the cache
+    Size getCacheHits() const;
+
+    /// Number of requests that had to go to the underlying access
+    Size getCacheMisses() const;
+
+    /// Drop all cached spectra (statistics are kept)
+    void clearCache();
+
+private:
+
+    /// Maximal number of cached spectra
+    Size cache_size_;
+    /// Cached spectra, ordered by index (and thus by retention time)
+    std::map<int, OpenSwath::SpectrumPtr> cache_;
+    /// Number of cache hits
+    Size cache_hits_;
+    /// Number of cache misses
+    Size cache_misses_;
+
+  };
+
+} //end namespace OpenMS
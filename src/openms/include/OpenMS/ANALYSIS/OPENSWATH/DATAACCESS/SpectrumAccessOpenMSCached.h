@@ -68,6 +68,15 @@ public:
 
     OpenSwath::SpectrumPtr getSpectrumById(int id) override;
 
+    /**
+      @brief Returns only the m/z strip [mz_start, mz_end] of a spectrum
+
+      Since the cached format stores the m/z array sorted and uncompressed,
+      the strip is located with a binary search directly on the on-disk data
+      and only the overlapping part of the arrays is read and decoded.
+    */
+    OpenSwath::SpectrumPtr getSpectrumMzSliceById(int id, double mz_start, double mz_end) override;
+
     OpenSwath::SpectrumMeta getSpectrumMetaById(int id) const override;
 
     std::vector<std::size_t> getSpectraByRT(double RT, double deltaRT) const override;
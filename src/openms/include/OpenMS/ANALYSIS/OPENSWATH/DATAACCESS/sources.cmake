@@ -11,6 +11,7 @@ SpectrumAccessOpenMSCached.h
 SpectrumAccessOpenMSInMemory.h
 SpectrumAccessSqMass.h
 SpectrumAccessTransforming.h
+SpectrumAccessCaching.h
 SpectrumAccessQuadMZTransforming.h
 )
 
@@ -18,6 +18,9 @@
 
 #include <OpenMS/KERNEL/RangeManager.h>
 
+#include <map>
+#include <mutex>
+
 namespace OpenMS
 {
   class TheoreticalSpectrumGenerator;
@@ -211,6 +214,19 @@ private:
     void getIsotopeIntysFromExpSpec_(double precursor_mz, const SpectrumSequence& spectrum, int charge_state, const RangeMobility& im_range,
                                      std::vector<double>& isotopes_int) const;
 
+    /**
+      @brief Get the max-normalized averagine isotope envelope for a neutral mass (cached)
+
+      The envelope is computed once per distinct mass with
+      CoarseIsotopePatternGenerator::estimateFromPeptideWeight() and kept in
+      averagine_cache_. The distinct masses are determined by the assay
+      library (product m/z times charge), so the table is filled during the
+      first candidates of a run and hit for every further candidate of the
+      same transition or precursor. Access is mutex-protected since one
+      DIAScoring object is shared by the scoring threads.
+    */
+    const std::vector<double>& getNormalizedAveragineEnvelope_(double mass) const;
+
     // Parameters
     double dia_extract_window_;
     double dia_byseries_intensity_min_;
@@ -221,6 +237,11 @@ private:
     bool dia_extraction_ppm_;
     bool dia_centroided_;
 
+    /// Cache of max-normalized averagine envelopes (neutral mass -> dia_nr_isotopes_ + 1 intensities)
+    mutable std::map<double, std::vector<double>> averagine_cache_;
+    /// protects averagine_cache_ (entries are never modified once inserted)
+    mutable std::mutex averagine_cache_mutex_;
+
     TheoreticalSpectrumGenerator * generator;
   };
 }
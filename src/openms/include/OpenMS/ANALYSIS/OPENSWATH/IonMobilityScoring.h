@@ -36,6 +36,10 @@ namespace OpenMS
    * - driftScoringMS1() performs scoring on precursor ion mobilograms extracted from a MS1 frame
    * - driftScoringMS1Contrast() performs cross correlation (contrast) scoring between precursor and fragment ion mobilograms
    *
+   * The scoring routines keep per-thread scratch buffers (ion mobilograms and
+   * the dense grid rows fed into the cross-correlation) which are reused
+   * across calls, so scoring many candidate peak groups does not allocate in
+   * steady state.
   */
   class OPENMS_DLLAPI IonMobilityScoring
   {
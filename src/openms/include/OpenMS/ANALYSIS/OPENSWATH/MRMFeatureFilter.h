@@ -18,6 +18,8 @@
 #include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
 #include <OpenMS/DATASTRUCTURES/String.h>
 
+#include <unordered_map>
+
 namespace OpenMS
 {
   class AbsoluteQuantitationMethod;
@@ -327,6 +329,34 @@ public:
     void initRange(const T& value, T& value_l, T& value_u) const;
 
 private:
+    /**
+      @brief Builds a lookup table from transition NativeID to transition
+
+      If several transitions share a NativeID, the first one is kept
+      (matching the first-match semantics of a linear scan over the
+      transitions).
+
+      @param[in] transitions Transitions from a TargetedExperiment
+
+      @return Map from NativeID to the corresponding transition. The pointers
+        reference into @p transitions and share its lifetime.
+    */
+    std::unordered_map<String, const ReactionMonitoringTransition*> buildTransitionIndex_(const TargetedExperiment& transitions) const;
+
+    /**
+      @brief Implementation of countLabelsAndTransitionTypes() on a pre-built transition index
+
+      Avoids re-scanning all transitions per subordinate when counting over
+      many component groups against the same TargetedExperiment.
+
+      @param component_group Component group with subordinates
+      @param transition_index Lookup table built by buildTransitionIndex_()
+
+      @return Map of labels/transition types and their corresponding number.
+    */
+    std::map<String,int> countLabelsAndTransitionTypes_(const Feature& component_group,
+      const std::unordered_map<String, const ReactionMonitoringTransition*>& transition_index) const;
+
     // Members
     /// flag or filter (i.e., remove) features that do not pass the QC
     String flag_or_filter_;
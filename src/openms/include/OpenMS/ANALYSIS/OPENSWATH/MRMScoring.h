@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 #include <OpenMS/DATASTRUCTURES/Matrix.h>
@@ -86,6 +87,15 @@ namespace OpenSwath
         /// Initialize the scoring object and building the cross-correlation matrix
         void initializeXCorrMatrix(const std::vector< std::vector< double > >& data);
 
+        /**
+           @brief Initialize the scoring object from a packed intensity matrix
+
+           @p data holds @p rows chromatograms of @p cols points each in a single
+           contiguous row-major array (e.g. MRMTransitionGroup::ChromatogramMatrix);
+           matrix rows are consumed directly, without per-chromatogram copies.
+        */
+        void initializeXCorrMatrix(const double* data, std::size_t rows, std::size_t cols);
+
         /// Initialize the scoring object and building the cross-correlation matrix
         void initializeXCorrMatrix(OpenSwath::IMRMFeature* mrmfeature, const std::vector<std::string>& native_ids);
 
@@ -72,7 +72,8 @@ namespace OpenMS
      * @param lag_intensity The computed intensity at the lag (output shape score) 
      * @param pearson_score The computed pearson score (output)
      * @param min_corr Minimal correlation needed to proceed computing the cross-correlations
-     * @param max_lag Currently unused
+     * @param max_lag Maximal lag (in data points) considered in the cross-correlation; the
+     *        lag scan is banded to [-max_lag, max_lag]. Pass a value <= 0 to scan the full trace length.
      * @param mindiff Minimal differences for matching up the two mass traces
      *
     */
@@ -12,11 +12,157 @@
 #include <OpenMS/KERNEL/MSExperiment.h>
 #include <OpenMS/ANALYSIS/TARGETED/TargetedExperiment.h>
 #include <OpenMS/OPENSWATHALGO/DATAACCESS/TransitionExperiment.h>
+#include <OpenMS/OPENSWATHALGO/DATAACCESS/SwathMap.h>
 #include <OpenMS/ANALYSIS/OPENSWATH/MRMFeatureFinderScoring.h>
 #include <OpenMS/CONCEPT/LogStream.h>
 
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace OpenMS
 {
+  /**
+    @brief Precursor m/z index over the transitions of a LightTargetedExperiment
+
+    Stores a (precursor m/z, transition index) table sorted by m/z together
+    with lookup maps from compound and protein identifiers to their positions
+    in the experiment. Repeated SWATH window queries then cost O(log n +
+    matches) instead of a linear scan over the whole transition library,
+    which matters when large libraries are distributed over many windows.
+
+    The index only holds positions into the experiment it was built from: the
+    experiment must outlive the index and must not be modified while the
+    index is in use. Once built, the index is read-only and can be shared
+    between threads.
+  */
+  class OPENMS_DLLAPI SwathTransitionIndex
+  {
+public:
+
+    /// Default constructor, call build() before querying
+    SwathTransitionIndex() = default;
+
+    /// Constructor that immediately indexes the given experiment
+    explicit SwathTransitionIndex(const OpenSwath::LightTargetedExperiment& targeted_exp);
+
+    /// Build the index for @p targeted_exp, replacing any previous content
+    void build(const OpenSwath::LightTargetedExperiment& targeted_exp);
+
+    /**
+      @brief Find the transitions falling into a SWATH window
+
+      Returns the indices of all transitions with lower < precursor m/z <
+      upper whose distance to the upper window edge is at least @p
+      min_upper_edge_dist, i.e. the same set a linear scan with
+      OpenSwathHelper::selectSwathTransitions() would select.
+
+      @param[in] min_upper_edge_dist Distance in Th to the upper edge
+      @param[in] lower Lower edge of SWATH window (in Th)
+      @param[in] upper Upper edge of SWATH window (in Th)
+
+      @return Matching transition indices in ascending index order
+    */
+    std::vector<Size> query(double min_upper_edge_dist, double lower, double upper) const;
+
+    /// Whether a compound with the given id exists in the indexed experiment
+    bool hasCompound(const std::string& id) const;
+
+    /// Position of a compound in the experiment's compound vector
+    /// @throw ElementNotFound If no compound with the given id was indexed
+    Size getCompoundIndex(const std::string& id) const;
+
+    /// Whether a protein with the given id exists in the indexed experiment
+    bool hasProtein(const std::string& id) const;
+
+    /// Position of a protein in the experiment's protein vector
+    /// @throw ElementNotFound If no protein with the given id was indexed
+    Size getProteinIndex(const std::string& id) const;
+
+private:
+
+    /// (precursor m/z, transition index) pairs, sorted by m/z, for binary search
+    std::vector<std::pair<double, Size>> mz_index_;
+
+    /// Compound id to position in the compound vector
+    std::unordered_map<std::string, Size> compound_index_;
+
+    /// Protein id to position in the protein vector
+    std::unordered_map<std::string, Size> protein_index_;
+  };
+
+  /**
+    @brief Isolation window index over a set of SwathMap objects
+
+    The inverse of SwathTransitionIndex: instead of asking which transitions
+    fall into a given window, it answers which fragment-ion (MS2) maps cover
+    a given precursor m/z. The (lower, upper) isolation bounds of all non-MS1
+    maps are kept sorted by their lower edge together with the width of the
+    widest window, so a point or interval query costs O(log n + candidates)
+    instead of a scan over all maps. This matters for overlapping-window and
+    SONAR schemes where hundreds of narrow windows tile the precursor range.
+
+    The index only holds positions into the map vector it was built from: the
+    vector must outlive the index and must not be reordered while the index
+    is in use. Once built, the index is read-only and can be shared between
+    threads.
+  */
+  class OPENMS_DLLAPI SwathMapIndex
+  {
+public:
+
+    /// Default constructor, call build() before querying
+    SwathMapIndex() = default;
+
+    /// Constructor that immediately indexes the given maps
+    explicit SwathMapIndex(const std::vector<OpenSwath::SwathMap>& swath_maps);
+
+    /// Build the index for @p swath_maps (MS1 maps are skipped), replacing any previous content
+    void build(const std::vector<OpenSwath::SwathMap>& swath_maps);
+
+    /**
+      @brief Find the MS2 maps whose isolation window contains a precursor m/z
+
+      Returns the positions of all non-MS1 maps with lower < precursor m/z <
+      upper, i.e. the same set a linear scan over the map vector would select.
+
+      @param[in] precursor_mz Precursor m/z to look up (in Th)
+
+      @return Matching map positions in ascending position order
+    */
+    std::vector<Size> query(double precursor_mz) const;
+
+    /**
+      @brief Find the MS2 maps whose isolation window contains an interval edge
+
+      Returns the positions of all non-MS1 maps containing at least one of
+      the two edges of [start, end] (inclusive on both sides), i.e. the
+      criterion used to pick the SONAR maps for a SONAR window.
+
+      @param[in] start Lower edge of the query interval (in Th)
+      @param[in] end Upper edge of the query interval (in Th)
+
+      @return Matching map positions in ascending position order
+    */
+    std::vector<Size> queryOverlap(double start, double end) const;
+
+private:
+
+    /// One indexed isolation window
+    struct Window
+    {
+      double lower;
+      double upper;
+      Size map_idx;
+    };
+
+    /// Non-MS1 isolation windows, sorted by their lower edge, for binary search
+    std::vector<Window> windows_;
+
+    /// Width of the widest indexed window (bounds how far below a query value a matching lower edge can lie)
+    double max_width_ = 0.0;
+  };
+
   /**
     @brief A helper class that is used by several OpenSWATH tools
   */
@@ -99,6 +245,28 @@ public:
                                        OpenSwath::LightTargetedExperiment& selected_transitions,
                                        double min_upper_edge_dist,
                                        double lower, double upper);
+
+    /**
+      @brief Select transitions between lower and upper using a prebuilt index
+
+      Produces the same result as the linear-scan overload above, but answers
+      the window query through a SwathTransitionIndex in O(log n + matches).
+      Build the index once per transition library and reuse it for all
+      windows; since it is read-only after construction, it can be shared
+      between threads processing different windows.
+
+      @param[in] targeted_exp Transition list for selection (the experiment @p index was built from)
+      @param[in] index Precursor m/z index built from @p targeted_exp
+      @param[out] selected_transitions Selected transitions for SWATH window
+      @param[in] min_upper_edge_dist Distance in Th to the upper edge
+      @param[in] lower Lower edge of SWATH window (in Th)
+      @param[in] upper Upper edge of SWATH window (in Th)
+    */
+    static void selectSwathTransitions(const OpenSwath::LightTargetedExperiment& targeted_exp,
+                                       const SwathTransitionIndex& index,
+                                       OpenSwath::LightTargetedExperiment& selected_transitions,
+                                       double min_upper_edge_dist,
+                                       double lower, double upper);
     /**
      @brief Match transitions with their "best" window across m/z and ion mobility, save results in a vector.
 
@@ -16,6 +16,7 @@
 #include <OpenMS/KERNEL/FeatureMap.h>
 
 #include <fstream>
+#include <set>
 
 namespace OpenMS
 {
@@ -95,6 +96,7 @@ namespace OpenMS
     bool use_ms1_traces_;
     bool sonar_;
     bool enable_uis_scoring_;
+    bool shard_output_;
 
   public:
 
@@ -172,6 +174,88 @@ namespace OpenMS
      */
     void writeLines(const std::vector<String>& to_osw_output);
 
+    /**
+     * @brief Enable or disable partitioned (sharded) output
+     *
+     * In shard mode the features of each SWATH window are committed to a
+     * separate shard file (see getShardFilename) and completed windows are
+     * recorded in a manifest (see getManifestFilename). This allows an
+     * interrupted run to resume without recomputing finished windows and
+     * allows shards computed on different nodes to be combined afterwards
+     * (see mergeShards / mergeShardFiles).
+     *
+     */
+    void setShardOutput(bool shard_output);
+
+    /// Whether output is partitioned into per SWATH window shards
+    bool shardOutput() const;
+
+    /// Name of the shard file holding the results of SWATH window @p swath_idx
+    String getShardFilename(Size swath_idx) const;
+
+    /// Name of the manifest file recording completed shards
+    String getManifestFilename() const;
+
+    /**
+     * @brief Create a writer targeting the shard of a single SWATH window
+     *
+     * The returned writer shares all settings with this writer but writes
+     * into the shard file of window @p swath_idx. A leftover shard file of
+     * an earlier, interrupted run is removed (shards not listed in the
+     * manifest may be incomplete). Call writeHeader on the returned writer
+     * before use.
+     *
+     */
+    OpenSwathOSWWriter createShardWriter(Size swath_idx) const;
+
+    /**
+     * @brief Read the shard manifest
+     *
+     * @returns The indices of all SWATH windows whose shards were completed
+     * by an earlier run (entries whose shard file no longer exists are
+     * ignored)
+     *
+     */
+    std::set<Size> readManifest() const;
+
+    /**
+     * @brief Record SWATH window @p swath_idx as completed in the manifest
+     *
+     * Only call this once all features of the window were flushed to its
+     * shard file.
+     *
+     * @note Only call inside an OpenMP critical section
+     *
+     */
+    void markShardDone(Size swath_idx);
+
+    /**
+     * @brief Merge all shards listed in the manifest into the final output
+     *
+     * The feature tables of all completed shards are concatenated into the
+     * output file (no rescoring takes place) and the shards and the manifest
+     * are removed afterwards. The output file is expected to contain the
+     * assay library tables only (as generated by copying the PQP file), the
+     * OSW tables are created by the merge.
+     *
+     */
+    void mergeShards();
+
+    /**
+     * @brief Merge a set of shard files into a single OSW file
+     *
+     * The feature tables of all shards are concatenated into @p
+     * merged_filename without rescoring; the RUN entry is taken from the
+     * first shard and all features are assigned to it. The merged file is
+     * expected to contain the assay library tables only (as generated by
+     * copying the PQP file), the OSW tables are created by the merge. The
+     * shard files are left untouched.
+     *
+     * @throws Exception::IllegalArgument if @p shard_filenames is empty
+     *
+     */
+    static void mergeShardFiles(const std::vector<String>& shard_filenames, const String& merged_filename);
+
   };
 
 }
@@ -186,6 +186,48 @@ public:
     };
     ///@}
 
+    /** @name computePeakProperties() output
+      The computePeakProperties() methods use this struct to save their results.
+    */
+    ///@{
+    struct PeakProperties
+    {
+      /**
+        The peak's area, height and apex position (see integratePeak())
+      */
+      PeakArea area;
+      /**
+        The peak's background area and height (see estimateBackground())
+      */
+      PeakBackground background;
+      /**
+        The peak's shape metrics (see calculatePeakShapeMetrics())
+      */
+      PeakShapeMetrics shape_metrics;
+    };
+    ///@}
+
+    /** @name Batched computePeakProperties() input
+      One integration request for the batched computePeakProperties() overload.
+    */
+    ///@{
+    struct PeakBoundary
+    {
+      /**
+        The index of the chromatogram which contains the peak
+      */
+      Size chromatogram_idx = 0;
+      /**
+        The left retention time boundary
+      */
+      double left = 0.0;
+      /**
+        The right retention time boundary
+      */
+      double right = 0.0;
+    };
+    ///@}
+
     /** @name Constant expressions for parameters
       
         Constants expressions used throughout the code and tests to set
@@ -508,6 +550,77 @@ public:
       const double peak_height, const double peak_apex_pos
     ) const;
 
+    /**
+      @brief Compute the area, background and shape metrics of a peak in one call.
+
+      Computes the same results as calling integratePeak(), estimateBackground()
+      and calculatePeakShapeMetrics() in sequence, but shares the work common to
+      the three computations: the boundary lookups are done once and, with
+      `fit_EMG` enabled, the EMG peak model is fitted only once instead of once
+      per method. The apex position and height determined during integration are
+      passed on to the background and shape computations.
+
+      @note Make sure the chromatogram is sorted with respect to retention time.
+
+      @throw Exception::InvalidParameter for class parameters `integration_type` and `baseline_type`.
+
+      @param[in] chromatogram The chromatogram which contains the peak
+      @param[in] left The left retention time boundary
+      @param[in] right The right retention time boundary
+
+      @return A struct containing the peak's area, background and shape metrics
+    */
+    PeakProperties computePeakProperties(
+      const MSChromatogram& chromatogram, const double left, const double right
+    ) const;
+
+    /**
+      @brief Compute the area, background and shape metrics of a peak in one call.
+
+      Computes the same results as calling integratePeak(), estimateBackground()
+      and calculatePeakShapeMetrics() in sequence, but shares the work common to
+      the three computations: the boundary lookups are done once and, with
+      `fit_EMG` enabled, the EMG peak model is fitted only once instead of once
+      per method. The apex position and height determined during integration are
+      passed on to the background and shape computations.
+
+      @note Make sure the spectrum is sorted with respect to mass-to-charge ratio.
+
+      @throw Exception::InvalidParameter for class parameters `integration_type` and `baseline_type`.
+
+      @param[in] spectrum The spectrum which contains the peak
+      @param[in] left The left mass-to-charge ratio boundary
+      @param[in] right The right mass-to-charge ratio boundary
+
+      @return A struct containing the peak's area, background and shape metrics
+    */
+    PeakProperties computePeakProperties(
+      const MSSpectrum& spectrum, const double left, const double right
+    ) const;
+
+    /**
+      @brief Compute the properties of many peaks in parallel.
+
+      Processes one (chromatogram, left, right) request per element of
+      @p boundaries; several requests may refer to the same chromatogram.
+      The individual requests are independent of each other and are executed
+      in parallel (OpenMP). The result at index `i` belongs to `boundaries[i]`.
+
+      @note Make sure the chromatograms are sorted with respect to retention time.
+
+      @throw Exception::InvalidValue if a request refers to a chromatogram index out of range.
+      @throw Exception::InvalidParameter for class parameters `integration_type` and `baseline_type`.
+
+      @param[in] chromatograms The chromatograms which contain the peaks
+      @param[in] boundaries The integration requests
+
+      @return One struct with area, background and shape metrics per request
+    */
+    std::vector<PeakProperties> computePeakProperties(
+      const std::vector<MSChromatogram>& chromatograms,
+      const std::vector<PeakBoundary>& boundaries
+    ) const;
+
     void getDefaultParameters(Param& params);
 
 protected:
@@ -519,7 +632,13 @@ protected:
       OPENMS_PRECONDITION(left <= right, "Left peak boundary must be smaller than right boundary!") // otherwise the code below will segfault (due to PosBegin/PosEnd)
       PeakContainerT emg_pc;
       const PeakContainerT& p = EMGPreProcess_(pc, emg_pc, left, right);
+      return integratePeakCore_(p, left, right);
+    }
 
+    /// Same as integratePeak_(), but expects EMGPreProcess_() to have been applied already
+    template <typename PeakContainerT>
+    PeakArea integratePeakCore_(const PeakContainerT& p, const double left, const double right) const
+    {
       std::function<double(const double, const double)>
       compute_peak_area_trapezoid = [&p](const double left, const double right)
       {
@@ -625,7 +744,16 @@ protected:
     {
       PeakContainerT emg_pc;
       const PeakContainerT& p = EMGPreProcess_(pc, emg_pc, left, right);
+      return estimateBackgroundCore_(p, left, right, peak_apex_pos);
+    }
 
+    /// Same as estimateBackground_(), but expects EMGPreProcess_() to have been applied already
+    template <typename PeakContainerT>
+    PeakBackground estimateBackgroundCore_(
+      const PeakContainerT& p, const double left, const double right,
+      const double peak_apex_pos
+    ) const
+    {
       const double int_l = p.PosBegin(left)->getIntensity();
       const double int_r = (p.PosEnd(right) - 1)->getIntensity();
       const double delta_int = int_r - int_l;
@@ -737,16 +865,26 @@ protected:
       const double peak_height, const double peak_apex_pos
     ) const
     {
-      PeakShapeMetrics psm;
-
-      if (pc.empty()) return psm; // return all '0'
+      if (pc.empty()) return PeakShapeMetrics(); // return all '0'
 
       // enforce order: left <= peakapex <= right
       if (!(left <= peak_apex_pos && peak_apex_pos <= right)) throw Exception::InvalidRange(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION);
 
       PeakContainerT emg_pc;
       const PeakContainerT& p = EMGPreProcess_(pc, emg_pc, left, right);
-    
+      return calculatePeakShapeMetricsCore_(p, left, right, peak_height, peak_apex_pos);
+    }
+
+    /// Same as calculatePeakShapeMetrics_(), but expects EMGPreProcess_() to have been applied
+    /// already and the boundaries and apex position to be validated
+    template <typename PeakContainerT>
+    PeakShapeMetrics calculatePeakShapeMetricsCore_(
+      const PeakContainerT& p, const double left, const double right,
+      const double peak_height, const double peak_apex_pos
+    ) const
+    {
+      PeakShapeMetrics psm;
+
       typename PeakContainerT::ConstIterator it_PosBegin_l = p.PosBegin(left);
       typename PeakContainerT::ConstIterator it_PosEnd_apex = p.PosBegin(peak_apex_pos); // if peak_apex_pos is correct, this will get the underlying iterator
       typename PeakContainerT::ConstIterator it_PosEnd_r = p.PosEnd(right); // past the end. Do not dereference (might be the true .end())
@@ -780,6 +918,25 @@ protected:
       return psm;
     }
 
+    template <typename PeakContainerT>
+    PeakProperties computePeakProperties_(const PeakContainerT& pc, double left, double right) const
+    {
+      OPENMS_PRECONDITION(left <= right, "Left peak boundary must be smaller than right boundary!")
+      PeakProperties props;
+
+      if (pc.empty()) return props; // return all '0'
+
+      PeakContainerT emg_pc;
+      // fit the EMG model (if enabled) only once for all three computations
+      const PeakContainerT& p = EMGPreProcess_(pc, emg_pc, left, right);
+
+      props.area = integratePeakCore_(p, left, right);
+      // the apex position and height found during integration are within [left, right]
+      props.background = estimateBackgroundCore_(p, left, right, props.area.apex_pos);
+      props.shape_metrics = calculatePeakShapeMetricsCore_(p, left, right, props.area.height, props.area.apex_pos);
+      return props;
+    }
+
 
 
     /**
@@ -75,11 +75,40 @@ public:
     */
     void pickChromatogram(const MSChromatogram& chromatogram, MSChromatogram& picked_chrom, MSChromatogram& smoothed_chrom);
 
+    /**
+      @brief Finds peaks in all chromatograms of a transition group in one pass
+
+      Batch version of pickChromatogram() for the chromatograms of one
+      MRMTransitionGroup, which share the same RT grid. All chromatograms are
+      smoothed with the same pre-tabulated filter kernel, and if @p
+      signal_to_noise is larger than zero, the noise level is estimated only
+      once, on the position-wise sum of all chromatograms, instead of once per
+      chromatogram. Since co-eluting transitions share their noise structure,
+      this is usually an equally good estimate; peak borders can differ
+      slightly from the per-chromatogram function where the estimates disagree.
+
+      @param chromatograms Input chromatograms (each sorted by RT)
+      @param picked_chroms One picked chromatogram per input, as produced by pickChromatogram()
+      @param smoothed_chroms One smoothed chromatogram per input
+    */
+    void pickChromatograms(const std::vector<MSChromatogram>& chromatograms,
+                           std::vector<MSChromatogram>& picked_chroms,
+                           std::vector<MSChromatogram>& smoothed_chroms);
+
 protected:
 
     void pickChromatogramCrawdad_(const MSChromatogram& chromatogram, MSChromatogram& picked_chrom);
 
-    void pickChromatogram_(const MSChromatogram& chromatogram, MSChromatogram& picked_chrom);
+    /**
+      @brief Performs the actual peak picking on an already smoothed chromatogram
+
+      If @p init_snt is false, the caller has already initialized the S/N
+      estimator (see pickChromatograms()).
+    */
+    void pickSmoothedChromatogram_(const MSChromatogram& chromatogram, const MSChromatogram& smoothed_chrom,
+                                   MSChromatogram& picked_chrom, bool init_snt);
+
+    void pickChromatogram_(const MSChromatogram& chromatogram, MSChromatogram& picked_chrom, bool init_snt = true);
 
     /**
       @brief Compute peak area (peak integration)
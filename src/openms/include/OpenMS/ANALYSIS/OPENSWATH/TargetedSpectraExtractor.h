@@ -95,6 +95,34 @@ public:
       {
         scores.clear();
         const BinnedSpectrum in_bs(spec, bin_size_, false, peak_spread_, bin_offset_);
+
+        // restrict the comparison to library entries with a compatible precursor m/z
+        // (if pruning is enabled and both query and library provide this information)
+        if (precursor_mz_tolerance_ > 0.0 && !spec.getPrecursors().empty() && !precursor_index_.empty())
+        {
+          const double precursor_mz = spec.getPrecursors().front().getMZ();
+          auto lower = std::lower_bound(precursor_index_.begin(), precursor_index_.end(),
+                                        std::make_pair(precursor_mz - precursor_mz_tolerance_, Size(0)));
+          for (; lower != precursor_index_.end() && lower->first <= precursor_mz + precursor_mz_tolerance_; ++lower)
+          {
+            const double cmp_score = cmp_bs_(in_bs, bs_library_[lower->second]);
+            if (cmp_score >= min_score)
+            {
+              scores.emplace_back(lower->second, cmp_score);
+            }
+          }
+          // library entries without precursor information are always considered
+          for (const Size i : no_precursor_idx_)
+          {
+            const double cmp_score = cmp_bs_(in_bs, bs_library_[i]);
+            if (cmp_score >= min_score)
+            {
+              scores.emplace_back(i, cmp_score);
+            }
+          }
+          return;
+        }
+
         for (Size i = 0; i < bs_library_.size(); ++i)
         {
           const double cmp_score = cmp_bs_(in_bs, bs_library_[i]);
@@ -110,9 +138,15 @@ public:
     private:
       BinnedSpectralContrastAngle cmp_bs_;
       std::vector<BinnedSpectrum> bs_library_;
+      /// library indices sorted by precursor m/z (entries with precursor information only)
+      std::vector<std::pair<double,Size>> precursor_index_;
+      /// library indices without precursor information (always compared when pruning)
+      std::vector<Size> no_precursor_idx_;
       double bin_size_ = 0.02; // Default for nominal mass: 1.0;
       UInt peak_spread_ = 0;
       double bin_offset_ = 0.0; // Default for nominal mass resolution: 0.4;
+      /// if > 0, only library entries within this precursor m/z tolerance are compared
+      double precursor_mz_tolerance_ = -1.0;
     };
 
     void getDefaultParameters(Param& params) const;
@@ -10,6 +10,8 @@
 
 #include <OpenMS/DATASTRUCTURES/Matrix.h>
 
+#include <map>
+
 // forward decl
 namespace Eigen
 {
@@ -47,20 +49,6 @@ public:
                                                                   const IsobaricQuantitationMethod* quant_method);
 
 private:
-    /**
-     @brief Fills the input vector for the Eigen/NNLS step given the ConsensusFeature.
-     */
-    static void fillInputVector_(Eigen::VectorXd& b,
-                                 Matrix<double>& m_b,
-                                 const ConsensusFeature& cf,
-                                 const ConsensusMap& cm);
-
-    /**
-     @brief
-     */
-    static void solveNNLS_(const Matrix<double>& correction_matrix,
-                           const Matrix<double>& m_b, Matrix<double>& m_x);
-
     /**
      @brief
      */
@@ -76,6 +64,7 @@ private:
     static float updateOutpuMap_(const ConsensusMap& consensus_map_in,
                                  ConsensusMap& consensus_map_out,
                                  Size current_cf,
+                                 const std::map<UInt64, Int>& channel_ids,
                                  const Matrix<double>& m_x);
   };
 } // namespace
@@ -50,21 +50,41 @@ public:
   {
   }
 
-  /// Add @p maps and balance kd-tree
+  /// Add @p maps and bulk-load the balanced kd-tree from all their features at once
   template <typename MapType>
   void addMaps(const std::vector<MapType>& maps)
   {
     num_maps_ = maps.size();
 
+    Size n = 0;
+    for (Size i = 0; i < num_maps_; ++i)
+    {
+      n += maps[i].size();
+    }
+    features_.reserve(features_.size() + n);
+    map_index_.reserve(map_index_.size() + n);
+    rt_.reserve(rt_.size() + n);
+
     for (Size i = 0; i < num_maps_; ++i)
     {
       const MapType& m = maps[i];
       for (typename MapType::const_iterator it = m.begin(); it != m.end(); ++it)
       {
-        addFeature(i, &(*it));
+        map_index_.push_back(i);
+        features_.push_back(&(*it));
+        rt_.push_back(it->getRT());
       }
     }
-    optimizeTree();
+
+    // building the balanced tree from all nodes in one go is much faster than
+    // inserting the nodes one at a time and rebalancing the grown tree afterwards
+    std::vector<KDTreeFeatureNode> nodes;
+    nodes.reserve(size());
+    for (Size i = 0; i < size(); ++i)
+    {
+      nodes.emplace_back(this, i);
+    }
+    kd_tree_.efficient_replace_and_optimise(nodes);
   }
 
   /// Add feature
@@ -106,6 +126,9 @@ public:
   /// Fill @p result with indices of all features compatible (wrt. RT, m/z, map index) to the feature with @p index
   void getNeighborhood(Size index, std::vector<Size>& result_indices, double rt_tol, double mz_tol, bool mz_ppm, bool include_features_from_same_map = false, double max_pairwise_log_fc = -1.0) const;
 
+  /// Batched getNeighborhood(): computes the neighborhoods of all @p indices (OpenMP-parallel, the tree is only read)
+  void getNeighborhoods(const std::vector<Size>& indices, std::vector<std::vector<Size> >& result_indices, double rt_tol, double mz_tol, bool mz_ppm, bool include_features_from_same_map = false, double max_pairwise_log_fc = -1.0) const;
+
   /// Fill @p result with indices of all features within the specified boundaries
   void queryRegion(double rt_low, double rt_high, double mz_low, double mz_high, std::vector<Size>& result_indices, Size ignored_map_index = std::numeric_limits<Size>::max()) const;
 
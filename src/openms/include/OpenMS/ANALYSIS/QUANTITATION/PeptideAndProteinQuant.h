@@ -15,6 +15,8 @@
 #include <OpenMS/METADATA/ProteinIdentification.h>
 #include <OpenMS/METADATA/ExperimentalDesign.h>
 
+#include <boost/container/flat_map.hpp>
+
 
 namespace OpenMS
 {
@@ -61,13 +63,19 @@ public:
     /// Mapping: peptide sequence (modified) -> peptide data
     typedef std::map<AASequence, PeptideData> PeptideQuant;
 
+    /// Mapping: peptide (unmodified) -> sample -> abundance.
+    /// Sorted by peptide like a std::map, but stored contiguously - iterating all
+    /// peptides of a protein (the inner loops of quantifyProteins()) avoids chasing
+    /// one heap node per peptide.
+    typedef boost::container::flat_map<String, SampleAbundances> PeptideAbundances;
+
     /// Quantitative and associated data for a protein
     struct ProteinData
     {
       /// mapping: peptide (unmodified) -> sample -> abundance
-      std::map<String, SampleAbundances> abundances;
+      PeptideAbundances abundances;
 
-      std::map<String, SampleAbundances> psm_counts;
+      PeptideAbundances psm_counts;
 
       /// mapping: sample -> total abundance
       SampleAbundances total_abundances;
@@ -230,13 +238,14 @@ private:
 
          The keys of @p abundances are stored ordered in @p result, best first.
     */
-    template <typename T>
-    void orderBest_(const std::map<T, SampleAbundances> & abundances,
-                    std::vector<T>& result)
+    template <typename MapType>
+    void orderBest_(const MapType& abundances,
+                    std::vector<typename MapType::key_type>& result)
     {
+      typedef typename MapType::key_type T;
       typedef std::pair<Size, double> PairType;
       std::multimap<PairType, T, std::greater<PairType> > order;
-      for (typename std::map<T, SampleAbundances>::const_iterator ab_it =
+      for (typename MapType::const_iterator ab_it =
              abundances.begin(); ab_it != abundances.end(); ++ab_it)
       {
         double total = 0.0;
@@ -92,7 +92,7 @@ namespace OpenMS
 
 
       /// get distribution for input mass. If input mass exceeds the maximum mass (specified in constructor), output for the maximum mass
-      IsotopeDistribution get(double mass) const;
+      const IsotopeDistribution& get(double mass) const;
 
       /// get max isotope index
       size_t getMaxIsotopeIndex() const;
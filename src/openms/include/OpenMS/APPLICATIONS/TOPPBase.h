@@ -112,6 +112,13 @@ public:
       - add a Doxygen page for the tool and add the page to TOPP.doxygen
       - hide the derived class in the OpenMS documentation by using Doxygen condition macros.
 
+    @note Startup cost is kept low deliberately: the chemistry databases (ElementDB, ResidueDB,
+    ModificationsDB) initialize lazily on first use, controlled vocabularies are only parsed when a
+    tool requests validation, and the TOPP tool list (ToolHandler::getTOPPToolList()) is built once
+    and cached. The version update check can be disabled by setting the environment variable
+    @p OPENMS_DISABLE_UPDATE_CHECK. Avoid touching these facilities in constructors of derived
+    tools, otherwise every invocation (including @p --help) pays for them.
+
     @todo: replace writeLog_, writeDebug_ with a logger concept
       we'd need something like -VLevels [LOGGERS] to specify which loggers shall print something
       the '-log' flag should clone all output to the log-file (maybe with custom [LOGGERS]), which can either be specified directly or is
@@ -52,7 +52,9 @@ namespace OpenMS
 public:
 
     /// Returns the list of official TOPP tools contained in the OpenMS/TOPP release.
-    static ToolListType getTOPPToolList(const bool includeGenericWrapper = false);
+    /// The list is built once and cached (building it requires parsing *.ttd files),
+    /// so repeated calls (e.g. one per TOPP tool invocation) are cheap.
+    static const ToolListType& getTOPPToolList(const bool includeGenericWrapper = false);
 
     /// get all types of a tool (empty if none)
     static StringList getTypes(const String& toolname);
@@ -69,6 +71,9 @@ public:
 
 private:
 
+    /// Builds the tool list returned (and cached) by getTOPPToolList()
+    static ToolListType createTOPPToolList_(const bool includeGenericWrapper);
+
     static Internal::ToolDescription getExternalTools_();
     static QStringList getExternalToolConfigFiles_();
     static void loadExternalToolConfig_();
@@ -597,6 +597,25 @@ protected:
     static AASequence fromString(const char* s,
                                  bool permissive = true);
 
+    /**
+      @brief create AASequence objects by parsing several OpenMS strings at once
+
+      Equivalent to calling fromString() on each element of @p sequences.
+      Where supported, the sequences are parsed in parallel: since the residue
+      name lookups read lock-free, parsing scales with the number of threads
+      (only sequences carrying a modification seen for the first time take a
+      lock to register the modified residue).
+
+      @param sequences Input strings
+      @param permissive If set, skip spaces and replace stop codon symbols ("*", "#", "+") by "X" (unknown amino acid) during parsing
+
+      @throws Exception::ParseError if an invalid string representation of an AA sequence is passed
+
+      @return Parsed sequences, in the order of @p sequences
+    */
+    static std::vector<AASequence> fromStrings(const std::vector<String>& sequences,
+                                               bool permissive = true);
+
   protected:
 
     std::vector<const Residue*> peptide_;
@@ -9,12 +9,16 @@
 #pragma once
 
 #include <OpenMS/CONCEPT/Types.h>
+#include <OpenMS/FORMAT/FASTAFile.h>
 #include <OpenMS/MATH/MISC/MathFunctions.h>
 
+#include <vector>
+
 namespace OpenMS
 {
   class AASequence;
   class DigestionEnzymeProtein;
+  class ProteaseDigestion;
 
   /**
      @brief Methods to generate isobaric decoy sequences for DDA target-decoy searches.
@@ -53,13 +57,72 @@ namespace OpenMS
             const String& protease,
             const int max_attempts = 100
             );
-    
+
+      /// decoy generation method of the byte-level bulk interface
+      enum class Method
+      {
+        REVERSE_PROTEIN,  ///< reverse the full protein sequence (see reverseProtein())
+        REVERSE_PEPTIDES, ///< reverse between enzymatic cutting sites, keeping the sites in place (see reversePeptides())
+        SHUFFLE_PEPTIDES  ///< shuffle between enzymatic cutting sites, minimizing sequence identity (see shufflePeptides())
+      };
+
+      /*
+          @brief byte-level counterpart of reverseProtein()/reversePeptides()/shufflePeptides()
+
+          Operates directly on the plain sequence string (no AASequence construction or parsing),
+          which is considerably faster on large databases. @p digestion must be configured with
+          zero missed cleavages and SPEC_NONE (see appendDecoys() for the canonical setup);
+          it is only used by the peptide-level methods. Shuffling draws from @p shuffler.
+      */
+      static String generateDecoySequence(
+            const String& sequence,
+            Method method,
+            const ProteaseDigestion& digestion,
+            int max_attempts,
+            Math::RandomShuffler& shuffler);
+
+      /*
+          @brief appends a decoy entry for every entry of @p db (parallel over proteins)
+
+          Decoy sequences are generated byte-level via generateDecoySequence(); decoy accessions
+          get @p decoy_string prepended (or appended, if @p decoy_string_prefix is false).
+          Shuffling is seeded per protein from the generator seed (see setSeed()), so results are
+          reproducible independent of the number of threads.
+      */
+      void appendDecoys(
+            std::vector<FASTAFile::FASTAEntry>& db,
+            Method method,
+            const String& protease,
+            const String& decoy_string = "DECOY_",
+            bool decoy_string_prefix = true,
+            int max_attempts = 100) const;
+
+      /*
+          @brief streams a FASTA database from @p in_fasta to @p out_fasta, writing each target entry followed by its decoy
+
+          Entries are read in batches of @p batch_size via FASTAFile::readNext(), decoy sequences
+          are generated in parallel (see appendDecoys()) and written out via FASTAFile::writeNext(),
+          so only one batch is held in memory instead of both databases.
+      */
+      void generateDecoyDatabase(
+            const String& in_fasta,
+            const String& out_fasta,
+            Method method,
+            const String& protease,
+            const String& decoy_string = "DECOY_",
+            bool decoy_string_prefix = true,
+            int max_attempts = 100,
+            Size batch_size = 50000) const;
+
     private:
       // sequence identity by matching AAs
       static double SequenceIdentity_(const String& decoy, const String& target);
 
       // portable shuffle
       Math::RandomShuffler shuffler_;
+
+      // seed of shuffler_; base for the per-protein shufflers of the bulk interface
+      UInt64 seed_;
   };
 }
 
@@ -0,0 +1,164 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/CHEMISTRY/EnzymaticDigestion.h>
+#include <OpenMS/DATASTRUCTURES/String.h>
+#include <OpenMS/FORMAT/FASTAFile.h>
+#include <OpenMS/SYSTEM/MemoryMappedFile.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Persistent on-disk cache of a digested protein database
+
+    Digesting a large FASTA file is repeated identically in every search with the
+    same database and digestion settings. This class stores the complete digest
+    once as packed EnzymaticDigestion::PeptideMass records (position, length and
+    monoisotopic mass per peptide) together with a per-protein offset table, and
+    later runs map the file back into memory instead of digesting again.
+    Accessors return read-only views directly into the mapped records, so loading
+    a cache costs no per-peptide allocations.
+
+    A cache file is identified by a key derived from the database content (the
+    protein sequences in their final order, i.e. including generated decoys) and
+    all digestion-relevant parameters. The key is part of the file name and is
+    also embedded in the file, so a parameter or database change simply leads to
+    a different file and a stale cache can never be mistaken for a valid one.
+    load() returns false for a missing, truncated or mismatching file and callers
+    are expected to re-digest and store() in that case.
+
+    The file stores native-endian integers of type Size, like the cached mzML
+    format; cache files are thus not portable between platforms of different
+    word size or endianness, which is fine for their role as local scratch data.
+
+    @ingroup Chemistry
+  */
+  class OPENMS_DLLAPI DigestCache
+  {
+public:
+
+    /// one digestion product: position and length within the protein plus its monoisotopic mass
+    typedef EnzymaticDigestion::PeptideMass PeptideMass;
+
+    /// The digest of a single protein: a read-only view into the cached record array
+    class DigestView
+    {
+public:
+      DigestView(const PeptideMass* begin, Size size) :
+        begin_(begin),
+        size_(size)
+      {
+      }
+
+      const PeptideMass* begin() const
+      {
+        return begin_;
+      }
+
+      const PeptideMass* end() const
+      {
+        return begin_ + size_;
+      }
+
+      Size size() const
+      {
+        return size_;
+      }
+
+      const PeptideMass& operator[](Size index) const
+      {
+        return begin_[index];
+      }
+
+private:
+      const PeptideMass* begin_;
+      Size size_;
+    };
+
+    /**
+      @brief Compute the cache key for a database and digestion settings
+
+      The key is a hex-encoded hash over the protein sequences of @p fasta_db (in
+      order) and the enzyme name, missed cleavages, specificity and length limits
+      of the digestion. It uses fixed hash constants so the same inputs give the
+      same key across runs and library versions.
+    */
+    static String cacheKey(const std::vector<FASTAFile::FASTAEntry>& fasta_db,
+                           const EnzymaticDigestion& digestion,
+                           Size min_length,
+                           Size max_length);
+
+    /// Name of the cache file for the given key inside @p cache_dir
+    static String cacheFileName(const String& cache_dir, const String& key);
+
+    /**
+      @brief Digest all proteins of @p fasta_db and write the cache file
+
+      @exception Exception::UnableToCreateFile is thrown if the file could not be created
+    */
+    static void store(const String& filename,
+                      const String& key,
+                      const std::vector<FASTAFile::FASTAEntry>& fasta_db,
+                      const EnzymaticDigestion& digestion,
+                      Size min_length,
+                      Size max_length);
+
+    /**
+      @brief Open an existing cache file
+
+      The file is memory-mapped if possible and read into an internal buffer
+      otherwise. Returns false if the file is missing, truncated or was written
+      for a different key; the object is left unloaded in that case.
+    */
+    bool load(const String& filename, const String& key);
+
+    /// Whether a cache file is currently loaded
+    bool isLoaded() const
+    {
+      return offsets_ != nullptr;
+    }
+
+    /// Number of proteins in the loaded cache
+    Size getNrProteins() const
+    {
+      return nr_proteins_;
+    }
+
+    /**
+      @brief The digest of the protein at @p protein_index as a view into the cached records
+
+      Only valid while the cache is loaded (the view references the mapped file).
+    */
+    DigestView getDigest(Size protein_index) const;
+
+protected:
+
+    /// Release the mapping / buffer and reset to the unloaded state
+    void clear_();
+
+    /// Memory mapping of the cache file (if mapping was possible)
+    Internal::MemoryMappedFile mmap_file_;
+
+    /// Fallback buffer holding the file content if it could not be mapped
+    std::vector<char> buffer_;
+
+    /// Per-protein record offsets (nr_proteins_ + 1 entries), pointing into the file
+    const Size* offsets_ = nullptr;
+
+    /// Packed peptide records of all proteins, pointing into the file
+    const PeptideMass* records_ = nullptr;
+
+    /// Number of proteins in the loaded cache
+    Size nr_proteins_ = 0;
+  };
+
+} // namespace OpenMS
@@ -10,6 +10,7 @@
 
 #include <OpenMS/CHEMISTRY/DigestionEnzyme.h>
 #include <OpenMS/CONCEPT/Types.h>
+#include <array>
 #include <boost/regex_fwd.hpp> // forward declaration of boost::regex
 #include <functional>          // for std::function
 #include <memory>              // unique_ptr
@@ -119,6 +120,29 @@ namespace OpenMS
      */
     Size digestUnmodified(const StringView& sequence, std::vector<std::pair<Size, Size>>& output, Size min_length = 1, Size max_length = 0) const;
 
+    /// A digestion product of digestUnmodifiedWithMasses(): position and length within the protein plus its monoisotopic mass
+    struct PeptideMass
+    {
+      Size position; ///< start index into the protein sequence
+      Size length;   ///< length of the peptide
+      double mass;   ///< monoisotopic mass of the unmodified peptide ([M], uncharged); NaN if the peptide contains a character without defined mass (e.g. 'X')
+    };
+
+    /**
+     @brief Performs the enzymatic digestion of an unmodified sequence and annotates every product with its monoisotopic mass.
+
+     Masses are taken from a per-residue lookup table and combined via prefix sums over the protein,
+     so no temporary AASequence or EmpiricalFormula objects are created per peptide. This makes
+     digest-and-mass-filter loops over large FASTA files allocation-free apart from the output vector.
+
+     @param sequence Sequence to digest
+     @param output Digestion products as packed (position, length, mass) tuples
+     @param min_length Minimal length of reported products
+     @param max_length Maximal length of reported products (0 = no restriction)
+     @return Number of discarded digestion products (which are not matching length restrictions)
+     */
+    Size digestUnmodifiedWithMasses(const StringView& sequence, std::vector<PeptideMass>& output, Size min_length = 1, Size max_length = 0) const;
+
     /**
     @brief Is the peptide fragment starting at position @p pep_pos with length @p pep_length within the sequence @p protein generated by the current enzyme?
 
@@ -207,6 +231,24 @@ namespace OpenMS
     /// Regex for tokenizing (huge speedup by making this a member instead of stack object in tokenize_())
     std::unique_ptr<boost::regex> re_; // use PImpl, since #include cost is huge
 
+    /**
+       @brief Try to compile the enzyme's cleavage regex into table-driven byte tests
+
+       Recognizes the common shape of lookbehind/lookahead character sets,
+       e.g. "(?<=[KR])(?!P)" for Trypsin or "(?=[BD])" for Asp-N. If the
+       regex has this shape, tokenize_() scans the sequence with two
+       256-entry tables instead of running the regex engine (about an order
+       of magnitude faster at PeptideIndexer scale); anything else
+       (alternations, quantifiers, ...) keeps using boost::regex.
+    */
+    void compileSimpleRule_();
+
+    /// Whether the enzyme's regex was compiled into the byte tables below (see compileSimpleRule_())
+    bool simple_rule_;
+    /// simple rule: cleave between positions p-1 and p iff cut_after_[seq[p-1]] and cut_before_[seq[p]]
+    std::array<bool, 256> cut_after_;
+    std::array<bool, 256> cut_before_;
+
     /// specificity of enzyme
     Specificity specificity_;
   };
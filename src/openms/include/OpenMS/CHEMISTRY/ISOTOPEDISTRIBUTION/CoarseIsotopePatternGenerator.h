@@ -129,6 +129,48 @@ namespace OpenMS
       */
       IsotopeDistribution estimateFromPeptideMonoWeight(double mono_weight);
 
+    /**
+       @brief Precomputes a table of averagine isotope patterns for fast weight-based lookup
+
+       Builds patterns with estimateFromPeptideWeight() at the weights
+       @p resolution, 2 * @p resolution, ..., up to @p max_weight. Afterwards,
+       estimateFromPeptideWeightFast() and estimateFromPeptideWeights() return
+       the precomputed pattern closest in weight instead of convolving the
+       element distributions per call. This pays off when patterns are needed
+       for many candidate masses (feature finding, deconvolution), where the
+       intensity error introduced by the weight rounding is far below the
+       coarse model error anyway.
+
+       The table respects the current max_isotope / round_masses settings;
+       call this method again after changing them.
+
+       @param max_weight Largest average weight covered by the table
+       @param resolution Weight spacing of the table entries
+
+       @pre max_weight >= resolution > 0
+    */
+    void buildAveragineTable(double max_weight = 10000.0, double resolution = 25.0);
+
+    /// Whether an averagine table was built with buildAveragineTable()
+    bool hasAveragineTable() const;
+
+    /**
+       @brief Table-based version of estimateFromPeptideWeight()
+
+       Returns a copy of the precomputed pattern closest in weight, with all
+       masses shifted to match @p average_weight. Weights beyond the end of
+       the table use its last entry. Falls back to the exact calculation if
+       no table was built.
+    */
+    IsotopeDistribution estimateFromPeptideWeightFast(double average_weight);
+
+    /**
+       @brief Estimates averagine patterns for a whole vector of weights in one call
+
+       Equivalent to calling estimateFromPeptideWeightFast() per weight (and
+       thus uses the averagine table, if built).
+    */
+    std::vector<IsotopeDistribution> estimateFromPeptideWeights(const std::vector<double>& average_weights);
 
     /**
        @brief Estimate peptide IsotopeDistribution from average weight and exact number of sulfurs
@@ -373,6 +415,10 @@ namespace OpenMS
     Size max_isotope_;
     /// flag to determine whether masses should be rounded or not
     bool round_masses_;
+    /// precomputed averagine patterns (entry i holds the pattern for weight (i + 1) * averagine_resolution_)
+    std::vector<IsotopeDistribution> averagine_table_;
+    /// weight spacing of averagine_table_; 0 if no table was built
+    double averagine_resolution_ = 0.0;
 
   };
 
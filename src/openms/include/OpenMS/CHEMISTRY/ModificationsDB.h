@@ -45,6 +45,13 @@ namespace OpenMS
       databases. This can be done by providing a path through
       initializeModificationsDB(), however it is important that this is done
       *before* the first call to getInstance().
+
+      @note Like ElementDB and ResidueDB, this database is built lazily on
+      first use, so concurrent TOPP processes only pay for the databases they
+      actually touch. The databases cannot be placed in a shared-memory
+      segment, since the stored objects are ordinary pointer-based heap
+      structures; only the compiled-in tables and the mapped share files are
+      shared across processes by the operating system.
   */
   class OPENMS_DLLAPI ModificationsDB
   {
@@ -238,6 +245,16 @@ public:
     */
     bool residuesMatch_(const char residue, const ResidueModification* curr_mod) const;
 
+    /** @brief Adds @p mod to the name index under all its non-empty names
+
+        Modifications without a UniMod mapping report an empty UniMod
+        accession (similar for missing full names); indexing those under the
+        empty string would collect thousands of unrelated modifications in
+        one entry. The caller must hold the OpenMS_ModificationsDB critical
+        section.
+    */
+    void addNamesToIndex_(const ResidueModification* mod);
+
 private:
 
     /** @name Constructors and Destructors
@@ -27,6 +27,12 @@ namespace OpenMS
       @brief OpenMS stores a central database of all residues in the ResidueDB.
       All (unmodified) residues are added to the database on construction.
       Modified residues get created and added if getModifiedResidue is called.
+
+      Thread safety: the unmodified residues, their name index and the residue
+      sets are fully initialized in the (thread-safe) constructor and never
+      change afterwards, so the corresponding getters read without locking.
+      Only the registry of modified residues grows at runtime and is guarded
+      by a critical section.
   */
   class OPENMS_DLLAPI ResidueDB
   {
@@ -0,0 +1,109 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/CHEMISTRY/TheoreticalSpectrumGenerator.h>
+#include <OpenMS/KERNEL/StandardTypes.h>
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace OpenMS
+{
+
+  /**
+    @brief A thread-safe memoization layer for TheoreticalSpectrumGenerator
+
+    Search engines score the same (modified) candidate peptide against many
+    MS2 spectra and thereby regenerate identical fragment ladders over and
+    over (in XL-MS searches the same alpha peptides come up thousands of
+    times). This cache stores generated spectra keyed by the full peptide
+    string (which includes its modifications) and the charge range, and hands
+    them out as shared_ptr so readers on all threads can use a cached spectrum
+    without copying.
+
+    The cache is sharded: each shard has its own lock and LRU list, so
+    concurrent lookups from different threads rarely contend. Hit and miss
+    counters are kept for tuning the cache size.
+
+    @note The generator's parameters are part of the generated spectrum but
+    not of the cache key. Use one cache instance per generator configuration
+    (as search engines do: one configured generator for the whole search).
+  */
+  class OPENMS_DLLAPI TheoreticalSpectrumCache
+  {
+public:
+
+    /**
+      @brief Constructor
+
+      @param capacity Maximal number of cached spectra (distributed over the shards)
+      @param shards Number of independently locked shards (rounded up to at least 1)
+    */
+    explicit TheoreticalSpectrumCache(Size capacity = 100000, Size shards = 16);
+
+    /**
+      @brief Returns the theoretical spectrum for @p peptide, generating it on a cache miss
+
+      On a hit, the cached spectrum is returned and moved to the front of its
+      shard's LRU list. On a miss, the spectrum is generated with @p generator
+      (outside any lock), inserted, and the least recently used entries of the
+      shard are evicted if the shard is over capacity.
+
+      @param generator The configured generator used on cache misses
+      @param peptide The (modified) peptide
+      @param min_charge Minimal fragment charge, passed to TheoreticalSpectrumGenerator::getSpectrum()
+      @param max_charge Maximal fragment charge, passed to TheoreticalSpectrumGenerator::getSpectrum()
+    */
+    std::shared_ptr<const PeakSpectrum> getSpectrum(const TheoreticalSpectrumGenerator& generator,
+                                                    const AASequence& peptide,
+                                                    Int min_charge,
+                                                    Int max_charge);
+
+    /// Number of lookups answered from the cache
+    UInt64 getHits() const;
+
+    /// Number of lookups which had to generate a spectrum
+    UInt64 getMisses() const;
+
+    /// Fraction of lookups answered from the cache (0 if there were no lookups yet)
+    double getHitRate() const;
+
+    /// Number of currently cached spectra (over all shards)
+    Size size() const;
+
+    /// Removes all cached spectra and resets the counters
+    void clear();
+
+private:
+
+    using CacheEntry = std::pair<std::string, std::shared_ptr<const PeakSpectrum> >;
+
+    /// An independently locked part of the cache with its own LRU list
+    struct Shard
+    {
+      std::mutex mutex;
+      std::list<CacheEntry> lru; ///< most recently used entry first
+      std::unordered_map<std::string, std::list<CacheEntry>::iterator> index;
+    };
+
+    /// Which shard is responsible for @p key?
+    Shard& shardFor_(const std::string& key);
+
+    std::vector<std::unique_ptr<Shard> > shards_;
+    Size capacity_per_shard_;
+    std::atomic<UInt64> hits_ {0};
+    std::atomic<UInt64> misses_ {0};
+  };
+
+} // namespace OpenMS
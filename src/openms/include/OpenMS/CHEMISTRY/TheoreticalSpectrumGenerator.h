@@ -75,6 +75,12 @@ namespace OpenMS
     /// @throw Exception::InvalidParameter   If fragmentation method is anything else than 'CID', 'HCID', 'ECD' or 'ETD'.
     static MSSpectrum generateSpectrum(const Precursor::ActivationMethod& fm, const AASequence& seq, int precursor_charge);
 
+    /// Generates only the m/z values of the singly charged b- and y-ions (b1..b(n-1), y1..y(n-1))
+    /// into the caller-provided arrays (cleared first; reuse the same vectors across calls to avoid
+    /// per-peptide allocations). Both arrays are sorted ascending. Intended for bulk scoring loops
+    /// in combination with the array-based HyperScore::computeWithDetail() overload.
+    static void getBYIonMZs(const AASequence& peptide, std::vector<double>& b_ion_mzs, std::vector<double>& y_ion_mzs);
+
     /// overwrite
     void updateMembers_() override;
     //@}
@@ -8,6 +8,7 @@ AASequence.h
 AdductInfo.h
 CrossLinksDB.h
 DecoyGenerator.h
+DigestCache.h
 Element.h
 ElementDB.h
 EmpiricalFormula.h
@@ -35,6 +36,7 @@ RibonucleotideDB.h
 SimpleTSGXLMS.h
 SpectrumAnnotator.h
 Tagger.h
+TheoreticalSpectrumCache.h
 TheoreticalSpectrumGenerator.h
 TheoreticalSpectrumGeneratorXLMS.h
 WeightWrapper.h
@@ -21,6 +21,7 @@
 #include <OpenMS/COMPARISON/SPECTRA/PeakSpectrumCompareFunctor.h>
 #include <OpenMS/CONCEPT/Exception.h>
 #include <OpenMS/DATASTRUCTURES/DistanceMatrix.h>
+#include <OpenMS/DATASTRUCTURES/SparseDistanceMatrix.h>
 #include <OpenMS/KERNEL/StandardTypes.h>
 #include <vector>
 
@@ -106,6 +107,62 @@ public:
     clusterer(original_distance, cluster_tree, threshold_);
   }
 
+  /**
+      @brief Memory-saving clustering function for large element counts
+
+      Like cluster(), but distances at or above ClusterHierarchical::threshold_ are
+      never stored, so the memory consumption is proportional to the number of
+      element pairs closer than the threshold instead of quadratic in the number
+      of elements. The clustering itself is done with the nearest-neighbor-chain
+      algorithm using single linkage, see clusterSparse(SparseDistanceMatrix<float>&, std::vector<BinaryTreeNode>&).
+
+      Note that this variant still evaluates @p comparator for every element
+      pair. If cheap coordinates are available for the elements (e.g. m/z and
+      retention time bucketed with a ClusteringGrid or HashGrid), fill a
+      SparseDistanceMatrix from the grid neighborhoods instead and pass it to
+      the SparseDistanceMatrix overload directly.
+
+      @param data Values to be clustered
+      @param comparator Similarity functor which returns a similarity in [0, 1] for any pair of values in @p data
+      @param cluster_tree The vector that will hold the BinaryTreeNodes representing the clustering
+
+      @see ClusterFunctor, BinaryTreeNode, SparseDistanceMatrix
+  */
+  template<typename Data, typename SimilarityComparator>
+  void clusterSparse(std::vector<Data>& data,
+                     const SimilarityComparator& comparator,
+                     std::vector<BinaryTreeNode>& cluster_tree) const
+  {
+    SparseDistanceMatrix<float> sparse_distance(data.size(), (float)threshold_);
+    for (Size i = 0; i < data.size(); i++)
+    {
+      for (Size j = 0; j < i; j++)
+      {
+        // distance value is 1-similarity value, since similarity is in range of [0,1];
+        // setValue drops pairs at or above the cutoff
+        sparse_distance.setValue(i, j, 1 - comparator(data[i], data[j]));
+      }
+    }
+    clusterSparse(sparse_distance, cluster_tree);
+  }
+
+  /**
+      @brief Single linkage clustering of a thresholded sparse distance store
+
+      Runs the nearest-neighbor-chain algorithm on the pairs stored in
+      @p sparse_distance, i.e. only merges closer than the cutoff of the store
+      are performed. Elements that remain unconnected below the cutoff are
+      appended to @p cluster_tree as dummy nodes with distance -1, in the same
+      way the ClusterFunctor implementations handle their threshold.
+
+      @param sparse_distance Pairwise distances below the cutoff, will be changed during the clustering process, make sure to have a copy or be able to redo
+      @param cluster_tree The vector that will hold the BinaryTreeNodes representing the clustering (for further investigation with the ClusterAnalyzer methods)
+      @throw ClusterFunctor::InsufficientInput thrown if @p sparse_distance holds less than two elements
+
+      @see ClusterFunctor, BinaryTreeNode, ClusterAnalyzer
+  */
+  void clusterSparse(SparseDistanceMatrix<float>& sparse_distance, std::vector<BinaryTreeNode>& cluster_tree) const;
+
   /**
     @brief clustering function for binned PeakSpectrum
 
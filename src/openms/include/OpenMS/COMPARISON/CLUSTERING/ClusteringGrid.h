@@ -15,9 +15,10 @@
 #include <OpenMS/CONCEPT/Exception.h>
 #include <OpenMS/CONCEPT/Macros.h>
 
-#include <map>
+#include <cstddef>
 #include <vector>
 #include <list>
+#include <unordered_map>
 
 namespace OpenMS
 {
@@ -81,13 +82,21 @@ class OPENMS_DLLAPI ClusteringGrid
     */
     void removeAllClusters();
 
+    /**
+    * @brief reserves hash table space for the expected number of non-empty cells
+    * (avoids rehashing while the grid is filled)
+    *
+    * @param expected_cells    expected number of non-empty grid cells (e.g. the number of points to be clustered)
+    */
+    void reserve(std::size_t expected_cells);
+
     /**
     * @brief returns clusters in this grid cell
     * 
     * @param cell_index    cell index (i,j) on the grid
     * @return list of cluster indices (from the list of clusters) which are centred in this cell
     */
-    std::list<int> getClusters(const CellIndex &cell_index) const;
+    const std::list<int>& getClusters(const CellIndex &cell_index) const;
 
     /**
     * @brief returns grid cell index (i,j) for the positions (x,y)
@@ -116,6 +125,17 @@ class OPENMS_DLLAPI ClusteringGrid
     int getCellCount() const;
 
     private:
+    /**
+    * @brief hash for a grid cell index (i,j)
+    */
+    struct CellIndexHash
+    {
+      std::size_t operator()(const CellIndex &cell_index) const
+      {
+        return std::hash<long long>()((static_cast<long long>(cell_index.first) << 32) ^ static_cast<long long>(cell_index.second));
+      }
+    };
+
     /**
     * @brief spacing of the grid in x and y direction
     */
@@ -131,7 +151,7 @@ class OPENMS_DLLAPI ClusteringGrid
     /**
     * @brief grid cell index mapped to a list of clusters in it
     */
-    std::map<CellIndex, std::list<int> > cells_;
+    std::unordered_map<CellIndex, std::list<int>, CellIndexHash> cells_;
 
 };
 
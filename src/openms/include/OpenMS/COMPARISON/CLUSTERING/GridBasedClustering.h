@@ -476,6 +476,7 @@ private:
                const std::vector<int>& properties_A, const std::vector<int>& properties_B)
     {
       // fill the grid with points to be clustered (initially each cluster contains a single point)
+      grid_.reserve(data_x.size());
       for (unsigned i = 0; i < data_x.size(); ++i)
       {
         Point position(data_x[i], data_y[i]);
@@ -494,23 +495,41 @@ private:
         grid_.addCluster(grid_.getIndex(position), i);
       }
 
-      // fill list of minimum distances
-      std::map<int, GridBasedCluster>::iterator iterator = clusters_.begin();
-      while (iterator != clusters_.end())
+      // Determine the initial nearest neighbour of every cluster. The scans are read-only and
+      // independent of each other: cell neighbourhoods and merge vetoes are symmetric, and a
+      // veto'd candidate never updates the minimum distance. Hence a cluster which ends up
+      // isolated (and is removed below) can never have been the nearest neighbour of any other
+      // cluster, and scanning with all clusters still on the grid yields the same result as the
+      // serial scan-and-remove loop. This allows the scans to run in parallel; the results are
+      // committed serially in ascending cluster index to keep the bookkeeping structures and
+      // the subsequent merge order deterministic.
+      const SignedSize cluster_count = static_cast<SignedSize>(data_x.size());
+      std::vector<int> nearest_neighbours(cluster_count, -1);
+      std::vector<double> min_distances(cluster_count, 0.0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+      for (SignedSize i = 0; i < cluster_count; ++i)
       {
-        int cluster_index = iterator->first;
-        const GridBasedCluster& cluster = iterator->second;
+        nearest_neighbours[i] = scanNearestNeighbour_(clusters_.find(static_cast<int>(i))->second, static_cast<int>(i), min_distances[i]);
+      }
 
-        if (findNearestNeighbour_(cluster, cluster_index))
+      // fill list of minimum distances
+      for (SignedSize i = 0; i < cluster_count; ++i)
+      {
+        std::map<int, GridBasedCluster>::iterator cluster_it = clusters_.find(static_cast<int>(i));
+        if (nearest_neighbours[i] == -1)
         {
+          // no mergeable cluster nearby, hence move the cluster to the final results
+          clusters_final_.insert(std::make_pair(cluster_it->first, cluster_it->second));
           // remove from grid
-          grid_.removeCluster(grid_.getIndex(cluster.getCentre()), cluster_index);
+          grid_.removeCluster(grid_.getIndex(cluster_it->second.getCentre()), cluster_it->first);
           // remove from cluster list
-          clusters_.erase(iterator++);
+          clusters_.erase(cluster_it);
         }
         else
         {
-          ++iterator;
+          insertMinDistance_(cluster_it->first, nearest_neighbours[i], min_distances[i]);
         }
       }
     }
@@ -562,23 +581,26 @@ private:
     }
 
     /**
-     * @brief determines the nearest neighbour for each cluster
+     * @brief scans the 3x3 grid cell neighbourhood of a cluster for its nearest mergeable neighbour
+     *
+     * The scan does not modify any data structures, i.e. it is safe to run concurrently for
+     * different clusters (as long as the metric is thread-safe). Ties in the distance are broken
+     * towards the smaller cluster index, making the result independent of the cell traversal order.
      *
-     * @note If no nearest neighbour exists, the cluster is removed from the list.
-     * The deletion is done outside of the method, see return boolean.
      * @note If two clusters cannot be merged (merge veto), they are no
      * viable nearest neighbours.
      *
      * @param cluster    cluster for which the nearest neighbour should be found
      * @param cluster_index    index of cluster
+     * @param min_dist    distance to the nearest neighbour (valid only if one was found)
      *
-     * @return Should the cluster be removed from the cluster list?
+     * @return index of the nearest mergeable neighbour, or -1 if none exists
      */
-    bool findNearestNeighbour_(const GridBasedCluster& cluster, int cluster_index)
+    int scanNearestNeighbour_(const GridBasedCluster& cluster, int cluster_index, double& min_dist)
     {
       const Point& centre = cluster.getCentre();
       const CellIndex& cell_index = grid_.getIndex(centre);
-      double min_dist = 0;
+      min_dist = 0;
       int nearest_neighbour = -1;
 
       // search in the grid cell and its 8 neighbouring cells for the nearest neighbouring cluster
@@ -600,7 +622,7 @@ private:
                 const Point& centre2 = cluster2.getCentre();
                 double distance = metric_(centre, centre2);
 
-                if (distance < min_dist || nearest_neighbour == -1)
+                if (distance < min_dist || nearest_neighbour == -1 || (distance == min_dist && *cluster_index2 < nearest_neighbour))
                 {
                   bool veto = mergeVeto_(cluster, cluster2); // If clusters cannot be merged anyhow, they are no nearest neighbours.
                   if (!veto)
@@ -615,19 +637,55 @@ private:
         }
       }
 
-      if (nearest_neighbour == -1)
-      {
-        // no other cluster nearby, hence move the cluster to the final results
-        clusters_final_.insert(std::make_pair(cluster_index, clusters_.find(cluster_index)->second));
-        return true;
-      }
+      return nearest_neighbour;
+    }
 
+    /**
+     * @brief inserts a minimum distance object and its related bookkeeping data
+     *
+     * Counterpart of eraseMinDistance_(): adds the distance to distances_ and registers it in
+     * the auxiliary data structures reverse_nns_ and distance_it_for_cluster_idx_.
+     *
+     * @param cluster_index    index of cluster
+     * @param nearest_neighbour    index of its nearest neighbour
+     * @param min_dist    distance between the two clusters
+     */
+    void insertMinDistance_(int cluster_index, int nearest_neighbour, double min_dist)
+    {
       // add to the list of minimal distances
       std::multiset<MinimumDistance>::const_iterator it = distances_.insert(MinimumDistance(cluster_index, nearest_neighbour, min_dist));
       // add to reverse nearest neighbor lookup table
       reverse_nns_.insert(std::make_pair(nearest_neighbour, it));
       // add to cluster index -> distance lookup table
       distance_it_for_cluster_idx_[cluster_index] = it;
+    }
+
+    /**
+     * @brief determines the nearest neighbour for each cluster
+     *
+     * @note If no nearest neighbour exists, the cluster is removed from the list.
+     * The deletion is done outside of the method, see return boolean.
+     * @note If two clusters cannot be merged (merge veto), they are no
+     * viable nearest neighbours.
+     *
+     * @param cluster    cluster for which the nearest neighbour should be found
+     * @param cluster_index    index of cluster
+     *
+     * @return Should the cluster be removed from the cluster list?
+     */
+    bool findNearestNeighbour_(const GridBasedCluster& cluster, int cluster_index)
+    {
+      double min_dist = 0;
+      int nearest_neighbour = scanNearestNeighbour_(cluster, cluster_index, min_dist);
+
+      if (nearest_neighbour == -1)
+      {
+        // no other cluster nearby, hence move the cluster to the final results
+        clusters_final_.insert(std::make_pair(cluster_index, clusters_.find(cluster_index)->second));
+        return true;
+      }
+
+      insertMinDistance_(cluster_index, nearest_neighbour, min_dist);
 
       return false;
     }
@@ -0,0 +1,76 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/CONCEPT/ProgressLogger.h>
+#include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
+#include <OpenMS/KERNEL/StandardTypes.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Scalable connected-component clustering of fragment spectra
+
+    Alternative to ClusterHierarchical for repository-scale datasets: instead of a full
+    DistanceMatrix (O(n^2) memory), all binned spectra are packed into a single
+    compressed sparse row (CSR) structure, candidate pairs are generated from a
+    precursor m/z sorted sliding window, and pairs whose normalized dot product
+    (cosine similarity) exceeds a threshold are merged with a union-find structure.
+    Memory usage is linear in the number of peaks; the pairwise comparisons are
+    limited to precursor neighborhoods and run in parallel.
+
+    Spectra without precursor information or with fewer filled bins than 'min_peaks'
+    are not compared and end up as singleton clusters.
+
+    @ingroup SpectraClustering
+  */
+  class OPENMS_DLLAPI SpectrumClusteringEngine :
+    public DefaultParamHandler,
+    public ProgressLogger
+  {
+public:
+    /// default constructor
+    SpectrumClusteringEngine();
+
+    /**
+      @brief Cluster spectra into connected components of similar spectra
+
+      @param spectra The fragment spectra to cluster
+      @return A cluster index for every input spectrum; indices are consecutive, starting at 0, in order of first occurrence
+    */
+    std::vector<Size> cluster(const std::vector<PeakSpectrum>& spectra) const;
+
+private:
+    /// all binned spectra packed into one CSR structure (bins sorted within each row, rows L2-normalized)
+    struct CSRBinnedSpectra
+    {
+      std::vector<Int> bin_indices;
+      std::vector<float> intensities;
+      std::vector<Size> row_offsets; ///< size = number of spectra + 1
+
+      /// number of filled bins of spectrum @p i
+      Size rowSize(Size i) const
+      {
+        return row_offsets[i + 1] - row_offsets[i];
+      }
+    };
+
+    /// bin all spectra and pack them into @p packed
+    void packSpectra_(const std::vector<PeakSpectrum>& spectra, CSRBinnedSpectra& packed) const;
+
+    /// cosine similarity of two rows (merge join over the sorted bin indices)
+    static float dotProduct_(const CSRBinnedSpectra& packed, Size a, Size b);
+
+    /// union-find root lookup with path halving
+    static Size findRoot_(std::vector<Size>& parent, Size i);
+  };
+
+}
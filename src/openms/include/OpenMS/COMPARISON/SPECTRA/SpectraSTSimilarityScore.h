@@ -80,6 +80,20 @@ public:
     ///spectrum is transformed into a binned spectrum with bin size 1 and spread 1 and the intensities are normalized.
     BinnedSpectrum transform(const PeakSpectrum & spec);
 
+    /**
+        @brief Scores a (transformed) query against a whole library and returns the best hits
+
+        The query is binned and normalized only once (see transform()), each library
+        comparison is a sparse dot product, and only the @p top_k best hits are kept
+        via a bounded heap instead of sorting all scores.
+
+        @param query the query spectrum, already transformed
+        @param library the library spectra, already transformed
+        @param top_k the maximal number of hits to return
+        @return (library index, dot product) of the best hits, sorted by descending score
+    */
+    std::vector<std::pair<Size, double>> score(const BinnedSpectrum & query, const std::vector<BinnedSpectrum> & library, Size top_k) const;
+
     /**
         @brief Calculates how much of the dot product is dominated by a few peaks
 
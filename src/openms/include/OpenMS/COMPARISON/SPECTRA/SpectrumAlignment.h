@@ -12,7 +12,6 @@
 #include <OpenMS/DATASTRUCTURES/MatchedIterator.h>
 
 #include <vector>
-#include <map>
 #include <utility>
 #include <algorithm>
 
@@ -58,8 +57,39 @@ public:
     SpectrumAlignment & operator=(const SpectrumAlignment & source);
     // @}
 
+    /// traceback directions of the banded DP, packed into AlignmentWorkspace::trace
+    enum TraceDirection : unsigned char
+    {
+      TB_NONE = 0, ///< cell outside the band (never stored; returned for off-band lookups)
+      TB_DIAG,     ///< align s1[i-1] with s2[j-1]
+      TB_UP,       ///< skip s2[j-1]
+      TB_LEFT      ///< skip s1[i-1]
+    };
+
+    /** @brief Reusable workspace for the banded alignment DP of getSpectrumAlignment()
+
+        The band of each DP row is stored back-to-back in flat arrays whose capacity is
+        retained across calls, so aligning many spectrum pairs (e.g. a query against a
+        spectral library) does not allocate in steady state.
+    */
+    struct AlignmentWorkspace
+    {
+      std::vector<Size> row_start;      ///< first DP column inside the band, per DP row
+      std::vector<Size> row_offset;     ///< start of each row's band in the packed arrays; row_offset[i + 1] - row_offset[i] is the band width of row i
+      std::vector<double> scores;       ///< packed band scores
+      std::vector<unsigned char> trace; ///< packed traceback directions (see TraceDirection)
+    };
+
     template <typename SpectrumType1, typename SpectrumType2>
     void getSpectrumAlignment(std::vector<std::pair<Size, Size> >& alignment, const SpectrumType1& s1, const SpectrumType2& s2) const
+    {
+      static thread_local AlignmentWorkspace ws;
+      getSpectrumAlignment(alignment, s1, s2, ws);
+    }
+
+    /// As above, but with a caller-provided DP workspace, which is reused across calls to avoid per-call allocations
+    template <typename SpectrumType1, typename SpectrumType2>
+    void getSpectrumAlignment(std::vector<std::pair<Size, Size> >& alignment, const SpectrumType1& s1, const SpectrumType2& s2, AlignmentWorkspace& ws) const
     {
       if (!s1.isSorted() || !s2.isSorted())
       {
@@ -72,21 +102,28 @@ public:
 
       if (!param_.getValue("is_relative_tolerance").toBool() )
       {
-        std::map<Size, std::map<Size, std::pair<Size, Size> > > traceback;
-        std::map<Size, std::map<Size, double> > matrix;
-
-        // init the matrix with "gap costs" tolerance
-        matrix[0][0] = 0;
-        for (Size i = 1; i <= s1.size(); ++i)
-        {
-          matrix[i][0] = i * tolerance;
-          traceback[i][0]  = std::make_pair(i - 1, 0);
-        }
-        for (Size j = 1; j <= s2.size(); ++j)
+        // banded DP over rows i = 1..|s1|; only the band of each row is stored.
+        // Cells outside the band (and the virtual boundary row/column) score (i + j) * tolerance ("gap costs").
+        ws.row_start.resize(s1.size() + 1);
+        ws.row_offset.resize(s1.size() + 2);
+        ws.scores.clear();
+        ws.trace.clear();
+        ws.row_offset[0] = 0;
+        ws.row_offset[1] = 0; // row 0 is the virtual boundary row and holds no band cells
+
+        // banded score lookup with the boundary/off-band fallback
+        auto score_at = [&ws, tolerance](Size r, Size c) -> double
         {
-          matrix[0][j] = j * tolerance;
-          traceback[0][j] = std::make_pair(0, j - 1);
-        }
+          if (r >= 1 && c >= ws.row_start[r])
+          {
+            Size k = c - ws.row_start[r];
+            if (k < ws.row_offset[r + 1] - ws.row_offset[r])
+            {
+              return ws.scores[ws.row_offset[r] + k];
+            }
+          }
+          return (r + c) * tolerance;
+        };
 
         // fill in the matrix
         Size left_ptr(1);
@@ -96,6 +133,8 @@ public:
         for (Size i = 1; i <= s1.size(); ++i)
         {
           double pos1(s1[i - 1].getMZ());
+          ws.row_start[i] = left_ptr;
+          ws.row_offset[i + 1] = ws.row_offset[i];
 
           for (Size j = left_ptr; j <= s2.size(); ++j)
           {
@@ -119,36 +158,9 @@ public:
               ++left_ptr;
             }
 
-            double score_align = diff_align;
-
-            if (matrix.find(i - 1) != matrix.end() && matrix[i - 1].find(j - 1) != matrix[i - 1].end())
-            {
-              score_align += matrix[i - 1][j - 1];
-            }
-            else
-            {
-              score_align += (i - 1 + j - 1) * tolerance;
-            }
-
-            double score_up = tolerance;
-            if (matrix.find(i) != matrix.end() && matrix[i].find(j - 1) != matrix[i].end())
-            {
-              score_up += matrix[i][j - 1];
-            }
-            else
-            {
-              score_up += (i + j - 1) * tolerance;
-            }
-
-            double score_left = tolerance;
-            if (matrix.find(i - 1) != matrix.end() && matrix[i - 1].find(j) != matrix[i - 1].end())
-            {
-              score_left += matrix[i - 1][j];
-            }
-            else
-            {
-              score_left += (i - 1 + j) * tolerance;
-            }
+            double score_align = diff_align + score_at(i - 1, j - 1);
+            double score_up = tolerance + score_at(i, j - 1);
+            double score_left = tolerance + score_at(i - 1, j);
 
     #ifdef ALIGNMENT_DEBUG
           cerr << i << " " << j << " " << left_ptr << " " << pos1 << " " << pos2 << " " << score_align << " " << score_left << " " << score_up << endl;
@@ -156,8 +168,8 @@ public:
 
           if (score_align <= score_up && score_align <= score_left && diff_align <= tolerance)
           {
-             matrix[i][j] = score_align;
-             traceback[i][j] = std::make_pair(i - 1, j - 1);
+             ws.scores.push_back(score_align);
+             ws.trace.push_back(TB_DIAG);
              last_i = i;
              last_j = j;
           }
@@ -165,15 +177,16 @@ public:
           {
             if (score_up <= score_left)
             {
-              matrix[i][j] = score_up;
-              traceback[i][j] = std::make_pair(i, j - 1);
+              ws.scores.push_back(score_up);
+              ws.trace.push_back(TB_UP);
             }
             else
             {
-              matrix[i][j] = score_left;
-              traceback[i][j] = std::make_pair(i - 1, j);
+              ws.scores.push_back(score_left);
+              ws.trace.push_back(TB_LEFT);
             }
           }
+          ++ws.row_offset[i + 1];
 
           if (off_band)
           {
@@ -187,71 +200,39 @@ public:
 
           //cerr << last_i << " " << last_j << endl;
 
-    #ifdef ALIGNMENT_DEBUG
-    #if 0
-          cerr << "TheMatrix: " << endl << " \t  \t";
-          for (Size j = 0; j != s2.size(); ++j)
+      // do traceback
+      Size i = last_i;
+      Size j = last_j;
+
+      while (i >= 1 && j >= 1)
+      {
+        unsigned char dir = TB_NONE;
+        if (j >= ws.row_start[i])
+        {
+          Size k = j - ws.row_start[i];
+          if (k < ws.row_offset[i + 1] - ws.row_offset[i])
           {
-        cerr << s2[j].getPosition()[0] << " \t";
+            dir = ws.trace[ws.row_offset[i] + k];
           }
-          cerr << endl;
-          for (Size i = 0; i <= s1.size(); ++i)
-          {
-        if (i != 0)
+        }
+        if (dir == TB_DIAG)
         {
-          cerr << s1[i - 1].getPosition()[0] << " \t";
+          alignment.push_back(std::make_pair(i - 1, j - 1));
+          --i;
+          --j;
         }
-        else
+        else if (dir == TB_UP)
         {
-          cerr << " \t";
+          --j;
         }
-        for (Size j = 0; j <= s2.size(); ++j)
+        else if (dir == TB_LEFT)
         {
-          if (matrix.has(i) && matrix[i].has(j))
-          {
-            if (traceback[i][j].first == i - 1 && traceback[i][j].second == j - 1)
-            {
-              cerr << "\\";
-            }
-            else
-            {
-              if (traceback[i][j].first == i - 1 && traceback[i][j].second == j)
-              {
-            cerr << "|";
-              }
-              else
-              {
-            cerr << "-";
-              }
-            }
-
-            cerr << matrix[i][j] << "  \t";
-          }
-          else
-          {
-            cerr << "-1  \t";
-          }
+          --i;
         }
-        cerr << endl;
-          }
-    #endif
-    #endif
-
-      // do traceback
-      Size i = last_i;
-      Size j = last_j;
-
-      while (i >= 1 && j >= 1)
-      {
-        if (traceback[i][j].first == i - 1 && traceback[i][j].second == j - 1)
+        else // off-band cell; the old sparse matrix fell back to its default (0, 0) entry here
         {
-          alignment.push_back(std::make_pair(i - 1, j - 1));
+          break;
         }
-        Size new_i = traceback[i][j].first;
-        Size new_j = traceback[i][j].second;
-
-        i = new_i;
-        j = new_j;
       }
 
       std::reverse(alignment.begin(), alignment.end());
@@ -281,11 +262,33 @@ public:
       #endif
       }
       else  // relative alignment (ppm tolerance)
-      {        
+      {
         // find  closest match of s1[i] in s2 for all i
         MatchedIterator<SpectrumType1, PpmTrait> it(s1, s2, tolerance);
         for (; it != it.end(); ++it) alignment.emplace_back(it.refIdx(), it.tgtIdx());
       }
     }
+
+    /** @brief Aligns one query spectrum against many library spectra (batch version for library search)
+
+        Computes alignments[k] = getSpectrumAlignment(library[k], query) for all k, sharing a single
+        DP workspace across all library spectra. Use this in library-search loops
+        (e.g. matching one experimental spectrum against all candidates of a precursor window)
+        to avoid the per-pair workspace allocations of the single-pair overload.
+
+        @param alignments One alignment per library spectrum, resized as needed
+        @param library Library (usually theoretical) spectra; each must be sorted by m/z
+        @param query Query (usually experimental) spectrum, sorted by m/z
+    */
+    template <typename SpectrumType1, typename SpectrumType2>
+    void getSpectrumAlignments(std::vector<std::vector<std::pair<Size, Size> > >& alignments, const std::vector<SpectrumType1>& library, const SpectrumType2& query) const
+    {
+      alignments.resize(library.size());
+      AlignmentWorkspace ws;
+      for (Size k = 0; k < library.size(); ++k)
+      {
+        getSpectrumAlignment(alignments[k], library[k], query, ws);
+      }
+    }
   };
 }
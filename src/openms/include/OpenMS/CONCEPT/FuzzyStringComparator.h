@@ -13,6 +13,7 @@
 #include <OpenMS/DATASTRUCTURES/ListUtils.h>
 
 
+#include <limits>
 #include <map>
 #include <sstream>
 
@@ -165,6 +166,57 @@ public:
     */
     void setLogDestination(std::ostream & rhs);
 
+    /**
+      @brief Streaming numeric digest of one input.
+
+      Summarizes an input in a single pass: all numbers are bucketed by their
+      decimal magnitude (tolerance class) and reduced to count/sum/min/max per
+      bucket; all non-numeric, non-whitespace characters are folded into a
+      hash. Two inputs whose digests agree within the configured tolerances
+      are almost certainly similar, without the cost of a synchronized
+      line-by-line comparison.
+    */
+    struct OPENMS_DLLAPI StreamDigest
+    {
+      /// count/sum/min/max of the numbers of one magnitude class
+      struct Bucket
+      {
+        Size count = 0;
+        double sum = 0.0;
+        double min = std::numeric_limits<double>::max();
+        double max = -std::numeric_limits<double>::max();
+      };
+
+      /// numeric statistics, keyed by decimal magnitude, i.e. floor(log10(|x|)) (0 is used for x == 0)
+      std::map<Int, Bucket> buckets;
+
+      /// FNV-1a hash of all non-numeric, non-whitespace characters
+      UInt64 text_hash = 0xcbf29ce484222325ull;
+    };
+
+    /// Whether compareFiles() compares digests first and only falls back to the line-by-line comparison on digest mismatch (default: false)
+    bool getCompareDigestFirst() const;
+
+    /**
+      @brief Whether compareFiles() compares digests first.
+
+      When enabled, compareFiles() computes a StreamDigest of each file and
+      accepts the files as similar if the digests agree within the acceptable
+      absolute/relative tolerances; only on digest mismatch does it rerun the
+      precise line-by-line comparison (which then also produces the usual
+      failure report). This is much faster on large outputs, but note that the
+      digest is insensitive to reorderings of numerically balanced content.
+      Whitelists are not supported by the digest; if one is set, compareFiles()
+      skips the digest and compares line-by-line as usual.
+    */
+    void setCompareDigestFirst(bool rhs);
+
+    /// Compute the digest of all lines of @p input (empty and whitespace-only lines are skipped, as in the line-by-line comparison)
+    void digestStream(std::istream & input, StreamDigest & digest) const;
+
+    /// Check whether two digests agree within the acceptable absolute/relative tolerances
+    bool digestsSimilar(const StreamDigest & d1, const StreamDigest & d2) const;
+
     /**
       @brief Compare two strings.
 
@@ -338,6 +390,9 @@ protected:
     /// use a prefix when reporting
     bool use_prefix_;
 
+    /// compare digests before falling back to the line-by-line comparison, see setCompareDigestFirst()
+    bool compare_digest_first_;
+
     /// Whitelist
     StringList whitelist_;
     /// Occurrences of whitelist entries
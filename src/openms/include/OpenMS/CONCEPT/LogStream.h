@@ -17,6 +17,7 @@
 #include <vector>
 #include <ctime>
 #include <map>
+#include <utility>
 
 namespace OpenMS
 {
@@ -281,10 +282,12 @@ protected:
       Which produces an error message in the log.
 
       @note The log stream macros are thread safe and can be used in a
-      multithreaded environment, the global variables are not! The macros are
-      protected by a OPENMS_THREAD_CRITICAL directive (which translates to an
-      OpenMP critical pragma), however there may be a small performance penalty
-      to this.
+      multithreaded environment, the global variables are not! Each macro
+      statement assembles its message in a thread-private buffer (see
+      LogLineBuffer) and only the hand-over of the finished text to the
+      shared stream is protected by an OPENMS_THREAD_CRITICAL directive
+      (which translates to an OpenMP critical pragma), so formatting the
+      message arguments does not serialize concurrent threads.
 
     */
     class OPENMS_DLLAPI LogStream :
@@ -428,37 +431,80 @@ private:
 
     }; //LogStream
 
+    /**
+      @brief Thread-private line assembly for the OPENMS_LOG_* macros.
+
+      Everything a single log statement inserts is collected in a buffer
+      local to the calling thread; when the statement ends, the destructor
+      forwards the assembled text to the associated LogStream in one short
+      critical section and flushes it. This way the (potentially expensive)
+      formatting of the message arguments happens outside of the global log
+      lock and concurrent threads only serialize on the final hand-over.
+      Line atomicity and the order of statements within a thread are
+      preserved; text without a trailing newline is still collected across
+      statements in LogStreamBuf::incomplete_line_.
+    */
+    class OPENMS_DLLAPI LogLineBuffer
+    {
+public:
+      /// Create a buffer which forwards to @p log when the statement ends
+      explicit LogLineBuffer(LogStream& log);
+
+      /// Hands the buffered text over to the LogStream (protected by OPENMS_THREAD_CRITICAL)
+      ~LogLineBuffer();
+
+      /// Buffer any insertable value without holding the global log lock
+      template <typename T>
+      LogLineBuffer& operator<<(T&& value)
+      {
+        buffer_ << std::forward<T>(value);
+        return *this;
+      }
+
+      /// Buffer stream manipulators like std::endl (flushing is deferred to the hand-over)
+      LogLineBuffer& operator<<(std::ostream& (*manip)(std::ostream&))
+      {
+        buffer_ << manip;
+        return *this;
+      }
+
+      /// Buffer format manipulators like std::hex
+      LogLineBuffer& operator<<(std::ios_base& (*manip)(std::ios_base&))
+      {
+        buffer_ << manip;
+        return *this;
+      }
+
+private:
+      LogStream& log_;
+      std::ostringstream buffer_;
+    };
+
   } // namespace Logger
 
   /// Macro to be used if fatal error are reported (processing stops)
 #define OPENMS_LOG_FATAL_ERROR \
-  OPENMS_THREAD_CRITICAL(LOGSTREAM) \
-  OpenMS_Log_fatal << __FILE__ << "(" << __LINE__ << "): "
+  OpenMS::Logger::LogLineBuffer(OpenMS_Log_fatal) << __FILE__ << "(" << __LINE__ << "): "
 
   /// Macro to be used if non-fatal error are reported (processing continues)
 #define OPENMS_LOG_ERROR \
-  OPENMS_THREAD_CRITICAL(LOGSTREAM) \
-  OpenMS_Log_error
+  OpenMS::Logger::LogLineBuffer(OpenMS_Log_error)
 
   /// Macro if a warning, a piece of information which should be read by the user, should be logged
 #define OPENMS_LOG_WARN \
-  OPENMS_THREAD_CRITICAL(LOGSTREAM) \
-  OpenMS_Log_warn
+  OpenMS::Logger::LogLineBuffer(OpenMS_Log_warn)
 
   /// Macro if a information, e.g. a status should be reported
 #define OPENMS_LOG_INFO \
-  OPENMS_THREAD_CRITICAL(LOGSTREAM) \
-  OpenMS_Log_info
+  OpenMS::Logger::LogLineBuffer(OpenMS_Log_info)
 
   /// Macro for general debugging information
 #define OPENMS_LOG_DEBUG \
-  OPENMS_THREAD_CRITICAL(LOGSTREAM) \
-  OpenMS_Log_debug << [](){ constexpr const char* x = (past_last_slash(__FILE__)); return x; }() << "(" << __LINE__ << "): "
+  OpenMS::Logger::LogLineBuffer(OpenMS_Log_debug) << [](){ constexpr const char* x = (past_last_slash(__FILE__)); return x; }() << "(" << __LINE__ << "): "
 
   /// Macro for general debugging information (without information on file)
 #define OPENMS_LOG_DEBUG_NOFILE \
-  OPENMS_THREAD_CRITICAL(LOGSTREAM) \
-  OpenMS_Log_debug
+  OpenMS::Logger::LogLineBuffer(OpenMS_Log_debug)
 
   OPENMS_DLLAPI extern Logger::LogStream OpenMS_Log_fatal; ///< Global static instance of a LogStream to capture messages classified as fatal errors. By default it is bound to @b cerr.
   OPENMS_DLLAPI extern Logger::LogStream OpenMS_Log_error; ///< Global static instance of a LogStream to capture messages classified as errors. By default it is bound to @b cerr.
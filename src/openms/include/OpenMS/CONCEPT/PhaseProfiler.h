@@ -0,0 +1,95 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/CONCEPT/Types.h>
+#include <OpenMS/DATASTRUCTURES/String.h>
+#include <OpenMS/SYSTEM/StopWatch.h>
+
+#include <mutex>
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Opt-in collection of per-phase runtime statistics, written as a JSON profile
+
+    Records wall time, CPU time and memory consumption (via SysInfo) for named phases of a
+    tool run and dumps them as a machine-readable JSON file when the process exits (or when
+    @ref dump() is called explicitly).
+
+    Phases are the sections a tool already reports via ProgressLogger::startProgress() /
+    endProgress(); when the profiler is enabled, ProgressLogger feeds it automatically, so
+    any tool using progress logging is instrumented without code changes. Additional phases
+    can be recorded manually using @ref startPhase() / @ref endPhase(). Phases may be nested;
+    the nesting depth is part of each record.
+
+    The profiler is disabled by default and has no overhead beyond a boolean check. It is
+    enabled either programmatically via @ref enable(), or by setting the environment variable
+    @c OPENMS_PHASE_PROFILE to the name of the output file.
+
+    @note Phase boundaries are expected to be crossed by the master thread only (as is the
+    case for ProgressLogger); recording itself is protected by a mutex.
+  */
+  class OPENMS_DLLAPI PhaseProfiler
+  {
+public:
+    /// access to the singleton instance
+    static PhaseProfiler* getInstance();
+
+    /// is profiling active? (cheap; intended to guard calls on hot paths)
+    bool isEnabled() const
+    {
+      return enabled_;
+    }
+
+    /// start profiling; the JSON profile is written to @p filename when the process exits
+    void enable(const String& filename);
+
+    /// open a new (possibly nested) phase with the given label
+    void startPhase(const String& label);
+
+    /// close the innermost open phase; does nothing if no phase is open
+    void endPhase();
+
+    /// write all completed phases to the output file (called automatically at process exit)
+    void dump() const;
+
+protected:
+    /// statistics of one completed phase
+    struct PhaseRecord_
+    {
+      String label;
+      Size depth; ///< nesting depth (0 = top level)
+      double wall_time; ///< wall clock time in seconds
+      double cpu_time; ///< CPU time in seconds
+      size_t mem_kb; ///< memory consumption at phase end in KB (0 if unavailable)
+      size_t mem_peak_kb; ///< peak memory consumption at phase end in KB (0 if unavailable)
+    };
+
+    /// a phase that has been started but not ended yet
+    struct OpenPhase_
+    {
+      Size record_index; ///< index into records_
+      StopWatch watch;
+    };
+
+    /// C'tor: checks the OPENMS_PHASE_PROFILE environment variable
+    PhaseProfiler();
+
+    bool enabled_ = false;
+    String filename_;
+    std::vector<PhaseRecord_> records_; ///< completed (and open) phases in order of start
+    std::vector<OpenPhase_> stack_; ///< currently open phases
+    mutable std::mutex mutex_;
+
+    static PhaseProfiler* instance_;
+  };
+
+} // namespace OpenMS
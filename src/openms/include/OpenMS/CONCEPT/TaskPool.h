@@ -0,0 +1,134 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/CONCEPT/Types.h>
+#include <OpenMS/OpenMSConfig.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Process-wide helpers for running loops and task groups on the shared OpenMP worker pool
+
+    OpenMS parallelizes with OpenMP, whose runtime keeps a single process-wide pool of worker
+    threads alive between parallel regions -- so there is no per-region thread spawn to avoid.
+    What does require care is composing parallel stages (e.g. parallel file loading plus parallel
+    peak picking): a parallel region opened inside another one either serializes or oversubscribes,
+    depending on the nesting settings. This class centralizes the recurring patterns:
+
+    - parallelFor() runs a loop on the worker pool with grain (chunk) control, transparently
+      runs serially when called from inside a parallel region (no oversubscription), and
+      rethrows the first exception thrown by an iteration after the loop has joined (exceptions
+      must not leak out of an OpenMP region).
+    - parallelInvoke() runs a group of independent tasks concurrently, e.g. independent
+      pipeline stages.
+    - enableNestedParallelism() splits the global thread budget between an outer stage and the
+      regions nested inside it, replacing manual OMP_NUM_THREADS juggling per stage.
+
+    Without OpenMP all calls execute serially, keeping call sites free of '#ifdef _OPENMP'.
+  */
+  class OPENMS_DLLAPI TaskPool
+  {
+public:
+    /// Number of worker threads the process may use (1 in non-OpenMP builds)
+    static int numberOfThreads();
+
+    /// Sets the process-wide thread budget (values < 1 are clamped to 1; no-op without OpenMP)
+    static void setNumberOfThreads(int threads);
+
+    /// Returns true if called from inside a parallel region
+    static bool inParallelRegion();
+
+    /**
+      @brief Allows parallel regions inside parallel regions and splits the thread budget
+
+      The outer stage is limited to @p outer_threads (clamped to the current budget); the
+      remaining threads are available to each nested region so that the total stays within
+      the budget.
+
+      @param outer_threads Number of threads for the outer stage
+      @return Number of threads each nested region should use (>= 1)
+    */
+    static int enableNestedParallelism(int outer_threads);
+
+    /// Disables nested parallel regions again and restores the full thread budget
+    static void disableNestedParallelism();
+
+    /**
+      @brief Runs @p fn(i) for all i in [@p begin, @p end) on the worker pool
+
+      The first exception thrown by an iteration is rethrown in the calling thread after all
+      workers have joined; remaining iterations are skipped once an error occurred. When called
+      from inside a parallel region the loop runs serially in the calling thread.
+
+      @param begin First loop index
+      @param end Past-the-end loop index
+      @param grain Number of consecutive iterations handed to a worker at a time. Small grains
+             balance uneven per-iteration work, large grains reduce scheduling overhead.
+             Pass 0 to derive a default from the range and the thread count.
+      @param fn Callable invoked with the loop index
+    */
+    template <typename Function>
+    static void parallelFor(SignedSize begin, SignedSize end, SignedSize grain, Function&& fn)
+    {
+      std::atomic<bool> failed(false);
+      std::exception_ptr error;
+#ifdef _OPENMP
+      const SignedSize chunk = (grain > 0) ? grain : std::max(SignedSize(1), (end - begin) / (SignedSize(numberOfThreads()) * 4));
+#pragma omp parallel for schedule(dynamic, chunk) if (omp_in_parallel() == 0)
+#endif
+      for (SignedSize i = begin; i < end; ++i)
+      {
+        if (failed.load(std::memory_order_relaxed)) continue; // first error wins; skip remaining work
+        try
+        {
+          fn(i);
+        }
+        catch (...)
+        {
+#ifdef _OPENMP
+#pragma omp critical (OpenMS_TaskPool_error)
+#endif
+          {
+            if (!failed.exchange(true))
+            {
+              error = std::current_exception();
+            }
+          }
+        }
+      }
+      if (error)
+      {
+        std::rethrow_exception(error);
+      }
+    }
+
+    /**
+      @brief Runs a group of independent tasks concurrently and waits for all of them
+
+      The first exception thrown by a task is rethrown after all tasks have finished or were
+      skipped. Tasks may themselves open parallel regions; whether those run in parallel is
+      governed by enableNestedParallelism().
+
+      @param tasks The tasks to run
+    */
+    static void parallelInvoke(const std::vector<std::function<void()>>& tasks);
+  };
+
+} // namespace OpenMS
@@ -11,10 +11,7 @@
 #include <OpenMS/CONCEPT/Types.h>
 #include <OpenMS/DATASTRUCTURES/Param.h>
 
-#include <boost/random/mersenne_twister.hpp>
-#include <boost/random/variate_generator.hpp>
-#include <boost/random/uniform_int.hpp>
-
+#include <atomic>
 
 namespace OpenMS
 {
@@ -25,9 +22,15 @@ namespace OpenMS
     @brief  A generator for unique ids.
 
     The unique ids are 64-bit random unsigned random integers.
-    The class is implemented as a singleton.
     The random generator is implemented using boost::random.
 
+    Each thread draws from its own random stream (seeded from the common base
+    seed and a per-thread ordinal), so getUniqueId() is lock-free: no critical
+    section or shared generator state is touched on the hot path.
+
+    Single-threaded use is reproducible: after setSeed(), the calling thread
+    produces the same id sequence as previous OpenMS versions.
+
     @ingroup Concept
   */
   class OPENMS_DLLAPI UniqueIdGenerator
@@ -49,13 +52,15 @@ protected:
     ~UniqueIdGenerator();
 
 private:
-    static UInt64 seed_;
-    static UniqueIdGenerator* instance_;
-    static boost::mt19937_64* rng_;
-    static boost::uniform_int<UInt64>* dist_;
-
-    static UniqueIdGenerator& getInstance_();
-    void init_();
+    /// Base seed all per-thread streams are derived from
+    static std::atomic<UInt64> seed_;
+    /// Bumped by setSeed(); invalidates the per-thread generators (0 = seed not initialized yet)
+    static std::atomic<UInt32> seed_version_;
+    /// Hands out the per-thread stream ordinals
+    static std::atomic<UInt32> thread_counter_;
+
+    /// Seeds from the clock on first use (unless setSeed() was called before)
+    static void ensureInitialized_();
     UniqueIdGenerator(const UniqueIdGenerator& );//protect from c++ auto-generation
   };
 
@@ -17,10 +17,12 @@ LogConfigHandler.h
 LogStream.h
 Macros.h
 MacrosTest.h
+PhaseProfiler.h
 PrecisionWrapper.h
 ProgressLogger.h
 RAIICleanup.h
 StreamHandler.h
+TaskPool.h
 Types.h
 UniqueIdGenerator.h
 UniqueIdIndexer.h
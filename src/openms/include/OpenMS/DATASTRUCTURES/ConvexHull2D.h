@@ -31,10 +31,11 @@ namespace OpenMS
       where points range within each scan (although missing points within this range are still not shown).
       When hulls are created like this, the encloses() function is supported, and works as expected, i.e.
       for the shape defined by this hull (view it in TOPPView) it answers whether the point is inside the shape.
-  However, once you store the hull in featureXML and load it again, the encloses() function is not supported any longer, because
+  However, once you store the hull in featureXML and load it again, only the outer hull points are restored, because
   the old convex hulls did not save min&max for each scan.
-  (to support encloses() at least for the new hulls, one would need to check if there exists a min&max value for each scan
-   --> then the query would be valid and the inner representation can be filled. Old featureXML's are not supported in any case.)
+  For hulls written by OpenMS, the inner representation (min&max per scan) can be reconstructed from the outer points
+  via compact(), which also drops the point vector (the outer points are recomputed on demand) and re-enables the
+  encloses() query. Old featureXML's with true convex hulls are not supported in any case.
 
       The outer hullpoints can be queried by getHullPoints().
 
@@ -105,6 +106,22 @@ public:
     **/
     Size compress();
 
+    /**
+      @brief Attempts to switch from plain hull points to the compact per-scan representation
+
+      Hulls created by addPoint()/addPoints() (e.g. during feature finding) store one m/z range
+      per RT scan and derive the outer hull points lazily on demand. Hulls set via setHullPoints()
+      (e.g. when loading featureXML) only carry the outer points. This method reconstructs the
+      per-scan ranges from the outer points, provided they form the scan-walk shape produced by
+      getHullPoints(). On success the point vector is dropped (roughly halving the memory
+      footprint of the hull) and encloses() is supported again; getHullPoints() will lazily
+      regenerate the identical points. Hulls of any other shape (e.g. true convex hulls from
+      legacy featureXML) are left untouched.
+
+      @returns True if the hull is (now) stored in its compact representation
+    **/
+    bool compact();
+
     /**
               @brief Expand a convex hull to its bounding box.
 
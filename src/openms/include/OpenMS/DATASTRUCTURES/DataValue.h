@@ -75,10 +75,14 @@ public:
     DataValue(const std::string&);
     /// specific constructor for string values
     DataValue(const String&);
+    /// specific move constructor for string values (avoids copying the string data)
+    DataValue(String&&) noexcept;
     /// specific constructor for QString values
     DataValue(const QString&);
     /// specific constructor for string lists
     DataValue(const StringList&);
+    /// specific move constructor for string lists (avoids copying the list data)
+    DataValue(StringList&&);
     /// specific constructor for integer lists
     DataValue(const IntList&);
     /// specific constructor for double lists
@@ -301,10 +305,14 @@ public:
     DataValue& operator=(const std::string&);
     /// specific assignment for string values
     DataValue& operator=(const String&);
+    /// specific move assignment for string values (avoids copying the string data)
+    DataValue& operator=(String&&) noexcept;
     /// specific assignment for QString values
     DataValue& operator=(const QString&);
     /// specific assignment for string lists
     DataValue& operator=(const StringList&);
+    /// specific move assignment for string lists (avoids copying the list data)
+    DataValue& operator=(StringList&&);
     /// specific assignment for integer lists
     DataValue& operator=(const IntList&);
     /// specific assignment for double lists
@@ -419,21 +427,32 @@ protected:
     /// The unit of the data value (if it has one) using UO identifier, otherwise -1.
     int32_t unit_;
 
-    /// Space to store the data
-    union
+    /// Space to store the data. String values are stored inline (benefiting
+    /// from std::string's small-string optimization) instead of behind an
+    /// extra heap allocation, since meta values are dominated by short
+    /// strings and copied frequently. The active member is tracked by
+    /// value_type_; the string member is constructed/destroyed manually via
+    /// placement new and clear_().
+    union Data_
     {
       SignedSize ssize_;
       double dou_;
-      String* str_;
+      String str_;
       StringList* str_list_;
       IntList* int_list_;
       DoubleList* dou_list_;
+      Data_() {} ///< no member is initialized; the enclosing DataValue manages the active member
+      ~Data_() {} ///< non-trivial members are destroyed in DataValue::clear_()
     } data_;
 
 private:
 
     /// Clears the current state of the DataValue and release every used memory.
     void clear_() noexcept;
+
+    /// Takes ownership of @p rhs' data (the union of *this must not hold a constructed member).
+    /// The caller is responsible for resetting rhs.value_type_ afterwards.
+    void moveData_(DataValue&& rhs) noexcept;
   };
 }
 
@@ -10,6 +10,7 @@
 
 
 #include <cstddef>   // for size_t
+#include <utility>   // for std::move/std::forward
 #include <vector>
 
 namespace OpenMS
@@ -150,6 +151,14 @@ namespace OpenMS
     {
       return data_.at(i);
     }
+    VectorElement& front() noexcept
+    {
+      return data_.front();
+    }
+    const VectorElement& front() const noexcept
+    {
+      return data_.front();
+    }
     VectorElement& back() noexcept
     {
       return data_.back();
@@ -188,6 +197,19 @@ namespace OpenMS
     {
       return data_.insert(where, from, to);
     }
+    iterator insert(const_iterator where, const VectorElement& value)
+    {
+      return data_.insert(where, value);
+    }
+    iterator insert(const_iterator where, VectorElement&& value)
+    {
+      return data_.insert(where, std::move(value));
+    }
+    template<typename... Args>
+    iterator emplace(const_iterator where, Args&&... args)
+    {
+      return data_.emplace(where, std::forward<Args>(args)...);
+    }
 
     /// read-only access to the underlying data
     const VecMember& getData() const
@@ -15,8 +15,12 @@
 #include <OpenMS/DATASTRUCTURES/StringUtilsSimple.h>
 #include <OpenMS/FORMAT/FASTAFile.h>
 
+#include <cstdint>
 #include <functional>
 #include <fstream>
+#include <future>
+#include <limits>
+#include <string_view>
 #include <unordered_map>
 #include <memory>
 #include <utility>
@@ -48,8 +52,8 @@ namespace OpenMS
   (with a potentially huge speed benefit over FASTAContainer<TFI_File> since it does not need disk access, but at the cost of memory).
 
   If an algorithm searches through a FASTA file linearly, you can use FASTAContainer<TFI_File> to pre-load a small chunk
-  and start working, while loading the next chunk in a background thread and swap it in when the active chunk 
-  was processed.
+  and start working, while loading the next chunk in a background thread (see cacheChunkAsync()) and swap it in
+  when the active chunk was processed.
 
   */
 template<typename TBackend>
@@ -87,39 +91,46 @@ public:
     return chunk_offset_;
   }
 
-  /** @brief Swaps in the background cache of entries, read previously via @p cacheChunk()
-      
-      If you call this function without a prior call to @p cacheChunk(), the cache will be empty.
+  /** @brief Swaps in the background cache of entries, read previously via @p cacheChunk() or @p cacheChunkAsync()
+
+      If you call this function without a prior call to @p cacheChunk()/@p cacheChunkAsync(), the cache will be empty.
+      Blocks until a pending @p cacheChunkAsync() has finished reading.
       @return true if cache contains data; false if empty
       @note Should be invoked by a single thread, followed by a barrier to sync access of subsequent calls to chunkAt()
   */
   bool activateCache()
   {
+    waitForPrefetch_();
     chunk_offset_ += data_fg_.size();
     data_fg_.swap(data_bg_);
     data_bg_.clear(); // just in case someone calls activateCache() multiple times...
     return !data_fg_.empty();
   }
 
-  /** @brief Prefetch a new cache in the background, with up to @p suggested_size entries (or fewer upon reaching end-of-file)
+  /** @brief Read a new background cache, with up to @p suggested_size entries (or fewer upon reaching end-of-file)
 
      Call @p activateCache() afterwards to make the data available via @p chunkAt() or @p readAt().
+     Reads synchronously; see @p cacheChunkAsync() to hide the read behind processing of the active chunk.
      @param suggested_size Number of FASTA entries to read from disk
      @return true if new data is available; false if background data is empty
   */
   bool cacheChunk(int suggested_size)
   {
-    data_bg_.clear();
-    data_bg_.reserve(suggested_size);
-    FASTAFile::FASTAEntry p;
-    for (int i = 0; i < suggested_size; ++i)
-    {
-      std::streampos spos = f_.position();
-      if (!f_.readNext(p)) break;
-      data_bg_.push_back(std::move(p));
-      offsets_.push_back(spos);
-    }
-    return !data_bg_.empty();
+    waitForPrefetch_(); // a pending prefetch writes to the same background cache
+    return cacheChunk_(suggested_size);
+  }
+
+  /** @brief Prefetch a new cache in a background thread, with up to @p suggested_size entries (or fewer upon reaching end-of-file)
+
+     Same as @p cacheChunk(), but returns immediately while a background thread parses the FASTA entries.
+     The data becomes available with the next call to @p activateCache(), which blocks until reading has finished.
+     Thus, the active chunk can be processed (via @p chunkAt()) while the next chunk is read from disk.
+     @param suggested_size Number of FASTA entries to read from disk
+  */
+  void cacheChunkAsync(int suggested_size)
+  {
+    waitForPrefetch_(); // only one prefetch can be in flight
+    prefetch_ = std::async(std::launch::async, &FASTAContainer::cacheChunk_, this, suggested_size);
   }
 
   /// number of entries in active cache
@@ -155,6 +166,7 @@ public:
   */
   bool readAt(FASTAFile::FASTAEntry& protein, size_t pos)
   {
+    waitForPrefetch_(); // a pending prefetch shares the file connection
     // check if position is currently cached...
     if (chunk_offset_ <= pos && pos < chunk_offset_ + chunkSize())
     {
@@ -176,12 +188,14 @@ public:
   /// is the FASTA file empty?
   bool empty()
   { // trusting the FASTA file can be read...
+    waitForPrefetch_();
     return f_.atEnd() && offsets_.empty();
   }
 
   /// resets reading of the FASTA file, enables fresh reading of the FASTA from the beginning
   void reset()
   {
+    waitForPrefetch_();
     offsets_.clear();
     data_fg_.clear();
     data_bg_.clear();
@@ -197,16 +211,40 @@ public:
   */
   size_t size() const
   {
+    waitForPrefetch_();
     return offsets_.size();
   }
 
 private:
+  /// reads up to @p suggested_size entries into the background cache; shared by cacheChunk() and cacheChunkAsync()
+  bool cacheChunk_(int suggested_size)
+  {
+    data_bg_.clear();
+    data_bg_.reserve(suggested_size);
+    FASTAFile::FASTAEntry p;
+    for (int i = 0; i < suggested_size; ++i)
+    {
+      std::streampos spos = f_.position();
+      if (!f_.readNext(p)) break;
+      data_bg_.push_back(std::move(p));
+      offsets_.push_back(spos);
+    }
+    return !data_bg_.empty();
+  }
+
+  /// block until a pending cacheChunkAsync() has finished reading (no-op if none is in flight)
+  void waitForPrefetch_() const
+  {
+    if (prefetch_.valid()) prefetch_.get();
+  }
+
   FASTAFile f_; ///< FASTA file connection
   std::vector<std::streampos> offsets_; ///< internal byte offsets into FASTA file for random access reading of previous entries.
   std::vector<FASTAFile::FASTAEntry> data_fg_; ///< active (foreground) data
   std::vector<FASTAFile::FASTAEntry> data_bg_; ///< prefetched (background) data; will become the next active data
   size_t chunk_offset_; ///< number of entries before the current chunk
   std::string filename_;///< FASTA file name
+  mutable std::future<bool> prefetch_; ///< pending background read issued by cacheChunkAsync()
 };
 
 /**
@@ -257,11 +295,17 @@ public:
   bool cacheChunk(int /*suggested_size*/)
   {
     if (!cache_count_)
-    { 
+    {
       cache_count_ = 1;
       return true;
     }
-    return false; 
+    return false;
+  }
+
+  /// no-op as well; simply forwards to cacheChunk() (no disk access to hide)
+  void cacheChunkAsync(int suggested_size)
+  {
+    cacheChunk(suggested_size);
   }
 
   /** @brief active data spans the full range, i.e. size of container
@@ -311,6 +355,94 @@ private:
   int cache_count_ = 0;
 };
 
+/**
+  @brief Immutable hash index over a fixed set of strings (e.g. the accessions of a FASTA database), queryable by std::string_view
+
+  The index is built once over the complete key set and answers lookups without
+  constructing String/std::string objects and without allocating, making it
+  suitable for hot per-hit paths (e.g. resolving protein accessions during
+  peptide indexing). Internally an open-addressing table with a power-of-two
+  size (load factor <= 0.5) and linear probing is used, i.e. a lookup costs one
+  hash over the query plus (usually) a single key comparison.
+
+  @note The index stores views into the key strings passed to build(). The
+        caller must keep those strings alive and unchanged for the lifetime of
+        the index (same contract as FASTAContainer<TFI_Vector> and its
+        referenced data).
+*/
+class AccessionIndex
+{
+public:
+  /// return value of find() if a key is not contained in the index
+  static constexpr Size npos = std::numeric_limits<Size>::max();
+
+  AccessionIndex() = default;
+
+  /** @brief Builds the index over @p keys; any previous content is discarded
+
+      Duplicate keys are allowed; find() reports the position of the first occurrence.
+
+      @param keys The key set; the index keeps the views, not copies (see class docs)
+  */
+  void build(std::vector<std::string_view> keys)
+  {
+    keys_ = std::move(keys);
+    Size slot_count = 2;
+    while (slot_count < keys_.size() * 2) slot_count *= 2; // load factor <= 0.5
+    slots_.assign(slot_count, 0);
+    for (Size i = 0; i < keys_.size(); ++i)
+    {
+      Size slot = hash_(keys_[i]) & (slot_count - 1);
+      while (slots_[slot] != 0 && keys_[slots_[slot] - 1] != keys_[i])
+      {
+        slot = (slot + 1) & (slot_count - 1);
+      }
+      if (slots_[slot] == 0) slots_[slot] = i + 1; // store position + 1 (0 marks an empty slot)
+    }
+  }
+
+  /// position of @p key in the key set passed to build(), or @p npos if the key is unknown
+  Size find(std::string_view key) const
+  {
+    if (slots_.empty()) return npos;
+    Size slot = hash_(key) & (slots_.size() - 1);
+    while (slots_[slot] != 0)
+    {
+      if (keys_[slots_[slot] - 1] == key) return slots_[slot] - 1;
+      slot = (slot + 1) & (slots_.size() - 1);
+    }
+    return npos;
+  }
+
+  /// is @p key contained in the index?
+  bool has(std::string_view key) const
+  {
+    return find(key) != npos;
+  }
+
+  /// number of keys the index was built over (including duplicates)
+  Size size() const
+  {
+    return keys_.size();
+  }
+
+private:
+  /// FNV-1a over the bytes of @p key (allocation-free; good distribution for short accession strings)
+  static uint64_t hash_(std::string_view key)
+  {
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (const char c : key)
+    {
+      h ^= (unsigned char)c;
+      h *= 0x100000001b3ull;
+    }
+    return h;
+  }
+
+  std::vector<std::string_view> keys_; ///< the key set (views into caller-owned strings)
+  std::vector<Size> slots_; ///< open-addressing table; entry = key position + 1, 0 = empty slot
+};
+
 /**
   @brief Helper class for calculations on decoy proteins
 */
@@ -456,10 +588,11 @@ public:
 
     constexpr size_t PROTEIN_CACHE_SIZE = 4e5;
 
+    proteins.cacheChunk(PROTEIN_CACHE_SIZE);
     while (true)
     {
-      proteins.cacheChunk(PROTEIN_CACHE_SIZE);
       if (!proteins.activateCache()) break;
+      proteins.cacheChunkAsync(PROTEIN_CACHE_SIZE); // read next chunk while we scan the current one
 
       auto prot_count = (SignedSize)proteins.chunkSize();
       ds.all_proteins_count += prot_count;
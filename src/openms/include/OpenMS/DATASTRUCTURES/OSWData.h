@@ -278,16 +278,19 @@ namespace OpenMS
     class OPENMS_DLLAPI OSWData
     {
       public:
-        /// Adds a transition; do this before adding Proteins
+        /// Adds a transition; do this before adding Proteins.
+        /// Transitions are usually added in ascending ID order (OSWFile reads them
+        /// sorted), which makes the hinted insertion below amortized O(1); unsorted
+        /// input stays correct and merely loses the speedup.
         void addTransition(const OSWTransition& tr)
         {
-          transitions_.emplace(tr.getID(), tr);
+          transitions_.emplace_hint(transitions_.end(), tr.getID(), tr);
         }
 
         void addTransition(OSWTransition&& tr)
         {
           UInt32 id = tr.getID();
-          transitions_.emplace(id, std::move(tr));
+          transitions_.emplace_hint(transitions_.end(), id, std::move(tr));
         }
 
         /// Adds a protein, which has all its subcomponents already populated
@@ -297,6 +300,13 @@ namespace OpenMS
         /// @throws Exception::Precondition() if transition IDs within protein are unknown
         void addProtein(OSWProtein&& prot);
 
+        /// Reserve space for @p count proteins (to avoid reallocation when the
+        /// number of proteins to be added is known upfront)
+        void reserveProteins(const Size count)
+        {
+          proteins_.reserve(count);
+        }
+
         /// constant accessor to proteins.
         /// There is no mutable access to prevent accidental violation of invariants (i.e. no matching transitions)
         const std::vector<OSWProtein>& getProteins() const
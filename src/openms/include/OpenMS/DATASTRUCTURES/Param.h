@@ -11,9 +11,10 @@
 #include <OpenMS/DATASTRUCTURES/ParamValue.h>
 #include <OpenMS/OpenMSConfig.h>
 
+#include <map>
+#include <memory>
 #include <set>
 #include <string>
-#include <map>
 
 namespace OpenMS
 {
@@ -36,6 +37,12 @@ namespace OpenMS
     Each parameter can be annotated with an arbitrary number of tags. Tags must not contain comma characters!
     @n E.g. the <i>advanced</i> tag indicates if this parameter is shown to all users or in advanced mode only.
 
+    Copies of a Param share the underlying parameter tree until one of them is modified
+    (copy-on-write). This makes copying cheap and lets e.g. per-thread algorithm clones
+    share one parameter storage instead of duplicating the whole tree. Distinct copies
+    sharing a tree can be read concurrently from multiple threads; as usual, a single
+    Param object must not be modified while another thread accesses it.
+
     @see DefaultParamHandler
 
     @ingroup Datastructures
@@ -224,7 +231,7 @@ protected:
     /// Default constructor
     Param();
 
-    /// Copy constructor
+    /// Copy constructor (shares the parameter tree with @p rhs until one of the copies is modified)
     Param(const Param&) = default;
 
     /// Move constructor
@@ -233,7 +240,7 @@ protected:
     /// Destructor
     ~Param();
 
-    /// Assignment operator
+    /// Assignment operator (shares the parameter tree with @p rhs until one of the copies is modified)
     Param& operator=(const Param&) = default;
 
     /// Move assignment operator
@@ -637,6 +644,8 @@ protected:
     /**
       @brief Returns a mutable reference to a parameter entry.
 
+      Does not detach from copies sharing the tree -- mutating callers must call detach_() first.
+
       @exception Exception::ElementNotFound is thrown for unset parameters
     */
     ParamEntry& getEntry_(const std::string& key) const;
@@ -644,8 +653,11 @@ protected:
     /// Constructor from a node which is used as root node
     Param(const Param::ParamNode& node);
 
-    /// Invisible root node that stores all the data
-    mutable Param::ParamNode root_;
+    /// Get a private copy of the parameter tree if it is currently shared with other Param objects (copy-on-write)
+    void detach_();
+
+    /// Invisible root node that stores all the data; shared between copies until one of them is modified (see detach_())
+    std::shared_ptr<Param::ParamNode> root_;
   };
 
   /// Output of Param to a stream.
@@ -57,8 +57,12 @@ public:
     ParamValue(const char*);
     /// specific constructor for std::string values
     ParamValue(const std::string&);
+    /// specific move constructor for std::string values (avoids copying the string data)
+    ParamValue(std::string&&) noexcept;
     /// specific constructor for string vectors
     ParamValue(const std::vector<std::string>&);
+    /// specific move constructor for string vectors (avoids copying the vector data)
+    ParamValue(std::vector<std::string>&&);
     /// specific constructor for integer vectors
     ParamValue(const std::vector<int>&);
     /// specific constructor for double vectors
@@ -280,8 +284,12 @@ public:
     ParamValue& operator=(const char*);
     /// specific assignment for std::string values
     ParamValue& operator=(const std::string&);
+    /// specific move assignment for std::string values (avoids copying the string data)
+    ParamValue& operator=(std::string&&) noexcept;
     /// specific assignment for string vectors
     ParamValue& operator=(const std::vector<std::string>&);
+    /// specific move assignment for string vectors (avoids copying the vector data)
+    ParamValue& operator=(std::vector<std::string>&&);
     /// specific assignment for integer vectors
     ParamValue& operator=(const std::vector<int>&);
     /// specific assignment for double vectors
@@ -346,15 +354,22 @@ protected:
     /// Type of the currently stored value
     ValueType value_type_;
 
-    /// Space to store the data
-    union
+    /// Space to store the data. String values are stored inline (benefiting
+    /// from std::string's small-string optimization) instead of behind an
+    /// extra heap allocation, since Param trees hold many short string values
+    /// and are copied on every DefaultParamHandler::setParameters() call.
+    /// The active member is tracked by value_type_; the string member is
+    /// constructed/destroyed manually via placement new and clear_().
+    union Data_
     {
       ptrdiff_t ssize_;
       double dou_;
-      std::string* str_;
+      std::string str_;
       std::vector<std::string>* str_list_;
       std::vector<int>* int_list_;
       std::vector<double>* dou_list_;
+      Data_() {} ///< no member is initialized; the enclosing ParamValue manages the active member
+      ~Data_() {} ///< non-trivial members are destroyed in ParamValue::clear_()
     } data_;
 
 private:
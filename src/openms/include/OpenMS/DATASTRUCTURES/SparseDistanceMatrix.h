@@ -0,0 +1,242 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Mathias Walzer $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/CONCEPT/Macros.h>
+#include <OpenMS/CONCEPT/Types.h>
+#include <OpenMS/config.h>
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace OpenMS
+{
+
+/**
+  @brief A thresholded, sparse counterpart of OpenMS::DistanceMatrix
+
+  Stores only element pairs whose distance is below a given cutoff, so the
+  memory consumption is proportional to the number of such pairs instead of
+  the quadratic footprint of OpenMS::DistanceMatrix. Pairs that were never
+  set (or were set to a value at or above the cutoff) are reported with the
+  cutoff itself, i.e. "at least this far apart". Storage is symmetric: each
+  stored pair appears in the neighbor maps of both of its elements.
+
+  Rows can be merged with the single linkage rule (element-wise minimum),
+  which makes the structure directly usable for agglomerative clustering of
+  element counts for which a dense matrix does not fit into memory, see
+  ClusterHierarchical::clusterSparse().
+
+  @ingroup Datastructures
+*/
+template<typename Value>
+class SparseDistanceMatrix
+{
+public:
+  ///@name STL compliance type definitions
+  //@{
+  typedef Value value_type;
+  //@}
+
+  ///@name OpenMS compliance type definitions
+  //@{
+  typedef Size SizeType;
+  typedef value_type ValueType;
+  /// neighbor index to distance mapping of a single row
+  typedef std::map<Size, Value> RowType;
+  //@}
+
+  /** @brief default constructor
+
+  */
+  SparseDistanceMatrix(): rows_(), cutoff_(Value())
+  {
+  }
+
+  /**
+    @brief detailed constructor
+
+    @param dimensionsize the number of rows (and therewith cols)
+    @param cutoff distances at or above this value are not stored and reported as @p cutoff
+  */
+  SparseDistanceMatrix(SizeType dimensionsize, Value cutoff): rows_(dimensionsize), cutoff_(cutoff)
+  {
+  }
+
+  /// destructor
+  ~SparseDistanceMatrix() = default;
+
+  /// copy constructor
+  SparseDistanceMatrix(const SparseDistanceMatrix& source) = default;
+
+  /// assignment operator
+  SparseDistanceMatrix& operator=(const SparseDistanceMatrix& source) = default;
+
+  /// gives the number of rows (i.e. number of elements)
+  SizeType dimensionsize() const
+  {
+    return rows_.size();
+  }
+
+  /// gives the distance cutoff above which pairs are not stored
+  Value cutoff() const
+  {
+    return cutoff_;
+  }
+
+  /// gives the number of stored pairs (i.e. pairs with a distance below the cutoff)
+  SizeType storedPairs() const
+  {
+    SizeType count(0);
+    for (const RowType& row : rows_)
+    {
+      count += row.size();
+    }
+    return count / 2;
+  }
+
+  /**
+    @brief sets a value at a given position
+
+    Stores the pair symmetrically if @p value is below the cutoff, otherwise
+    a previously stored value for the pair is removed. The main diagonal is
+    ignored, self-distance is assumed to be 0.
+
+    @param i the i-th row
+    @param j the j-th col
+    @param value the value to set
+  */
+  void setValue(SizeType i, SizeType j, ValueType value)
+  {
+    OPENMS_PRECONDITION(i < rows_.size() && j < rows_.size(), "SparseDistanceMatrix::setValue(): index out of bounds");
+    if (i == j)
+    {
+      return;
+    }
+    if (value < cutoff_)
+    {
+      rows_[i][j] = value;
+      rows_[j][i] = value;
+    }
+    else
+    {
+      rows_[i].erase(j);
+      rows_[j].erase(i);
+    }
+  }
+
+  /**
+    @brief gets a value at a given position
+
+    @param i the i-th row
+    @param j the j-th col
+    @return the stored distance, 0 for the main diagonal and the cutoff for pairs that are not stored
+  */
+  ValueType getValue(SizeType i, SizeType j) const
+  {
+    OPENMS_PRECONDITION(i < rows_.size() && j < rows_.size(), "SparseDistanceMatrix::getValue(): index out of bounds");
+    if (i == j)
+    {
+      return ValueType();
+    }
+    typename RowType::const_iterator it = rows_[i].find(j);
+    return (it == rows_[i].end()) ? cutoff_ : it->second;
+  }
+
+  /// whether a distance below the cutoff is stored for the pair (@p i, @p j)
+  bool hasValue(SizeType i, SizeType j) const
+  {
+    OPENMS_PRECONDITION(i < rows_.size() && j < rows_.size(), "SparseDistanceMatrix::hasValue(): index out of bounds");
+    return rows_[i].find(j) != rows_[i].end();
+  }
+
+  /// read access to the stored neighbors of row @p i
+  const RowType& row(SizeType i) const
+  {
+    OPENMS_PRECONDITION(i < rows_.size(), "SparseDistanceMatrix::row(): index out of bounds");
+    return rows_[i];
+  }
+
+  /**
+    @brief gives the nearest stored neighbor of row @p i
+
+    @return index and distance of the closest neighbor; (@p i, cutoff) if the row is empty
+  */
+  std::pair<SizeType, ValueType> nearestNeighbor(SizeType i) const
+  {
+    OPENMS_PRECONDITION(i < rows_.size(), "SparseDistanceMatrix::nearestNeighbor(): index out of bounds");
+    std::pair<SizeType, ValueType> nearest(i, cutoff_);
+    for (const typename RowType::value_type& neighbor : rows_[i])
+    {
+      if (neighbor.second < nearest.second)
+      {
+        nearest = neighbor;
+      }
+    }
+    return nearest;
+  }
+
+  /**
+    @brief merges row @p from into row @p to with the single linkage rule
+
+    Every neighbor of @p from is afterwards a neighbor of @p to with the
+    minimum of the two distances, the symmetric entries of the affected
+    neighbors are updated accordingly and row @p from is left empty. The
+    pair (@p from, @p to) itself is dropped, as the two now form one cluster.
+
+    @param from the row to be merged and emptied
+    @param to the row holding the merged neighborhood
+  */
+  void mergeRowsMin(SizeType from, SizeType to)
+  {
+    OPENMS_PRECONDITION(from < rows_.size() && to < rows_.size(), "SparseDistanceMatrix::mergeRowsMin(): index out of bounds");
+    OPENMS_PRECONDITION(from != to, "SparseDistanceMatrix::mergeRowsMin(): cannot merge a row with itself");
+    RowType& source = rows_[from];
+    RowType& target = rows_[to];
+    source.erase(to);
+    target.erase(from);
+    for (const typename RowType::value_type& neighbor : source)
+    {
+      rows_[neighbor.first].erase(from);
+      typename RowType::iterator it = target.find(neighbor.first);
+      if (it == target.end() || neighbor.second < it->second)
+      {
+        target[neighbor.first] = neighbor.second;
+        rows_[neighbor.first][to] = neighbor.second;
+      }
+    }
+    source.clear();
+  }
+
+  /// reset the matrix to hold @p dimensionsize empty rows with the given @p cutoff
+  void resize(SizeType dimensionsize, Value cutoff)
+  {
+    rows_.clear();
+    rows_.resize(dimensionsize);
+    cutoff_ = cutoff;
+  }
+
+  /// removes all stored pairs
+  void clear()
+  {
+    for (RowType& row : rows_)
+    {
+      row.clear();
+    }
+  }
+
+protected:
+  /// sparse storage: one neighbor map per element
+  std::vector<RowType> rows_;
+
+  /// distances at or above this value are not stored
+  Value cutoff_;
+};
+
+} // namespace OpenMS
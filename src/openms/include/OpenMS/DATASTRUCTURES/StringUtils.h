@@ -134,6 +134,40 @@ public:
       return boost::spirit::qi::parse(begin, end, parse_double_, target);
     }
 
+    /**
+      @brief convert a complete string view to a double without allocating
+
+      In contrast to toDouble(), whitespace is not skipped (combine with trimView() if needed)
+      and failure is reported via the return value instead of an exception.
+
+      @param s View on the number
+      @param target Only contains a valid result if true is returned
+      @return true if the complete view was parsed successfully
+    */
+    static bool toDouble(std::string_view s, double& target)
+    {
+      const char* it = s.data();
+      const char* end = s.data() + s.size();
+      return extractDouble(it, end, target) && it == end;
+    }
+
+    /**
+      @brief convert a complete string view to an Int32 without allocating
+
+      In contrast to toInt32(), whitespace is not skipped (combine with trimView() if needed)
+      and failure is reported via the return value instead of an exception.
+
+      @param s View on the number
+      @param target Only contains a valid result if true is returned
+      @return true if the complete view was parsed successfully
+    */
+    static bool toInt32(std::string_view s, Int32& target)
+    {
+      const char* it = s.data();
+      const char* end = s.data() + s.size();
+      return boost::spirit::qi::parse(it, end, boost::spirit::qi::int_, target) && it == end;
+    }
+
   private:
   
     /*
@@ -218,6 +252,16 @@ public:
       return StringUtilsHelper::toDouble(this_s);
     }
 
+    [[maybe_unused]] static bool toDouble(std::string_view s, double& target)
+    {
+      return StringUtilsHelper::toDouble(s, target);
+    }
+
+    [[maybe_unused]] static bool toInt32(std::string_view s, Int32& target)
+    {
+      return StringUtilsHelper::toInt32(s, target);
+    }
+
     template <typename IteratorT>
     static bool extractDouble(IteratorT& begin, const IteratorT& end, double& target)
     {
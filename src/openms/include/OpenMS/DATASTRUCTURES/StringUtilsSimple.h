@@ -642,10 +642,47 @@ namespace OpenMS
   
       // shorten result
       if (has_spaces) this_s.resize(dest - this_s.begin());
-  
+
       return this_s;
     }
-  
+
+    /**
+     @brief Return a view on @p data without leading and trailing whitespaces (\\n, \\t, \\r, ' ')
+
+     Allocation-free counterpart of trim(); the returned view references the original buffer.
+    */
+    inline std::string_view trimView(std::string_view data)
+    {
+      while (!data.empty() && (data.back() == ' ' || data.back() == '\t' || data.back() == '\n' || data.back() == '\r'))
+      {
+        data.remove_suffix(1);
+      }
+      data.remove_prefix(skipWhitespace(data));
+      return data;
+    }
+
+    /**
+     @brief Split @p data at every occurrence of @p splitter into views on the original buffer
+
+     Allocation-free counterpart of split(): the views stay valid as long as the underlying
+     buffer does, and @p substrings is cleared and reused, so a caller splitting many lines
+     (e.g. a TSV reader) does not allocate in steady state.
+
+     In contrast to split(), empty fields are always kept: splitting "a,," at ',' yields
+     three fields, and splitting an empty string yields a single empty field.
+    */
+    inline void splitView(std::string_view data, const char splitter, std::vector<std::string_view>& substrings)
+    {
+      substrings.clear();
+      size_t start = 0;
+      for (size_t pos = data.find(splitter); pos != std::string_view::npos; pos = data.find(splitter, start))
+      {
+        substrings.push_back(data.substr(start, pos - start));
+        start = pos + 1;
+      }
+      substrings.push_back(data.substr(start));
+    }
+
   }
 
 } // namespace OPENMS
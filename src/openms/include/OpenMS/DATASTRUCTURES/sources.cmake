@@ -39,6 +39,7 @@ OSWData.h
 Param.h
 ParamValue.h
 QTCluster.h
+SparseDistanceMatrix.h
 String.h
 StringUtils.h
 StringUtilsSimple.h
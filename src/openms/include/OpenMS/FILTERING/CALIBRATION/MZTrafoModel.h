@@ -15,6 +15,7 @@
 
 namespace OpenMS
 {
+  class MSSpectrum;
     
   /**
 
@@ -150,7 +151,22 @@ namespace OpenMS
 
     */
     double predict(double mz) const;
-    
+
+    /**
+      @brief Apply the model to all peak m/z values of a spectrum (in place).
+
+      Same result as calling predict() for every peak, but the coefficients
+      and the ppm branch are hoisted out of the loop, so the compiler can
+      vectorize the polynomial evaluation. Use this when calibrating whole
+      experiments.
+
+      Make sure the model was trained (train()) and is valid (isValidModel()) before calling this function!
+
+      @param spec The spectrum whose peak positions will be calibrated
+    */
+    void applyToSpectrum(MSSpectrum& spec) const;
+
+
     /**
       @brief Binary search for the model nearest to a specific RT
 
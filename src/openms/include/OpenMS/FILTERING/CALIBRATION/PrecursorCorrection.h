@@ -19,6 +19,7 @@
 #include <OpenMS/METADATA/Precursor.h>
 
 #include <string>
+#include <utility>
 #include <vector>
 #include <set>
 
@@ -33,6 +34,7 @@ namespace OpenMS
   correctToNearestMS1Peak: Correct to the peak in closest proximity in a certain mass range.
   correctToHighestIntensityMS1Peak: Correct to the peak with the highest intensity in a certain mass range.
   correctToNearestFeature: Use feature information to re-annotate a precursor (e.g. falsely assigned to non mono-isotopic trace).
+  correctToMS1Peak: Correct a single MS2 spectrum against its survey scan (building block of the above and of MSDataPrecursorCorrectingConsumer).
   */
 class OPENMS_DLLAPI PrecursorCorrection
 {
@@ -76,7 +78,9 @@ class OPENMS_DLLAPI PrecursorCorrection
      /**
      @brief Selection of the peak in closest proximity as corrected precursor mass in a given mass range (e.g. precursor mass +/- 0.2 Da).
 
-     For each MS2 spectrum the corresponding MS1 spectrum is determined by using the rt information of the precursor.
+     MS2 spectra are grouped under their survey (MS1) scan in a single linear pass,
+     so each MS1 spectrum is looked up once and shared by all its dependent MS2 scans.
+     The groups are corrected in parallel (OpenMP); results are reported in scan order.
      In the MS1, the peak closest to the uncorrected precursor m/z is selected and used as corrected precursor m/z.
 
      @param exp: MSExperiment.
@@ -97,7 +101,9 @@ class OPENMS_DLLAPI PrecursorCorrection
      /**
      @brief Selection of the peak with the highest intensity as corrected precursor mass in a given mass range (e.g. precursor mass +/- 0.2 Da)
 
-     For each MS2 spectrum the corresponding MS1 spectrum is determined by using the rt information of the precursor.
+     MS2 spectra are grouped under their survey (MS1) scan in a single linear pass,
+     so each MS1 spectrum is looked up once and shared by all its dependent MS2 scans.
+     The groups are corrected in parallel (OpenMP); results are reported in scan order.
      In the MS1, the peak with the highest intensity in a given mass range to the uncorrected precursor m/z is selected and used as corrected precursor m/z.
 
      @param exp: MSExperiment.
@@ -115,6 +121,29 @@ class OPENMS_DLLAPI PrecursorCorrection
                                                             std::vector<double> & mzs,
                                                             std::vector<double> & rts);
 
+     /**
+     @brief Corrects the first precursor of a single MS2 spectrum using the peaks of its survey scan.
+
+     This is the single-spectrum building block of correctToNearestMS1Peak and
+     correctToHighestIntensityMS1Peak. It only needs the survey scan at hand, so it
+     can also be applied while streaming, e.g. by MSDataPrecursorCorrectingConsumer
+     during the initial load of a file.
+
+     @param ms1: Survey scan (centroided) the precursor of @p ms2 was sampled from.
+     @param ms2: Fragment spectrum whose first precursor m/z is corrected in-place.
+     @param mz_tolerance: double tolerance used for precursor correction in mass range.
+     @param ppm: bool enables usage of ppm.
+     @param highest_intensity: pick the highest intensity peak in the tolerance window (true) or the nearest peak (false).
+     @param[out] delta_mz: applied m/z shift (corrected minus uncorrected); 0.0 if no correction was applied.
+     @return true if the precursor was corrected.
+     */
+     static bool correctToMS1Peak(const MSSpectrum& ms1,
+                                  MSSpectrum& ms2,
+                                  double mz_tolerance,
+                                  bool ppm,
+                                  bool highest_intensity,
+                                  double& delta_mz);
+
 
      /**
      @brief Reassigns a precursor to the nearest feature in a given rt and mass range.
@@ -152,6 +181,19 @@ class OPENMS_DLLAPI PrecursorCorrection
 
   protected:
 
+      /**
+      @brief Groups MS2 scans under the index of their survey (MS1) scan.
+
+      One linear pass over @p exp; each returned pair holds the index of an MS1
+      spectrum and the indices of all precursor-bearing MS2 scans acquired after it
+      (before the next MS1). Precursor-bearing spectra without a usable survey scan
+      are reported with a warning, as in the per-precursor lookup used before.
+
+      @param exp: constant MSExperiment.
+      @return survey-scan groups in scan order.
+      */
+      static std::vector<std::pair<Size, std::vector<Size>>> groupBySurveyScan_(const MSExperiment& exp);
+
       /**
       @brief Check if precursor is located in the bounding box of a features convex hull.
       Here the bounding box of the feature is extended by the retention time tolerance and
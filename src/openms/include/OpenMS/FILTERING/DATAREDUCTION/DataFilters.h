@@ -17,6 +17,7 @@ namespace OpenMS
 {
   class Feature;
   class ConsensusFeature;
+  class MSExperiment;
   /**
       @brief DataFilter array providing some convenience functions
 
@@ -135,6 +136,26 @@ public:
       return is_active_;
     }
 
+    /**
+        @brief Collects the indices of all peaks in @p spectrum which pass the current filter criteria
+
+        Equivalent to calling passes() for every peak of the spectrum, but
+        much faster on large spectra: the filters are "compiled" once per
+        spectrum (meta data arrays are looked up by name only once, filter
+        types which do not apply to peaks are dropped) and a specialized
+        loop handles the common case of a single intensity threshold.
+    */
+    void passedIndices(const MSSpectrum& spectrum, std::vector<Size>& indices) const;
+
+    /**
+        @brief Removes all peaks from the spectra of @p exp which do not pass the current filter criteria
+
+        Spectra are processed in parallel (using OpenMP); the associated
+        data arrays are kept in sync. Does nothing if the filters are
+        inactive. Chromatograms are not touched.
+    */
+    void filterPeakMap(MSExperiment& exp) const;
+
     /// Returns if the @p feature fulfills the current filter criteria
     bool passes(const Feature& feature) const;
 
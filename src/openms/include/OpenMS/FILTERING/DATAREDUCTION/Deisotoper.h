@@ -16,6 +16,7 @@ namespace OpenMS
 {
 
 class MSSpectrum;
+class MSExperiment;
 
 class OPENMS_DLLAPI Deisotoper
 {
@@ -73,6 +74,38 @@ class OPENMS_DLLAPI Deisotoper
                                             bool annotate_iso_peak_count = false,
                                             bool add_up_intensity = false);
 
+  /** @brief Detect isotopic clusters in all spectra of an experiment (in parallel).
+
+    Applies deisotopeWithAveragineModel() to every spectrum of the given MS level,
+    processing the spectra in parallel (OpenMP) with reusable per-thread workspaces.
+    The averagine intensities for the KL-divergence check are taken from a lookup
+    table that is precomputed once and shared by all threads (one entry per 10 Da),
+    instead of regenerating the model for every peak and charge state. Due to the
+    mass quantization of the table, cluster extensions close to the KL thresholds
+    may differ marginally from the per-spectrum function.
+
+   * @param [exp] Input experiment (all spectra sorted by m/z)
+   * @param [fragment_tolerance] The tolerance used to match isotopic peaks
+   * @param [fragment_unit_ppm] Whether ppm or m/z is used as tolerance
+   * @param [ms_level] Only spectra of this MS level are deisotoped
+   *
+   * All further parameters are passed through to deisotopeWithAveragineModel().
+   */
+    static void deisotopeWithAveragineModel(MSExperiment& exp,
+                                            double fragment_tolerance,
+                                            bool fragment_unit_ppm,
+                                            UInt ms_level = 2,
+                                            int number_of_final_peaks = 5000,
+                                            int min_charge = 1,
+                                            int max_charge = 3,
+                                            bool keep_only_deisotoped = false,
+                                            unsigned int min_isopeaks = 2,
+                                            unsigned int max_isopeaks = 10,
+                                            bool make_single_charged = true,
+                                            bool annotate_charge = false,
+                                            bool annotate_iso_peak_count = false,
+                                            bool add_up_intensity = false);
+
   /** @brief Detect isotopic clusters in a mass spectrum.
 
     Deisotoping is based on C13 abundance and will try to identify a simple
@@ -126,6 +159,37 @@ class OPENMS_DLLAPI Deisotoper
                                          bool use_decreasing_model = true,
                                          unsigned int start_intensity_check = 2,
                                          bool add_up_intensity = false);
+
+  /** @brief Detect isotopic clusters in all spectra of an experiment (in parallel).
+
+    Applies deisotopeAndSingleCharge() to every spectrum of the given MS level,
+    processing the spectra in parallel (OpenMP) with reusable per-thread workspaces
+    (the per-spectrum function allocates its working buffers on every call, which
+    adds up when deisotoping a whole experiment in a loop). Results are identical
+    to calling the per-spectrum function serially.
+
+   * @param [exp] Input experiment (all spectra sorted by m/z)
+   * @param [fragment_tolerance] The tolerance used to match isotopic peaks
+   * @param [fragment_unit_ppm] Whether ppm or m/z is used as tolerance
+   * @param [ms_level] Only spectra of this MS level are deisotoped
+   *
+   * All further parameters are passed through to deisotopeAndSingleCharge().
+   */
+    static void deisotopeAndSingleCharge(MSExperiment& exp,
+                                         double fragment_tolerance,
+                                         bool fragment_unit_ppm,
+                                         UInt ms_level = 2,
+                                         int min_charge = 1,
+                                         int max_charge = 3,
+                                         bool keep_only_deisotoped = false,
+                                         unsigned int min_isopeaks = 3,
+                                         unsigned int max_isopeaks = 10,
+                                         bool make_single_charged = true,
+                                         bool annotate_charge = false,
+                                         bool annotate_iso_peak_count = false,
+                                         bool use_decreasing_model = true,
+                                         unsigned int start_intensity_check = 2,
+                                         bool add_up_intensity = false);
 };
 
 }
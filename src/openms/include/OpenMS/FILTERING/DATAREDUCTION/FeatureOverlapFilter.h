@@ -16,7 +16,7 @@ namespace OpenMS
   {
     public:   
     /*
-        @brief Filter overlapping features using a spatial datastructure (quadtree). 
+        @brief Filter overlapping features using an RT sweep-line over the feature bounding boxes.
                Retains only the best feature in each cluster of overlapping features.
 
         @param FeatureComparator must implement the concept of a less comparator.
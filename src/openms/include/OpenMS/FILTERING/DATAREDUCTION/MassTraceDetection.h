@@ -92,6 +92,37 @@ namespace OpenMS
                   std::vector<MassTrace> & found_masstraces,
                   const Size max_traces = 0);
 
+        /**
+          @brief Extends mass traces from the given apices (in order of decreasing intensity).
+
+          Used by run_() on the whole map and by runTiled_() on one m/z band at a time.
+          If @p keep_low < @p keep_high, only traces whose apex m/z lies in [keep_low, keep_high)
+          are reported; apices outside that band are still extended (and their peaks marked as
+          used), so that the competition for peaks near the band borders matches the untiled run.
+
+          @param apex_intensities If not null, receives the apex intensity of every reported trace (used to restore the global processing order after tiling)
+          @param with_progress Enables the progress logger; must be false when called from worker threads
+        */
+        void extendApices_(const std::vector<Apex>& chrom_apices,
+                           const Size peak_count,
+                           const PeakMap & work_exp,
+                           const std::vector<Size>& spec_offsets,
+                           std::vector<MassTrace> & found_masstraces,
+                           const Size max_traces,
+                           const double keep_low,
+                           const double keep_high,
+                           std::vector<double>* apex_intensities,
+                           const bool with_progress);
+
+        /// Tiled version of run_(): partitions the apices into overlapping m/z bands which are
+        /// extended concurrently; band results are merged back into global apex intensity order.
+        void runTiled_(const std::vector<Apex>& chrom_apices,
+                       const Size peak_count,
+                       const PeakMap & work_exp,
+                       const std::vector<Size>& spec_offsets,
+                       std::vector<MassTrace> & found_masstraces,
+                       const Size max_traces = 0);
+
         // parameter stuff
         double mass_error_ppm_;
         double noise_threshold_int_;
@@ -105,5 +136,6 @@ namespace OpenMS
         double max_trace_length_;
 
         bool reestimate_mt_sd_;
+        Size mz_bands_;
     };
 }
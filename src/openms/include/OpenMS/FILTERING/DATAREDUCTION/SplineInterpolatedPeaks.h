@@ -109,6 +109,20 @@ class OPENMS_DLLAPI SplineInterpolatedPeaks
         */
         double eval(double pos);
 
+        /**
+        * @brief evaluates the spline interpolated intensity at all positions in @p pos
+        *
+        * Batch version of eval() for positions sorted in ascending order, e.g. a full
+        * scan pattern collected via getNextPos(). The packages and their spline segments
+        * are walked through just once for the entire batch, instead of once per position.
+        *
+        * @param pos positions at which to evaluate (must be ascending)
+        * @param intensity output intensities, resized to the size of @p pos
+        *
+        * @throw Exception::IllegalArgument if @p pos is not sorted in ascending order
+        */
+        void eval(const std::vector<double>& pos, std::vector<double>& intensity);
+
         /**
         * @brief returns the next sensible m/z (or RT) position for scanning through a spectrum (or chromatogram)
         * (fast access since we can start search from lastPackage)
@@ -63,6 +63,19 @@ bool isInPackage(double pos) const;
  */
 double eval(double pos) const;
 
+/**
+ * @brief evaluates the interpolated intensity at all positions in [pos_begin, pos_end)
+ *
+ * Batch version of eval() for positions sorted in ascending order. Positions
+ * outside the package evaluate to zero; within the package the spline segments
+ * are advanced along with the positions, avoiding a binary search per position.
+ *
+ * @param pos_begin start of the positions (must be ascending)
+ * @param pos_end end of the positions
+ * @param intensity_begin start of the output range (must provide space for all results)
+ */
+void eval(std::vector<double>::const_iterator pos_begin, std::vector<double>::const_iterator pos_end, std::vector<double>::iterator intensity_begin) const;
+
 private:
 /**
  * @brief position limits of the package in the raw data spectrum
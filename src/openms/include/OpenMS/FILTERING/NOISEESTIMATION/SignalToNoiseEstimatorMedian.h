@@ -263,9 +263,9 @@ protected:
       // bin in which a datapoint would fall
       int to_bin = 0;
 
-      // index of bin where the median is located
+      // index of bin where the median is located (tracked incrementally across windows)
       int median_bin = 0;
-      // additive number of elements from left to x in histogram
+      // number of elements in bins [0..median_bin]
       int element_inc_count = 0;
 
       // tracks elements in current window, which may vary because of unevenly spaced data
@@ -290,6 +290,7 @@ protected:
         {
           to_bin = std::max(std::min<int>((int)((*window_pos_borderleft).getIntensity() / bin_size), bin_count_minus_1), 0);
           --histogram[to_bin];
+          if (to_bin <= median_bin) { --element_inc_count; }
           --elements_in_window;
           ++window_pos_borderleft;
         }
@@ -301,6 +302,7 @@ protected:
           //std::cerr << (*window_pos_borderright).getIntensity() << " " << bin_size << " " << bin_count_minus_1 << std::endl;
           to_bin = std::max(std::min<int>((int)((*window_pos_borderright).getIntensity() / bin_size), bin_count_minus_1), 0);
           ++histogram[to_bin];
+          if (to_bin <= median_bin) { ++element_inc_count; }
           ++elements_in_window;
           ++window_pos_borderright;
         }
@@ -312,15 +314,20 @@ protected:
         }
         else
         {
-          // find bin i where ceil[elements_in_window/2] <= sum_c(0..i){ histogram[c] }
-          median_bin = -1;
-          element_inc_count = 0;
+          // move median_bin to the smallest bin i with ceil[elements_in_window/2] <= sum_c(0..i){ histogram[c] };
+          // since only few elements change between adjacent windows, this is amortized O(1)
+          // instead of rescanning all bins for every data point
           element_in_window_half = (elements_in_window + 1) / 2;
           while (median_bin < bin_count_minus_1 && element_inc_count < element_in_window_half)
           {
             ++median_bin;
             element_inc_count += histogram[median_bin];
           }
+          while (median_bin > 0 && element_inc_count - histogram[median_bin] >= element_in_window_half)
+          {
+            element_inc_count -= histogram[median_bin];
+            --median_bin;
+          }
 
           // increase the error count
           if (median_bin == bin_count_minus_1) {++histogram_oob_percent_; }
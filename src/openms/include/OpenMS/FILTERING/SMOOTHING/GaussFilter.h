@@ -66,12 +66,32 @@ public:
     /**
       @brief Smoothes an MSExperiment containing profile data.
 
-      @exception Exception::IllegalArgument is thrown, if the @em gaussian_width parameter is too small.
+      The spectra (and chromatograms) are smoothed in parallel (if OpenMS is compiled with
+      OpenMP support); each thread reuses its own kernel and scratch buffers across scans.
+
+      @exception Exception::IllegalArgument is thrown, if the @em gaussian_width parameter is too small
+                 or if @em use_ppm_tolerance is set and @p map contains chromatograms.
     */
     void filterExperiment(PeakMap & map);
 
 protected:
 
+    /// Smoothes @p spectrum using @p algo and the caller-provided scratch buffers (resized as needed)
+    void filterSpectrum_(MSSpectrum & spectrum,
+                         GaussFilterAlgorithm & algo,
+                         std::vector<double> & mz_in,
+                         std::vector<double> & int_in,
+                         std::vector<double> & mz_out,
+                         std::vector<double> & int_out);
+
+    /// Smoothes @p chromatogram using @p algo and the caller-provided scratch buffers (resized as needed)
+    void filterChromatogram_(MSChromatogram & chromatogram,
+                             GaussFilterAlgorithm & algo,
+                             std::vector<double> & rt_in,
+                             std::vector<double> & int_in,
+                             std::vector<double> & rt_out,
+                             std::vector<double> & int_out);
+
     GaussFilterAlgorithm gauss_algo_;
 
     /// The spacing of the pre-tabulated kernel coefficients
@@ -184,20 +184,61 @@ public:
 
     /**
       @brief Removed the noise from an MSExperiment containing profile data.
+
+      The spectra (and chromatograms) are smoothed in parallel (if OpenMS is compiled with
+      OpenMP support); the coefficient table is read-only and shared, each thread reuses its
+      own peak buffer across scans.
     */
     void filterExperiment(PeakMap & map)
     {
       Size progress = 0;
-      startProgress(0, map.size() + map.getChromatograms().size(), "smoothing data");
-      for (Size i = 0; i < map.size(); ++i)
-      {
-        filter(map[i]);
-        setProgress(++progress);
-      }
-      for (Size i = 0; i < map.getChromatograms().size(); ++i)
+      const SignedSize n_spectra = (SignedSize)map.size();
+      const SignedSize n_chroms = (SignedSize)map.getChromatograms().size();
+      startProgress(0, n_spectra + n_chroms, "smoothing data");
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
       {
-        filter(map.getChromatogram(i));
-        setProgress(++progress);
+        // per-thread output buffers, reused across scans (cheaper than copying the whole scan incl. meta data)
+        std::vector<Peak1D> spec_buffer;
+        std::vector<ChromatogramPeak> chrom_buffer;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 100)
+#endif
+        for (SignedSize i = 0; i < n_spectra; ++i)
+        {
+          MSSpectrum& spectrum = map[i];
+          if (frame_size_ <= spectrum.size()) // filter() leaves shorter scans untouched
+          {
+            spec_buffer.resize(spectrum.size());
+            filter(spectrum.begin(), spectrum.end(), spec_buffer.begin());
+            std::copy(spec_buffer.begin(), spec_buffer.end(), spectrum.begin());
+          }
+#ifdef _OPENMP
+#pragma omp critical (SavitzkyGolayFilterProgress)
+#endif
+          setProgress(++progress);
+        }
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 100)
+#endif
+        for (SignedSize i = 0; i < n_chroms; ++i)
+        {
+          MSChromatogram& chromatogram = map.getChromatogram(i);
+          if (frame_size_ <= chromatogram.size())
+          {
+            chrom_buffer.resize(chromatogram.size());
+            filter(chromatogram.begin(), chromatogram.end(), chrom_buffer.begin());
+            std::copy(chrom_buffer.begin(), chrom_buffer.end(), chromatogram.begin());
+          }
+#ifdef _OPENMP
+#pragma omp critical (SavitzkyGolayFilterProgress)
+#endif
+          setProgress(++progress);
+        }
       }
       endProgress();
     }
@@ -309,6 +309,55 @@ public:
 
     }
 
+    /**
+        @brief Distribute raw points onto a uniform grid, adding into a caller-owned intensity buffer.
+
+        Specialization of raster() for the common case that the resampling
+        points are equally spaced (grid point i sits at start_pos + i *
+        spacing). The grid index of every raw point is then computed directly
+        from its m/z instead of walking an iterator over the output range, so
+        the loop has no data-dependent control flow and compiles to
+        vectorizable straight-line code. The intensity of each raw point is
+        distributed between its two neighboring grid points exactly as in
+        raster(), conserving the sum of intensity; points outside the grid are
+        added to the first or last grid point.
+
+        The output buffer is owned by the caller and is only added to, so
+        several inputs can be accumulated into the same buffer without any
+        intermediate allocations.
+
+        @param mz_raw m/z values of the input data (sorted)
+        @param int_raw Intensity values of the input data (same length as @p mz_raw)
+        @param n_raw Number of input data points
+        @param start_pos Position of the first grid point
+        @param spacing Distance between two adjacent grid points
+        @param int_resampled Caller-owned intensity buffer of the grid (added to, not overwritten)
+        @param n_resampled Number of grid points
+    */
+    static void raster_uniform(const double* mz_raw, const double* int_raw, Size n_raw,
+        double start_pos, double spacing, double* int_resampled, Size n_resampled);
+
+    /**
+        @brief Resample multiple spectra onto one uniform grid and sum them up in a single pass.
+
+        Fused variant of raster_uniform() for adding up several spectra (as
+        done per picked peak apex in DIA scoring): all inputs are distributed
+        onto the same caller-owned intensity buffer, avoiding one resampled
+        copy per input spectrum.
+
+        @param mz_arrays m/z arrays of the input spectra (each sorted)
+        @param int_arrays Intensity arrays of the input spectra (parallel to @p mz_arrays)
+        @param sizes Number of data points of each input spectrum
+        @param start_pos Position of the first grid point
+        @param spacing Distance between two adjacent grid points
+        @param int_resampled Caller-owned intensity buffer of the grid (added to, not overwritten)
+        @param n_resampled Number of grid points
+    */
+    static void raster_uniform(const std::vector<const double*>& mz_arrays,
+        const std::vector<const double*>& int_arrays,
+        const std::vector<Size>& sizes,
+        double start_pos, double spacing, double* int_resampled, Size n_resampled);
+
 protected:
 
     /// Spacing of the resampled data
@@ -0,0 +1,156 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+//
+#pragma once
+
+#include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
+#include <OpenMS/KERNEL/StandardTypes.h>
+#include <OpenMS/KERNEL/MSSpectrum.h>
+#include <OpenMS/KERNEL/MSExperiment.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace OpenMS
+{
+
+  /**
+    @brief Combined noise filter: intensity threshold, top N peaks per m/z window and overall N largest peaks in a single pass
+
+    Retains the same peaks as running ThresholdMower, WindowMower (jumping window) and NLargest in sequence,
+    which is the typical search engine preprocessing. Instead of sorting and copying the peak data once per
+    stage, peaks are selected per window via partial selection (std::nth_element) on peak indices and the
+    spectrum is compacted in place at the end. The filtered spectrum stays sorted by m/z, so no re-sort
+    is needed afterwards. Selection scratch buffers are kept per thread and reused across spectra.
+
+    @htmlinclude OpenMS_TopNPerWindowFilter.parameters
+
+    @ingroup SpectraPreprocessers
+  */
+  class OPENMS_DLLAPI TopNPerWindowFilter :
+    public DefaultParamHandler
+  {
+public:
+
+    // @name Constructors and Destructors
+    // @{
+    /// default constructor
+    TopNPerWindowFilter();
+    /// destructor
+    ~TopNPerWindowFilter() override;
+
+    /// copy constructor
+    TopNPerWindowFilter(const TopNPerWindowFilter& source);
+    /// assignment operator
+    TopNPerWindowFilter& operator=(const TopNPerWindowFilter& source);
+    // @}
+
+    ///
+    template <typename SpectrumType>
+    void filterSpectrum(SpectrumType& spectrum)
+    {
+      if (spectrum.empty())
+      {
+        return;
+      }
+
+      if (!spectrum.isSorted())
+      {
+        spectrum.sortByPosition();
+      }
+
+      // per-thread scratch, reused across spectra
+      static thread_local std::vector<Size> window;   // indices of the current window's peaks (above threshold)
+      static thread_local std::vector<Size> selected; // indices of all retained peaks
+      selected.clear();
+      window.clear();
+
+      // intensity-descending order of peak indices
+      auto more_intense = [&spectrum](Size a, Size b)
+      {
+        typename SpectrumType::PeakType::IntensityLess cmp;
+        return cmp(spectrum[b], spectrum[a]);
+      };
+
+      // keep the @p keep most intense peaks of the current window, in m/z order
+      auto selectTopN = [&](Size keep)
+      {
+        if (window.size() > keep)
+        {
+          std::nth_element(window.begin(), window.begin() + keep, window.end(), more_intense);
+          window.resize(keep);
+          std::sort(window.begin(), window.end()); // restore m/z order
+        }
+        selected.insert(selected.end(), window.begin(), window.end());
+      };
+
+      // assign peaks to jumping windows; as there might be large gaps between peaks
+      // resulting in empty windows, each window starts at its first peak
+      double window_start_mz(0);
+      for (Size i = 0; i != spectrum.size(); ++i)
+      {
+        if (spectrum[i].getIntensity() < threshold_)
+        {
+          continue;
+        }
+        if (window.empty())
+        {
+          window_start_mz = spectrum[i].getMZ();
+        }
+        else if (spectrum[i].getMZ() - window_start_mz >= windowsize_)
+        {
+          selectTopN(peakcount_);
+          window.clear();
+          window_start_mz = spectrum[i].getMZ();
+        }
+        window.push_back(i);
+      }
+
+      if (!window.empty()) // last window is not empty
+      {
+        // Note that the last window might be much smaller than windowsize.
+        // Therefore the number of peaks kept from this window is adapted accordingly.
+        // Otherwise a lot of noise peaks are kept from each end of a spectrum.
+        double last_window_size = spectrum[window.back()].getMZ() - window_start_mz;
+        double last_window_size_fraction = last_window_size / windowsize_;
+        Size last_window_peakcount = static_cast<Size>(std::round(last_window_size_fraction * peakcount_));
+        selectTopN(last_window_peakcount);
+      }
+
+      // keep the nlargest most intense peaks overall
+      if (selected.size() > nlargest_)
+      {
+        std::nth_element(selected.begin(), selected.begin() + nlargest_, selected.end(), more_intense);
+        selected.resize(nlargest_);
+        std::sort(selected.begin(), selected.end()); // restore m/z order
+      }
+
+      if (selected.size() == spectrum.size())
+      {
+        return; // nothing was filtered out
+      }
+      spectrum.select(selected);
+    }
+
+    void filterPeakSpectrum(PeakSpectrum& spectrum);
+
+    /// filters all spectra of the map, parallel over spectra
+    void filterPeakMap(PeakMap& exp);
+
+protected:
+    void updateMembers_() override;
+
+private:
+    double threshold_;
+    double windowsize_;
+    Size peakcount_;
+    Size nlargest_;
+  };
+
+}
@@ -20,6 +20,7 @@ SpectraMerger.h
 SqrtMower.h
 TICFilter.h
 ThresholdMower.h
+TopNPerWindowFilter.h
 WindowMower.h
 )
 
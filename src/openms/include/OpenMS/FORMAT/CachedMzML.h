@@ -9,6 +9,7 @@
 #pragma once
 
 #include <OpenMS/KERNEL/MSExperiment.h>
+#include <OpenMS/SYSTEM/MemoryMappedFile.h>
 
 #include <fstream>
 
@@ -85,9 +86,12 @@ protected:
     /// Meta data
     MSExperiment meta_ms_experiment_;
 
-    /// Internal filestream 
+    /// Internal filestream (fallback if the file cannot be memory-mapped)
     std::ifstream ifs_;
 
+    /// Memory mapping of the cached file (data is read via the mapping if open)
+    Internal::MemoryMappedFile mmap_file_;
+
     /// Name of the mzML file
     String filename_;
 
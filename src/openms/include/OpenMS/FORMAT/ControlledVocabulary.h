@@ -200,6 +200,48 @@ protected:
     */
     bool checkName_(const String& id, const String& name, bool ignore_case = true) const;
 
+    /**
+        @brief Parses an OBO file into the vocabulary
+
+        The header values of the file are returned in @p version, @p label and
+        @p url (empty if not present); the ids of the parsed terms are
+        appended to @p file_term_ids.
+
+        @exception Exception::FileNotFound is thrown if the file could not be opened
+        @exception Exception::ParseError is thrown if an error occurs during parsing
+    */
+    void parseOBOFile_(const String& filename, std::vector<String>& file_term_ids, String& version, String& label, String& url);
+
+    /**
+        @brief Returns the path of the binary cache file for the OBO file @p filename
+
+        The cache is keyed on the content hash of the OBO file, so editing or
+        updating the file automatically leads to a fresh cache entry.
+
+        @return Empty string if caching is disabled (environment variable @c OPENMS_DISABLE_CV_CACHE) or @p filename cannot be read
+    */
+    String cacheFilename_(const String& filename) const;
+
+    /**
+        @brief Loads the terms of a single OBO file from its binary cache
+
+        On success, the terms are added to the vocabulary and the header values
+        of the cached file are returned in @p version, @p label and @p url
+        (empty if not present in the file).
+
+        @return false if the cache file is missing or invalid (wrong magic bytes, format version, or truncated)
+    */
+    bool loadFromCache_(const String& cache_filename, String& version, String& label, String& url);
+
+    /**
+        @brief Writes the terms parsed from a single OBO file (given by their ids) to the binary cache
+
+        Best effort: the cache is written to a temporary file and then moved
+        into place, so concurrently starting tools never see a partial cache;
+        failures (e.g. a read-only home directory) are silently ignored.
+    */
+    void writeCache_(const String& cache_filename, const std::vector<String>& file_term_ids, const String& version, const String& label, const String& url) const;
+
     /// Map from ID to CVTerm
     std::map<String, CVTerm> terms_;
     /// Map from name to id
@@ -0,0 +1,126 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/FORMAT/MSNumpressCoder.h>
+#include <OpenMS/KERNEL/MSExperiment.h>
+
+#include <list>
+#include <map>
+
+namespace OpenMS
+{
+
+  /**
+    @brief An MSExperiment that keeps its peak data numpress-compressed in memory
+
+    This container is intended for applications that need many experiments
+    resident at the same time (e.g. QC overviews) but only access a few spectra
+    at a time. The peak data of each spectrum is stored numpress-compressed
+    (linear for m/z, slof for intensity, see MSNumpressCoder), which typically
+    reduces the resident peak memory by 5-10x. All spectrum meta data
+    (retention time, MS level, precursors, float/integer/string data arrays)
+    is kept uncompressed and can be inspected without triggering decompression.
+
+    Spectra are decompressed transparently by getSpectrum(). A small LRU
+    working set (see setWorkingSetSize()) holds the most recently accessed
+    spectra in decompressed form, so repeated access to the same spectra is
+    cheap. References returned by getSpectrum() are only guaranteed to stay
+    valid until the next getSpectrum() call, since the referenced spectrum may
+    be evicted from the working set.
+
+    @note Numpress encoding is lossy: m/z values are accurate to within the
+    numpress error tolerance (1e-4 relative by default) and intensities to
+    about 2e-4 relative. This matches the accuracy of numpress-compressed
+    mzML files and is usually negligible for QC purposes, but the round trip
+    through compress() / getSpectrum() is not bit-exact.
+  */
+  class OPENMS_DLLAPI CompressedMSExperiment
+  {
+public:
+
+    /// Default constructor, creates an empty container
+    CompressedMSExperiment() = default;
+
+    /**
+      @brief Constructor, compresses all spectra of @p exp
+
+      @param exp The experiment to compress
+      @param working_set_size Number of decompressed spectra kept in the LRU working set
+    */
+    explicit CompressedMSExperiment(const MSExperiment& exp, Size working_set_size = 32);
+
+    /**
+      @brief Compresses all spectra of @p exp, replacing the current content
+
+      Chromatograms and experimental settings are stored as-is; only the peak
+      data of the spectra is compressed.
+    */
+    void compress(const MSExperiment& exp);
+
+    /**
+      @brief Returns a single spectrum, decompressing it if necessary
+
+      The returned reference points into the LRU working set and stays valid
+      until the next call to getSpectrum().
+
+      @throw Exception::IndexOverflow is thrown if @p id is not a valid spectrum index
+    */
+    const MSSpectrum& getSpectrum(Size id);
+
+    /// Returns the number of spectra
+    Size getNrSpectra() const;
+
+    /// Returns the experimental settings (meta data of the whole experiment)
+    const ExperimentalSettings& getExperimentalSettings() const;
+
+    /// Decompresses all spectra into a regular MSExperiment
+    MSExperiment toExperiment();
+
+    /// Returns the number of bytes held in compressed peak data
+    Size getCompressedSizeInBytes() const;
+
+    /// Returns the number of decompressed spectra kept in the LRU working set
+    Size getWorkingSetSize() const;
+
+    /// Sets the number of decompressed spectra kept in the LRU working set (minimum 1)
+    void setWorkingSetSize(Size working_set_size);
+
+private:
+
+    /// A single spectrum with compressed peak data
+    struct CompressedSpectrum
+    {
+      MSSpectrum meta; ///< spectrum meta data and data arrays, peak data cleared
+      String mz_data; ///< raw numpress linear encoded m/z values
+      String intensity_data; ///< raw numpress slof encoded intensities
+      Size n_peaks = 0; ///< number of encoded peaks
+    };
+
+    /// Decompresses spectrum @p id into @p spec
+    void decompressInto_(Size id, MSSpectrum& spec);
+
+    /// Compressed spectra in original order
+    std::vector<CompressedSpectrum> spectra_;
+    /// Experiment-wide meta data
+    ExperimentalSettings settings_;
+    /// Chromatograms are stored as-is (they are few and small compared to spectra)
+    std::vector<MSChromatogram> chromatograms_;
+
+    /// LRU working set: most recently used spectrum first
+    std::list<std::pair<Size, MSSpectrum> > working_set_;
+    /// Index into the working set by spectrum index
+    std::map<Size, std::list<std::pair<Size, MSSpectrum> >::iterator> working_set_index_;
+    /// Maximal number of decompressed spectra kept
+    Size working_set_size_ = 32;
+
+    MSNumpressCoder coder_;
+  };
+
+} // namespace OpenMS
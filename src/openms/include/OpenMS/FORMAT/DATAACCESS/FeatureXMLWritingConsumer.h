@@ -0,0 +1,108 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/FORMAT/HANDLERS/FeatureXMLHandler.h>
+#include <OpenMS/KERNEL/FeatureMap.h>
+
+#include <fstream>
+
+namespace OpenMS
+{
+    /**
+      @brief Consumer class that writes features to disk using the featureXML format.
+
+      The FeatureXMLWritingConsumer is the featureXML counterpart of
+      MSDataWritingConsumer: it writes features to disk on the fly (as soon as
+      they are consumed) instead of requiring the complete FeatureMap in
+      memory. This is useful for feature detection on very large maps where
+      features are produced incrementally.
+
+      Example usage:
+
+      @code
+      FeatureXMLWritingConsumer consumer(outfile);
+      consumer.setExpectedSize(feature_count);
+      consumer.setMetaData(map_meta); // identifications, data processing etc.
+      [...]
+      // multiple times ...
+      consumer.consumeFeature(feature);
+      [...]
+      // closes the featureList / featureMap tags (also done by the destructor)
+      consumer.close();
+      @endcode
+
+      @note The first call to consumeFeature() writes the featureXML header to
+      disk, so setExpectedSize() and setMetaData() have to be called before
+      the first feature is consumed.
+
+      @note The number of features passed to setExpectedSize() is stored in
+      the featureList count attribute; a warning is emitted on close() if it
+      does not match the number of features actually written.
+    */
+    class OPENMS_DLLAPI FeatureXMLWritingConsumer
+    {
+public:
+
+      /// Constructor, opens the output file
+      explicit FeatureXMLWritingConsumer(const String& filename);
+
+      /// Destructor, closes the document if close() was not called yet
+      ~FeatureXMLWritingConsumer();
+
+      // streams cannot be copied
+      FeatureXMLWritingConsumer(const FeatureXMLWritingConsumer&) = delete;
+      FeatureXMLWritingConsumer& operator=(const FeatureXMLWritingConsumer&) = delete;
+
+      /// Set the number of features which will be consumed (written to the featureList count attribute)
+      void setExpectedSize(Size size);
+
+      /// Set the meta data written to the header (everything of @p map except the features themselves)
+      void setMetaData(const FeatureMap& map);
+
+      /// Write a single feature to disk (writes the header on the first call)
+      void consumeFeature(const Feature& feature);
+
+      /// Write the closing tags and flush the file (no further features can be consumed)
+      void close();
+
+      /// Number of features written so far
+      Size getNrFeaturesWritten() const
+      {
+        return features_written_;
+      }
+
+protected:
+
+      /// Write the header if it has not been written yet
+      void writeHeaderIfNecessary_();
+
+      /// Meta data written to the header (features are never stored here)
+      FeatureMap meta_;
+
+      /// Handler performing the actual XML serialization
+      Internal::FeatureXMLHandler handler_;
+
+      /// Output file stream
+      std::ofstream ofs_;
+
+      /// Number of features announced via setExpectedSize()
+      Size expected_size_ = 0;
+
+      /// Number of features written so far
+      Size features_written_ = 0;
+
+      /// Whether the header has been written
+      bool header_written_ = false;
+
+      /// Whether the footer has been written
+      bool footer_written_ = false;
+    };
+
+} //end namespace OpenMS
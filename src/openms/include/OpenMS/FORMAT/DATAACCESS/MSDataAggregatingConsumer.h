@@ -26,6 +26,11 @@ namespace OpenMS
       Constructor). Spectra are aggregated using
       SpectrumAddition::addUpSpectra() which merges the spectra.
 
+      @note To avoid copying peak data, consumed spectra are moved into the
+      internal buffer and may be left in a moved-from state after
+      consumeSpectrum() returns. Spectra with a unique retention time are
+      passed on unchanged (without a resampling round-trip).
+
     */
     class OPENMS_DLLAPI MSDataAggregatingConsumer :
       public Interfaces::IMSDataConsumer
@@ -68,6 +73,11 @@ namespace OpenMS
 
       void setExperimentalSettings(const OpenMS::ExperimentalSettings&) override {}
 
+    private:
+
+      /// aggregate the buffered spectra (if more than one) and pass the result to the next consumer
+      void flushSpectrumList_();
+
     };
 
 } //end namespace OpenMS
@@ -0,0 +1,150 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/INTERFACES/IMSDataConsumer.h>
+#include <OpenMS/KERNEL/MSSpectrum.h>
+#include <OpenMS/KERNEL/MSChromatogram.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace OpenMS
+{
+
+  /**
+    @brief Consumer class that forwards all consumed data to a downstream consumer on a background thread
+
+    Wraps any IMSDataConsumer and decouples it from the producing thread: each
+    consumed spectrum or chromatogram is placed in a bounded queue and handed
+    to the downstream consumer by a dedicated worker thread, strictly in the
+    order it was consumed. This overlaps the producer's computation with the
+    downstream work, which is most useful when the downstream consumer
+    serializes to disk (e.g. MSDataWritingConsumer or a chain ending in one):
+    the transformation of the next spectrum then runs while the previous one
+    is still being written.
+
+    If the queue is full, consumeSpectrum() / consumeChromatogram() block
+    until the worker catches up, so memory stays bounded by the queue
+    capacity. setExperimentalSettings() and setExpectedSize() are forwarded
+    synchronously and must be called before consuming, as usual.
+
+    Call waitForCompletion() after the last spectrum or chromatogram to drain
+    the queue and surface any exception thrown by the downstream consumer;
+    the destructor also drains the queue but has to swallow such exceptions.
+
+    Usage:
+
+    @code
+    PlainMSDataWritingConsumer writing_consumer(outfile);
+    writing_consumer.setExpectedSize(specsize, 0);
+    writing_consumer.setExperimentalSettings(exp_settings);
+    MSDataAsyncConsumer async_consumer(&writing_consumer);
+    [...]
+    // multiple times, returns as soon as the spectrum is queued ...
+    async_consumer.consumeSpectrum(spec);
+    [...]
+    async_consumer.waitForCompletion(); // rethrows write errors, if any
+    @endcode
+
+    @note This class does not take ownership - the downstream consumer must
+    outlive it (or at least outlive waitForCompletion()).
+  */
+  class OPENMS_DLLAPI MSDataAsyncConsumer :
+    public Interfaces::IMSDataConsumer
+  {
+
+  public:
+
+    /**
+      @brief Constructor, starts the worker thread
+
+      @param downstream The consumer to forward all data to (not owned)
+      @param queue_capacity Maximal number of queued spectra/chromatograms
+        before consuming blocks (minimum 1)
+    */
+    explicit MSDataAsyncConsumer(Interfaces::IMSDataConsumer* downstream, Size queue_capacity = 16);
+
+    /// Destructor; drains the queue and joins the worker thread (swallowing downstream exceptions)
+    ~MSDataAsyncConsumer() override;
+
+    MSDataAsyncConsumer(const MSDataAsyncConsumer&) = delete;
+    MSDataAsyncConsumer& operator=(const MSDataAsyncConsumer&) = delete;
+
+    /// Forwarded synchronously to the downstream consumer; call before consuming
+    void setExperimentalSettings(const ExperimentalSettings& settings) override;
+
+    /// Forwarded synchronously to the downstream consumer; call before consuming
+    void setExpectedSize(Size s_size, Size c_size) override;
+
+    /**
+      @brief Queue a spectrum for the downstream consumer
+
+      Blocks while the queue is full. Rethrows a pending downstream exception,
+      if one occurred since the last call.
+    */
+    void consumeSpectrum(SpectrumType& s) override;
+
+    /**
+      @brief Queue a chromatogram for the downstream consumer
+
+      Blocks while the queue is full. Rethrows a pending downstream exception,
+      if one occurred since the last call.
+    */
+    void consumeChromatogram(ChromatogramType& c) override;
+
+    /**
+      @brief Wait until all queued data has been handed to the downstream consumer
+
+      Joins the worker thread; consuming further data afterwards is not
+      allowed. Rethrows the first exception thrown by the downstream
+      consumer, if any.
+    */
+    void waitForCompletion();
+
+  private:
+
+    /// A queued spectrum or chromatogram (only one of the two is filled)
+    struct QueueItem
+    {
+      bool is_spectrum;
+      SpectrumType spectrum;
+      ChromatogramType chromatogram;
+    };
+
+    /// worker thread main loop: hand queued items to the downstream consumer in order
+    void run_();
+
+    /// block until the queue has room, then append @p item (shared by both consume functions)
+    void enqueue_(QueueItem&& item);
+
+    /// downstream consumer (not owned)
+    Interfaces::IMSDataConsumer* downstream_;
+    /// maximal number of queued items
+    Size queue_capacity_;
+    /// queued items, consumed front to back by the worker
+    std::deque<QueueItem> queue_;
+    /// protects queue_, finished_ and error_
+    std::mutex mutex_;
+    /// signaled when the worker removed an item (queue may have room again)
+    std::condition_variable queue_has_room_;
+    /// signaled when an item was queued or finished_ was set
+    std::condition_variable queue_has_data_;
+    /// set once no further items will be queued (worker exits after draining)
+    bool finished_;
+    /// first exception thrown by the downstream consumer, if any
+    std::exception_ptr error_;
+    /// dedicated worker thread
+    std::thread worker_;
+  };
+
+} //end namespace OpenMS
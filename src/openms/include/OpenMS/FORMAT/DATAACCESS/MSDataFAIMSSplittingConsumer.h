@@ -0,0 +1,106 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Eugen Netz $
+// $Authors: Eugen Netz $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/INTERFACES/IMSDataConsumer.h>
+
+#include <OpenMS/KERNEL/StandardTypes.h>
+
+#include <OpenMS/KERNEL/MSSpectrum.h>
+#include <OpenMS/KERNEL/MSChromatogram.h>
+#include <OpenMS/METADATA/ExperimentalSettings.h>
+
+#include <functional>
+#include <map>
+
+namespace OpenMS
+{
+
+    /**
+      @brief Routes spectra of a FAIMS experiment to per-compensation-voltage downstream consumers
+
+      Streaming counterpart of IMDataConverter::splitByFAIMSCV(): instead of
+      loading the full experiment and splitting it afterwards, each consumed
+      spectrum is forwarded to the consumer responsible for its compensation
+      voltage (CV). Since the set of CVs is not known up front, a factory
+      callback is invoked once for every newly encountered CV; it typically
+      creates a file-writing consumer (e.g. a PlainMSDataWritingConsumer or
+      MSDataCachedConsumer) for that CV. This splits a FAIMS run into per-CV
+      files in a single pass, holding only one spectrum at a time.
+
+      Experimental settings passed to setExperimentalSettings() are recorded
+      and replayed to every newly created downstream consumer, so they may be
+      set before the first spectrum as usual. Chromatograms are dropped with a
+      warning, matching IMDataConverter::splitByFAIMSCV().
+
+      @note The factory retains ownership of the consumers it returns; they
+      must outlive this consumer.
+
+      Usage:
+
+      @code
+      std::vector<std::unique_ptr<PlainMSDataWritingConsumer>> writers;
+      MSDataFAIMSSplittingConsumer splitter([&](double cv)
+        {
+          writers.push_back(std::make_unique<PlainMSDataWritingConsumer>(filenameForCV(cv)));
+          return writers.back().get();
+        });
+      MzMLFile().transform(in, &splitter, true);
+      @endcode
+    */
+    class OPENMS_DLLAPI MSDataFAIMSSplittingConsumer :
+      public Interfaces::IMSDataConsumer
+    {
+
+    public:
+
+      /// Factory invoked once per newly encountered compensation voltage; the returned consumer is not owned
+      typedef std::function<Interfaces::IMSDataConsumer*(double)> ConsumerFactory;
+
+      /**
+        @brief Constructor
+
+        @param consumer_factory Creates (or looks up) the downstream consumer for a compensation voltage
+
+        @throws Exception::IllegalArgument if @p consumer_factory is empty
+      */
+      explicit MSDataFAIMSSplittingConsumer(ConsumerFactory consumer_factory);
+
+      void setExpectedSize(Size, Size) override {}
+
+      /**
+        @brief Forwards @p s to the consumer responsible for its compensation voltage
+
+        @throws Exception::MissingInformation if @p s does not carry a FAIMS compensation voltage
+      */
+      void consumeSpectrum(SpectrumType& s) override;
+
+      /// Chromatograms are dropped (a warning is logged once)
+      void consumeChromatogram(ChromatogramType& c) override;
+
+      /// Recorded and replayed to every downstream consumer created afterwards
+      void setExperimentalSettings(const OpenMS::ExperimentalSettings& settings) override;
+
+      /// The downstream consumers created so far, by compensation voltage
+      const std::map<double, Interfaces::IMSDataConsumer*>& getConsumers() const;
+
+    private:
+
+      /// Returns the consumer for @p cv, creating it via the factory on first use
+      Interfaces::IMSDataConsumer* consumerForCV_(double cv);
+
+      ConsumerFactory consumer_factory_;
+      std::map<double, Interfaces::IMSDataConsumer*> consumers_;
+      ExperimentalSettings settings_;
+      bool settings_set_;
+      bool warned_chromatograms_;
+
+    };
+
+} //end namespace OpenMS
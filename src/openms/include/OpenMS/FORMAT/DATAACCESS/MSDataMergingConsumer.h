@@ -0,0 +1,98 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/INTERFACES/IMSDataConsumer.h>
+
+#include <OpenMS/KERNEL/StandardTypes.h>
+
+#include <OpenMS/KERNEL/MSSpectrum.h>
+#include <OpenMS/KERNEL/MSChromatogram.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+
+    /**
+      @brief Merges blocks of consecutive spectra by retention time
+
+      Streaming counterpart of SpectraMerger's block-wise merging: spectra of
+      the selected MS level are collected in RT order into a block which is
+      merged (summed up and resampled, see SpectrumAddition::addUpSpectra())
+      and passed to the next consumer once the block holds @p block_size
+      spectra or spans more than @p rt_max_length seconds. Only the active
+      block is kept in memory, so experiments far exceeding RAM (e.g.
+      ion-mobility-resolved profile data read from an OnDiscMSExperiment) can
+      be merged by streaming them through this consumer.
+
+      The merged spectrum carries the meta data (RT, native id, ...) of the
+      first spectrum of its block. Spectra of other MS levels and
+      chromatograms are passed through unchanged; note that such spectra may
+      reach the next consumer before the (earlier) block they interleave with
+      is complete and emitted.
+
+      Deleting this consumer flushes the remaining block to the next consumer
+      (as with MSDataAggregatingConsumer), so it must be deleted before the
+      next consumer.
+
+    */
+    class OPENMS_DLLAPI MSDataMergingConsumer :
+      public Interfaces::IMSDataConsumer
+    {
+
+      Interfaces::IMSDataConsumer* next_consumer_;
+      Size block_size_;
+      double rt_max_length_;
+      UInt ms_level_;
+      std::vector<SpectrumType> block_;
+
+    public:
+
+      /**
+        @brief Constructor
+
+        @param next_consumer Consumer the merged spectra are passed to
+        @param block_size Maximal number of spectra merged into one block
+        @param rt_max_length Maximal RT span of one block in seconds (0 = no limit)
+        @param ms_level Only spectra of this MS level are merged; others pass through
+
+        @note This does not transfer ownership of the consumer
+      */
+      MSDataMergingConsumer(Interfaces::IMSDataConsumer* next_consumer,
+                            Size block_size,
+                            double rt_max_length = 0.0,
+                            UInt ms_level = 1);
+
+      /**
+        @brief Destructor
+
+        Flushes the remaining block to the next consumer
+
+        @note It is essential to not delete the underlying next_consumer before
+        deleting this object, otherwise we risk a memory error
+      */
+      ~MSDataMergingConsumer() override;
+
+      void setExpectedSize(Size, Size) override {}
+
+      void consumeSpectrum(SpectrumType& s) override;
+
+      void consumeChromatogram(ChromatogramType& c) override;
+
+      void setExperimentalSettings(const OpenMS::ExperimentalSettings&) override {}
+
+    private:
+
+      /// Merge the active block (if any) and pass the result to the next consumer
+      void flush_();
+
+    };
+
+} //end namespace OpenMS
@@ -0,0 +1,99 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/INTERFACES/IMSDataConsumer.h>
+
+#include <OpenMS/KERNEL/StandardTypes.h>
+
+#include <OpenMS/KERNEL/MSSpectrum.h>
+#include <OpenMS/KERNEL/MSChromatogram.h>
+
+#include <utility>
+#include <vector>
+
+namespace OpenMS
+{
+
+    /**
+      @brief Removes peaks below an adaptive, per-spectrum noise floor while streaming
+
+      Streaming counterpart of ThresholdMower with an adaptive threshold: for
+      each spectrum the given intensity percentile is determined by one-pass
+      selection (std::nth_element over a reused scratch buffer) and all peaks
+      below percentile * multiplier are dropped before the spectrum is passed
+      to the next consumer. On profile data, where the vast majority of data
+      points sample the baseline, a median-based floor removes most noise
+      points, shrinking the written file and every downstream read.
+
+      Since only one spectrum is held at a time, this consumer can be placed
+      into a file conversion chain (e.g. in front of an MzMLConsumer) to
+      filter experiments far exceeding RAM.
+
+      Peaks inside the configured keep ranges (see addKeepRange()) are always
+      retained regardless of their intensity, e.g. to protect reporter ion
+      regions from being thinned out. Spectra of other MS levels (if a level
+      is selected) and chromatograms are passed through unchanged.
+
+    */
+    class OPENMS_DLLAPI MSDataNoiseFilteringConsumer :
+      public Interfaces::IMSDataConsumer
+    {
+
+      Interfaces::IMSDataConsumer* next_consumer_;
+      double percentile_;
+      double multiplier_;
+      UInt ms_level_;
+      std::vector<std::pair<double, double>> keep_ranges_;
+      std::vector<double> intensities_; ///< scratch buffer for the selection (reused across spectra)
+      std::vector<Size> indices_; ///< scratch buffer for the surviving peak indices (reused across spectra)
+
+    public:
+
+      /**
+        @brief Constructor
+
+        @param next_consumer Consumer the filtered spectra are passed to
+        @param percentile Intensity percentile (in [0, 100]) used as the noise floor estimate
+        @param multiplier Threshold = noise floor * @p multiplier; peaks below it are removed
+        @param ms_level Only spectra of this MS level are filtered; others pass through (0 = filter all levels)
+
+        @note This does not transfer ownership of the consumer
+
+        @throws Exception::IllegalArgument if @p percentile is outside [0, 100]
+      */
+      MSDataNoiseFilteringConsumer(Interfaces::IMSDataConsumer* next_consumer,
+                                   double percentile = 50.0,
+                                   double multiplier = 2.0,
+                                   UInt ms_level = 0);
+
+      /**
+        @brief Adds an m/z range whose peaks are kept regardless of intensity
+
+        @param mz_start Start of the range (inclusive)
+        @param mz_end End of the range (inclusive)
+      */
+      void addKeepRange(double mz_start, double mz_end);
+
+      void setExpectedSize(Size, Size) override {}
+
+      void consumeSpectrum(SpectrumType& s) override;
+
+      void consumeChromatogram(ChromatogramType& c) override;
+
+      void setExperimentalSettings(const OpenMS::ExperimentalSettings&) override {}
+
+    private:
+
+      /// Is @p mz inside one of the keep ranges?
+      bool inKeepRange_(double mz) const;
+
+    };
+
+} //end namespace OpenMS
@@ -0,0 +1,92 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/INTERFACES/IMSDataConsumer.h>
+
+#include <OpenMS/KERNEL/StandardTypes.h>
+
+#include <OpenMS/KERNEL/MSSpectrum.h>
+#include <OpenMS/KERNEL/MSChromatogram.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+
+    /**
+      @brief Corrects precursor m/z values against the survey scan while streaming
+
+      Streaming counterpart of PrecursorCorrection::correctToNearestMS1Peak and
+      PrecursorCorrection::correctToHighestIntensityMS1Peak: only the most recent
+      survey (MS1) scan is held, and the first precursor of every following MS2
+      spectrum is corrected against its peaks before the spectrum is passed on.
+      This way, precursor correction can be done during the initial load of a
+      file (e.g. in front of an MzMLConsumer in a conversion chain) instead of
+      requiring a separate pass over the full in-memory experiment.
+
+      The applied shifts can be retrieved afterwards (see getDeltaMZs()) in the
+      layout expected by PrecursorCorrection::writeHist().
+
+      Spectra of other MS levels and chromatograms are passed through unchanged.
+
+    */
+    class OPENMS_DLLAPI MSDataPrecursorCorrectingConsumer :
+      public Interfaces::IMSDataConsumer
+    {
+
+      Interfaces::IMSDataConsumer* next_consumer_;
+      double mz_tolerance_;
+      bool ppm_;
+      bool highest_intensity_;
+      MSSpectrum last_ms1_; ///< most recent survey scan (shared by all its dependent MS2 scans)
+      std::vector<double> delta_mzs_;
+      std::vector<double> mzs_;
+      std::vector<double> rts_;
+
+    public:
+
+      /**
+        @brief Constructor
+
+        @param next_consumer Consumer the corrected spectra are passed to (pass a nullptr to only correct and collect statistics)
+        @param mz_tolerance Precursor mass tolerance used to find the correcting MS1 peak
+        @param ppm Is @p mz_tolerance given in ppm (true) or Da (false)?
+        @param highest_intensity Correct to the highest intensity peak in the tolerance window (true) or to the nearest peak (false)
+
+        @note This does not transfer ownership of the consumer
+      */
+      MSDataPrecursorCorrectingConsumer(Interfaces::IMSDataConsumer* next_consumer,
+                                        double mz_tolerance,
+                                        bool ppm = true,
+                                        bool highest_intensity = false);
+
+      void setExpectedSize(Size, Size) override {}
+
+      void consumeSpectrum(SpectrumType& s) override;
+
+      void consumeChromatogram(ChromatogramType& c) override;
+
+      void setExperimentalSettings(const OpenMS::ExperimentalSettings&) override {}
+
+      /// Number of precursors corrected so far
+      Size getNumberOfCorrectedPrecursors() const;
+
+      /// Applied m/z shifts (corrected minus uncorrected), one entry per corrected precursor
+      const std::vector<double>& getDeltaMZs() const;
+
+      /// Uncorrected precursor m/z values, one entry per corrected precursor
+      const std::vector<double>& getMZs() const;
+
+      /// Retention times of the corrected MS2 spectra, one entry per corrected precursor
+      const std::vector<double>& getRTs() const;
+
+    };
+
+} //end namespace OpenMS
@@ -168,6 +168,16 @@ namespace OpenMS
       */
       virtual void doCleanup_();
 
+      /**
+        @brief Write all buffered spectra to the output file.
+
+        The buffered spectra are base64-encoded and compressed by worker
+        threads out of order into per-spectrum buffers, which are then emitted
+        in order. Without OpenMP the buffer holds at most one spectrum, so
+        writing happens immediately.
+      */
+      void flushSpectraBuffer_();
+
     protected:
 
       /// File stream (to write mzML)
@@ -190,6 +200,9 @@ namespace OpenMS
       /// Whether to add dataprocessing term to the data before writing
       bool add_dataprocessing_;
 
+      /// Processed spectra waiting to be serialized and written
+      std::vector<SpectrumType> spectra_buffer_;
+
       /// Validator that knows about CV terms
       Internal::MzMLValidator * validator_;
 
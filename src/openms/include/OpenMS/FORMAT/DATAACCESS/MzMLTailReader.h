@@ -0,0 +1,104 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/DATASTRUCTURES/String.h>
+#include <OpenMS/INTERFACES/IMSDataConsumer.h>
+
+#include <ios>
+
+namespace OpenMS
+{
+
+  /**
+    @brief Incremental reader for an mzML file that is still being written ("tail -f" for mzML)
+
+    Allows monitoring a running acquisition: instruments (or converters) append
+    complete &lt;spectrum&gt; elements to the mzML file while it grows, but the
+    index of an indexedmzML file only exists once the run has finished, so
+    neither IndexedMzMLHandler nor a full MzMLFile::load() can be used before
+    that - and re-parsing the whole file on every poll gets slower as the run
+    progresses.
+
+    This class remembers how far into the file it has read. Each call to
+    consumeNewSpectra() picks up at that position, extracts all spectra that
+    have been completely written since the last call and hands them to the
+    given consumer (e.g. for online QC), then remembers the new position.
+    Incompletely written spectra at the end of the file are left for the next
+    call, so polling in a loop (with a short sleep) delivers each spectrum
+    shortly after the instrument finished writing it:
+
+    @code
+    MzMLTailReader tail_reader(filename);
+    MSDataStoringConsumer consumer;
+    while (acquisition_running)
+    {
+      tail_reader.consumeNewSpectra(&consumer);
+      // inspect new spectra, sleep briefly ...
+    }
+    @endcode
+
+    Only spectra are delivered; chromatograms (usually written after the run)
+    and the surrounding metadata are not parsed. The spectra are decoded with
+    MzMLSpectrumDecoder, i.e. the same way IndexedMzMLHandler decodes them.
+  */
+  class OPENMS_DLLAPI MzMLTailReader
+  {
+
+public:
+
+    /**
+      @brief Constructor
+
+      The file does not need to exist yet; it is (re)opened on every call to
+      consumeNewSpectra().
+
+      @param filename The growing mzML file to follow
+    */
+    explicit MzMLTailReader(const String& filename);
+
+    /**
+      @brief Deliver all spectra appended to the file since the last call
+
+      Reads the file from the last remembered position, parses every spectrum
+      that has been completely written and passes it to @p consumer in file
+      order. A spectrum whose closing tag has not been written yet is left in
+      place and delivered by a later call once it is complete.
+
+      @param consumer The consumer to hand the new spectra to (not owned)
+      @return The number of spectra delivered by this call
+
+      @throw Exception::IllegalArgument if @p consumer is null
+      @throw Exception::FileNotFound if the file cannot be opened
+    */
+    Size consumeNewSpectra(Interfaces::IMSDataConsumer* consumer);
+
+    /// Returns the total number of spectra delivered since construction
+    Size getNrSpectraRead() const;
+
+    /// Whether to skip some XML checks (removing whitespace from base64 arrays) and be fast instead
+    void setSkipXMLChecks(bool skip)
+    {
+      skip_xml_checks_ = skip;
+    }
+
+private:
+
+    /// Name of the file
+    String filename_;
+    /// Position in the file up to which the content has been consumed
+    std::streamoff scan_offset_;
+    /// Total number of spectra delivered so far
+    Size n_spectra_read_;
+    /// Whether to skip XML checks
+    bool skip_xml_checks_;
+
+  };
+
+} //end namespace OpenMS
@@ -3,13 +3,21 @@ set(directory include/OpenMS/FORMAT/DATAACCESS)
 
 ### list all header files of the directory here
 set(sources_list_h
+  CompressedMSExperiment.h
+  FeatureXMLWritingConsumer.h
   MSDataAggregatingConsumer.h
+  MSDataAsyncConsumer.h
   MSDataCachedConsumer.h
   MSDataChainingConsumer.h
+  MSDataFAIMSSplittingConsumer.h
   MSDataStoringConsumer.h
+  MSDataMergingConsumer.h
+  MSDataNoiseFilteringConsumer.h
+  MSDataPrecursorCorrectingConsumer.h
   MSDataSqlConsumer.h
   MSDataTransformingConsumer.h
   MSDataWritingConsumer.h
+  MzMLTailReader.h
   NoopMSDataConsumer.h
   SiriusFragmentAnnotation.h
   SwathFileConsumer.h
@@ -27,7 +27,10 @@ namespace OpenMS
   {
     public:
 
-    /// Loads an experimental design from a tabular separated file
+    /// Loads an experimental design from a tabular separated file.
+    /// The parsed and validated design is cached per file (and @p require_spectra_files setting),
+    /// so repeated loads of the same design within one process do not parse or validate again.
+    /// The file is assumed not to change while the process is running.
     static ExperimentalDesign load(const String& tsv_file, bool require_spectra_files);
 
     /// Loads an experimental design from an already loaded or generated, tabular file
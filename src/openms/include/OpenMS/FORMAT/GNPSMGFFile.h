@@ -35,7 +35,7 @@ namespace OpenMS
       static constexpr double DEF_COSINE_SIMILARITY = 0.9;
       static constexpr double DEF_MERGE_BIN_SIZE = static_cast<double>(BinnedSpectrum::DEFAULT_BIN_WIDTH_HIRES);
 
-//      static constexpr double DEF_PREC_MASS_TOL = 0.5;
+      static constexpr double DEF_PREC_MASS_TOL = 0.5;
 //      static constexpr bool DEF_PREC_MASS_TOL_ISPPM = false;
 
       static constexpr int DEF_PEPT_CUTOFF = 5;
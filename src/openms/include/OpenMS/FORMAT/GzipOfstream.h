@@ -0,0 +1,118 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/config.h>
+
+#include <ostream>
+#include <streambuf>
+#include <vector>
+
+#include <zlib.h>
+
+namespace OpenMS
+{
+  namespace Internal
+  {
+    /**
+      @brief Stream buffer which deflates everything written to it into a gzip file
+
+      Used by GzipOfstream; writes are collected in an internal buffer and
+      handed to zlib in large blocks.
+    */
+    class OPENMS_DLLAPI GzipStreamBuf :
+      public std::streambuf
+    {
+public:
+      ///Default constructor
+      GzipStreamBuf();
+
+      ///Destructor; closes the file
+      ~GzipStreamBuf() override;
+
+      ///returns whether a file is open
+      bool isOpen() const;
+
+      /**
+        @brief opens a file for writing (compression)
+
+        @note any previously open file will be closed first!
+      */
+      void open(const char* filename);
+
+      ///flushes pending data and closes the current file
+      void close();
+
+protected:
+      int overflow(int c) override;
+      int sync() override;
+
+private:
+      ///hands the buffered data to zlib; returns false on write errors
+      bool flushBuffer_();
+
+      ///a gzFile object (void*). Necessary for compression
+      gzFile gzfile_ = nullptr;
+      ///buffer collecting writes between deflate calls
+      std::vector<char> buffer_;
+
+      ///not implemented
+      GzipStreamBuf(const GzipStreamBuf&);
+      GzipStreamBuf& operator=(const GzipStreamBuf&);
+    };
+  } // namespace Internal
+
+  /**
+    @brief Compresses written data into a file in the gzip format (*.gz)
+
+    Output counterpart of GzipIfstream. As a std::ostream it can be used
+    wherever an uncompressed std::ofstream would be written to; failures to
+    open or write set the usual stream state bits.
+  */
+  class OPENMS_DLLAPI GzipOfstream :
+    public std::ostream
+  {
+public:
+    ///Default Constructor
+    GzipOfstream();
+
+    /// Detailed constructor with filename
+    explicit GzipOfstream(const char* filename);
+
+    ///Destructor; flushes and closes the file
+    ~GzipOfstream() override;
+
+    ///returns whether a file is open
+    bool isOpen() const;
+
+    /**
+      @brief opens a file for writing (compression)
+
+      @note any previously open file will be closed first!
+    */
+    void open(const char* filename);
+
+    ///flushes pending data and closes the current file
+    void close();
+
+protected:
+    Internal::GzipStreamBuf buf_;
+
+private:
+    ///not implemented
+    GzipOfstream(const GzipOfstream&);
+    GzipOfstream& operator=(const GzipOfstream&);
+  };
+
+  inline bool GzipOfstream::isOpen() const
+  {
+    return buf_.isOpen();
+  }
+
+} //namespace OpenMS
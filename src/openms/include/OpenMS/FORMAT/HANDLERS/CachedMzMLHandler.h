@@ -134,6 +134,25 @@ public:
     */
     static std::vector<OpenSwath::BinaryDataArrayPtr> readSpectrumFast(std::ifstream& ifs, int& ms_level, double& rt);
 
+    /**
+      @brief Fast access to the m/z strip [mz_start, mz_end] of a spectrum
+
+      Since the m/z array is stored sorted and uncompressed, the strip
+      boundaries can be located with a binary search directly on the on-disk
+      data; only the peaks (and the entries of any extra data arrays of
+      matching length) inside the strip are read and decoded. On return, the
+      stream is positioned past the spectrum.
+
+      @param ifs Input file stream (moved to the correct position)
+      @param ms_level Output parameter to store the MS level of the spectrum (1, 2, 3 ...)
+      @param rt Output parameter to store the retention time of the spectrum
+      @param mz_start Lower inclusive bound of the m/z strip to read
+      @param mz_end Upper inclusive bound of the m/z strip to read
+
+      @throws Exception::ParseError is thrown if the spectrum cannot be read
+    */
+    static std::vector<OpenSwath::BinaryDataArrayPtr> readSpectrumFast(std::ifstream& ifs, int& ms_level, double& rt, double mz_start, double mz_end);
+
     /**
       @brief Fast access to a chromatogram
 
@@ -159,6 +178,46 @@ public:
       @throws Exception::ParseError is thrown if the chromatogram size cannot be read
     */
     static std::vector<OpenSwath::BinaryDataArrayPtr> readChromatogramFast(std::ifstream& ifs);
+
+    /**
+      @brief Fast access to a spectrum from a memory-mapped cached file
+
+      Reads the spectrum starting at @p offset from an in-memory buffer
+      (usually a memory mapping of the whole cached file), avoiding the
+      seek/read syscalls of the stream-based overload. On return, @p offset
+      points past the spectrum.
+
+      @param buffer Start of the cached file content
+      @param buffer_size Size of the buffer in bytes
+      @param offset Offset of the spectrum within the buffer (advanced while reading)
+      @param ms_level Output parameter to store the MS level of the spectrum (1, 2, 3 ...)
+      @param rt Output parameter to store the retention time of the spectrum
+
+      @throws Exception::ParseError is thrown if the spectrum cannot be read
+    */
+    static std::vector<OpenSwath::BinaryDataArrayPtr> readSpectrumFast(const char* buffer, Size buffer_size, Size& offset, int& ms_level, double& rt);
+
+    /**
+      @brief Fast access to the m/z strip [mz_start, mz_end] of a spectrum from a memory-mapped cached file
+
+      See the stream-based strip overload for the strip semantics. Touches
+      only the pages holding the header, the binary search probes and the
+      strip itself, which keeps the amount of data paged in proportional to
+      the strip instead of the full spectrum. On return, @p offset points
+      past the spectrum.
+
+      @throws Exception::ParseError is thrown if the spectrum cannot be read
+    */
+    static std::vector<OpenSwath::BinaryDataArrayPtr> readSpectrumFast(const char* buffer, Size buffer_size, Size& offset, int& ms_level, double& rt, double mz_start, double mz_end);
+
+    /**
+      @brief Fast access to a chromatogram from a memory-mapped cached file
+
+      See the spectrum overload for details on the buffer-based access.
+
+      @throws Exception::ParseError is thrown if the chromatogram cannot be read
+    */
+    static std::vector<OpenSwath::BinaryDataArrayPtr> readChromatogramFast(const char* buffer, Size buffer_size, Size& offset);
     //@}
 
     /**
@@ -171,6 +230,18 @@ public:
     */
     static void readSpectrum(SpectrumType& spectrum, std::ifstream& ifs);
 
+    /**
+      @brief Read a single spectrum directly into an OpenMS MSSpectrum from an in-memory buffer
+
+      @param spectrum Output spectrum
+      @param buffer Start of the cached file content
+      @param buffer_size Size of the buffer in bytes
+      @param offset Offset of the spectrum within the buffer (advanced while reading)
+
+      @throws Exception::ParseError is thrown if the spectrum cannot be read
+    */
+    static void readSpectrum(SpectrumType& spectrum, const char* buffer, Size buffer_size, Size& offset);
+
     /**
       @brief Read a single chromatogram directly into an OpenMS MSChromatogram (assuming file is already at the correct position)
 
@@ -181,6 +252,18 @@ public:
     */
     static void readChromatogram(ChromatogramType& chromatogram, std::ifstream& ifs);
 
+    /**
+      @brief Read a single chromatogram directly into an OpenMS MSChromatogram from an in-memory buffer
+
+      @param chromatogram Output chromatogram
+      @param buffer Start of the cached file content
+      @param buffer_size Size of the buffer in bytes
+      @param offset Offset of the chromatogram within the buffer (advanced while reading)
+
+      @throws Exception::ParseError is thrown if the chromatogram cannot be read
+    */
+    static void readChromatogram(ChromatogramType& chromatogram, const char* buffer, Size buffer_size, Size& offset);
+
 protected:
 
     /// write a single spectrum to filestream
@@ -190,9 +273,13 @@ protected:
     void writeChromatogram_(const ChromatogramType& chromatogram, std::ofstream& ofs) const;
 
     /// helper method for fast reading of spectra and chromatograms
-    static inline void readDataFast_(std::ifstream& ifs, std::vector<OpenSwath::BinaryDataArrayPtr>& data, const Size& data_size, 
+    static inline void readDataFast_(std::ifstream& ifs, std::vector<OpenSwath::BinaryDataArrayPtr>& data, const Size& data_size,
       const Size& nr_float_arrays);
 
+    /// helper method for fast reading of spectra and chromatograms from an in-memory buffer
+    static inline void readDataFast_(const char* buffer, Size buffer_size, Size& offset,
+      std::vector<OpenSwath::BinaryDataArrayPtr>& data, const Size& data_size, const Size& nr_float_arrays);
+
     /// Members
     std::vector<std::streampos> spectra_index_;
     std::vector<std::streampos> chrom_index_;
@@ -104,7 +104,7 @@ protected:
     /// Temporary peptide hit
     PeptideHit pep_hit_;
     /// Temporary peptide evidences
-    std::vector<PeptideEvidence> peptide_evidences_;
+    PeptideHit::PeptideEvidences peptide_evidences_;
     /// Map from protein id to accession
     std::map<String, String> proteinid_to_accession_;
     /// Map from search identifier concatenated with protein accession to id
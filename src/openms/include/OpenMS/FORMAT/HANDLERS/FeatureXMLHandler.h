@@ -62,6 +62,23 @@ public:
     /// Docu in base class XMLHandler::writeTo
     void writeTo(std::ostream& os) override;
 
+    /**
+        @brief Writes everything up to (and including) the opening &lt;featureList&gt; tag
+
+        Used for streaming featureXML output, where features are written one
+        at a time (see writeFeature() and FeatureXMLWritingConsumer).
+
+        @param os The stream to write to
+        @param count The number of features which will follow (stored in the featureList count attribute)
+    */
+    void writeHeader(std::ostream& os, Size count);
+
+    /// Writes a single feature (streaming counterpart of the featureList body written by writeTo())
+    void writeFeature(std::ostream& os, const Feature& feature);
+
+    /// Writes the closing &lt;/featureList&gt; and &lt;/featureMap&gt; tags and clears the write caches
+    void writeFooter(std::ostream& os);
+
     /// Mutable access to the options for loading/storing
     FeatureFileOptions& getOptions();
 
@@ -0,0 +1,199 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Mathias Walzer $
+// $Authors: Mathias Walzer $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/FORMAT/HANDLERS/XMLHandler.h>
+#include <OpenMS/FORMAT/ControlledVocabulary.h>
+#include <OpenMS/CHEMISTRY/AASequence.h>
+#include <OpenMS/METADATA/ProteinIdentification.h>
+#include <OpenMS/METADATA/PeptideIdentification.h>
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace OpenMS
+{
+  class ProgressLogger;
+
+  namespace Internal
+  {
+
+    /**
+        @brief Streaming XML handler for reading identifications from MzIdentML files
+
+        Forward-only SAX handler that reads SpectrumIdentificationResults into
+        PeptideIdentification / ProteinIdentification without building a DOM.
+        MzIdentMLDOMHandler materializes the whole document tree before
+        traversing it, which for repository-scale mzid files needs many times
+        the file size in memory; this handler only keeps the identification
+        data itself plus the id lookup tables (peptide sequences, peptide
+        evidences, protein accessions), so memory stays proportional to the
+        results.
+
+        Content that the legacy id structures cannot represent is skipped
+        while parsing instead of being materialized: protein (Seq) sequences,
+        the ProteinDetection section, fragmentation annotations and the
+        detailed search parameters of the identification protocol.
+
+        Supported is the common PSM-centric read path. Cross-linking
+        (OpenPepXL) results are rejected with Exception::NotImplemented and
+        modifications are limited to what ModificationsDB can resolve by name
+        - use MzIdentMLDOMHandler where full fidelity is required.
+
+        The single forward pass relies on the schema-mandated element order
+        (SequenceCollection before AnalysisCollection before DataCollection).
+
+        @note Do not use this class. It is only needed in MzIdentMLFile.
+    */
+    class OPENMS_DLLAPI MzIdentMLStreamHandler :
+      public XMLHandler
+    {
+public:
+      /// Constructor for a read-only handler for internal identification structures
+      MzIdentMLStreamHandler(std::vector<ProteinIdentification>& pro_id, std::vector<PeptideIdentification>& pep_id, const String& filename, const String& version, const ProgressLogger& logger);
+
+      /// Destructor
+      ~MzIdentMLStreamHandler() override;
+
+      // Docu in base class
+      void startElement(const XMLCh* const /*uri*/, const XMLCh* const /*local_name*/, const XMLCh* const qname, const xercesc::Attributes& attributes) override;
+
+      // Docu in base class
+      void endElement(const XMLCh* const /*uri*/, const XMLCh* const /*local_name*/, const XMLCh* const qname) override;
+
+      // Docu in base class
+      void characters(const XMLCh* const chars, const XMLSize_t length) override;
+
+protected:
+      /// Progress logger
+      const ProgressLogger& logger_;
+
+      ///Controlled vocabulary (psi-ms from OpenMS/share/OpenMS/CV/psi-ms.obo)
+      const ControlledVocabulary& cv_;
+
+private:
+      MzIdentMLStreamHandler();
+      MzIdentMLStreamHandler(const MzIdentMLStreamHandler& rhs);
+      MzIdentMLStreamHandler& operator=(const MzIdentMLStreamHandler& rhs);
+
+      /// Raw attributes of one cvParam element
+      struct CVParam
+      {
+        String accession;
+        String name;
+        String cv_ref;
+        String value;
+        String unit_accession;
+        String unit_name;
+        String unit_cv_ref;
+      };
+
+      /// One Modification element of the current Peptide (cvParams applied when the Peptide closes)
+      struct ModificationInfo
+      {
+        Int location = -2;
+        std::vector<CVParam> params;
+      };
+
+      /// One SubstitutionModification element of the current Peptide
+      struct SubstitutionInfo
+      {
+        Int location = -1;
+        char original = '-';
+        char replacement = '-';
+      };
+
+      /// Position information of one PeptideEvidence element
+      struct PeptideEvidenceInfo
+      {
+        String db_sequence_ref;
+        Int start = -1;
+        Int stop = -1;
+        char pre = '-';
+        char post = '-';
+        bool decoy = false;
+      };
+
+      /// Converts the raw attributes to a CVTerm (mirrors the DOM handler)
+      CVTerm makeCVTerm_(const CVParam& param) const;
+
+      /// Builds the AASequence of the Peptide that just closed and stores it in pep_map_
+      void finishPeptide_();
+
+      /// Converts the SpectrumIdentificationItem that just closed into a PeptideHit
+      void finishSpectrumIdentificationItem_();
+
+      /// Applies result-level params to the SpectrumIdentificationResult that just closed and stores it
+      void finishSpectrumIdentificationResult_();
+
+      ///Identification runs
+      std::vector<ProteinIdentification>* pro_id_;
+      ///Spectrum identifications
+      std::vector<PeptideIdentification>* pep_id_;
+
+      ///Score terms from the CV, for score type selection (same sets as the DOM handler)
+      std::set<String> q_score_terms_;
+      std::set<String> e_score_terms_;
+      std::set<String> specific_score_terms_;
+
+      ///DBSequence id to accession (sequences themselves are skipped)
+      std::map<String, String> db_accession_;
+      ///Peptide id to sequence
+      std::map<String, AASequence> pep_map_;
+      ///PeptideEvidence id to position information
+      std::map<String, PeptideEvidenceInfo> pe_ev_map_;
+      ///Peptide id to the ids of its PeptideEvidences
+      std::multimap<String, String> p_pv_map_;
+
+      ///AnalysisSoftware id to (name, version)
+      std::map<String, std::pair<String, String> > as_map_;
+      ///SearchDatabase id to (location, version)
+      std::map<String, std::pair<String, String> > db_map_;
+      ///SpectraData id to location
+      std::map<String, String> sd_map_;
+      ///SpectrumIdentificationList id to index into pro_id_
+      std::map<String, Size> sil_to_run_;
+      ///Pending searchDatabase_ref per run (resolved when Inputs closes)
+      std::map<Size, String> run_db_ref_;
+      ///Pending spectraData_ref per run (resolved when Inputs closes)
+      std::map<Size, String> run_sdata_ref_;
+      ///Pending spectrumIdentificationProtocol_ref per run (resolved when the protocol is parsed)
+      std::map<String, std::vector<Size> > sip_to_runs_;
+
+      ///State of the Peptide currently open
+      String current_peptide_id_;
+      String current_peptide_name_;
+      String current_peptide_seq_;
+      std::vector<ModificationInfo> current_mods_;
+      std::vector<SubstitutionInfo> current_subs_;
+      bool in_peptide_sequence_ = false;
+
+      ///State of the AnalysisSoftware currently open
+      String current_software_id_;
+      String current_software_version_;
+
+      ///State of the SpectrumIdentificationList / -Result / -Item currently open
+      String current_sil_id_;
+      PeptideIdentification current_result_;
+      bool in_result_ = false;
+      std::map<String, std::vector<CVTerm> > result_cv_params_;
+      std::map<String, DataValue> result_user_params_;
+      String current_item_peptide_ref_;
+      Int current_item_rank_ = 0;
+      Int current_item_charge_ = 0;
+      double current_item_exp_mz_ = 0.0;
+      double current_item_calc_mz_ = 0.0;
+      bool current_item_pass_threshold_ = false;
+      bool in_item_ = false;
+      std::map<String, std::vector<CVTerm> > item_cv_params_;
+      std::map<String, DataValue> item_user_params_;
+    };
+  } // namespace Internal
+} // namespace OpenMS
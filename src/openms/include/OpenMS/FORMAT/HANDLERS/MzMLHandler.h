@@ -23,6 +23,7 @@
 #include <OpenMS/FORMAT/ControlledVocabulary.h>
 #include <OpenMS/FORMAT/VALIDATORS/SemanticValidator.h>
 
+#include <future>
 #include <map>
 
 
@@ -193,19 +194,41 @@ protected:
       /**
           @brief Populate all spectra on the stack with data from input
 
-          Will populate all spectra on the current work stack with data (using
-          multiple threads if available) and append them to the result.
+          Hands the current work stack over to a background task which decodes
+          the binary data (using multiple threads if available) while the XML
+          parse thread continues with the next batch. The previously submitted
+          batch is finalized first, so spectra are appended to the result in
+          file order. Call flushDecodedSpectra_() after the last batch.
       */
       void populateSpectraWithData_();
 
       /**
           @brief Populate all chromatograms on the stack with data from input
 
-          Will populate all chromatograms on the current work stack with data (using
-          multiple threads if available) and append them to the result.
+          Hands the current work stack over to a background task which decodes
+          the binary data (using multiple threads if available) while the XML
+          parse thread continues with the next batch. The previously submitted
+          batch is finalized first, so chromatograms are appended to the result
+          in file order. Call flushDecodedChromatograms_() after the last batch.
       */
       void populateChromatogramsWithData_();
 
+      // forward declarations of the work stack entries (defined below)
+      struct SpectrumData;
+      struct ChromatogramData;
+
+      /// Decode the binary data of all spectra in @p batch (executed in a background task)
+      void decodeSpectrumData_(std::vector<SpectrumData>& batch);
+
+      /// Wait for the pending spectrum decoding task (re-throwing its errors) and append the decoded spectra to the experiment / consumer
+      void flushDecodedSpectra_();
+
+      /// Decode the binary data of all chromatograms in @p batch (executed in a background task)
+      void decodeChromatogramData_(std::vector<ChromatogramData>& batch);
+
+      /// Wait for the pending chromatogram decoding task (re-throwing its errors) and append the decoded chromatograms to the experiment / consumer
+      void flushDecodedChromatograms_();
+
       /**
           @brief Add extra data arrays to a spectrum
 
@@ -285,7 +308,14 @@ protected:
                         const Internal::MzMLValidator& validator);
 
 
-      /// Write out a single spectrum
+      /**
+          @brief Write out a single spectrum
+
+          The caller is responsible for recording the spectrum's index offset via
+          addSpectrumOffset_() before emitting the serialized data to the final output.
+          Apart from that, this function does not touch any mutable handler state, so
+          multiple spectra may be serialized into separate buffers concurrently.
+      */
       void writeSpectrum_(std::ostream& os,
                           const SpectrumType& spec,
                           Size spec_idx,
@@ -293,12 +323,18 @@ protected:
                           bool renew_native_ids,
                           std::vector<std::vector< ConstDataProcessingPtr > >& dps);
 
-      /// Write out a single chromatogram
+      /// Write out a single chromatogram (see writeSpectrum_() for the offset/thread-safety contract)
       void writeChromatogram_(std::ostream& os,
                               const ChromatogramType& chromatogram,
                               Size chrom_idx,
                               const Internal::MzMLValidator& validator);
 
+      /// Record the index offset of a \<spectrum\> tag which starts at position @p os_offset of the final output
+      void addSpectrumOffset_(const SpectrumType& spec, Size spec_idx, bool renew_native_ids, Int64 os_offset);
+
+      /// Record the index offset of a \<chromatogram\> tag which starts at position @p os_offset of the final output
+      void addChromatogramOffset_(const ChromatogramType& chromatogram, Int64 os_offset);
+
       template <typename ContainerT>
       void writeContainerData_(std::ostream& os, const PeakFileOptions& pf_options_, const ContainerT& container, const String& array_type);
 
@@ -439,6 +475,12 @@ protected:
       /// Vector of spectrum data stored for later parallel processing
       std::vector<SpectrumData> spectrum_data_;
 
+      /// Batch of spectra currently decoded by the background task (kept separate so parsing can continue)
+      std::vector<SpectrumData> decoding_spectrum_data_;
+
+      /// Pending background task decoding decoding_spectrum_data_
+      std::future<void> spectrum_decode_future_;
+
       /**
           @brief Data necessary to generate a single chromatogram
 
@@ -456,6 +498,12 @@ protected:
       /// Vector of chromatogram data stored for later parallel processing
       std::vector<ChromatogramData> chromatogram_data_;
 
+      /// Batch of chromatograms currently decoded by the background task (kept separate so parsing can continue)
+      std::vector<ChromatogramData> decoding_chromatogram_data_;
+
+      /// Pending background task decoding decoding_chromatogram_data_
+      std::future<void> chromatogram_decode_future_;
+
       //@}
       
       /**@name temporary data structures to hold written data
@@ -90,6 +90,25 @@ namespace OpenMS
         {
         }
 
+        /// Reset to the state of a default-constructed object, but keep the
+        /// memory allocated by the data buffers (for efficient re-use)
+        void clear()
+        {
+          precision = PRE_NONE;
+          data_type = DT_NONE;
+          np_compression = MSNumpressCoder::NONE;
+          compression = false;
+          unit_multiplier = 1.0;
+          base64.clear();
+          size = 0;
+          floats_32.clear();
+          floats_64.clear();
+          ints_32.clear();
+          ints_64.clear();
+          decoded_char.clear();
+          meta = MetaInfoDescription();
+        }
+
         BinaryData(const BinaryData&) = default;               // Copy constructor
         BinaryData(BinaryData&&) = default;                    // Move constructor
         BinaryData& operator=(const BinaryData&) & = default;  // Copy assignment operator
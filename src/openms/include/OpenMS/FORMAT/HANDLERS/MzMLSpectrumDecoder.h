@@ -38,20 +38,32 @@ namespace OpenMS
   */
   class OPENMS_DLLAPI MzMLSpectrumDecoder
   {
+  public:
+
+    typedef Internal::MzMLHandlerHelper::BinaryData BinaryData;
+
   protected:
 
     bool skip_xml_checks_; ///< Whether to skip some XML checks (e.g. removing whitespace inside base64 arrays) and be fast instead
-      
-    typedef Internal::MzMLHandlerHelper::BinaryData BinaryData;
 
     /**
       @brief decode binary data
 
-      @todo Duplicated code from MzMLHandler, need to clean up see MzMLHandler::fillData_() 
+      @todo Duplicated code from MzMLHandler, need to clean up see MzMLHandler::fillData_()
 
     */
     OpenMS::Interfaces::SpectrumPtr decodeBinaryDataSpectrum_(std::vector<BinaryData> & data) const;
 
+    /**
+      @brief decode binary data, recycling the spectrum object
+
+      Variant of decodeBinaryDataSpectrum_() which re-uses the spectrum
+      object passed in @p sptr (and the memory of its data arrays) if the
+      caller holds the only reference to them; otherwise fresh objects are
+      allocated.
+    */
+    void decodeBinaryDataSpectrum_(std::vector<BinaryData>& data, OpenMS::Interfaces::SpectrumPtr& sptr) const;
+
     void decodeBinaryDataMSSpectrum_(std::vector<BinaryData>& data, OpenMS::MSSpectrum& s) const;
 
     void decodeBinaryDataMSChrom_(std::vector<BinaryData>& data, OpenMS::MSChromatogram& c) const;
@@ -67,12 +79,13 @@ namespace OpenMS
     /**
       @brief Convert a single DOMNode of type binaryDataArray to BinaryData object.
 
-      This function will extract the data from a xerces DOMNode which points to
-      a binaryDataArray tag and store the result as a BinaryData object. The
-      result will be appended to the data vector.
+      This function will extract the data from a xerces DOMNode which points
+      to a binaryDataArray tag and store the result in the last element of
+      the data vector, which the caller needs to have appended (this allows
+      callers to recycle BinaryData objects from a previous parse).
 
       @param indexListNode DOMNode of type binaryDataArray
-      @param data Binary data extracted from the string
+      @param data Binary data extracted from the string (result in data.back())
     */
     void handleBinaryDataArray_(xercesc::DOMNode* indexListNode, std::vector<BinaryData>& data);
 
@@ -129,6 +142,42 @@ namespace OpenMS
     */
     void domParseSpectrum(const std::string& in, MSSpectrum& s);
 
+    /**
+      @brief Extract data from a string which contains a full mzML spectrum, re-using buffers.
+
+      Variant of domParseSpectrum() for streaming consumers which decode many
+      spectra in a row: @p binary_data is used as scratch space for the
+      base64-decoded data arrays and keeps its buffer memory between calls.
+      Likewise, if the caller holds the only reference to @p sptr (e.g. the
+      already processed spectrum of the previous iteration), the object and
+      its data arrays are re-used instead of re-allocated. Steady-state
+      decoding of similarly sized spectra then allocates nothing.
+
+      @param in Input string containing the raw XML
+      @param sptr Resulting spectrum; may hold a re-usable previous spectrum
+      @param binary_data Caller-owned scratch buffer for the decoded data arrays
+
+      @pre in must have \<spectrum\> as root element.
+
+    */
+    void domParseSpectrum(const std::string& in, OpenMS::Interfaces::SpectrumPtr& sptr, std::vector<BinaryData>& binary_data);
+
+    /**
+      @brief Extract data from a string which contains a full mzML spectrum, re-using buffers.
+
+      Variant of domParseSpectrum() for streaming consumers: @p binary_data
+      is used as scratch space for the base64-decoded data arrays and keeps
+      its buffer memory between calls (see above).
+
+      @param in Input string containing the raw XML
+      @param s Resulting spectrum
+      @param binary_data Caller-owned scratch buffer for the decoded data arrays
+
+      @pre in must have \<spectrum\> as root element.
+
+    */
+    void domParseSpectrum(const std::string& in, MSSpectrum& s, std::vector<BinaryData>& binary_data);
+
     /**
       @brief Extract data from a string which contains a full mzML chromatogram.
 
@@ -292,6 +292,18 @@ public:
       */
       static void appendASCII(const XMLCh * str, const XMLSize_t length, String & result);
 
+      /**
+       * @brief Converts the supplied XMLCh* (expected to hold a number) directly to a double
+       *
+       * Narrows the characters into a stack buffer and parses them in place,
+       * avoiding the two heap allocations of the XMLCh* -> String -> double
+       * route. Content that is not a plain ASCII number falls back to the
+       * String-based conversion (including its error reporting).
+       *
+       * @throws Exception::ConversionError if the content cannot be parsed as a double
+      */
+      static double toDouble(const XMLCh* str);
+
     };
 
     /**
@@ -660,7 +672,7 @@ protected:
       {
         const XMLCh * val = a.getValue(sm_.convertPtr(name).get());
         if (val == nullptr) fatalError(LOAD, String("Required attribute '") + name + "' not present!");
-        return String(sm_.convert(val)).toDouble();
+        return sm_.toDouble(val);
       }
 
       /// Converts an attribute to a DoubleList
@@ -751,7 +763,7 @@ protected:
         const XMLCh * val = a.getValue(sm_.convertPtr(name).get());
         if (val != nullptr)
         {
-          value = String(sm_.convert(val)).toDouble();
+          value = sm_.toDouble(val);
           return true;
         }
         return false;
@@ -826,7 +838,7 @@ protected:
       {
         const XMLCh * val = a.getValue(name);
         if (val == nullptr) fatalError(LOAD, String("Required attribute '") + sm_.convert(name) + "' not present!");
-        return sm_.convert(val).toDouble();
+        return sm_.toDouble(val);
       }
 
       /// Converts an attribute to a DoubleList
@@ -901,7 +913,7 @@ protected:
         const XMLCh * val = a.getValue(name);
         if (val != nullptr)
         {
-          value = sm_.convert(val).toDouble();
+          value = sm_.toDouble(val);
           return true;
         }
         return false;
@@ -105,13 +105,13 @@ protected:
       * Helper function to create the XML string for the amino acids before and after the peptide position in a protein.
       * Can be reused by e.g. ConsensusXML, FeatureXML to write PeptideHit elements  
       */
-    static std::ostream& createFlankingAAXMLString_(const std::vector<PeptideEvidence> & pes, std::ostream& os);
+    static std::ostream& createFlankingAAXMLString_(const PeptideHit::PeptideEvidences & pes, std::ostream& os);
 
     /**
       * Helper function to create the XML string for the position of the peptide in a protein.
       * Can be reused by e.g. ConsensusXML, FeatureXML to write PeptideHit elements  
       */
-    static std::ostream& createPositionXMLString_(const std::vector<PeptideEvidence> & pes, std::ostream& os);
+    static std::ostream& createPositionXMLString_(const PeptideHit::PeptideEvidences & pes, std::ostream& os);
 
 
     /**
@@ -151,7 +151,7 @@ protected:
     /// Temporary analysis result instance
     PeptideHit::PepXMLAnalysisResult current_analysis_result_;
     /// Temporary peptide evidences
-    std::vector<PeptideEvidence> peptide_evidences_;
+    PeptideHit::PeptideEvidences peptide_evidences_;
     /// Map from protein id to accession
     std::unordered_map<std::string, String> proteinid_to_accession_;
     /// Document identifier
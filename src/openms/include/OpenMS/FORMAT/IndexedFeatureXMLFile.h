@@ -0,0 +1,136 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/CONCEPT/Types.h>
+#include <OpenMS/DATASTRUCTURES/String.h>
+#include <OpenMS/KERNEL/FeatureMap.h>
+
+#include <fstream>
+#include <vector>
+
+namespace OpenMS
+{
+
+  /**
+    @brief Indexed access to the features of a featureXML or consensusXML file
+
+    Counterpart of Internal::IndexedMzMLHandler for feature data: instead of
+    materializing the full feature map (including convex hulls, subordinate
+    features, meta values and identifications), the file is scanned once and
+    only the byte offset plus the centroid (RT, m/z, intensity, charge,
+    quality) of each top-level @p &lt;feature&gt; (or @p &lt;consensusElement&gt;)
+    is recorded. Afterwards, features can be retrieved selectively, e.g. all
+    centroids in an RT/m/z window, without parsing their subelements -- which
+    is all that cross-experiment QC queries over many files usually need.
+
+    Since featureXML carries no index footer, the index is built by a single
+    raw text scan over the file (the writer's element layout is fixed), not by
+    a full XML parse. For callers which do need the complete record of a
+    single feature, getElementXML() returns the element's raw bytes.
+
+    @note Only the centroid data is available through this class; use
+    FeatureXMLFile / ConsensusXMLFile to load complete maps.
+
+    @ingroup FileIO
+  */
+  class OPENMS_DLLAPI IndexedFeatureXMLFile
+  {
+public:
+
+    /// Index entry of one top-level feature / consensus element
+    struct ElementIndexEntry
+    {
+      std::streampos offset{}; ///< byte offset of the opening tag
+      Size length = 0;         ///< element length in bytes (including the closing tag)
+      double rt = 0.0;         ///< centroid retention time
+      double mz = 0.0;         ///< centroid m/z
+      float intensity = 0.0f;  ///< centroid intensity
+      Int charge = 0;          ///< charge state
+      double quality = 0.0;    ///< overall quality
+      String id;               ///< the element's 'id' attribute (e.g. 'f_...' or 'e_...')
+    };
+
+    /// Default constructor; call openFile() before use
+    IndexedFeatureXMLFile();
+
+    /// Constructs and calls openFile()
+    explicit IndexedFeatureXMLFile(const String& filename);
+
+    /// Destructor
+    ~IndexedFeatureXMLFile();
+
+    /**
+      @brief Scans @p filename and builds the feature index
+
+      The file type (featureXML or consensusXML) is detected from the root
+      element. Features nested inside @p &lt;subordinate&gt; elements are part of
+      their parent's byte range and are not indexed separately.
+
+      @exception Exception::FileNotFound is thrown if the file could not be opened
+      @exception Exception::ParseError is thrown if the file is neither featureXML
+                 nor consensusXML or its element tags are not properly nested
+    */
+    void openFile(const String& filename);
+
+    /// Whether openFile() succeeded on the current file
+    bool getParsingSuccess() const;
+
+    /// Number of indexed top-level features / consensus elements
+    Size size() const;
+
+    /// Read access to the full index (sorted by file position)
+    const std::vector<ElementIndexEntry>& getIndex() const;
+
+    /**
+      @brief Fills @p feature with the centroid data of element @p index
+
+      Only position, intensity, charge, overall quality and the unique id are
+      set; convex hulls, subordinates and meta values are not parsed. For
+      consensusXML files the consensus centroid is returned.
+
+      @exception Exception::IndexOverflow is thrown for an invalid index
+    */
+    void getFeature(Size index, Feature& feature) const;
+
+    /**
+      @brief Appends the centroids of all elements with RT in [@p min_rt, @p max_rt]
+             and m/z in [@p min_mz, @p max_mz] to @p out
+
+      Features are filled as in getFeature(); nothing is read from disk.
+
+      @return the number of features appended
+    */
+    Size getFeaturesInRange(double min_rt, double max_rt, double min_mz, double max_mz, FeatureMap& out) const;
+
+    /**
+      @brief Returns the raw XML of element @p index (for full parsing by the caller)
+
+      @exception Exception::IndexOverflow is thrown for an invalid index
+    */
+    String getElementXML(Size index);
+
+private:
+
+    /// Scans the file and fills index_; sets parsing_success_
+    void parseIndex_();
+
+    /// Name of the file
+    String filename_;
+    /// The current filestream (opened by openFile), used by getElementXML()
+    std::ifstream filestream_;
+    /// Offsets and centroids of all top-level elements
+    std::vector<ElementIndexEntry> index_;
+    /// Whether the file is a consensusXML (else featureXML)
+    bool consensus_ = false;
+    /// Whether building the index was successful
+    bool parsing_success_ = false;
+  };
+
+} // namespace OpenMS
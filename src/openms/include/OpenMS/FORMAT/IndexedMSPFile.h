@@ -0,0 +1,132 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Douglas McCloskey, Pasquale Domenico Colaianni $
+// $Authors: Douglas McCloskey, Pasquale Domenico Colaianni $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/config.h> // OPENMS_DLLAPI
+#include <OpenMS/DATASTRUCTURES/String.h>
+#include <OpenMS/FORMAT/MSPGenericFile.h>
+#include <OpenMS/KERNEL/MSSpectrum.h>
+
+#include <fstream>
+#include <utility>
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Indexed access to an MSP spectral library without loading it into memory
+
+    While MSPGenericFile loads a whole library into an MSExperiment, this
+    class only scans the file once when it is opened and records the byte
+    offset of every entry (an entry starts at its "Name:" line) together with
+    its precursor m/z, if present. Spectra are then parsed lazily, one entry
+    at a time, when they are requested — either by index or through the
+    precursor m/z lookup table, which is kept sorted for binary search. This
+    allows library search against spectral libraries larger than the
+    available RAM.
+
+    The entries themselves are parsed with MSPGenericFile, so the supported
+    entry format (and the produced meta values) are identical to load()ing
+    the library; see MSPGenericFile for the format description.
+
+    @note Entries without a PRECURSORMZ field (e.g. GC-EI libraries) can be
+    accessed by index, but do not take part in the precursor m/z lookup.
+  */
+  class OPENMS_DLLAPI IndexedMSPFile
+  {
+public:
+    /// Default constructor
+    IndexedMSPFile();
+
+    /// Constructor that immediately indexes the given file
+    explicit IndexedMSPFile(const String& filename);
+
+    /// Destructor
+    ~IndexedMSPFile();
+
+    /**
+      @brief Open an MSP file and build the entry index.
+
+      Scans the file once, recording the byte offset of each entry and its
+      precursor m/z (if present). No spectra are parsed during the scan.
+
+      @param[in] filename Path to the MSP input file
+
+      @throw FileNotFound If the file could not be found
+    */
+    void openFile(const String& filename);
+
+    /// Whether a file has been opened and indexed successfully
+    bool isOpen() const;
+
+    /// Number of indexed entries
+    Size getNrSpectra() const;
+
+    /**
+      @brief Parse and return a single library entry.
+
+      Seeks to the indexed byte offset of the entry and parses only its
+      lines; the rest of the file is not touched.
+
+      @param[in] index The entry index (in file order)
+
+      @throw IndexOverflow If @p index is out of range
+      @throw MissingInformation If the entry misses the Name or Num Peaks information
+      @throw ParseError If the number of points parsed does not match `Num Peaks`
+
+      @return The parsed spectrum
+    */
+    MSSpectrum getSpectrum(Size index);
+
+    /**
+      @brief Find the entries whose precursor m/z lies within a tolerance window.
+
+      Performs a binary search on the precursor m/z lookup table built
+      during openFile(). The returned indices can be passed to getSpectrum()
+      to parse the matching entries lazily.
+
+      @param[in] mz The query precursor mass-to-charge ratio
+      @param[in] tolerance The allowed deviation (in Th, or in ppm of @p mz if @p ppm is true)
+      @param[in] ppm Whether @p tolerance is given in ppm
+
+      @return The indices of the matching entries, in ascending precursor m/z order
+    */
+    std::vector<Size> getSpectraByPrecursorMZ(const double mz, const double tolerance, const bool ppm = false) const;
+
+    /**
+      @brief The precursor m/z recorded for an entry during indexing.
+
+      @param[in] index The entry index (in file order)
+
+      @throw IndexOverflow If @p index is out of range
+
+      @return The entry's precursor m/z, or NaN if the entry has no PRECURSORMZ field
+    */
+    double getPrecursorMZ(Size index) const;
+
+private:
+    /// The indexed file
+    String filename_;
+
+    /// The opened stream, kept open between getSpectrum() calls
+    std::ifstream ifs_;
+
+    /// Byte offset of the first line of each entry, plus the end-of-file offset as sentinel
+    std::vector<std::streamoff> offsets_;
+
+    /// Per-entry precursor m/z (NaN if the entry has none)
+    std::vector<double> precursor_mzs_;
+
+    /// (precursor m/z, entry index) pairs, sorted by m/z, for binary search
+    std::vector<std::pair<double, Size>> mz_index_;
+
+    /// Parser for single entries
+    MSPGenericFile msp_;
+  };
+}
@@ -13,6 +13,8 @@
 #include <OpenMS/DATASTRUCTURES/String.h>
 #include <OpenMS/KERNEL/MSExperiment.h>
 
+#include <iosfwd>
+
 namespace OpenMS
 {
   /**
@@ -67,6 +69,18 @@ public:
     */
     void load(const String& filename, MSExperiment& library);
 
+    /**
+      @brief Parse MSP formatted data from an input stream, and save it into an `MSExperiment`.
+
+      Same as load(), but reads from an already opened stream. Used by
+      IndexedMSPFile to parse single library entries without loading the
+      whole file.
+
+      @param[in] is The stream with the MSP formatted data
+      @param[out] library The variable into which the extracted information will be saved
+    */
+    void load(std::istream& is, MSExperiment& library);
+
     /**
       @brief Save data and metadata into a file.
 
@@ -10,9 +10,9 @@
 
 #include <OpenMS/METADATA/ExperimentalDesign.h>
 #include <OpenMS/KERNEL/ConsensusMap.h>
-#include <OpenMS/FORMAT/TextFile.h>
 
 #include <map>
+#include <ostream>
 #include <utility>
 #include <unordered_map>
 #include <set>
@@ -260,13 +260,14 @@ namespace OpenMS
       };
 
       /*
-        *  @brief Constructs the lines and adds them to the TextFile
+        *  @brief Constructs the lines and streams them to the output file (row by row, instead of
+        *  assembling the full table in memory first)
         *  @param peptideseq_quantifyable Has to be a set (only) for deterministic  ordered output
         */
       template <class LineType>
       void constructFile_(const String& retention_time_summarization_method,
                           const bool rt_summarization_manual,
-                          TextFile& csv_out,
+                          std::ostream& csv_out,
                           const std::set<String>& peptideseq_quantifyable,
                           LineType & peptideseq_to_prefix_to_intensities) const;
 
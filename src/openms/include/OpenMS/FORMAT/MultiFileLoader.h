@@ -0,0 +1,97 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/CONCEPT/ProgressLogger.h>
+#include <OpenMS/DATASTRUCTURES/ListUtils.h>
+#include <OpenMS/KERNEL/StandardTypes.h>
+
+#include <functional>
+
+namespace OpenMS
+{
+
+  /**
+    @brief Loads multiple MS data files concurrently with bounded memory
+
+    Parses up to a configurable number of files at the same time in background
+    threads, but hands the loaded experiments to the caller strictly in input
+    order on the calling thread. Memory is bounded: at most
+    getMaxFilesInFlight() experiments are loaded-but-unconsumed at any time.
+
+    Used by FileMerger to overlap parsing of fraction files; usable anywhere
+    several experiments need to be loaded and processed in order:
+
+    @code
+    MultiFileLoader loader;
+    loader.setLogType(log_type);
+    loader.load(filenames, [&](Size i, PeakMap& exp)
+    {
+      // called in input order, on this thread
+    });
+    @endcode
+
+    Per-file progress is reported through ProgressLogger (one step per
+    consumed file); the per-file parsers run silently.
+  */
+  class OPENMS_DLLAPI MultiFileLoader :
+    public ProgressLogger
+  {
+public:
+
+    /// Constructor
+    MultiFileLoader() = default;
+
+    /// Maximal number of files parsed or held in memory at the same time
+    Size getMaxFilesInFlight() const;
+
+    /// Sets the maximal number of files parsed or held in memory at the same time (minimum 1).
+    /// This bounds both the parser thread count and the memory held in unconsumed experiments.
+    void setMaxFilesInFlight(Size max_in_flight);
+
+    /**
+      @brief Loads all @p filenames concurrently and consumes them in input order
+
+      @p consume is called once per file with the file's index and the loaded
+      experiment (which may be modified or moved from), on the calling thread,
+      in the order of @p filenames. File types are determined per file as in
+      FileHandler::loadExperiment().
+
+      If loading one of the files throws, the exception is rethrown on the
+      calling thread after the preceding files have been consumed; files
+      already being parsed in the background are finished and discarded.
+
+      @param filenames The files to load
+      @param consume Callback invoked per loaded file, in input order
+      @param rewrite_source_file Passed to FileHandler::loadExperiment()
+      @param compute_hash Passed to FileHandler::loadExperiment()
+
+      @exception Exception::FileNotFound is thrown if a file could not be opened
+      @exception Exception::ParseError is thrown if an error occurs during parsing
+    */
+    void load(const StringList& filenames,
+              const std::function<void(Size, PeakMap&)>& consume,
+              bool rewrite_source_file = false,
+              bool compute_hash = false);
+
+    /**
+      @brief Convenience overload: concatenates all files into @p out
+
+      Spectra and chromatograms are appended in input order; the experimental
+      settings of the first file are copied to @p out, source files of the
+      remaining files are appended.
+    */
+    void load(const StringList& filenames, PeakMap& out);
+
+private:
+
+    Size max_in_flight_ = 4;
+  };
+
+} // namespace OpenMS
@@ -56,6 +56,26 @@ public:
     */
     void load(const String& filename, std::vector<ProteinIdentification>& poid, std::vector<PeptideIdentification>& peid);
 
+    /**
+        @brief Loads the identifications from a MzIdentML file with a forward-only streaming parser.
+
+        Unlike load(), which builds a full Xerces DOM of the document before
+        traversing it, this method parses the file in a single SAX pass and
+        never materializes the DOM, so memory stays proportional to the
+        identification data itself. Protein (Seq) sequences, the
+        ProteinDetection section and the detailed search parameters of the
+        identification protocol are skipped while parsing. This makes reading
+        repository-scale mzid files feasible on standard machines.
+
+        Use load() where full fidelity is required; in particular,
+        cross-linking (OpenPepXL) results are not supported here.
+
+        @exception Exception::FileNotFound is thrown if the file could not be opened
+        @exception Exception::ParseError is thrown if an error occurs during parsing
+        @exception Exception::NotImplemented is thrown for cross-linking search results
+    */
+    void loadStreamed(const String& filename, std::vector<ProteinIdentification>& poid, std::vector<PeptideIdentification>& peid);
+
     /**
         @brief Stores the identifications in a MzIdentML file.
 
@@ -14,7 +14,7 @@
 #include <OpenMS/KERNEL/FeatureMap.h>
 #include <OpenMS/KERNEL/ConsensusMap.h>
 #include <OpenMS/CHEMISTRY/AASequence.h>
-#include <OpenMS/METADATA/PeptideEvidence.h>
+#include <OpenMS/METADATA/PeptideHit.h>
 
 #include <optional>
 
@@ -281,7 +281,7 @@ public:
       @param peptide_evidences Vector of PeptideEvidence holding internal data.
     */
 
-    void addPepEvidenceToRows(const std::vector<PeptideEvidence>& peptide_evidences);
+    void addPepEvidenceToRows(const PeptideHit::PeptideEvidences& peptide_evidences);
     /// Comparison operator for sorting rows
     struct RowCompare
     {
@@ -39,7 +39,7 @@ namespace OpenMS
     // store MzTab file
     void store(const String& filename, const MzTab& mz_tab) const;
 
-    // stream IDs to file
+    // stream IDs to file (a '.gz' suffix on the filename enables gzip compression of the output)
     void store(
           const String& filename,
           const std::vector<ProteinIdentification>& protein_identifications,
@@ -49,7 +49,7 @@ namespace OpenMS
           bool export_all_psms = false,
           const String& title = "ID export from OpenMS");
 
-    // stream ConsensusMap to file
+    // stream ConsensusMap to file (a '.gz' suffix on the filename enables gzip compression of the output)
     void store(
       const String& filename, 
       const ConsensusMap& cmap,
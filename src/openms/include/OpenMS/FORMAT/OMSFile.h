@@ -31,6 +31,24 @@ namespace OpenMS
       setLogType(log_type);
     }
 
+    /** @brief Enable/disable bulk-ingestion mode for store()
+     *
+     * If enabled, the database is configured for maximal write throughput:
+     * foreign key checks are skipped while writing and locks, pages and
+     * temporary structures are kept in memory. The stored file is identical
+     * to one written with the default settings.
+     */
+    void setFastStore(bool fast_store)
+    {
+      fast_store_ = fast_store;
+    }
+
+    /// Whether bulk-ingestion mode is enabled for store()
+    bool getFastStore() const
+    {
+      return fast_store_;
+    }
+
     /** @brief Write out an IdentificationData object to SQL-based OMS file
      *
      * @param filename The output file
@@ -82,5 +100,6 @@ namespace OpenMS
 
   protected:
     LogType log_type_;
+    bool fast_store_ = false;
   };
 } // namespace OpenMS
@@ -69,10 +69,14 @@ namespace OpenMS
 
         @param filename Path to the .oms output file (SQLite database)
         @param log_type Type of logging to use
+        @param fast_store If true, configure the database for bulk ingestion: foreign key
+               enforcement is skipped during writing and locks, pages and temporary
+               structures are kept in memory. The resulting file is identical; only the
+               per-insert consistency checks are traded for write throughput.
 
         @throw Exception::FailedAPICall Database cannot be opened
       */
-      OMSFileStore(const String& filename, LogType log_type);
+      OMSFileStore(const String& filename, LogType log_type, bool fast_store = false);
 
       /*!
         @brief Destructor
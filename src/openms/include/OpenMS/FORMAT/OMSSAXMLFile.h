@@ -95,7 +95,7 @@ private:
 
     PeptideEvidence actual_peptide_evidence_;
 
-    std::vector<PeptideEvidence> actual_peptide_evidences_;
+    PeptideHit::PeptideEvidences actual_peptide_evidences_;
 
     PeptideIdentification actual_peptide_id_;
 
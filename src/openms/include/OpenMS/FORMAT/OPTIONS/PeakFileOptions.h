@@ -118,6 +118,24 @@ public:
     void setCompression(bool compress);
     /// returns @c true, if data should be compressed when writing
     bool getCompression() const;
+
+    /**
+        @brief [mzML only!] Set how many significand (mantissa) bits to keep for intensity values when writing (-1 = lossless)
+
+        This is a lossy option: the intensity significands are rounded to the
+        given number of bits before encoding, which makes the resulting zlib
+        compression (see setCompression()) considerably more effective while
+        producing standard-conformant 32/64-bit float arrays. Keeping 7 bits
+        retains roughly two decimal digits (comparable to a bfloat16
+        truncation), 10 bits roughly three (comparable to a half-precision
+        float) - usually well below the measurement error of the instrument.
+
+        The option only applies to intensity arrays and is ignored when
+        numpress compression (which is lossy itself) is configured for them.
+    */
+    void setIntensityMantissaBits(Int bits);
+    /// returns the number of significand bits kept for intensity values when writing (-1 = lossless)
+    Int getIntensityMantissaBits() const;
     //@}
 
     ///@name lazyload option
@@ -203,6 +221,16 @@ public:
     /// [mzML only!] Set whether to use the "selected ion m/z" value as the precursor m/z value (alternative: use the "isolation window target m/z" value)
     void setPrecursorMZSelectedIon(bool choice);
 
+    /// [mzML only!] Whether to skip meta data of spectra while loading (see setPeaksOnly())
+    bool getPeaksOnly() const;
+
+    /// [mzML only!] Set whether to skip meta data of spectra while loading.
+    /// Only the peak data, retention time, MS level, spectrum representation (centroid/profile)
+    /// and precursor information are retained; all other cvParams and userParams of spectra
+    /// are not materialized, which saves a substantial part of the load time of large files.
+    /// File-level meta data and chromatograms are not affected.
+    void setPeaksOnly(bool peaks_only);
+
     /// do these options skip spectra or chromatograms due to RT or MSLevel filters?
     bool hasFilters() const;
 
@@ -221,6 +249,7 @@ private:
     DRange<1> intensity_range_;
     std::vector<Int> ms_levels_;
     bool zlib_compression_;
+    Int int_mantissa_bits_;
     bool always_append_data_;
     bool skip_xml_checks_;
     bool sort_spectra_by_mz_;
@@ -232,6 +261,7 @@ private:
     MSNumpressCoder::NumpressConfig np_config_fda_;
     Size maximal_data_pool_size_;
     bool precursor_mz_selected_ion_;
+    bool peaks_only_;
   };
 
 } // namespace OpenMS
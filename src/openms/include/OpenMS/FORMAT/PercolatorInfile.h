@@ -9,8 +9,9 @@
 #pragma once
 
 #include <OpenMS/METADATA/PeptideIdentification.h>
-#include <OpenMS/FORMAT/TextFile.h>
+#include <OpenMS/DATASTRUCTURES/ListUtils.h>
 
+#include <iosfwd>
 #include <vector>
 
 namespace OpenMS
@@ -23,11 +24,22 @@ namespace OpenMS
   class OPENMS_DLLAPI PercolatorInfile
   {
     public:
-      static void store(const String& pin_file, 
-        const std::vector<PeptideIdentification>& peptide_ids, 
-        const StringList& feature_set, 
-        const std::string& enz, 
-        int min_charge, 
+      static void store(const String& pin_file,
+        const std::vector<PeptideIdentification>& peptide_ids,
+        const StringList& feature_set,
+        const std::string& enz,
+        int min_charge,
+        int max_charge);
+
+      /** @brief stream the pin content to @p os instead of a file.
+          Rows are written as they are generated, without buffering the whole table in memory.
+          This allows feeding percolator through a pipe without the temporary file round-trip.
+          **/
+      static void store(std::ostream& os,
+        const std::vector<PeptideIdentification>& peptide_ids,
+        const StringList& feature_set,
+        const std::string& enz,
+        int min_charge,
         int max_charge);
 
       /** @brief load pin file and convert to a vector of PeptideIdentification using the given score column @p score_name and orientation @p higher_score_better.
@@ -50,12 +62,13 @@ namespace OpenMS
     protected:
 
       //id <tab> label <tab> scannr <tab> calcmass <tab> expmass <tab> feature1 <tab> ... <tab> featureN <tab> peptide <tab> proteinId1 <tab> .. <tab> proteinIdM
-      static TextFile preparePin_(
-        const std::vector<PeptideIdentification>& peptide_ids, 
-        const StringList& feature_set, 
-        const std::string& enz, 
-        int min_charge, 
-        int max_charge);
+      static void preparePin_(
+        const std::vector<PeptideIdentification>& peptide_ids,
+        const StringList& feature_set,
+        const std::string& enz,
+        int min_charge,
+        int max_charge,
+        std::ostream& os);
 
       static bool isEnz_(const char& n, const char& c, const std::string& enz);
 
@@ -42,10 +42,13 @@ GNPSMetaValueFile.h
 GNPSMGFFile.h
 GNPSQuantificationFile.h
 GzipIfstream.h
+GzipOfstream.h
 GzipInputStream.h
 IBSpectraFile.h
 IdXMLFile.h
 IndentedStream.h
+IndexedFeatureXMLFile.h
+IndexedMSPFile.h
 IndexedMzMLFileLoader.h
 InspectInfile.h
 InspectOutfile.h
@@ -62,6 +65,7 @@ MascotGenericFile.h
 MascotRemoteQuery.h
 MascotXMLFile.h
 MsInspectFile.h
+MultiFileLoader.h
 MzDataFile.h
 MzMLFile.h
 MzQCFile.h
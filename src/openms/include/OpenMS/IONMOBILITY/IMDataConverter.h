@@ -19,6 +19,7 @@ namespace OpenMS
     {
       class FloatDataArray;
     }
+    class Mobilogram;
     enum class DriftTimeUnit;
 
     /**
@@ -74,6 +75,62 @@ namespace OpenMS
       */
       static MSExperiment splitByIonMobility(MSExperiment&& in, UInt number_of_bins = -1);
 
+      /**
+        @brief Aggregate a (TimsTOF) ion mobility frame into a binned mobilogram on a fixed IM grid
+
+        The intensities of all peaks of @p im_frame are summed into @p number_of_bins equally sized
+        bins covering [@p mb_start, @p mb_end] in a single pass over the data (scatter-add); peaks
+        outside the grid are added to the first/last bin. This is much cheaper than materializing
+        one spectrum per IM value via splitByIonMobility() when only the mobility distribution is
+        needed. The resulting mobilogram has one peak per bin (at the bin center) and inherits RT
+        and IM unit from the frame.
+
+        @param im_frame Concatenated spectrum representing a frame
+        @param mb_start Lower end of the IM grid
+        @param mb_end Upper end of the IM grid
+        @param number_of_bins Number of equally sized bins between @p mb_start and @p mb_end
+        @return Binned mobilogram of the frame
+
+        @throws Exception::MissingInformation if @p im_frame does not have IM data in floatDataArrays
+        @throws Exception::IllegalArgument if @p number_of_bins is zero or the grid range is empty
+      */
+      static Mobilogram aggregateToMobilogram(const MSSpectrum& im_frame, double mb_start, double mb_end, Size number_of_bins);
+
+      /**
+        @brief Aggregate all (TimsTOF) ion mobility frames of an experiment into binned mobilograms (parallel across frames)
+
+        Frame-batched version of aggregateToMobilogram(): all frames are binned onto the same
+        IM grid, so the results can be compared or summed directly. Frames are processed in
+        parallel (OpenMP). Spectra without IM data yield an empty mobilogram (with the RT of
+        the spectrum), keeping the output index-aligned with @p exp.
+
+        @param exp The PeakMap containing IM-frame spectra
+        @param mb_start Lower end of the IM grid
+        @param mb_end Upper end of the IM grid
+        @param number_of_bins Number of equally sized bins between @p mb_start and @p mb_end
+        @return One mobilogram per input spectrum
+
+        @throws Exception::IllegalArgument if @p number_of_bins is zero or the grid range is empty
+      */
+      static std::vector<Mobilogram> aggregateToMobilograms(const MSExperiment& exp, double mb_start, double mb_end, Size number_of_bins);
+
+      /**
+        @brief Extract the peaks of a (TimsTOF) ion mobility frame which lie in an IM window
+
+        The IM column of @p im_frame is resolved once (see MSSpectrum::getIMData()) and the peaks
+        with IM values in [@p im_start, @p im_end] are selected in a single pass together with all
+        data arrays (see MSSpectrum::selectByFloatDataArray()) -- no per-peak name lookups.
+        The IM float data array is retained in the result (subset to the selected peaks).
+
+        @param im_frame Concatenated spectrum representing a frame
+        @param im_start Lower end of the IM window (inclusive)
+        @param im_end Upper end of the IM window (inclusive)
+        @return Copy of @p im_frame containing only the peaks within the IM window
+
+        @throws Exception::MissingInformation if @p im_frame does not have IM data in floatDataArrays
+      */
+      static MSSpectrum extractIMRange(const MSSpectrum& im_frame, double im_start, double im_end);
+
       /**
         @brief Collapses multiple MS spectra (each with its own drift time) from the same IM-frame into a single MSSpectrum (with an IM-float data array)
 
@@ -10,6 +10,7 @@
 
 // OpenMS includes
 #include <OpenMS/CONCEPT/Types.h>
+#include <OpenMS/KERNEL/AreaTileIndex.h>
 #include <OpenMS/KERNEL/PeakIndex.h>
 #include <OpenMS/KERNEL/RangeManager.h>
 
@@ -102,6 +103,13 @@ namespace OpenMS
           ms_level_ = ms_level;
           return *this;
         }
+        /// Consult @p index (may be nullptr) to skip spectra without peaks in the m/z range, see AreaTileIndex.
+        /// The index must have been built for the experiment iterated over and must still match its spectra.
+        Param& skipIndex(const AreaTileIndex* index)
+        {
+          skip_index_ = index;
+          return *this;
+        }
         //@}
 
       protected:
@@ -126,6 +134,8 @@ namespace OpenMS
         CoordinateType high_im_ = std::numeric_limits<CoordinateType>::max();
         /// Only scans of this MS level are iterated over
         int8_t ms_level_ {};
+        /// Optional tile index used to skip spectra without peaks in the m/z range
+        const AreaTileIndex* skip_index_ = nullptr;
         /// Flag that indicates that this iterator is the end iterator
         bool is_end_ = false;
 
@@ -287,6 +297,13 @@ namespace OpenMS
             p_.is_end_ = true;
             return;
           }
+          // consult the tile index (if any) before binary-searching the spectrum
+          if (p_.skip_index_ != nullptr &&
+              !p_.skip_index_->containsPeaks(p_.current_scan_ - p_.first_, p_.low_mz_, p_.high_mz_))
+          {
+            ++p_.current_scan_;
+            continue;
+          }
           p_.current_peak_ = p_.current_scan_->MZBegin(p_.low_mz_);
           p_.end_peak_ = p_.current_scan_->MZEnd(p_.high_mz_);
           if (p_.current_peak_ != p_.end_peak_)
@@ -0,0 +1,127 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/CONCEPT/Types.h>
+#include <OpenMS/OpenMSConfig.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace OpenMS
+{
+  class MSExperiment;
+
+  /**
+    @brief 2D occupancy index (spectra x m/z tiles) to speed up AreaIterator on sparse areas
+
+    The index divides the m/z range of an experiment into a fixed number of tiles and
+    records for every spectrum which tiles contain at least one peak. In addition, a
+    coarse directory over blocks of consecutive spectra stores the minimal and maximal
+    peak intensity per tile. An AreaIterator given this index (see
+    Internal::AreaIterator::Param::skipIndex() and MSExperiment::buildAreaTileIndex())
+    can discard spectra without peaks in its m/z window by a few bit tests instead of
+    binary-searching every spectrum in the RT range, which makes repeated extraction of
+    narrow XICs from experiments with many (e.g. ion mobility) spectra much cheaper.
+
+    The index is a snapshot: it answers queries by spectrum index and must be rebuilt
+    after spectra are added, removed, reordered or their peak data changes. All queries
+    are conservative, i.e. for spectra not covered by the index the answer is
+    "may contain peaks", so a stale or partial index can degrade performance but never
+    drops peaks -- provided the number and order of spectra is unchanged.
+  */
+  class OPENMS_DLLAPI AreaTileIndex
+  {
+  public:
+    /// Default constructor; creates an empty index (all queries are conservative)
+    AreaTileIndex() = default;
+
+    /**
+      @brief Builds the index for all spectra of @p exp
+
+      @param exp The experiment to index; spectra must be sorted by m/z
+      @param mz_tiles Number of m/z tiles spanning the full m/z range of @p exp
+      @param rt_block_size Number of consecutive spectra sharing one row of the intensity directory
+
+      @exception Exception::IllegalArgument is thrown if @p mz_tiles or @p rt_block_size is zero
+    */
+    void build(const MSExperiment& exp, Size mz_tiles = 256, Size rt_block_size = 64);
+
+    /// Removes all index data; all queries are conservative afterwards
+    void clear();
+
+    /// Is the index empty, i.e. build() was not called (or called on an empty experiment)?
+    bool empty() const
+    {
+      return n_spectra_ == 0;
+    }
+
+    /// Number of indexed spectra
+    Size getNrSpectra() const
+    {
+      return n_spectra_;
+    }
+
+    /// Number of m/z tiles per spectrum
+    Size getNrMZTiles() const
+    {
+      return n_tiles_;
+    }
+
+    /**
+      @brief Might the spectrum at @p scan_index contain peaks in [@p low_mz, @p high_mz]?
+
+      Returns @em false only if the occupancy bitmap proves the window empty (tile
+      granularity). For an empty index or a @p scan_index beyond the indexed spectra,
+      @em true is returned.
+    */
+    bool containsPeaks(Size scan_index, double low_mz, double high_mz) const;
+
+    /**
+      @brief Upper bound on the intensity of any peak of spectrum @p scan_index in [@p low_mz, @p high_mz]
+
+      The bound is taken from the block-level intensity directory, i.e. it covers
+      @p rt_block_size consecutive spectra at tile granularity. Returns 0 if the
+      occupancy bitmap proves the window empty, and the maximal float value if the
+      spectrum is not covered by the index.
+    */
+    float maxIntensity(Size scan_index, double low_mz, double high_mz) const;
+
+    /// Lower bound counterpart of maxIntensity(); returns 0 if the window is empty or not covered
+    float minIntensity(Size scan_index, double low_mz, double high_mz) const;
+
+  private:
+    /// m/z tile of @p mz, clamped to [0, n_tiles_ - 1]
+    Size tileOf_(double mz) const;
+
+    /// first and last (inclusive) tile overlapping [@p low_mz, @p high_mz], clamped
+    std::pair<Size, Size> tileRange_(double low_mz, double high_mz) const;
+
+    /// number of indexed spectra
+    Size n_spectra_ = 0;
+    /// number of m/z tiles per spectrum
+    Size n_tiles_ = 0;
+    /// number of 64 bit words of the occupancy bitmap per spectrum
+    Size words_per_spectrum_ = 0;
+    /// number of consecutive spectra per row of the intensity directory
+    Size rt_block_size_ = 0;
+    /// lower m/z boundary of tile 0
+    double min_mz_ = 0.0;
+    /// tiles per m/z unit (0 for a degenerate m/z range, which maps everything to tile 0)
+    double inv_tile_width_ = 0.0;
+    /// per-spectrum occupancy bitmap (n_spectra_ x words_per_spectrum_ words, tile t = bit t)
+    std::vector<uint64_t> occupied_;
+    /// minimal peak intensity per (spectrum block, tile); only valid for occupied tiles
+    std::vector<float> block_min_intensity_;
+    /// maximal peak intensity per (spectrum block, tile); only valid for occupied tiles
+    std::vector<float> block_max_intensity_;
+  };
+
+} // namespace OpenMS
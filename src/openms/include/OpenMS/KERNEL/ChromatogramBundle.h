@@ -0,0 +1,142 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/KERNEL/ChromatogramPeak.h>
+#include <OpenMS/METADATA/ChromatogramSettings.h>
+#include <OpenMS/CONCEPT/Types.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+  class MSChromatogram;
+
+  /**
+    @brief Contiguous storage for many chromatograms sharing one RT axis.
+
+    MSChromatogram stores each chromatogram as its own std::vector of
+    (RT, intensity) peaks. SWATH extractions produce hundreds of thousands of
+    short chromatograms which all sample the same retention times (one point
+    per MS spectrum), so the per-object layout replicates the RT axis once per
+    chromatogram and scatters the intensity data across the heap.
+
+    ChromatogramBundle keeps the shared RT axis once and all intensities in a
+    single chromatogram-major matrix: the intensities of chromatogram i are
+    the contiguous range [intensityData(i), intensityData(i) + gridSize()),
+    and scanning all chromatograms walks memory linearly. Per-chromatogram
+    metadata (native ID, precursor/product) is kept as ChromatogramSettings.
+
+    Conversion from/to std::vector<MSChromatogram> is explicit (see the
+    conversion constructor and toChromatograms()); it requires all
+    chromatograms to share one RT axis.
+
+    @ingroup Kernel
+  */
+  class OPENMS_DLLAPI ChromatogramBundle
+  {
+public:
+    ///@name Base type definitions
+    //@{
+    /// Peak type of the per-object chromatogram layout
+    typedef ChromatogramPeak PeakType;
+    /// Coordinate (RT) type
+    typedef PeakType::CoordinateType CoordinateType;
+    /// Intensity type
+    typedef PeakType::IntensityType IntensityType;
+    /// Shared RT axis type
+    typedef std::vector<CoordinateType> RTArrayType;
+    /// Contiguous intensity matrix type (chromatogram-major)
+    typedef std::vector<IntensityType> IntensityMatrixType;
+    //@}
+
+    /// Constructor (empty bundle)
+    ChromatogramBundle() = default;
+
+    /**
+      @brief Conversion from the per-object chromatogram layout
+
+      @exception Exception::InvalidParameter is thrown if the chromatograms do not all share the RT axis of the first one
+    */
+    explicit ChromatogramBundle(const std::vector<MSChromatogram>& chromatograms);
+
+    /**
+      @brief Sets the shared RT axis
+
+      @exception Exception::InvalidParameter is thrown if the bundle already contains chromatograms of a different grid size
+    */
+    void setRTs(RTArrayType rts);
+
+    /// The shared RT axis
+    const RTArrayType& getRTs() const { return rts_; }
+
+    ///@name Container interface
+    //@{
+    /// Number of chromatograms
+    Size size() const { return settings_.size(); }
+    /// Number of points per chromatogram (length of the shared RT axis)
+    Size gridSize() const { return rts_.size(); }
+    bool empty() const { return settings_.empty(); }
+    void clear();
+    void reserve(Size n);
+    //@}
+
+    /**
+      @brief Appends a chromatogram
+
+      @param settings Per-chromatogram metadata (native ID, precursor/product, ...)
+      @param intensities One intensity per point of the shared RT axis
+
+      @exception Exception::InvalidParameter is thrown if @p intensities does not match the grid size
+    */
+    void addChromatogram(const ChromatogramSettings& settings, const std::vector<IntensityType>& intensities);
+
+    ///@name Packed data access (use these in hot loops)
+    //@{
+    /// Pointer to the gridSize() intensities of chromatogram @p i
+    const IntensityType* intensityData(Size i) const { return intensities_.data() + i * rts_.size(); }
+    /// Pointer to the gridSize() intensities of chromatogram @p i
+    IntensityType* intensityData(Size i) { return intensities_.data() + i * rts_.size(); }
+    /// The full intensity matrix (chromatogram-major, size() * gridSize() values)
+    const IntensityMatrixType& getIntensityMatrix() const { return intensities_; }
+    //@}
+
+    /// Metadata of chromatogram @p i
+    const ChromatogramSettings& getSettings(Size i) const { return settings_[i]; }
+    /// Metadata of chromatogram @p i
+    ChromatogramSettings& getSettings(Size i) { return settings_[i]; }
+
+    /// Assembles chromatogram @p i in the per-object layout
+    MSChromatogram getChromatogram(Size i) const;
+
+    /// Convert back to the per-object chromatogram layout
+    std::vector<MSChromatogram> toChromatograms() const;
+
+    /// Equality operator
+    bool operator==(const ChromatogramBundle& rhs) const
+    {
+      return rts_ == rhs.rts_ && intensities_ == rhs.intensities_ && settings_ == rhs.settings_;
+    }
+
+    /// Equality operator
+    bool operator!=(const ChromatogramBundle& rhs) const
+    {
+      return !(operator==(rhs));
+    }
+
+protected:
+    /// Shared RT axis
+    RTArrayType rts_;
+    /// Intensities of all chromatograms (chromatogram-major)
+    IntensityMatrixType intensities_;
+    /// Per-chromatogram metadata
+    std::vector<ChromatogramSettings> settings_;
+  };
+
+} // namespace OpenMS
@@ -26,6 +26,7 @@
 #include <OpenMS/OpenMSConfig.h>
 
 #include <map>
+#include <memory>
 #include <vector>
 #include <iosfwd>
 
@@ -83,9 +84,13 @@ public:
 
       /// Copy constructor
       ColumnHeader(const ColumnHeader&) = default;
+      /// Move constructor
+      ColumnHeader(ColumnHeader&&) = default;
 
       /// Copy assignment
       ColumnHeader& operator=(const ColumnHeader&) = default;
+      /// Move assignment
+      ColumnHeader& operator=(ColumnHeader&&) = default;
 
       /// File name of the mzML file
       String filename;
@@ -166,12 +171,21 @@ public:
     /// Non-mutable access to the file descriptions
     const ColumnHeaders& getColumnHeaders() const;
 
-    /// Mutable access to the file descriptions
+    /**
+      @brief Mutable access to the file descriptions
+
+      The headers are shared between copies of a map until one of them is
+      modified (copy-on-write), so this detaches them first. The returned
+      reference is invalidated by copying or assigning the map.
+    */
     ColumnHeaders& getColumnHeaders();
 
-    /// Mutable access to the file descriptions
+    /// Replaces the file descriptions
     void setColumnHeaders(const ColumnHeaders& column_description);
 
+    /// Replaces the file descriptions (move version)
+    void setColumnHeaders(ColumnHeaders&& column_description);
+
     /// Non-mutable access to the experiment type
     const String& getExperimentType() const;
 
@@ -350,8 +364,23 @@ public:
     ///@}
 
   protected:
-    /// Map from index to file description
-    ColumnHeaders column_description_;
+    /**
+      @brief Releases the sub-hierarchies of all contained features in parallel
+
+      Each consensus feature owns separately heap-allocated feature handles,
+      ratios and peptide identifications; releasing them one by one dominates
+      the destruction time of large maps. This frees them with all available
+      threads and leaves the features themselves empty, so the subsequent
+      vector destruction is trivial.
+    */
+    void releaseFeatureData_();
+
+    /// Gives this map its own copy of the column headers if they are still shared with another map
+    void detachColumnHeaders_();
+
+    /// Map from index to file description; shared between copies of a map
+    /// until one of them modifies the headers (copy-on-write)
+    std::shared_ptr<ColumnHeaders> column_description_ = std::make_shared<ColumnHeaders>();
 
     /// type of experiment (label-free, labeled_MS1, labeled_MS2)
     String experiment_type_ = "label-free";
@@ -24,6 +24,8 @@
 
 #include <array>
 #include <memory>
+#include <tuple>
+#include <type_traits>
 
 
 namespace OpenMS
@@ -88,6 +90,14 @@ namespace OpenMS
     /// @throw Exception::InvalidRange if elements do not support the dimension
     virtual ValueTypes map(const MSChromatogram& chrom) const = 0;
 
+    /// same as map(const MSSpectrum&), but filling the buffer @p out (cleared first; its capacity is reused across calls)
+    /// @throw Exception::InvalidRange if elements do not support the dimension
+    virtual void map(const MSSpectrum& spec, ValueTypes& out) const = 0;
+
+    /// same as map(const MSChromatogram&), but filling the buffer @p out (cleared first; its capacity is reused across calls)
+    /// @throw Exception::InvalidRange if elements do not support the dimension
+    virtual void map(const MSChromatogram& chrom, ValueTypes& out) const = 0;
+
     virtual ValueType map(const BaseFeature& bf) const = 0;
 
     virtual ValueType map(const PeptideIdentification& pi) const = 0;
@@ -200,6 +210,20 @@ namespace OpenMS
       return res;
     }
 
+    void map(const MSSpectrum&, ValueTypes&) const override
+    {
+      throw Exception::InvalidRange(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION);
+    }
+    void map(const MSChromatogram& chrom, ValueTypes& out) const override
+    {
+      out.clear();
+      out.reserve(chrom.size());
+      for (const auto& p : chrom)
+      {
+        out.push_back(p.getRT());
+      }
+    }
+
     ValueType map(const MSExperiment::ConstAreaIterator& it) const override
     {
       return it.getRT();
@@ -321,8 +345,22 @@ namespace OpenMS
     ValueTypes map(const MSChromatogram&) const override
     {
       throw Exception::InvalidRange(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION);
-    }  
-    
+    }
+
+    void map(const MSSpectrum& spec, ValueTypes& out) const override
+    {
+      out.clear();
+      out.reserve(spec.size());
+      for (const auto& p : spec)
+      {
+        out.push_back(p.getMZ());
+      }
+    }
+    void map(const MSChromatogram&, ValueTypes&) const override
+    {
+      throw Exception::InvalidRange(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION);
+    }
+
     ValueType map(const BaseFeature& bf) const override
     {
       return bf.getMZ();
@@ -441,6 +479,25 @@ namespace OpenMS
       return res;
     }
 
+    void map(const MSSpectrum& spec, ValueTypes& out) const override
+    {
+      out.clear();
+      out.reserve(spec.size());
+      for (const auto& p : spec)
+      {
+        out.push_back(p.getIntensity());
+      }
+    }
+    void map(const MSChromatogram& chrom, ValueTypes& out) const override
+    {
+      out.clear();
+      out.reserve(chrom.size());
+      for (const auto& p : chrom)
+      {
+        out.push_back(p.getIntensity());
+      }
+    }
+
     ValueType map(const BaseFeature& bf) const override
     {
       return bf.getIntensity();
@@ -518,6 +575,14 @@ namespace OpenMS
     {
       throw Exception::InvalidRange(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION);
     }
+    void map(const MSSpectrum&, ValueTypes&) const override
+    {
+      throw Exception::InvalidRange(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION);
+    }
+    void map(const MSChromatogram&, ValueTypes&) const override
+    {
+      throw Exception::InvalidRange(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION);
+    }
 
     ValueType map(const MSExperiment::ConstAreaIterator& it) const override
     {
@@ -612,6 +677,8 @@ namespace OpenMS
 
       Use N_DIM template parameter to determine the number of axis dimensions (1-3 is currently supported). Usually 2 or 3 make sense.
 
+      If the axis configuration is already fixed at compile time, consider StaticDimMapper, which avoids the virtual call per point and dimension.
+
       @ingroup Visual
   */
   template<int N_DIM>
@@ -686,6 +753,17 @@ namespace OpenMS
       return pr;
     }
 
+    /// convert all datapoints of a container (such as MSSpectrum) at once, filling one packed
+    /// coordinate buffer per dimension (e.g. for rendering); only a single virtual call per
+    /// dimension is made and the capacity of the buffers in @p out is reused across calls
+    /// @throw Exception::InvalidRange if a dimension does not support per-point values of the container
+    template<typename Container>
+    void map(const Container& data, std::array<DimBase::ValueTypes, N_DIM>& out) const
+    {
+      for (int i = 0; i < N_DIM; ++i)
+        dims_[i]->map(data, out[i]);
+    }
+
     /// Convert Range to an N_DIM-dimensional area (min and max for each dimension)
     template<typename ...Ranges>
     DRange<N_DIM> mapRange(const RangeManager<Ranges...>& ranges) const
@@ -786,6 +864,125 @@ namespace OpenMS
   };
 
 
+  /**
+      @brief A compile-time variant of DimMapper for performance-critical loops, e.g. updating the point buffers of a TOPPView layer.
+
+      The dimensions are given as template arguments (the order is assumed to be X, Y, Z, ...) and are held by value.
+      Since all Dim classes are final, the compiler can devirtualize (and inline) the per-point map() calls,
+      which then collapse to direct member loads -- in contrast to DimMapper, which dispatches through a virtual
+      call per point and dimension.
+
+      Use DimMapper whenever the axis configuration is only known at runtime (e.g. user-configurable axes).
+
+      @ingroup Visual
+  */
+  template<typename... DimTypes>
+  class StaticDimMapper
+  {
+  public:
+    /// the number of axis dimensions
+    static constexpr int N_DIM = sizeof...(DimTypes);
+    using Point = DPosition<N_DIM, DimBase::ValueType>;
+
+    static_assert(N_DIM >= 1); // at least one dimension (X)
+    static_assert(N_DIM <= 3); // at most three (X, Y, Z)
+    static_assert((std::is_base_of_v<DimBase, DimTypes> && ...), "All dimensions must derive from DimBase");
+
+    /// Default C'tor; only usable if all dimensions are default-constructible (DimIM is not)
+    StaticDimMapper() = default;
+
+    /// Custom C'tor with dimension instances, e.g. to pass the ion mobility unit to a DimIM
+    explicit StaticDimMapper(DimTypes... dims) : dims_(std::move(dims)...)
+    {
+    }
+
+    /// Equality (same units in the same order)
+    bool operator==(const StaticDimMapper& rhs) const
+    {
+      return dims_ == rhs.dims_;
+    }
+
+    /// Inequality
+    bool operator!=(const StaticDimMapper& rhs) const
+    {
+      return !operator==(rhs);
+    }
+
+    /// convert an OpenMS datatype (such as Feature) to an N_DIM-dimensional point
+    template<typename T>
+    Point map(const T& data) const
+    {
+      Point pr;
+      int i = 0;
+      std::apply([&](const auto&... dim) { ((pr[i++] = dim.map(data)), ...); }, dims_);
+      return pr;
+    }
+
+    /// convert an OpenMS datapoint in a container (such as MSSpectrum) to an N_DIM-dimensional point
+    template<typename Container>
+    Point map(const Container& data, const Size index) const
+    {
+      Point pr;
+      int i = 0;
+      std::apply([&](const auto&... dim) { ((pr[i++] = dim.map(data, index)), ...); }, dims_);
+      return pr;
+    }
+
+    /// convert all datapoints of a container (such as MSSpectrum) at once, filling one packed
+    /// coordinate buffer per dimension; the capacity of the buffers in @p out is reused across calls
+    /// @throw Exception::InvalidRange if a dimension does not support per-point values of the container
+    template<typename Container>
+    void map(const Container& data, std::array<DimBase::ValueTypes, N_DIM>& out) const
+    {
+      int i = 0;
+      std::apply([&](const auto&... dim) { (dim.map(data, out[i++]), ...); }, dims_);
+    }
+
+    /// Convert Range to an N_DIM-dimensional area (min and max for each dimension)
+    template<typename... Ranges>
+    DRange<N_DIM> mapRange(const RangeManager<Ranges...>& ranges) const
+    {
+      DRange<N_DIM> res;
+      RangeAllType all;
+      all.assign(ranges);
+      auto dims = dimPtrs_();
+      for (int i = 0; i < N_DIM; ++i)
+      {
+        RangeBase mm = dims[i]->map(all);
+        if (mm.isEmpty()) continue;
+        res.setDimMinMax(i, {mm.getMin(), mm.getMax()});
+      }
+      return res;
+    }
+
+    /// obtain unit/name for X/Y/Z dimension.
+    const DimBase& getDim(DIM d) const
+    {
+      assert((int)d < N_DIM);
+      return *dimPtrs_()[(int)d];
+    }
+
+  private:
+    /// pointers to the dimensions (in X, Y, Z order), for uniform runtime indexing
+    std::array<const DimBase*, N_DIM> dimPtrs_() const
+    {
+      return std::apply([](const auto&... dim) { return std::array<const DimBase*, N_DIM> {{&dim...}}; }, dims_);
+    }
+
+    std::tuple<DimTypes...> dims_; ///< the dimensions (X, Y, Z, ...), held by value
+  };
+
+  /// compile-time mapper for the standard 2D peak map view (X = RT, Y = m/z)
+  using DimMapperRTMZ = StaticDimMapper<DimRT, DimMZ>;
+  /// compile-time mapper for the standard 1D spectrum view (X = m/z, Y = intensity)
+  using DimMapperMZInt = StaticDimMapper<DimMZ, DimINT>;
+  /// compile-time mapper for the standard chromatogram view (X = RT, Y = intensity)
+  using DimMapperRTInt = StaticDimMapper<DimRT, DimINT>;
+  /// compile-time mapper for an ion mobility view (X = IM, Y = intensity);
+  /// construct with the IM unit, e.g. DimMapperIMInt(DimIM(DIM_UNIT::IM_MS), DimINT())
+  using DimMapperIMInt = StaticDimMapper<DimIM, DimINT>;
+
+
   /// The data is stored in two members, one axis-related (X and Y; unit does not matter), and one unit-related (units; no mapping to axis)
   /// You can set either, and the other will be updated accordingly as long as you provide a DimMapper which translates between the two representations.
   template <int N_DIM>
@@ -0,0 +1,142 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/KERNEL/MSExperiment.h>
+
+namespace OpenMS
+{
+  /**
+    @brief Non-owning view over a contiguous spectrum range of an MSExperiment.
+
+    Slicing an experiment by retention time usually means copying the selected
+    spectra into a new MSExperiment (or erasing the rest), which duplicates the
+    peak data of the whole slice. An ExperimentView instead just remembers an
+    iterator range into the original experiment, so cutting an RT window out of
+    a large in-memory experiment for per-window processing is free.
+
+    The view mimics the spectra part of the MSExperiment interface (iteration,
+    element access, size) and maintains its own RangeManager, which
+    updateRanges() recalculates over the viewed spectra only (chromatograms are
+    not part of a view). Like any iterator range, a view is invalidated by
+    operations that reallocate or resize the spectrum list of the underlying
+    experiment; the peak data of the spectra themselves may be modified freely
+    through the view.
+
+    @ingroup Kernel
+  */
+  class OPENMS_DLLAPI ExperimentView : public RangeManagerContainer<RangeRT, RangeMZ, RangeIntensity, RangeMobility>
+  {
+public:
+    /// @name Base type definitions (mirroring MSExperiment)
+    //@{
+    /// Peak type
+    typedef MSExperiment::PeakType PeakType;
+    /// Coordinate type of peak positions
+    typedef MSExperiment::CoordinateType CoordinateType;
+    /// Spectrum Type
+    typedef MSExperiment::SpectrumType SpectrumType;
+    /// Mutable iterator
+    typedef MSExperiment::Iterator Iterator;
+    /// Non-mutable iterator
+    typedef MSExperiment::ConstIterator ConstIterator;
+    typedef SpectrumType value_type;
+    typedef Iterator iterator;
+    typedef ConstIterator const_iterator;
+    //@}
+
+    /// View of the spectra in the range [ @p first, @p last )
+    ExperimentView(Iterator first, Iterator last);
+
+    /**
+      @brief View of all spectra of @p exp with retention time in [ @p min_rt, @p max_rt ]
+
+      The spectra of @p exp need to be sorted by retention time (see MSExperiment::sortSpectra()).
+    */
+    ExperimentView(MSExperiment& exp, CoordinateType min_rt, CoordinateType max_rt);
+
+    Iterator begin()
+    {
+      return begin_;
+    }
+
+    ConstIterator begin() const
+    {
+      return begin_;
+    }
+
+    ConstIterator cbegin() const
+    {
+      return begin_;
+    }
+
+    Iterator end()
+    {
+      return end_;
+    }
+
+    ConstIterator end() const
+    {
+      return end_;
+    }
+
+    ConstIterator cend() const
+    {
+      return end_;
+    }
+
+    /// The number of spectra in the view
+    Size size() const
+    {
+      return end_ - begin_;
+    }
+
+    bool empty() const
+    {
+      return begin_ == end_;
+    }
+
+    /// Access to the spectrum at position @p n of the view
+    SpectrumType& operator[](Size n)
+    {
+      return *(begin_ + n);
+    }
+
+    /// Access to the spectrum at position @p n of the view (const)
+    const SpectrumType& operator[](Size n) const
+    {
+      return *(begin_ + n);
+    }
+
+    /// The total number of peaks in the viewed spectra (only valid after calling updateRanges())
+    UInt64 getSize() const
+    {
+      return total_size_;
+    }
+
+    // Docu in base class (RangeManagerContainer)
+    void updateRanges() override;
+
+    /**
+      @brief Updates the m/z, intensity, retention time and mobility ranges of the viewed spectra with a certain ms level
+
+      @param ms_level MS level to consider for the ranges (all MS levels if negative)
+    */
+    void updateRanges(Int ms_level);
+
+protected:
+    /// First spectrum of the view
+    Iterator begin_;
+    /// Past-the-end spectrum of the view
+    Iterator end_;
+    /// Number of all peaks in the viewed spectra
+    UInt64 total_size_ = 0;
+  };
+
+} // namespace OpenMS
@@ -277,6 +277,17 @@ namespace OpenMS
     ///@}
 
 protected:
+    /**
+      @brief Releases the sub-hierarchies of all contained features in parallel
+
+      Each feature owns separately heap-allocated subordinates, convex hulls
+      and peptide identifications; releasing them one by one dominates the
+      destruction time of large maps. This frees them with all available
+      threads and leaves the features themselves empty, so the subsequent
+      vector destruction is trivial.
+    */
+    void releaseFeatureData_();
+
     /// protein identifications
     std::vector<ProteinIdentification> protein_identifications_;
 
@@ -203,6 +203,68 @@ public:
       OPENMS_PRECONDITION(chromatograms_.size() > (size_t)chromatogram_map_.at(key), "Mapping needs to be accurate")
       return chromatograms_[chromatogram_map_.at(key)];
     }
+
+    /**
+      @brief Packed view of all fragment ion chromatograms of the group.
+
+      The intensities of all chromatograms are stored in a single row-major
+      (rows x cols) matrix, one chromatogram per row, so that scoring code can
+      walk contiguous rows instead of chasing pointers through individual
+      chromatogram objects (see MRMScoring::initializeXCorrMatrix()).
+    */
+    struct ChromatogramMatrix
+    {
+      Size rows = 0; ///< number of chromatograms
+      Size cols = 0; ///< number of data points per chromatogram
+      std::vector<double> intensities; ///< rows * cols intensities, row-major
+      std::map<String, int> row_map; ///< chromatogram key -> row
+
+      /// Pointer to the first intensity of row @p r
+      const double* row(Size r) const
+      {
+        OPENMS_PRECONDITION(r < rows, "Row index out of bounds")
+        return intensities.data() + r * cols;
+      }
+
+      /// Row holding the chromatogram stored under @p key
+      int rowIndex(const String& key) const
+      {
+        OPENMS_PRECONDITION(row_map.find(key) != row_map.end(), "Cannot retrieve chromatogram that does not exist")
+        return row_map.at(key);
+      }
+    };
+
+    /** @brief Pack all fragment ion chromatograms into one contiguous intensity matrix.
+     *
+     * All chromatograms of a group are extracted on the same RT grid, so their
+     * intensities can share a single row-major matrix; rows keep the order of
+     * getChromatograms() and are addressable by key via ChromatogramMatrix::rowIndex().
+     *
+     * @throws Exception::InvalidValue if the chromatograms differ in length
+     */
+    ChromatogramMatrix getChromatogramMatrix() const
+    {
+      ChromatogramMatrix m;
+      m.rows = chromatograms_.size();
+      m.cols = chromatograms_.empty() ? 0 : chromatograms_[0].size();
+      m.intensities.resize(m.rows * m.cols);
+      for (Size r = 0; r < m.rows; ++r)
+      {
+        const ChromatogramType& chromatogram = chromatograms_[r];
+        if (chromatogram.size() != m.cols)
+        {
+          throw Exception::InvalidValue(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+              "Cannot pack chromatograms of differing length into a matrix", String(chromatogram.size()));
+        }
+        double* row = m.intensities.data() + r * m.cols;
+        for (Size c = 0; c < m.cols; ++c)
+        {
+          row[c] = chromatogram[c].getIntensity();
+        }
+      }
+      m.row_map = chromatogram_map_;
+      return m;
+    }
     //@}
 
 
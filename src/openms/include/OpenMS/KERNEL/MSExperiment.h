@@ -15,6 +15,7 @@
 #include <OpenMS/KERNEL/MSSpectrum.h>
 #include <OpenMS/METADATA/ExperimentalSettings.h>
 
+#include <memory>
 #include <vector>
 
 
@@ -330,6 +331,30 @@ public:
     /// Returns an non-mutable invalid area iterator marking the end of an area
     ConstAreaIterator areaEndConst() const;
 
+    /**
+      @brief Builds a 2D tile index which subsequent area iterators use to skip empty spectra
+
+      See AreaTileIndex for details. Once built, all area iterators obtained from
+      areaBegin()/areaBeginConst() consult the index to discard spectra without peaks in
+      their m/z window, which speeds up repeated extraction of narrow XICs from sparse
+      experiments (e.g. ion mobility frames) considerably.
+
+      The index is a snapshot of the current peak data: call this method again (or
+      clearAreaTileIndex()) after spectra are added, removed, reordered or modified.
+      A stale index over the unchanged set of spectra only degrades performance; if the
+      number or order of spectra changed, iteration results are undefined.
+
+      @param mz_tiles Number of m/z tiles spanning the full m/z range
+      @param rt_block_size Number of consecutive spectra sharing one row of the intensity directory
+    */
+    void buildAreaTileIndex(Size mz_tiles = 256, Size rt_block_size = 64);
+
+    /// Removes the tile index (if any); area iterators fall back to visiting every spectrum
+    void clearAreaTileIndex();
+
+    /// The tile index built by buildAreaTileIndex(), or nullptr if there is none
+    const AreaTileIndex* getAreaTileIndex() const;
+
     // for fast pyOpenMS access to MS1 peak data in format: [rt, [mz, intensity]]
     void get2DPeakData(CoordinateType min_rt, CoordinateType max_rt, CoordinateType min_mz, CoordinateType max_mz, 
       std::vector<float>& rt, 
@@ -502,6 +527,24 @@ public:
     */
     void updateRanges(Int ms_level);
 
+    /**
+      @brief Incremental version of updateRanges(), folding cached per-spectrum ranges
+
+      Recomputes the experiment-wide ranges, MS levels and peak count from
+      the cached ranges of the contained spectra and chromatograms instead
+      of rescanning every peak. A spectrum (or chromatogram) is only
+      rescanned if it contains peaks but its cached range is empty, i.e. its
+      ranges were never computed or were invalidated. Callers that modified
+      peak data through a reference must mark the affected spectrum dirty
+      with its clearRanges() before calling this method, otherwise its stale
+      cached range is folded.
+
+      With all caches valid this costs O(number of spectra) instead of
+      O(number of peaks), which matters for pipelines calling updateRanges()
+      after each of many small mutations.
+    */
+    void updateRangesIncremental();
+
     /// returns the total number of peaks
     UInt64 getSize() const;
 
@@ -522,7 +565,7 @@ public:
     /**
       @brief Sorts the data points by retention time
 
-      @param sort_mz if @em true, spectra are sorted by m/z position as well
+      @param sort_mz if @em true, spectra are sorted by m/z position as well (parallelized over spectra)
     */
     void sortSpectra(bool sort_mz = true);
 
@@ -586,6 +629,11 @@ public:
     void addSpectrum(const MSSpectrum& spectrum);
     void addSpectrum(MSSpectrum&& spectrum);
 
+    /// appends a batch of spectra to the list (one reallocation at most; the rvalue
+    /// overload moves the individual spectra and leaves @p spectra empty)
+    void addSpectra(const std::vector<MSSpectrum>& spectra);
+    void addSpectra(std::vector<MSSpectrum>&& spectra);
+
     /// returns the spectrum list
     const std::vector<MSSpectrum>& getSpectra() const;
 
@@ -600,6 +648,11 @@ public:
     void addChromatogram(const MSChromatogram& chromatogram);
     void addChromatogram(MSChromatogram&& chrom);
 
+    /// appends a batch of chromatograms to the list (one reallocation at most; the rvalue
+    /// overload moves the individual chromatograms and leaves @p chromatograms empty)
+    void addChromatograms(const std::vector<MSChromatogram>& chromatograms);
+    void addChromatograms(std::vector<MSChromatogram>&& chromatograms);
+
     /// returns the chromatogram list
     const std::vector<MSChromatogram>& getChromatograms() const;
 
@@ -640,6 +693,27 @@ public:
     */
     void clear(bool clear_meta_data);
 
+    /**
+      @brief Re-place the peak data of spectra and chromatograms for parallel access
+
+      After loading, the backing memory of all spectra has typically been
+      allocated (and its pages first-touched) by a single thread, so on
+      multi-socket machines parallel loops over the spectra pay for
+      cross-socket memory traffic. This method re-allocates the peak data of
+      each spectrum and chromatogram from within a statically scheduled
+      OpenMP loop, so the pages are first touched -- and, with the usual
+      first-touch placement policy, placed -- on the NUMA node of the thread
+      that owns the same index range in subsequent statically scheduled
+      loops. Chunked dynamic loops also benefit, since the pages end up
+      distributed over the nodes instead of concentrated on one.
+
+      Call once after load() and before heavy parallel processing, e.g.
+      PeakPickerHiRes::pickExperiment() or GaussFilter::filterExperiment().
+      The data is unchanged; without OpenMP this is a no-op apart from the
+      reallocation.
+    */
+    void partitionForParallelAccess();
+
     /// returns true if at least one of the spectra has the specified level
     bool containsScanOfLevel(size_t ms_level) const;
 
@@ -661,6 +735,8 @@ public:
     std::vector<MSChromatogram > chromatograms_;
     /// spectra
     std::vector<SpectrumType> spectra_;
+    /// optional tile index consulted by area iterators (see buildAreaTileIndex()); shared between copies
+    std::shared_ptr<const AreaTileIndex> area_tile_index_;
 
 private:
 
@@ -559,6 +559,38 @@ public:
     */
     MSSpectrum& select(const std::vector<Size>& indices);
 
+    /**
+      @brief Resolve the name of a float data array into its index (a stable handle)
+
+      Use this to resolve a column name once and then index by handle (e.g. via
+      getFloatDataArrays()[handle]) instead of searching by name per peak/access.
+      The index stays valid as long as no data arrays are added or removed.
+
+      @param name Name of the float data array
+      @return Index of the first float data array with @p name, or Size(-1) if none exists
+    */
+    Size findFloatDataArray(const String& name) const;
+
+    /// same as findFloatDataArray(), but for integer data arrays
+    Size findIntegerDataArray(const String& name) const;
+
+    /**
+      @brief Keep only peaks whose value in float data array @p array_index lies in [@p min_value, @p max_value]
+
+      This fuses the column scan with the subsetting: the matching indices are collected in one
+      pass over the column and peaks plus all data arrays are subset together via select().
+      Useful for predicate pushdown on per-peak annotation columns, e.g. selecting the peaks of
+      an IM frame within an ion mobility window (see IMDataConverter::extractIMRange()).
+
+      @param array_index Index of the float data array to filter on (e.g. from findFloatDataArray())
+      @param min_value Lower end of the value range (inclusive)
+      @param max_value Upper end of the value range (inclusive)
+      @return Reference to this MSSpectrum
+
+      @throws Exception::Precondition if the data array's size does not match the spectrum's size
+    */
+    MSSpectrum& selectByFloatDataArray(Size array_index, float min_value, float max_value);
+
 
     /**
       @brief Determine if spectrum is profile or centroided using up to three layers of information.
@@ -62,6 +62,10 @@ public:
     /// Detailed constructor for vector
     MassTrace(const std::vector<PeakType>& trace_peaks);
 
+    /// Detailed constructor taking ownership of an already assembled peak vector (avoids copying
+    /// the peaks again; important when millions of traces are built, e.g. by MassTraceDetection)
+    MassTrace(std::vector<PeakType>&& trace_peaks);
+
     /// Destructor
     ~MassTrace() = default;
 
@@ -212,6 +216,18 @@ public:
       smoothed_intensities_ = db_vec;
     }
 
+    /// Set smoothed intensities, taking ownership of the data (overload avoiding a copy).
+    void setSmoothedIntensities(std::vector<double>&& db_vec)
+    {
+      if (trace_peaks_.size() != db_vec.size())
+      {
+        throw Exception::InvalidValue(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+            "Number of smoothed intensities deviates from mass trace size! Aborting...", String(db_vec.size()));
+      }
+
+      smoothed_intensities_ = std::move(db_vec);
+    }
+
     /// Get average scan time of mass trace
     double getAverageMS1CycleTime() const
     {
@@ -17,6 +17,7 @@
 #include <OpenMS/FORMAT/HANDLERS/IndexedMzMLHandler.h>
 
 #include <vector>
+#include <future>
 #include <limits>
 
 #include <boost/shared_ptr.hpp>
@@ -33,9 +34,11 @@ namespace OpenMS
     data item. Please provide a separate copy to each thread, e.g. 
 
     @code
-    #pragma omp parallel for firstprivate(ondisc_map) 
+    #pragma omp parallel for firstprivate(ondisc_map)
     @endcode
 
+    For sequential scans, setReadAhead() decodes the next spectrum in an internal
+    background thread; this does @a not make concurrent external access safe.
   */
   class OPENMS_DLLAPI OnDiscMSExperiment
   {
@@ -152,6 +155,20 @@ public:
       return getSpectrum(n);
     }
 
+    /**
+      @brief Enables readahead for sequential scans over the spectra
+
+      If enabled, each call to getSpectrum() schedules decoding of the following spectrum in a
+      background thread, so a sequential consumer overlaps its processing with the decoding of
+      the next scan. Out-of-order access stays valid but discards the readahead.
+      Accessing the experiment from multiple threads remains unsupported (see class docs).
+    */
+    void setReadAhead(bool read_ahead)
+    {
+      waitForReadAhead_();
+      read_ahead_ = read_ahead;
+    }
+
     /**
       @brief returns a single spectrum
 
@@ -159,10 +176,36 @@ public:
     */
     MSSpectrum getSpectrum(Size id)
     {
-      if (!meta_ms_experiment_) return indexed_mzml_file_.getMSSpectrumById(int(id));
+      if (!read_ahead_)
+      {
+        return fetchSpectrum_(id);
+      }
 
-      MSSpectrum spectrum(meta_ms_experiment_->operator[](id));
-      indexed_mzml_file_.getMSSpectrumById(int(id), spectrum);
+      MSSpectrum spectrum;
+      if (read_ahead_spectrum_.valid() && read_ahead_id_ == id)
+      {
+        spectrum = read_ahead_spectrum_.get();
+      }
+      else
+      {
+        if (read_ahead_spectrum_.valid())
+        { // out-of-order access: discard the readahead (incl. any decode error of the unrequested spectrum)
+          try
+          {
+            read_ahead_spectrum_.get();
+          }
+          catch (...)
+          {
+          }
+        }
+        spectrum = fetchSpectrum_(id);
+      }
+
+      if (id + 1 < getNrSpectra())
+      { // decode the next spectrum while the caller processes the current one
+        read_ahead_id_ = id + 1;
+        read_ahead_spectrum_ = std::async(std::launch::async, &OnDiscMSExperiment::fetchSpectrum_, this, id + 1);
+      }
       return spectrum;
     }
 
@@ -171,6 +214,7 @@ public:
     */
     OpenMS::Interfaces::SpectrumPtr getSpectrumById(Size id)
     {
+      waitForReadAhead_();
       return indexed_mzml_file_.getSpectrumById((int)id);
     }
 
@@ -181,6 +225,7 @@ public:
     */
     MSChromatogram getChromatogram(Size id)
     {
+      waitForReadAhead_();
       if (!meta_ms_experiment_) return indexed_mzml_file_.getMSChromatogramById(int(id));
 
       MSChromatogram chromatogram(meta_ms_experiment_->getChromatogram(id));
@@ -215,6 +260,23 @@ private:
     /// Private Assignment operator -> we cannot copy file streams in IndexedMzMLHandler
     OnDiscMSExperiment& operator=(const OnDiscMSExperiment& /* source */);
 
+    /// reads and decodes spectrum @p id (used directly and by the readahead thread)
+    MSSpectrum fetchSpectrum_(Size id)
+    {
+      if (!meta_ms_experiment_) return indexed_mzml_file_.getMSSpectrumById(int(id));
+
+      MSSpectrum spectrum(meta_ms_experiment_->operator[](id));
+      indexed_mzml_file_.getMSSpectrumById(int(id), spectrum);
+      return spectrum;
+    }
+
+    /// blocks until a pending readahead has finished decoding (no-op if none is running);
+    /// required before any other file access, since the decoder moves the file pointer
+    void waitForReadAhead_() const
+    {
+      if (read_ahead_spectrum_.valid()) read_ahead_spectrum_.wait();
+    }
+
     void loadMetaData_(const String& filename);
 
     MSChromatogram getMetaChromatogramById_(const std::string& id);
@@ -233,6 +295,12 @@ protected:
     std::unordered_map< std::string, Size > chromatograms_native_ids_;
     /// Mapping of spectra native ids to offsets
     std::unordered_map< std::string, Size > spectra_native_ids_;
+    /// Whether getSpectrum() schedules decoding of the following spectrum in the background
+    bool read_ahead_ = false;
+    /// Index of the spectrum currently being decoded ahead
+    Size read_ahead_id_ = 0;
+    /// Pending readahead decode (invalid if none is running)
+    mutable std::future<MSSpectrum> read_ahead_spectrum_;
   };
 
 typedef OpenMS::OnDiscMSExperiment OnDiscPeakMap;
@@ -0,0 +1,182 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg$
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/KERNEL/Peak1D.h>
+#include <OpenMS/CONCEPT/Types.h>
+
+#include <iterator>
+#include <vector>
+
+namespace OpenMS
+{
+  class MSSpectrum;
+
+  /**
+    @brief Structure-of-arrays (SoA) peak storage for a 1D spectrum.
+
+    MSSpectrum stores peaks as a std::vector<Peak1D>, i.e. m/z (double) and
+    intensity (float) interleaved in memory. For algorithms which scan only one
+    of the two dimensions (binary searches on m/z, extraction windows, intensity
+    sums), this array-of-structures layout wastes cache bandwidth: every cache
+    line transports data of the dimension that is not inspected.
+
+    SoASpectrum keeps m/z and intensity in two separate contiguous arrays, so
+    m/z-only scans touch densely packed doubles. The peak-wise iterator API of
+    MSSpectrum is preserved through a proxy iterator which assembles Peak1D
+    values on the fly; hot loops should instead operate directly on the packed
+    arrays returned by getMZArray() and getIntensityArray().
+
+    Conversion from/to MSSpectrum is explicit (see SoASpectrum(const MSSpectrum&)
+    and toSpectrum()), so callers choose per use-case (or per experiment) which
+    layout to run on.
+
+    @ingroup Kernel
+  */
+  class OPENMS_DLLAPI SoASpectrum
+  {
+public:
+    ///@name Base type definitions
+    //@{
+    /// Peak type assembled by the proxy iterator
+    typedef Peak1D PeakType;
+    /// Coordinate (m/z) type
+    typedef PeakType::CoordinateType CoordinateType;
+    /// Intensity type
+    typedef PeakType::IntensityType IntensityType;
+    /// Packed m/z array type
+    typedef std::vector<CoordinateType> MZArrayType;
+    /// Packed intensity array type
+    typedef std::vector<IntensityType> IntensityArrayType;
+    //@}
+
+    /**
+      @brief Random access proxy iterator assembling Peak1D values from the packed arrays.
+
+      Dereferencing yields a Peak1D by value, which is sufficient for the
+      read-only peak loops found in most algorithms. Mutation has to go through
+      the packed arrays directly.
+    */
+    class ConstIterator
+    {
+public:
+      typedef std::random_access_iterator_tag iterator_category;
+      typedef Peak1D value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef Peak1D reference; // proxy: values are assembled on the fly
+      typedef void pointer;
+
+      ConstIterator() = default;
+      ConstIterator(const SoASpectrum* spec, Size index) : spec_(spec), index_(index) {}
+
+      Peak1D operator*() const
+      {
+        return Peak1D(Peak1D::PositionType(spec_->mz_[index_]), spec_->intensity_[index_]);
+      }
+      Peak1D operator[](difference_type n) const
+      {
+        return *(*this + n);
+      }
+
+      ConstIterator& operator++() { ++index_; return *this; }
+      ConstIterator operator++(int) { ConstIterator tmp(*this); ++index_; return tmp; }
+      ConstIterator& operator--() { --index_; return *this; }
+      ConstIterator operator--(int) { ConstIterator tmp(*this); --index_; return tmp; }
+      ConstIterator& operator+=(difference_type n) { index_ += n; return *this; }
+      ConstIterator& operator-=(difference_type n) { index_ -= n; return *this; }
+      ConstIterator operator+(difference_type n) const { return ConstIterator(spec_, index_ + n); }
+      ConstIterator operator-(difference_type n) const { return ConstIterator(spec_, index_ - n); }
+      difference_type operator-(const ConstIterator& rhs) const { return difference_type(index_) - difference_type(rhs.index_); }
+
+      bool operator==(const ConstIterator& rhs) const { return index_ == rhs.index_; }
+      bool operator!=(const ConstIterator& rhs) const { return index_ != rhs.index_; }
+      bool operator<(const ConstIterator& rhs) const { return index_ < rhs.index_; }
+      bool operator>(const ConstIterator& rhs) const { return index_ > rhs.index_; }
+      bool operator<=(const ConstIterator& rhs) const { return index_ <= rhs.index_; }
+      bool operator>=(const ConstIterator& rhs) const { return index_ >= rhs.index_; }
+
+private:
+      const SoASpectrum* spec_ = nullptr;
+      Size index_ = 0;
+    };
+
+    /// Constructor (empty spectrum)
+    SoASpectrum() = default;
+
+    /// Conversion from the interleaved MSSpectrum layout
+    explicit SoASpectrum(const MSSpectrum& spec);
+
+    /// Construct from already packed arrays (moved in); both arrays must have the same size
+    SoASpectrum(MZArrayType&& mz, IntensityArrayType&& intensity);
+
+    /// Convert back to the interleaved MSSpectrum layout (peak data only, no metadata)
+    MSSpectrum toSpectrum() const;
+
+    ///@name Container interface
+    //@{
+    Size size() const { return mz_.size(); }
+    bool empty() const { return mz_.empty(); }
+    void clear();
+    void reserve(Size n);
+    void push_back(CoordinateType mz, IntensityType intensity);
+    Peak1D operator[](Size i) const { return Peak1D(Peak1D::PositionType(mz_[i]), intensity_[i]); }
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, size()); }
+    ConstIterator cbegin() const { return begin(); }
+    ConstIterator cend() const { return end(); }
+    //@}
+
+    ///@name Packed array access (use these in hot loops)
+    //@{
+    const MZArrayType& getMZArray() const { return mz_; }
+    MZArrayType& getMZArray() { return mz_; }
+    const IntensityArrayType& getIntensityArray() const { return intensity_; }
+    IntensityArrayType& getIntensityArray() { return intensity_; }
+    //@}
+
+    ///@name Searching a peak or peak range (require m/z-sorted data)
+    //@{
+    /**
+      @brief Binary search for the peak nearest to a specific m/z
+
+      @note Make sure the spectrum is sorted with respect to m/z! Otherwise the result is undefined.
+      @exception Exception::Precondition is thrown if the spectrum is empty (not only in debug mode)
+    */
+    Size findNearest(CoordinateType mz) const;
+
+    /// Index of the first peak with an m/z not less than @p mz (binary search on the packed m/z array)
+    Size MZBegin(CoordinateType mz) const;
+
+    /// Index one past the last peak with an m/z not greater than @p mz (binary search on the packed m/z array)
+    Size MZEnd(CoordinateType mz) const;
+    //@}
+
+    /// Checks if all peaks are sorted with respect to ascending m/z
+    bool isSorted() const;
+
+    /// Equality operator
+    bool operator==(const SoASpectrum& rhs) const
+    {
+      return mz_ == rhs.mz_ && intensity_ == rhs.intensity_;
+    }
+
+    /// Equality operator
+    bool operator!=(const SoASpectrum& rhs) const
+    {
+      return !(operator==(rhs));
+    }
+
+protected:
+    /// Packed m/z values
+    MZArrayType mz_;
+    /// Packed intensities
+    IntensityArrayType intensity_;
+  };
+
+} // namespace OpenMS
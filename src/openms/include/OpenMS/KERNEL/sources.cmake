@@ -4,7 +4,9 @@ set(directory include/OpenMS/KERNEL)
 ### list all header files of the directory here
 set(sources_list_h
 AreaIterator.h
+AreaTileIndex.h
 BaseFeature.h
+ChromatogramBundle.h
 ChromatogramPeak.h
 ChromatogramTools.h
 ConsensusFeature.h
@@ -13,6 +15,7 @@ ConsensusMap.h
 ConversionHelper.h
 DimMapper.h
 DPeak.h
+ExperimentView.h
 Feature.h
 FeatureHandle.h
 FeatureMap.h
@@ -32,6 +35,7 @@ PeakIndex.h
 RangeManager.h
 RangeUtils.h
 RichPeak2D.h
+SoASpectrum.h
 StandardTypes.h
 StandardDeclarations.h
 SpectrumHelper.h
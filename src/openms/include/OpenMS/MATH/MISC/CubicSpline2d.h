@@ -27,10 +27,10 @@ namespace OpenMS
   class OPENMS_DLLAPI CubicSpline2d
   {
 
-    std::vector<double> a_; ///< constant spline coefficients
-    std::vector<double> b_; ///< linear spline coefficients
-    std::vector<double> c_; ///< quadratic spline coefficients
-    std::vector<double> d_; ///< cubic spline coefficients
+    /// packed polynomial coefficients: constant, linear, quadratic and cubic
+    /// coefficient of each spline segment stored contiguously (stride 4), so an
+    /// evaluation touches one cache line instead of four scattered vectors
+    std::vector<double> coeffs_;
     std::vector<double> x_; ///< knots
 
 public:
@@ -61,6 +61,20 @@ public:
      */
     double eval(double x) const;
 
+    /**
+     * @brief evaluates the spline at all positions in [x_begin, x_end)
+     *
+     * Batch version of eval() for positions sorted in ascending order. The
+     * spline segments are advanced monotonically along with the positions,
+     * i.e. no per-position binary search is needed, and the results are
+     * written to the range starting at @p y_begin.
+     *
+     * @param x_begin start of the x-positions (must be ascending and within the spline range)
+     * @param x_end end of the x-positions
+     * @param y_begin start of the output range (must provide space for all results)
+     */
+    void eval(std::vector<double>::const_iterator x_begin, std::vector<double>::const_iterator x_end, std::vector<double>::iterator y_begin) const;
+
     /**
      * @brief evaluates first derivative of spline at position x
      *
@@ -90,6 +90,26 @@ public:
       const double right_pos = 0.0
     ) const;
 
+    /**
+      @brief Fit the EMG peak model to a batch of peaks
+
+      Applies fitEMGPeakModel() to each element of @p input_peaks and stores
+      the reconstructed peaks at the corresponding positions of
+      @p output_peaks (which is resized accordingly). The individual fits are
+      independent of each other and are executed in parallel (OpenMP), which
+      is considerably cheaper than fitting peak by peak, e.g. for all
+      chromatograms of an MRM transition group.
+
+      @tparam PeakContainerT Either a MSChromatogram or a MSSpectrum
+      @param[in] input_peaks Input peaks
+      @param[out] output_peaks Output (reconstructed) peaks
+    */
+    template <typename PeakContainerT>
+    void fitEMGPeakModelBatch(
+      const std::vector<PeakContainerT>& input_peaks,
+      std::vector<PeakContainerT>& output_peaks
+    ) const;
+
     /**
       @brief The implementation of the gradient descent algorithm for the EMG peak model
 
@@ -347,6 +367,42 @@ private:
       const double tau
     ) const;
 
+    /**
+      @brief Compute the cost E and all its partial derivatives in a single pass
+
+      Evaluates the same per-point terms as Loss_function(), E_wrt_h(),
+      E_wrt_mu(), E_wrt_sigma() and E_wrt_tau(), but walks the training set
+      only once, sharing the branch selection on the `z` parameter and
+      avoiding the per-call buffer allocations of the individual methods.
+      This is the hot path of estimateEmgParameters(); the individual methods
+      remain in use for the per-point debug output (`print_debug == 2`).
+
+      @param[in] xs Positions
+      @param[in] ys Intensities
+      @param[in] h Amplitude
+      @param[in] mu Mean
+      @param[in] sigma Standard deviation
+      @param[in] tau Exponent relaxation time
+      @param[out] E The computed cost
+      @param[out] diff_E_h The partial derivative of E with respect to `h`
+      @param[out] diff_E_mu The partial derivative of E with respect to `mu`
+      @param[out] diff_E_sigma The partial derivative of E with respect to `sigma`
+      @param[out] diff_E_tau The partial derivative of E with respect to `tau`
+    */
+    void computeLossAndGradient_(
+      const std::vector<double>& xs,
+      const std::vector<double>& ys,
+      const double h,
+      const double mu,
+      const double sigma,
+      const double tau,
+      double& E,
+      double& diff_E_h,
+      double& diff_E_mu,
+      double& diff_E_sigma,
+      double& diff_E_tau
+    ) const;
+
     /**
       @brief Compute EMG's z parameter
 
@@ -0,0 +1,110 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/CONCEPT/Types.h>
+#include <OpenMS/OpenMSConfig.h>
+
+#include <random>
+#include <vector>
+
+namespace OpenMS
+{
+  namespace Math
+  {
+
+    /**
+        @brief Streaming quantile summary with bounded memory (KLL-style sketch)
+
+        Estimates quantiles and ranks of a stream of values without storing the
+        stream. Values are collected in a hierarchy of buffers: whenever a
+        buffer overflows it is sorted and every second element is promoted to
+        the next level with doubled weight, so memory stays at O(k) per level
+        while the rank error stays proportional to 1/k. As long as no
+        compaction has happened (streams of up to ~3k values), results are
+        exact.
+
+        The compaction offset is drawn from a fixed-seed generator, so the same
+        stream always yields the same summary.
+
+        @ingroup Math
+    */
+    class OPENMS_DLLAPI QuantileSketch
+    {
+public:
+      /// Constructor; @p k controls the accuracy/memory trade-off (rank error ~ 1/k)
+      explicit QuantileSketch(Size k = 200);
+
+      /// Add a value to the summary
+      void add(double value);
+
+      /// Number of values added so far
+      UInt64 count() const
+      {
+        return count_;
+      }
+
+      /// Smallest value added so far (exact; 0 if empty)
+      double minValue() const
+      {
+        return min_;
+      }
+
+      /// Largest value added so far (exact; 0 if empty)
+      double maxValue() const
+      {
+        return max_;
+      }
+
+      /**
+          @brief Estimate of the @p phi quantile (phi in [0, 1], clamped otherwise)
+
+          phi = 0 / phi = 1 return the exact minimum / maximum.
+      */
+      double quantile(double phi) const;
+
+      /// Estimated fraction of added values that are <= @p value (in [0, 1])
+      double cdf(double value) const;
+
+      /**
+          @brief Sorted snapshot of the summary for fast repeated queries
+
+          Returns the summarized values in ascending order together with the
+          cumulative weight fraction up to and including each value. Callers
+          that need many quantile or rank lookups (e.g. remapping a whole map
+          of intensities) can binary-search these arrays instead of paying the
+          collection cost per query.
+      */
+      void getCumulative(std::vector<double>& values, std::vector<double>& cumulative_fractions) const;
+
+private:
+      /// Size of a level buffer before it is compacted into the next level
+      Size levelCapacity_(Size level) const;
+
+      /// Compact overflowing levels until all buffers are within their capacity
+      void compress_();
+
+      /// Collect (value, weight) pairs of all levels, sorted by value
+      void collect_(std::vector<std::pair<double, UInt64>>& items) const;
+
+      /// Accuracy parameter
+      Size k_;
+      /// Level buffers; items of level l carry weight 2^l
+      std::vector<std::vector<double>> levels_;
+      /// Number of values added
+      UInt64 count_ = 0;
+      /// Exact minimum / maximum of the stream
+      double min_ = 0;
+      double max_ = 0;
+      /// Fixed-seed generator for the compaction offsets (deterministic results)
+      std::mt19937 rng_;
+    };
+
+  } // namespace Math
+} // namespace OpenMS
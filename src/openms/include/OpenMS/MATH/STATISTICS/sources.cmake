@@ -14,6 +14,7 @@ Histogram.h
 LinearRegression.h
 LinearRegressionWithoutIntercept.h
 QuadraticRegression.h
+QuantileSketch.h
 PosteriorErrorProbabilityModel.h
 ROCCurve.h
 StatisticFunctions.h
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include <OpenMS/CONCEPT/Types.h>
@@ -28,6 +29,14 @@ namespace OpenMS
     publicly inherit the MetaInfoInterface.  Meta information is an array of
     Type-Name-Value tuples.
 
+    The underlying MetaInfo object uses copy-on-write semantics: copying an
+    object (or a container of objects, e.g. a FeatureMap) shares the meta
+    information instead of deep-copying it; the actual copy is deferred until
+    one of the sharing objects is modified through this interface. Keys are
+    interned as integer indices via the MetaInfoRegistry. Objects sharing
+    their meta information may be read concurrently, but (as before) a single
+    object must not be modified while it is accessed from another thread.
+
     @ingroup Metadata
   */
 
@@ -104,11 +113,12 @@ public:
 
 protected:
 
-    /// Creates the MetaInfo object if it does not exist
+    /// Makes the MetaInfo object writable: creates it if it does not exist,
+    /// detaches (deep-copies) it if it is currently shared with copies of this object
     inline void createIfNotExists_();
 
-    /// Pointer to the MetaInfo object (0 by default)
-    MetaInfo* meta_;
+    /// Pointer to the MetaInfo object (null by default); shared between copies until one of them is modified
+    std::shared_ptr<MetaInfo> meta_;
   };
 
 } // namespace OpenMS
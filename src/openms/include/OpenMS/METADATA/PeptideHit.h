@@ -17,6 +17,8 @@
 #include <OpenMS/CHEMISTRY/AASequence.h>
 #include <OpenMS/METADATA/PeptideEvidence.h>
 
+#include <boost/container/small_vector.hpp>
+
 namespace OpenMS
 {
   /**
@@ -163,6 +165,12 @@ public:
       }
     };
 
+    /// Container for the peptide evidences of a PSM. A PSM maps to very few proteins
+    /// in almost all cases, so the first entries are stored inline, which avoids one
+    /// heap allocation per hit (of which there can be tens of millions after loading
+    /// a large identification file).
+    using PeptideEvidences = boost::container::small_vector<PeptideEvidence, 2>;
+
     /** @name Constructors and Assignment
     */
     //@{
@@ -219,9 +227,14 @@ public:
     void setCharge(Int charge);
 
     /// returns information on peptides (potentially) identified by this PSM
-    const std::vector<PeptideEvidence>& getPeptideEvidences() const;
+    const PeptideEvidences& getPeptideEvidences() const;
 
     /// set information on peptides (potentially) identified by this PSM
+    void setPeptideEvidences(const PeptideEvidences& peptide_evidences);
+
+    void setPeptideEvidences(PeptideEvidences&& peptide_evidences);
+
+    /// as above, from a std::vector (the elements are copied/moved over)
     void setPeptideEvidences(const std::vector<PeptideEvidence>& peptide_evidences);
 
     void setPeptideEvidences(std::vector<PeptideEvidence>&& peptide_evidences);
@@ -229,6 +242,8 @@ public:
     /// adds information on a peptide that is (potentially) identified by this PSM
     void addPeptideEvidence(const PeptideEvidence& peptide_evidence);
 
+    void addPeptideEvidence(PeptideEvidence&& peptide_evidence);
+
     /// returns the PSM score
     double getScore() const;
 
@@ -279,7 +294,7 @@ protected:
     Int charge_{};
 
     /// information on the potential peptides observed through this PSM.
-    std::vector<PeptideEvidence> peptide_evidences_;
+    PeptideEvidences peptide_evidences_;
 
     /// annotations of fragments in the corresponding spectrum
     std::vector<PeptideHit::PeakAnnotation> fragment_annotations_;
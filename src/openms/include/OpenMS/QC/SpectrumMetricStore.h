@@ -0,0 +1,115 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/QC/QCBase.h>
+
+#include <functional>
+#include <vector>
+
+namespace OpenMS
+{
+  class MSExperiment;
+  class MSSpectrum;
+
+  /**
+    @brief Per-spectrum QC metrics with a persistent sqlite-backed store
+
+    Collects a compact set of metrics for every spectrum (MS level, RT, TIC,
+    base peak, number of peaks). The metrics can be extracted from a full
+    MSExperiment using compute(), or on the fly while a file is being read, by
+    plugging getSpectrumFunc() into an MSDataTransformingConsumer -- this way
+    QC collection piggybacks on the initial file load and does not require the
+    raw data to be held in memory.
+
+    The collected metrics can be persisted to an sqlite database keyed by the
+    SHA1 hash of the raw file (see FileHandler::computeFileHash()). Subsequent
+    QC runs over the same (unmodified) raw file can then load() the precomputed
+    metrics instead of parsing the raw data again, and several raw files can
+    share one database for longitudinal queries.
+
+    **/
+  class OPENMS_DLLAPI SpectrumMetricStore : public QCBase
+  {
+  public:
+    /// compact per-spectrum summary; cheap to compute while streaming
+    struct OPENMS_DLLAPI SpectrumMetrics {
+      String native_id;           ///< native spectrum identifier
+      UInt ms_level = 0;          ///< MS level of the scan
+      double rt = 0;              ///< retention time in seconds
+      double tic = 0;             ///< summed peak intensity
+      double base_peak_mz = 0;    ///< m/z of the most intense peak (0 for empty spectra)
+      double base_peak_intensity = 0; ///< intensity of the most intense peak (0 for empty spectra)
+      UInt peak_count = 0;        ///< number of peaks in the spectrum
+
+      bool operator==(const SpectrumMetrics& rhs) const;
+    };
+
+    /// Constructor
+    SpectrumMetricStore() = default;
+
+    /// Destructor
+    virtual ~SpectrumMetricStore() = default;
+
+    /// extract metrics from a single spectrum and append them to the internal results
+    void addSpectrum(const MSSpectrum& spec);
+
+    /**
+      @brief Lambda suitable for MSDataTransformingConsumer::setSpectraProcessingFunc()
+
+      The spectrum is not modified. Make sure this object outlives the consumer.
+    **/
+    std::function<void(MSSpectrum&)> getSpectrumFunc();
+
+    /// extract metrics from all spectra of @p exp (convenience for the non-streaming case)
+    void compute(const MSExperiment& exp);
+
+    /// metrics collected so far, in order of observation (scan index)
+    const std::vector<SpectrumMetrics>& getResults() const;
+
+    /// discard all collected metrics
+    void clear();
+
+    /**
+      @brief Checks whether @p db_filename already holds metrics for a raw file with hash @p file_hash
+
+      Returns false if the database does not exist (yet).
+    **/
+    static bool contains(const String& db_filename, const String& file_hash);
+
+    /**
+      @brief Persist the collected metrics to @p db_filename (created if missing)
+
+      Metrics of a previous run with the same @p file_hash are replaced, i.e.
+      storing is idempotent per raw file. Other runs in the database are untouched,
+      so one database accumulates metrics across files incrementally.
+
+      @param db_filename sqlite database to write to
+      @param raw_filename name of the raw file the metrics were computed from (stored for bookkeeping)
+      @param file_hash SHA1 hash of the raw file, see FileHandler::computeFileHash()
+    **/
+    void store(const String& db_filename, const String& raw_filename, const String& file_hash) const;
+
+    /**
+      @brief Load previously stored metrics for @p file_hash, replacing the current results
+
+      @return true on success; false if the database or the run is not present (results are left empty then)
+    **/
+    bool load(const String& db_filename, const String& file_hash);
+
+    const String& getName() const override;
+
+    QCBase::Status requirements() const override;
+
+  private:
+    std::vector<SpectrumMetrics> metrics_;
+
+    const String name_ = "SpectrumMetricStore";
+  };
+} // namespace OpenMS
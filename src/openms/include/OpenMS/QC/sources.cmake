@@ -20,6 +20,7 @@ set(sources_list_h
   QCBase.h
   RTAlignment.h
   SpectrumCount.h
+  SpectrumMetricStore.h
   DBSuitability.h
   TIC.h
 )
@@ -0,0 +1,109 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/SYSTEM/ExternalProcess.h>
+
+#include <OpenMS/DATASTRUCTURES/String.h>
+
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+#include <functional> // for std::function
+#include <vector>
+
+namespace OpenMS
+{
+
+  /**
+    @brief Runs multiple external programs concurrently with bounded parallelism
+
+    Complements ExternalProcess (which runs one blocking child at a time): jobs are
+    enqueued up front and then executed by up to @p max_concurrent child processes
+    at once, so adapter tools can fan out independent invocations (e.g. one search
+    engine run per chunked input file) from a single OpenMS process.
+
+    While the children run, their stdout/stderr is drained continuously into
+    per-job buffers, so a chatty child never stalls on a full pipe; optional
+    callbacks additionally receive the output live, tagged with the job index.
+    Results (return state, exit code, captured output, wall time) are collected
+    in submission order, no matter in which order the children finish.
+
+    Like ExternalProcess, runAll() blocks the caller until all jobs are done, so
+    do not use this in a main GUI thread.
+
+  */
+  class OPENMS_DLLAPI ExternalProcessPool
+  {
+  public:
+    /// outcome and accounting of a single job
+    struct JobResult
+    {
+      ExternalProcess::RETURNSTATE state = ExternalProcess::RETURNSTATE::FAILED_TO_START; ///< did the job succeed?
+      int exit_code = -1; ///< exit code of the child (only meaningful if the child ran to completion)
+      String stdout_output; ///< everything the child wrote to stdout
+      String stderr_output; ///< everything the child wrote to stderr
+      String error_msg; ///< message to display to the user if state != SUCCESS
+      double wall_time_sec = 0.0; ///< wall time from start to exit of the child
+    };
+
+    /**
+      @brief Constructor
+
+      @param max_concurrent Maximum number of child processes running at the same time
+      @throws Exception::IllegalArgument if @p max_concurrent is 0
+    */
+    explicit ExternalProcessPool(Size max_concurrent = 1);
+
+    /// set callback functions which receive stdout/stderr output live as it is drained, together with the index of the job which produced it
+    void setCallbacks(std::function<void(Size, const String&)> callbackStdOut, std::function<void(Size, const String&)> callbackStdErr);
+
+    /**
+      @brief Adds a job to the queue (does not start it yet)
+
+      @param exe The program to call (can contain spaces in path, no problem)
+      @param args A list of extra arguments (can be empty)
+      @param working_dir Execute the job in the given directory. Leave empty to use the current working directory.
+      @return The index of the job (identifies its entry in getResults() and in the callbacks)
+    */
+    Size enqueue(const QString& exe, const QStringList& args, const QString& working_dir = QString());
+
+    /**
+      @brief Runs all enqueued jobs with bounded concurrency and blocks until the last one finished
+
+      @param verbose Report the call commands and errors via the callbacks (default: false)
+      @return One JobResult per job, in submission order (same as getResults())
+    */
+    const std::vector<JobResult>& runAll(bool verbose = false);
+
+    /// results of the last runAll() call, in submission order
+    const std::vector<JobResult>& getResults() const;
+
+    /// did all jobs of the last runAll() call return SUCCESS?
+    bool allSucceeded() const;
+
+    /// remove all jobs and results
+    void clear();
+
+  private:
+    /// a not-yet-started job
+    struct PendingJob_
+    {
+      QString exe;
+      QStringList args;
+      QString working_dir;
+    };
+
+    Size max_concurrent_;
+    std::vector<PendingJob_> jobs_;
+    std::vector<JobResult> results_;
+    std::function<void(Size, const String&)> callbackStdOut_;
+    std::function<void(Size, const String&)> callbackStdErr_;
+  };
+} // ns OpenMS
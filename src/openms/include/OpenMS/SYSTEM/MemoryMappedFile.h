@@ -0,0 +1,92 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/DATASTRUCTURES/String.h>
+
+#include <cstddef>
+
+namespace OpenMS
+{
+namespace Internal
+{
+
+  /**
+    @brief Read-only memory mapping of a file (RAII)
+
+    Maps a whole file into the address space of the current process, giving
+    random access to its content without per-access seek/read syscalls and
+    without copying the data into user-space buffers first. The mapping is
+    released in the destructor.
+
+    On platforms without memory mapping support, open() returns false and
+    callers are expected to fall back to regular stream-based I/O.
+  */
+  class OPENMS_DLLAPI MemoryMappedFile
+  {
+public:
+
+    /// Default constructor (no mapping)
+    MemoryMappedFile();
+
+    /// Destructor, unmaps the file
+    ~MemoryMappedFile();
+
+    // mappings cannot be shared
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    /**
+      @brief Map the given file read-only into memory
+
+      An existing mapping is released first.
+
+      @return true on success, false if the file could not be mapped (missing
+              file, empty file or platform without mmap support)
+    */
+    bool open(const String& filename);
+
+    /// Release the mapping (no-op if nothing is mapped)
+    void close();
+
+    /// Whether a file is currently mapped
+    bool isOpen() const
+    {
+      return data_ != nullptr;
+    }
+
+    /// Pointer to the first byte of the mapped file (nullptr if not mapped)
+    const char* data() const
+    {
+      return data_;
+    }
+
+    /// Size of the mapped file in bytes (0 if not mapped)
+    std::size_t size() const
+    {
+      return size_;
+    }
+
+protected:
+
+    /// Start of the mapped region
+    const char* data_ = nullptr;
+
+    /// Size of the mapped region
+    std::size_t size_ = 0;
+
+#ifdef OPENMS_WINDOWSPLATFORM
+    /// Handles needed to release the mapping again
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+  };
+
+} // namespace Internal
+} // namespace OpenMS
@@ -21,9 +21,11 @@ source_group("Source Files\\OpenMS\\SYSTEM" FILES ${sources})
 set(sources_list_h
 BuildInfo.h
 ExternalProcess.h
+ExternalProcessPool.h
 File.h
 FileWatcher.h
 JavaInfo.h
+MemoryMappedFile.h
 NetworkGetRequest.h
 PythonInfo.h
 RWrapper.h
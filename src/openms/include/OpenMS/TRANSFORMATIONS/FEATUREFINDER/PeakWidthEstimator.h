@@ -38,6 +38,24 @@ namespace OpenMS
     */
     PeakWidthEstimator(const PeakMap & exp_picked, const std::vector<std::vector<PeakPickerHiRes::PeakBoundary> > & boundaries);
 
+    /**
+    * @brief constructor estimating the spline from bucketed width sketches
+    *
+    * Instead of fitting the B-spline to every single peak, the m/z range is
+    * divided into @p mz_buckets equally wide buckets, each collecting a
+    * bounded-memory quantile sketch (Math::QuantileSketch) of the peak
+    * widths. The spline is then fitted to the median width per bucket. This
+    * keeps the memory footprint independent of the number of peaks and is
+    * the preferred mode for very large maps.
+    *
+    * @param exp_picked m/z positions of picked peaks
+    * @param boundaries corresponding peak widths
+    * @param mz_buckets number of m/z buckets (and thereby spline input points)
+    *
+    * @throw Exception::UnableToFit if no peaks are given or the B-spline initialisation fails.
+    */
+    PeakWidthEstimator(const PeakMap & exp_picked, const std::vector<std::vector<PeakPickerHiRes::PeakBoundary> > & boundaries, Size mz_buckets);
+
     /**
     * @brief returns the estimated peak width at m/z
     * 
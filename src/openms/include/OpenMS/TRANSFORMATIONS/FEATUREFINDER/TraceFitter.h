@@ -12,6 +12,9 @@
 #include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
 #include <OpenMS/KERNEL/Peak1D.h>
 
+#include <memory>
+#include <vector>
+
 // forward decl
 namespace Eigen
 {
@@ -75,6 +78,26 @@ protected:
      */
     virtual void fit(FeatureFinderAlgorithmPickedHelperStructs::MassTraces& traces) = 0;
 
+    /**
+     * @brief Fits one set of mass traces per fitter, in parallel (OpenMP)
+     *
+     * Exceptions must not leave a parallel region, so fit failures are
+     * reported per element instead of being thrown: after the call,
+     * @p fitters[i] holds the fitted model for @p traces_vec[i] if and only
+     * if the returned flag at position i is non-zero. Failed fitters are left
+     * in an unspecified state and should not be queried.
+     *
+     * The fitters act as reusable per-element workspaces: construct them once
+     * (e.g. by copying a configured prototype) and reuse them across batches.
+     *
+     * @param traces_vec One set of mass traces per fit
+     * @param fitters One configured fitter per element of @p traces_vec
+     * @return One flag per element: 1 if the fit converged, 0 if it failed with Exception::UnableToFit
+     * @throws Exception::IllegalArgument if the two vectors differ in size
+     */
+    static std::vector<char> fitBatch(std::vector<FeatureFinderAlgorithmPickedHelperStructs::MassTraces>& traces_vec,
+                                      std::vector<std::shared_ptr<TraceFitter>>& fitters);
+
     /**
      * Returns the lower bound of the fitted RT model
      */
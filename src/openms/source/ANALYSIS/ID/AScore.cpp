@@ -44,18 +44,52 @@ namespace OpenMS
   AScore::~AScore() = default;
 
   PeptideHit AScore::compute(const PeptideHit& hit, PeakSpectrum& real_spectrum)
+  {
+    if (!real_spectrum.empty() && !real_spectrum.isSorted())
+    {
+      real_spectrum.sortByPosition();
+    }
+    return computeHit_(hit, real_spectrum);
+  }
+
+  vector<PeptideHit> AScore::compute(const vector<PeptideHit>& hits, const vector<PeakSpectrum*>& real_spectra)
+  {
+    OPENMS_PRECONDITION(hits.size() == real_spectra.size(), "One spectrum (pointer) is required per peptide hit.");
+
+    // sort up front: several PSMs may share a spectrum and computeHit_ expects sorted input
+    for (PeakSpectrum* real_spectrum : real_spectra)
+    {
+      if (!real_spectrum->empty() && !real_spectrum->isSorted())
+      {
+        real_spectrum->sortByPosition();
+      }
+    }
+
+    vector<PeptideHit> scored_hits(hits.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (SignedSize i = 0; i < (SignedSize)hits.size(); ++i)
+    {
+      scored_hits[i] = computeHit_(hits[i], *real_spectra[i]);
+    }
+    return scored_hits;
+  }
+
+  PeptideHit AScore::computeHit_(const PeptideHit& hit, const PeakSpectrum& real_spectrum) const
   {
     PeptideHit phospho = hit;
-    
+
     //reset phospho
     phospho.setScore(-1);
     if (real_spectrum.empty())
     {
       return phospho;
     }
-    
+
     String sequence_str = phospho.getSequence().toString();
-    
+
     Size number_of_phosphorylation_events = numberOfPhosphoEvents_(sequence_str);
     AASequence seq_without_phospho = removePhosphositesFromSequence_(sequence_str);
 
@@ -77,13 +111,14 @@ namespace OpenMS
     {
       phospho.setScore(unambiguous_score_);
       return phospho;
-    } 
+    }
 
-    vector<vector<Size>> permutations = computePermutations_(sites, (Int)number_of_phosphorylation_events);
+    const PermutationSpectra_& table = permutationSpectra_(seq_without_phospho, sites, number_of_phosphorylation_events);
+    const vector<vector<Size>>& permutations = table.permutations;
     OPENMS_LOG_DEBUG << "\tnumber of permutations: " << permutations.size() << std::endl;
 
     // TODO: using a heuristic to calculate the best phospho sites if the number of permutations are exceeding the maximum.
-    // A heuristic could be to calculate the best site for the first phosphorylation and based on this the best site for the second 
+    // A heuristic could be to calculate the best site for the first phosphorylation and based on this the best site for the second
     // phosphorylation and so on until every site is determined
     if ((max_permutations_ > 0) && (permutations.size() > max_permutations_))
     {
@@ -91,20 +126,16 @@ namespace OpenMS
       return phospho;
     }
 
-    vector<PeakSpectrum> th_spectra = createTheoreticalSpectra_(permutations, seq_without_phospho);
+    const vector<PeakSpectrum>& th_spectra = table.th_spectra;
 
     // prepare real spectrum windows
-    if (!real_spectrum.isSorted())
-    {
-      real_spectrum.sortByPosition();
-    }
     vector<PeakSpectrum> windows_top10 = peakPickingPerWindowsInSpectrum_(real_spectrum);
 
     // compute match probability for a peak depth of 1
-    base_match_probability_ = computeBaseProbability_(real_spectrum.back().getMZ());
+    double base_match_probability = computeBaseProbability_(real_spectrum.back().getMZ());
 
     // calculate peptide score for each possible phospho site permutation
-    vector<vector<double>> peptide_site_scores = calculatePermutationPeptideScores_(th_spectra, windows_top10);
+    vector<vector<double>> peptide_site_scores = calculatePermutationPeptideScores_(th_spectra, windows_top10, base_match_probability);
 
     // rank peptide permutations ascending
     multimap<double, Size> ranking = rankWeightedPermutationPeptideScores_(peptide_site_scores);
@@ -139,7 +170,7 @@ namespace OpenMS
 
         computeSiteDeterminingIons_(th_spectra, *s_it, site_determining_ions);
         Size N = site_determining_ions[0].size(); // all possibilities have the same number so take the first one
-        double p = static_cast<double>(s_it->peak_depth) * base_match_probability_;
+        double p = static_cast<double>(s_it->peak_depth) * base_match_probability;
 
         Size n_first = 0; // number of matching peaks for first peptide
         for (Size window_idx = 0; window_idx != windows_top10.size(); ++window_idx) // for each 100 m/z window
@@ -501,18 +532,39 @@ namespace OpenMS
     }
     return th_spectra;
   }
-    
-  std::vector<PeakSpectrum> AScore::peakPickingPerWindowsInSpectrum_(PeakSpectrum& real_spectrum) const
+
+  const AScore::PermutationSpectra_& AScore::permutationSpectra_(const AASequence& seq_without_phospho, const vector<Size>& sites, Size number_of_phosphorylation_events) const
+  {
+    pair<String, Size> key(seq_without_phospho.toString(), number_of_phosphorylation_events);
+
+    std::lock_guard<std::mutex> lock(permutation_cache_mutex_);
+    map<pair<String, Size>, PermutationSpectra_>::iterator it = permutation_cache_.find(key);
+    if (it == permutation_cache_.end())
+    {
+      PermutationSpectra_ entry;
+      entry.permutations = computePermutations_(sites, (Int)number_of_phosphorylation_events);
+      // only expand permutation sets below the configured limit into theoretical spectra
+      if ((max_permutations_ == 0) || (entry.permutations.size() <= max_permutations_))
+      {
+        entry.th_spectra = createTheoreticalSpectra_(entry.permutations, seq_without_phospho);
+      }
+      it = permutation_cache_.emplace(std::move(key), std::move(entry)).first;
+    }
+    return it->second; // map nodes are stable, so the reference survives later insertions
+  }
+
+
+  std::vector<PeakSpectrum> AScore::peakPickingPerWindowsInSpectrum_(const PeakSpectrum& real_spectrum) const
   {
     vector<PeakSpectrum> windows_top10;
-    
+
     double spect_lower_bound = floor(real_spectrum.front().getMZ() / 100) * 100;
     double spect_upper_bound = ceil(real_spectrum.back().getMZ() / 100) * 100;
-    
+
     Size number_of_windows = static_cast<Size>(ceil((spect_upper_bound - spect_lower_bound) / 100));
     windows_top10.resize(number_of_windows);
-    
-    PeakSpectrum::Iterator it_current_peak = real_spectrum.begin();
+
+    PeakSpectrum::ConstIterator it_current_peak = real_spectrum.begin();
     Size window_upper_bound(spect_lower_bound + 100);
     
     for (Size current_window = 0; current_window < number_of_windows; ++current_window)
@@ -535,14 +587,14 @@ namespace OpenMS
     return windows_top10;
   }
   
-  std::vector<std::vector<double>> AScore::calculatePermutationPeptideScores_(vector<PeakSpectrum>& th_spectra, const vector<PeakSpectrum>& windows_top10) const
+  std::vector<std::vector<double>> AScore::calculatePermutationPeptideScores_(const vector<PeakSpectrum>& th_spectra, const vector<PeakSpectrum>& windows_top10, double base_match_probability) const
   {
     //prepare peak depth for all windows in the actual spectrum
     vector<vector<double>> permutation_peptide_scores(th_spectra.size());
     vector<vector<double>>::iterator site_score = permutation_peptide_scores.begin();
-    
+
     // for each phospho site assignment
-    for (vector<PeakSpectrum>::iterator it = th_spectra.begin(); it != th_spectra.end(); ++it, ++site_score)
+    for (vector<PeakSpectrum>::const_iterator it = th_spectra.begin(); it != th_spectra.end(); ++it, ++site_score)
     {
       // the number of theoretical peaks (all b- and y-ions) correspond to the number of trials N
       Size N = it->size();
@@ -554,7 +606,7 @@ namespace OpenMS
         {
           n += numberOfMatchedIons_(*it, windows_top10[current_win], i);
         }
-        double p = static_cast<double>(i) * base_match_probability_;
+        double p = static_cast<double>(i) * base_match_probability;
         double cumulative_score = computeCumulativeScore_(N, n, p);
 
         //abs is used to avoid -0 score values
@@ -609,6 +661,10 @@ namespace OpenMS
     max_peptide_length_ = param_.getValue("max_peptide_length");
     max_permutations_ = param_.getValue("max_num_perm");
     unambiguous_score_ = param_.getValue("unambiguous_score");
+
+    // 'max_num_perm' decides which permutation sets get expanded into spectra, so drop the memoized entries
+    std::lock_guard<std::mutex> lock(permutation_cache_mutex_);
+    permutation_cache_.clear();
   }
   
 } // namespace OpenMS
@@ -612,19 +612,28 @@ namespace OpenMS
     step_ref = id.registerProcessingStep(step, search_param_ref);
     id.setCurrentProcessingStep(step_ref); // add the new step
 
+    // query all features in one parallel pass; the database is read-only after init()
+    QueryResultsTable feature_results(fmap.size());
+    Size dummy_count(0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(+ : dummy_count)
+#endif
+    for (SignedSize i = 0; i < (SignedSize)fmap.size(); ++i)
+    {
+      feature_results[i] = extractQueryResults_(fmap[i], i, ion_mode_internal, dummy_count);
+    }
+
     // map for storing overall results
     QueryResultsTable overall_results;
-    Size dummy_count(0);
     for (Size i = 0; i < fmap.size(); ++i)
     {
-      std::vector<AccurateMassSearchResult> query_results = extractQueryResults_(fmap[i], i, ion_mode_internal, dummy_count);
-      if (query_results.empty())
+      if (feature_results[i].empty())
       {
         continue;
       }
-      overall_results.push_back(query_results);
+      overall_results.push_back(feature_results[i]);
 
-      addMatchesToID_(id, query_results, file_ref, mass_error_ppm_score_ref, mass_error_Da_score_ref, step_ref, fmap[i]); // MztabM
+      addMatchesToID_(id, feature_results[i], file_ref, mass_error_ppm_score_ref, mass_error_Da_score_ref, step_ref, fmap[i]); // MztabM
     }
 
     // filter FeatureMap to only have entries with an PrimaryID attached
@@ -677,19 +686,28 @@ namespace OpenMS
       file_locations.emplace_back(ms_run_paths[0]);
     }
 
+    // query all features in one parallel pass; the database is read-only after init()
+    QueryResultsTable feature_results(fmap.size());
+    Size dummy_count(0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(+ : dummy_count)
+#endif
+    for (SignedSize i = 0; i < (SignedSize)fmap.size(); ++i)
+    {
+      feature_results[i] = extractQueryResults_(fmap[i], i, ion_mode_internal, dummy_count);
+    }
+
     // map for storing overall results
     QueryResultsTable overall_results;
-    Size dummy_count(0);
     for (Size i = 0; i < fmap.size(); ++i)
     {
-      std::vector<AccurateMassSearchResult> query_results = extractQueryResults_(fmap[i], i, ion_mode_internal, dummy_count);
-      if (query_results.empty())
+      if (feature_results[i].empty())
       {
         continue;
       }
-      overall_results.push_back(query_results);
+      overall_results.push_back(feature_results[i]);
 
-      annotate_(query_results, fmap[i]);
+      annotate_(feature_results[i], fmap[i]);
     }
 
     // filter FeatureMap to only have entries with an identification
@@ -858,13 +876,17 @@ namespace OpenMS
     }
 
     // map for storing overall results
-    QueryResultsTable overall_results;
+    QueryResultsTable overall_results(cmap.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (SignedSize i = 0; i < (SignedSize)cmap.size(); ++i)
+    {
+      queryByConsensusFeature(cmap[i], i, num_of_maps, ion_mode_internal, overall_results[i]);
+    }
     for (Size i = 0; i < cmap.size(); ++i)
     {
-      std::vector<AccurateMassSearchResult> query_results;
-      queryByConsensusFeature(cmap[i], i, num_of_maps, ion_mode_internal, query_results);
-      annotate_(query_results, cmap[i]);
-      overall_results.push_back(query_results);
+      annotate_(overall_results[i], cmap[i]);
     }
     // add dummy protein identification which is required to keep peptidehits alive during store()
     cmap.getProteinIdentifications().resize(cmap.getProteinIdentifications().size() + 1);
@@ -1343,6 +1365,13 @@ namespace OpenMS
     }
     std::sort(mass_mappings_.begin(), mass_mappings_.end(), CompareEntryAndMass_());
 
+    mass_flat_.clear();
+    mass_flat_.reserve(mass_mappings_.size());
+    for (const MappingEntry_& entry : mass_mappings_)
+    {
+      mass_flat_.push_back(entry.mass);
+    }
+
     OPENMS_LOG_INFO << "Read " << mass_mappings_.size() << " entries from mapping file!" << std::endl;
 
     return;
@@ -1428,11 +1457,12 @@ namespace OpenMS
       throw Exception::InvalidValue(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "There are no entries found in mass-to-ids mapping file! Aborting... ", "0");
     }
 
-    std::vector<MappingEntry_>::const_iterator lower_it = std::lower_bound(mass_mappings_.begin(), mass_mappings_.end(), neutral_query_mass - diff_mass, CompareEntryAndMass_()); // first element equal or larger
-    std::vector<MappingEntry_>::const_iterator upper_it = std::upper_bound(mass_mappings_.begin(), mass_mappings_.end(), neutral_query_mass + diff_mass, CompareEntryAndMass_()); // first element greater than
+    // search the flat copy of the sorted masses; the full entries are only touched for actual hits
+    std::vector<double>::const_iterator lower_it = std::lower_bound(mass_flat_.begin(), mass_flat_.end(), neutral_query_mass - diff_mass); // first element equal or larger
+    std::vector<double>::const_iterator upper_it = std::upper_bound(mass_flat_.begin(), mass_flat_.end(), neutral_query_mass + diff_mass); // first element greater than
 
-    Size start_idx = std::distance(mass_mappings_.begin(), lower_it);
-    Size end_idx = std::distance(mass_mappings_.begin(), upper_it);
+    Size start_idx = std::distance(mass_flat_.begin(), lower_it);
+    Size end_idx = std::distance(mass_flat_.begin(), upper_it);
 
     hit_indices.first = start_idx;
     hit_indices.second = end_idx;
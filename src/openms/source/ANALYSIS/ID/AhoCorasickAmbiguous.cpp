@@ -12,7 +12,10 @@
 #include <OpenMS/CONCEPT/LogStream.h>
 
 #include <cassert>
+#include <cstring>
+#include <fstream>
 #include <queue>
+#include <type_traits>
 
 namespace OpenMS
 {
@@ -161,6 +164,146 @@ namespace OpenMS
     umap_index2children_naive_.clear(); // not needed anymore
   }
 
+  namespace
+  {
+    // binary format of ACTrie::store()/load(); bump when the layout changes
+    constexpr const char ACTRIE_MAGIC[8] = {'O', 'M', 'S', 'A', 'C', 'T', 'R', '1'};
+    constexpr const uint32_t ACTRIE_ENDIAN_GUARD = 0x01020304;
+
+    template<typename T>
+    void writePOD(std::ostream& os, const T& value)
+    {
+      static_assert(std::is_trivially_copyable_v<T>);
+      os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    void readPOD(std::istream& is, T& value)
+    {
+      static_assert(std::is_trivially_copyable_v<T>);
+      is.read(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+
+    void writeString(std::ostream& os, const std::string& s)
+    {
+      writePOD(os, uint64_t(s.size()));
+      os.write(s.data(), std::streamsize(s.size()));
+    }
+
+    std::string readString(std::istream& is)
+    {
+      uint64_t size {0};
+      readPOD(is, size);
+      std::string s(size, '\0');
+      is.read(s.data(), std::streamsize(size));
+      return s;
+    }
+  }
+
+  void ACTrie::store(const String& filename, const String& source_checksum) const
+  {
+    static_assert(std::is_trivially_copyable_v<ACNode>);
+    if (trie_.size() <= 1 || !umap_index2children_naive_.empty())
+    {
+      throw Exception::Precondition(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+          "Only a non-empty, compressed trie can be stored. Call compressTrie() first.");
+    }
+
+    std::ofstream os(filename.c_str(), std::ios::binary);
+    if (!os)
+    {
+      throw Exception::UnableToCreateFile(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename);
+    }
+
+    os.write(ACTRIE_MAGIC, sizeof(ACTRIE_MAGIC));
+    writePOD(os, ACTRIE_ENDIAN_GUARD);       // detects foreign byte order on load
+    writePOD(os, uint32_t(sizeof(ACNode)));  // detects foreign struct layout/packing on load
+    writeString(os, source_checksum);
+    writePOD(os, needle_count_);
+
+    // the node array as one contiguous block
+    writePOD(os, uint64_t(trie_.size()));
+    os.write(reinterpret_cast<const char*>(trie_.data()), std::streamsize(trie_.size() * sizeof(ACNode)));
+
+    // node index --> needle indices
+    writePOD(os, uint64_t(umap_index2needles_.size()));
+    for (const auto& [node, needles] : umap_index2needles_)
+    {
+      writePOD(os, node());
+      writePOD(os, uint64_t(needles.size()));
+      os.write(reinterpret_cast<const char*>(needles.data()), std::streamsize(needles.size() * sizeof(uint32_t)));
+    }
+
+    if (!os)
+    {
+      throw Exception::UnableToCreateFile(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename);
+    }
+  }
+
+  bool ACTrie::load(const String& filename, const String& expected_source_checksum)
+  {
+    std::ifstream is(filename.c_str(), std::ios::binary);
+    if (!is)
+    {
+      throw Exception::FileNotFound(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename);
+    }
+
+    char magic[sizeof(ACTRIE_MAGIC)] = {0};
+    is.read(magic, sizeof(magic));
+    if (!is || memcmp(magic, ACTRIE_MAGIC, sizeof(magic)) != 0)
+    {
+      throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename,
+          "Not an ACTrie cache file (or written by an incompatible OpenMS version).");
+    }
+    uint32_t endian_guard {0}, node_size {0};
+    readPOD(is, endian_guard);
+    readPOD(is, node_size);
+    if (endian_guard != ACTRIE_ENDIAN_GUARD || node_size != sizeof(ACNode))
+    {
+      throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename,
+          "ACTrie cache file was written on an incompatible platform.");
+    }
+
+    if (readString(is) != expected_source_checksum)
+    {
+      return false; // stale cache; the caller needs to rebuild
+    }
+
+    uint32_t needle_count {0};
+    readPOD(is, needle_count);
+    uint64_t node_count {0};
+    readPOD(is, node_count);
+    std::vector<ACNode> nodes(node_count);
+    is.read(reinterpret_cast<char*>(nodes.data()), std::streamsize(node_count * sizeof(ACNode)));
+
+    uint64_t map_size {0};
+    readPOD(is, map_size);
+    decltype(umap_index2needles_) index2needles;
+    index2needles.reserve(map_size);
+    for (uint64_t i = 0; i < map_size; ++i)
+    {
+      Index::T node {0};
+      uint64_t nr_needles {0};
+      readPOD(is, node);
+      readPOD(is, nr_needles);
+      std::vector<uint32_t> needles(nr_needles);
+      is.read(reinterpret_cast<char*>(needles.data()), std::streamsize(nr_needles * sizeof(uint32_t)));
+      index2needles[node] = std::move(needles);
+    }
+
+    if (!is || node_count == 0)
+    {
+      throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename,
+          "ACTrie cache file is truncated or corrupt.");
+    }
+
+    trie_ = std::move(nodes);
+    umap_index2needles_ = std::move(index2needles);
+    umap_index2children_naive_.clear();
+    needle_count_ = needle_count;
+    return true;
+  }
+
   size_t ACTrie::getNeedleCount() const
   {
     return needle_count_;
@@ -8,6 +8,8 @@
 
 #include <OpenMS/ANALYSIS/ID/ConsensusIDAlgorithmPEPMatrix.h>
 
+#include <set>
+
 using namespace std;
 
 namespace OpenMS
@@ -44,30 +46,172 @@ namespace OpenMS
       throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
                                        msg);
     }
-    // new parameters may affect the similarity calculation, so clear cache:
+    // new parameters may affect the similarity calculation, so clear caches:
     similarities_.clear();
+    self_scores_.clear();
+  }
+
+  void ConsensusIDAlgorithmPEPMatrix::prepareSimilarities_(
+    const vector<PeptideIdentification>& ids)
+  {
+    // collect the unique sequences of this group:
+    map<AASequence, Size> seq_indexes;
+    vector<AASequence> sequences;
+    for (const PeptideIdentification& id : ids)
+    {
+      for (const PeptideHit& hit : id.getHits())
+      {
+        if (seq_indexes.emplace(hit.getSequence(), sequences.size()).second)
+        {
+          sequences.push_back(hit.getSequence());
+        }
+      }
+    }
+    vector<String> unmod_seqs(sequences.size());
+    for (Size i = 0; i < sequences.size(); ++i)
+    {
+      unmod_seqs[i] = sequences[i].toUnmodifiedString();
+    }
+
+    // which cross-run sequence pairs are not in the cache yet?
+    set<pair<Size, Size> > seen_pairs;
+    vector<pair<Size, Size> > todo; // pairs that need an alignment
+    for (Size run1 = 0; run1 < ids.size(); ++run1)
+    {
+      for (Size run2 = run1 + 1; run2 < ids.size(); ++run2)
+      {
+        for (const PeptideHit& hit1 : ids[run1].getHits())
+        {
+          for (const PeptideHit& hit2 : ids[run2].getHits())
+          {
+            Size i = seq_indexes[hit1.getSequence()];
+            Size j = seq_indexes[hit2.getSequence()];
+            if (i == j) continue;
+            // order of sequences matters for cache look-up:
+            if (sequences[j] < sequences[i]) swap(i, j);
+            if (!seen_pairs.insert(make_pair(i, j)).second) continue;
+            pair<AASequence, AASequence> seq_pair =
+              make_pair(sequences[i], sequences[j]);
+            if (similarities_.find(seq_pair) != similarities_.end()) continue;
+            if (unmod_seqs[i] == unmod_seqs[j]) // no modifications considered
+            {
+              similarities_[seq_pair] = 1.0;
+              continue;
+            }
+            todo.push_back(make_pair(i, j));
+          }
+        }
+      }
+    }
+    if (todo.empty()) return;
+
+    // self-alignment scores (for normalization) of sequences not seen before:
+    set<String> missing_selfs;
+    for (const pair<Size, Size>& indexes : todo)
+    {
+      for (Size i : {indexes.first, indexes.second})
+      {
+        if (self_scores_.find(unmod_seqs[i]) == self_scores_.end())
+        {
+          missing_selfs.insert(unmod_seqs[i]);
+        }
+      }
+    }
+    vector<String> new_selfs(missing_selfs.begin(), missing_selfs.end());
+    vector<double> new_self_scores(new_selfs.size());
+#pragma omp parallel
+    {
+      // thread-local aligner, as "align" reuses internal buffers:
+      NeedlemanWunsch aligner = alignment_;
+#pragma omp for schedule(dynamic)
+      for (SignedSize k = 0; k < (SignedSize)new_selfs.size(); ++k)
+      {
+        new_self_scores[k] = aligner.align(new_selfs[k], new_selfs[k]);
+      }
+    }
+    for (Size k = 0; k < new_selfs.size(); ++k)
+    {
+      self_scores_[new_selfs[k]] = new_self_scores[k];
+    }
+    // per-index look-up table, so the parallel loop below only reads vectors:
+    vector<double> self_scores(sequences.size());
+    for (Size i = 0; i < sequences.size(); ++i)
+    {
+      map<String, double>::iterator pos = self_scores_.find(unmod_seqs[i]);
+      if (pos != self_scores_.end()) self_scores[i] = pos->second;
+    }
+
+    // align all new pairs in parallel:
+    vector<double> pair_scores(todo.size());
+#pragma omp parallel
+    {
+      NeedlemanWunsch aligner = alignment_;
+#pragma omp for schedule(dynamic)
+      for (SignedSize k = 0; k < (SignedSize)todo.size(); ++k)
+      {
+        Size i = todo[k].first, j = todo[k].second;
+        double score_sim = aligner.align(unmod_seqs[i], unmod_seqs[j]);
+        if (score_sim < 0)
+        {
+          score_sim = 0;
+        }
+        else
+        {
+          score_sim /= min(self_scores[i], self_scores[j]); // normalize
+        }
+        pair_scores[k] = score_sim;
+      }
+    }
+    // single-threaded merge into the cache; getSimilarity_() then only
+    // performs look-ups for this group:
+    for (Size k = 0; k < todo.size(); ++k)
+    {
+      similarities_[make_pair(sequences[todo[k].first],
+                              sequences[todo[k].second])] = pair_scores[k];
+    }
+  }
+
+  double ConsensusIDAlgorithmPEPMatrix::selfScore_(const String& unmod_seq)
+  {
+    map<String, double>::iterator pos = self_scores_.find(unmod_seq);
+    if (pos == self_scores_.end())
+    {
+      pos = self_scores_.insert(
+        make_pair(unmod_seq, double(alignment_.align(unmod_seq,
+                                                     unmod_seq)))).first;
+    }
+    return pos->second;
   }
 
   double ConsensusIDAlgorithmPEPMatrix::getSimilarity_(AASequence seq1,
                                                        AASequence seq2)
   {
+    if (seq1 == seq2) return 1.0;
+    // order of sequences matters for cache look-up:
+    if (seq2 < seq1) swap(seq1, seq2);
+    pair<AASequence, AASequence> seq_pair = make_pair(seq1, seq2);
+    SimilarityCache::iterator pos = similarities_.find(seq_pair);
+    if (pos != similarities_.end()) return pos->second; // score found in cache
+
+    // not covered by prepareSimilarities_() - compute and cache:
     // here we cannot take modifications into account:
     String unmod_seq1 = seq1.toUnmodifiedString();
     String unmod_seq2 = seq2.toUnmodifiedString();
-    if (unmod_seq1 == unmod_seq2) return 1.0;
-
-    double score_sim = alignment_.align(unmod_seq1, unmod_seq2);
-
-    if (score_sim < 0)
-    {
-      score_sim = 0;
-    }
-    else
+    double score_sim = 1.0;
+    if (unmod_seq1 != unmod_seq2)
     {
-      double score_self1 = alignment_.align(unmod_seq1, unmod_seq1);
-      double score_self2 = alignment_.align(unmod_seq2, unmod_seq2);
-      score_sim /= min(score_self1, score_self2); // normalize
+      score_sim = alignment_.align(unmod_seq1, unmod_seq2);
+      if (score_sim < 0)
+      {
+        score_sim = 0;
+      }
+      else
+      {
+        score_sim /= min(selfScore_(unmod_seq1),
+                         selfScore_(unmod_seq2)); // normalize
+      }
     }
+    similarities_[seq_pair] = score_sim;
     return score_sim;
   }
 
@@ -19,6 +19,13 @@ namespace OpenMS
   }
 
 
+  void ConsensusIDAlgorithmSimilarity::prepareSimilarities_(
+    const vector<PeptideIdentification>& /* ids */)
+  {
+    // no batch computation by default - subclasses may override
+  }
+
+
   void ConsensusIDAlgorithmSimilarity::apply_(
     vector<PeptideIdentification>& ids,
     const map<String, String>& se_info,
@@ -37,6 +44,9 @@ namespace OpenMS
       }
     }
 
+    // give subclasses a chance to fill the similarity cache in one go:
+    prepareSimilarities_(ids);
+
     for (vector<PeptideIdentification>::iterator id1 = ids.begin();
          id1 != ids.end(); ++id1)
     {
@@ -9,6 +9,7 @@
 #include <OpenMS/ANALYSIS/ID/ConsensusMapMergerAlgorithm.h>
 
 #include <OpenMS/CONCEPT/LogStream.h>
+#include <OpenMS/FORMAT/ConsensusXMLFile.h>
 #include <OpenMS/METADATA/PeptideIdentification.h>
 #include <unordered_map>
 
@@ -282,6 +283,48 @@ namespace OpenMS
     cmap.setProteinIdentifications(std::move(new_prot_ids));
   }
 
+  void ConsensusMapMergerAlgorithm::mergeConsensusMaps(const StringList& in_files, const String& out_file) const
+  {
+    if (in_files.empty())
+    {
+      throw Exception::MissingInformation(
+          __FILE__,
+          __LINE__,
+          OPENMS_PRETTY_FUNCTION,
+          "No input files given for merging.");
+    }
+
+    ConsensusXMLFile cxml;
+    ConsensusMap out;
+
+    // Load the inputs one after another and move their columns into the output map.
+    // This bounds peak memory to the output plus the currently loaded input, instead of
+    // the whole cohort at once.
+    startProgress(0, in_files.size(), "merging consensusXML files");
+    for (Size i = 0; i < in_files.size(); ++i)
+    {
+      if (i == 0)
+      {
+        cxml.load(in_files[i], out);
+      }
+      else
+      {
+        ConsensusMap tmp;
+        cxml.load(in_files[i], tmp);
+        out.appendColumns(tmp);
+      }
+      setProgress(i + 1);
+    }
+    endProgress();
+
+    // sort by (RT, m/z) so downstream tools can sweep the result with a bounded RT window
+    out.sortByPosition();
+    out.updateRanges();
+    out.ensureUniqueId(); // appendColumns() resets the map's own unique id
+
+    cxml.store(out_file, out);
+  }
+
   //merge proteins across fractions and replicates
   void ConsensusMapMergerAlgorithm::mergeAllIDRuns(ConsensusMap& cmap) const
   {
@@ -17,6 +17,7 @@
 #include <OpenMS/METADATA/ProteinIdentification.h>
 
 #include <algorithm>
+#include <functional>
 
 // #define FALSE_DISCOVERY_RATE_DEBUG
 // #undef  FALSE_DISCOVERY_RATE_DEBUG
@@ -732,26 +733,39 @@ namespace OpenMS
   void FalseDiscoveryRate::calculateFDRs_(map<double, double>& score_to_fdr, vector<double>& target_scores, vector<double>& decoy_scores, bool q_value, bool higher_score_better) const
   {
     Size number_of_target_scores = target_scores.size();
-    // sort the scores
-    if (higher_score_better && !q_value)
-    {
-      sort(target_scores.rbegin(), target_scores.rend());
-      sort(decoy_scores.rbegin(), decoy_scores.rend());
-    }
-    else if (!higher_score_better && !q_value)
-    {
-      sort(target_scores.begin(), target_scores.end());
-      sort(decoy_scores.begin(), decoy_scores.end());
-    }
-    else if (higher_score_better)
-    {
-      sort(target_scores.begin(), target_scores.end());
-      sort(decoy_scores.rbegin(), decoy_scores.rend());
-    }
-    else
+    // sort the scores; target scores ascending iff (higher_score_better == q_value),
+    // decoy scores ascending iff (!higher_score_better). The two sorts are independent
+    // and dominate the runtime for millions of PSMs, so run them concurrently.
+#ifdef _OPENMP
+#pragma omp parallel sections
+#endif
     {
-      sort(target_scores.rbegin(), target_scores.rend());
-      sort(decoy_scores.begin(), decoy_scores.end());
+#ifdef _OPENMP
+#pragma omp section
+#endif
+      {
+        if (higher_score_better == q_value)
+        {
+          sort(target_scores.begin(), target_scores.end());
+        }
+        else
+        {
+          sort(target_scores.rbegin(), target_scores.rend());
+        }
+      }
+#ifdef _OPENMP
+#pragma omp section
+#endif
+      {
+        if (!higher_score_better)
+        {
+          sort(decoy_scores.begin(), decoy_scores.end());
+        }
+        else
+        {
+          sort(decoy_scores.rbegin(), decoy_scores.rend());
+        }
+      }
     }
 
     Size j = 0;
@@ -843,13 +857,29 @@ namespace OpenMS
     {
       const double& ds = decoy_scores[i];
 
-      // advance target index until score is better than decoy score
+      // find the first target score which is better than the decoy score;
+      // a linear scan here is quadratic overall, so exploit the sorting instead
       size_t k{0};
-      while (k != target_scores.size() &&
-             ((target_scores[k] <= ds && higher_score_better) ||
-              (target_scores[k] >= ds && !higher_score_better)))
-      {
-        ++k;
+      if (q_value)
+      { // target scores are sorted ascending (higher_score_better) or descending (else)
+        if (higher_score_better)
+        {
+          k = upper_bound(target_scores.begin(), target_scores.end(), ds) - target_scores.begin();
+        }
+        else
+        {
+          k = upper_bound(target_scores.begin(), target_scores.end(), ds, greater<double>()) - target_scores.begin();
+        }
+      }
+      else
+      { // target scores are sorted in the opposite direction, so scores not better
+        // than ds form a suffix: the scan stops at the very first target or runs through
+        if (!target_scores.empty() &&
+            ((higher_score_better && target_scores[0] <= ds) ||
+             (!higher_score_better && target_scores[0] >= ds)))
+        {
+          k = target_scores.size();
+        }
       }
 
       // corner cases
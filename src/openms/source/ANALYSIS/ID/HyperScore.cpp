@@ -11,7 +11,9 @@
 #include <OpenMS/KERNEL/MSSpectrum.h>
 #include <OpenMS/DATASTRUCTURES/MatchedIterator.h>
 #include <OpenMS/DATASTRUCTURES/StringUtils.h>
+#include <OpenMS/MATH/MISC/MathFunctions.h>
 
+#include <algorithm>
 
 using std::vector;
 
@@ -99,9 +101,159 @@ namespace OpenMS
     return hyperScore;
   }
 
-  double HyperScore::computeWithDetail(double fragment_mass_tolerance, 
-    bool fragment_mass_tolerance_unit_ppm, 
-    const PeakSpectrum& exp_spectrum, 
+  double HyperScore::computeWithDetail(double fragment_mass_tolerance,
+    bool fragment_mass_tolerance_unit_ppm,
+    const PeakSpectrum& exp_spectrum,
+    const std::vector<double>& b_ion_mzs,
+    const std::vector<double>& y_ion_mzs,
+    PSMDetail& d)
+  {
+    if (exp_spectrum.empty() || (b_ion_mzs.empty() && y_ion_mzs.empty()))
+    {
+      return 0.0;
+    }
+
+    int y_ion_count = 0;
+    int b_ion_count = 0;
+    double dot_product = 0.0;
+    double abs_error = 0.0;
+
+    // match each theoretical ion to the nearest experimental peak within tolerance;
+    // theoretical intensities are 1, so the dot product sums matched experimental intensities
+    auto match_ions = [&](const std::vector<double>& ion_mzs, int& ion_count)
+    {
+      for (const double theo_mz : ion_mzs)
+      {
+        const double tolerance_da = fragment_mass_tolerance_unit_ppm ? Math::ppmToMass(fragment_mass_tolerance, theo_mz) : fragment_mass_tolerance;
+        const Int exp_idx = exp_spectrum.findNearest(theo_mz, tolerance_da);
+        if (exp_idx < 0)
+        {
+          continue;
+        }
+        const double exp_mz = exp_spectrum[exp_idx].getMZ();
+        abs_error += fragment_mass_tolerance_unit_ppm ? Math::getPPMAbs(theo_mz, exp_mz) : std::abs(theo_mz - exp_mz);
+        dot_product += exp_spectrum[exp_idx].getIntensity();
+        ++ion_count;
+      }
+    };
+    match_ions(b_ion_mzs, b_ion_count);
+    match_ions(y_ion_mzs, y_ion_count);
+
+    const int i_min = std::min(y_ion_count, b_ion_count);
+    const int i_max = std::max(y_ion_count, b_ion_count);
+    const double hyperScore = log1p(dot_product) + 2*logfactorial_(i_min) + logfactorial_(i_max, i_min + 1);
+    d.matched_b_ions = b_ion_count;
+    d.matched_y_ions = y_ion_count;
+    d.mean_error = (b_ion_count + y_ion_count) > 0 ? abs_error / (double)(b_ion_count + y_ion_count) : 0.0;
+    return hyperScore;
+  }
+
+  void HyperScore::PackedCandidates::clear()
+  {
+    b_ion_mzs.clear();
+    y_ion_mzs.clear();
+    b_offsets.assign(1, 0);
+    y_offsets.assign(1, 0);
+  }
+
+  void HyperScore::PackedCandidates::addCandidate(const std::vector<double>& b_mzs, const std::vector<double>& y_mzs)
+  {
+    if (b_offsets.empty())
+    {
+      b_offsets.push_back(0);
+      y_offsets.push_back(0);
+    }
+    b_ion_mzs.insert(b_ion_mzs.end(), b_mzs.begin(), b_mzs.end());
+    y_ion_mzs.insert(y_ion_mzs.end(), y_mzs.begin(), y_mzs.end());
+    b_offsets.push_back(b_ion_mzs.size());
+    y_offsets.push_back(y_ion_mzs.size());
+  }
+
+  void HyperScore::computeBatch(double fragment_mass_tolerance,
+    bool fragment_mass_tolerance_unit_ppm,
+    const PeakSpectrum& exp_spectrum,
+    const PackedCandidates& candidates,
+    std::vector<double>& scores,
+    std::vector<PSMDetail>* details)
+  {
+    const Size n_candidates = candidates.size();
+    scores.assign(n_candidates, 0.0);
+    if (details != nullptr)
+    {
+      details->assign(n_candidates, PSMDetail());
+    }
+    if (exp_spectrum.empty() || n_candidates == 0)
+    {
+      return;
+    }
+
+    // unpack the observed spectrum into flat arrays once; the candidate loop
+    // below touches only plain contiguous doubles
+    const Size n_peaks = exp_spectrum.size();
+    std::vector<double> exp_mz(n_peaks), exp_int(n_peaks);
+    for (Size i = 0; i < n_peaks; ++i)
+    {
+      exp_mz[i] = exp_spectrum[i].getMZ();
+      exp_int[i] = exp_spectrum[i].getIntensity();
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (SignedSize c = 0; c < (SignedSize)n_candidates; ++c)
+    {
+      int y_ion_count = 0;
+      int b_ion_count = 0;
+      double dot_product = 0.0;
+      double abs_error = 0.0;
+
+      // nearest-within-tolerance matching, equivalent to MSSpectrum::findNearest()
+      auto match_range = [&](const double* mzs, const Size n_ions, int& ion_count)
+      {
+        for (Size k = 0; k < n_ions; ++k)
+        {
+          const double theo_mz = mzs[k];
+          const double tolerance_da = fragment_mass_tolerance_unit_ppm ? Math::ppmToMass(fragment_mass_tolerance, theo_mz) : fragment_mass_tolerance;
+          const Size right = std::lower_bound(exp_mz.begin(), exp_mz.end(), theo_mz) - exp_mz.begin();
+          Size best = n_peaks; // invalid
+          double best_dist = tolerance_da;
+          if (right < n_peaks && std::fabs(exp_mz[right] - theo_mz) <= best_dist)
+          {
+            best = right;
+            best_dist = std::fabs(exp_mz[right] - theo_mz);
+          }
+          if (right > 0 && std::fabs(exp_mz[right - 1] - theo_mz) < best_dist)
+          {
+            best = right - 1;
+          }
+          if (best == n_peaks)
+          {
+            continue;
+          }
+          abs_error += fragment_mass_tolerance_unit_ppm ? Math::getPPMAbs(theo_mz, exp_mz[best]) : std::fabs(theo_mz - exp_mz[best]);
+          dot_product += exp_int[best];
+          ++ion_count;
+        }
+      };
+      match_range(candidates.b_ion_mzs.data() + candidates.b_offsets[c], candidates.b_offsets[c + 1] - candidates.b_offsets[c], b_ion_count);
+      match_range(candidates.y_ion_mzs.data() + candidates.y_offsets[c], candidates.y_offsets[c + 1] - candidates.y_offsets[c], y_ion_count);
+
+      const int i_min = std::min(y_ion_count, b_ion_count);
+      const int i_max = std::max(y_ion_count, b_ion_count);
+      scores[c] = log1p(dot_product) + 2*logfactorial_(i_min) + logfactorial_(i_max, i_min + 1);
+      if (details != nullptr)
+      {
+        PSMDetail& d = (*details)[c];
+        d.matched_b_ions = b_ion_count;
+        d.matched_y_ions = y_ion_count;
+        d.mean_error = (b_ion_count + y_ion_count) > 0 ? abs_error / (double)(b_ion_count + y_ion_count) : 0.0;
+      }
+    }
+  }
+
+  double HyperScore::computeWithDetail(double fragment_mass_tolerance,
+    bool fragment_mass_tolerance_unit_ppm,
+    const PeakSpectrum& exp_spectrum,
     const PeakSpectrum& theo_spectrum,
     PSMDetail& d)
   {
@@ -20,6 +20,7 @@
 #include <boost/graph/graph_utility.hpp>
 #include <boost/graph/connected_components.hpp>
 
+#include <numeric>
 #include <ostream>
 #ifdef _OPENMP
 #include <omp.h>
@@ -308,6 +309,8 @@ namespace OpenMS
     unordered_map<IDPointer, vertex_t, boost::hash<IDPointer>> vertex_map{};
     unordered_map<std::string, ProteinHit*> accession_map{};
 
+    accession_map.reserve(proteins.getHits().size());
+    vertex_map.reserve(proteins.getHits().size()); // all proteins end up in here, plus the peptides
     for (auto& prot : proteins.getHits())
     {
       accession_map[prot.getAccession()] = &prot;
@@ -370,6 +373,8 @@ namespace OpenMS
     unordered_map<IDPointer, vertex_t, boost::hash<IDPointer>> vertex_map{};
     unordered_map<std::string, ProteinHit*> accession_map{};
 
+    accession_map.reserve(proteins.getHits().size());
+    vertex_map.reserve(proteins.getHits().size()); // all proteins end up in here, plus the peptides
     for (auto& prot : proteins.getHits())
     {
       accession_map[prot.getAccession()] = &prot;
@@ -402,6 +407,8 @@ namespace OpenMS
 
     unordered_map<string, ProteinHit*> accession_map{};
 
+    accession_map.reserve(proteins.getHits().size());
+    vertex_map.reserve(proteins.getHits().size()); // all proteins end up in here, plus the peptides
     for (auto& prot : proteins.getHits())
     {
       accession_map[prot.getAccession()] = &prot;
@@ -436,6 +443,8 @@ namespace OpenMS
 
     unordered_map<string, ProteinHit*> accession_map{};
 
+    accession_map.reserve(proteins.getHits().size());
+    vertex_map.reserve(proteins.getHits().size()); // all proteins end up in here, plus the peptides
     for (auto& prot : proteins.getHits())
     {
       accession_map[prot.getAccession()] = &prot;
@@ -506,7 +515,7 @@ namespace OpenMS
       if (!has_active_data)
         break; // leave while-loop
 
-      proteins.cacheChunk(PROTEIN_CACHE_SIZE);
+      proteins.cacheChunkAsync(PROTEIN_CACHE_SIZE); // read next chunk while we digest the current one
 
 
       for (Size i = 0; i < prot_count; ++i)
@@ -592,10 +601,20 @@ namespace OpenMS
       throw Exception::MissingInformation(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "No connected components annotated. Run computeConnectedComponents first!");
     }
 
+    // Process the components largest-first: combined with the dynamic schedule
+    // this prevents a giant component picked up late from running alone at the
+    // end, while the many small components fill up the remaining threads.
+    std::vector<int> order(ccs_.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [this](int a, int b) { return boost::num_vertices(ccs_.at(a)) > boost::num_vertices(ccs_.at(b)); });
+
     // Use dynamic schedule because big CCs take much longer!
-    #pragma omp parallel for schedule(dynamic) default(none) shared(functor)
-    for (int i = 0; i < static_cast<int>(ccs_.size()); i += 1)
+    #pragma omp parallel for schedule(dynamic) default(none) shared(functor, order)
+    for (int k = 0; k < static_cast<int>(order.size()); k += 1)
     {
+      const int i = order[k];
+
       #ifdef INFERENCE_BENCH
       StopWatch sw;
       sw.start();
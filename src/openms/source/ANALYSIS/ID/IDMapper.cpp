@@ -12,8 +12,13 @@
 #include <OpenMS/CONCEPT/Constants.h>
 #include <OpenMS/SYSTEM/File.h>
 
+#include <cmath>
 #include <unordered_set>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace std;
 
 namespace OpenMS
@@ -258,21 +263,9 @@ namespace OpenMS
     // append protein identifications to Map
     map.getProteinIdentifications().insert(map.getProteinIdentifications().end(), protein_ids.begin(), protein_ids.end());
 
-    // keep track of assigned/unassigned peptide identifications.
-    // maps Pep.Id. index to number of assignments to a feature
-    std::unordered_map<Size, Size> assigned_ids;
-
     // keep track of assigned/unassigned precursors
     std::unordered_map<Size, Size> assigned_precursors;
 
-    // store which peptides fit which feature (and avoid double entries)
-    // consensusMap -> {peptide_index}
-    vector<set<size_t>> mapping(map.size());
-
-    DoubleList mz_values;
-    double rt_pep;
-    IntList charges;
-
     // for statistics
     Size id_matches_none(0), id_matches_single(0), id_matches_multiple(0);
 
@@ -284,6 +277,52 @@ namespace OpenMS
 
     NATIVE_ID_TYPE native_id_type = checkTMTType(map);
 
+    // hash consensus features by RT (cf. the FeatureMap overload of this
+    // method): the RT range is partitioned into bins of 1 second and every
+    // feature is hashed into all bins that its tolerance-expanded RT range
+    // overlaps; this replaces the all-vs-all scan of the map for every
+    // identification/precursor below
+    vector<vector<Size> > rt_hash;
+    SignedSize rt_offset(0);
+    if (!map.empty())
+    {
+      vector<pair<double, double> > rt_ranges;
+      rt_ranges.reserve(map.size());
+      double min_rt = numeric_limits<double>::max();
+      double max_rt = -numeric_limits<double>::max();
+      for (Size cm_index = 0; cm_index < map.size(); ++cm_index)
+      {
+        double rt_min, rt_max;
+        if (!measure_from_subelements || map[cm_index].getFeatures().empty())
+        {
+          rt_min = rt_max = map[cm_index].getRT();
+        }
+        else // all subelements are candidates for matching
+        {
+          rt_min = numeric_limits<double>::max();
+          rt_max = -numeric_limits<double>::max();
+          for (const FeatureHandle& handle : map[cm_index].getFeatures())
+          {
+            rt_min = min(rt_min, handle.getRT());
+            rt_max = max(rt_max, handle.getRT());
+          }
+        }
+        rt_ranges.emplace_back(rt_min - rt_tolerance_, rt_max + rt_tolerance_);
+        min_rt = min(min_rt, rt_ranges.back().first);
+        max_rt = max(max_rt, rt_ranges.back().second);
+      }
+      rt_offset = SignedSize(floor(min_rt));
+      rt_hash.resize(SignedSize(floor(max_rt)) - rt_offset + 1);
+      for (Size cm_index = 0; cm_index < rt_ranges.size(); ++cm_index)
+      {
+        for (SignedSize i = SignedSize(floor(rt_ranges[cm_index].first));
+             i <= SignedSize(floor(rt_ranges[cm_index].second)); ++i)
+        {
+          rt_hash[i - rt_offset].push_back(cm_index);
+        }
+      }
+    }
+
     // We have TMT data: spectrum references annotated at consensus feature and in id
     // We can directly map by native id
     if ((native_id_type != NATIVE_ID_TYPE::UNKNOWN) )
@@ -386,110 +425,168 @@ namespace OpenMS
     }
     else
     { // non TMT data (e.g., label-free)
+      // precompute the ID details once; this can throw, so it must not
+      // happen inside the parallel matching loop below:
+      vector<double> id_rts(ids.size());
+      vector<DoubleList> id_mzs(ids.size());
+      vector<IntList> id_charges(ids.size());
       for (Size i = 0; i < ids.size(); ++i)
       {
         // skip IDs without peptide annotations
         if (ids[i].getHits().empty()) continue;
 
-        getIDDetails_(ids[i], rt_pep, mz_values, charges);
+        getIDDetails_(ids[i], id_rts[i], id_mzs[i], id_charges[i]);
+      }
+      if ((measure_ != MEASURE_PPM) && (measure_ != MEASURE_DA)) // isMatch_ would throw below
+      {
+        throw Exception::InvalidValue(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "IDMapper::annotate(): illegal internal state of measure_!", String(measure_));
+      }
 
-        bool id_mapped(false);
+      // a recorded match of a peptide identification to a consensus feature:
+      struct IDMatch
+      {
+        Size id_index;
+        Size cm_index;
+        Size map_index; // of the matched subelement ("annotate_ids_with_subelements")
+      };
+      vector<IDMatch> matches;
 
-        // iterate over the features
-        for (Size cm_index = 0; cm_index < map.size(); ++cm_index)
+#pragma omp parallel
+      {
+        // per-thread match buffer, merged in thread order below so that the
+        // matches stay sorted by ID index (as in the serial version):
+        vector<IDMatch> matches_private;
+#pragma omp for schedule(static) nowait
+        for (SignedSize i = 0; i < SignedSize(ids.size()); ++i)
         {
-          // if set to TRUE, we leave the i_mz-loop as we added the whole ID with all hits
-          bool was_added = false; // was current pep-m/z matched?!
+          // skip IDs without peptide annotations
+          if (ids[i].getHits().empty()) continue;
+
+          const double rt_pep = id_rts[i];
+          const DoubleList& mz_values = id_mzs[i];
+          const IntList& charges = id_charges[i];
+
+          SignedSize rt_bin = SignedSize(floor(rt_pep)) - rt_offset;
+          if ((rt_bin < 0) || (rt_bin >= SignedSize(rt_hash.size())))
+          {
+            continue; // RT out of bounds - no candidate features
+          }
 
-          // iterate over m/z values of pepIds
-          for (Size i_mz = 0; i_mz < mz_values.size(); ++i_mz)
+          // iterate over the candidate features
+          for (Size cm_index : rt_hash[rt_bin])
           {
-            double mz_pep = mz_values[i_mz];
+            // if set to TRUE, we leave the i_mz-loop as we added the whole ID with all hits
+            bool was_added = false; // was current pep-m/z matched?!
 
-            // charge states to use for checking:
-            IntList current_charges;
-            if (!ignore_charge_)
+            // iterate over m/z values of pepIds
+            for (Size i_mz = 0; i_mz < mz_values.size(); ++i_mz)
             {
-              // if "mz_ref." is "precursor", we have only one m/z value to check,
-              // but still one charge state per peptide hit that could match:
-              if (mz_values.size() == 1)
-              {
-                current_charges = charges;
-              }
-              else
+              double mz_pep = mz_values[i_mz];
+
+              // charge states to use for checking:
+              IntList current_charges;
+              if (!ignore_charge_)
               {
-                current_charges.push_back(charges[i_mz]);
+                // if "mz_ref." is "precursor", we have only one m/z value to check,
+                // but still one charge state per peptide hit that could match:
+                if (mz_values.size() == 1)
+                {
+                  current_charges = charges;
+                }
+                else
+                {
+                  current_charges.push_back(charges[i_mz]);
+                }
+                current_charges.push_back(0); // "not specified" always matches
               }
-              current_charges.push_back(0); // "not specified" always matches
-            }
 
-            //check if we compare distance from centroid or subelements
-            if (!measure_from_subelements)
-            {
-              if (
-                  isMatch_(rt_pep - map[cm_index].getRT(), mz_pep, map[cm_index].getMZ()) && 
-                  (ignore_charge_ || ListUtils::contains(current_charges, map[cm_index].getCharge()))  
-                  ) 
+              //check if we compare distance from centroid or subelements
+              if (!measure_from_subelements)
               {
-                id_mapped = true;
-                was_added = true;
-                map[cm_index].getPeptideIdentifications().push_back(ids[i]);
-                ++assigned_ids[i];
+                if (
+                    isMatch_(rt_pep - map[cm_index].getRT(), mz_pep, map[cm_index].getMZ()) &&
+                    (ignore_charge_ || ListUtils::contains(current_charges, map[cm_index].getCharge()))
+                    )
+                {
+                  was_added = true;
+                  matches_private.push_back({Size(i), cm_index, 0});
+                }
               }
-            }
-            else
-            {            
-              for (ConsensusFeature::HandleSetType::const_iterator it_handle = map[cm_index].getFeatures().begin();
-                  it_handle != map[cm_index].getFeatures().end();
-                  ++it_handle)
+              else
               {
-                if (isMatch_(rt_pep - it_handle->getRT(), mz_pep, it_handle->getMZ()) && 
-                    (ignore_charge_ || ListUtils::contains(current_charges, it_handle->getCharge())))
+                for (ConsensusFeature::HandleSetType::const_iterator it_handle = map[cm_index].getFeatures().begin();
+                    it_handle != map[cm_index].getFeatures().end();
+                    ++it_handle)
                 {
-                  id_mapped = true;
-                  was_added = true;
-                  if (mapping[cm_index].count(i) == 0)
+                  if (isMatch_(rt_pep - it_handle->getRT(), mz_pep, it_handle->getMZ()) &&
+                      (ignore_charge_ || ListUtils::contains(current_charges, it_handle->getCharge())))
                   {
-                    // Store the map index of the peptide feature in the id the feature was mapped to.
-                    PeptideIdentification id_pep = ids[i];
-                    if (annotate_ids_with_subelements)
-                    {
-                      id_pep.setMetaValue("map_index", it_handle->getMapIndex());
-                    }
-
-                    map[cm_index].getPeptideIdentifications().push_back(id_pep);
-                    ++assigned_ids[i];
-                    mapping[cm_index].insert(i);
+                    was_added = true;
+                    matches_private.push_back({Size(i), cm_index, it_handle->getMapIndex()});
+                    break; // we added this peptide already.. no need to check other handles
                   }
-                  break; // we added this peptide already.. no need to check other handles
                 }
+                // continue to here
               }
-              // continue to here
-            }
 
-            if (was_added) break;
+              if (was_added) break;
 
-          } // m/z values to check
+            } // m/z values to check
 
-          // break to here
+            // break to here
 
-        } // features
+          } // candidate features
+        } // Identifications
 
-        // the id has not been mapped to any consensus feature
-        if (!id_mapped)
+        // merge the per-thread buffers:
+#ifdef _OPENMP
+#pragma omp for schedule(static) ordered
+        for (int t = 0; t < omp_get_num_threads(); ++t)
         {
-          map.getUnassignedPeptideIdentifications().push_back(ids[i]);
-          ++id_matches_none;
+#pragma omp ordered
+          matches.insert(matches.end(), matches_private.begin(), matches_private.end());
         }
-      } // Identifications
+#else
+        matches.insert(matches.end(), matches_private.begin(), matches_private.end());
+#endif
+      } // end of parallel region
+
+      // batch assignment, in the (ascending ID) order of the serial version:
+      vector<Size> assigned_count(ids.size(), 0);
+      for (const IDMatch& match : matches)
+      {
+        if (!measure_from_subelements)
+        {
+          map[match.cm_index].getPeptideIdentifications().push_back(ids[match.id_index]);
+        }
+        else
+        {
+          // Store the map index of the peptide feature in the id the feature was mapped to.
+          PeptideIdentification id_pep = ids[match.id_index];
+          if (annotate_ids_with_subelements)
+          {
+            id_pep.setMetaValue("map_index", match.map_index);
+          }
+          map[match.cm_index].getPeptideIdentifications().push_back(std::move(id_pep));
+        }
+        ++assigned_count[match.id_index];
+      }
 
-      for (auto aid : assigned_ids)
+      for (Size i = 0; i < ids.size(); ++i)
       {
-        if (aid.second == 1)
+        if (ids[i].getHits().empty()) continue;
+
+        if (assigned_count[i] == 0)
+        {
+          // the id has not been mapped to any consensus feature
+          map.getUnassignedPeptideIdentifications().push_back(ids[i]);
+          ++id_matches_none;
+        }
+        else if (assigned_count[i] == 1)
         {
           ++id_matches_single;
         }
-        else if (aid.second > 1)
+        else
         {
           ++id_matches_multiple;
         }
@@ -562,8 +659,14 @@ namespace OpenMS
         }
         precursor_empty_id.setIdentifier(empty_protein_id.getIdentifier());
 
-        // iterate over the consensus features
-        for (Size cm_index = 0; cm_index < map.size(); ++cm_index)
+        SignedSize rt_bin = SignedSize(floor(rt_value)) - rt_offset;
+        if ((rt_bin < 0) || (rt_bin >= SignedSize(rt_hash.size())))
+        {
+          continue; // RT out of bounds - no candidate features
+        }
+
+        // iterate over the candidate consensus features
+        for (Size cm_index : rt_hash[rt_bin])
         {
           // charge states to use for checking:
           IntList current_charges;
@@ -975,6 +1078,175 @@ namespace OpenMS
     OPENMS_LOG_INFO << map.getAnnotationStatistics() << endl;
   }
 
+  void IDMapper::annotate(FeatureMap& map, const IdentificationData& id_data,
+                          bool use_centroid_rt, bool use_centroid_mz)
+  {
+    // merge the identifications into the map, so that the references stored in the
+    // features stay valid for the lifetime of the map:
+    map.getIdentificationData().merge(id_data);
+    IdentificationData& ids = map.getIdentificationData();
+
+    // check if all features have at least one convex hull
+    // if not, use the centroid and the given tolerances
+    if (!(use_centroid_rt && use_centroid_mz))
+    {
+      for (Feature& f_it : map)
+      {
+        if (f_it.getConvexHulls().empty())
+        {
+          use_centroid_rt = true;
+          use_centroid_mz = true;
+          OPENMS_LOG_WARN << "IDMapper warning: at least one feature has no convex hull - using centroid coordinates for matching" << endl;
+          break;
+        }
+      }
+    }
+
+    const bool mz_ref_precursor = (param_.getValue("mz_reference") == "precursor");
+
+    // calculate feature bounding boxes only once:
+    vector<DBoundingBox<2> > boxes;
+    double min_rt = numeric_limits<double>::max();
+    double max_rt = -numeric_limits<double>::max();
+    boxes.reserve(map.size());
+    for (Feature& f_it : map)
+    {
+      DBoundingBox<2> box;
+      if (!(use_centroid_rt && use_centroid_mz))
+      {
+        box = f_it.getConvexHull().getBoundingBox();
+      }
+      if (use_centroid_rt)
+      {
+        box.setMinX(f_it.getRT());
+        box.setMaxX(f_it.getRT());
+      }
+      if (use_centroid_mz)
+      {
+        box.setMinY(f_it.getMZ());
+        box.setMaxY(f_it.getMZ());
+      }
+      increaseBoundingBox_(box);
+      boxes.push_back(box);
+
+      min_rt = min(min_rt, box.minPosition().getX());
+      max_rt = max(max_rt, box.maxPosition().getX());
+    }
+
+    // hash bounding boxes of features by RT (see the legacy method above):
+    vector<vector<SignedSize> > hash_table;
+    SignedSize offset(0);
+    if (!map.empty())
+    {
+      offset = SignedSize(floor(min_rt));
+      hash_table.resize(SignedSize(floor(max_rt)) - offset + 1);
+      for (Size index = 0; index < boxes.size(); ++index)
+      {
+        const DBoundingBox<2>& box = boxes[index];
+        for (SignedSize i = SignedSize(floor(box.minPosition().getX()));
+             i <= SignedSize(floor(box.maxPosition().getX())); ++i)
+        {
+          hash_table[i - offset].push_back(index);
+        }
+      }
+    }
+    else
+    {
+      OPENMS_LOG_WARN << "IDMapper received an empty FeatureMap! All matches are left unassigned!" << endl;
+    }
+
+    // for statistics:
+    Size matches_none = 0, matches_single = 0, matches_multi = 0;
+
+    // iterate over the observation matches (e.g. PSMs):
+    for (auto match_it = ids.getObservationMatches().begin();
+         match_it != ids.getObservationMatches().end(); ++match_it)
+    {
+      const IdentificationData::Observation& obs = *match_it->observation_ref;
+      const Int charge = match_it->charge;
+      if (std::isnan(obs.rt) || (mz_ref_precursor && std::isnan(obs.mz)))
+      {
+        throw Exception::MissingInformation(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "IDMapper: RT or m/z information missing for observation '" + obs.data_id + "'!");
+      }
+      const double rt_value = obs.rt;
+      double mz_value;
+      if (mz_ref_precursor || (charge == 0)) // without a charge there is no theoretical m/z
+      {
+        mz_value = obs.mz;
+      }
+      else // use the mass of the identified molecule (assuming H+ adducts):
+      {
+        mz_value = match_it->identified_molecule_var.getFormula(0, charge).getMonoWeight() / charge;
+      }
+
+      if (map.empty() || (rt_value < min_rt) || (rt_value > max_rt)) // RT out of bounds
+      {
+        ++matches_none;
+        continue;
+      }
+
+      // iterate over candidate features:
+      Size index = SignedSize(floor(rt_value)) - offset;
+      Size matching_features = 0;
+      for (SignedSize& hash_it : hash_table[index])
+      {
+        Feature& feat = map[hash_it];
+
+        // charge states need to match:
+        if (!ignore_charge_ && (charge != feat.getCharge())) continue;
+
+        DPosition<2> id_pos(rt_value, mz_value);
+        if (boxes[hash_it].encloses(id_pos)) // potential match
+        {
+          if (use_centroid_mz)
+          {
+            // the m/z value was already incorporated into the overall
+            // bounding box -> success!
+            feat.addIDMatch(match_it);
+            ++matching_features;
+            continue;
+          }
+          // else: check all the mass traces
+          for (vector<ConvexHull2D>::iterator ch_it =
+                 feat.getConvexHulls().begin(); ch_it !=
+                 feat.getConvexHulls().end(); ++ch_it)
+          {
+            DBoundingBox<2> box = ch_it->getBoundingBox();
+            if (use_centroid_rt)
+            {
+              box.setMinX(feat.getRT());
+              box.setMaxX(feat.getRT());
+            }
+            increaseBoundingBox_(box);
+            if (box.encloses(id_pos)) // success!
+            {
+              feat.addIDMatch(match_it);
+              ++matching_features;
+              break; // "ch_it" loop
+            }
+          }
+        }
+      }
+      if (matching_features == 0)
+      {
+        ++matches_none;
+      }
+      else if (matching_features == 1)
+      {
+        ++matches_single;
+      }
+      else
+      {
+        ++matches_multi;
+      }
+    }
+
+    // some statistics output
+    OPENMS_LOG_INFO << "Unassigned matches: " << matches_none << "\n"
+    << "Matches assigned to exactly one feature: " << matches_single << "\n"
+    << "Matches assigned to multiple features: " << matches_multi << "\n";
+  }
+
   double IDMapper::getAbsoluteMZTolerance_(const double mz) const
   {
     if (measure_ == MEASURE_PPM)
@@ -7,9 +7,15 @@
 // --------------------------------------------------------------------------
 
 #include <OpenMS/ANALYSIS/ID/IDMergerAlgorithm.h>
+#include <OpenMS/FORMAT/GzipOfstream.h>
+#include <OpenMS/FORMAT/IdXMLFile.h>
 #include <OpenMS/METADATA/PeptideIdentification.h>
+#include <OpenMS/SYSTEM/File.h>
 #include <unordered_map>
+#include <algorithm>
 #include <array>
+#include <fstream>
+#include <limits>
 
 using namespace std;
 namespace OpenMS
@@ -34,6 +40,14 @@ namespace OpenMS
                        "false",
                        "Force merging of disagreeing runs. Use at your own risk.");
     defaults_.setValidStrings("allow_disagreeing_settings", {"true","false"});
+    defaults_.setValue("max_psms_in_memory",
+                       0,
+                       "If larger than zero, accumulated peptide IDs are spilled to sorted, gzip-compressed "
+                       "temporary idXML blocks on disk whenever more than this number is held in memory; the blocks "
+                       "are merged again when the results are requested. Bounds the memory footprint of huge merges "
+                       "(e.g. whole cohorts) at the cost of disk I/O. The resulting peptide IDs are then sorted by "
+                       "RT and m/z.");
+    defaults_.setMinInt("max_psms_in_memory", 0);
     defaultsToParam_();
     prot_result_.setIdentifier(getNewIdentifier_());
   }
@@ -110,6 +124,10 @@ namespace OpenMS
     prot_result_.setPrimaryMSRunPath(newOrigins);
     std::swap(prots, prot_result_);
     std::swap(peps, pep_result_);
+    if (!spill_files_.empty())
+    {
+      mergeSpilledPepIDs_(peps);
+    }
     //reset so the new this class is reuseable
     prot_result_ = ProteinIdentification{};
     prot_result_.setIdentifier(getNewIdentifier_());
@@ -268,6 +286,71 @@ namespace OpenMS
     insertProteinIDs_(std::move(old_protRuns));
     pepIDs.clear();
     old_protRuns.clear();
+
+    Int max_psms = param_.getValue("max_psms_in_memory");
+    if (max_psms > 0 && pep_result_.size() >= (Size)max_psms)
+    {
+      spillPepIDsToDisk_();
+    }
+  }
+
+  bool IDMergerAlgorithm::pepIDLess_(const PeptideIdentification& a, const PeptideIdentification& b)
+  {
+    // IDs without RT/MZ sort to the front (NaN must not reach the comparator)
+    const double rt_a = a.hasRT() ? a.getRT() : -std::numeric_limits<double>::max();
+    const double rt_b = b.hasRT() ? b.getRT() : -std::numeric_limits<double>::max();
+    if (rt_a != rt_b) return rt_a < rt_b;
+
+    const double mz_a = a.hasMZ() ? a.getMZ() : -std::numeric_limits<double>::max();
+    const double mz_b = b.hasMZ() ? b.getMZ() : -std::numeric_limits<double>::max();
+    return mz_a < mz_b;
+  }
+
+  void IDMergerAlgorithm::spillPepIDsToDisk_()
+  {
+    if (pep_result_.empty()) return;
+
+    std::sort(pep_result_.begin(), pep_result_.end(), pepIDLess_);
+    // a stub protein run carrying the new identifier (without hits; those stay in the
+    // streaming accession union) makes the block a self-contained idXML document
+    vector<ProteinIdentification> stub_run(1, prot_result_);
+    const String plain_file = File::getTemporaryFile();
+    IdXMLFile().store(plain_file, stub_run, pep_result_);
+
+    // the idXML writer has no stream interface, so deflate the block afterwards
+    const String spill_file = File::getTemporaryFile();
+    {
+      std::ifstream plain(plain_file.c_str(), std::ios_base::binary);
+      GzipOfstream compressed(spill_file.c_str());
+      compressed << plain.rdbuf();
+    }
+    File::remove(plain_file);
+
+    spill_files_.push_back(spill_file);
+    pep_result_.clear();
+    pep_result_.shrink_to_fit();
+  }
+
+  void IDMergerAlgorithm::mergeSpilledPepIDs_(vector<PeptideIdentification>& peps)
+  {
+    std::sort(peps.begin(), peps.end(), pepIDLess_);
+    IdXMLFile spill_format;
+    for (const String& spill_file : spill_files_)
+    {
+      vector<ProteinIdentification> block_prots; // just the stub run; discarded
+      vector<PeptideIdentification> block_peps;
+      spill_format.load(spill_file, block_prots, block_peps); // transparently inflates
+      File::remove(spill_file);
+
+      // each block is sorted already, so merging block by block keeps the
+      // memory overhead at a single block
+      const Size mid = peps.size();
+      peps.insert(peps.end(),
+                  std::make_move_iterator(block_peps.begin()),
+                  std::make_move_iterator(block_peps.end()));
+      std::inplace_merge(peps.begin(), peps.begin() + mid, peps.end(), pepIDLess_);
+    }
+    spill_files_.clear();
   }
 
   /* Old version. Quite slower but only copies actually referenced proteins
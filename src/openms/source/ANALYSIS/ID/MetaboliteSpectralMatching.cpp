@@ -335,8 +335,11 @@ namespace OpenMS
 
     // for every DB (theoretical) peak in the valid m/z range, find the closest
     // matching experimental (observed) peak within the allowed tolerance;
-    // in principle, multiple DB peaks can match to the same exp. peak:
-    map<Size, vector<MSSpectrum::ConstIterator>> peak_matches;
+    // in principle, multiple DB peaks can match to the same exp. peak.
+    // Matches are collected in a flat list and grouped by observed peak below;
+    // this avoids one tree node allocation per match, which adds up over the
+    // millions of query/candidate pairs scored against a spectral library.
+    vector<pair<Size, MSSpectrum::ConstIterator>> peak_matches;
     for (auto db_it = db_spectrum.MZBegin(mz_lower_bound);
          db_it != db_spectrum.MZEnd(mz_upper_bound); ++db_it)
     {
@@ -348,18 +351,30 @@ namespace OpenMS
       }
 
       Int index = exp_spectrum.findNearest(db_mz, mz_offset);
-      if (index >= 0) peak_matches[index].push_back(db_it);
+      if (index >= 0) peak_matches.emplace_back(index, db_it);
     }
 
+    // group matches of the same observed peak together; stable sort keeps the
+    // ascending db m/z order within each group
+    stable_sort(peak_matches.begin(), peak_matches.end(),
+                [](const pair<Size, MSSpectrum::ConstIterator>& lhs,
+                   const pair<Size, MSSpectrum::ConstIterator>& rhs)
+                { return lhs.first < rhs.first; });
+
     double dot_product = 0.0;
-    for (const auto& match : peak_matches)
+    Size matched_ions_count = 0; // count obs. peaks only once
+    Size group_start = 0;
+    while (group_start < peak_matches.size())
     {
       double db_intensity = 0.0;
-      for (const auto& db_it : match.second)
+      Size group_end = group_start;
+      for (; group_end < peak_matches.size() && peak_matches[group_end].first == peak_matches[group_start].first; ++group_end)
       {
-        db_intensity = max(db_intensity, double(db_it->getIntensity()));
+        db_intensity = max(db_intensity, double(peak_matches[group_end].second->getIntensity()));
       }
-      dot_product += db_intensity * exp_spectrum[match.first].getIntensity();
+      dot_product += db_intensity * exp_spectrum[peak_matches[group_start].first].getIntensity();
+      ++matched_ions_count;
+      group_start = group_end;
     }
 
     // return annotations for matching peaks?
@@ -367,25 +382,21 @@ namespace OpenMS
         !db_spectrum.getStringDataArrays().empty() &&
         !db_spectrum.getIntegerDataArrays().empty())
     {
+      // potentially add several annotations for the same peak if there are
+      // multiple matches for that peak:
       for (const auto& match : peak_matches)
       {
         const auto& exp_peak = exp_spectrum[match.first];
-        // potentially add several annotations for the same peak if there are
-        // multiple matches for that peak:
-        for (const auto& db_it : match.second)
-        {
-          PeptideHit::PeakAnnotation ann;
-          Size index = db_it - db_spectrum.begin();
-          ann.annotation = db_spectrum.getStringDataArrays()[0].at(index);
-          ann.charge = db_spectrum.getIntegerDataArrays()[0].at(index);
-          ann.mz = exp_peak.getMZ();
-          ann.intensity = exp_peak.getIntensity();
-          annotations->push_back(ann);
-        }
+        PeptideHit::PeakAnnotation ann;
+        Size index = match.second - db_spectrum.begin();
+        ann.annotation = db_spectrum.getStringDataArrays()[0].at(index);
+        ann.charge = db_spectrum.getIntegerDataArrays()[0].at(index);
+        ann.mz = exp_peak.getMZ();
+        ann.intensity = exp_peak.getIntensity();
+        annotations->push_back(ann);
       }
     }
 
-    Size matched_ions_count = peak_matches.size(); // count obs. peaks only once
     double matched_ions_term = 0.0;
 
     // return score 0 if too few matched ions
@@ -454,7 +465,15 @@ namespace OpenMS
     bool fragment_error_unit_ppm(true);
     if (mz_error_unit_ == "Da") { fragment_error_unit_ppm = false; }
 
-    for (Size spec_idx = 0; spec_idx < msexp.size(); ++spec_idx)
+    // query spectra are scored against the (read-only) library independently of
+    // each other; matches are collected per query spectrum and concatenated below,
+    // so the reported order is the same as with the former serial loop
+    vector<vector<SpectralMatch>> results_per_spectrum(msexp.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (SignedSize spec_idx = 0; spec_idx < (SignedSize)msexp.size(); ++spec_idx)
     {
       // cout << "merged spectrum no. " << spec_idx << " with #fragment ions: " << msexp[spec_idx].size() << endl;
 
@@ -548,7 +567,7 @@ namespace OpenMS
           for (Size result_idx = 0; result_idx < last_result_idx; ++result_idx)
           {
             // cout << "score: " << partial_results[result_idx].getMatchingScore() << " " << partial_results[result_idx].getMatchingSpectrumIndex() << endl;
-            matching_results.push_back(partial_results[result_idx]);
+            results_per_spectrum[spec_idx].push_back(partial_results[result_idx]);
           }
         }
 
@@ -556,13 +575,18 @@ namespace OpenMS
         {
           if (!partial_results.empty())
           {
-            matching_results.push_back(partial_results[0]);
+            results_per_spectrum[spec_idx].push_back(partial_results[0]);
           }
         }
 
       } // end precursor loop
     } // end spectra loop
 
+    for (Size spec_idx = 0; spec_idx < msexp.size(); ++spec_idx)
+    {
+      matching_results.insert(matching_results.end(), results_per_spectrum[spec_idx].begin(), results_per_spectrum[spec_idx].end());
+    }
+
     // write final results to MzTab
     exportMzTab_(matching_results, mztab_out);
   }
@@ -12,6 +12,7 @@
 #include <OpenMS/CHEMISTRY/ProteaseDB.h>
 #include <OpenMS/CHEMISTRY/ProteaseDigestion.h>
 #include <OpenMS/CONCEPT/EnumHelpers.h>
+#include <OpenMS/METADATA/MetaInfo.h>
 #include <OpenMS/SYSTEM/StopWatch.h>
 #include <OpenMS/SYSTEM/SysInfo.h>
 
@@ -393,9 +394,8 @@ PeptideIndexing::ExitCodes PeptideIndexing::run_(FASTAContainer<T>& proteins, st
   }
 
   FoundProteinFunctor func(enzyme, xtandem_fix_parameters); // store the matches
-  std::map<String, Size> acc_to_prot; // map: accessions --> FASTA protein index
   std::vector<bool> protein_is_decoy; // protein index -> is decoy?
-  std::vector<std::string> protein_accessions; // protein index -> accession
+  std::vector<std::string> protein_accessions; // protein index -> accession (only filled for proteins with at least one peptide hit)
 
   bool invalid_protein_sequence = false; // check for proteins with modifications, i.e. '[' or '(', and throw an exception
 
@@ -454,7 +454,6 @@ PeptideIndexing::ExitCodes PeptideIndexing::run_(FASTAContainer<T>& proteins, st
     #pragma omp parallel
     {
       FoundProteinFunctor func_threads(enzyme, xtandem_fix_parameters);
-      std::map<String, Size> acc_to_prot_thread; // map: accessions --> FASTA protein index
       ACTrieState ac_state;
       String prot;
 
@@ -472,7 +471,7 @@ PeptideIndexing::ExitCodes PeptideIndexing::run_(FASTAContainer<T>& proteins, st
 
         #pragma omp master
         {
-          proteins.cacheChunk(PROTEIN_CACHE_SIZE);
+          proteins.cacheChunkAsync(PROTEIN_CACHE_SIZE); // read next chunk while all threads (incl. master) search the current one
           protein_is_decoy.resize(proteins.getChunkOffset() + prot_count);
           for (SignedSize i = 0; i < prot_count; ++i)
           { // do this in master only, to avoid false sharing
@@ -552,7 +551,6 @@ PeptideIndexing::ExitCodes PeptideIndexing::run_(FASTAContainer<T>& proteins, st
           if (hits_total < func_threads.filter_passed + func_threads.filter_rejected)
           {
             protein_accessions[prot_idx] = proteins.chunkAt(i).identifier;
-            acc_to_prot_thread[protein_accessions[prot_idx]] = prot_idx;
           }
         } // end parallel FOR
 
@@ -564,9 +562,6 @@ PeptideIndexing::ExitCodes PeptideIndexing::run_(FASTAContainer<T>& proteins, st
           func.merge(func_threads);
           // sort hits by peptide index
           std::sort(func.pep_to_prot.begin(), func.pep_to_prot.end());
-          // accession -> index
-          acc_to_prot.insert(acc_to_prot_thread.begin(), acc_to_prot_thread.end());
-          acc_to_prot_thread.clear();
           s.stop();
         } // OMP end critical
       } // end readChunk
@@ -607,8 +602,22 @@ PeptideIndexing::ExitCodes PeptideIndexing::run_(FASTAContainer<T>& proteins, st
 
   } // end local scope
 
+  // index the accessions of all matched proteins (entries of proteins without
+  // any peptide hit remained empty above); queried by string_view below, i.e.
+  // without constructing String keys per lookup
+  AccessionIndex matched_accessions;
+  {
+    std::vector<std::string_view> accs;
+    accs.reserve(protein_accessions.size());
+    for (const std::string& acc : protein_accessions)
+    {
+      if (!acc.empty()) accs.push_back(acc);
+    }
+    matched_accessions.build(std::move(accs));
+  }
+
   //
-  //   do mapping 
+  //   do mapping
   //
   // index existing proteins
   std::map<String, Size> runid_to_runidx; // identifier to index
@@ -627,6 +636,14 @@ PeptideIndexing::ExitCodes PeptideIndexing::run_(FASTAContainer<T>& proteins, st
 
   std::map<Size, std::set<Size> > runidx_to_protidx; // in which protID do appear which proteins (according to mapped peptides)
 
+  // intern annotation keys and values once: they are assigned to every single hit,
+  // and the string-based setMetaValue() overload would hash the key and construct
+  // the same DataValue strings over and over
+  const UInt idx_target_decoy = MetaInfo::registry().registerName("target_decoy");
+  const UInt idx_protein_references = MetaInfo::registry().registerName("protein_references");
+  const DataValue dv_target_plus_decoy("target+decoy"), dv_target("target"), dv_decoy("decoy");
+  const DataValue dv_unique("unique"), dv_non_unique("non-unique"), dv_unmatched("unmatched"), dv_empty("");
+
   Size pep_idx(0);
   Size func_hits_idx(0); ///< current position in func.pep_to_prot[] which has a stretch of matches for current pep_idx
   const Size func_hits_size = func.pep_to_prot.size(); 
@@ -681,29 +698,29 @@ PeptideIndexing::ExitCodes PeptideIndexing::run_(FASTAContainer<T>& proteins, st
 
       if (matches_decoy && matches_target)
       {
-        it_hit->setMetaValue("target_decoy", "target+decoy");
+        it_hit->setMetaValue(idx_target_decoy, dv_target_plus_decoy);
         ++stats_count_m_td;
       }
       else if (matches_target)
       {
-        it_hit->setMetaValue("target_decoy", "target");
+        it_hit->setMetaValue(idx_target_decoy, dv_target);
         ++stats_count_m_t;
       }
       else if (matches_decoy)
       {
-        it_hit->setMetaValue("target_decoy", "decoy");
+        it_hit->setMetaValue(idx_target_decoy, dv_decoy);
         ++stats_count_m_d;
       } // else: could match to no protein (i.e. both are false)
       //else ... // not required (handled below; see stats_unmatched);
 
       if (prot_count_of_current_pep == 1)
       {
-        it_hit->setMetaValue("protein_references", "unique");
+        it_hit->setMetaValue(idx_protein_references, dv_unique);
         ++stats_matched_unique;
       }
       else if (prot_count_of_current_pep > 1)
       {
-        it_hit->setMetaValue("protein_references", "non-unique");
+        it_hit->setMetaValue(idx_protein_references, dv_non_unique);
         ++stats_matched_multi;
       }
       else
@@ -718,7 +735,7 @@ PeptideIndexing::ExitCodes PeptideIndexing::run_(FASTAContainer<T>& proteins, st
         }
         else
         {
-          it_hit->setMetaValue("protein_references", "unmatched");
+          it_hit->setMetaValue(idx_protein_references, dv_unmatched);
         }
       }
 
@@ -757,12 +774,12 @@ PeptideIndexing::ExitCodes PeptideIndexing::run_(FASTAContainer<T>& proteins, st
       for (std::vector<ProteinHit>::iterator p_hit = phits.begin(); p_hit != phits.end(); ++p_hit)
       {
         const String& acc = p_hit->getAccession();
-        if (acc_to_prot.find(acc) == acc_to_prot.end()) // acc_to_prot only contains found proteins from current run
+        if (!matched_accessions.has(acc)) // matched_accessions only contains found proteins from current run
         { // old hit is orphaned
           ++stats_orphaned_proteins;
           if (keep_unreferenced_proteins_)
           {
-            p_hit->setMetaValue("target_decoy", "");
+            p_hit->setMetaValue(idx_target_decoy, dv_empty);
             orphaned_hits.push_back(*p_hit);
           }
         }
@@ -793,12 +810,12 @@ PeptideIndexing::ExitCodes PeptideIndexing::run_(FASTAContainer<T>& proteins, st
       }
       if (protein_is_decoy[*it])
       {
-        hit.setMetaValue("target_decoy", "decoy");
+        hit.setMetaValue(idx_target_decoy, dv_decoy);
         ++stats_proteins_decoy;
       }
       else
       {
-        hit.setMetaValue("target_decoy", "target");
+        hit.setMetaValue(idx_target_decoy, dv_target);
         ++stats_proteins_target;
       }
       phits.push_back(hit);
@@ -109,13 +109,13 @@ namespace OpenMS
       if (!hits.empty())
       {
         PeptideHit& best_hit = hits[0];
-        const vector<PeptideEvidence>& pepev = best_hit.getPeptideEvidences();
+        const PeptideHit::PeptideEvidences& pepev = best_hit.getPeptideEvidences();
         set<Size> bestNonDecoyGrpTie;
         set<Size> bestDecoyGrpTie;
         unordered_map<Size,set<Size>> grpIdxToEvIdx;
 
         Size ev_idx = 0;
-        for (vector<PeptideEvidence>::const_iterator pepev_it = pepev.begin();
+        for (auto pepev_it = pepev.begin();
              pepev_it != pepev.end(); ++pepev_it, ++ev_idx)
         {
           String acc = pepev_it->getProteinAccession();
@@ -304,9 +304,9 @@ namespace OpenMS
       if (!hits.empty())
       {
         PeptideHit best_hit = hits[0];
-        const vector<PeptideEvidence>& pepev = best_hit.getPeptideEvidences();
+        const PeptideHit::PeptideEvidences& pepev = best_hit.getPeptideEvidences();
 
-        for (vector<PeptideEvidence>::const_iterator pepev_it = pepev.begin();
+        for (auto pepev_it = pepev.begin();
              pepev_it != pepev.end(); ++pepev_it)
         {
           String acc = pepev_it->getProteinAccession();
@@ -558,12 +558,12 @@ namespace OpenMS
              pepid_it != indist_prot_grp_to_pep_[*grp_it].end(); ++pepid_it)
         {
           vector<PeptideHit> pep_id_hits = peptides[*pepid_it].getHits();
-          vector<PeptideEvidence> best_hit_ev =
+          PeptideHit::PeptideEvidences best_hit_ev =
               pep_id_hits[0].getPeptideEvidences();
 
           // go through all the evidence of this peptide and remove all
           // proteins but the ones from the current indist. group
-          for (vector<PeptideEvidence>::iterator pepev_it = best_hit_ev.begin();
+          for (auto pepev_it = best_hit_ev.begin();
                pepev_it != best_hit_ev.end();
             //don't increase index, will be done by case
               )
@@ -629,12 +629,12 @@ namespace OpenMS
                  pepid_it != indist_prot_grp_to_pep_[*grp_it].end(); ++pepid_it)
             {
               vector<PeptideHit> pep_id_hits = peptides[*pepid_it].getHits();
-              vector<PeptideEvidence> best_hit_ev =
+              PeptideHit::PeptideEvidences best_hit_ev =
                   pep_id_hits[0].getPeptideEvidences();
 
               // go through all the evidence of this peptide and remove all
               // proteins but the ones from the current indist. group
-              for (vector<PeptideEvidence>::iterator pepev_it = best_hit_ev.begin();
+              for (auto pepev_it = best_hit_ev.begin();
                    pepev_it != best_hit_ev.end();
                 //don't increase index, will be done by case
                   )
@@ -735,7 +735,7 @@ namespace OpenMS
            pepid_it != indist_prot_grp_to_pep_[*grp_it].end(); ++pepid_it)
       {
         vector<PeptideHit> pep_id_hits = peptides[*pepid_it].getHits();
-        vector<PeptideEvidence> best_hit_ev =
+        PeptideHit::PeptideEvidences best_hit_ev =
             pep_id_hits[0].getPeptideEvidences();
 
         // Go through all _remaining_ proteins of the component and remove this
@@ -750,7 +750,7 @@ namespace OpenMS
 
         // go through all the evidence of this peptide and remove all
         // proteins but the ones from the current indist. group
-        for (vector<PeptideEvidence>::iterator pepev_it = best_hit_ev.begin();
+        for (auto pepev_it = best_hit_ev.begin();
              pepev_it != best_hit_ev.end();
           //don't increase index, will be done by case
             )
@@ -10,6 +10,8 @@
 #include <OpenMS/CONCEPT/Constants.h>
 #include <OpenMS/CONCEPT/LogStream.h>
 
+#include <algorithm>
+
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -130,12 +132,16 @@ namespace OpenMS
       return purityscores;
     }
 
+    // group MS2 spectra by their parent MS1 (parent index -1 = no parent):
+    // consecutive MS2 scans of one survey scan would otherwise repeat the
+    // same backward search for the parent spectrum
+    std::map<int, std::vector<int>> ms1_groups;
     for (int i = 0; i < spectra_size; ++i)
     {
       if (spectra[i].getMSLevel() == 2)
       {
-        auto parent_spectrum_it = spectra.getPrecursorSpectrum(spectra.begin()+i);
-        if (parent_spectrum_it == spectra.end() && !ignore_missing_precursor_spectra)
+        int parent_index = spectra.getPrecursorSpectrum(i);
+        if (parent_index == -1 && !ignore_missing_precursor_spectra)
         {
           OPENMS_LOG_WARN << "Warning: Input data not suitable for Precursor Purity computation. An MS2 spectrum without parent spectrum detected. Precursor Purity info will not be calculated!\n";
           return std::map<String, PrecursorPurity::PurityScores>();
@@ -153,27 +159,44 @@ namespace OpenMS
           OPENMS_LOG_WARN << "Warning: Input data not suitable for Precursor Purity computation. Duplicate Spectrum IDs. Precursor Purity info will not be calculated!\n";
           return std::map<String, PrecursorPurity::PurityScores>();
         }
+
+        ms1_groups[parent_index].push_back(i);
       }
     }
 
-#pragma omp parallel for schedule(guided)
-    for (int i = 0; i < spectra_size; ++i)
+    // process the isolation windows of one shared MS1 in ascending m/z order
+    std::vector<std::pair<int, std::vector<int>>> groups(ms1_groups.begin(), ms1_groups.end());
+    for (auto& group : groups)
     {
-      if (spectra[i].getMSLevel() == 2)
-      {
-        PrecursorPurity::PurityScores score;
-        auto parent_spectrum_it = spectra.getPrecursorSpectrum(spectra.begin() + i);
-        if (parent_spectrum_it != spectra.end())
+      std::sort(group.second.begin(), group.second.end(), [&spectra](int a, int b)
         {
-          score = PrecursorPurity::computePrecursorPurity((*parent_spectrum_it), spectra[i].getPrecursors()[0], precursor_mass_tolerance, precursor_mass_tolerance_unit_ppm);
-        }
-#pragma omp critical (purityscores_access)
-        {
-          // replace the initialized values
-          purityscores[spectra[i].getNativeID()] = score;
-        }
-      } // end of MS2 spectrum
-    } // end of parallelized spectra loop
+          return spectra[a].getPrecursors()[0].getMZ() < spectra[b].getPrecursors()[0].getMZ();
+        });
+    }
+
+    // MS1 groups are independent and of similar cost, one result slot per
+    // spectrum - no synchronization needed
+    std::vector<PrecursorPurity::PurityScores> scores(spectra.size());
+#pragma omp parallel for schedule(dynamic)
+    for (SignedSize g = 0; g < (SignedSize)groups.size(); ++g)
+    {
+      const int parent_index = groups[g].first;
+      if (parent_index == -1) continue; // scores of orphan MS2 spectra stay 0
+      const PeakSpectrum& parent_spectrum = spectra[parent_index];
+      for (const int i : groups[g].second)
+      {
+        scores[i] = PrecursorPurity::computePrecursorPurity(parent_spectrum, spectra[i].getPrecursors()[0], precursor_mass_tolerance, precursor_mass_tolerance_unit_ppm);
+      }
+    } // end of parallelized group loop
+
+    // replace the initialized values
+    for (const auto& group : groups)
+    {
+      for (const int i : group.second)
+      {
+        purityscores[spectra[i].getNativeID()] = scores[i];
+      }
+    }
     return purityscores;
   } // end of function def
 
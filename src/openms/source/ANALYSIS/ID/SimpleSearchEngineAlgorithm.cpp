@@ -22,10 +22,9 @@
 #include <OpenMS/DATASTRUCTURES/StringView.h>
 #include <OpenMS/FILTERING/DATAREDUCTION/Deisotoper.h>
 #include <OpenMS/FILTERING/ID/IDFilter.h>
-#include <OpenMS/FILTERING/TRANSFORMERS/NLargest.h>
 #include <OpenMS/FILTERING/TRANSFORMERS/Normalizer.h>
 #include <OpenMS/FILTERING/TRANSFORMERS/ThresholdMower.h>
-#include <OpenMS/FILTERING/TRANSFORMERS/WindowMower.h>
+#include <OpenMS/FILTERING/TRANSFORMERS/TopNPerWindowFilter.h>
 #include <OpenMS/FORMAT/FASTAFile.h>
 #include <OpenMS/FORMAT/FileHandler.h>
 #include <OpenMS/KERNEL/MSExperiment.h>
@@ -99,6 +98,11 @@ namespace OpenMS
     defaults_.setValue("decoys", "false", "Should decoys be generated?");
     defaults_.setValidStrings("decoys", {"true","false"} );
 
+    defaults_.setValue("fragment_index", "false", "Spectrum-centric search using a fragment-ion index: all theoretical b/y fragments of the candidate peptides are binned into an m/z-sorted index and spectra collect their candidates by index lookups instead of scoring every candidate in the precursor window. Reported scores are identical to the regular search; much faster for large databases at the cost of additional memory for the index.");
+    defaults_.setValidStrings("fragment_index", {"true","false"} );
+
+    defaults_.setValue("digest_cache", "", "Directory for a persistent digest cache. If set, the digested database (packed peptide positions and masses) is written there once, keyed by a hash of the database content and all digestion parameters, and repeated searches with the same database and settings map the cached digest instead of digesting again. Empty: no caching.", {"advanced"});
+
     defaults_.setValue("annotate:PSM",  std::vector<std::string>{"ALL"}, "Annotations added to each PSM.");
     defaults_.setValidStrings("annotate:PSM", 
       std::vector<std::string>{
@@ -165,6 +169,8 @@ namespace OpenMS
     report_top_hits_ = param_.getValue("report:top_hits");
 
     decoys_ = param_.getValue("decoys") == "true";
+    fragment_index_ = param_.getValue("fragment_index") == "true";
+    digest_cache_dir_ = param_.getValue("digest_cache").toString();
     annotate_psm_ = ListUtils::toStringList<std::string>(param_.getValue("annotate:PSM"));
   }
 
@@ -182,17 +188,15 @@ namespace OpenMS
     // sort by rt
     exp.sortSpectra(false);
 
-    // filter settings
-    WindowMower window_mower_filter;
-    Param filter_param = window_mower_filter.getParameters();
-    filter_param.setValue("windowsize", 100.0, "The size of the sliding window along the m/z axis.");
-    filter_param.setValue("peakcount", 20, "The number of peaks that should be kept.");
-    filter_param.setValue("movetype", "jump", "Whether sliding window (one peak steps) or jumping window (window size steps) should be used.");
-    window_mower_filter.setParameters(filter_param);
+    // filter settings: top 20 peaks per 100 Th window, at most 400 peaks overall
+    TopNPerWindowFilter noise_filter;
+    Param filter_param = noise_filter.getParameters();
+    filter_param.setValue("windowsize", 100.0, "The size of the jumping window along the m/z axis.");
+    filter_param.setValue("peakcount", 20, "The number of peaks that should be kept per window.");
+    filter_param.setValue("nlargest", 400, "The overall number of peaks to keep after the window filter.");
+    noise_filter.setParameters(filter_param);
 
-    NLargest nlargest_filter = NLargest(400);
-
-#pragma omp parallel for default(none) shared(exp, fragment_mass_tolerance, fragment_mass_tolerance_unit_ppm, window_mower_filter, nlargest_filter)
+#pragma omp parallel for default(none) shared(exp, fragment_mass_tolerance, fragment_mass_tolerance_unit_ppm, noise_filter)
     for (SignedSize exp_index = 0; exp_index < (SignedSize)exp.size(); ++exp_index)
     {
       // sort by mz
@@ -206,16 +210,290 @@ namespace OpenMS
         3, 10,  // min / max isopeaks 
         true);  // convert fragment m/z to mono-charge
 
-      // remove noise
-      window_mower_filter.filterPeakSpectrum(exp[exp_index]);
-      nlargest_filter.filterPeakSpectrum(exp[exp_index]);
+      // remove noise (keeps the spectrum sorted by m/z)
+      noise_filter.filterPeakSpectrum(exp[exp_index]);
+    }
+  }
 
-      // sort (nlargest changes order)
-      exp[exp_index].sortByPosition();
+  void SimpleSearchEngineAlgorithm::searchWithFragmentIndex_(const PeakMap& spectra,
+      const std::vector<FASTAFile::FASTAEntry>& fasta_db,
+      ProteaseDigestion& digestor,
+      const DigestCache& digest_cache,
+      const ModifiedPeptideGenerator::MapToResidueType& fixed_modifications,
+      const ModifiedPeptideGenerator::MapToResidueType& variable_modifications,
+      bool precursor_mass_tolerance_unit_ppm,
+      bool fragment_mass_tolerance_unit_ppm,
+      std::vector<std::vector<AnnotatedHit_> >& annotated_hits) const
+  {
+    boost::regex peptide_motif_regex(peptide_motif_);
+
+    // a candidate is a fixed+variable modified peptide; only its mass and its
+    // enumeration indices are stored, the AASequence is regenerated on demand
+    struct Candidate_
+    {
+      double mass;
+      Size peptide_index;
+      Size mod_index;
+    };
+
+    // one entry per theoretical singly charged b/y ion of a candidate
+    struct FragmentEntry_
+    {
+      double mz;
+      Size candidate_index;
+    };
+
+    // collect the unique peptides of the digested database
+    startProgress(0, fasta_db.size(), "Digesting database...");
+    vector<StringView> peptides;
+    set<StringView> processed_petides;
+    for (Size fasta_index = 0; fasta_index != fasta_db.size(); ++fasta_index)
+    {
+      setProgress(fasta_index);
+
+      vector<StringView> current_digest;
+      if (digest_cache.isLoaded())
+      {
+        // reconstruct the peptides as views into the protein sequence from the cached records
+        const StringView protein(fasta_db[fasta_index].sequence);
+        for (const EnzymaticDigestion::PeptideMass& pm : digest_cache.getDigest(fasta_index))
+        {
+          current_digest.push_back(protein.substr(pm.position, pm.length));
+        }
+      }
+      else
+      {
+        digestor.digestUnmodified(fasta_db[fasta_index].sequence, current_digest, peptide_min_size_, peptide_max_size_);
+      }
+
+      for (auto const & c : current_digest)
+      {
+        const String current_peptide = c.getString();
+        if (current_peptide.find_first_of("XBZ") != std::string::npos)
+        {
+          continue;
+        }
+
+        // if a peptide motif is provided skip all peptides without match
+        if (!peptide_motif_.empty() && !boost::regex_match(current_peptide, peptide_motif_regex))
+        {
+          continue;
+        }
+
+        // peptide (and all modified variants) already processed so skip it
+        if (processed_petides.find(c) != processed_petides.end())
+        {
+          continue;
+        }
+        processed_petides.insert(c);
+        peptides.push_back(c);
+      }
+    }
+    endProgress();
+
+    // enumerate all modified candidates and bin their theoretical b/y ions
+    // into the fragment index; built with per-thread buffers that are merged
+    // (shifting the thread-local candidate indices) at the end
+    startProgress(0, peptides.size(), "Building fragment index...");
+    vector<Candidate_> candidates;
+    vector<FragmentEntry_> fragment_index;
+    Size count_peptides(0);
+
+#pragma omp parallel default(none) shared(peptides, fixed_modifications, variable_modifications, candidates, fragment_index, count_peptides)
+    {
+      // fragment m/z buffers, reused for all candidates of this thread (no per-peptide heap traffic)
+      vector<double> b_ion_mzs, y_ion_mzs;
+      vector<Candidate_> candidates_local;
+      vector<FragmentEntry_> fragments_local;
+
+#pragma omp for schedule(dynamic, 100)
+      for (SignedSize peptide_index = 0; peptide_index < (SignedSize)peptides.size(); ++peptide_index)
+      {
+        #pragma omp atomic
+        ++count_peptides;
+
+        IF_MASTERTHREAD
+        {
+          setProgress(count_peptides);
+        }
+
+        vector<AASequence> all_modified_peptides;
+
+        // this critical section is because ResidueDB is not thread safe and new residues are created based on the PTMs
+        #pragma omp critical (residuedb_access)
+        {
+          AASequence aas = AASequence::fromString(peptides[peptide_index].getString());
+          ModifiedPeptideGenerator::applyFixedModifications(fixed_modifications, aas);
+          ModifiedPeptideGenerator::applyVariableModifications(variable_modifications, aas, modifications_max_variable_mods_per_peptide_, all_modified_peptides);
+        }
+
+        for (Size mod_pep_idx = 0; mod_pep_idx != all_modified_peptides.size(); ++mod_pep_idx)
+        {
+          const AASequence& candidate = all_modified_peptides[mod_pep_idx];
+          const Size candidate_index = candidates_local.size(); // thread-local index, shifted on merge
+          candidates_local.push_back({candidate.getMonoWeight(), (Size)peptide_index, mod_pep_idx});
+
+          // generate m/z of singly charged b and y ions into the reused buffers
+          TheoreticalSpectrumGenerator::getBYIonMZs(candidate, b_ion_mzs, y_ion_mzs);
+          for (double mz : b_ion_mzs) { fragments_local.push_back({mz, candidate_index}); }
+          for (double mz : y_ion_mzs) { fragments_local.push_back({mz, candidate_index}); }
+        }
+      }
+
+      // merge the per-thread buffers into the shared index
+      #pragma omp critical (fragment_index_merge)
+      {
+        const Size candidate_offset = candidates.size();
+        candidates.insert(candidates.end(), candidates_local.begin(), candidates_local.end());
+        fragment_index.reserve(fragment_index.size() + fragments_local.size());
+        for (const FragmentEntry_& f : fragments_local)
+        {
+          fragment_index.push_back({f.mz, f.candidate_index + candidate_offset});
+        }
+      }
+    }
+
+    std::sort(fragment_index.begin(), fragment_index.end(),
+      [](const FragmentEntry_& a, const FragmentEntry_& b) { return a.mz < b.mz; });
+    endProgress();
+
+    OPENMS_LOG_INFO << "Peptides: " << count_peptides << endl;
+    OPENMS_LOG_INFO << "Candidates (incl. modified variants): " << candidates.size() << endl;
+    OPENMS_LOG_INFO << "Indexed fragments: " << fragment_index.size() << endl;
+
+    // spectrum-centric scoring: every peak retrieves the candidates it
+    // matches from the index; candidates sharing at least one fragment with
+    // the spectrum are then scored with the regular hyperscore
+    startProgress(0, spectra.size(), "Scoring spectra against the fragment index...");
+    Size count_spectra(0);
+
+#pragma omp parallel default(none) shared(spectra, peptides, candidates, fragment_index, fixed_modifications, variable_modifications, precursor_mass_tolerance_unit_ppm, fragment_mass_tolerance_unit_ppm, annotated_hits, count_spectra)
+    {
+      // fragment m/z buffers, reused for all candidates of this thread (no per-peptide heap traffic)
+      vector<double> b_ion_mzs, y_ion_mzs;
+      map<Size, Size> candidate_hits; // candidate index -> number of matched peaks
+
+#pragma omp for schedule(dynamic)
+      for (SignedSize scan_index = 0; scan_index < (SignedSize)spectra.size(); ++scan_index)
+      {
+        #pragma omp atomic
+        ++count_spectra;
+
+        IF_MASTERTHREAD
+        {
+          setProgress(count_spectra);
+        }
+
+        const PeakSpectrum& exp_spectrum = spectra[scan_index];
+        const vector<Precursor>& precursor = exp_spectrum.getPrecursors();
+
+        // there should only one precursor and MS2 should contain at least a few peaks to be considered (e.g. at least for every AA in the peptide)
+        if (precursor.size() != 1 || exp_spectrum.size() < peptide_min_size_)
+        {
+          continue;
+        }
+
+        const Size precursor_charge = precursor[0].getCharge();
+        if (precursor_charge < precursor_min_charge_
+         || precursor_charge > precursor_max_charge_)
+        {
+          continue;
+        }
+
+        // calculate precursor masses (optionally corrected for misassignment)
+        vector<double> precursor_masses;
+        for (int isotope_number : precursor_isotopes_)
+        {
+          double precursor_mass = (double) precursor_charge * precursor[0].getMZ() - (double) precursor_charge * Constants::PROTON_MASS_U;
+
+          // correct for monoisotopic misassignments of the precursor annotation
+          if (isotope_number != 0) { precursor_mass -= isotope_number * Constants::C13C12_MASSDIFF_U; }
+
+          precursor_masses.push_back(precursor_mass);
+        }
+
+        // look up every peak in the index and count the matched fragments of
+        // all candidates in the precursor mass window; the counts only serve
+        // as an existence filter, the final score is computed below exactly
+        // as in the protein-centric search
+        candidate_hits.clear();
+        for (Size peak_index = 0; peak_index != exp_spectrum.size(); ++peak_index)
+        {
+          const double peak_mz = exp_spectrum[peak_index].getMZ();
+          const double fragment_tolerance = fragment_mass_tolerance_unit_ppm ? peak_mz * fragment_mass_tolerance_ * 1e-6 : fragment_mass_tolerance_;
+
+          auto low_it = std::lower_bound(fragment_index.begin(), fragment_index.end(), peak_mz - fragment_tolerance,
+            [](const FragmentEntry_& f, double mz) { return f.mz < mz; });
+          auto up_it = std::upper_bound(fragment_index.begin(), fragment_index.end(), peak_mz + fragment_tolerance,
+            [](double mz, const FragmentEntry_& f) { return mz < f.mz; });
+
+          for (; low_it != up_it; ++low_it)
+          {
+            const double candidate_mass = candidates[low_it->candidate_index].mass;
+            const double precursor_tolerance = precursor_mass_tolerance_unit_ppm ? candidate_mass * precursor_mass_tolerance_ * 1e-6 : precursor_mass_tolerance_;
+            for (double precursor_mass : precursor_masses)
+            {
+              if (fabs(candidate_mass - precursor_mass) <= precursor_tolerance)
+              {
+                ++candidate_hits[low_it->candidate_index];
+                break;
+              }
+            }
+          }
+        }
+
+        // rescore the retrieved candidates with the regular hyperscore
+        for (const auto& hit : candidate_hits)
+        {
+          const Candidate_& cand = candidates[hit.first];
+
+          vector<AASequence> all_modified_peptides;
+
+          // this critical section is because ResidueDB is not thread safe and new residues are created based on the PTMs
+          #pragma omp critical (residuedb_access)
+          {
+            AASequence aas = AASequence::fromString(peptides[cand.peptide_index].getString());
+            ModifiedPeptideGenerator::applyFixedModifications(fixed_modifications, aas);
+            ModifiedPeptideGenerator::applyVariableModifications(variable_modifications, aas, modifications_max_variable_mods_per_peptide_, all_modified_peptides);
+          }
+
+          const AASequence& candidate = all_modified_peptides[cand.mod_index];
+          TheoreticalSpectrumGenerator::getBYIonMZs(candidate, b_ion_mzs, y_ion_mzs);
+
+          HyperScore::PSMDetail detail;
+          const double& score = HyperScore::computeWithDetail(fragment_mass_tolerance_, fragment_mass_tolerance_unit_ppm, exp_spectrum, b_ion_mzs, y_ion_mzs, detail);
+
+          if (score == 0)
+          {
+            continue; // no hit?
+          }
+          // add peptide hit
+          AnnotatedHit_ ah;
+          ah.sequence = peptides[cand.peptide_index];
+          ah.peptide_mod_index = cand.mod_index;
+          ah.score = score;
+          ah.prefix_fraction = (double)detail.matched_b_ions/(double)peptides[cand.peptide_index].size();
+          ah.suffix_fraction = (double)detail.matched_y_ions/(double)peptides[cand.peptide_index].size();
+          ah.mean_error = detail.mean_error;
+
+          // no lock required here: each spectrum is processed by exactly one thread
+          annotated_hits[scan_index].push_back(ah);
+
+          // prevent vector from growing indefinitely (memory) but don't shrink the vector every time
+          if (annotated_hits[scan_index].size() >= 2 * report_top_hits_)
+          {
+            std::partial_sort(annotated_hits[scan_index].begin(), annotated_hits[scan_index].begin() + report_top_hits_, annotated_hits[scan_index].end(), AnnotatedHit_::hasBetterScore);
+            annotated_hits[scan_index].resize(report_top_hits_);
+          }
+        }
+      }
     }
+    endProgress();
+
+    OPENMS_LOG_INFO << "Processed peptides: " << processed_petides.size() << endl;
   }
 
-void SimpleSearchEngineAlgorithm::postProcessHits_(const PeakMap& exp, 
+void SimpleSearchEngineAlgorithm::postProcessHits_(const PeakMap& exp,
       std::vector<std::vector<SimpleSearchEngineAlgorithm::AnnotatedHit_> >& annotated_hits, 
       std::vector<ProteinIdentification>& protein_ids, 
       std::vector<PeptideIdentification>& peptide_ids, 
@@ -456,13 +734,6 @@ void SimpleSearchEngineAlgorithm::postProcessHits_(const PeakMap& exp,
       }
     }
 
-    // create spectrum generator
-    TheoreticalSpectrumGenerator spectrum_generator;
-    Param param(spectrum_generator.getParameters());
-    param.setValue("add_first_prefix_ion", "true");
-    param.setValue("add_metainfo", "true");
-    spectrum_generator.setParameters(param);
-
     // preallocate storage for PSMs
     vector<vector<AnnotatedHit_> > annotated_hits(spectra.size(), vector<AnnotatedHit_>());
     for (auto & a : annotated_hits) { a.reserve(2 * report_top_hits_); }
@@ -504,153 +775,194 @@ void SimpleSearchEngineAlgorithm::postProcessHits_(const PeakMap& exp,
     ProteaseDigestion digestor;
     digestor.setEnzyme(enzyme_);
     digestor.setMissedCleavages(peptide_missed_cleavages_);
-    startProgress(0, fasta_db.size(), "Scoring peptide models against spectra...");
 
-    // lookup for processed peptides. must be defined outside of omp section and synchronized
-    set<StringView> processed_petides;
+    // if a cache directory is configured, reuse the digest of an earlier run with
+    // the same database and settings (or digest once now and store it); the key
+    // covers the database content after decoy generation, so positions in the
+    // cached records always refer to the entries of fasta_db
+    DigestCache digest_cache;
+    if (!digest_cache_dir_.empty())
+    {
+      const String key = DigestCache::cacheKey(fasta_db, digestor, peptide_min_size_, peptide_max_size_);
+      const String cache_file = DigestCache::cacheFileName(digest_cache_dir_, key);
+      if (!digest_cache.load(cache_file, key))
+      {
+        startProgress(0, 1, "Writing digest cache...");
+        DigestCache::store(cache_file, key, fasta_db, digestor, peptide_min_size_, peptide_max_size_);
+        digest_cache.load(cache_file, key);
+        endProgress();
+      }
+    }
 
-    Size count_proteins(0), count_peptides(0);
+    if (fragment_index_)
+    {
+      searchWithFragmentIndex_(spectra, fasta_db, digestor, digest_cache,
+        fixed_modifications, variable_modifications,
+        precursor_mass_tolerance_unit_ppm, fragment_mass_tolerance_unit_ppm,
+        annotated_hits);
+    }
+    else
+    {
+      startProgress(0, fasta_db.size(), "Scoring peptide models against spectra...");
 
-#pragma omp parallel for schedule(static) default(none) shared(annotated_hits, spectrum_generator, multimap_mass_2_scan_index, fixed_modifications, variable_modifications, fasta_db, digestor, processed_petides, count_proteins, count_peptides, precursor_mass_tolerance_unit_ppm, fragment_mass_tolerance_unit_ppm, peptide_motif_regex, spectra, annotated_hits_lock)
-      for (SignedSize fasta_index = 0; fasta_index < (SignedSize)fasta_db.size(); ++fasta_index)
-      {
+      // lookup for processed peptides. must be defined outside of omp section and synchronized
+      set<StringView> processed_petides;
 
-      #pragma omp atomic
-      ++count_proteins;
+      Size count_proteins(0), count_peptides(0);
 
-      IF_MASTERTHREAD
+#pragma omp parallel default(none) shared(annotated_hits, multimap_mass_2_scan_index, fixed_modifications, variable_modifications, fasta_db, digestor, digest_cache, processed_petides, count_proteins, count_peptides, precursor_mass_tolerance_unit_ppm, fragment_mass_tolerance_unit_ppm, peptide_motif_regex, spectra, annotated_hits_lock)
       {
-        setProgress(count_proteins);
-      }
+        // fragment m/z buffers, reused for all candidates of this thread (no per-peptide heap traffic)
+        vector<double> b_ion_mzs, y_ion_mzs;
 
-      vector<StringView> current_digest;
-      digestor.digestUnmodified(fasta_db[fasta_index].sequence, current_digest, peptide_min_size_, peptide_max_size_);
+#pragma omp for schedule(static)
+        for (SignedSize fasta_index = 0; fasta_index < (SignedSize)fasta_db.size(); ++fasta_index)
+        {
 
-      for (auto const & c : current_digest)
-      { 
-        const String current_peptide = c.getString();
-        if (current_peptide.find_first_of("XBZ") != std::string::npos)
+      #pragma omp atomic
+        ++count_proteins;
+
+        IF_MASTERTHREAD
         {
-          continue;
+          setProgress(count_proteins);
         }
 
-        // if a peptide motif is provided skip all peptides without match
-        if (!peptide_motif_.empty() && !boost::regex_match(current_peptide, peptide_motif_regex))
+        vector<StringView> current_digest;
+        if (digest_cache.isLoaded())
         {
-          continue;
-        }          
-      
-        bool already_processed = false;
-        #pragma omp critical (processed_peptides_access)
-        {
-          // peptide (and all modified variants) already processed so skip it
-          if (processed_petides.find(c) != processed_petides.end())
-          {
-            already_processed = true;
-          }
-          else
+          // reconstruct the peptides as views into the protein sequence from the cached records
+          const StringView protein(fasta_db[fasta_index].sequence);
+          for (const EnzymaticDigestion::PeptideMass& pm : digest_cache.getDigest(fasta_index))
           {
-            processed_petides.insert(c);
+            current_digest.push_back(protein.substr(pm.position, pm.length));
           }
         }
-
-        // skip peptides that have already been processed
-        if (already_processed) { continue; }
-
-        #pragma omp atomic
-        ++count_peptides;
-
-        vector<AASequence> all_modified_peptides;
-
-        // this critical section is because ResidueDB is not thread safe and new residues are created based on the PTMs
-        #pragma omp critical (residuedb_access)
+        else
         {
-          AASequence aas = AASequence::fromString(current_peptide);
-          ModifiedPeptideGenerator::applyFixedModifications(fixed_modifications, aas);
-          ModifiedPeptideGenerator::applyVariableModifications(variable_modifications, aas, modifications_max_variable_mods_per_peptide_, all_modified_peptides);
+          digestor.digestUnmodified(fasta_db[fasta_index].sequence, current_digest, peptide_min_size_, peptide_max_size_);
         }
 
-        for (SignedSize mod_pep_idx = 0; mod_pep_idx < (SignedSize)all_modified_peptides.size(); ++mod_pep_idx)
-        {
-          const AASequence& candidate = all_modified_peptides[mod_pep_idx];
-          double current_peptide_mass = candidate.getMonoWeight();
-
-          // determine MS2 precursors that match to the current peptide mass
-          multimap<double, Size>::const_iterator low_it;
-          multimap<double, Size>::const_iterator up_it;
-
-          if (precursor_mass_tolerance_unit_ppm) // ppm
-          {
-            low_it = multimap_mass_2_scan_index.lower_bound(current_peptide_mass - current_peptide_mass * precursor_mass_tolerance_ * 1e-6);
-            up_it = multimap_mass_2_scan_index.upper_bound(current_peptide_mass + current_peptide_mass * precursor_mass_tolerance_ * 1e-6);
-          }
-          else // Dalton
+        for (auto const & c : current_digest)
+        { 
+          const String current_peptide = c.getString();
+          if (current_peptide.find_first_of("XBZ") != std::string::npos)
           {
-            low_it = multimap_mass_2_scan_index.lower_bound(current_peptide_mass - precursor_mass_tolerance_);
-            up_it = multimap_mass_2_scan_index.upper_bound(current_peptide_mass + precursor_mass_tolerance_);
+            continue;
           }
 
-          // no matching precursor in data
-          if (low_it == up_it)
-          { 
+          // if a peptide motif is provided skip all peptides without match
+          if (!peptide_motif_.empty() && !boost::regex_match(current_peptide, peptide_motif_regex))
+          {
             continue;
+          }          
+      
+          bool already_processed = false;
+        #pragma omp critical (processed_peptides_access)
+          {
+            // peptide (and all modified variants) already processed so skip it
+            if (processed_petides.find(c) != processed_petides.end())
+            {
+              already_processed = true;
+            }
+            else
+            {
+              processed_petides.insert(c);
+            }
           }
 
-          // create theoretical spectrum
-          PeakSpectrum theo_spectrum;
+          // skip peptides that have already been processed
+          if (already_processed) { continue; }
+
+        #pragma omp atomic
+          ++count_peptides;
 
-          // add peaks for b and y ions with charge 1
-          spectrum_generator.getSpectrum(theo_spectrum, candidate, 1, 1);
+          vector<AASequence> all_modified_peptides;
 
-          // sort by mz
-          theo_spectrum.sortByPosition();
+          // this critical section is because ResidueDB is not thread safe and new residues are created based on the PTMs
+        #pragma omp critical (residuedb_access)
+          {
+            AASequence aas = AASequence::fromString(current_peptide);
+            ModifiedPeptideGenerator::applyFixedModifications(fixed_modifications, aas);
+            ModifiedPeptideGenerator::applyVariableModifications(variable_modifications, aas, modifications_max_variable_mods_per_peptide_, all_modified_peptides);
+          }
 
-          for (; low_it != up_it; ++low_it)
+          for (SignedSize mod_pep_idx = 0; mod_pep_idx < (SignedSize)all_modified_peptides.size(); ++mod_pep_idx)
           {
-            const Size& scan_index = low_it->second;
-            const PeakSpectrum& exp_spectrum = spectra[scan_index];
-            // const int& charge = exp_spectrum.getPrecursors()[0].getCharge();
-            HyperScore::PSMDetail detail;
-            const double& score = HyperScore::computeWithDetail(fragment_mass_tolerance_, fragment_mass_tolerance_unit_ppm, exp_spectrum, theo_spectrum, detail);
+            const AASequence& candidate = all_modified_peptides[mod_pep_idx];
+            double current_peptide_mass = candidate.getMonoWeight();
+
+            // determine MS2 precursors that match to the current peptide mass
+            multimap<double, Size>::const_iterator low_it;
+            multimap<double, Size>::const_iterator up_it;
+
+            if (precursor_mass_tolerance_unit_ppm) // ppm
+            {
+              low_it = multimap_mass_2_scan_index.lower_bound(current_peptide_mass - current_peptide_mass * precursor_mass_tolerance_ * 1e-6);
+              up_it = multimap_mass_2_scan_index.upper_bound(current_peptide_mass + current_peptide_mass * precursor_mass_tolerance_ * 1e-6);
+            }
+            else // Dalton
+            {
+              low_it = multimap_mass_2_scan_index.lower_bound(current_peptide_mass - precursor_mass_tolerance_);
+              up_it = multimap_mass_2_scan_index.upper_bound(current_peptide_mass + precursor_mass_tolerance_);
+            }
 
-            if (score == 0)
+            // no matching precursor in data
+            if (low_it == up_it)
             { 
-              continue; // no hit?
+              continue;
             }
-            // add peptide hit
-            AnnotatedHit_ ah;
-            ah.sequence = c;
-            ah.peptide_mod_index = mod_pep_idx;
-            ah.score = score;
-            ah.prefix_fraction = (double)detail.matched_b_ions/(double)c.size();
-            ah.suffix_fraction = (double)detail.matched_y_ions/(double)c.size();
-            ah.mean_error = detail.mean_error;
 
-#ifdef _OPENMP
-            omp_set_lock(&(annotated_hits_lock[scan_index]));
+            // generate m/z of singly charged b and y ions into the reused buffers (sorted ascending)
+            TheoreticalSpectrumGenerator::getBYIonMZs(candidate, b_ion_mzs, y_ion_mzs);
+
+            for (; low_it != up_it; ++low_it)
             {
-#endif
-              annotated_hits[scan_index].push_back(ah);
+              const Size& scan_index = low_it->second;
+              const PeakSpectrum& exp_spectrum = spectra[scan_index];
+              // const int& charge = exp_spectrum.getPrecursors()[0].getCharge();
+              HyperScore::PSMDetail detail;
+              const double& score = HyperScore::computeWithDetail(fragment_mass_tolerance_, fragment_mass_tolerance_unit_ppm, exp_spectrum, b_ion_mzs, y_ion_mzs, detail);
+
+              if (score == 0)
+              { 
+                continue; // no hit?
+              }
+              // add peptide hit
+              AnnotatedHit_ ah;
+              ah.sequence = c;
+              ah.peptide_mod_index = mod_pep_idx;
+              ah.score = score;
+              ah.prefix_fraction = (double)detail.matched_b_ions/(double)c.size();
+              ah.suffix_fraction = (double)detail.matched_y_ions/(double)c.size();
+              ah.mean_error = detail.mean_error;
 
-              // prevent vector from growing indefinitely (memory) but don't shrink the vector every time
-              if (annotated_hits[scan_index].size() >= 2 * report_top_hits_)
+#ifdef _OPENMP
+              omp_set_lock(&(annotated_hits_lock[scan_index]));
               {
-                std::partial_sort(annotated_hits[scan_index].begin(), annotated_hits[scan_index].begin() + report_top_hits_, annotated_hits[scan_index].end(), AnnotatedHit_::hasBetterScore);
-                annotated_hits[scan_index].resize(report_top_hits_); 
-              }
+#endif
+                annotated_hits[scan_index].push_back(ah);
+
+                // prevent vector from growing indefinitely (memory) but don't shrink the vector every time
+                if (annotated_hits[scan_index].size() >= 2 * report_top_hits_)
+                {
+                  std::partial_sort(annotated_hits[scan_index].begin(), annotated_hits[scan_index].begin() + report_top_hits_, annotated_hits[scan_index].end(), AnnotatedHit_::hasBetterScore);
+                  annotated_hits[scan_index].resize(report_top_hits_); 
+                }
 #ifdef _OPENMP
-            }
-            omp_unset_lock(&(annotated_hits_lock[scan_index]));
+              }
+              omp_unset_lock(&(annotated_hits_lock[scan_index]));
 #endif
+            }
           }
         }
+        }
       }
-    }
-    endProgress();
+      endProgress();
 
-    OPENMS_LOG_INFO << "Proteins: " << count_proteins << endl;
-    OPENMS_LOG_INFO << "Peptides: " << count_peptides << endl;
-    OPENMS_LOG_INFO << "Processed peptides: " << processed_petides.size() << endl;
+      OPENMS_LOG_INFO << "Proteins: " << count_proteins << endl;
+      OPENMS_LOG_INFO << "Peptides: " << count_peptides << endl;
+      OPENMS_LOG_INFO << "Processed peptides: " << processed_petides.size() << endl;
+    }
 
     startProgress(0, 1, "Post-processing PSMs...");
     SimpleSearchEngineAlgorithm::postProcessHits_(spectra, 
@@ -9,6 +9,9 @@
 #include <OpenMS/ANALYSIS/MAPMATCHING/ConsensusMapNormalizerAlgorithmQuantile.h>
 
 #include <OpenMS/CONCEPT/ProgressLogger.h>
+#include <OpenMS/MATH/STATISTICS/QuantileSketch.h>
+
+#include <algorithm>
 
 using namespace std;
 
@@ -36,14 +39,16 @@ namespace OpenMS
     }
 
     //resample n data points from each sorted intensity distribution (from the different maps), n = maximum number of features in any map
-    vector<vector<double> > resampled_sorted_data;
-    for (Size i = 0; i < number_of_maps; ++i)
+    //the maps are independent here, so the expensive sorting runs in parallel
+    vector<vector<double> > resampled_sorted_data(number_of_maps);
+#pragma omp parallel for schedule(dynamic)
+    for (SignedSize i = 0; i < (SignedSize)number_of_maps; ++i)
     {
       vector<double> sorted = feature_ints[i];
       std::sort(sorted.begin(), sorted.end());
       vector<double> resampled(largest_number_of_features);
       resample(sorted, resampled, static_cast<UInt>(largest_number_of_features));
-      resampled_sorted_data.push_back(resampled);
+      resampled_sorted_data[i] = resampled;
     }
 
     //compute reference distribution from all resampled distributions
@@ -66,7 +71,9 @@ namespace OpenMS
     }
 
     //set the intensities of feature_ints to the normalized intensities
-    for (Size i = 0; i < number_of_maps; ++i)
+    //again independent per map (sorting dominates), so run in parallel
+#pragma omp parallel for schedule(dynamic)
+    for (SignedSize i = 0; i < (SignedSize)number_of_maps; ++i)
     {
       // We do not want to change the order in feature_ints[i] but normalized_sorted_ints
       // comes sorted, so we transfer the values in feature_ints[i] into pairs that store
@@ -97,6 +104,105 @@ namespace OpenMS
     setNormalizedIntensityValues(feature_ints, map);
   }
 
+  void ConsensusMapNormalizerAlgorithmQuantile::normalizeMapsApproximate(ConsensusMap& map, Size sketch_accuracy)
+  {
+    Size number_of_maps = map.getColumnHeaders().size();
+    for (UInt i = 0; i < number_of_maps; i++)
+    {
+      if (map.getColumnHeaders().find(i) == map.getColumnHeaders().end())
+      {
+        throw Exception::ElementNotFound(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, String(i));
+      }
+    }
+    if (number_of_maps == 0 || map.empty())
+    {
+      return;
+    }
+
+    //single streaming pass: one bounded-memory sketch per map instead of full intensity vectors
+    vector<Math::QuantileSketch> sketches(number_of_maps, Math::QuantileSketch(sketch_accuracy));
+    for (ConsensusMap::ConstIterator cf_it = map.begin(); cf_it != map.end(); ++cf_it)
+    {
+      ConsensusFeature::HandleSetType::const_iterator f_it;
+      for (f_it = cf_it->getFeatures().begin(); f_it != cf_it->getFeatures().end(); ++f_it)
+      {
+        sketches[f_it->getMapIndex()].add(f_it->getIntensity());
+      }
+    }
+
+    //sorted snapshots of the sketches for fast repeated rank/quantile lookups
+    vector<vector<double> > sketch_values(number_of_maps);
+    vector<vector<double> > sketch_fractions(number_of_maps);
+    for (Size i = 0; i < number_of_maps; ++i)
+    {
+      sketches[i].getCumulative(sketch_values[i], sketch_fractions[i]);
+    }
+
+    //the quantile function of map j evaluated at rank phi (step function over the snapshot)
+    auto step_quantile = [&sketches, &sketch_values, &sketch_fractions](Size j, double phi) -> double
+    {
+      if (phi >= 1.0)
+      {
+        return sketches[j].maxValue();
+      }
+      Size idx = std::lower_bound(sketch_fractions[j].begin(), sketch_fractions[j].end(), phi) - sketch_fractions[j].begin();
+      return (idx < sketch_values[j].size()) ? sketch_values[j][idx] : sketches[j].maxValue();
+    };
+
+    Size n_used_maps = 0;
+    double normalized_at_zero = 0.0; //for intensities below every summarized value of their map
+    for (Size i = 0; i < number_of_maps; ++i)
+    {
+      if (sketches[i].count() == 0)
+      {
+        continue;
+      }
+      ++n_used_maps;
+      normalized_at_zero += sketches[i].minValue();
+    }
+    normalized_at_zero /= (double)n_used_maps;
+
+    //reference distribution = mean of all maps' quantile functions, precomputed
+    //at every rank step a feature of the respective map can fall on
+    vector<vector<double> > normalized_at_rank(number_of_maps);
+#pragma omp parallel for schedule(dynamic)
+    for (SignedSize i = 0; i < (SignedSize)number_of_maps; ++i)
+    {
+      normalized_at_rank[i].resize(sketch_fractions[i].size());
+      for (Size r = 0; r < sketch_fractions[i].size(); ++r)
+      {
+        double sum = 0.0;
+        for (Size j = 0; j < number_of_maps; ++j)
+        {
+          if (sketches[j].count() == 0)
+          {
+            continue;
+          }
+          sum += step_quantile(j, sketch_fractions[i][r]);
+        }
+        normalized_at_rank[i][r] = sum / (double)n_used_maps;
+      }
+    }
+
+    //remap every intensity onto the reference distribution at its estimated rank;
+    //the features are independent here, so this pass runs in parallel
+#pragma omp parallel for schedule(dynamic)
+    for (SignedSize f = 0; f < (SignedSize)map.size(); ++f)
+    {
+      ConsensusFeature::HandleSetType::const_iterator f_it;
+      for (f_it = map[f].getFeatures().begin(); f_it != map[f].getFeatures().end(); ++f_it)
+      {
+        const Size map_idx = f_it->getMapIndex();
+        const vector<double>& values = sketch_values[map_idx];
+
+        //rank step of the intensity in its own map
+        Size idx = std::upper_bound(values.begin(), values.end(), (double)f_it->getIntensity()) - values.begin();
+        const double normalized = (idx == 0) ? normalized_at_zero : normalized_at_rank[map_idx][idx - 1];
+        f_it->asMutable().setIntensity(normalized);
+      }
+    }
+  }
+
   void ConsensusMapNormalizerAlgorithmQuantile::resample(const vector<double>& data_in, vector<double>& data_out, UInt n_resampling_points)
   {
     data_out.clear();
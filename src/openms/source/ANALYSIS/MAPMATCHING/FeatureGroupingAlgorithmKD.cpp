@@ -301,12 +301,13 @@ namespace OpenMS
       }
 
       // compile set of all points whose neighborhoods will need updating
+      // (query the neighborhoods of all sub features in one parallel batch)
       update_these = set<Size>();
-      for (vector<Size>::const_iterator f_it = cf_indices.begin(); f_it != cf_indices.end(); ++f_it)
+      vector<vector<Size> > cf_neighbors;
+      kd_data.getNeighborhoods(cf_indices, cf_neighbors, rt_tol_secs_, mz_tol_, mz_ppm_, true);
+      for (vector<vector<Size> >::const_iterator n_it = cf_neighbors.begin(); n_it != cf_neighbors.end(); ++n_it)
       {
-        vector<Size> f_neighbors;
-        kd_data.getNeighborhood(*f_it, f_neighbors, rt_tol_secs_, mz_tol_, mz_ppm_, true);
-        for (vector<Size>::const_iterator it = f_neighbors.begin(); it != f_neighbors.end(); ++it)
+        for (vector<Size>::const_iterator it = n_it->begin(); it != n_it->end(); ++it)
         {
           if (!assigned[*it])
           {
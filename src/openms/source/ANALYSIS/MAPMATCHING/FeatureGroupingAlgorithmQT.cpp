@@ -13,6 +13,11 @@
 #include <OpenMS/METADATA/PeptideIdentification.h>
 
 #include <OpenMS/ANALYSIS/MAPMATCHING/FeatureGroupingAlgorithm.h>
+#include <OpenMS/CONCEPT/LogStream.h>
+
+#include <algorithm>
+#include <cmath>
+#include <set>
 
 using namespace std;
 
@@ -20,7 +25,7 @@ namespace OpenMS
 {
 
   FeatureGroupingAlgorithmQT::FeatureGroupingAlgorithmQT() :
-    FeatureGroupingAlgorithm()
+    FeatureGroupingAlgorithm(), session_active_(false)
   {
     setName("FeatureGroupingAlgorithmQT");
     defaults_.insert("", QTClusterFinder().getParameters());
@@ -60,4 +65,222 @@ namespace OpenMS
     group_(maps, out);
   }
 
+  void FeatureGroupingAlgorithmQT::beginIncremental(const vector<FeatureMap>& maps,
+                                                    ConsensusMap& out)
+  {
+    session_maps_ = maps;
+    // the session maps consensus features back to their original features via unique ids:
+    for (FeatureMap& map : session_maps_)
+    {
+      map.applyMemberFunction(&UniqueIdInterface::ensureUniqueId);
+      map.updateRanges();
+    }
+    session_result_ = ConsensusMap();
+    group(session_maps_, session_result_);
+    session_active_ = true;
+    out = session_result_;
+  }
+
+  Size FeatureGroupingAlgorithmQT::addMap(const FeatureMap& map, ConsensusMap& out)
+  {
+    if (!session_active_)
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+                                       "No incremental session active - call beginIncremental() first");
+    }
+    Size map_index = session_maps_.size();
+    session_maps_.push_back(map);
+    FeatureMap& new_map = session_maps_.back();
+    new_map.applyMemberFunction(&UniqueIdInterface::ensureUniqueId);
+    new_map.updateRanges();
+
+    relinkIncremental_(new_map, map_index, true);
+
+    // append identification meta data, as postprocess_() does for a full run:
+    session_result_.getProteinIdentifications().insert(
+        session_result_.getProteinIdentifications().end(),
+        new_map.getProteinIdentifications().begin(),
+        new_map.getProteinIdentifications().end());
+    for (const PeptideIdentification& pep_id :
+           new_map.getUnassignedPeptideIdentifications())
+    {
+      PeptideIdentification new_pep_id = pep_id;
+      new_pep_id.setMetaValue("map_index", map_index);
+      session_result_.getUnassignedPeptideIdentifications().push_back(new_pep_id);
+    }
+
+    out = session_result_;
+    return map_index;
+  }
+
+  void FeatureGroupingAlgorithmQT::retireMap(Size map_index, ConsensusMap& out)
+  {
+    if (!session_active_)
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+                                       "No incremental session active - call beginIncremental() first");
+    }
+    if (map_index >= session_maps_.size() || session_maps_[map_index].empty())
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+                                       "Invalid or already retired map index: " + String(map_index));
+    }
+
+    // empty the slot first, so that relinking cannot resurrect the retired features;
+    // the indices of the remaining maps stay stable
+    FeatureMap retired;
+    retired.swapFeaturesOnly(session_maps_[map_index]);
+
+    relinkIncremental_(retired, map_index, false);
+
+    // drop unassigned peptide identifications of the retired map:
+    auto& unassigned = session_result_.getUnassignedPeptideIdentifications();
+    unassigned.erase(remove_if(unassigned.begin(), unassigned.end(),
+                               [map_index](const PeptideIdentification& pep_id)
+                               {
+                                 if (!pep_id.metaValueExists("map_index")) return false;
+                                 Size index = pep_id.getMetaValue("map_index");
+                                 return index == map_index;
+                               }),
+                     unassigned.end());
+
+    out = session_result_;
+  }
+
+  void FeatureGroupingAlgorithmQT::relinkIncremental_(const FeatureMap& changed,
+                                                      Size changed_index, bool is_new)
+  {
+    if (changed.empty() && session_result_.empty()) return;
+
+    // the linking tolerances define the cell size of the closure computation below;
+    // a ppm m/z tolerance is converted using the largest m/z of the session (conservative):
+    double max_diff_rt = param_.getValue("distance_RT:max_difference");
+    double max_diff_mz = param_.getValue("distance_MZ:max_difference");
+    if (param_.getValue("distance_MZ:unit") == "ppm")
+    {
+      double max_mz = 0.0;
+      for (const FeatureMap& map : session_maps_)
+      {
+        if (!map.empty()) max_mz = max(max_mz, map.getMaxMZ());
+      }
+      max_diff_mz *= max_mz * 1e-6;
+    }
+
+    // features within the tolerances of each other always share a cell or sit in adjacent ones
+    auto cell_of = [max_diff_rt, max_diff_mz](double rt, double mz)
+    {
+      return make_pair(Int(floor(rt / max_diff_rt)), Int(floor(mz / max_diff_mz)));
+    };
+
+    set<pair<Int, Int>> dirty_cells;
+    for (const Feature& feature : changed)
+    {
+      dirty_cells.insert(cell_of(feature.getRT(), feature.getMZ()));
+    }
+
+    auto is_dirty = [&dirty_cells, &cell_of](double rt, double mz)
+    {
+      const pair<Int, Int> cell = cell_of(rt, mz);
+      for (Int i = cell.first - 1; i <= cell.first + 1; ++i)
+      {
+        for (Int j = cell.second - 1; j <= cell.second + 1; ++j)
+        {
+          if (dirty_cells.find(make_pair(i, j)) != dirty_cells.end()) return true;
+        }
+      }
+      return false;
+    };
+
+    // transitive closure: dissolve every consensus feature within the tolerances of a changed
+    // feature and treat its own features as changed in turn - at the fixpoint, no cluster can
+    // connect the dissolved region with the kept consensus features, so relinking the region
+    // in isolation yields the same result as a full rerun
+    vector<bool> dissolved(session_result_.size(), false);
+    bool converged = false;
+    while (!converged)
+    {
+      converged = true;
+      for (Size i = 0; i < session_result_.size(); ++i)
+      {
+        if (dissolved[i]) continue;
+        for (const FeatureHandle& handle : session_result_[i].getFeatures())
+        {
+          if (is_dirty(handle.getRT(), handle.getMZ()))
+          {
+            dissolved[i] = true;
+            converged = false;
+            for (const FeatureHandle& member : session_result_[i].getFeatures())
+            {
+              dirty_cells.insert(cell_of(member.getRT(), member.getMZ()));
+            }
+            break;
+          }
+        }
+      }
+    }
+
+    // collect the original features of the dissolved consensus features (plus all features of
+    // a newly added map) into one sub-map per session map:
+    vector<FeatureMap> sub_maps(session_maps_.size());
+    if (is_new)
+    {
+      sub_maps[changed_index] = changed;
+    }
+    Size num_dissolved = 0;
+    for (Size i = 0; i < session_result_.size(); ++i)
+    {
+      if (!dissolved[i]) continue;
+      ++num_dissolved;
+      for (const FeatureHandle& handle : session_result_[i].getFeatures())
+      {
+        Size handle_map = handle.getMapIndex();
+        // features of a retired map are no longer in the session and simply drop out here:
+        Size feature_index = session_maps_[handle_map].uniqueIdToIndex(handle.getUniqueId());
+        if (feature_index == Size(-1)) continue;
+        sub_maps[handle_map].push_back(session_maps_[handle_map][feature_index]);
+      }
+    }
+
+    // remove the dissolved consensus features from the session result:
+    Size kept = 0;
+    for (Size i = 0; i < session_result_.size(); ++i)
+    {
+      if (!dissolved[i])
+      {
+        if (kept != i) session_result_[kept] = std::move(session_result_[i]);
+        ++kept;
+      }
+    }
+    session_result_.resize(kept);
+
+    Size num_features = 0;
+    for (FeatureMap& sub_map : sub_maps)
+    {
+      num_features += sub_map.size();
+      sub_map.updateRanges();
+    }
+    if (num_features == 0) return; // nothing in the vicinity of the changed features
+
+    OPENMS_LOG_INFO << "Incremental linking: relinking " << num_features
+                    << " features from " << num_dissolved
+                    << " dissolved consensus features (" << kept
+                    << " consensus features untouched)." << endl;
+
+    QTClusterFinder cluster_finder;
+    cluster_finder.setParameters(param_.copy("", true));
+    ConsensusMap relinked;
+    cluster_finder.run(sub_maps, relinked);
+
+    session_result_.reserve(session_result_.size() + relinked.size());
+    for (ConsensusFeature& cf : relinked)
+    {
+      session_result_.push_back(std::move(cf));
+    }
+
+    // restore the canonical ordering established by postprocess_():
+    session_result_.sortByQuality();
+    session_result_.sortByMaps();
+    session_result_.sortBySize();
+  }
+
 } // namespace OpenMS
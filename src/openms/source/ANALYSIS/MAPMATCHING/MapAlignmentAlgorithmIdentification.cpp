@@ -199,9 +199,12 @@ namespace OpenMS
     // filter RT data (remove peptides that elute in several fractions):
     // TODO
 
-    // compute RT medians:
+    // compute RT medians (runs are independent of each other):
     OPENMS_LOG_DEBUG << "Computing RT medians..." << endl;
     vector<SeqToValue> medians_per_run(size);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
     for (Int i = 0; i < size; ++i)
     {
       computeMedians_(rt_data[i], medians_per_run[i], sorted);
@@ -289,6 +292,43 @@ namespace OpenMS
 
     // generate RT transformations:
     OPENMS_LOG_DEBUG << "Generating RT transformations..." << endl;
+
+    // collect the reference matches of all runs in parallel (runs are
+    // independent); assembly and diagnostic output stay serial below to keep
+    // the original ordering
+    vector<TransformationDescription::DataPoints> data_per_run(size);
+    vector<Size> outliers_per_run(size, 0);
+    if (!reference_.empty())
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for (Int i = 0; i < size; ++i)
+      {
+        // to be useful for the alignment, a peptide sequence has to occur in the
+        // current run ("medians_per_run[i]"), but also in at least one other run
+        // ("medians_overall"):
+        for (SeqToValue::iterator med_it = medians_per_run[i].begin();
+             med_it != medians_per_run[i].end(); ++med_it)
+        {
+          SeqToValue::const_iterator pos = reference_.find(med_it->first);
+          if (pos != reference_.end())
+          {
+            if (abs(med_it->second - pos->second) <= max_rt_shift)
+            { // found, and satisfies "max_rt_shift" condition!
+              TransformationDescription::DataPoint point(med_it->second,
+                                                         pos->second, pos->first);
+              data_per_run[i].push_back(point);
+            }
+            else
+            {
+              outliers_per_run[i]++;
+            }
+          }
+        }
+      }
+    }
+
     OPENMS_LOG_INFO << "\nAlignment based on:" << endl; // diagnostic output
     Size offset = 0; // offset in case of internal reference
     for (Int i = 0; i < size + 1; ++i)
@@ -314,35 +354,12 @@ namespace OpenMS
         transforms.push_back(trafo);
         continue;
       }
-                
-      // to be useful for the alignment, a peptide sequence has to occur in the
-      // current run ("medians_per_run[i]"), but also in at least one other run
-      // ("medians_overall"):
-      TransformationDescription::DataPoints data;
-      Size n_outliers = 0;
-      for (SeqToValue::iterator med_it = medians_per_run[i].begin();
-           med_it != medians_per_run[i].end(); ++med_it)
-      {
-        SeqToValue::const_iterator pos = reference_.find(med_it->first);
-        if (pos != reference_.end())
-        {
-          if (abs(med_it->second - pos->second) <= max_rt_shift)
-          { // found, and satisfies "max_rt_shift" condition!
-            TransformationDescription::DataPoint point(med_it->second,
-                                                       pos->second, pos->first);
-            data.push_back(point);
-          }
-          else
-          {
-            n_outliers++;
-          }
-        }
-      }
-      transforms.emplace_back(data);
-      OPENMS_LOG_INFO << "- " << data.size() << " data points for sample "
+
+      transforms.emplace_back(data_per_run[i]);
+      OPENMS_LOG_INFO << "- " << data_per_run[i].size() << " data points for sample "
                << i + offset + 1;
-      if (n_outliers) OPENMS_LOG_INFO << " (" << n_outliers << " outliers removed)";
-      OPENMS_LOG_INFO << "\n";    
+      if (outliers_per_run[i]) OPENMS_LOG_INFO << " (" << outliers_per_run[i] << " outliers removed)";
+      OPENMS_LOG_INFO << "\n";
     }
     OPENMS_LOG_INFO << endl;
 
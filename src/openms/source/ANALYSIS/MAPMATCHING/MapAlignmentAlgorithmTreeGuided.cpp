@@ -159,8 +159,6 @@ namespace OpenMS
                                                             std::vector<Size>& trafo_order)
   {
     Size last_trafo = 0;  // to get final transformation order from map_sets
-    vector<TransformationDescription> transformations_align;  // temporary for aligner output
-    vector<FeatureMap> to_align;
 
     // helper to memorize rt transformation order
     vector<vector<Size>> map_sets(feature_maps_transformed.size());
@@ -169,9 +167,6 @@ namespace OpenMS
       map_sets[i].push_back(i);
     }
 
-    Size ref;
-    Size to_transform;
-
     // check RT ranges of IDs
     for (size_t i = 0; i < maps_ranges.size(); ++i)
     {
@@ -180,64 +175,106 @@ namespace OpenMS
       if (maps_ranges[i].empty()) throw Exception::MissingInformation(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "FeatureMap originating from '" + ListUtils::concatenate(p, "', '") + "' contains no Peptide Identifications. Cannot align!");
     }
 
-    for (const auto& node : tree)
+    // A tree node only depends on the nodes that produced its two child
+    // clusters; siblings of the same tree level operate on disjoint sets of
+    // maps. Group the nodes by level (one more than the deepest node that
+    // last wrote one of the child clusters) so each level can be aligned in
+    // parallel while the levels themselves stay in tree order.
+    vector<Size> node_level(tree.size(), 0);
+    Size nr_levels = 0;
     {
-      // ----------------
-      // prepare alignment
-      // ----------------
-      //  determine the map with larger RT range for 10/90 percentile (->reference)
-      double left_range = maps_ranges[node.left_child][maps_ranges[node.left_child].size()*0.9] - maps_ranges[node.left_child][maps_ranges[node.left_child].size()*0.1];
-      double right_range = maps_ranges[node.right_child][maps_ranges[node.right_child].size()*0.9] - maps_ranges[node.right_child][maps_ranges[node.right_child].size()*0.1];
-
-      if (left_range > right_range)
-      {
-        ref = node.left_child;
-        to_transform = node.right_child;
-      }
-      else
+      vector<SignedSize> last_writer(feature_maps_transformed.size(), -1);
+      for (Size i = 0; i < tree.size(); ++i)
       {
-        ref = node.right_child;
-        to_transform = node.left_child;
+        Size level = 0;
+        if (last_writer[tree[i].left_child] >= 0)
+        {
+          level = node_level[last_writer[tree[i].left_child]] + 1;
+        }
+        if (last_writer[tree[i].right_child] >= 0)
+        {
+          level = max(level, node_level[last_writer[tree[i].right_child]] + 1);
+        }
+        node_level[i] = level;
+        nr_levels = max(nr_levels, level + 1);
+        last_writer[tree[i].left_child] = i;
+        last_writer[tree[i].right_child] = i;
       }
+    }
+    vector<vector<Size>> levels(nr_levels);
+    for (Size i = 0; i < tree.size(); ++i)
+    {
+      levels[node_level[i]].push_back(i);
+    }
 
-      vector<double> tmp;
-      std::merge(maps_ranges[node.right_child].begin(), maps_ranges[node.right_child].end(), maps_ranges[node.left_child].begin(), maps_ranges[node.left_child].end(), std::back_inserter(tmp));
-
-      to_align.push_back(feature_maps_transformed[to_transform]);
-      to_align.push_back(feature_maps_transformed[ref]);
-
-      // ----------------
-      // perform alignment
-      // ----------------
-      align_algorithm_.align(to_align, transformations_align, 1);
-
-      // transform retention times of non-identity for next iteration
-      transformations_align[0].fitModel(model_type_, model_param_);
-      MapAlignmentTransformer::transformRetentionTimes(feature_maps_transformed[to_transform],
-              transformations_align[0], true);
-
-      // combine aligned maps, store at smaller index, because tree always calls smaller number
-      // clear feature map at larger index to save memory
-      feature_maps_transformed[ref] += feature_maps_transformed[to_transform];
-      feature_maps_transformed[ref].updateRanges();
-      if (ref < to_transform)
-      {
-        feature_maps_transformed[to_transform].clear(true);
-        last_trafo = ref;
-      }
-      else
+    const Param align_param = align_algorithm_.getParameters();
+    for (const vector<Size>& level : levels)
+    {
+#pragma omp parallel for schedule(dynamic)
+      for (SignedSize n = 0; n < static_cast<SignedSize>(level.size()); ++n)
       {
-        feature_maps_transformed[to_transform] = feature_maps_transformed[ref];
-        feature_maps_transformed[ref].clear(true);
-        last_trafo = to_transform;
-      }
+        const BinaryTreeNode& node = tree[level[n]];
+        // ----------------
+        // prepare alignment
+        // ----------------
+        //  determine the map with larger RT range for 10/90 percentile (->reference)
+        double left_range = maps_ranges[node.left_child][maps_ranges[node.left_child].size()*0.9] - maps_ranges[node.left_child][maps_ranges[node.left_child].size()*0.1];
+        double right_range = maps_ranges[node.right_child][maps_ranges[node.right_child].size()*0.9] - maps_ranges[node.right_child][maps_ranges[node.right_child].size()*0.1];
+
+        Size ref;
+        Size to_transform;
+        if (left_range > right_range)
+        {
+          ref = node.left_child;
+          to_transform = node.right_child;
+        }
+        else
+        {
+          ref = node.right_child;
+          to_transform = node.left_child;
+        }
 
-      // update order of alignment for both aligned maps
-      map_sets[ref].insert(map_sets[ref].end(), map_sets[to_transform].begin(), map_sets[to_transform].end());
-      map_sets[to_transform] = map_sets[ref];
+        vector<FeatureMap> to_align;
+        to_align.push_back(feature_maps_transformed[to_transform]);
+        to_align.push_back(feature_maps_transformed[ref]);
+
+        // ----------------
+        // perform alignment
+        // ----------------
+        // the member aligner holds per-run state, so every node uses its own
+        // instance with the same parameters
+        MapAlignmentAlgorithmIdentification aligner;
+        aligner.setParameters(align_param);
+        vector<TransformationDescription> transformations_align;  // temporary for aligner output
+        aligner.align(to_align, transformations_align, 1);
+
+        // transform retention times of non-identity for next iteration
+        transformations_align[0].fitModel(model_type_, model_param_);
+        MapAlignmentTransformer::transformRetentionTimes(feature_maps_transformed[to_transform],
+                transformations_align[0], true);
+
+        // combine aligned maps, store at smaller index, because tree always calls smaller number
+        // clear feature map at larger index to save memory
+        feature_maps_transformed[ref] += feature_maps_transformed[to_transform];
+        feature_maps_transformed[ref].updateRanges();
+        if (ref < to_transform)
+        {
+          feature_maps_transformed[to_transform].clear(true);
+        }
+        else
+        {
+          feature_maps_transformed[to_transform] = feature_maps_transformed[ref];
+          feature_maps_transformed[ref].clear(true);
+        }
 
-      transformations_align.clear();
-      to_align.clear();
+        // update order of alignment for both aligned maps
+        map_sets[ref].insert(map_sets[ref].end(), map_sets[to_transform].begin(), map_sets[to_transform].end());
+        map_sets[to_transform] = map_sets[ref];
+      }
+    }
+    if (!tree.empty())
+    { // the final merge ends up at the smaller of the last node's child indices
+      last_trafo = min(tree.back().left_child, tree.back().right_child);
     }
     // copy last transformed FeatureMap for reference return
     map_transformed = feature_maps_transformed[last_trafo];
@@ -13,6 +13,8 @@
 
 #include <boost/math/special_functions/fpclassify.hpp> // isnan
 
+#include <algorithm>
+
 // #define Debug_PoseClusteringAffineSuperimposer
 
 namespace OpenMS
@@ -151,25 +153,51 @@ namespace OpenMS
       dump_pairs_file << "#" << ' ' << "i" << ' ' << "j" << ' ' << "k" << ' ' << "l" << ' ' << std::endl;
     }
 
+    // both maps are sorted by ascending m/z, so the m/z windows of the serial
+    // sliding-window formulation can be re-derived for any i by binary search;
+    // this makes the outer loop iterations independent and allows hashing the
+    // votes into per-thread histograms which are merged at the end
+    auto mz_window = [mz_pair_max_distance](const std::vector<Peak2D>& map, double mz, Size& low, Size& high)
+    {
+      low = std::lower_bound(map.begin(), map.end(), mz - mz_pair_max_distance,
+                             [](const Peak2D& p, double value) { return p.getMZ() < value; }) - map.begin();
+      high = std::upper_bound(map.begin(), map.end(), mz + mz_pair_max_distance,
+                              [](double value, const Peak2D& p) { return value < p.getMZ(); }) - map.begin();
+    };
+
+#ifdef _OPENMP
+#pragma omp parallel if (!do_dump_pairs) // dump order must stay deterministic
+#endif
+    {
+    // per-thread histograms: same mapping as the shared ones, but zeroed data
+    Math::LinearInterpolation<double, double> scaling_hash_1_local(scaling_hash_1);
+    Math::LinearInterpolation<double, double> scaling_hash_2_local(scaling_hash_2);
+    Math::LinearInterpolation<double, double> rt_low_hash_local(rt_low_hash_);
+    Math::LinearInterpolation<double, double> rt_high_hash_local(rt_high_hash_);
+    std::fill(scaling_hash_1_local.getData().begin(), scaling_hash_1_local.getData().end(), 0.0);
+    std::fill(scaling_hash_2_local.getData().begin(), scaling_hash_2_local.getData().end(), 0.0);
+    std::fill(rt_low_hash_local.getData().begin(), rt_low_hash_local.getData().end(), 0.0);
+    std::fill(rt_high_hash_local.getData().begin(), rt_high_hash_local.getData().end(), 0.0);
+
     // first point in model map (i)
-    for (Size i = 0, i_low = 0, i_high = 0, k_low = 0, k_high = 0; i < model_map_size - 1; ++i)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+    for (SignedSize i_signed = 0; i_signed < (SignedSize)model_map_size - 1; ++i_signed)
     {
-      // Adjust window around i in model map (get all features in a m/z range of item i in the model map)
-      while (i_low < model_map_size && model_map[i_low].getMZ() < model_map[i].getMZ() - mz_pair_max_distance)
-        ++i_low;
-      while (i_high < model_map_size && model_map[i_high].getMZ() <= model_map[i].getMZ() + mz_pair_max_distance)
-        ++i_high;
+      const Size i = i_signed;
+      // window around i in model map (get all features in a m/z range of item i in the model map)
+      Size i_low, i_high;
+      mz_window(model_map, model_map[i].getMZ(), i_low, i_high);
       // stop if there are too many features are in our window
       double i_winlength_factor = 1. / (i_high - i_low);
       i_winlength_factor -= winlength_factor_baseline;
       if (i_winlength_factor <= 0)
         continue;
 
-      // Adjust window around k in scene map (get all features in a m/z range of item i in the scene map)
-      while (k_low < scene_map_size && scene_map[k_low].getMZ() < model_map[i].getMZ() - mz_pair_max_distance)
-        ++k_low;
-      while (k_high < scene_map_size && scene_map[k_high].getMZ() <= model_map[i].getMZ() + mz_pair_max_distance)
-        ++k_high;
+      // window around k in scene map (get all features in a m/z range of item i in the scene map)
+      Size k_low, k_high;
+      mz_window(scene_map, model_map[i].getMZ(), k_low, k_high);
 
       // Iterate through all matching features in the scene map that are
       // within the m/z distance of item i from the model map.
@@ -257,17 +285,17 @@ namespace OpenMS
             if (hashing_round == 1)
             {
               // hashing round 1 (estimate the scaling only)
-              scaling_hash_1.addValue(log(scaling), similarity_ik_jl);
+              scaling_hash_1_local.addValue(log(scaling), similarity_ik_jl);
             }
             else if (scaling >= scale_low_1 && scaling <= scale_high_1)
             {
               // hashing round 2 (estimate scaling and shift)
-              scaling_hash_2.addValue(log(scaling), similarity_ik_jl);
+              scaling_hash_2_local.addValue(log(scaling), similarity_ik_jl);
 
               const double rt_low_image = shift + rt_low * scaling;
-              rt_low_hash_.addValue(rt_low_image, similarity_ik_jl);
+              rt_low_hash_local.addValue(rt_low_image, similarity_ik_jl);
               const double rt_high_image = shift + rt_high * scaling;
-              rt_high_hash_.addValue(rt_high_image, similarity_ik_jl);
+              rt_high_hash_local.addValue(rt_high_image, similarity_ik_jl);
 
               if (do_dump_pairs)
               {
@@ -280,6 +308,30 @@ namespace OpenMS
         }   // j
       }   // k
     }   // i
+
+    // merge the per-thread histograms into the shared ones
+#ifdef _OPENMP
+#pragma omp critical (OpenMS_PoseClusteringAffineSuperimposer_hashes)
+#endif
+    {
+      for (Size index = 0; index < scaling_hash_1.getData().size(); ++index)
+      {
+        scaling_hash_1.getData()[index] += scaling_hash_1_local.getData()[index];
+      }
+      for (Size index = 0; index < scaling_hash_2.getData().size(); ++index)
+      {
+        scaling_hash_2.getData()[index] += scaling_hash_2_local.getData()[index];
+      }
+      for (Size index = 0; index < rt_low_hash_.getData().size(); ++index)
+      {
+        rt_low_hash_.getData()[index] += rt_low_hash_local.getData()[index];
+      }
+      for (Size index = 0; index < rt_high_hash_.getData().size(); ++index)
+      {
+        rt_high_hash_.getData()[index] += rt_high_hash_local.getData()[index];
+      }
+    }
+    }   // parallel
   }
 
   /**
@@ -130,6 +130,14 @@ namespace OpenMS
     return spline_->eval(value);
   }
 
+  void TransformationModelBSpline::evaluate(std::vector<double>& values) const
+  {
+    for (double& value : values)
+    { // qualified call, so no per-value virtual dispatch
+      value = TransformationModelBSpline::evaluate(value);
+    }
+  }
+
   void TransformationModelBSpline::getDefaultParameters(Param& params)
   {
     params.clear();
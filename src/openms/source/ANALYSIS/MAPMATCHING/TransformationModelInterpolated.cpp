@@ -393,6 +393,14 @@ private:
     return interp_->eval(value);
   }
 
+  void TransformationModelInterpolated::evaluate(std::vector<double>& values) const
+  {
+    for (double& value : values)
+    { // qualified call, so no per-value virtual dispatch
+      value = TransformationModelInterpolated::evaluate(value);
+    }
+  }
+
   void TransformationModelInterpolated::getDefaultParameters(Param& params)
   {
     params.clear();
@@ -98,6 +98,22 @@ namespace OpenMS
     return eval;
   }
 
+  void TransformationModelLinear::evaluate(std::vector<double>& values) const
+  {
+    if (!weighting_)
+    {
+      for (double& value : values)
+      {
+        value = slope_ * value + intercept_;
+      }
+      return;
+    }
+    for (double& value : values)
+    {
+      value = TransformationModelLinear::evaluate(value);
+    }
+  }
+
   void TransformationModelLinear::invert()
   {
     if (slope_ == 0)
@@ -98,6 +98,63 @@ namespace OpenMS
     }
   }
 
+  void ChromatogramExtractor::extractChromatograms(const OpenSwath::SpectrumAccessPtr input,
+                                                   ChromatogramBundle& output,
+                                                   const std::vector<ExtractionCoordinates>& extraction_coordinates,
+                                                   double mz_extraction_window,
+                                                   bool ppm,
+                                                   double im_extraction_window,
+                                                   const String& filter)
+  {
+    std::vector< OpenSwath::ChromatogramPtr > chromatograms;
+    chromatograms.reserve(extraction_coordinates.size());
+    for (Size i = 0; i < extraction_coordinates.size(); ++i)
+    {
+      chromatograms.push_back(OpenSwath::ChromatogramPtr(new OpenSwath::Chromatogram));
+    }
+    ChromatogramExtractorAlgorithm().extractChromatograms(input, chromatograms,
+        extraction_coordinates, mz_extraction_window, ppm, im_extraction_window, filter);
+
+    output.clear();
+    if (chromatograms.empty())
+    {
+      return;
+    }
+
+    // all chromatograms sample the RT of every spectrum, so the time axis of
+    // the first one is the shared RT axis of the bundle
+    const std::vector<double>& rts = chromatograms[0]->getTimeArray()->data;
+    output.setRTs(ChromatogramBundle::RTArrayType(rts.begin(), rts.end()));
+    output.reserve(chromatograms.size());
+
+    std::vector<ChromatogramBundle::IntensityType> intensities(rts.size());
+    for (Size i = 0; i < chromatograms.size(); ++i)
+    {
+      if (chromatograms[i]->getTimeArray()->data != rts)
+      {
+        throw Exception::InvalidParameter(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+            "ChromatogramExtractor: extracted chromatograms do not share one RT axis. "
+            "Extract without an RT restriction to use ChromatogramBundle output.");
+      }
+      const std::vector<double>& data = chromatograms[i]->getIntensityArray()->data;
+      for (Size p = 0; p < data.size(); ++p)
+      {
+        intensities[p] = ChromatogramBundle::IntensityType(data[p]);
+      }
+
+      ChromatogramSettings settings;
+      settings.setNativeID(extraction_coordinates[i].id);
+      Precursor prec;
+      prec.setMZ(extraction_coordinates[i].mz_precursor);
+      settings.setPrecursor(prec);
+      Product prod;
+      prod.setMZ(extraction_coordinates[i].mz);
+      settings.setProduct(prod);
+
+      output.addChromatogram(settings, intensities);
+    }
+  }
+
   void ChromatogramExtractor::prepare_coordinates(std::vector< OpenSwath::ChromatogramPtr > & output_chromatograms,
                                                   std::vector< ExtractionCoordinates > & coordinates,
                                                   const OpenSwath::LightTargetedExperiment & transition_exp_used,
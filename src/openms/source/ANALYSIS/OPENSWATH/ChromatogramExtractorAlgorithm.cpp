@@ -11,7 +11,10 @@
 #include <OpenMS/DATASTRUCTURES/String.h>
 
 #include <OpenMS/CONCEPT/Exception.h>
+
+#include <algorithm>
 #include <iostream>
+#include <numeric>
 
 namespace OpenMS
 {
@@ -45,77 +48,20 @@ namespace OpenMS
       right = mz + mz_extraction_window / 2.0;
     }
 
-    std::vector<double>::const_iterator mz_walker;
-    std::vector<double>::const_iterator int_walker;
-
-    // advance the mz / int iterator until we hit the m/z value of the next transition
-    while (mz_it != mz_end && (*mz_it) < mz)
-    {
-      mz_it++;
-      int_it++;
-    }
-
-    // walk right and left and add to our intensity
-    mz_walker  = mz_it;
-    int_walker = int_it;
-
-    // if we moved past the end of the spectrum, we need to try the last peak
-    // of the spectrum (it could still be within the window)
-    if (mz_it == mz_end)
-    {
-      --mz_walker;
-      --int_walker;
-    }
-
-    // add the current peak if it is between right and left
-    if ((*mz_walker) > left && (*mz_walker) < right)
-    {
-      integrated_intensity += (*int_walker);
-    }
-
-    // (i) Walk to the left one step and then keep walking left until we go
-    // outside the window. Note for the first step to the left we have to
-    // check for the walker becoming equal to the first data point.
-    mz_walker  = mz_it;
-    int_walker = int_it;
-    if (mz_it != mz_start)
-    {
-      --mz_walker;
-      --int_walker;
-
-      // Special case: target m/z is larger than first data point but the first
-      // data point is inside the window.
-      // Then, mz_it is the second data point, mz_walker now points to the very
-      // first data point. If mz_it was the first data point, we already added
-      // it above. We still need to add this point if it is inside the window
-      // (while loop below will not catch it)
-      if (mz_walker == mz_start && (*mz_walker) > left && (*mz_walker) < right)
-      {
-        integrated_intensity += (*int_walker);
-      }
-    }
-    while (mz_walker != mz_start && (*mz_walker) > left && (*mz_walker) < right)
-    {
-      integrated_intensity += (*int_walker);
-      --mz_walker;
-      --int_walker;
-    }
-
-    // (ii) Walk to the right one step and then keep walking right until we are
-    // outside the window
-    mz_walker  = mz_it;
-    int_walker = int_it;
-    if (mz_it != mz_end)
-    {
-      ++mz_walker;
-      ++int_walker;
-    }
-    while (mz_walker != mz_end && (*mz_walker) > left && (*mz_walker) < right)
-    {
-      integrated_intensity += (*int_walker);
-      ++mz_walker;
-      ++int_walker;
-    }
+    // advance the mz / int iterator until we hit the m/z value of the next
+    // transition (the coordinates are sorted by m/z, so we never go back)
+    const std::vector<double>::const_iterator mz_next = std::lower_bound(mz_it, mz_end, mz);
+    int_it += std::distance(mz_it, mz_next);
+    mz_it = mz_next;
+
+    // the peaks strictly inside (left, right) form one contiguous run of the
+    // sorted m/z array; its bounds are found by binary search and the
+    // corresponding intensities are summed in one tight loop (which the
+    // compiler can unroll and vectorize for wide extraction windows)
+    const std::vector<double>::const_iterator win_begin = std::upper_bound(mz_start, mz_it, left);
+    const std::vector<double>::const_iterator win_end = std::lower_bound(mz_it, mz_end, right);
+    integrated_intensity = std::accumulate(int_it + std::distance(mz_it, win_begin),
+                                           int_it + std::distance(mz_it, win_end), 0.0);
   }
 
   void ChromatogramExtractorAlgorithm::extract_value_tophat(
@@ -158,87 +104,28 @@ namespace OpenMS
     double left_im  = im - im_extraction_window / 2.0;
     double right_im = im + im_extraction_window / 2.0;
 
-    std::vector<double>::const_iterator mz_walker;
-    std::vector<double>::const_iterator im_walker;
-    std::vector<double>::const_iterator int_walker;
-
-    // advance the mz / int iterator until we hit the m/z value of the next transition
-    while (mz_it != mz_end && (*mz_it) < mz)
-    {
-      mz_it++;
-      im_it++;
-      int_it++;
-    }
-
-    // walk right and left and add to our intensity
-    mz_walker  = mz_it;
-    im_walker  = im_it;
-    int_walker = int_it;
-
-    // if we moved past the end of the spectrum, we need to try the last peak
-    // of the spectrum (it could still be within the window)
-    if (mz_it == mz_end)
-    {
-      --mz_walker;
-      --im_walker;
-      --int_walker;
-    }
-
-    // add the current peak if it is between right and left
-    if ((*mz_walker) > left && (*mz_walker) < right && (*im_walker) > left_im && (*im_walker) < right_im)
-    {
-      integrated_intensity += (*int_walker);
-    }
-
-    // (i) Walk to the left one step and then keep walking left until we go
-    // outside the window. Note for the first step to the left we have to
-    // check for the walker becoming equal to the first data point.
-    mz_walker  = mz_it;
-    int_walker = int_it;
-    im_walker = im_it;
-    if (mz_it != mz_start)
+    // advance the mz / int / im iterator until we hit the m/z value of the
+    // next transition (the coordinates are sorted by m/z, so we never go back)
+    const std::vector<double>::const_iterator mz_next = std::lower_bound(mz_it, mz_end, mz);
+    int_it += std::distance(mz_it, mz_next);
+    im_it += std::distance(mz_it, mz_next);
+    mz_it = mz_next;
+
+    // the peaks strictly inside (left, right) form one contiguous run of the
+    // sorted m/z array; within the run each peak additionally has to pass the
+    // ion mobility window (the data is not sorted by ion mobility)
+    const std::vector<double>::const_iterator win_begin = std::upper_bound(mz_start, mz_it, left);
+    const std::vector<double>::const_iterator win_end = std::lower_bound(mz_it, mz_end, right);
+    std::vector<double>::const_iterator im_walker = im_it + std::distance(mz_it, win_begin);
+    std::vector<double>::const_iterator int_walker = int_it + std::distance(mz_it, win_begin);
+    for (std::vector<double>::const_iterator mz_walker = win_begin; mz_walker != win_end;
+         ++mz_walker, ++im_walker, ++int_walker)
     {
-      --mz_walker;
-      --im_walker;
-      --int_walker;
-
-      // Special case: target m/z is larger than first data point but the first
-      // data point is inside the window.
-      // Then, mz_it is the second data point, mz_walker now points to the very
-      // first data point. If mz_it was the first data point, we already added
-      // it above. We still need to add this point if it is inside the window
-      // (while loop below will not catch it)
-      if (mz_walker == mz_start && (*mz_walker) > left && (*mz_walker) < right && (*im_walker) > left_im && (*im_walker) < right_im)
+      if (*im_walker > left_im && *im_walker < right_im)
       {
         integrated_intensity += (*int_walker);
       }
     }
-    while (mz_walker != mz_start && (*mz_walker) > left && (*mz_walker) < right)
-    {
-      if (*im_walker > left_im && *im_walker < right_im) integrated_intensity += (*int_walker);
-      --mz_walker;
-      --im_walker;
-      --int_walker;
-    }
-
-    // (ii) Walk to the right one step and then keep walking right until we are
-    // outside the window
-    mz_walker  = mz_it;
-    im_walker  = im_it;
-    int_walker = int_it;
-    if (mz_it != mz_end)
-    {
-      ++im_walker;
-      ++mz_walker;
-      ++int_walker;
-    }
-    while (mz_walker != mz_end && (*mz_walker) > left && (*mz_walker) < right)
-    {
-      if (*im_walker > left_im && *im_walker < right_im) integrated_intensity += (*int_walker);
-      ++mz_walker;
-      ++im_walker;
-      ++int_walker;
-    }
   }
 
   void ChromatogramExtractorAlgorithm::extractChromatograms(const OpenSwath::SpectrumAccessPtr& input,
@@ -250,7 +137,7 @@ namespace OpenMS
       const String& filter)
   {
     Size input_size = input->getNrSpectra();
-    if (input_size < 1)
+    if (input_size < 1 || extraction_coordinates.empty())
     {
       return;
     }
@@ -270,15 +157,78 @@ namespace OpenMS
         "Input to extractChromatogram needs to be sorted by m/z");
     }
 
+    // Collect the merged RT windows of all coordinates: spectra outside every
+    // window cannot contribute to any chromatogram, so we do not need to fetch
+    // them at all (for on-disc input this skips reading and decoding their
+    // binary data arrays). A coordinate without RT restriction (rt_end -
+    // rt_start <= 0, i.e. "extract the whole chromatogram") forces all spectra in.
+    std::vector<std::pair<double, double> > rt_windows;
+    bool restrict_rt = true;
+    for (const auto& coord : extraction_coordinates)
+    {
+      if (coord.rt_end - coord.rt_start <= 0)
+      {
+        restrict_rt = false;
+        break;
+      }
+      rt_windows.emplace_back(coord.rt_start, coord.rt_end);
+    }
+    if (restrict_rt && !rt_windows.empty())
+    {
+      std::sort(rt_windows.begin(), rt_windows.end());
+      Size merged = 0;
+      for (Size i = 1; i < rt_windows.size(); ++i)
+      {
+        if (rt_windows[i].first <= rt_windows[merged].second)
+        {
+          rt_windows[merged].second = std::max(rt_windows[merged].second, rt_windows[i].second);
+        }
+        else
+        {
+          rt_windows[++merged] = rt_windows[i];
+        }
+      }
+      rt_windows.resize(merged + 1);
+    }
+
+    // All coordinates together only ever touch the m/z strip from the lowest
+    // to the highest coordinate, each padded by its extraction window (the
+    // coordinates are sorted by m/z, see above). Inputs backed by seekable
+    // storage can then skip reading and decoding peaks outside the strip.
+    double mz_strip_start = extraction_coordinates.front().mz;
+    double mz_strip_end = extraction_coordinates.back().mz;
+    if (ppm)
+    {
+      mz_strip_start -= mz_strip_start * mz_extraction_window / 2.0 * 1.0e-6;
+      mz_strip_end += mz_strip_end * mz_extraction_window / 2.0 * 1.0e-6;
+    }
+    else
+    {
+      mz_strip_start -= mz_extraction_window / 2.0;
+      mz_strip_end += mz_extraction_window / 2.0;
+    }
+
     //go through all spectra
     startProgress(0, input_size, "Extracting chromatograms");
     for (Size scan_idx = 0; scan_idx < input_size; ++scan_idx)
     {
       setProgress(scan_idx);
 
-      OpenSwath::SpectrumPtr sptr = input->getSpectrumById(scan_idx);
       OpenSwath::SpectrumMeta s_meta = input->getSpectrumMetaById(scan_idx);
 
+      if (restrict_rt)
+      {
+        // first window whose end is not left of the current RT
+        auto win = std::lower_bound(rt_windows.begin(), rt_windows.end(), s_meta.RT,
+            [](const std::pair<double, double>& w, double rt) { return w.second < rt; });
+        if (win == rt_windows.end() || win->first > s_meta.RT)
+        {
+          continue; // no coordinate covers this spectrum
+        }
+      }
+
+      OpenSwath::SpectrumPtr sptr = input->getSpectrumMzSliceById(scan_idx, mz_strip_start, mz_strip_end);
+
       OpenSwath::BinaryDataArrayPtr mz_arr = sptr->getMZArray();
       OpenSwath::BinaryDataArrayPtr int_arr = sptr->getIntensityArray();
       std::vector<double>::const_iterator mz_start = mz_arr->data.begin();
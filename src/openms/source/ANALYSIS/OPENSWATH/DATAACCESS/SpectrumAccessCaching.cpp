@@ -0,0 +1,82 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/ANALYSIS/OPENSWATH/DATAACCESS/SpectrumAccessCaching.h>
+
+#include <iterator>
+#include <utility>
+
+namespace OpenMS
+{
+
+  SpectrumAccessCaching::SpectrumAccessCaching(OpenSwath::SpectrumAccessPtr sptr, Size cache_size) :
+    SpectrumAccessTransforming(std::move(sptr)),
+    cache_size_(cache_size),
+    cache_hits_(0),
+    cache_misses_(0)
+  {}
+
+  SpectrumAccessCaching::~SpectrumAccessCaching() = default;
+
+  boost::shared_ptr<OpenSwath::ISpectrumAccess> SpectrumAccessCaching::lightClone() const
+  {
+    return boost::shared_ptr<OpenSwath::ISpectrumAccess>(
+        new SpectrumAccessCaching(sptr_->lightClone(), cache_size_));
+  }
+
+  OpenSwath::SpectrumPtr SpectrumAccessCaching::getSpectrumById(int id)
+  {
+    std::map<int, OpenSwath::SpectrumPtr>::iterator pos = cache_.find(id);
+    if (pos != cache_.end())
+    {
+      ++cache_hits_;
+      return pos->second;
+    }
+    ++cache_misses_;
+
+    OpenSwath::SpectrumPtr spectrum = sptr_->getSpectrumById(id);
+    if (cache_size_ > 0)
+    {
+      if (cache_.size() >= cache_size_)
+      {
+        // keep a contiguous index neighborhood around the current request:
+        // evict whichever end of the cached index range is further away (for a
+        // forward walk through the run this drops spectra behind the RT window
+        // first, while local re-reads around the current position stay cached)
+        int lowest = cache_.begin()->first;
+        int highest = cache_.rbegin()->first;
+        if (id - lowest >= highest - id)
+        {
+          cache_.erase(cache_.begin());
+        }
+        else
+        {
+          cache_.erase(std::prev(cache_.end()));
+        }
+      }
+      cache_.emplace(id, spectrum);
+    }
+    return spectrum;
+  }
+
+  Size SpectrumAccessCaching::getCacheHits() const
+  {
+    return cache_hits_;
+  }
+
+  Size SpectrumAccessCaching::getCacheMisses() const
+  {
+    return cache_misses_;
+  }
+
+  void SpectrumAccessCaching::clearCache()
+  {
+    cache_.clear();
+  }
+
+} //end namespace OpenMS
@@ -39,6 +39,14 @@ namespace OpenMS
     int ms_level = -1;
     double rt = -1.0;
 
+    if (mmap_file_.isOpen())
+    {
+      Size offset = static_cast<Size>(spectra_index_[id]);
+      OpenSwath::SpectrumPtr sptr(new OpenSwath::Spectrum);
+      sptr->getDataArrays() = Internal::CachedMzMLHandler::readSpectrumFast(mmap_file_.data(), mmap_file_.size(), offset, ms_level, rt);
+      return sptr;
+    }
+
     if ( !ifs_.seekg(spectra_index_[id]) )
     {
       std::cerr << "Error while reading spectrum " << id << " - seekg created an error when trying to change position to " << spectra_index_[id] << "." << std::endl;
@@ -53,6 +61,36 @@ namespace OpenMS
     return sptr;
   }
 
+  OpenSwath::SpectrumPtr SpectrumAccessOpenMSCached::getSpectrumMzSliceById(int id, double mz_start, double mz_end)
+  {
+    OPENMS_PRECONDITION(id >= 0, "Id needs to be larger than zero");
+    OPENMS_PRECONDITION(id < (int)getNrSpectra(), "Id cannot be larger than number of spectra");
+
+    int ms_level = -1;
+    double rt = -1.0;
+
+    if (mmap_file_.isOpen())
+    {
+      Size offset = static_cast<Size>(spectra_index_[id]);
+      OpenSwath::SpectrumPtr sptr(new OpenSwath::Spectrum);
+      sptr->getDataArrays() = Internal::CachedMzMLHandler::readSpectrumFast(mmap_file_.data(), mmap_file_.size(), offset, ms_level, rt, mz_start, mz_end);
+      return sptr;
+    }
+
+    if ( !ifs_.seekg(spectra_index_[id]) )
+    {
+      std::cerr << "Error while reading spectrum " << id << " - seekg created an error when trying to change position to " << spectra_index_[id] << "." << std::endl;
+      std::cerr << "Maybe an invalid position was supplied to seekg, this can happen for example when reading large files (>2GB) on 32bit systems." << std::endl;
+      throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+        "Error while changing position of input stream pointer.", filename_cached_);
+    }
+
+    OpenSwath::SpectrumPtr sptr(new OpenSwath::Spectrum);
+    sptr->getDataArrays() = Internal::CachedMzMLHandler::readSpectrumFast(ifs_, ms_level, rt, mz_start, mz_end);
+
+    return sptr;
+  }
+
   OpenSwath::SpectrumMeta SpectrumAccessOpenMSCached::getSpectrumMetaById(int id) const
   {
     OPENMS_PRECONDITION(id >= 0, "Id needs to be larger than zero");
@@ -69,6 +107,14 @@ namespace OpenMS
     OPENMS_PRECONDITION(id >= 0, "Id needs to be larger than zero");
     OPENMS_PRECONDITION(id < (int)getNrChromatograms(), "Id cannot be larger than number of chromatograms");
 
+    if (mmap_file_.isOpen())
+    {
+      Size offset = static_cast<Size>(chrom_index_[id]);
+      OpenSwath::ChromatogramPtr cptr(new OpenSwath::Chromatogram);
+      cptr->getDataArrays() = Internal::CachedMzMLHandler::readChromatogramFast(mmap_file_.data(), mmap_file_.size(), offset);
+      return cptr;
+    }
+
     if ( !ifs_.seekg(chrom_index_[id]) )
     {
       std::cerr << "Error while reading chromatogram " << id << " - seekg created an error when trying to change position to " << chrom_index_[id] << "." << std::endl;
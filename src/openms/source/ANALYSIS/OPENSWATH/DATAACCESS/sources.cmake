@@ -9,6 +9,7 @@ SpectrumAccessOpenMSCached.cpp
 SpectrumAccessOpenMSInMemory.cpp
 SpectrumAccessSqMass.cpp
 SpectrumAccessTransforming.cpp
+SpectrumAccessCaching.cpp
 SpectrumAccessQuadMZTransforming.cpp
 DataAccessHelper.cpp
 SimpleOpenMSSpectraAccessFactory.cpp
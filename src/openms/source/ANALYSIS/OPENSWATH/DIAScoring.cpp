@@ -93,6 +93,10 @@ namespace OpenMS
     dia_nr_isotopes_ = (int)param_.getValue("dia_nr_isotopes");
     dia_nr_charges_ = (int)param_.getValue("dia_nr_charges");
     peak_before_mono_max_ppm_diff_ = (double)param_.getValue("peak_before_mono_max_ppm_diff");
+
+    // the cached envelopes depend on dia_nr_isotopes_
+    std::lock_guard<std::mutex> lock(averagine_cache_mutex_);
+    averagine_cache_.clear();
   }
 
   ///////////////////////////////////////////////////////////////////////////
@@ -213,15 +217,13 @@ namespace OpenMS
   {
     std::vector<double> exp_isotopes_int;
     getIsotopeIntysFromExpSpec_(precursor_mz, spectrum, charge_state, im_range, exp_isotopes_int);
-    CoarseIsotopePatternGenerator solver(dia_nr_isotopes_ + 1);
-    // NOTE: this is a rough estimate of the neutral mz value since we would not know the charge carrier for negative ions
-    IsotopeDistribution isotope_dist = solver.estimateFromPeptideWeight(std::fabs(precursor_mz * charge_state));
 
     double max_ratio;
     int nr_occurrences;
     // calculate the scores:
     // isotope correlation (forward) and the isotope overlap (backward) scores
-    isotope_corr = scoreIsotopePattern_(exp_isotopes_int, isotope_dist);
+    // (uses the cached averagine envelope for the estimated neutral mass)
+    isotope_corr = scoreIsotopePattern_(exp_isotopes_int, precursor_mz, charge_state);
     largePeaksBeforeFirstIsotope_(spectrum, precursor_mz, exp_isotopes_int[0], nr_occurrences, max_ratio, im_range);
     isotope_overlap = max_ratio;
   }
@@ -377,16 +379,58 @@ namespace OpenMS
   {
     OPENMS_PRECONDITION(putative_fragment_charge != 0, "Charge needs to be set to != 0"); // charge can be positive and negative
 
-    IsotopeDistribution isotope_dist;
-
-    // create the theoretical distribution from the peptide weight
-    CoarseIsotopePatternGenerator solver(dia_nr_isotopes_ + 1);
     // NOTE: this is a rough estimate of the neutral mz value since we would not know the charge carrier for negative ions
-    isotope_dist = solver.estimateFromPeptideWeight(std::fabs(product_mz * putative_fragment_charge));
+    const std::vector<double>& envelope = getNormalizedAveragineEnvelope_(std::fabs(product_mz * putative_fragment_charge));
 
-    return scoreIsotopePattern_(isotopes_int, isotope_dist);
+    // score the pattern against the theoretical one
+    OPENMS_POSTCONDITION(isotopes_int.size() == envelope.size(), "Vectors for pearson correlation do not have the same size.");
+    double int_score = OpenSwath::cor_pearson(isotopes_int.begin(), isotopes_int.end(), envelope.begin());
+    if (std::isnan(int_score))
+    {
+      int_score = 0;
+    }
+    return int_score;
   } //end of dia_isotope_corr_sub
 
+  const std::vector<double>& DIAScoring::getNormalizedAveragineEnvelope_(double mass) const
+  {
+    std::lock_guard<std::mutex> lock(averagine_cache_mutex_);
+    std::map<double, std::vector<double>>::iterator pos = averagine_cache_.find(mass);
+    if (pos == averagine_cache_.end())
+    {
+      // create the theoretical distribution from the peptide weight
+      CoarseIsotopePatternGenerator solver(dia_nr_isotopes_ + 1);
+      IsotopeDistribution isotope_dist = solver.estimateFromPeptideWeight(mass);
+
+      std::vector<double> envelope;
+      envelope.reserve(isotope_dist.size());
+      for (IsotopeDistribution::ConstIterator it = isotope_dist.begin(); it != isotope_dist.end(); ++it)
+      {
+        envelope.push_back(it->getIntensity());
+      }
+
+      // scale the distribution to a maximum of 1
+      double max = 0.0;
+      for (Size i = 0; i < envelope.size(); ++i)
+      {
+        if (envelope[i] > max)
+        {
+          max = envelope[i];
+        }
+      }
+      if (max == 0.) max = 1.;
+      for (Size i = 0; i < envelope.size(); ++i)
+      {
+        envelope[i] /= max;
+      }
+
+      pos = averagine_cache_.emplace(mass, std::move(envelope)).first;
+    }
+    // map nodes are stable and entries are never modified after insertion, so
+    // the reference stays valid after the lock is released
+    return pos->second;
+  }
+
   double DIAScoring::scoreIsotopePattern_(const std::vector<double>& isotopes_int,
                                           const EmpiricalFormula& empf) const
   {
@@ -136,8 +136,11 @@ namespace OpenMS
 
     // We need to store all values that map to the same ion mobility in the
     // same spot in the ion mobilogram (they are not sorted by ion mobility in
-    // the input data), therefore create a map to map to bins.
-    std::map< int, double> im_chrom;
+    // the input data), therefore collect <bin, intensity> pairs and merge them
+    // below. The accumulator is reused across calls (one instance per thread)
+    // since this function runs once per transition and candidate peak group.
+    static thread_local std::vector< std::pair<int, double> > im_bins;
+    im_bins.clear();
 
     for (const auto& spectrum : spectra)
     {
@@ -166,7 +169,7 @@ namespace OpenMS
         {
           intensity += (*int_it);
           im += (*int_it) * (*im_it);
-          im_chrom[ int((*im_it)*IM_IDX_MULT) ] += *int_it;
+          im_bins.emplace_back( int((*im_it)*IM_IDX_MULT), *int_it );
         }
         ++mz_it;
         ++int_it;
@@ -185,10 +188,22 @@ namespace OpenMS
       intensity = 0;
     }
 
-    res.reserve(res.size() + im_chrom.size());
-    for (const auto& k : im_chrom)
+    // sum up all intensities that fall into the same bin (stable sort keeps
+    // the original summation order within a bin)
+    std::stable_sort(im_bins.begin(), im_bins.end(),
+                     [](const std::pair<int, double>& a, const std::pair<int, double>& b) { return a.first < b.first; });
+    res.reserve(res.size() + im_bins.size());
+    for (Size k = 0; k < im_bins.size(); )
     {
-      res.emplace_back(k.first / IM_IDX_MULT, k.second );
+      double summed_intensity = im_bins[k].second;
+      Size j = k + 1;
+      while (j < im_bins.size() && im_bins[j].first == im_bins[k].first)
+      {
+        summed_intensity += im_bins[j].second;
+        ++j;
+      }
+      res.emplace_back(im_bins[k].first / IM_IDX_MULT, summed_intensity);
+      k = j;
     }
   }
 
@@ -234,43 +249,52 @@ namespace OpenMS
     // extend IM range by drift_extra
     im_range.scaleBy(drift_extra * 2. + 1); // multiple by 2 because want drift extra to be extended by that amount on either side
 
-    std::vector< IonMobilogram > mobilograms;
+    // Scratch space reused across candidates (one instance per thread, cf.
+    // ElutionPeakDetection); the last mobilogram holds the precursor (MS1)
+    // profile so that the grid is computed over all profiles.
+    static thread_local std::vector< IonMobilogram > mobilograms;
+    mobilograms.resize(transitions.size() + 1);
 
     // Step 1: MS2 extraction
     for (std::size_t k = 0; k < transitions.size(); k++)
     {
       double im(0), intensity(0);
-      IonMobilogram res;
+      IonMobilogram& res = mobilograms[k];
+      res.clear();
       const TransitionType transition = transitions[k];
       // Calculate the difference of the theoretical ion mobility and the actually measured ion mobility
       RangeMZ mz_range = DIAHelpers::createMZRangePPM(transition.getProductMZ(), dia_extract_window_, dia_extraction_ppm_);
 
       computeIonMobilogram(spectra, mz_range, im_range, im, intensity, res, eps);
-      mobilograms.push_back( std::move(res) );
     }
 
     // Step 2: MS1 extraction
     double im(0), intensity(0);
-    IonMobilogram ms1_profile;
+    IonMobilogram& ms1_profile = mobilograms.back();
+    ms1_profile.clear();
     RangeMZ mz_range = DIAHelpers::createMZRangePPM(transitions[0].getPrecursorMZ(), dia_extract_window_, dia_extraction_ppm_);
 
     computeIonMobilogram(ms1spectrum, mz_range, im_range, im, intensity, ms1_profile, eps); // TODO: aggregate over isotopes
-    mobilograms.push_back(ms1_profile);
 
     std::vector<double> im_grid = computeGrid_(mobilograms, eps); // ensure grid is based on all profiles!
-    mobilograms.pop_back();
 
-    // Step 3: Align the IonMobilogram vectors to the grid
-    std::vector< std::vector< double > > aligned_mobilograms;
-    for (const auto & mobilogram : mobilograms)
+    // Step 3: Align the IonMobilogram vectors to the grid (the dense rows are
+    // per-thread scratch as well and keep their capacity across candidates)
+    static thread_local std::vector< std::vector< double > > aligned_mobilograms;
+    static thread_local std::vector< double > arrIM;
+    aligned_mobilograms.resize(transitions.size());
+    for (std::size_t k = 0; k < transitions.size(); k++)
     {
-      std::vector< double > arrInt, arrIM;
+      std::vector< double >& arrInt = aligned_mobilograms[k];
+      arrInt.clear();
+      arrIM.clear();
       Size max_peak_idx = 0;
-      alignToGrid_(mobilogram, im_grid, arrInt, arrIM, eps, max_peak_idx);
-      aligned_mobilograms.push_back(arrInt);
+      alignToGrid_(mobilograms[k], im_grid, arrInt, arrIM, eps, max_peak_idx);
     }
 
-    std::vector< double > ms1_int_values, ms1_im_values;
+    static thread_local std::vector< double > ms1_int_values, ms1_im_values;
+    ms1_int_values.clear();
+    ms1_im_values.clear();
     Size max_peak_idx = 0;
     alignToGrid_(ms1_profile, im_grid, ms1_int_values, ms1_im_values, eps, max_peak_idx);
 
@@ -285,8 +309,8 @@ namespace OpenMS
     }
 
     // Step 5: contrast precursor vs summed fragment ions
-    std::vector<double> fragment_values;
-    fragment_values.resize(ms1_int_values.size(), 0);
+    static thread_local std::vector<double> fragment_values;
+    fragment_values.assign(ms1_int_values.size(), 0);
     for (Size k = 0; k < fragment_values.size(); k++)
     {
       for (Size i = 0; i < aligned_mobilograms.size(); i++)
@@ -370,8 +394,12 @@ namespace OpenMS
 
     double delta_drift = 0;
     double delta_drift_abs = 0;
-    // IonMobilogram: a data structure that holds points <im_value, intensity>
-    std::vector< IonMobilogram > mobilograms;
+    // IonMobilogram: a data structure that holds points <im_value, intensity>.
+    // The mobilograms and the dense grid rows below are scratch space reused
+    // across candidates (one instance per thread, cf. ElutionPeakDetection),
+    // since this function runs once per candidate peak group.
+    static thread_local std::vector< IonMobilogram > mobilograms;
+    mobilograms.resize(transitions.size());
     double computed_im = 0;
     double computed_im_weighted = 0;
     double sum_intensity = 0;
@@ -381,7 +409,8 @@ namespace OpenMS
     for (std::size_t k = 0; k < transitions.size(); k++)
     {
       const TransitionType transition = transitions[k];
-      IonMobilogram res;
+      IonMobilogram& res = mobilograms[k];
+      res.clear();
       double im(0), intensity(0);
 
       // Calculate the difference of the theoretical ion mobility and the actually measured ion mobility
@@ -390,7 +419,6 @@ namespace OpenMS
       //double left(transition.getProductMZ()), right(transition.getProductMZ());
       //DIAHelpers::adjustExtractionWindow(right, left, dia_extract_window_, dia_extraction_ppm_);
       computeIonMobilogram(spectra, mz_range, im_range, im, intensity, res, eps);
-      mobilograms.push_back(res);
 
       // TODO what do to about those that have no signal ?
       if (intensity <= 0.0) {continue;} // note: im is -1 then
@@ -431,14 +459,20 @@ namespace OpenMS
 
     // Step 2: Align the IonMobilogram vectors to the grid
     std::vector<double> im_grid = computeGrid_(mobilograms, eps);
-    std::vector< std::vector< double > > aligned_mobilograms;
+    static thread_local std::vector< std::vector< double > > aligned_mobilograms;
+    static thread_local std::vector< double > arr_IM;
+    Size n_rows = 0;
     for (const auto & mobilogram : mobilograms)
     {
-      std::vector< double > arr_int, arr_IM;
+      if (aligned_mobilograms.size() == n_rows) aligned_mobilograms.emplace_back();
+      std::vector< double >& arr_int = aligned_mobilograms[n_rows];
+      arr_int.clear();
+      arr_IM.clear();
       Size max_peak_idx = 0;
       alignToGrid_(mobilogram, im_grid, arr_int, arr_IM, eps, max_peak_idx);
-      if (!arr_int.empty()) aligned_mobilograms.push_back(arr_int);
+      if (!arr_int.empty()) ++n_rows;
     }
+    aligned_mobilograms.resize(n_rows); // drop leftover rows of a previous call
 
     // Step 3: Compute cross-correlation scores based on ion mobilograms
     if (aligned_mobilograms.size() < 2)
@@ -18,6 +18,7 @@
 #include <OpenMS/KERNEL/FeatureMap.h>
 
 #include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
+#include <OpenMS/METADATA/MetaInfo.h>
 #include <OpenMS/CONCEPT/LogStream.h>
 
 namespace OpenMS
@@ -50,22 +51,52 @@ namespace OpenMS
     const TargetedExperiment& transitions
   )
   {
-    // initialize QC variables
-    FeatureMap features_filtered;
+    // compile the filter plan once: resolve transitions and criteria by name
+    // and register the verdict meta value keys, instead of scanning all
+    // criteria and hashing all keys again for every subordinate
+    const std::unordered_map<String, const ReactionMonitoringTransition*> transition_index = buildTransitionIndex_(transitions);
+    std::unordered_map<String, std::vector<size_t>> cg_qcs_by_name, c_qcs_by_name;
+    for (size_t i = 0; i < filter_criteria.component_group_qcs.size(); ++i)
+    {
+      cg_qcs_by_name[filter_criteria.component_group_qcs[i].component_group_name].push_back(i);
+    }
+    for (size_t i = 0; i < filter_criteria.component_qcs.size(); ++i)
+    {
+      c_qcs_by_name[filter_criteria.component_qcs[i].component_name].push_back(i);
+    }
+    // pre-register the verdict keys, so the parallel loop below never has to
+    // modify the (unguarded) MetaInfoRegistry
+    const UInt key_c_score = MetaInfo::registry().registerName("QC_transition_score");
+    const UInt key_c_pass = MetaInfo::registry().registerName("QC_transition_pass");
+    const UInt key_c_message = MetaInfo::registry().registerName("QC_transition_message");
+    const UInt key_cg_score = MetaInfo::registry().registerName("QC_transition_group_score");
+    const UInt key_cg_pass = MetaInfo::registry().registerName("QC_transition_group_pass");
+    const UInt key_cg_message = MetaInfo::registry().registerName("QC_transition_group_message");
+
+    // the verdict for each feature only depends on that feature, so the
+    // features are evaluated in parallel; in filter mode the surviving
+    // subordinates are collected per feature and the filtered map is
+    // assembled afterwards in the original order
+    const bool filter = (flag_or_filter_ == "filter");
+    std::vector<std::vector<Feature>> subordinates_filtered(features.size());
+    std::vector<char> cg_qc_passes(features.size(), false);
 
     // iterate through each component_group/feature
-    for (size_t feature_it = 0; feature_it < features.size(); ++feature_it)
+    #pragma omp parallel for schedule(dynamic)
+    for (SignedSize feature_it = 0; feature_it < (SignedSize)features.size(); ++feature_it)
     {
       String component_group_name = (String)features.at(feature_it).getMetaValue("PeptideRef");
 
-      std::map<String, int> labels_and_transition_types = countLabelsAndTransitionTypes(features.at(feature_it), transitions);
+      std::map<String, int> labels_and_transition_types = countLabelsAndTransitionTypes_(features.at(feature_it), transition_index);
 
-      // initialize the new feature and subordinates
-      std::vector<Feature> subordinates_filtered;
       bool cg_qc_pass = true;
       StringList cg_qc_fail_message_vec;
       UInt cg_tests_count{ 0 };
 
+      const auto cg_qcs_matched = cg_qcs_by_name.find(component_group_name);
+      const auto no_cg_qcs = std::vector<size_t>{};
+      const std::vector<size_t>& cg_qcs = (cg_qcs_matched != cg_qcs_by_name.end()) ? cg_qcs_matched->second : no_cg_qcs;
+
       // iterate through each component/sub-feature
       for (size_t sub_it = 0; sub_it < features.at(feature_it).getSubordinates().size(); ++sub_it)
       {
@@ -74,98 +105,78 @@ namespace OpenMS
         StringList c_qc_fail_message_vec;
 
         // iterate through multi-feature/multi-sub-feature QCs/filters
-        // iterate through component_groups
-        for (size_t cg_qc_it = 0; cg_qc_it < filter_criteria.component_group_qcs.size(); ++cg_qc_it)
+        // iterate through matching component_groups
+        for (const size_t cg_qc_it : cg_qcs)
         {
-          if (filter_criteria.component_group_qcs.at(cg_qc_it).component_group_name == component_group_name)
+          const MRMFeatureQC::ComponentGroupQCs& cg_qc = filter_criteria.component_group_qcs.at(cg_qc_it);
+          const double rt = features.at(feature_it).getRT();
+          if (!checkRange(rt, cg_qc.retention_time_l, cg_qc.retention_time_u))
           {
-            const double rt = features.at(feature_it).getRT();
-            if (!checkRange(rt,
-              filter_criteria.component_group_qcs.at(cg_qc_it).retention_time_l,
-              filter_criteria.component_group_qcs.at(cg_qc_it).retention_time_u))
-            {
-              cg_qc_pass = false;
-              cg_qc_fail_message_vec.push_back("retention_time");
-            }
+            cg_qc_pass = false;
+            cg_qc_fail_message_vec.push_back("retention_time");
+          }
 
-            const double intensity = features.at(feature_it).getIntensity();
-            if (!checkRange(intensity,
-              filter_criteria.component_group_qcs.at(cg_qc_it).intensity_l,
-              filter_criteria.component_group_qcs.at(cg_qc_it).intensity_u))
-            {
-              cg_qc_pass = false;
-              cg_qc_fail_message_vec.push_back("intensity");
-            }
+          const double intensity = features.at(feature_it).getIntensity();
+          if (!checkRange(intensity, cg_qc.intensity_l, cg_qc.intensity_u))
+          {
+            cg_qc_pass = false;
+            cg_qc_fail_message_vec.push_back("intensity");
+          }
 
-            const double quality = features.at(feature_it).getOverallQuality();
-            if (!checkRange(quality,
-              filter_criteria.component_group_qcs.at(cg_qc_it).overall_quality_l,
-              filter_criteria.component_group_qcs.at(cg_qc_it).overall_quality_u))
-            {
-              cg_qc_pass = false;
-              cg_qc_fail_message_vec.push_back("overall_quality");
-            }
-            // labels and transition counts QC
-            if (!checkRange(labels_and_transition_types["n_heavy"],
-              filter_criteria.component_group_qcs.at(cg_qc_it).n_heavy_l,
-              filter_criteria.component_group_qcs.at(cg_qc_it).n_heavy_u))
-            {
-              cg_qc_pass = false;
-              cg_qc_fail_message_vec.push_back("n_heavy");
-            }
-            if (!checkRange(labels_and_transition_types["n_light"],
-              filter_criteria.component_group_qcs.at(cg_qc_it).n_light_l,
-              filter_criteria.component_group_qcs.at(cg_qc_it).n_light_u))
-            {
-              cg_qc_pass = false;
-              cg_qc_fail_message_vec.push_back("n_light");
-            }
-            if (!checkRange(labels_and_transition_types["n_detecting"],
-              filter_criteria.component_group_qcs.at(cg_qc_it).n_detecting_l,
-              filter_criteria.component_group_qcs.at(cg_qc_it).n_detecting_u))
-            {
-              cg_qc_pass = false;
-              cg_qc_fail_message_vec.push_back("n_detecting");
-            }
-            if (!checkRange(labels_and_transition_types["n_quantifying"],
-              filter_criteria.component_group_qcs.at(cg_qc_it).n_quantifying_l,
-              filter_criteria.component_group_qcs.at(cg_qc_it).n_quantifying_u))
-            {
-              cg_qc_pass = false;
-              cg_qc_fail_message_vec.push_back("n_quantifying");
-            }
-            if (!checkRange(labels_and_transition_types["n_identifying"],
-              filter_criteria.component_group_qcs.at(cg_qc_it).n_identifying_l,
-              filter_criteria.component_group_qcs.at(cg_qc_it).n_identifying_u))
-            {
-              cg_qc_pass = false;
-              cg_qc_fail_message_vec.push_back("n_identifying");
-            }
-            if (!checkRange(labels_and_transition_types["n_transitions"],
-              filter_criteria.component_group_qcs.at(cg_qc_it).n_transitions_l,
-              filter_criteria.component_group_qcs.at(cg_qc_it).n_transitions_u))
-            {
-              cg_qc_pass = false;
-              cg_qc_fail_message_vec.push_back("n_transitions");
-            }
+          const double quality = features.at(feature_it).getOverallQuality();
+          if (!checkRange(quality, cg_qc.overall_quality_l, cg_qc.overall_quality_u))
+          {
+            cg_qc_pass = false;
+            cg_qc_fail_message_vec.push_back("overall_quality");
+          }
+          // labels and transition counts QC
+          if (!checkRange(labels_and_transition_types["n_heavy"], cg_qc.n_heavy_l, cg_qc.n_heavy_u))
+          {
+            cg_qc_pass = false;
+            cg_qc_fail_message_vec.push_back("n_heavy");
+          }
+          if (!checkRange(labels_and_transition_types["n_light"], cg_qc.n_light_l, cg_qc.n_light_u))
+          {
+            cg_qc_pass = false;
+            cg_qc_fail_message_vec.push_back("n_light");
+          }
+          if (!checkRange(labels_and_transition_types["n_detecting"], cg_qc.n_detecting_l, cg_qc.n_detecting_u))
+          {
+            cg_qc_pass = false;
+            cg_qc_fail_message_vec.push_back("n_detecting");
+          }
+          if (!checkRange(labels_and_transition_types["n_quantifying"], cg_qc.n_quantifying_l, cg_qc.n_quantifying_u))
+          {
+            cg_qc_pass = false;
+            cg_qc_fail_message_vec.push_back("n_quantifying");
+          }
+          if (!checkRange(labels_and_transition_types["n_identifying"], cg_qc.n_identifying_l, cg_qc.n_identifying_u))
+          {
+            cg_qc_pass = false;
+            cg_qc_fail_message_vec.push_back("n_identifying");
+          }
+          if (!checkRange(labels_and_transition_types["n_transitions"], cg_qc.n_transitions_l, cg_qc.n_transitions_u))
+          {
+            cg_qc_pass = false;
+            cg_qc_fail_message_vec.push_back("n_transitions");
+          }
 
-            cg_tests_count += 9;
+          cg_tests_count += 9;
 
-            // ion ratio QC
+          // ion ratio QC
+          if (!cg_qc.ion_ratio_pair_name_1.empty()
+           && !cg_qc.ion_ratio_pair_name_2.empty()
+           && cg_qc.ion_ratio_pair_name_1 == component_name)
+          {
             for (size_t sub_it2 = 0; sub_it2 < features.at(feature_it).getSubordinates().size(); ++sub_it2)
             {
               String component_name2 = (String)features.at(feature_it).getSubordinates().at(sub_it2).getMetaValue("native_id");
               // find the ion ratio pair
-              if (!filter_criteria.component_group_qcs.at(cg_qc_it).ion_ratio_pair_name_1.empty()
-               && !filter_criteria.component_group_qcs.at(cg_qc_it).ion_ratio_pair_name_2.empty()
-               && filter_criteria.component_group_qcs.at(cg_qc_it).ion_ratio_pair_name_1 == component_name
-               && filter_criteria.component_group_qcs.at(cg_qc_it).ion_ratio_pair_name_2 == component_name2)
+              if (cg_qc.ion_ratio_pair_name_2 == component_name2)
               {
-                double ion_ratio = calculateIonRatio(features.at(feature_it).getSubordinates().at(sub_it), features.at(feature_it).getSubordinates().at(sub_it2), filter_criteria.component_group_qcs.at(cg_qc_it).ion_ratio_feature_name);
+                double ion_ratio = calculateIonRatio(features.at(feature_it).getSubordinates().at(sub_it), features.at(feature_it).getSubordinates().at(sub_it2), cg_qc.ion_ratio_feature_name);
 
-                if (!checkRange(ion_ratio,
-                  filter_criteria.component_group_qcs.at(cg_qc_it).ion_ratio_l,
-                  filter_criteria.component_group_qcs.at(cg_qc_it).ion_ratio_u))
+                if (!checkRange(ion_ratio, cg_qc.ion_ratio_l, cg_qc.ion_ratio_u))
                 {
                   cg_qc_pass = false;
                   cg_qc_fail_message_vec.push_back("ion_ratio_pair[" + component_name + "/" + component_name2 + "]");
@@ -173,32 +184,32 @@ namespace OpenMS
                 ++cg_tests_count;
               }
             }
+          }
 
-            //std::pair<const String, std::pair<double, double>>
-            for (const auto& kv : filter_criteria.component_group_qcs.at(cg_qc_it).meta_value_qc)
+          //std::pair<const String, std::pair<double, double>>
+          for (const auto& kv : cg_qc.meta_value_qc)
+          {
+            bool metavalue_exists{ false };
+            if (!checkMetaValue(features.at(feature_it), kv.first, kv.second.first, kv.second.second, metavalue_exists))
             {
-              bool metavalue_exists{ false };
-              if (!checkMetaValue(features.at(feature_it), kv.first, kv.second.first, kv.second.second, metavalue_exists))
-              {
-                cg_qc_pass = false;
-                cg_qc_fail_message_vec.push_back(kv.first);
-              }
-              if (metavalue_exists) ++cg_tests_count;
+              cg_qc_pass = false;
+              cg_qc_fail_message_vec.push_back(kv.first);
             }
+            if (metavalue_exists) ++cg_tests_count;
           }
         }
 
         UInt c_tests_count{ 0 };
-        // iterate through feature/sub-feature QCs/filters
-        for (size_t c_qc_it = 0; c_qc_it < filter_criteria.component_qcs.size(); ++c_qc_it)
+        // iterate through matching feature/sub-feature QCs/filters
+        const auto c_qcs_matched = c_qcs_by_name.find(component_name);
+        if (c_qcs_matched != c_qcs_by_name.end())
         {
-          if (filter_criteria.component_qcs.at(c_qc_it).component_name == component_name)
+          for (const size_t c_qc_it : c_qcs_matched->second)
           {
+            const MRMFeatureQC::ComponentQCs& c_qc = filter_criteria.component_qcs.at(c_qc_it);
             // RT check
             const double rt = features.at(feature_it).getSubordinates().at(sub_it).getRT();
-            if (!checkRange(rt,
-              filter_criteria.component_qcs.at(c_qc_it).retention_time_l,
-              filter_criteria.component_qcs.at(c_qc_it).retention_time_u))
+            if (!checkRange(rt, c_qc.retention_time_l, c_qc.retention_time_u))
             {
               c_qc_pass = false;
               c_qc_fail_message_vec.push_back("retention_time");
@@ -206,9 +217,7 @@ namespace OpenMS
 
             // intensity check
             double intensity = features.at(feature_it).getSubordinates().at(sub_it).getIntensity();
-            if (!checkRange(intensity,
-              filter_criteria.component_qcs.at(c_qc_it).intensity_l,
-              filter_criteria.component_qcs.at(c_qc_it).intensity_u))
+            if (!checkRange(intensity, c_qc.intensity_l, c_qc.intensity_u))
             {
               c_qc_pass = false;
               c_qc_fail_message_vec.push_back("intensity");
@@ -216,9 +225,7 @@ namespace OpenMS
 
             // overall quality check getQuality
             double quality = features.at(feature_it).getSubordinates().at(sub_it).getOverallQuality();
-            if (!checkRange(quality,
-              filter_criteria.component_qcs.at(c_qc_it).overall_quality_l,
-              filter_criteria.component_qcs.at(c_qc_it).overall_quality_u))
+            if (!checkRange(quality, c_qc.overall_quality_l, c_qc.overall_quality_u))
             {
               c_qc_pass = false;
               c_qc_fail_message_vec.push_back("overall_quality");
@@ -227,7 +234,7 @@ namespace OpenMS
             c_tests_count += 3;
 
             // metaValue checks
-            for (auto const& kv : filter_criteria.component_qcs.at(c_qc_it).meta_value_qc)
+            for (auto const& kv : c_qc.meta_value_qc)
             {
               bool metavalue_exists{ false };
               if (!checkMetaValue(features.at(feature_it).getSubordinates().at(sub_it), kv.first, kv.second.first, kv.second.second, metavalue_exists))
@@ -241,62 +248,59 @@ namespace OpenMS
         }
 
         const double c_score = c_tests_count ? 1.0 - c_qc_fail_message_vec.size() / (double)c_tests_count : 1.0;
-        features.at(feature_it).getSubordinates().at(sub_it).setMetaValue("QC_transition_score", c_score);
+        features.at(feature_it).getSubordinates().at(sub_it).setMetaValue(key_c_score, c_score);
 
         // Copy or Flag passing/failing subordinates
-        if (c_qc_pass && flag_or_filter_ == "filter")
+        if (c_qc_pass && filter)
         {
-          subordinates_filtered.push_back(features.at(feature_it).getSubordinates().at(sub_it));
+          subordinates_filtered[feature_it].push_back(features.at(feature_it).getSubordinates().at(sub_it));
         }
-        else if (c_qc_pass && flag_or_filter_ == "flag")
+        else if (c_qc_pass && !filter)
         {
-          features.at(feature_it).getSubordinates().at(sub_it).setMetaValue("QC_transition_pass", true);
-          features.at(feature_it).getSubordinates().at(sub_it).setMetaValue("QC_transition_message", StringList());
+          features.at(feature_it).getSubordinates().at(sub_it).setMetaValue(key_c_pass, true);
+          features.at(feature_it).getSubordinates().at(sub_it).setMetaValue(key_c_message, StringList());
         }
-        else if (!c_qc_pass && flag_or_filter_ == "filter")
+        else if (!c_qc_pass && filter)
         {
           // do nothing
         }
-        else if (!c_qc_pass && flag_or_filter_ == "flag")
+        else if (!c_qc_pass && !filter)
         {
-          features.at(feature_it).getSubordinates().at(sub_it).setMetaValue("QC_transition_pass", false);
-          features.at(feature_it).getSubordinates().at(sub_it).setMetaValue("QC_transition_message", getUniqueSorted(c_qc_fail_message_vec));
+          features.at(feature_it).getSubordinates().at(sub_it).setMetaValue(key_c_pass, false);
+          features.at(feature_it).getSubordinates().at(sub_it).setMetaValue(key_c_message, getUniqueSorted(c_qc_fail_message_vec));
         }
       }
 
       const double cg_score = cg_tests_count ? 1.0 - cg_qc_fail_message_vec.size() / (double)cg_tests_count : 1.0;
-      features.at(feature_it).setMetaValue("QC_transition_group_score", cg_score);
+      features.at(feature_it).setMetaValue(key_cg_score, cg_score);
+      cg_qc_passes[feature_it] = cg_qc_pass;
 
-      // Copy or Flag passing/failing Features
-      if (cg_qc_pass && flag_or_filter_ == "filter" && !subordinates_filtered.empty())
+      // Flag passing/failing Features (filtered Features are collected below)
+      if (cg_qc_pass && !filter)
       {
-        Feature feature_filtered(features.at(feature_it));
-        feature_filtered.setSubordinates(subordinates_filtered);
-        features_filtered.push_back(feature_filtered);
+        features.at(feature_it).setMetaValue(key_cg_pass, true);
+        features.at(feature_it).setMetaValue(key_cg_message, StringList());
       }
-      else if (cg_qc_pass && flag_or_filter_ == "filter" && subordinates_filtered.empty())
+      else if (!cg_qc_pass && !filter)
       {
-        // do nothing
-      }
-      else if (cg_qc_pass && flag_or_filter_ == "flag")
-      {
-        features.at(feature_it).setMetaValue("QC_transition_group_pass", true);
-        features.at(feature_it).setMetaValue("QC_transition_group_message", StringList());
-      }
-      else if (!cg_qc_pass && flag_or_filter_ == "filter")
-      {
-        // do nothing
-      }
-      else if (!cg_qc_pass && flag_or_filter_ == "flag")
-      {
-        features.at(feature_it).setMetaValue("QC_transition_group_pass", false);
-        features.at(feature_it).setMetaValue("QC_transition_group_message", getUniqueSorted(cg_qc_fail_message_vec));
+        features.at(feature_it).setMetaValue(key_cg_pass, false);
+        features.at(feature_it).setMetaValue(key_cg_message, getUniqueSorted(cg_qc_fail_message_vec));
       }
     }
 
     // replace with the filtered featureMap
-    if (flag_or_filter_ == "filter")
+    if (filter)
     {
+      FeatureMap features_filtered;
+      for (size_t feature_it = 0; feature_it < features.size(); ++feature_it)
+      {
+        if (cg_qc_passes[feature_it] && !subordinates_filtered[feature_it].empty())
+        {
+          Feature feature_filtered(features.at(feature_it));
+          feature_filtered.setSubordinates(subordinates_filtered[feature_it]);
+          features_filtered.push_back(feature_filtered);
+        }
+      }
       features = features_filtered;
     }
   }
@@ -854,23 +858,39 @@ namespace OpenMS
   std::map<String, int> MRMFeatureFilter::countLabelsAndTransitionTypes(
     const Feature& component_group,
     const TargetedExperiment& transitions) const
+  {
+    return countLabelsAndTransitionTypes_(component_group, buildTransitionIndex_(transitions));
+  }
+
+  std::unordered_map<String, const ReactionMonitoringTransition*> MRMFeatureFilter::buildTransitionIndex_(
+    const TargetedExperiment& transitions) const
+  {
+    std::unordered_map<String, const ReactionMonitoringTransition*> transition_index;
+    for (const ReactionMonitoringTransition& transition : transitions.getTransitions())
+    {
+      // emplace keeps the first transition with a given NativeID, matching
+      // the first-match semantics of the former linear scan
+      transition_index.emplace(transition.getNativeID(), &transition);
+    }
+    return transition_index;
+  }
+
+  std::map<String, int> MRMFeatureFilter::countLabelsAndTransitionTypes_(
+    const Feature& component_group,
+    const std::unordered_map<String, const ReactionMonitoringTransition*>& transition_index) const
   {
     int n_heavy(0), n_light(0), n_quant(0), n_detect(0), n_ident(0), n_trans(0);
     std::map<String, int> output;
 
+    // subordinates without a matching transition count as a default
+    // constructed transition (i.e. quantifying and detecting)
+    const ReactionMonitoringTransition default_transition;
+
     for (size_t cg_it = 0; cg_it < component_group.getSubordinates().size(); ++cg_it)
     {
-
       // extract out the matching transition
-      ReactionMonitoringTransition transition;
-      for (size_t trans_it = 0; trans_it < transitions.getTransitions().size(); ++trans_it)
-      {
-        if (transitions.getTransitions()[trans_it].getNativeID() == component_group.getSubordinates()[cg_it].getMetaValue("native_id"))
-        {
-          transition = transitions.getTransitions()[trans_it];
-          break;
-        }
-      }
+      const auto matched = transition_index.find((String)component_group.getSubordinates()[cg_it].getMetaValue("native_id"));
+      const ReactionMonitoringTransition& transition = (matched != transition_index.end()) ? *matched->second : default_transition;
 
       // count labels and transition types
       String label_type = (String)component_group.getSubordinates()[cg_it].getMetaValue("LabelType");
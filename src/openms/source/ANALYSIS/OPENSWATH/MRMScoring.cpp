@@ -49,6 +49,33 @@ namespace OpenSwath
       }
     }
 
+    void MRMScoring::initializeXCorrMatrix(const double* data, std::size_t rows, std::size_t cols)
+    {
+      xcorr_matrix_.getEigenMatrix().resize(rows, rows);
+      xcorr_matrix_max_peak_.getEigenMatrix().resize(rows, rows);
+      xcorr_matrix_max_peak_sec_.getEigenMatrix().resize(rows, rows);
+
+      // standardize one contiguous copy of the matrix, then correlate its rows
+      // in place (no per-chromatogram vectors)
+      std::vector<double> standardized(data, data + rows * cols);
+      for (std::size_t i = 0; i < rows; i++)
+      {
+        Scoring::standardize_data(standardized.data() + i * cols, cols);
+      }
+
+      for (std::size_t i = 0; i < rows; i++)
+      {
+        for (std::size_t j = i; j < rows; j++)
+        {
+          // compute normalized cross correlation
+          xcorr_matrix_(i, j) = Scoring::normalizedCrossCorrelationPost(standardized.data() + i * cols, standardized.data() + j * cols, cols, static_cast<int>(cols), 1);
+          auto x = Scoring::xcorrArrayGetMaxPeak(xcorr_matrix_(i, j));
+          xcorr_matrix_max_peak_(i, j) = std::abs(x->first);
+          xcorr_matrix_max_peak_sec_(i, j) = x->second;
+        }
+      }
+    }
+
     const MRMScoring::XCorrMatrixType& MRMScoring::getXCorrContrastMatrix() const
     {
       return xcorr_contrast_matrix_;
@@ -119,8 +119,8 @@ namespace OpenMS
   }
 
   void MasstraceCorrelator::scoreHullpoints(const MasstracePointsType& hull_points1, const MasstracePointsType& hull_points2,
-        int& lag, double& lag_intensity, double& pearson_score, 
-        const double min_corr, const int /* max_lag */, const double mindiff)
+        int& lag, double& lag_intensity, double& pearson_score,
+        const double min_corr, const int max_lag, const double mindiff)
   {
     std::vector<double> vec1;
     std::vector<double> vec2;
@@ -129,12 +129,18 @@ namespace OpenMS
     pearson_score = Math::pearsonCorrelationCoefficient(vec1.begin(), vec1.end(), vec2.begin(), vec2.end() );
 
     // If the correlation is below the minimum level, we can already return at this point
-    if (pearson_score <= min_corr) 
+    if (pearson_score <= min_corr)
     {
       return;
     }
 
-    Scoring::XCorrArrayType xcorr_array = Scoring::normalizedCrossCorrelation(vec1, vec2, vec1.size(), 1);
+    // Band the lag scan: all callers reject lags outside [-max_lag, max_lag]
+    // anyway, so there is no point scanning the full trace length. Note that
+    // this reports the best lag *within* the band, whereas a full scan would
+    // report the global optimum (which is discarded if it lies outside).
+    const int datasize = static_cast<int>(vec1.size());
+    const int maxdelay = (max_lag > 0) ? std::min(datasize, max_lag) : datasize;
+    Scoring::XCorrArrayType xcorr_array = Scoring::normalizedCrossCorrelation(vec1, vec2, maxdelay, 1);
     Scoring::XCorrArrayType::const_iterator pt = Scoring::xcorrArrayGetMaxPeak(xcorr_array);
     lag = pt->first;  // the lag / RT at the maximal Xcorr value =~ coelution score
     lag_intensity = pt->second; // the intensity at the maximal Xcorr value =~ shape score
@@ -247,7 +253,9 @@ namespace OpenMS
       current_rt = rt_cache[i];
       rt_cache_ptr = &rt_cache[i];
 
-      // go through all features with lower intensity in the map
+      // go through all features with lower intensity in the map and collect
+      // the candidates which pass the cheap RT filters
+      std::vector<Size> candidates;
       for (j = i+1; j < map.size(); ++j)
       {
 
@@ -257,8 +265,30 @@ namespace OpenMS
         if ( fabs( (*rt_cache_ptr) - current_rt ) >  max_rt_apex_difference) {continue;}
         if ( (*rt_cache_ptr) < firstpoint || (*rt_cache_ptr) > lastpoint ) {continue;}
 
+        candidates.push_back(j);
+      }
+
+      // Score all candidate pairs against the seed in parallel -- each pair is
+      // scored independently and only reads the shared caches.
+      std::vector<int> lags(candidates.size(), 0);
+      std::vector<double> lag_intensities(candidates.size(), 0);
+      std::vector<double> pearson_scores(candidates.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for (SignedSize c = 0; c < static_cast<SignedSize>(candidates.size()); ++c)
+      {
         // We score the two vectors against each other in terms of several properties / scores
-        scoreHullpoints(feature_points[i], feature_points[j], lag, lag_intensity, pearson_score, min_correlation, max_lag);
+        scoreHullpoints(feature_points[i], feature_points[candidates[c]], lags[c], lag_intensities[c], pearson_scores[c], min_correlation, max_lag);
+      }
+
+      // collect the accepted peaks in their original order
+      for (Size c = 0; c < candidates.size(); ++c)
+      {
+        j = candidates[c];
+        lag = lags[c];
+        lag_intensity = lag_intensities[c];
+        pearson_score = pearson_scores[c];
 
 #ifdef DEBUG_MASSTRACES
         cout << j << ". Checking mass trace at RT: "<<  map[j].getRT() << " m/z: " << map[j].getMZ()
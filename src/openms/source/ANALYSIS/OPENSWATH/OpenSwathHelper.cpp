@@ -8,8 +8,150 @@
 
 #include <OpenMS/ANALYSIS/OPENSWATH/OpenSwathHelper.h>
 
+#include <algorithm>
+#include <limits>
+
 namespace OpenMS
 {
+  SwathTransitionIndex::SwathTransitionIndex(const OpenSwath::LightTargetedExperiment& targeted_exp)
+  {
+    build(targeted_exp);
+  }
+
+  void SwathTransitionIndex::build(const OpenSwath::LightTargetedExperiment& targeted_exp)
+  {
+    mz_index_.clear();
+    compound_index_.clear();
+    protein_index_.clear();
+
+    mz_index_.reserve(targeted_exp.transitions.size());
+    for (Size i = 0; i < targeted_exp.transitions.size(); i++)
+    {
+      mz_index_.emplace_back(targeted_exp.transitions[i].getPrecursorMZ(), i);
+    }
+    std::sort(mz_index_.begin(), mz_index_.end());
+
+    for (Size i = 0; i < targeted_exp.compounds.size(); i++)
+    {
+      compound_index_[targeted_exp.compounds[i].id] = i;
+    }
+    for (Size i = 0; i < targeted_exp.proteins.size(); i++)
+    {
+      protein_index_[targeted_exp.proteins[i].id] = i;
+    }
+  }
+
+  std::vector<Size> SwathTransitionIndex::query(double min_upper_edge_dist, double lower, double upper) const
+  {
+    // same window criterion as the linear scan in selectSwathTransitions():
+    // lower < mz < upper and at least min_upper_edge_dist away from the upper edge
+    std::vector<Size> results;
+    auto it = std::upper_bound(mz_index_.begin(), mz_index_.end(),
+                               std::make_pair(lower, std::numeric_limits<Size>::max()));
+    for (; (it != mz_index_.end()) && (it->first < upper); ++it)
+    {
+      if (std::fabs(upper - it->first) >= min_upper_edge_dist)
+      {
+        results.push_back(it->second);
+      }
+    }
+    std::sort(results.begin(), results.end());
+    return results;
+  }
+
+  bool SwathTransitionIndex::hasCompound(const std::string& id) const
+  {
+    return compound_index_.find(id) != compound_index_.end();
+  }
+
+  Size SwathTransitionIndex::getCompoundIndex(const std::string& id) const
+  {
+    auto it = compound_index_.find(id);
+    if (it == compound_index_.end())
+    {
+      throw Exception::ElementNotFound(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, id);
+    }
+    return it->second;
+  }
+
+  bool SwathTransitionIndex::hasProtein(const std::string& id) const
+  {
+    return protein_index_.find(id) != protein_index_.end();
+  }
+
+  Size SwathTransitionIndex::getProteinIndex(const std::string& id) const
+  {
+    auto it = protein_index_.find(id);
+    if (it == protein_index_.end())
+    {
+      throw Exception::ElementNotFound(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, id);
+    }
+    return it->second;
+  }
+
+  SwathMapIndex::SwathMapIndex(const std::vector<OpenSwath::SwathMap>& swath_maps)
+  {
+    build(swath_maps);
+  }
+
+  void SwathMapIndex::build(const std::vector<OpenSwath::SwathMap>& swath_maps)
+  {
+    windows_.clear();
+    max_width_ = 0.0;
+
+    windows_.reserve(swath_maps.size());
+    for (Size i = 0; i < swath_maps.size(); i++)
+    {
+      if (swath_maps[i].ms1) {continue;} // skip MS1
+      windows_.push_back(Window{swath_maps[i].lower, swath_maps[i].upper, i});
+      if (swath_maps[i].upper - swath_maps[i].lower > max_width_)
+      {
+        max_width_ = swath_maps[i].upper - swath_maps[i].lower;
+      }
+    }
+    std::sort(windows_.begin(), windows_.end(),
+              [](const Window& left, const Window& right) { return left.lower < right.lower; });
+  }
+
+  std::vector<Size> SwathMapIndex::query(double precursor_mz) const
+  {
+    // every window containing precursor_mz has its lower edge within
+    // max_width_ below it; binary search for that range, then apply the same
+    // criterion as a linear scan over the maps (lower < m/z < upper)
+    std::vector<Size> results;
+    auto it = std::lower_bound(windows_.begin(), windows_.end(), precursor_mz - max_width_,
+                               [](const Window& window, double value) { return window.lower < value; });
+    for (; (it != windows_.end()) && (it->lower < precursor_mz); ++it)
+    {
+      if (precursor_mz < it->upper)
+      {
+        results.push_back(it->map_idx);
+      }
+    }
+    std::sort(results.begin(), results.end());
+    return results;
+  }
+
+  std::vector<Size> SwathMapIndex::queryOverlap(double start, double end) const
+  {
+    std::vector<Size> results;
+    auto it = std::lower_bound(windows_.begin(), windows_.end(), start - max_width_,
+                               [](const Window& window, double value) { return window.lower < value; });
+    for (; (it != windows_.end()) && (it->lower <= end); ++it)
+    {
+      // same criterion as the SONAR window selection: one of the interval
+      // edges falls into the isolation window (note that a window lying
+      // strictly inside (start, end) does not qualify)
+      if ((start >= it->lower && start <= it->upper) ||
+          (end >= it->lower && end <= it->upper))
+      {
+        results.push_back(it->map_idx);
+      }
+    }
+    std::sort(results.begin(), results.end());
+    return results;
+  }
+
   void OpenSwathHelper::selectSwathTransitions(const OpenMS::TargetedExperiment& targeted_exp,
                                                OpenMS::TargetedExperiment& transition_exp_used, double min_upper_edge_dist,
                                                double lower, double upper)
@@ -145,6 +287,42 @@ namespace OpenMS
     }
   }
 
+  void OpenSwathHelper::selectSwathTransitions(const OpenSwath::LightTargetedExperiment& targeted_exp,
+                                               const SwathTransitionIndex& index,
+                                               OpenSwath::LightTargetedExperiment& transition_exp_used, double min_upper_edge_dist,
+                                               double lower, double upper)
+  {
+    // matching compounds / proteins are collected as positions (sorted sets)
+    // so that the output keeps the original library order, exactly like the
+    // linear-scan overload
+    std::set<Size> matching_compounds;
+    for (Size i : index.query(min_upper_edge_dist, lower, upper))
+    {
+      const OpenSwath::LightTransition& tr = targeted_exp.transitions[i];
+      transition_exp_used.transitions.push_back(tr);
+      if (index.hasCompound(tr.getPeptideRef()))
+      {
+        matching_compounds.insert(index.getCompoundIndex(tr.getPeptideRef()));
+      }
+    }
+    std::set<Size> matching_proteins;
+    for (Size i : matching_compounds)
+    {
+      transition_exp_used.compounds.push_back( targeted_exp.compounds[i] );
+      for (Size j = 0; j < targeted_exp.compounds[i].protein_refs.size(); j++)
+      {
+        if (index.hasProtein(targeted_exp.compounds[i].protein_refs[j]))
+        {
+          matching_proteins.insert(index.getProteinIndex(targeted_exp.compounds[i].protein_refs[j]));
+        }
+      }
+    }
+    for (Size i : matching_proteins)
+    {
+      transition_exp_used.proteins.push_back( targeted_exp.proteins[i] );
+    }
+  }
+
   std::pair<double,double> OpenSwathHelper::estimateRTRange(const OpenSwath::LightTargetedExperiment & exp)
   {
     if (exp.getCompounds().empty())
@@ -8,34 +8,18 @@
 
 #include <OpenMS/ANALYSIS/OPENSWATH/OpenSwathOSWWriter.h>
 
+#include <OpenMS/CONCEPT/Exception.h>
+#include <OpenMS/FORMAT/FileHandler.h>
 #include <OpenMS/FORMAT/SqliteConnector.h>
+#include <OpenMS/SYSTEM/File.h>
 
 #include <sqlite3.h>
 
-namespace OpenMS
+namespace
 {
-  OpenSwathOSWWriter::OpenSwathOSWWriter(const String& output_filename, const UInt64 run_id, const String& input_filename, bool ms1_scores, bool sonar, bool uis_scores) :
-    output_filename_(output_filename),
-    input_filename_(input_filename),
-    run_id_(Internal::SqliteHelper::clearSignBit(run_id)),
-    doWrite_(!output_filename.empty()),
-    use_ms1_traces_(ms1_scores),
-    sonar_(sonar),
-    enable_uis_scoring_(uis_scores)
-  {}
-
-  bool OpenSwathOSWWriter::isActive() const
-  {
-    return doWrite_;
-  }
-
-  void OpenSwathOSWWriter::writeHeader()
-  {
-    // Open database
-    SqliteConnector conn(output_filename_);
-
-    // Create SQL structure
-    const char * create_sql =
+  // SQL statements creating the OSW tables (shared between writeHeader and
+  // the shard merge)
+  const char * OSW_CREATE_SQL =
       "CREATE TABLE RUN(" \
       "ID INT PRIMARY KEY NOT NULL," \
       "FILENAME TEXT NOT NULL); " \
@@ -143,9 +127,33 @@ namespace OpenMS
       "VAR_MI_RATIO_SCORE REAL NULL," \
       "VAR_ISOTOPE_CORRELATION_SCORE REAL NULL," \
       "VAR_ISOTOPE_OVERLAP_SCORE REAL NULL);";
+}
+
+namespace OpenMS
+{
+  OpenSwathOSWWriter::OpenSwathOSWWriter(const String& output_filename, const UInt64 run_id, const String& input_filename, bool ms1_scores, bool sonar, bool uis_scores) :
+    output_filename_(output_filename),
+    input_filename_(input_filename),
+    run_id_(Internal::SqliteHelper::clearSignBit(run_id)),
+    doWrite_(!output_filename.empty()),
+    use_ms1_traces_(ms1_scores),
+    sonar_(sonar),
+    enable_uis_scoring_(uis_scores),
+    shard_output_(false)
+  {}
+
+  bool OpenSwathOSWWriter::isActive() const
+  {
+    return doWrite_;
+  }
+
+  void OpenSwathOSWWriter::writeHeader()
+  {
+    // Open database
+    SqliteConnector conn(output_filename_);
 
     // Execute SQL create statement
-    conn.executeStatement(create_sql);
+    conn.executeStatement(OSW_CREATE_SQL);
 
     // Insert run_id information
     std::stringstream sql_run;
@@ -469,5 +477,127 @@ namespace OpenMS
     }
     conn.executeStatement("END TRANSACTION");
   }
+
+  void OpenSwathOSWWriter::setShardOutput(bool shard_output)
+  {
+    shard_output_ = shard_output;
+  }
+
+  bool OpenSwathOSWWriter::shardOutput() const
+  {
+    return doWrite_ && shard_output_;
+  }
+
+  String OpenSwathOSWWriter::getShardFilename(Size swath_idx) const
+  {
+    return FileHandler::stripExtension(output_filename_) + "_shard_" + String(swath_idx) + ".osw";
+  }
+
+  String OpenSwathOSWWriter::getManifestFilename() const
+  {
+    return FileHandler::stripExtension(output_filename_) + "_shards.manifest";
+  }
+
+  OpenSwathOSWWriter OpenSwathOSWWriter::createShardWriter(Size swath_idx) const
+  {
+    OpenSwathOSWWriter shard_writer(*this);
+    shard_writer.output_filename_ = getShardFilename(swath_idx);
+    shard_writer.shard_output_ = false;
+
+    // A shard that exists but is not yet listed in the manifest stems from an
+    // interrupted run and may be incomplete - recompute it from scratch.
+    if (File::exists(shard_writer.output_filename_))
+    {
+      File::remove(shard_writer.output_filename_);
+    }
+    return shard_writer;
+  }
+
+  std::set<Size> OpenSwathOSWWriter::readManifest() const
+  {
+    std::set<Size> completed;
+    std::ifstream manifest(getManifestFilename().c_str());
+    std::string line;
+    while (std::getline(manifest, line))
+    {
+      String entry(line);
+      entry.trim();
+      if (entry.empty()) continue;
+
+      std::vector<String> fields;
+      entry.split('\t', fields);
+      // only trust entries whose shard file is still present
+      if (fields.size() == 2 && File::exists(fields[1]))
+      {
+        completed.insert(fields[0].toInt());
+      }
+    }
+    return completed;
+  }
+
+  void OpenSwathOSWWriter::markShardDone(Size swath_idx)
+  {
+    std::ofstream manifest(getManifestFilename().c_str(), std::ios::app);
+    manifest << swath_idx << '\t' << getShardFilename(swath_idx) << std::endl;
+  }
+
+  void OpenSwathOSWWriter::mergeShards()
+  {
+    std::set<Size> completed = readManifest();
+    if (completed.empty())
+    {
+      // nothing was computed (e.g. no transitions matched any window); still
+      // create the tables so that the output is a valid OSW file
+      writeHeader();
+      return;
+    }
+
+    std::vector<String> shard_filenames;
+    for (Size swath_idx : completed)
+    {
+      shard_filenames.push_back(getShardFilename(swath_idx));
+    }
+    mergeShardFiles(shard_filenames, output_filename_);
+
+    // the shards were merged; clean up so that a subsequent run starts fresh
+    for (Size k = 0; k < shard_filenames.size(); k++)
+    {
+      File::remove(shard_filenames[k]);
+    }
+    File::remove(getManifestFilename());
+  }
+
+  void OpenSwathOSWWriter::mergeShardFiles(const std::vector<String>& shard_filenames, const String& merged_filename)
+  {
+    if (shard_filenames.empty())
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+          "Cannot merge OSW shards, no shard files given.");
+    }
+
+    SqliteConnector conn(merged_filename);
+    conn.executeStatement(OSW_CREATE_SQL);
+
+    for (Size k = 0; k < shard_filenames.size(); k++)
+    {
+      conn.executeStatement("ATTACH DATABASE '" + shard_filenames[k] + "' AS shard;");
+      if (k == 0)
+      {
+        // adopt the run entry of the first shard; shards written by a resumed
+        // run may carry a different run id, their features are re-assigned
+        // below
+        conn.executeStatement("INSERT INTO RUN SELECT * FROM shard.RUN;");
+      }
+      conn.executeStatement("BEGIN TRANSACTION");
+      conn.executeStatement("INSERT INTO FEATURE SELECT * FROM shard.FEATURE;");
+      conn.executeStatement("INSERT INTO FEATURE_MS1 SELECT * FROM shard.FEATURE_MS1;");
+      conn.executeStatement("INSERT INTO FEATURE_MS2 SELECT * FROM shard.FEATURE_MS2;");
+      conn.executeStatement("INSERT INTO FEATURE_PRECURSOR SELECT * FROM shard.FEATURE_PRECURSOR;");
+      conn.executeStatement("INSERT INTO FEATURE_TRANSITION SELECT * FROM shard.FEATURE_TRANSITION;");
+      conn.executeStatement("END TRANSACTION");
+      conn.executeStatement("DETACH DATABASE shard;");
+    }
+    conn.executeStatement("UPDATE FEATURE SET RUN_ID = (SELECT ID FROM RUN);");
+  }
 }
 
@@ -8,6 +8,9 @@
 
 #include <OpenMS/ANALYSIS/OPENSWATH/OpenSwathWorkflow.h>
 
+#include <algorithm>
+#include <numeric>
+
 // OpenSwathCalibrationWorkflow
 namespace OpenMS
 {
@@ -310,6 +313,10 @@ namespace OpenMS
       OpenSwathHelper::selectSwathTransitionsPasef(irt_transitions, tr_win_map, cp.min_upper_edge_dist, swath_maps);
     }
 
+    // Build the precursor m/z index once; it is read-only afterwards and
+    // shared by all threads answering per-window queries.
+    SwathTransitionIndex irt_transition_index(irt_transitions);
+
     this->startProgress(0, 1, "Extract iRT chromatograms");
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic,1)
@@ -359,7 +366,7 @@ namespace OpenMS
         }
         else
         {
-          OpenSwathHelper::selectSwathTransitions(irt_transitions, transition_exp_used,
+          OpenSwathHelper::selectSwathTransitions(irt_transitions, irt_transition_index, transition_exp_used,
           cp.min_upper_edge_dist, swath_maps[map_idx].lower, swath_maps[map_idx].upper);
         }
         if (!transition_exp_used.getTransitions().empty()) // skip if no transitions found
@@ -488,10 +495,37 @@ namespace OpenMS
     int ms1_isotopes,
     bool load_into_memory)
   {
+    bool ms1_only = (swath_maps.size() == 1 && swath_maps[0].ms1);
+    if (ms1_only)
+    {
+      // MS1-only runs have no SWATH windows to partition, fall back to
+      // writing the shared output directly
+      osw_writer.setShardOutput(false);
+    }
+
     tsv_writer.writeHeader();
-    osw_writer.writeHeader();
+    if (!osw_writer.shardOutput())
+    {
+      // in shard mode the tables of the final output are created when the
+      // shards are merged (see OpenSwathOSWWriter::mergeShards)
+      osw_writer.writeHeader();
+    }
 
-    bool ms1_only = (swath_maps.size() == 1 && swath_maps[0].ms1);
+    // In partitioned (shard) mode each SWATH window commits its features to
+    // its own OSW shard and is recorded in a manifest once finished; windows
+    // already listed there were completed by an earlier run and are skipped.
+    // The final output is assembled from the shards by the caller (see
+    // OpenSwathOSWWriter::mergeShards).
+    std::set<Size> completed_windows;
+    if (osw_writer.shardOutput())
+    {
+      completed_windows = osw_writer.readManifest();
+      if (!completed_windows.empty())
+      {
+        std::cout << "Resuming partitioned run, " << completed_windows.size() <<
+          " SWATH windows were already completed by an earlier run." << std::endl;
+      }
+    }
 
     // Compute inversion of the transformation
     TransformationDescription trafo_inverse = trafo;
@@ -615,10 +649,47 @@ namespace OpenMS
     else {
     };
 
+    // Build the precursor m/z index once; it is read-only afterwards and
+    // shared by all threads answering per-window queries.
+    SwathTransitionIndex transition_index(transition_exp);
+
+    // Estimate the workload per SWATH window (number of transitions falling
+    // into it) and process the windows in descending workload order: with
+    // dynamic scheduling the most expensive windows are started first, which
+    // avoids a long serial tail on runs with many threads and few windows.
+    std::vector<Size> window_workload(swath_maps.size(), 0);
+    if (prm_ || pasef_)
+    {
+      for (Size k = 0; k < tr_win_map.size(); k++)
+      {
+        if (tr_win_map[k] >= 0)
+        {
+          ++window_workload[tr_win_map[k]];
+        }
+      }
+    }
+    else
+    {
+      for (Size w = 0; w < swath_maps.size(); w++)
+      {
+        if (!swath_maps[w].ms1)
+        {
+          window_workload[w] = transition_index.query(cp.min_upper_edge_dist, swath_maps[w].lower, swath_maps[w].upper).size();
+        }
+      }
+    }
+    std::vector<SignedSize> swath_processing_order(swath_maps.size());
+    std::iota(swath_processing_order.begin(), swath_processing_order.end(), 0);
+    std::stable_sort(swath_processing_order.begin(), swath_processing_order.end(),
+                     [&window_workload](SignedSize a, SignedSize b)
+                     {
+                       return window_workload[a] > window_workload[b];
+                     });
+
     // (iv) Perform extraction and scoring of fragment ion chromatograms (MS2)
-    // We set dynamic scheduling such that the maps are worked on in the order
-    // in which they were given to the program / acquired. This gives much
-    // better load balancing than static allocation.
+    // We set dynamic scheduling such that the maps are worked on in
+    // descending workload order. This gives much better load balancing than
+    // static allocation.
 #ifdef _OPENMP
 #ifdef MT_ENABLE_NESTED_OPENMP
     int total_nr_threads = omp_get_max_threads(); // store total number of threads we are allowed to use
@@ -636,9 +707,10 @@ namespace OpenMS
 #endif
 #pragma omp parallel for schedule(dynamic,1)
 #endif
-    for (SignedSize i = 0; i < boost::numeric_cast<SignedSize>(swath_maps.size()); ++i)
+    for (SignedSize order_idx = 0; order_idx < boost::numeric_cast<SignedSize>(swath_processing_order.size()); ++order_idx)
     {
-      if (!swath_maps[i].ms1) // skip MS1
+      const SignedSize i = swath_processing_order[order_idx];
+      if (!swath_maps[i].ms1 && completed_windows.find(Size(i)) == completed_windows.end()) // skip MS1 and windows finished in an earlier run
       {
 
         // Step 1: select which transitions to extract (proceed in batches)
@@ -646,7 +718,7 @@ namespace OpenMS
         if (!(prm_ || pasef_))
         {
           // Step 1.1: select transitions matching the window
-          OpenSwathHelper::selectSwathTransitions(transition_exp, transition_exp_used_all,
+          OpenSwathHelper::selectSwathTransitions(transition_exp, transition_index, transition_exp_used_all,
               cp.min_upper_edge_dist, swath_maps[i].lower, swath_maps[i].upper);
         }
         else
@@ -707,6 +779,15 @@ namespace OpenMS
 
           SignedSize nr_batches = (transition_exp_used_all.getCompounds().size() / batch_size);
 
+          // In shard mode all features of this window go into a dedicated
+          // shard file instead of the shared output.
+          OpenSwathOSWWriter window_osw_writer(osw_writer);
+          if (osw_writer.shardOutput())
+          {
+            window_osw_writer = osw_writer.createShardWriter(i);
+            window_osw_writer.writeHeader();
+          }
+
 #ifdef _OPENMP
 #ifdef MT_ENABLE_NESTED_OPENMP
           // If we have a multiple of threads_outer_loop_ here, then use nested
@@ -789,7 +870,7 @@ namespace OpenMS
             std::vector< OpenSwath::SwathMap > tmp = {swath_maps[i]};
             tmp.back().sptr = current_swath_map_inner;
             scoreAllChromatograms_(chrom_exp.getChromatograms(), ms1_chromatograms, tmp, transition_exp_used,
-                feature_finder_param, trafo, cp.rt_extraction_window, featureFile, tsv_writer, osw_writer, ms1_isotopes);
+                feature_finder_param, trafo, cp.rt_extraction_window, featureFile, tsv_writer, window_osw_writer, ms1_isotopes);
 
             // Step 4: write all chromatograms and features out into an output object / file
             // (this needs to be done in a critical section since we only have one
@@ -800,6 +881,16 @@ namespace OpenMS
             }
           }
 
+          if (osw_writer.shardOutput())
+          {
+            // the shard is complete on disk, record it in the manifest so
+            // that a restarted run can skip this window
+            #pragma omp critical (osw_write_out)
+            {
+              osw_writer.markShardDone(i);
+            }
+          }
+
         } // continue 2 (no continue due to OpenMP)
       } // continue 1 (no continue due to OpenMP)
 
@@ -1197,6 +1288,16 @@ namespace OpenMS
 
       std::cout << "Will analyze " << transition_exp.transitions.size() << " transitions in total." << std::endl;
       int progress = 0;
+
+      // Build the precursor m/z index once; it is read-only afterwards and
+      // shared by all threads answering per-window queries.
+      SwathTransitionIndex transition_index(transition_exp);
+
+      // Inverted index over the map isolation windows: answers which SONAR
+      // maps to use for a given window without scanning all maps. Also built
+      // once and shared read-only by all threads.
+      SwathMapIndex swath_map_index(swath_maps);
+
       this->startProgress(0, sonar_total_win, "Extracting and scoring transitions");
 
       ///////////////////////////////////////////////////////////////////////////
@@ -1216,7 +1317,7 @@ namespace OpenMS
 
         // Step 1: select which transitions to extract with the current windows (proceed in batches)
         OpenSwath::LightTargetedExperiment transition_exp_used_all;
-        OpenSwathHelper::selectSwathTransitions(transition_exp, transition_exp_used_all,
+        OpenSwathHelper::selectSwathTransitions(transition_exp, transition_index, transition_exp_used_all,
             0, currwin_start, currwin_end);
 
         if (!transition_exp_used_all.getTransitions().empty()) // skip if no transitions found
@@ -1227,20 +1328,14 @@ namespace OpenMS
           // Identify which SONAR windows to use for current set of transitions
           //////////////////////////////////
           std::vector< OpenSwath::SwathMap > used_maps;
-          for (size_t i = 0; i < swath_maps.size(); ++i)
+          // TODO: what if the swath map is smaller than the current window ??
+          for (Size i : swath_map_index.queryOverlap(currwin_start, currwin_end))
           {
-            if (swath_maps[i].ms1) {continue;} // skip MS1
-
-            // TODO: what if the swath map is smaller than the current window ??
-            if (  (currwin_start >= swath_maps[i].lower && currwin_start <= swath_maps[i].upper  ) ||
-                  (currwin_end >= swath_maps[i].lower && currwin_end <= swath_maps[i].upper  ) )
-            {
 #ifdef OPENSWATH_WORKFLOW_DEBUG
-              std::cout << " will use curr window  " << i << " : " << swath_maps[i].lower << "-" <<
-                                                                      swath_maps[i].upper << std::endl;
+            std::cout << " will use curr window  " << i << " : " << swath_maps[i].lower << "-" <<
+                                                                    swath_maps[i].upper << std::endl;
 #endif
-              used_maps.push_back(swath_maps[i]);
-            }
+            used_maps.push_back(swath_maps[i]);
           }
 
           //////////////////////////////////
@@ -1390,21 +1485,31 @@ namespace OpenMS
       typedef std::vector< ChromatogramExtractor::ExtractionCoordinates > coordinatesList;
 
       ChromatogramExtractor extractor;
+
+      // Match each precursor against the used isolation windows once (through
+      // the inverted index) and cache the coordinate list per map; both the
+      // extraction and the aggregation pass below reuse these lists.
+      SwathMapIndex map_index(used_maps);
+      std::vector< std::vector<size_t> > coords_per_map(used_maps.size());
+      for (size_t c_idx = 0; c_idx < coordinates.size(); c_idx++)
+      {
+        for (Size map_idx : map_index.query(coordinates[c_idx].mz_precursor))
+        {
+          coords_per_map[map_idx].push_back(c_idx);
+        }
+      }
+
       // Iterate over all SONAR maps we currently have and extract chromatograms from them
       for (size_t map_idx = 0; map_idx < used_maps.size(); map_idx++)
       {
         chromatogramList tmp_chromatogram_list;
         coordinatesList coordinates_used;
 
-        for (size_t c_idx = 0; c_idx < coordinates.size(); c_idx++)
+        for (size_t c_idx : coords_per_map[map_idx])
         {
-          if (coordinates[c_idx].mz_precursor > used_maps[map_idx].lower &&
-              coordinates[c_idx].mz_precursor < used_maps[map_idx].upper)
-          {
-            coordinates_used.push_back( coordinates[c_idx] );
-            OpenSwath::ChromatogramPtr s(new OpenSwath::Chromatogram);
-            tmp_chromatogram_list.push_back(s);
-          }
+          coordinates_used.push_back( coordinates[c_idx] );
+          OpenSwath::ChromatogramPtr s(new OpenSwath::Chromatogram);
+          tmp_chromatogram_list.push_back(s);
         }
 
 #ifdef OPENSWATH_WORKFLOW_DEBUG
@@ -1420,20 +1525,12 @@ namespace OpenMS
         // the data, we will aggregate the data by adding all
         // chromatograms from different SONAR scans up
         size_t chrom_idx = 0;
-        for (size_t c_idx = 0; c_idx < coordinates.size(); c_idx++)
+        for (size_t c_idx : coords_per_map[map_idx])
         {
-          if (coordinates[c_idx].mz_precursor > used_maps[map_idx].lower &&
-              coordinates[c_idx].mz_precursor < used_maps[map_idx].upper)
-          {
+          /// add the new chromatogram to the one that we already have (the base chromatogram)
+          chrom_list[c_idx] = addChromatograms(chrom_list[c_idx], tmp_chromatogram_list[chrom_idx]);
 
-            OpenSwath::ChromatogramPtr s = tmp_chromatogram_list[chrom_idx];
-            OpenSwath::ChromatogramPtr base_chrom = chrom_list[c_idx];
-
-            /// add the new chromatogram to the one that we already have (the base chromatogram)
-            chrom_list[c_idx] = addChromatograms(chrom_list[c_idx], tmp_chromatogram_list[chrom_idx]);
-
-            chrom_idx++;
-          }
+          chrom_idx++;
         }
       }
 
@@ -79,6 +79,41 @@ namespace OpenMS
     return calculatePeakShapeMetrics_(spectrum, left->getMZ(), right->getMZ(), peak_height, peak_apex_pos);
   }
 
+  PeakIntegrator::PeakProperties PeakIntegrator::computePeakProperties(const MSChromatogram& chromatogram, const double left, const double right) const
+  {
+    return computePeakProperties_(chromatogram, left, right);
+  }
+
+  PeakIntegrator::PeakProperties PeakIntegrator::computePeakProperties(const MSSpectrum& spectrum, const double left, const double right) const
+  {
+    return computePeakProperties_(spectrum, left, right);
+  }
+
+  std::vector<PeakIntegrator::PeakProperties> PeakIntegrator::computePeakProperties(
+    const std::vector<MSChromatogram>& chromatograms,
+    const std::vector<PeakBoundary>& boundaries) const
+  {
+    // validate the requests up front; exceptions must not escape the parallel region
+    for (const PeakBoundary& boundary : boundaries)
+    {
+      if (boundary.chromatogram_idx >= chromatograms.size())
+      {
+        throw Exception::InvalidValue(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+                                      "Chromatogram index in peak boundary is out of range.",
+                                      String(boundary.chromatogram_idx));
+      }
+    }
+
+    std::vector<PeakProperties> results(boundaries.size());
+    #pragma omp parallel for schedule(dynamic)
+    for (SignedSize i = 0; i < (SignedSize)boundaries.size(); ++i)
+    {
+      const PeakBoundary& boundary = boundaries[i];
+      results[i] = computePeakProperties_(chromatograms[boundary.chromatogram_idx], boundary.left, boundary.right);
+    }
+    return results;
+  }
+
   void PeakIntegrator::getDefaultParameters(Param& params)
   {
     params.clear();
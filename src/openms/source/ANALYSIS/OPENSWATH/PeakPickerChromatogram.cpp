@@ -99,6 +99,100 @@ namespace OpenMS
       gauss_.filter(smoothed_chrom);
     }
 
+    pickSmoothedChromatogram_(chromatogram, smoothed_chrom, picked_chrom, true);
+  }
+
+  void PeakPickerChromatogram::pickChromatograms(const std::vector<MSChromatogram>& chromatograms,
+                                                 std::vector<MSChromatogram>& picked_chroms,
+                                                 std::vector<MSChromatogram>& smoothed_chroms)
+  {
+    picked_chroms.clear();
+    smoothed_chroms.clear();
+    picked_chroms.resize(chromatograms.size());
+    smoothed_chroms.resize(chromatograms.size());
+
+    // Crawdad does its own smoothing and noise estimation, so there is nothing to share:
+    if (method_ == "crawdad")
+    {
+      for (Size i = 0; i < chromatograms.size(); ++i)
+      {
+        pickChromatogram(chromatograms[i], picked_chroms[i], smoothed_chroms[i]);
+      }
+      return;
+    }
+
+    for (const MSChromatogram& chromatogram : chromatograms)
+    {
+      if (!chromatogram.isSorted())
+      {
+        throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+                                         "Chromatogram must be sorted by position");
+      }
+    }
+
+    // Smooth all chromatograms; the filter kernels are tabulated once (in updateMembers_())
+    // and reused across the group
+    for (Size i = 0; i < chromatograms.size(); ++i)
+    {
+      smoothed_chroms[i] = chromatograms[i];
+      if (!use_gauss_)
+      {
+        sgolay_.filter(smoothed_chroms[i]);
+      }
+      else
+      {
+        gauss_.filter(smoothed_chroms[i]);
+      }
+    }
+
+    // Estimate the noise level once for the whole group on the position-wise sum of all
+    // chromatograms (they share the RT grid, so we sum into the longest one):
+    bool shared_snt = false;
+    if (signal_to_noise_ > 0.0 && !chromatograms.empty())
+    {
+      Size longest = 0;
+      for (Size i = 1; i < chromatograms.size(); ++i)
+      {
+        if (chromatograms[i].size() > chromatograms[longest].size())
+        {
+          longest = i;
+        }
+      }
+      if (!chromatograms[longest].empty())
+      {
+        MSChromatogram stacked = chromatograms[longest];
+        for (Size i = 0; i < chromatograms.size(); ++i)
+        {
+          if (i == longest)
+          {
+            continue;
+          }
+          for (Size p = 0; p < chromatograms[i].size(); ++p)
+          {
+            stacked[p].setIntensity(stacked[p].getIntensity() + chromatograms[i][p].getIntensity());
+          }
+        }
+        snt_.init(stacked);
+        shared_snt = true;
+      }
+    }
+
+    for (Size i = 0; i < chromatograms.size(); ++i)
+    {
+      if (chromatograms[i].empty())
+      {
+        OPENMS_LOG_DEBUG << " ====  Chromatogram " << chromatograms[i].getNativeID() << "empty. Skip picking.";
+        continue;
+      }
+      picked_chroms[i].clear(true);
+      pickSmoothedChromatogram_(chromatograms[i], smoothed_chroms[i], picked_chroms[i], !shared_snt);
+    }
+  }
+
+  void PeakPickerChromatogram::pickSmoothedChromatogram_(const MSChromatogram& chromatogram,
+                                                         const MSChromatogram& smoothed_chrom,
+                                                         MSChromatogram& picked_chrom, bool init_snt)
+  {
     // Find initial seeds (peak picking)
     pp_.pick(smoothed_chrom, picked_chrom);
     OPENMS_LOG_DEBUG << "Picked " << picked_chrom.size() << " chromatographic peaks." << std::endl;
@@ -106,7 +200,7 @@ namespace OpenMS
     if (method_ == "legacy")
     {
       // Legacy is to use the original chromatogram for peak-detection
-      pickChromatogram_(chromatogram, picked_chrom);
+      pickChromatogram_(chromatogram, picked_chrom, init_snt);
       if (remove_overlapping_)
         removeOverlappingPeaks_(chromatogram, picked_chrom);
 
@@ -116,7 +210,7 @@ namespace OpenMS
     else if (method_ == "corrected")
     {
       // use the smoothed chromatogram to derive the peak boundaries
-      pickChromatogram_(smoothed_chrom, picked_chrom);
+      pickChromatogram_(smoothed_chrom, picked_chrom, init_snt);
       if (remove_overlapping_)
         removeOverlappingPeaks_(smoothed_chrom, picked_chrom);
 
@@ -145,7 +239,7 @@ namespace OpenMS
     }
   }
 
-  void PeakPickerChromatogram::pickChromatogram_(const MSChromatogram& chromatogram, MSChromatogram& picked_chrom)
+  void PeakPickerChromatogram::pickChromatogram_(const MSChromatogram& chromatogram, MSChromatogram& picked_chrom, bool init_snt)
   {
 
     integrated_intensities_.clear();
@@ -155,7 +249,7 @@ namespace OpenMS
     left_width_.reserve(picked_chrom.size());
     right_width_.reserve(picked_chrom.size());
 
-    if (signal_to_noise_ > 0.0)
+    if (signal_to_noise_ > 0.0 && init_snt)
     {
       snt_.init(chromatogram);
     }
@@ -10,6 +10,7 @@
 
 #include <OpenMS/ANALYSIS/OPENSWATH/DIAScoring.h>
 #include <OpenMS/ANALYSIS/OPENSWATH/DIAHelper.h>
+#include <OpenMS/ANALYSIS/OPENSWATH/OpenSwathHelper.h>
 #include <OpenMS/OPENSWATHALGO/ALGO/StatsHelpers.h>
 
 #include <OpenMS/MATH/STATISTICS/LinearRegression.h>
@@ -147,6 +148,38 @@ namespace OpenMS
     // idea 2: check the SONAR profile (e.g. in the dimension of) of the best scan (RT apex)
     double RT = imrmfeature->getRT();
 
+    // Which maps cover the precursor (answered through the inverted isolation
+    // window index), and which scan sits closest to the feature apex in each
+    // map, only depend on the transition group - cache both once here instead
+    // of recomputing them for every transition below.
+    SwathMapIndex map_index(swath_maps);
+    std::vector<Size> covering_maps = map_index.query(precursor_mz);
+
+    std::vector<OpenSwath::SpectrumPtr> apex_spectra;
+    std::vector<bool> signal_exp;
+    Size covering_pos = 0;
+    for (Size swath_idx = 0; swath_idx < swath_maps.size(); swath_idx++)
+    {
+      OpenSwath::SpectrumAccessPtr swath_map = swath_maps[swath_idx].sptr;
+
+      if (swath_maps[swath_idx].ms1) {continue;} // skip MS1
+      while (covering_pos < covering_maps.size() && covering_maps[covering_pos] < swath_idx) {covering_pos++;}
+      bool expect_signal = (covering_pos < covering_maps.size() && covering_maps[covering_pos] == swath_idx);
+
+      // find closest scan for current SONAR map (by retention time)
+      std::vector<std::size_t> indices = swath_map->getSpectraByRT(RT, 0.0);
+      if (indices.empty() )  {continue;}
+      int closest_idx = boost::numeric_cast<int>(indices[0]);
+      if (indices[0] != 0 &&
+          std::fabs(swath_map->getSpectrumMetaById(boost::numeric_cast<int>(indices[0]) - 1).RT - RT) <
+          std::fabs(swath_map->getSpectrumMetaById(boost::numeric_cast<int>(indices[0])).RT - RT))
+      {
+        closest_idx--;
+      }
+      apex_spectra.push_back(swath_map->getSpectrumById(closest_idx));
+      signal_exp.push_back(expect_signal);
+    }
+
     // Aggregate sonar profiles (for each transition)
     std::vector<std::vector<double> > sonar_profiles;
     std::vector<double> sn_score;
@@ -159,43 +192,19 @@ namespace OpenMS
     {
       String native_id = transitions[k].getNativeID();
 
-      // Gather profiles across all SONAR maps
+      // Gather profiles across all SONAR maps (using the cached apex scans)
       std::vector<double> sonar_profile;
       std::vector<double> sonar_mz_profile;
-      std::vector<bool> signal_exp;
-      for (Size swath_idx = 0; swath_idx < swath_maps.size(); swath_idx++)
+      RangeMZ mz_range = DIAHelpers::createMZRangePPM(transitions[k].getProductMZ(), dia_extract_window_, dia_extraction_ppm_);
+      for (Size scan_idx = 0; scan_idx < apex_spectra.size(); scan_idx++)
       {
-        OpenSwath::SpectrumAccessPtr swath_map = swath_maps[swath_idx].sptr;
-
-        bool expect_signal = false;
-        if (swath_maps[swath_idx].ms1) {continue;} // skip MS1
-        if (precursor_mz > swath_maps[swath_idx].lower && precursor_mz < swath_maps[swath_idx].upper)
-        {
-          expect_signal = true;
-        }
-
-        // find closest scan for current SONAR map (by retention time)
-        std::vector<std::size_t> indices = swath_map->getSpectraByRT(RT, 0.0);
-        if (indices.empty() )  {continue;}
-        int closest_idx = boost::numeric_cast<int>(indices[0]);
-        if (indices[0] != 0 &&
-            std::fabs(swath_map->getSpectrumMetaById(boost::numeric_cast<int>(indices[0]) - 1).RT - RT) <
-            std::fabs(swath_map->getSpectrumMetaById(boost::numeric_cast<int>(indices[0])).RT - RT))
-        {
-          closest_idx--;
-        }
-        OpenSwath::SpectrumPtr spectrum_ = swath_map->getSpectrumById(closest_idx);
-
         // integrate intensity within that scan
-        RangeMZ mz_range = DIAHelpers::createMZRangePPM(transitions[k].getProductMZ(), dia_extract_window_, dia_extraction_ppm_);
-
         double mz, intensity, im; // create im even though not used
         RangeMobility im_range;
-        DIAHelpers::integrateWindow(spectrum_, mz, im, intensity, mz_range, im_range, dia_centroided_);
+        DIAHelpers::integrateWindow(apex_spectra[scan_idx], mz, im, intensity, mz_range, im_range, dia_centroided_);
 
         sonar_profile.push_back(intensity);
         sonar_mz_profile.push_back(mz);
-        signal_exp.push_back(expect_signal);
       }
       sonar_profiles.push_back(sonar_profile);
 
@@ -117,20 +117,19 @@ namespace OpenMS
       ++cnt;
     }
 
-    LinearResamplerAlign lresampler;
-    // resample all spectra and add to master spectrum
+    // resample all spectra onto the uniform grid and sum them up in one fused
+    // pass, writing directly into the output intensity buffer
+    std::vector<const double*> mz_arrays, int_arrays;
+    std::vector<Size> sizes;
     for (Size curr_sp = 0; curr_sp < all_spectra.size(); curr_sp++)
     {
-      lresampler.raster(all_spectra[curr_sp]->getMZArray()->data.begin(),
-                        all_spectra[curr_sp]->getMZArray()->data.end(),
-                        all_spectra[curr_sp]->getIntensityArray()->data.begin(),
-                        all_spectra[curr_sp]->getIntensityArray()->data.end(),
-                        resampled_peak_container->getMZArray()->data.begin(),
-                        resampled_peak_container->getMZArray()->data.end(),
-                        resampled_peak_container->getIntensityArray()->data.begin(),
-                        resampled_peak_container->getIntensityArray()->data.end()
-      );
+      mz_arrays.push_back(all_spectra[curr_sp]->getMZArray()->data.data());
+      int_arrays.push_back(all_spectra[curr_sp]->getIntensityArray()->data.data());
+      sizes.push_back(all_spectra[curr_sp]->getMZArray()->data.size());
     }
+    LinearResamplerAlign::raster_uniform(mz_arrays, int_arrays, sizes, min, sampling_rate,
+                                         resampled_peak_container->getIntensityArray()->data.data(),
+                                         resampled_peak_container->getIntensityArray()->data.size());
 
     if (!filter_zeros)
     {
@@ -276,21 +275,26 @@ namespace OpenMS
       ++it;
     }
 
-    // resample all spectra and add to master spectrum
-    LinearResamplerAlign lresampler;
+    // resample all spectra onto the uniform grid and sum them up in one fused
+    // pass (no per-spectrum copy of the resampled container)
     MSSpectrum master_spectrum = resampled_peak_container;
+    std::vector<double> mz_buffer, int_buffer;
+    std::vector<double> summed(number_resampled_points, 0.0);
     for (Size curr_sp = 0; curr_sp < all_spectra.size(); curr_sp++)
     {
-      MSSpectrum input_spectrum;
-      MSSpectrum output_spectrum = resampled_peak_container;
-
-      lresampler.raster(all_spectra[curr_sp].begin(), all_spectra[curr_sp].end(), output_spectrum.begin(), output_spectrum.end());
-
-      // add to master spectrum
-      for (Size i = 0; i < output_spectrum.size(); ++i)
+      mz_buffer.clear();
+      int_buffer.clear();
+      for (const auto& peak : all_spectra[curr_sp])
       {
-        master_spectrum[i].setIntensity(master_spectrum[i].getIntensity() + output_spectrum[i].getIntensity());
+        mz_buffer.push_back(peak.getMZ());
+        int_buffer.push_back(peak.getIntensity());
       }
+      LinearResamplerAlign::raster_uniform(mz_buffer.data(), int_buffer.data(), mz_buffer.size(),
+                                           min, sampling_rate, summed.data(), summed.size());
+    }
+    for (Size i = 0; i < master_spectrum.size(); ++i)
+    {
+      master_spectrum[i].setIntensity(summed[i]);
     }
 
     if (!filter_zeros)
@@ -780,7 +780,10 @@ namespace OpenMS
     const Size tmp = top_matches_to_report_;
     top_matches_to_report_ = 1;
 
-    for (Size i = 0; i < spectra.size(); ++i)
+    // queries are independent (matchSpectrum and the comparator are const),
+    // so they can be scored against the library in parallel
+#pragma omp parallel for schedule(dynamic)
+    for (SignedSize i = 0; i < (SignedSize)spectra.size(); ++i)
     {
       std::vector<Match> matches;
       matchSpectrum(spectra[i], cmp, matches);
@@ -794,12 +797,14 @@ namespace OpenMS
       }
       else
       {
+#pragma omp critical (TargetedSpectraExtractor_NOMATCHES)
         no_matches_idx.push_back(i);
         features[i].setMetaValue("spectral_library_name", "");
         features[i].setMetaValue("spectral_library_score", 0.0);
         features[i].setMetaValue("spectral_library_comments", "");
       }
     }
+    std::sort(no_matches_idx.begin(), no_matches_idx.end());
 
     top_matches_to_report_ = tmp;
 
@@ -1118,13 +1123,28 @@ namespace OpenMS
     {
       bin_offset_ = options.at("bin_offset");
     }
+    if (options.count("precursor_mz_tolerance"))
+    {
+      precursor_mz_tolerance_ = options.at("precursor_mz_tolerance");
+    }
     library_.clear();
     bs_library_.clear();
+    precursor_index_.clear();
+    no_precursor_idx_.clear();
     for (const MSSpectrum& s : library)
     {
       library_.push_back(s);
       bs_library_.emplace_back(s, bin_size_, false, peak_spread_, bin_offset_);
+      if (!s.getPrecursors().empty())
+      {
+        precursor_index_.emplace_back(s.getPrecursors().front().getMZ(), library_.size() - 1);
+      }
+      else
+      {
+        no_precursor_idx_.push_back(library_.size() - 1);
+      }
     }
+    std::sort(precursor_index_.begin(), precursor_index_.end());
     OPENMS_LOG_INFO << "The library contains " << bs_library_.size() << " spectra." << std::endl;
   }
 
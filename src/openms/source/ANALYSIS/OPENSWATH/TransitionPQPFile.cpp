@@ -56,6 +56,9 @@ namespace OpenMS
     int num_transitions = sqlite3_column_int(cntstmt, 0);
     sqlite3_finalize(cntstmt);
 
+    // size the output container ahead of time (avoids reallocation spikes while reading)
+    transition_list.reserve(transition_list.size() + num_transitions);
+
     String select_drift_time = "";
     bool drift_time_exists = SqliteConnector::columnExists(db, "PRECURSOR", "LIBRARY_DRIFT_TIME");
     if (drift_time_exists)
@@ -187,6 +190,13 @@ namespace OpenMS
 
     Size progress = 0;
     startProgress(0, num_transitions, "reading PQP file");
+
+    // The aggregated protein and peptidoform columns repeat for every transition
+    // of a precursor; intern the split results so each distinct value is parsed once
+    // and looked up afterwards.
+    std::unordered_map<std::string, std::vector<String>> protein_list_cache;
+    std::unordered_map<std::string, std::vector<String>> peptidoform_list_cache;
+
     // Convert SQLite data to TSVTransition data structure
     while (sqlite3_column_type(stmt, 0) != SQLITE_NULL)
     {
@@ -203,7 +213,12 @@ namespace OpenMS
       Sql::extractValue<int>((int*)&mytransition.decoy, stmt, 7);
       Sql::extractValue<std::string>(&mytransition.PeptideSequence, stmt, 8);
       String tmp_field;
-      if (Sql::extractValue<std::string>(&tmp_field, stmt, 9)) tmp_field.split(';', mytransition.ProteinName);
+      if (Sql::extractValue<std::string>(&tmp_field, stmt, 9))
+      {
+        auto pos = protein_list_cache.try_emplace(tmp_field);
+        if (pos.second) tmp_field.split(';', pos.first->second);
+        mytransition.ProteinName = pos.first->second;
+      }
       Sql::extractValue<std::string>(&mytransition.Annotation, stmt, 10);
       Sql::extractValue<std::string>(&mytransition.FullPeptideName, stmt, 11);
       Sql::extractValue<std::string>(&mytransition.CompoundName, stmt, 12);
@@ -222,14 +237,19 @@ namespace OpenMS
       Sql::extractValue<int>((int*)&mytransition.detecting_transition, stmt, 25);
       Sql::extractValue<int>((int*)&mytransition.identifying_transition, stmt, 26);
       Sql::extractValue<int>((int*)&mytransition.quantifying_transition, stmt, 27);
-      if (Sql::extractValue<std::string>(&tmp_field, stmt, 28)) tmp_field.split('|', mytransition.peptidoforms);
+      if (Sql::extractValue<std::string>(&tmp_field, stmt, 28))
+      {
+        auto pos = peptidoform_list_cache.try_emplace(tmp_field);
+        if (pos.second) tmp_field.split('|', pos.first->second);
+        mytransition.peptidoforms = pos.first->second;
+      }
       // optional attributes only present in newer file versions
       if (drift_time_exists) Sql::extractValue<double>(&mytransition.drift_time, stmt, 29);
       if (gene_exists) Sql::extractValue<std::string>(&mytransition.GeneName, stmt, 30);
 
       if (mytransition.GeneName == "NA") mytransition.GeneName = "";
 
-      transition_list.push_back(mytransition);
+      transition_list.push_back(std::move(mytransition));
       sqlite3_step( stmt );
     }
     endProgress();
@@ -12,8 +12,10 @@
 #include <OpenMS/CHEMISTRY/ModificationsDB.h>
 #include <OpenMS/CHEMISTRY/ResidueDB.h>
 #include <OpenMS/CONCEPT/LogStream.h>
+#include <OpenMS/DATASTRUCTURES/StringUtilsSimple.h>
 #include <OpenMS/FORMAT/TextFile.h>
 
+#include <string_view>
 #include <utility>
 
 namespace OpenMS
@@ -144,7 +146,7 @@ namespace OpenMS
 
   void TransitionTSVFile::getTSVHeader_(const std::string& line, char& delimiter, std::map<std::string, int>& header_dict) const
   {
-    std::string tmp;
+    std::vector<std::string_view> fields;
     std::vector<std::string> header;
     int nr_delimiters = 3;
     Size min_header_size = 8;
@@ -153,11 +155,15 @@ namespace OpenMS
     for (int i = 0; i < nr_delimiters; i++)
     {
       header.clear();
-      std::stringstream lineStream(line);
       delimiter = possibleDelimiters[i];
-      while (std::getline(lineStream, tmp, delimiter))
+      StringUtils::splitView(line, delimiter, fields);
+      if (!fields.empty() && fields.back().empty())
+      { // a trailing delimiter does not start another (empty) column
+        fields.pop_back();
+      }
+      for (const std::string_view& field : fields)
       {
-        String tmp2(tmp);
+        String tmp2(field);
         tmp2 = tmp2.remove('"');
         tmp2 = tmp2.remove('\'');
         tmp2 = tmp2.remove(',');
@@ -193,7 +199,7 @@ namespace OpenMS
   {
     std::ifstream data(filename);
     std::string   line;
-    std::string   tmp;
+    std::vector<std::string_view> fields;
 
     // read header
     std::vector<std::string>   tmp_line;
@@ -230,12 +236,13 @@ namespace OpenMS
     int cnt = 0;
     while (TextFile::getLine(data, line)) // make sure line endings are handled correctly
     {
-      line.push_back(delimiter); // avoid losing last column if it is empty
-      std::stringstream lineStream(line);
-
-      while (std::getline(lineStream, tmp, delimiter)) // default getline is fine here, we only want to split the line
+      // split into views (empty trailing columns are kept) and copy them into the
+      // reused field buffers; no allocations once the buffers reached their capacity
+      StringUtils::splitView(line, delimiter, fields);
+      tmp_line.resize(fields.size());
+      for (Size i = 0; i < fields.size(); ++i)
       {
-        tmp_line.push_back(tmp);
+        tmp_line[i].assign(fields[i].data(), fields[i].size());
       }
       cnt++;
 
@@ -455,7 +462,6 @@ namespace OpenMS
       std::cout << mytransition.uniprot_id << std::endl;
 #endif
 
-      tmp_line.clear();
     }
 
     if (spectrast_legacy && retentionTimeInterpretation_ == "iRT")
@@ -590,12 +596,20 @@ namespace OpenMS
 
     Size progress = 0;
     startProgress(0, transition_list.size(), "conversion to internal data representation");
-    for (auto tr_it = transition_list.begin(); tr_it != transition_list.end(); ++tr_it)
+
+    // convert rows to ReactionMonitoringTransition objects in parallel; the
+    // peptide/compound/protein bookkeeping below is sequential (first
+    // occurrence determines the order of the resulting entries)
+    TransitionVectorType rm_transitions(transition_list.size());
+#pragma omp parallel for
+    for (SignedSize i = 0; i < (SignedSize)transition_list.size(); ++i)
     {
-      ReactionMonitoringTransition rm_trans;
-      createTransition_(tr_it, rm_trans);
-      exp.addTransition(rm_trans);
+      auto tr_it = transition_list.begin() + i;
+      createTransition_(tr_it, rm_transitions[i]);
+    }
 
+    for (auto tr_it = transition_list.begin(); tr_it != transition_list.end(); ++tr_it)
+    {
       // check whether we need a new peptide
       if (peptide_map.find(tr_it->group_id) == peptide_map.end() &&
           compound_map.find(tr_it->group_id) == compound_map.end() )
@@ -639,6 +653,7 @@ namespace OpenMS
     }
     endProgress();
 
+    exp.setTransitions(std::move(rm_transitions));
     exp.setCompounds(compounds);
     exp.setPeptides(peptides);
     exp.setProteins(proteins);
@@ -655,6 +670,7 @@ namespace OpenMS
 
     Size progress = 0;
     startProgress(0, transition_list.size(), "conversion to internal data representation");
+    exp.transitions.reserve(exp.transitions.size() + transition_list.size());
     for (auto tr_it = transition_list.cbegin(); tr_it != transition_list.cend(); ++tr_it)
     {
       OpenSwath::LightTransition transition;
@@ -17,6 +17,9 @@
 #include <OpenMS/KERNEL/ConsensusMap.h>
 #include <OpenMS/MATH/STATISTICS/StatisticFunctions.h>
 
+#include <cmath>
+#include <limits>
+
 // #define ISOBARIC_CHANNEL_EXTRACTOR_DEBUG
 // #undef ISOBARIC_CHANNEL_EXTRACTOR_DEBUG
 
@@ -488,7 +491,21 @@ namespace OpenMS
 
     Size number_of_channels = quant_method_->getNumberOfChannels();
 
-    PeakMap::ConstIterator it_last_MS2 = ms_exp_data.end(); // remember last MS2 spec, to get precursor in MS1 (also if quant is in MS3)
+    // Pass 1 (serial, cheap): select the scans to quantify and record for each
+    // one the surrounding MS1 survey scans. Consecutive MS2/MS3 scans share
+    // their survey scan, so this lookup happens once per scan here instead of
+    // once per purity computation.
+    struct CandidateScan_
+    {
+      Size scan;           ///< index of the scan to quantify
+      Size ms2_scan;       ///< index of the scan holding the MS1 precursor info (== scan, unless quantifying MS3)
+      Size precursor_scan; ///< index of the preceding MS1 scan (or experiment size, if there is none)
+      Size follow_up_scan; ///< index of the following MS1 scan (or experiment size, if there is none)
+      bool ms3;            ///< MS3 data seen so far (add 'id_scan_id' meta value)?
+    };
+    std::vector<CandidateScan_> candidates;
+    const Size no_scan = ms_exp_data.size();
+
     bool ms3 = false;
     for (PeakMap::ConstIterator it = ms_exp_data.begin(); it != ms_exp_data.end(); ++it)
     {
@@ -497,8 +514,6 @@ namespace OpenMS
       {
         // remember potential precursor and continue
         pState.precursorScan = it;
-        // reset last MS2 -- we expect to see a new one soon and the old one should not be used for the following MS3 (if any)
-        it_last_MS2 = ms_exp_data.end();
         continue;
       }
 
@@ -520,23 +535,8 @@ namespace OpenMS
         continue;
       }
 
-      // check precursor purity if we have a valid precursor ..
-      double precursor_purity = -1.0;
-      if (pState.precursorScan != ms_exp_data.end())
-      {
-        precursor_purity = computePrecursorPurity_(it, pState);
-        // check if purity is high enough
-        if (precursor_purity < min_precursor_purity_)
-        {
-          OPENMS_LOG_DEBUG << "Skip spectrum " << it->getNativeID() << ": Precursor purity is below the threshold. [purity = " << precursor_purity << "]" << std::endl;
-          continue;
-        }
-      }
-      else
-      {
-        OPENMS_LOG_INFO << "No precursor available for spectrum: " << it->getNativeID() << std::endl;
-      }
-
+      // remember last MS2 spec, to get precursor in MS1 (also if quant is in MS3)
+      PeakMap::ConstIterator it_last_MS2 = it;
       if (it->getMSLevel() == 3)
       {
         ms3 = true;
@@ -548,10 +548,6 @@ namespace OpenMS
           throw Exception::MissingInformation(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, String("No MS2 precursor information given for MS3 scan native ID ") + it->getNativeID() + " with RT " + String(it->getRT()));
         }
       }
-      else
-      {
-        it_last_MS2 = it;
-      }
 
       // check if MS1 precursor info is available
       if (it_last_MS2->getPrecursors().empty())
@@ -559,18 +555,62 @@ namespace OpenMS
         throw Exception::MissingInformation(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, String("No precursor information given for scan native ID ") + it->getNativeID() + " with RT " + String(it->getRT()));
       }
 
-      // store RT of MS2 scan and MZ of MS1 precursor ion as centroid of ConsensusFeature
-      ConsensusFeature cf;
-      cf.setUniqueId();
-      cf.setRT(it_last_MS2->getRT());
-      cf.setMZ(it_last_MS2->getPrecursors()[0].getMZ());
+      CandidateScan_ candidate;
+      candidate.scan = it - ms_exp_data.begin();
+      candidate.ms2_scan = it_last_MS2 - ms_exp_data.begin();
+      candidate.precursor_scan = (pState.precursorScan != ms_exp_data.end()) ? Size(pState.precursorScan - ms_exp_data.begin()) : no_scan;
+      candidate.follow_up_scan = pState.hasFollowUpScan ? Size(pState.followUpScan - ms_exp_data.begin()) : no_scan;
+      candidate.ms3 = ms3;
+      candidates.push_back(candidate);
+    } // ! Experiment iterator
+
+    // Pass 2 (parallel): purity computation and reporter ion extraction only
+    // read the experiment and are independent between scans, given the survey
+    // scan indices from pass 1.
+    struct ScanQuant_
+    {
+      bool keep = false;                  ///< passed the purity filter?
+      double precursor_purity = -1.0;     ///< computed purity (-1 if there was no precursor scan)
+      std::vector<Peak2D> channel_values; ///< extracted reporter signal per channel
+      std::vector<double> mz_deltas;      ///< distance to expected reporter position per channel (NaN if no signal)
+      std::vector<int> signal_not_unique; ///< more than one peak in the search window?
+    };
+    std::vector<ScanQuant_> quants(candidates.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (SignedSize c = 0; c < (SignedSize)candidates.size(); ++c)
+    {
+      const CandidateScan_& candidate = candidates[c];
+      ScanQuant_& quant = quants[c];
+      PeakMap::ConstIterator it = ms_exp_data.begin() + candidate.scan;
+
+      // check precursor purity if we have a valid precursor ..
+      if (candidate.precursor_scan != no_scan)
+      {
+        PuritySate_ scan_state(ms_exp_data);
+        scan_state.precursorScan = ms_exp_data.begin() + candidate.precursor_scan;
+        scan_state.hasFollowUpScan = (candidate.follow_up_scan != no_scan);
+        scan_state.followUpScan = scan_state.hasFollowUpScan ? ms_exp_data.begin() + candidate.follow_up_scan : ms_exp_data.end();
+
+        quant.precursor_purity = computePrecursorPurity_(it, scan_state);
+        // check if purity is high enough
+        if (quant.precursor_purity < min_precursor_purity_)
+        {
+          continue; // reported below, in scan order
+        }
+      }
+      quant.keep = true;
 
       Peak2D channel_value;
       channel_value.setRT(it->getRT());
-      // for each each channel
-      UInt64 map_index = 0;
-      Peak2D::IntensityType overall_intensity = 0;
+      quant.channel_values.reserve(number_of_channels);
+      quant.mz_deltas.resize(number_of_channels, std::numeric_limits<double>::quiet_NaN());
+      quant.signal_not_unique.resize(number_of_channels, 0);
 
+      // for each each channel
+      Size channel_index = 0;
       for (IsobaricQuantitationMethod::IsobaricChannelList::const_iterator cl_it = quant_method_->getChannelInformation().begin();
             cl_it != quant_method_->getChannelInformation().end();
             ++cl_it)
@@ -604,8 +644,8 @@ namespace OpenMS
         {
           double mz_delta = cl_it->center - idx_nearest->getMZ();
           // stats: we don't care what shift the user specified
-          channel_mz_delta[cl_it->name].mz_deltas.push_back(mz_delta);
-          if (peak_count > 1) ++channel_mz_delta[cl_it->name].signal_not_unique;
+          quant.mz_deltas[channel_index] = mz_delta;
+          if (peak_count > 1) quant.signal_not_unique[channel_index] = 1;
           // pass user threshold
           if (std::fabs(mz_delta) < reporter_mass_shift_)
           {
@@ -619,9 +659,51 @@ namespace OpenMS
           channel_value.setIntensity(0);
         }
 
-        overall_intensity += channel_value.getIntensity();
+        quant.channel_values.push_back(channel_value);
+        ++channel_index;
+      } // ! channel_iterator
+    } // ! candidates (parallel)
+
+    // Pass 3 (serial): assemble the consensus map and the QC statistics in
+    // scan order.
+    for (Size c = 0; c < candidates.size(); ++c)
+    {
+      const CandidateScan_& candidate = candidates[c];
+      const ScanQuant_& quant = quants[c];
+      PeakMap::ConstIterator it = ms_exp_data.begin() + candidate.scan;
+      PeakMap::ConstIterator it_last_MS2 = ms_exp_data.begin() + candidate.ms2_scan;
+
+      if (candidate.precursor_scan == no_scan)
+      {
+        OPENMS_LOG_INFO << "No precursor available for spectrum: " << it->getNativeID() << std::endl;
+      }
+      else if (!quant.keep)
+      {
+        OPENMS_LOG_DEBUG << "Skip spectrum " << it->getNativeID() << ": Precursor purity is below the threshold. [purity = " << quant.precursor_purity << "]" << std::endl;
+        continue;
+      }
+
+      // store RT of MS2 scan and MZ of MS1 precursor ion as centroid of ConsensusFeature
+      ConsensusFeature cf;
+      cf.setUniqueId();
+      cf.setRT(it_last_MS2->getRT());
+      cf.setMZ(it_last_MS2->getPrecursors()[0].getMZ());
+
+      UInt64 map_index = 0;
+      Peak2D::IntensityType overall_intensity = 0;
+      for (IsobaricQuantitationMethod::IsobaricChannelList::const_iterator cl_it = quant_method_->getChannelInformation().begin();
+            cl_it != quant_method_->getChannelInformation().end();
+            ++cl_it)
+      {
+        if (!std::isnan(quant.mz_deltas[map_index]))
+        {
+          channel_mz_delta[cl_it->name].mz_deltas.push_back(quant.mz_deltas[map_index]);
+          channel_mz_delta[cl_it->name].signal_not_unique += quant.signal_not_unique[map_index];
+        }
+
+        overall_intensity += quant.channel_values[map_index].getIntensity();
         // add channel to ConsensusFeature
-        cf.insert(map_index, channel_value, element_index);
+        cf.insert(map_index, quant.channel_values[map_index], element_index);
         ++map_index;
       } // ! channel_iterator
 
@@ -637,16 +719,16 @@ namespace OpenMS
         cf.setMetaValue("all_empty", String("true"));
       }
       // add purity information if we could compute it
-      if (precursor_purity > 0.0)
+      if (quant.precursor_purity > 0.0)
       {
-        cf.setMetaValue("precursor_purity", precursor_purity);
+        cf.setMetaValue("precursor_purity", quant.precursor_purity);
       }
 
       // embed the id of the scan from which the quantitative information was extracted
       cf.setMetaValue("scan_id", it->getNativeID());
       // embed the id of the scan from which the ID information should be extracted
       // helpful for mapping later
-      if (ms3)
+      if (candidate.ms3)
       {
         cf.setMetaValue("id_scan_id", it_last_MS2->getNativeID());
       }
@@ -659,7 +741,7 @@ namespace OpenMS
 
       // the tandem-scan in the order they appear in the experiment
       ++element_index;
-    } // ! Experiment iterator
+    } // ! candidates
 
     // print stats about m/z calibration / presence of signal
     OPENMS_LOG_INFO << "Calibration stats: Median distance of observed reporter ions m/z to expected position (up to " << qc_dist_mz << " Th):\n";
@@ -54,10 +54,6 @@ namespace OpenMS
     }
     
     Eigen::FullPivLU<Eigen::MatrixXd> ludecomp(correction_matrix.getEigenMatrix());
-    Eigen::VectorXd b;
-    b.resize(quant_method->getNumberOfChannels());
-    b.setZero();
-    std::vector<double> x(quant_method->getNumberOfChannels(), 0);
 
     if (!ludecomp.isInvertible())
     {
@@ -65,68 +61,92 @@ namespace OpenMS
       throw Exception::InvalidParameter(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "IsobaricIsotopeCorrector: The given isotope correction matrix is not invertible!");
     }
 
-    // data structures for NNLS
-    Matrix<double> m_b(quant_method->getNumberOfChannels(), 1);
-    Matrix<double> m_x(quant_method->getNumberOfChannels(), 1);
+    const Size n_channels = quant_method->getNumberOfChannels();
+    const Size n_features = consensus_map_out.size();
 
-    // correct all consensus elements
-    for (ConsensusMap::size_type i = 0; i < consensus_map_out.size(); ++i)
+    // resolve the channel id of every map once, instead of per feature handle
+    std::map<UInt64, Int> channel_ids;
+    for (const auto& header : consensus_map_in.getColumnHeaders())
     {
-#ifdef ISOBARIC_QUANT_DEBUG
-      std::cout << "\nMAP element  #### " << i << " #### \n" << std::endl;
-#endif
-      // delete only the consensus handles from the output map
-      consensus_map_out[i].clear();
-
-      // fill b vector
-      fillInputVector_(b, m_b, consensus_map_in[i], consensus_map_in);
+      channel_ids[header.first] = Int(header.second.getMetaValue("channel_id"));
+    }
 
-      //solve
-      Eigen::MatrixXd e_mx = ludecomp.solve(b);
-      if (!(correction_matrix.getEigenMatrix() * e_mx).isApprox(b))
+    // batch all input vectors into one matrix (one column per consensus
+    // feature) ...
+    Eigen::MatrixXd b_batch = Eigen::MatrixXd::Zero(n_channels, n_features);
+    for (Size i = 0; i < n_features; ++i)
+    {
+      for (ConsensusFeature::HandleSetType::const_iterator it_elements = consensus_map_in[i].getFeatures().begin();
+           it_elements != consensus_map_in[i].getFeatures().end();
+           ++it_elements)
       {
-        throw Exception::InvalidParameter(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "IsobaricIsotopeCorrector: Cannot multiply!");
+        b_batch(channel_ids[it_elements->getMapIndex()], i) = it_elements->getIntensity();
       }
-      solveNNLS_(correction_matrix, m_b, m_x);
-
-      // update the output consensus map with the corrected intensities
-      float cf_intensity = updateOutpuMap_(consensus_map_in, consensus_map_out, i, m_x);
-
-      // check consistency
-      computeStats_(m_x, e_mx, cf_intensity, quant_method, stats);    
     }
 
-    return stats;
-  }
+    // ... so the factorized correction matrix is applied to all features with
+    // a single multi-right-hand-side solve
+    // (this is deprecated, but serves as quality measurement)
+    Eigen::MatrixXd x_naive = ludecomp.solve(b_batch);
+    if (!(correction_matrix.getEigenMatrix() * x_naive).isApprox(b_batch))
+    {
+      throw Exception::InvalidParameter(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "IsobaricIsotopeCorrector: Cannot multiply!");
+    }
 
-  void
-  IsobaricIsotopeCorrector::fillInputVector_(Eigen::VectorXd& b,
-                                             Matrix<double>& m_b, const ConsensusFeature& cf, const ConsensusMap& cm)
-  {
-    for (ConsensusFeature::HandleSetType::const_iterator it_elements = cf.getFeatures().begin();
-         it_elements != cf.getFeatures().end();
-         ++it_elements)
+    // the NNLS problems are independent, so they are solved in parallel;
+    // failures are recorded and reported after the loop
+    Eigen::MatrixXd x_nnls(n_channels, n_features);
+    bool nnls_failed(false);
+#pragma omp parallel
     {
-      //find channel_id of current element
-      Int index = Int(cm.getColumnHeaders().find(it_elements->getMapIndex())->second.getMetaValue("channel_id"));
+      // data structures for NNLS, one set per thread
+      Matrix<double> m_b(n_channels, 1);
+      Matrix<double> m_x(n_channels, 1);
+#pragma omp for schedule(dynamic, 64)
+      for (SignedSize i = 0; i < (SignedSize)n_features; ++i)
+      {
 #ifdef ISOBARIC_QUANT_DEBUG
-      std::cout << "  map_index " << it_elements->getMapIndex() << "-> id " << index << " with intensity " << it_elements->getIntensity() << "\n" << std::endl;
+        std::cout << "\nMAP element  #### " << i << " #### \n" << std::endl;
 #endif
-      // this is deprecated, but serves as quality measurement
-      b(index) = it_elements->getIntensity();
-      m_b(index, 0) = it_elements->getIntensity();
+        for (Size index = 0; index < n_channels; ++index)
+        {
+          m_b(index, 0) = b_batch(index, i);
+        }
+        if (NonNegativeLeastSquaresSolver::solve(correction_matrix, m_b, m_x) != NonNegativeLeastSquaresSolver::SOLVED)
+        {
+#pragma omp atomic write
+          nnls_failed = true;
+          continue;
+        }
+        for (Size index = 0; index < n_channels; ++index)
+        {
+          x_nnls(index, i) = m_x(index, 0);
+        }
+      }
     }
-  }
-
-  void
-  IsobaricIsotopeCorrector::solveNNLS_(const Matrix<double>& correction_matrix,
-                                       const Matrix<double>& m_b, Matrix<double>& m_x)
-  {
-    Int status = NonNegativeLeastSquaresSolver::solve(correction_matrix, m_b, m_x);
-    if (status != NonNegativeLeastSquaresSolver::SOLVED)
+    if (nnls_failed)
     {
       throw Exception::FailedAPICall(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "IsobaricIsotopeCorrector: Failed to find least-squares fit!");
     }
+
+    // update the output consensus map with the corrected intensities
+    Matrix<double> m_x(n_channels, 1);
+    for (Size i = 0; i < n_features; ++i)
+    {
+      // delete only the consensus handles from the output map
+      consensus_map_out[i].clear();
+
+      for (Size index = 0; index < n_channels; ++index)
+      {
+        m_x(index, 0) = x_nnls(index, i);
+      }
+      float cf_intensity = updateOutpuMap_(consensus_map_in, consensus_map_out, i, channel_ids, m_x);
+
+      // check consistency
+      computeStats_(m_x, x_naive.col(i), cf_intensity, quant_method, stats);
+    }
+
+    return stats;
   }
 
   void
@@ -172,7 +192,8 @@ namespace OpenMS
   float
   IsobaricIsotopeCorrector::updateOutpuMap_(
     const ConsensusMap& consensus_map_in, ConsensusMap& consensus_map_out,
-    ConsensusMap::size_type current_cf, const Matrix<double>& m_x)
+    ConsensusMap::size_type current_cf, const std::map<UInt64, Int>& channel_ids,
+    const Matrix<double>& m_x)
   {
     float cf_intensity(0);
     for (ConsensusFeature::HandleSetType::const_iterator it_elements = consensus_map_in[current_cf].begin();
@@ -181,7 +202,7 @@ namespace OpenMS
     {
       FeatureHandle handle = *it_elements;
       //find channel_id of current element
-      Int index = Int(consensus_map_out.getColumnHeaders()[it_elements->getMapIndex()].getMetaValue("channel_id"));
+      Int index = channel_ids.find(it_elements->getMapIndex())->second;
       handle.setIntensity(float(m_x(index, 0)));
 
       consensus_map_out[current_cf].insert(handle);
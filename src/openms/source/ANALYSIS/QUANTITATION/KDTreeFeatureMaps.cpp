@@ -115,6 +115,21 @@ void KDTreeFeatureMaps::getNeighborhood(Size index, vector<Size>& result_indices
   }
 }
 
+void KDTreeFeatureMaps::getNeighborhoods(const vector<Size>& indices, vector<vector<Size> >& result_indices, double rt_tol, double mz_tol, bool mz_ppm, bool include_features_from_same_map, double max_pairwise_log_fc) const
+{
+  result_indices.clear();
+  result_indices.resize(indices.size());
+
+  // the queries only read the tree, so they can run concurrently
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+  for (SignedSize i = 0; i < (SignedSize)indices.size(); ++i)
+  {
+    getNeighborhood(indices[i], result_indices[i], rt_tol, mz_tol, mz_ppm, include_features_from_same_map, max_pairwise_log_fc);
+  }
+}
+
 void KDTreeFeatureMaps::queryRegion(double rt_low, double rt_high, double mz_low, double mz_high, vector<Size>& result_indices, Size ignored_map_index) const
 {
   // set up tolerance window as region for the 2D tree
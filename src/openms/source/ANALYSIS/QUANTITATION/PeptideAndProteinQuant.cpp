@@ -15,6 +15,12 @@
 #include <OpenMS/CHEMISTRY/EnzymaticDigestion.h>
 #include <OpenMS/DATASTRUCTURES/StringView.h>
 
+#include <functional>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace std;
 
 namespace OpenMS
@@ -413,6 +419,17 @@ namespace OpenMS
 
     bool contains_accessions {false};
 
+    // resolve each peptide to its (group leader) accession once, up front - the
+    // accession determines which shard aggregates the peptide below
+    struct PeptideContribution
+    {
+      String accession; // leader accession of the protein (group)
+      String peptide; // unmodified ("proteotypic") sequence
+      const PeptideData* data;
+    };
+    std::vector<PeptideContribution> contributions;
+    contributions.reserve(pep_quant_.size());
+
     for (auto const& pep_q : pep_quant_)
     {
       String accession = getAccession_(pep_q.second.accessions, accession_to_leader);
@@ -423,23 +440,54 @@ namespace OpenMS
         continue;
 
       contains_accessions = true;
-      // proteotypic peptide
-      const String peptide = pep_q.first.toUnmodifiedString();
-
-      prot_quant_[accession].psm_count += pep_q.second.psm_count;
+      contributions.push_back(PeptideContribution{accession, pep_q.first.toUnmodifiedString(), &pep_q.second});
+    }
 
-      // transfer abundances and counts from peptides->protein
-      // summarize abundances and counts between different peptidoforms
-      for (auto const& sta : pep_q.second.total_abundances)
+    // transfer abundances and counts from peptides->protein
+    // summarize abundances and counts between different peptidoforms
+    //
+    // Proteins are hashed across shards and each shard aggregates only "its"
+    // accessions, so the shards never touch the same protein and can run in
+    // parallel. Every shard scans the contributions in pep_quant_ order, so
+    // per protein the summation order (and thus every quantity) is identical
+    // to a serial pass.
+#ifdef _OPENMP
+    SignedSize n_shards = omp_get_max_threads();
+#else
+    SignedSize n_shards = 1;
+#endif
+    std::vector<ProteinQuant> shards(n_shards);
+    std::hash<std::string> hasher;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (SignedSize shard = 0; shard < n_shards; ++shard)
+    {
+      ProteinQuant& local = shards[shard];
+      for (auto const& contrib : contributions)
       {
-        prot_quant_[accession].abundances[peptide][sta.first] += sta.second;
-      }
+        if (SignedSize(hasher(contrib.accession) % Size(n_shards)) != shard)
+          continue;
 
-      for (auto const& sta : pep_q.second.total_psm_counts)
-      {
-        prot_quant_[accession].psm_counts[peptide][sta.first] += sta.second;
+        ProteinData& protein = local[contrib.accession];
+        protein.psm_count += contrib.data->psm_count;
+
+        for (auto const& sta : contrib.data->total_abundances)
+        {
+          protein.abundances[contrib.peptide][sta.first] += sta.second;
+        }
+
+        for (auto const& sta : contrib.data->total_psm_counts)
+        {
+          protein.psm_counts[contrib.peptide][sta.first] += sta.second;
+        }
       }
     }
+    // shards hold disjoint accessions; merging restores the overall map order
+    for (auto& shard : shards)
+    {
+      prot_quant_.merge(shard);
+    }
 
     if (!contains_accessions)
     {
@@ -463,8 +511,22 @@ namespace OpenMS
       aggregate = "sum";
     }
 
+    // proteins are independent of each other from here on: each iteration only
+    // reads and writes its own ProteinData (statistics are reduced separately)
+    std::vector<ProteinQuant::value_type*> prot_entries;
+    prot_entries.reserve(prot_quant_.size());
     for (auto& prot_q : prot_quant_)
     {
+      prot_entries.push_back(&prot_q);
+    }
+
+    Size quant_proteins(0), too_few_peptides(0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(+: quant_proteins, too_few_peptides)
+#endif
+    for (SignedSize entry = 0; entry < (SignedSize)prot_entries.size(); ++entry)
+    {
+      ProteinQuant::value_type& prot_q = *prot_entries[entry];
       const ProteinData& pd = prot_q.second;
 
       // calculate PSM counts based on all (!) peptides of a protein (group)
@@ -484,7 +546,7 @@ namespace OpenMS
       // select which peptides of the current protein (group) are quantified
       if ((top_n > 0) && (prot_q.second.abundances.size() < top_n))
       { // not enough proteotypic peptides? skip protein (except if user chose to include the nevertheless)
-        stats_.too_few_peptides++;
+        too_few_peptides++;
         if (!include_all)
         {
           continue;
@@ -575,13 +637,16 @@ namespace OpenMS
       // update statistics:
       if (prot_q.second.total_abundances.empty())
       {
-        stats_.too_few_peptides++;
+        too_few_peptides++;
       }
       else
       {
-        stats_.quant_proteins++;
+        quant_proteins++;
       }
     }
+    stats_.too_few_peptides += too_few_peptides;
+    stats_.quant_proteins += quant_proteins;
+
     if (method == "iBAQ")
     {
       EnzymaticDigestion digest{};
@@ -189,26 +189,35 @@ void SimpleSVM::predict(vector<Prediction>& predictions, vector<Size> indexes) c
   Size n_classes = svm_get_nr_class(model_);
   vector<int> outcomes(n_classes);
   svm_get_labels(model_, &(outcomes[0]));
-  vector<double> probabilities(n_classes);
-  predictions.clear();
-  predictions.reserve(indexes.size());
-  for (vector<Size>::iterator it = indexes.begin(); it != indexes.end(); ++it)
+  // validate all indexes up front, so the parallel loop below cannot throw
+  for (vector<Size>::const_iterator it = indexes.begin(); it != indexes.end(); ++it)
   {
     if (*it >= n_obs)
     {
-      String msg = "Invalid index for prediction; there are only " + 
+      String msg = "Invalid index for prediction; there are only " +
         String(n_obs) + " observations.";
       throw Exception::InvalidValue(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
                                     msg, String(*it));
     }
-    Prediction pred;
-    pred.outcome = svm_predict_probability(model_, &(nodes_[*it][0]), 
-                                             &(probabilities[0]));
-    for (Size i = 0; i < n_classes; ++i)
+  }
+  predictions.clear();
+  predictions.resize(indexes.size());
+  // samples are independent and the model is read-only during prediction
+#pragma omp parallel
+  {
+    vector<double> probabilities(n_classes);
+#pragma omp for schedule(dynamic, 100)
+    for (SignedSize p_index = 0; p_index < (SignedSize)indexes.size(); ++p_index)
     {
-      pred.probabilities[outcomes[i]] = probabilities[i];
+      Prediction pred;
+      pred.outcome = svm_predict_probability(model_, &(nodes_[indexes[p_index]][0]),
+                                             &(probabilities[0]));
+      for (Size i = 0; i < n_classes; ++i)
+      {
+        pred.probabilities[outcomes[i]] = probabilities[i];
+      }
+      predictions[p_index] = std::move(pred);
     }
-    predictions.push_back(pred);
   }
 }
 
@@ -256,32 +265,46 @@ void SimpleSVM::predict(PredictorMap& predictors, vector<Prediction>& prediction
   Size n_classes = svm_get_nr_class(model_);
   vector<int> outcomes(n_classes);
   svm_get_labels(model_, &(outcomes[0]));
-  vector<double> probabilities(n_classes);
   predictions.clear();
-  predictions.reserve(n_obs);
-
-  svm_node *x = new svm_node[feature_dim + 1];
-  for (Size i = 0; i != n_obs; ++i)
+  predictions.resize(n_obs);
+
+  // build all samples in one flattened matrix (one row of feature_dim + 1
+  // nodes per observation), filled predictor by predictor in a single pass
+  const Size row_length = feature_dim + 1;
+  vector<svm_node> nodes(row_length * n_obs);
+  Size feature_index{0};
+  for (const auto& p : predictors)
   {
-    size_t feature_index{0};
-    for (auto p : predictors) 
+    for (Size i = 0; i != n_obs; ++i)
     {
-      x[feature_index].index = feature_index + 1;
-      x[feature_index].value = p.second[i]; // feature value for observation i
-      ++feature_index;
+      nodes[i * row_length + feature_index].index = feature_index + 1;
+      nodes[i * row_length + feature_index].value = p.second[i]; // feature value for observation i
     }
-    x[feature_dim].index = -1;
-    x[feature_dim].value = 0;
+    ++feature_index;
+  }
+  for (Size i = 0; i != n_obs; ++i) // sentinel nodes
+  {
+    nodes[i * row_length + feature_dim].index = -1;
+    nodes[i * row_length + feature_dim].value = 0;
+  }
 
-    Prediction pred;
-    pred.outcome = svm_predict_probability(model_, x, &(probabilities[0]));
-    for (Size c = 0; c < n_classes; ++c)
+  // samples are independent and the model is read-only during prediction
+#pragma omp parallel
+  {
+    vector<double> probabilities(n_classes);
+#pragma omp for schedule(dynamic, 100)
+    for (SignedSize i = 0; i < (SignedSize)n_obs; ++i)
     {
-      pred.probabilities[outcomes[c]] = probabilities[c];
+      Prediction pred;
+      pred.outcome = svm_predict_probability(model_, &nodes[i * row_length],
+                                             &(probabilities[0]));
+      for (Size c = 0; c < n_classes; ++c)
+      {
+        pred.probabilities[outcomes[c]] = probabilities[c];
+      }
+      predictions[i] = std::move(pred);
     }
-    predictions.push_back(pred);
   }
-  delete[] x;  
 }
 
 // only works in classification mode
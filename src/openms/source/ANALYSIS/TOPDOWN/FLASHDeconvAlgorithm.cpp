@@ -652,24 +652,39 @@ namespace OpenMS
     int charge_range = current_max_charge_;
     Size mass_bin_size = mass_bins_.size();
     int log_mz_peak_size = (int)log_mz_peaks_.size();
-    // this stores which peak is now being considered per charge. Per charge, peak is considered from left (lowest m/z) to right (highest m/z).
-    auto current_peak_index = std::vector<int>(charge_range, 0);
     deconvolved_spectrum_.reserve(mass_bins_.count());
-    Size mass_bin_index = mass_bins_.find_first();
     auto peak_bin_numbers = std::vector<Size>(log_mz_peak_size);
-    const double max_mass_dalton_tolerance = .16; // this is additional mass tolerance in Da to get more high signal-to-ratio peaks in this candidate peakgroup finding
     // per peak, store the m/z bin number for fast processing
     for (int i = 0; i < log_mz_peak_size; i++)
     {
       peak_bin_numbers[i] = getBinNumber_(log_mz_peaks_[i].logMz, mz_bin_min_value_, bin_mul_factor);
     }
+
+    // collect the set mass bins up front, so the main loop below can be parallelized
+    std::vector<Size> mass_bin_indices;
+    mass_bin_indices.reserve(mass_bins_.count());
+    for (Size mbi = mass_bins_.find_first(); mbi != mass_bins_.npos; mbi = mass_bins_.find_next(mbi))
+    {
+      mass_bin_indices.push_back(mbi);
+    }
+
+    // main iteration. per_mass_abs_charge_ranges gives the range of charges for each mass bin.
+    // the mass bins are independent, so they are processed in parallel; the per-thread peak
+    // groups are concatenated in thread order below, which together with the static schedule
+    // preserves the original (mass bin ascending) output ordering.
+#pragma omp parallel default(none) shared(bin_mul_factor, tol, charge_range, mass_bin_size, log_mz_peak_size, peak_bin_numbers, mass_bin_indices, per_mass_abs_charge_ranges)
+    {
+    std::vector<PeakGroup> peak_groups_private;
+    peak_groups_private.reserve(mass_bin_indices.size());
+    const double max_mass_dalton_tolerance = .16; // this is additional mass tolerance in Da to get more high signal-to-ratio peaks in this candidate peakgroup finding
     std::vector<double> total_harmonic_intensity(harmonic_charges_.size(), .0);
     std::vector<int> h_prev_iso(harmonic_charges_.size(), 0);
     std::vector<float> h_max_isotope_intensity(harmonic_charges_.size(), .0f);
 
-    // main iteration. per_mass_abs_charge_ranges gives the range of charges for each mass bin
-    while (mass_bin_index != mass_bins_.npos)
+#pragma omp for nowait schedule(static)
+    for (int mbi_index = 0; mbi_index < (int)mass_bin_indices.size(); mbi_index++)
     {
+      Size mass_bin_index = mass_bin_indices[mbi_index];
       double log_m = getBinValue_(mass_bin_index, mass_bin_min_value_, bin_mul_factor);
       double mass = exp(log_m);
 
@@ -698,7 +713,10 @@ namespace OpenMS
         }
 
         Size b_index = mass_bin_index - bin_offset; // m/z bin
-        int& cpi = current_peak_index[j];           // in this charge which peak is to be considered?
+        // find the first peak that can match this m/z bin. peak_bin_numbers is sorted (peaks are
+        // sorted by m/z), so a binary search replaces the rolling per-charge cursor - this keeps
+        // the mass bins independent of each other and lets the surrounding loop run in parallel.
+        int cpi = (int)(std::lower_bound(peak_bin_numbers.begin(), peak_bin_numbers.end(), b_index) - peak_bin_numbers.begin());
         double max_intensity = -1;
 
         while (cpi < log_mz_peak_size - 1) // scan through peaks from cpi
@@ -951,10 +969,27 @@ namespace OpenMS
             continue;
           }
           pg.setScanNumber(deconvolved_spectrum_.getScanNumber());
-          deconvolved_spectrum_.push_back(pg); //
+          peak_groups_private.push_back(pg); //
         }
       }
-      mass_bin_index = mass_bins_.find_next(mass_bin_index);
+    }
+
+#ifdef _OPENMP
+  #pragma omp for schedule(static) ordered
+    for (int i = 0; i < omp_get_num_threads(); i++)
+    {
+  #pragma omp ordered
+      for (auto& pg : peak_groups_private)
+      {
+        deconvolved_spectrum_.push_back(pg);
+      }
+    }
+#else
+    for (auto& pg : peak_groups_private)
+    {
+      deconvolved_spectrum_.push_back(pg);
+    }
+#endif
     }
   }
 
@@ -1231,7 +1266,7 @@ namespace OpenMS
     {
       return .0;
     }
-    auto iso = avg.get(mono_mass);
+    const auto& iso = avg.get(mono_mass);
 
     int iso_size = (int)iso.size();
     int right = (int)avg.getApexIndex(mono_mass) / 4 + 1;
@@ -117,7 +117,7 @@ namespace OpenMS
     return i;
   }
 
-  IsotopeDistribution FLASHDeconvHelperStructs::PrecalculatedAveragine::get(const double mass) const
+  const IsotopeDistribution& FLASHDeconvHelperStructs::PrecalculatedAveragine::get(const double mass) const
   {
     return isotopes_[massToIndex_(mass)];
   }
@@ -78,7 +78,7 @@ namespace OpenMS
 
   void PeakGroup::updatePerChargeCos_(const FLASHDeconvHelperStructs::PrecalculatedAveragine& avg)
   {
-    auto iso_dist = avg.get(monoisotopic_mass_);
+    const auto& iso_dist = avg.get(monoisotopic_mass_);
     int iso_size = (int)iso_dist.size();
     auto current_per_isotope_intensities = std::vector<float>(getIsotopeIntensities().size() + min_negative_isotope_index_, .0f);
 
@@ -241,23 +241,20 @@ namespace OpenMS
 
     float charge_noise_pwr = 0;
 
-    std::vector<std::vector<Size>> per_bin_edges(max_bin_number);
+    const Size peak_count = all_peaks.size();
+    // one flat buffer for all bins instead of a vector of vectors (row k = bin k)
+    std::vector<Size> per_bin_edges(max_bin_number * peak_count, 0);
     std::vector<int> per_bin_start_index(max_bin_number, -2); // -2 means bin is empty. -1 means bin is used. zero or positive = edge index
     std::map<float, Size> max_intensity_sum_to_bin;
 
-    for (Size k = 0; k < max_bin_number; k++)
-    {
-      per_bin_edges[k] = std::vector<Size>(all_peaks.size(), 0);
-    }
-
     // first collect all possible edges. An edge means mass difference between two peaks.
-    for (Size i = 0; i < all_peaks.size(); i++)
+    for (Size i = 0; i < peak_count; i++)
     {
-      auto p1 = all_peaks[i];
+      const auto& p1 = all_peaks[i];
       bool p1_signal = is_signal_bitset[i];
-      for (Size j = i + 1; j < all_peaks.size(); j++)
+      for (Size j = i + 1; j < peak_count; j++)
       {
-        auto p2 = all_peaks[j];
+        const auto& p2 = all_peaks[j];
         double normalized_dist = (p2.mz - p1.mz) * z / iso_da_distance_;
         if (normalized_dist > .9 && normalized_dist < 1.1) // if the distance is too close to the isotope distance, skip
         {
@@ -277,7 +274,7 @@ namespace OpenMS
         {
           continue;
         }
-        per_bin_edges[bin][i] = j;
+        per_bin_edges[bin * peak_count + i] = j;
         per_bin_start_index[bin] = -1;
       }
     }
@@ -289,9 +286,9 @@ namespace OpenMS
       {
         continue;
       }
-      auto edges = per_bin_edges[k];
+      const Size* edges = &per_bin_edges[k * peak_count];
       float max_sum_intensity = 0;
-      for (Size i = 0; i < edges.size(); i++)
+      for (Size i = 0; i < peak_count; i++)
       {
         if (edges[i] == 0)
         {
@@ -302,7 +299,7 @@ namespace OpenMS
         Size j = edges[i];
 
         int cntr = 0; // how many edges?
-        while (j < edges.size())
+        while (j < peak_count)
         {
           cntr++;
           j = edges[j];
@@ -337,7 +334,7 @@ namespace OpenMS
         continue;
       }
 
-      auto edges = per_bin_edges[bin];
+      const Size* edges = &per_bin_edges[bin * peak_count];
       float intensity = is_signal_bitset[index] ? 0 : all_peaks[index].intensity;
       float sum_intensity = .0, sum_squared_intensity = .0;
       int skiped_peak_cntr = 0;
@@ -355,7 +352,7 @@ namespace OpenMS
 
       Size j = edges[index];
 
-      while (j < edges.size())
+      while (j < peak_count)
       {
         j = edges[j];
         if (j <= 0)
@@ -56,11 +56,35 @@ namespace OpenMS
       }
     }
 
+    // the ms levels are processed independently; gather references up front so
+    // the loop below can run in parallel without mutating the maps themselves
+    struct LevelData
+    {
+      std::vector<float>* qscores;
+      std::vector<float>* dscore_iso;
+      std::vector<float>* dscore_noise;
+      std::vector<float>* dscore_charge;
+      std::map<float, float>* map_iso;
+      std::map<float, float>* map_noise;
+      std::map<float, float>* map_charge;
+    };
+    std::vector<LevelData> level_data;
+    level_data.reserve(tscore_map.size());
     for (auto& [ms_level, qscores] : tscore_map)
     {
-      auto& dscore_iso = dscore_iso_decoy_map[ms_level];
-      auto& dscore_charge = dscore_charge_decoy_map[ms_level];
-      auto& dscore_noise = dscore_noise_decoy_map[ms_level];
+      level_data.push_back(LevelData {&qscores, &dscore_iso_decoy_map[ms_level], &dscore_noise_decoy_map[ms_level], &dscore_charge_decoy_map[ms_level], &qscore_iso_decoy_map[ms_level],
+                                      &qscore_noise_decoy_map[ms_level], &qscore_charge_decoy_map[ms_level]});
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (SignedSize li = 0; li < (SignedSize)level_data.size(); li++)
+    {
+      auto& qscores = *level_data[li].qscores;
+      auto& dscore_iso = *level_data[li].dscore_iso;
+      auto& dscore_charge = *level_data[li].dscore_charge;
+      auto& dscore_noise = *level_data[li].dscore_noise;
 
       auto mixed_dist = getDistribution(qscores, bin_number);
       auto charge_dist = getDistribution(dscore_charge, bin_number);
@@ -132,50 +156,35 @@ namespace OpenMS
       std::sort(dscore_noise.begin(), dscore_noise.end());
       std::sort(dscore_charge.begin(), dscore_charge.end());
 
-      auto& map_charge = qscore_charge_decoy_map[ms_level];
-      float tmp_q_charge = 1;
-
-      // calculate q values using targets and charge dummies
-      for (size_t i = 0; i < qscores.size(); i++)
-      {
-        float ts = qscores[i];
-        size_t dindex = dscore_charge.size() == 0 ? 0 : std::distance(std::lower_bound(dscore_charge.begin(), dscore_charge.end(), ts), dscore_charge.end());
-        size_t tindex = qscores.size() - i;
-        float nom = weights[0] * (float)dindex;
-        float denom = (float)(tindex);
-        tmp_q_charge = (nom / denom);
-        map_charge[ts] = tmp_q_charge;
-      }
-
-      auto& map_iso = qscore_iso_decoy_map[ms_level];
-      float tmp_q_iso = 1;
-
-      // calculate q values using targets and isotope dummies
-      for (size_t i = 0; i < qscores.size(); i++)
-      {
-        float ts = qscores[i];
-        size_t dindex = dscore_iso.size() == 0 ? 0 : std::distance(std::lower_bound(dscore_iso.begin(), dscore_iso.end(), ts), dscore_iso.end());
-        size_t tindex = qscores.size() - i;
-        float nom = weights[2] * (float)dindex;
-        float denom = (float)(tindex);
-        tmp_q_iso = nom / denom;
-        map_iso[ts] = tmp_q_iso;
-      }
-
-      auto& map_noise = qscore_noise_decoy_map[ms_level];
-      float tmp_q_noise = 1;
+      auto& map_charge = *level_data[li].map_charge;
+      auto& map_iso = *level_data[li].map_iso;
+      auto& map_noise = *level_data[li].map_noise;
 
-      // calculate q values using targets and noise dummies
+      // calculate q values using targets and charge, isotope and noise dummies
+      // in one fused pass: since the targets are scanned in ascending score
+      // order, the number of decoys >= the current score follows from a
+      // merge-style walk over each sorted decoy vector (no per-target binary
+      // search), and each score is appended at the end of its q-value map
+      size_t charge_pos = 0, iso_pos = 0, noise_pos = 0; // first decoy >= current target score
       for (size_t i = 0; i < qscores.size(); i++)
       {
         float ts = qscores[i];
-        size_t dindex = dscore_noise.size() == 0 ? 0 : std::distance(std::lower_bound(dscore_noise.begin(), dscore_noise.end(), ts), dscore_noise.end());
-        size_t tindex = qscores.size() - i;
-        float nom = weights[1] * (float)dindex;
-        float denom = (float)(tindex);
-        // tmp_q_noise = std::min(tmp_q_noise, (nom / denom));
-        tmp_q_noise = (nom / denom);
-        map_noise[ts] = tmp_q_noise;
+        while (charge_pos < dscore_charge.size() && dscore_charge[charge_pos] < ts)
+          charge_pos++;
+        while (iso_pos < dscore_iso.size() && dscore_iso[iso_pos] < ts)
+          iso_pos++;
+        while (noise_pos < dscore_noise.size() && dscore_noise[noise_pos] < ts)
+          noise_pos++;
+
+        float denom = (float)(qscores.size() - i);
+        float tmp_q_charge = weights[0] * (float)(dscore_charge.size() - charge_pos) / denom;
+        float tmp_q_iso = weights[2] * (float)(dscore_iso.size() - iso_pos) / denom;
+        float tmp_q_noise = weights[1] * (float)(dscore_noise.size() - noise_pos) / denom;
+
+        // duplicate scores keep the value of their last (highest-index) occurrence
+        map_charge.emplace_hint(map_charge.end(), ts, tmp_q_charge)->second = tmp_q_charge;
+        map_iso.emplace_hint(map_iso.end(), ts, tmp_q_iso)->second = tmp_q_iso;
+        map_noise.emplace_hint(map_noise.end(), ts, tmp_q_noise)->second = tmp_q_noise;
       }
     }
 
@@ -78,7 +78,13 @@ namespace OpenMS
       int first_index = first_loop - peptides.cbegin();
       int last_index = last_loop - peptides.cbegin();
 
-#pragma omp parallel for
+#pragma omp parallel
+      {
+      // collect candidates per thread and merge them in one step,
+      // instead of synchronizing on every single candidate
+      vector<OPXLDataStructs::XLPrecursor> candidates_private;
+      vector<int> positions_private;
+#pragma omp for nowait
       for (int p1 = first_index; p1 < last_index; ++p1)
       {
         const String& seq_first = peptides[p1].unmodified_seq;
@@ -117,13 +123,17 @@ namespace OpenMS
          precursor.alpha_seq = seq_first;
          precursor.beta_seq = "";
 
-#pragma omp critical (mass_to_candidates_access)
-         {
-           mass_to_candidates.push_back(precursor);
-           precursor_correction_positions.push_back(pm);
-         }
+         candidates_private.push_back(precursor);
+         positions_private.push_back(pm);
         }
-      } // end of parallel loop over loop-link candidates
+      } // end of loop over loop-link candidates
+
+#pragma omp critical (mass_to_candidates_access)
+      {
+        mass_to_candidates.insert(mass_to_candidates.end(), candidates_private.begin(), candidates_private.end());
+        precursor_correction_positions.insert(precursor_correction_positions.end(), positions_private.begin(), positions_private.end());
+      }
+      } // end of parallel region over loop-link candidates
 
       // ################################ Enumerate Mono-Links #################
       for (Size i = 0; i < cross_link_mass_mono_link.size(); i++)
@@ -141,7 +151,11 @@ namespace OpenMS
         first_index = first_mono - peptides.cbegin();
         last_index = last_mono - peptides.cbegin();
 
-#pragma omp parallel for
+#pragma omp parallel
+        {
+        vector<OPXLDataStructs::XLPrecursor> candidates_private;
+        vector<int> positions_private;
+#pragma omp for nowait
         for (int p1 = first_index; p1 < last_index; ++p1)
         {
           // Monoisotopic weight of the peptide + cross-linker
@@ -155,12 +169,16 @@ namespace OpenMS
           precursor.alpha_seq = peptides[p1].unmodified_seq;
           precursor.beta_seq = "";
 
-#pragma omp critical (mass_to_candidates_access)
-         {
-           mass_to_candidates.push_back(precursor);
-           precursor_correction_positions.push_back(pm);
-         }
+          candidates_private.push_back(precursor);
+          positions_private.push_back(pm);
         } // end of loop over candidates for a specific mono-link mass
+
+#pragma omp critical (mass_to_candidates_access)
+        {
+          mass_to_candidates.insert(mass_to_candidates.end(), candidates_private.begin(), candidates_private.end());
+          precursor_correction_positions.insert(precursor_correction_positions.end(), positions_private.begin(), positions_private.end());
+        }
+        } // end of parallel region for a specific mono-link mass
       } // end of loop over mono-link masses
 
       // ################################ Enumerate Cross-Links #################
@@ -171,7 +189,11 @@ namespace OpenMS
       last_alpha = upper_bound(last_alpha, conservative_upper_bound, max_peptide_mass, OPXLDataStructs::AASeqWithMassComparator());
       int last_alpha_index = last_alpha - peptides.cbegin();
 
-#pragma omp parallel for
+#pragma omp parallel
+      {
+      vector<OPXLDataStructs::XLPrecursor> candidates_private;
+      vector<int> positions_private;
+#pragma omp for nowait
       for (int p1 = 0; p1 < last_alpha_index; ++p1)
       {
         // Constrain search for beta
@@ -203,13 +225,17 @@ namespace OpenMS
           precursor.alpha_seq = peptides[p1].unmodified_seq;
           precursor.beta_seq = peptides[p2].unmodified_seq;
 
-#pragma omp critical (mass_to_candidates_access)
-         {
-           mass_to_candidates.push_back(precursor);
-           precursor_correction_positions.push_back(pm);
-         }
+          candidates_private.push_back(precursor);
+          positions_private.push_back(pm);
         } // end of loop over betas
-      } // end of parallel loop over alphas
+      } // end of loop over alphas
+
+#pragma omp critical (mass_to_candidates_access)
+      {
+        mass_to_candidates.insert(mass_to_candidates.end(), candidates_private.begin(), candidates_private.end());
+        precursor_correction_positions.insert(precursor_correction_positions.end(), positions_private.begin(), positions_private.end());
+      }
+      } // end of parallel region over alphas
     } // end of loop over precursor masses
     return mass_to_candidates;
   }
@@ -966,8 +992,8 @@ namespace OpenMS
       String prot1_pos;
 
       // cross-link position in Protein (alpha)
-      const std::vector<PeptideEvidence> pevs = ph_alpha.getPeptideEvidences();
-      for (std::vector<PeptideEvidence>::const_iterator pev = pevs.begin(); pev != pevs.end(); ++pev)
+      const PeptideHit::PeptideEvidences& pevs = ph_alpha.getPeptideEvidences();
+      for (auto pev = pevs.begin(); pev != pevs.end(); ++pev)
       {
         // start counting at 1: pev->getStart() and xl_pos are both starting at 0,  with + 1 the N-term residue is number 1
         Int prot_link_pos = pev->getStart() + String(ph_alpha.getMetaValue(Constants::UserParam::OPENPEPXL_XL_POS1)).toInt() + 1;
@@ -987,8 +1013,8 @@ namespace OpenMS
         String prot2_pos;
         String prot2_accessions;
 
-        const std::vector<PeptideEvidence> pevs_beta = ph_beta.getPeptideEvidences();
-        for (std::vector<PeptideEvidence>::const_iterator pev = pevs_beta.begin(); pev != pevs_beta.end(); ++pev)
+        const PeptideHit::PeptideEvidences& pevs_beta = ph_beta.getPeptideEvidences();
+        for (auto pev = pevs_beta.begin(); pev != pevs_beta.end(); ++pev)
         {
           // start counting at 1: pev->getStart() and xl_pos are both starting at 0,  with + 1 the N-term residue is number 1
           Int prot_link_pos = pev->getStart() + String(ph_alpha.getMetaValue(Constants::UserParam::OPENPEPXL_XL_POS2)).toInt() + 1;
@@ -1010,7 +1036,7 @@ namespace OpenMS
         if (ph_alpha.getMetaValue(Constants::UserParam::OPENPEPXL_XL_POS2) != "-")
         {
           String prot2_pos;
-          for (std::vector<PeptideEvidence>::const_iterator pev = pevs.begin(); pev != pevs.end(); ++pev)
+          for (auto pev = pevs.begin(); pev != pevs.end(); ++pev)
           {
             // start counting at 1: pev->getStart() and xl_pos are both starting at 0,  with + 1 the N-term residue is number 1
             Int prot_link_pos = pev->getStart() + String(ph_alpha.getMetaValue(Constants::UserParam::OPENPEPXL_XL_POS2)).toInt() + 1;
@@ -1044,8 +1070,8 @@ namespace OpenMS
         PeptideHit& ph_beta = id.getHits()[1];
         String prot2_accessions;
 
-        const std::vector<PeptideEvidence> pevs_beta = ph_beta.getPeptideEvidences();
-        for (std::vector<PeptideEvidence>::const_iterator pev = pevs_beta.begin(); pev != pevs_beta.end(); ++pev)
+        const PeptideHit::PeptideEvidences& pevs_beta = ph_beta.getPeptideEvidences();
+        for (auto pev = pevs_beta.begin(); pev != pevs_beta.end(); ++pev)
         {
           prot2_accessions = prot2_accessions + "," + pev->getProteinAccession();
         }
@@ -1101,7 +1127,7 @@ namespace OpenMS
       if (id.getHits().size() == 2 && id.getHits()[1].getMetaValue("xl_chain") == "MS:1002510")
       {
 
-        const std::vector<PeptideEvidence>& peptide_evidences = id.getHits()[1].getPeptideEvidences();
+        const PeptideHit::PeptideEvidences& peptide_evidences = id.getHits()[1].getPeptideEvidences();
         String pre, post, start, end;
         for (const PeptideEvidence& pe : peptide_evidences)
         {
@@ -99,8 +99,11 @@ namespace OpenMS
     filter_param.setValue("movetype", "jump", "Whether sliding window (one peak steps) or jumping window (window size steps) should be used.");
     window_mower_filter.setParameters(filter_param);
 
-    PeakMap filtered_spectra;
-
+    // process into per-index slots and assemble the map afterwards: no lock on a
+    // shared container, and the output keeps the input spectrum order regardless
+    // of thread scheduling (the labeled mode relies on stable spectrum indices)
+    std::vector<PeakSpectrum> processed(exp.size());
+    std::vector<char> keep(exp.size(), 0);
 
 #pragma omp parallel for
     for (SignedSize exp_index = 0; exp_index < static_cast<SignedSize>(exp.size()); ++exp_index)
@@ -150,8 +153,8 @@ namespace OpenMS
           window_mower_filter.filterPeakSpectrum(deisotoped);
           deisotoped.sortByPosition();
 
-#pragma omp critical (filtered_spectra_access)
-          filtered_spectra.addSpectrum(deisotoped);
+          processed[exp_index] = std::move(deisotoped);
+          keep[exp_index] = 1;
         }
       }
       else
@@ -167,11 +170,20 @@ namespace OpenMS
         {
           filtered.sortByPosition();
 
-#pragma omp critical (filtered_spectra_access)
-          filtered_spectra.addSpectrum(filtered);
+          processed[exp_index] = std::move(filtered);
+          keep[exp_index] = 1;
         }
       }
     } // end of parallelized loop over spectra
+
+    PeakMap filtered_spectra;
+    for (Size exp_index = 0; exp_index < exp.size(); ++exp_index)
+    {
+      if (keep[exp_index])
+      {
+        filtered_spectra.addSpectrum(std::move(processed[exp_index]));
+      }
+    }
     return filtered_spectra;
   }
 
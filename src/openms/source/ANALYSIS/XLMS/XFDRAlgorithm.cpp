@@ -315,7 +315,7 @@ using namespace OpenMS;
         if (ph.metaValueExists(Constants::UserParam::OPENPEPXL_XL_TYPE) && ph.getMetaValue(Constants::UserParam::OPENPEPXL_XL_TYPE) == "cross-link")
         {
           StringList alpha_prots;
-          const std::vector<PeptideEvidence> pevs_alpha = ph.getPeptideEvidences();
+          const PeptideHit::PeptideEvidences& pevs_alpha = ph.getPeptideEvidences();
           for (PeptideEvidence pev : pevs_alpha)
           {
             alpha_prots.push_back(pev.getProteinAccession());
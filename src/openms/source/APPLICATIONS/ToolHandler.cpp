@@ -16,7 +16,20 @@
 
 namespace OpenMS
 {
-  ToolListType ToolHandler::getTOPPToolList(const bool includeGenericWrapper)
+  const ToolListType& ToolHandler::getTOPPToolList(const bool includeGenericWrapper)
+  {
+    // build each variant only once: every TOPP tool invocation queries this list
+    // (TOPPBase constructor and main), and building it parses *.ttd files
+    if (includeGenericWrapper)
+    {
+      static const ToolListType tools_with_wrapper = createTOPPToolList_(true);
+      return tools_with_wrapper;
+    }
+    static const ToolListType tools = createTOPPToolList_(false);
+    return tools;
+  }
+
+  ToolListType ToolHandler::createTOPPToolList_(const bool includeGenericWrapper)
   {
     ToolListType tools_map;
     
@@ -145,6 +158,7 @@ namespace OpenMS
     tools_map["OpenSwathFeatureXMLToTSV"] = Internal::ToolDescription("OpenSwathFeatureXMLToTSV", cat_targeted);
     tools_map["OpenSwathFileSplitter"] = Internal::ToolDescription("OpenSwathFileSplitter", cat_targeted);
     tools_map["OpenSwathMzMLFileCacher"] = Internal::ToolDescription("OpenSwathMzMLFileCacher", cat_targeted);
+    tools_map["OpenSwathOSWMerger"] = Internal::ToolDescription("OpenSwathOSWMerger", cat_targeted);
     tools_map["OpenSwathRewriteToFeatureXML"] = Internal::ToolDescription("OpenSwathRewriteToFeatureXML", cat_targeted);
     tools_map["OpenSwathRTNormalizer"] = Internal::ToolDescription("OpenSwathRTNormalizer", cat_targeted);
     tools_map["OpenSwathWorkflow"] = Internal::ToolDescription("OpenSwathWorkflow", cat_targeted);
@@ -239,19 +253,11 @@ namespace OpenMS
 
   StringList ToolHandler::getTypes(const String& toolname)
   {
-    Internal::ToolDescription ret;
-    ToolListType tools;
-    if (toolname == "GenericWrapper")
-    {
-      tools = getTOPPToolList(true);
-    }
-    else
-    {
-      tools = getTOPPToolList();
-    }
-    if (tools.find(toolname) != tools.end())
+    const ToolListType& tools = getTOPPToolList(toolname == "GenericWrapper");
+    auto it = tools.find(toolname);
+    if (it != tools.end())
     {
-      return tools[toolname].types;
+      return it->second.types;
     }
     throw Exception::InvalidValue(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Requested tool '" + toolname + "' does not exist!", toolname);
   }
@@ -395,11 +401,12 @@ namespace OpenMS
 
   String ToolHandler::getCategory(const String& toolname)
   {
-    ToolListType tools = getTOPPToolList(true);
+    const ToolListType& tools = getTOPPToolList(true);
     String s;
-    if (tools.find(toolname) != tools.end())
+    auto it = tools.find(toolname);
+    if (it != tools.end())
     {
-      s = tools[toolname].category;
+      s = it->second.category;
     }
 
     return s;
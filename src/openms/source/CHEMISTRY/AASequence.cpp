@@ -1691,4 +1691,37 @@ namespace OpenMS
     return aas;
   }
 
+  std::vector<AASequence> AASequence::fromStrings(const std::vector<String>& sequences, bool permissive)
+  {
+    std::vector<AASequence> result(sequences.size());
+    SignedSize first_error(-1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (SignedSize i = 0; i < (SignedSize)sequences.size(); ++i)
+    {
+      try
+      {
+        parseString_(sequences[i], result[i], permissive);
+      }
+      catch (...)
+      {
+        // exceptions must not leave the parallel region; remember the first
+        // offending sequence and rethrow below
+#ifdef _OPENMP
+#pragma omp critical (AASequence_fromStrings)
+#endif
+        {
+          if (first_error == -1 || i < first_error) first_error = i;
+        }
+      }
+    }
+    if (first_error != -1)
+    {
+      AASequence aas;
+      parseString_(sequences[first_error], aas, permissive); // throws the original exception
+    }
+    return result;
+  }
+
 }
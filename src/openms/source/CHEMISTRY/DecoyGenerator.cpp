@@ -10,6 +10,8 @@
 #include <OpenMS/CHEMISTRY/ProteaseDigestion.h>
 #include <OpenMS/CHEMISTRY/DecoyGenerator.h>
 #include <OpenMS/CONCEPT/Macros.h>
+#include <OpenMS/CONCEPT/TaskPool.h>
+#include <OpenMS/DATASTRUCTURES/StringView.h>
 
 #include <chrono>
 #include <algorithm>
@@ -19,11 +21,13 @@ using namespace OpenMS;
 DecoyGenerator::DecoyGenerator()
 {
   const UInt64 seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+  seed_ = seed;
   shuffler_.seed(seed);
 }
 
 void DecoyGenerator::setSeed(UInt64 seed)
 {
+  seed_ = seed;
   shuffler_.seed(seed);
 }
 
@@ -122,6 +126,163 @@ AASequence DecoyGenerator::shufflePeptides(
   return AASequence::fromString(protein_shuffled);
 }
 
+// static
+String DecoyGenerator::generateDecoySequence(
+  const String& sequence,
+  Method method,
+  const ProteaseDigestion& digestion,
+  int max_attempts,
+  Math::RandomShuffler& shuffler)
+{
+  if (sequence.empty())
+  {
+    return sequence;
+  }
+
+  if (method == Method::REVERSE_PROTEIN)
+  {
+    String s(sequence);
+    std::reverse(s.begin(), s.end());
+    return s;
+  }
+
+  std::vector<StringView> peptides;
+  digestion.digestUnmodified(StringView(sequence), peptides);
+
+  String decoy;
+  decoy.reserve(sequence.size());
+  for (Size i = 0; i < peptides.size(); ++i)
+  {
+    String s = peptides[i].getString();
+    // the last peptide of a protein does not end in an enzymatic cutting site,
+    // all others keep their cutting site (= last residue) in place
+    const bool last_peptide = (i == peptides.size() - 1);
+    const auto reverse_end = last_peptide ? s.end() : --s.end();
+
+    if (method == Method::REVERSE_PEPTIDES)
+    {
+      std::reverse(s.begin(), reverse_end);
+      decoy += s;
+      continue;
+    }
+
+    // Method::SHUFFLE_PEPTIDES
+    const String target = s;
+    double lowest_identity(1.0);
+    String lowest_identity_string(s);
+    for (int attempt = 0; attempt < max_attempts; ++attempt) // try to find sequence with low identity
+    {
+      shuffler.portable_random_shuffle(s.begin(), reverse_end);
+      double identity = SequenceIdentity_(s, target);
+      if (identity < lowest_identity)
+      {
+        lowest_identity = identity;
+        lowest_identity_string = s;
+        // only the cutting site (if any) of all AAs may match
+        if (identity <= (last_peptide ? 0.0 : (1.0 / s.size() + 1e-6)))
+        {
+          break; // found perfect shuffle
+        }
+      }
+    }
+    decoy += lowest_identity_string;
+  }
+  return decoy;
+}
+
+namespace
+{
+  // digestion setup shared by the bulk interface: we want to reverse/shuffle between all cutting sites
+  ProteaseDigestion makeFullDigestion(const String& protease)
+  {
+    ProteaseDigestion digestion;
+    digestion.setMissedCleavages(0);
+    digestion.setEnzyme(protease);
+    digestion.setSpecificity(EnzymaticDigestion::SPEC_NONE);
+    return digestion;
+  }
+
+  FASTAFile::FASTAEntry makeDecoyEntry(const FASTAFile::FASTAEntry& target, String decoy_sequence, const String& decoy_string, bool decoy_string_prefix)
+  {
+    FASTAFile::FASTAEntry decoy(target);
+    decoy.identifier = decoy_string_prefix ? decoy_string + target.identifier : target.identifier + decoy_string;
+    decoy.sequence = std::move(decoy_sequence);
+    return decoy;
+  }
+}
+
+void DecoyGenerator::appendDecoys(
+  std::vector<FASTAFile::FASTAEntry>& db,
+  Method method,
+  const String& protease,
+  const String& decoy_string,
+  bool decoy_string_prefix,
+  int max_attempts) const
+{
+  const ProteaseDigestion digestion = makeFullDigestion(protease);
+
+  const Size n_targets = db.size();
+  db.resize(n_targets * 2);
+  TaskPool::parallelFor(0, (SignedSize)n_targets, 0, [&](SignedSize i)
+  {
+    // per-protein RNG: reproducible for a fixed seed, independent of the thread count
+    Math::RandomShuffler shuffler;
+    shuffler.seed(seed_ + (UInt64)i);
+    db[n_targets + i] = makeDecoyEntry(db[i],
+                                       generateDecoySequence(db[i].sequence, method, digestion, max_attempts, shuffler),
+                                       decoy_string, decoy_string_prefix);
+  });
+}
+
+void DecoyGenerator::generateDecoyDatabase(
+  const String& in_fasta,
+  const String& out_fasta,
+  Method method,
+  const String& protease,
+  const String& decoy_string,
+  bool decoy_string_prefix,
+  int max_attempts,
+  Size batch_size) const
+{
+  const ProteaseDigestion digestion = makeFullDigestion(protease);
+
+  FASTAFile reader;
+  reader.readStart(in_fasta);
+  FASTAFile writer;
+  writer.writeStart(out_fasta);
+
+  std::vector<FASTAFile::FASTAEntry> batch;
+  batch.reserve(batch_size);
+  std::vector<String> decoy_sequences;
+  UInt64 entry_index = 0; // global entry index, keeps shuffling reproducible across batches
+  FASTAFile::FASTAEntry entry;
+  bool more = true;
+  while (more)
+  {
+    batch.clear();
+    while (batch.size() < batch_size && (more = reader.readNext(entry)))
+    {
+      batch.push_back(std::move(entry));
+    }
+
+    decoy_sequences.assign(batch.size(), String());
+    TaskPool::parallelFor(0, (SignedSize)batch.size(), 0, [&](SignedSize i)
+    {
+      Math::RandomShuffler shuffler;
+      shuffler.seed(seed_ + entry_index + (UInt64)i);
+      decoy_sequences[i] = generateDecoySequence(batch[i].sequence, method, digestion, max_attempts, shuffler);
+    });
+
+    for (Size i = 0; i < batch.size(); ++i)
+    {
+      writer.writeNext(batch[i]);
+      writer.writeNext(makeDecoyEntry(batch[i], std::move(decoy_sequences[i]), decoy_string, decoy_string_prefix));
+    }
+    entry_index += batch.size();
+  }
+  writer.writeEnd();
+}
+
 // static
 double DecoyGenerator::SequenceIdentity_(const String& decoy, const String& target)
 {
@@ -0,0 +1,217 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CHEMISTRY/DigestCache.h>
+
+#include <OpenMS/CONCEPT/Exception.h>
+#include <OpenMS/CONCEPT/Macros.h>
+#include <OpenMS/DATASTRUCTURES/StringView.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+// first word of every digest cache file
+#define DIGEST_CACHE_FILE_IDENTIFIER 8095
+
+namespace OpenMS
+{
+
+  String DigestCache::cacheKey(const std::vector<FASTAFile::FASTAEntry>& fasta_db,
+                               const EnzymaticDigestion& digestion,
+                               Size min_length,
+                               Size max_length)
+  {
+    // FNV-1a with its standard 64 bit constants, so the key only depends on the
+    // input (and not on platform or standard library hash implementations)
+    UInt64 hash = 0xcbf29ce484222325ull;
+    auto feed = [&hash](const std::string& data)
+    {
+      for (const char c : data)
+      {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x00000100000001b3ull;
+      }
+      // separate the fields so concatenations cannot collide
+      hash ^= static_cast<unsigned char>('\n');
+      hash *= 0x00000100000001b3ull;
+    };
+
+    // the database content in its final order (positions in the cache refer to it)
+    for (const FASTAFile::FASTAEntry& entry : fasta_db)
+    {
+      feed(entry.sequence);
+    }
+
+    // all digestion-relevant parameters
+    feed(digestion.getEnzymeName());
+    feed(EnzymaticDigestion::NamesOfSpecificity[digestion.getSpecificity()]);
+    feed(String(digestion.getMissedCleavages()));
+    feed(String(min_length));
+    feed(String(max_length));
+
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+    return String(hex);
+  }
+
+  String DigestCache::cacheFileName(const String& cache_dir, const String& key)
+  {
+    return cache_dir + "/" + key + ".digestcache";
+  }
+
+  void DigestCache::store(const String& filename,
+                          const String& key,
+                          const std::vector<FASTAFile::FASTAEntry>& fasta_db,
+                          const EnzymaticDigestion& digestion,
+                          Size min_length,
+                          Size max_length)
+  {
+    std::ofstream ofs(filename.c_str(), std::ios::binary);
+    if (!ofs)
+    {
+      throw Exception::UnableToCreateFile(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename);
+    }
+
+    Size value = DIGEST_CACHE_FILE_IDENTIFIER;
+    ofs.write(reinterpret_cast<const char*>(&value), sizeof(value));
+
+    // the key, zero-padded so everything behind it stays Size-aligned
+    const Size key_length = key.size();
+    ofs.write(reinterpret_cast<const char*>(&key_length), sizeof(key_length));
+    ofs.write(key.c_str(), key_length);
+    const char padding[sizeof(Size)] = {0};
+    const Size padded_key_length = (key_length + sizeof(Size) - 1) / sizeof(Size) * sizeof(Size);
+    ofs.write(padding, padded_key_length - key_length);
+
+    const Size nr_proteins = fasta_db.size();
+    ofs.write(reinterpret_cast<const char*>(&nr_proteins), sizeof(nr_proteins));
+
+    // reserve space for the offset table; the records are streamed right behind
+    // it while digesting, then the completed table is written back
+    const std::streampos offsets_pos = ofs.tellp();
+    std::vector<Size> offsets(nr_proteins + 1, 0);
+    ofs.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(Size));
+
+    std::vector<PeptideMass> current_digest;
+    Size nr_records = 0;
+    for (Size i = 0; i < nr_proteins; ++i)
+    {
+      offsets[i] = nr_records;
+      digestion.digestUnmodifiedWithMasses(StringView(fasta_db[i].sequence), current_digest, min_length, max_length);
+      nr_records += current_digest.size();
+      if (!current_digest.empty())
+      {
+        ofs.write(reinterpret_cast<const char*>(current_digest.data()), current_digest.size() * sizeof(PeptideMass));
+      }
+    }
+    offsets[nr_proteins] = nr_records;
+
+    ofs.seekp(offsets_pos);
+    ofs.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(Size));
+    if (!ofs)
+    {
+      throw Exception::UnableToCreateFile(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename);
+    }
+  }
+
+  bool DigestCache::load(const String& filename, const String& key)
+  {
+    clear_();
+
+    const char* base = nullptr;
+    Size size = 0;
+    if (mmap_file_.open(filename))
+    {
+      base = mmap_file_.data();
+      size = mmap_file_.size();
+    }
+    else
+    {
+      // platform without memory mapping support: read the whole file instead
+      std::ifstream ifs(filename.c_str(), std::ios::binary);
+      if (!ifs)
+      {
+        return false;
+      }
+      buffer_.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+      base = buffer_.data();
+      size = buffer_.size();
+    }
+
+    Size pos = 0;
+    auto readSize = [base, size, &pos](Size& value) -> bool
+    {
+      if (size - pos < sizeof(Size) || size < pos)
+      {
+        return false;
+      }
+      std::memcpy(&value, base + pos, sizeof(Size));
+      pos += sizeof(Size);
+      return true;
+    };
+
+    Size magic;
+    if (!readSize(magic) || magic != DIGEST_CACHE_FILE_IDENTIFIER)
+    {
+      clear_();
+      return false;
+    }
+
+    // a cache written for a different database or different parameters carries
+    // a different key and is treated like a missing file
+    Size key_length;
+    const Size padded_key_length = (key.size() + sizeof(Size) - 1) / sizeof(Size) * sizeof(Size);
+    if (!readSize(key_length) || key_length != key.size() ||
+        size - pos < padded_key_length ||
+        std::memcmp(base + pos, key.c_str(), key_length) != 0)
+    {
+      clear_();
+      return false;
+    }
+    pos += padded_key_length;
+
+    Size nr_proteins;
+    if (!readSize(nr_proteins) || (size - pos) / sizeof(Size) < nr_proteins + 1)
+    {
+      clear_();
+      return false;
+    }
+    offsets_ = reinterpret_cast<const Size*>(base + pos);
+    pos += (nr_proteins + 1) * sizeof(Size);
+
+    const Size nr_records = offsets_[nr_proteins];
+    if ((size - pos) / sizeof(PeptideMass) != nr_records || (size - pos) % sizeof(PeptideMass) != 0)
+    {
+      clear_();
+      return false;
+    }
+    records_ = reinterpret_cast<const PeptideMass*>(base + pos);
+    nr_proteins_ = nr_proteins;
+    return true;
+  }
+
+  DigestCache::DigestView DigestCache::getDigest(Size protein_index) const
+  {
+    OPENMS_PRECONDITION(isLoaded(), "No digest cache loaded");
+    OPENMS_PRECONDITION(protein_index < nr_proteins_, "Protein index out of range");
+    return DigestView(records_ + offsets_[protein_index], offsets_[protein_index + 1] - offsets_[protein_index]);
+  }
+
+  void DigestCache::clear_()
+  {
+    mmap_file_.close();
+    buffer_.clear();
+    buffer_.shrink_to_fit();
+    offsets_ = nullptr;
+    records_ = nullptr;
+    nr_proteins_ = 0;
+  }
+
+} // namespace OpenMS
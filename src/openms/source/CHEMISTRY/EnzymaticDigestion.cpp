@@ -8,11 +8,17 @@
 
 #include <OpenMS/CHEMISTRY/EnzymaticDigestion.h>
 #include <OpenMS/CHEMISTRY/ProteaseDB.h>
+#include <OpenMS/CHEMISTRY/Residue.h>
+#include <OpenMS/CHEMISTRY/ResidueDB.h>
 #include <OpenMS/CONCEPT/LogStream.h>
 #include <OpenMS/DATASTRUCTURES/StringView.h>
 #include <OpenMS/SYSTEM/File.h>
 #include <boost/regex.hpp>
 
+#include <array>
+#include <cmath>
+#include <limits>
+
 using namespace std;
 
 namespace OpenMS
@@ -27,12 +33,16 @@ namespace OpenMS
       re_(new boost::regex(enzyme_->getRegEx())),
       specificity_(SPEC_FULL)
   {
+    compileSimpleRule_();
   }
 
   EnzymaticDigestion::EnzymaticDigestion(const EnzymaticDigestion& rhs) :
       missed_cleavages_(rhs.missed_cleavages_),
       enzyme_(rhs.enzyme_),
       re_(new boost::regex(*rhs.re_)),
+      simple_rule_(rhs.simple_rule_),
+      cut_after_(rhs.cut_after_),
+      cut_before_(rhs.cut_before_),
       specificity_(rhs.specificity_)
   {
   }
@@ -42,6 +52,9 @@ namespace OpenMS
     missed_cleavages_ = rhs.missed_cleavages_;
     enzyme_ = rhs.enzyme_;
     re_.reset(new boost::regex(*rhs.re_));
+    simple_rule_ = rhs.simple_rule_;
+    cut_after_ = rhs.cut_after_;
+    cut_before_ = rhs.cut_before_;
     specificity_ = rhs.specificity_;
     return *this;
   }
@@ -62,6 +75,7 @@ namespace OpenMS
   {
     enzyme_ = enzyme;
     re_.reset(new boost::regex(enzyme_->getRegEx()));
+    compileSimpleRule_();
   }
 
   String EnzymaticDigestion::getEnzymeName() const
@@ -89,6 +103,88 @@ namespace OpenMS
     specificity_ = spec;
   }
 
+  void EnzymaticDigestion::compileSimpleRule_()
+  {
+    simple_rule_ = false;
+    cut_after_.fill(false);
+    cut_before_.fill(true);
+
+    // parse a single residue or a character class (e.g. "K" or "[KR]" or "[A-Z]")
+    // starting at i; on success, advance i and set the listed characters in 'set'
+    const std::string& re = enzyme_->getRegEx();
+    auto parse_set = [&re](size_t& i, std::array<bool, 256>& set) -> bool {
+      set.fill(false);
+      if (i >= re.size()) return false;
+      if (re[i] != '[')
+      {
+        if (!isupper(re[i])) return false;
+        set[(unsigned char)re[i]] = true;
+        ++i;
+        return true;
+      }
+      ++i; // skip '['
+      if (i < re.size() && re[i] == '^') return false; // negated classes stay with the regex engine
+      while (i < re.size() && re[i] != ']')
+      {
+        if (!isupper(re[i])) return false;
+        if (i + 2 < re.size() && re[i + 1] == '-' && isupper(re[i + 2]))
+        { // range, e.g. "A-Z"
+          if (re[i] > re[i + 2]) return false;
+          for (char c = re[i]; c <= re[i + 2]; ++c) set[(unsigned char)c] = true;
+          i += 3;
+        }
+        else
+        {
+          set[(unsigned char)re[i]] = true;
+          ++i;
+        }
+      }
+      if (i >= re.size()) return false;
+      ++i; // skip ']'
+      return true;
+    };
+
+    // accept any sequence of zero-width groups: (?<=set) restricts the residue
+    // before the cut, (?=set) / (?!set) restrict the residue after the cut
+    bool has_lookbehind = false;
+    std::array<bool, 256> set{};
+    size_t i = 0;
+    while (i < re.size())
+    {
+      if (re.compare(i, 4, "(?<=") == 0)
+      {
+        i += 4;
+        if (has_lookbehind || !parse_set(i, set)) return;
+        cut_after_ = set;
+        has_lookbehind = true;
+      }
+      else if (re.compare(i, 3, "(?=") == 0 || re.compare(i, 3, "(?!") == 0)
+      {
+        const bool negated = (re[i + 2] == '!');
+        i += 3;
+        if (!parse_set(i, set)) return;
+        for (int c = 0; c < 256; ++c)
+        {
+          cut_before_[c] = cut_before_[c] && (negated ? !set[c] : set[c]);
+        }
+      }
+      else
+      {
+        return; // anything else (alternations, quantifiers, ...): keep the regex engine
+      }
+      if (i >= re.size() || re[i] != ')') return;
+      ++i; // skip ')'
+    }
+    if (!has_lookbehind)
+    {
+      // covers "()" (no cleavage) and lookahead-only enzymes (e.g. Asp-N): the
+      // latter tokenize differently at the range start (leading empty token),
+      // which the table scan would not reproduce
+      return;
+    }
+    simple_rule_ = true;
+  }
+
   std::vector<int> EnzymaticDigestion::tokenize_(const String& sequence, int start, int end) const
   {
     std::vector<int> positions;
@@ -97,7 +193,21 @@ namespace OpenMS
     if (end < 0 || end > (int)sequence.size())
       end = (int)sequence.size();
 
-    if (enzyme_->getRegEx() != "()") // if it's not "no cleavage"
+    if (simple_rule_) // table-driven scan, equivalent to the enzyme's regex (see compileSimpleRule_())
+    {
+      if (start < end)
+      {
+        positions.push_back(start);
+        for (int p = start + 1; p < end; ++p)
+        {
+          if (cut_after_[(unsigned char)sequence[p - 1]] && cut_before_[(unsigned char)sequence[p]])
+          {
+            positions.push_back(p);
+          }
+        }
+      }
+    }
+    else if (enzyme_->getRegEx() != "()") // if it's not "no cleavage"
     {
       boost::sregex_token_iterator i(sequence.begin() + start, sequence.begin() + end, *re_, -1);
       boost::sregex_token_iterator j;
@@ -433,4 +543,60 @@ namespace OpenMS
     return digestAfterTokenize_(fragment_positions, sequence, output, min_length, max_length);
   }
 
+  /// residue monoisotopic masses (internal residues) indexed by one-letter code; NaN for characters without a defined mass
+  static const std::array<double, 256>& residueMonoMasses_()
+  {
+    static const std::array<double, 256> table = []() {
+      std::array<double, 256> t;
+      t.fill(std::numeric_limits<double>::quiet_NaN());
+      const ResidueDB* db = ResidueDB::getInstance();
+      for (int c = 'A'; c <= 'Z'; ++c)
+      {
+        const Residue* r = db->getResidue(static_cast<unsigned char>(c));
+        if (r != nullptr && c != 'X') // 'X' represents an unknown mass (see AASequence::getMonoWeight)
+        {
+          t[c] = r->getMonoWeight(Residue::Internal);
+        }
+      }
+      return t;
+    }();
+    return table;
+  }
+
+  Size EnzymaticDigestion::digestUnmodifiedWithMasses(const StringView& sequence, std::vector<PeptideMass>& output, Size min_length, Size max_length) const
+  {
+    // obtain (position, length) products first; this handles unspecific cleavage and missed cleavages
+    std::vector<std::pair<Size, Size>> products;
+    const Size wrong_size = digestUnmodified(sequence, products, min_length, max_length);
+
+    // prefix sums of residue masses over the protein:
+    // mass(position, length) = prefix[position + length] - prefix[position] + water
+    // Characters without defined mass contribute 0 to the sums (a NaN would poison all downstream
+    // prefixes); affected peptides are detected via a second prefix sum and reported with mass NaN.
+    const std::array<double, 256>& residue_mass = residueMonoMasses_();
+    const String seq = sequence.getString();
+    std::vector<double> prefix(seq.size() + 1, 0.0);
+    std::vector<Size> n_unknown(seq.size() + 1, 0);
+    for (Size i = 0; i < seq.size(); ++i)
+    {
+      const double m = residue_mass[static_cast<unsigned char>(seq[i])];
+      const bool known = !std::isnan(m);
+      prefix[i + 1] = prefix[i] + (known ? m : 0.0);
+      n_unknown[i + 1] = n_unknown[i] + (known ? 0 : 1);
+    }
+    const double water = Residue::getInternalToFull().getMonoWeight();
+
+    output.clear();
+    output.reserve(products.size());
+    for (const auto& p : products)
+    {
+      const Size end = p.first + p.second;
+      const double mass = (n_unknown[end] == n_unknown[p.first]) ?
+        prefix[end] - prefix[p.first] + water :
+        std::numeric_limits<double>::quiet_NaN();
+      output.push_back({p.first, p.second, mass});
+    }
+    return wrong_size;
+  }
+
 } // namespace OpenMS
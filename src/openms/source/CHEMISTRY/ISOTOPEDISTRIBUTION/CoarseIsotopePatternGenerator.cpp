@@ -89,6 +89,61 @@ namespace OpenMS
 
 
 
+  void CoarseIsotopePatternGenerator::buildAveragineTable(double max_weight, double resolution)
+  {
+    if (resolution <= 0.0 || max_weight < resolution)
+    {
+      throw Exception::Precondition(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+        "CoarseIsotopePatternGenerator: averagine table requires max_weight >= resolution > 0");
+    }
+    averagine_resolution_ = resolution;
+    const Size n_entries = (Size)(max_weight / resolution);
+    averagine_table_.clear();
+    averagine_table_.reserve(n_entries);
+    for (Size i = 0; i < n_entries; ++i)
+    {
+      averagine_table_.push_back(estimateFromPeptideWeight((i + 1) * resolution));
+    }
+  }
+
+  bool CoarseIsotopePatternGenerator::hasAveragineTable() const
+  {
+    return !averagine_table_.empty();
+  }
+
+  IsotopeDistribution CoarseIsotopePatternGenerator::estimateFromPeptideWeightFast(double average_weight)
+  {
+    if (averagine_table_.empty())
+    {
+      return estimateFromPeptideWeight(average_weight);
+    }
+    // nearest table entry; weights beyond the table use its last entry
+    Size index = (Size)std::max(0.0, std::round(average_weight / averagine_resolution_) - 1.0);
+    index = std::min(index, averagine_table_.size() - 1);
+
+    IsotopeDistribution result = averagine_table_[index];
+    // shift the masses from the table weight to the query weight
+    // (keep integer masses if rounding is requested)
+    double shift = average_weight - (index + 1) * averagine_resolution_;
+    if (round_masses_) shift = std::round(shift);
+    for (Peak1D& peak : result)
+    {
+      peak.setMZ(peak.getMZ() + shift);
+    }
+    return result;
+  }
+
+  std::vector<IsotopeDistribution> CoarseIsotopePatternGenerator::estimateFromPeptideWeights(const std::vector<double>& average_weights)
+  {
+    std::vector<IsotopeDistribution> results;
+    results.reserve(average_weights.size());
+    for (const double weight : average_weights)
+    {
+      results.push_back(estimateFromPeptideWeightFast(weight));
+    }
+    return results;
+  }
+
   IsotopeDistribution CoarseIsotopePatternGenerator::estimateFromPeptideWeightAndS(double average_weight, UInt S)
   {
     // Element counts are from Senko's Averagine model, excluding sulfur.
@@ -474,14 +474,7 @@ namespace OpenMS
 
       #pragma omp critical(OpenMS_ModificationsDB)
       {
-        // e.g. Oxidation (M)
-        modification_names_[m->getFullId()].insert(m);
-        // e.g. Oxidation
-        modification_names_[m->getId()].insert(m);
-        // e.g. Oxidized
-        modification_names_[m->getFullName()].insert(m);
-        // e.g. UniMod:312
-        modification_names_[m->getUniModAccession()].insert(m);
+        addNamesToIndex_(m);
         mods_.push_back(m);
       }
     }
@@ -500,10 +493,7 @@ namespace OpenMS
       }
       else
       {
-        modification_names_[new_mod->getFullId()].insert(new_mod.get());
-        modification_names_[new_mod->getId()].insert(new_mod.get());
-        modification_names_[new_mod->getFullName()].insert(new_mod.get());
-        modification_names_[new_mod->getUniModAccession()].insert(new_mod.get());
+        addNamesToIndex_(new_mod.get());
         mods_.push_back(new_mod.get());
         new_mod.release(); // do not delete the object;
         ret = mods_.back();
@@ -525,10 +515,7 @@ namespace OpenMS
       }
       else
       {
-        modification_names_[ret->getFullId()].insert(ret);
-        modification_names_[ret->getId()].insert(ret);
-        modification_names_[ret->getFullName()].insert(ret);
-        modification_names_[ret->getUniModAccession()].insert(ret);
+        addNamesToIndex_(ret);
         mods_.push_back(const_cast<ResidueModification*>(ret));
         ret = mods_.back();
       }
@@ -541,16 +528,35 @@ namespace OpenMS
     const ResidueModification* ret = new ResidueModification(new_mod);
     #pragma omp critical(OpenMS_ModificationsDB)
     {
-      modification_names_[ret->getFullId()].insert(ret);
-      modification_names_[ret->getId()].insert(ret);
-      modification_names_[ret->getFullName()].insert(ret);
-      modification_names_[ret->getUniModAccession()].insert(ret);
+      addNamesToIndex_(ret);
       mods_.push_back(const_cast<ResidueModification*>(ret));
       ret = mods_.back();
     }
     return ret;
   }
 
+  void ModificationsDB::addNamesToIndex_(const ResidueModification* mod)
+  {
+    // e.g. Oxidation (M); always set before a modification is registered
+    modification_names_[mod->getFullId()].insert(mod);
+    // e.g. Oxidation
+    if (!mod->getId().empty())
+    {
+      modification_names_[mod->getId()].insert(mod);
+    }
+    // e.g. Oxidized
+    if (!mod->getFullName().empty())
+    {
+      modification_names_[mod->getFullName()].insert(mod);
+    }
+    // e.g. UniMod:312; empty for modifications without a UniMod mapping
+    const String& unimod_accession = mod->getUniModAccession();
+    if (!unimod_accession.empty())
+    {
+      modification_names_[unimod_accession].insert(mod);
+    }
+  }
+
   void ModificationsDB::readFromOBOFile(const String& filename)
   {
     ResidueModification mod;
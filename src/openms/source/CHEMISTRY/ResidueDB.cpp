@@ -44,20 +44,15 @@ namespace OpenMS
       throw Exception::InvalidValue(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "No residue specified.", "");
     }
 
-    const Residue* r{};
-    #pragma omp critical (ResidueDB)
-    {   
-      auto it = residue_names_.find(name);
-      if (it != residue_names_.end()) 
-      { 
-        r = it->second; 
-      }
-    }
-    if (r == nullptr)
+    // no lock required here: only unmodified residues are indexed by name and
+    // all of them are created in the thread-safe constructor; modified
+    // residues are registered in residue_mod_names_ only
+    auto it = residue_names_.find(name);
+    if (it == residue_names_.end())
     {
       throw Exception::InvalidValue(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Residue not found: ", name);
     }
-    return r;
+    return it->second;
   }
 
   const Residue* ResidueDB::getResidue(const unsigned char& one_letter_code) const
@@ -69,12 +64,9 @@ namespace OpenMS
 
   Size ResidueDB::getNumberOfResidues() const
   {
-    Size s;
-    #pragma omp critical (ResidueDB)
-    {
-      s = const_residues_.size();
-    } 
-    return s;
+    // no lock required here: all unmodified residues are created in the
+    // thread-safe constructor
+    return const_residues_.size();
   }
 
   Size ResidueDB::getNumberOfModifiedResidues() const
@@ -89,17 +81,15 @@ namespace OpenMS
 
   const set<const Residue*> ResidueDB::getResidues(const String& residue_set) const
   {
+    // no lock required here: the residue sets are fixed after the thread-safe constructor
     set<const Residue*> s;
-    #pragma omp critical (ResidueDB)
+    auto it = residues_by_set_.find(residue_set);
+    if (it != residues_by_set_.end())
     {
-      auto it = residues_by_set_.find(residue_set);
-      if (it != residues_by_set_.end())
-      {
-        s = it->second;
-      }
-    } 
+      s = it->second;
+    }
 
-    if (s.empty()) 
+    if (s.empty())
     {
       cout << "Residue set cannot be found: '" + residue_set + "'" << endl;
     }
@@ -128,12 +118,9 @@ namespace OpenMS
 
   bool ResidueDB::hasResidue(const String& res_name) const
   {
-    bool found = false;
-    #pragma omp critical (ResidueDB)
-    {
-      found = residue_names_.find(res_name) != residue_names_.end();
-    }  
-    return found;
+    // no lock required here: the name index only contains the unmodified
+    // residues created in the thread-safe constructor
+    return residue_names_.find(res_name) != residue_names_.end();
   }
 
   bool ResidueDB::hasResidue(const Residue* residue) const
@@ -273,12 +260,8 @@ namespace OpenMS
 
   const set<String> ResidueDB::getResidueSets() const
   {
-    set<String> rs;
-    #pragma omp critical (ResidueDB)
-    {
-      rs = residue_sets_; 
-    }
-    return rs;
+    // no lock required here: the residue sets are fixed after the thread-safe constructor
+    return residue_sets_;
   }
 
   void ResidueDB::addModifiedResidueNames_(const Residue* r)
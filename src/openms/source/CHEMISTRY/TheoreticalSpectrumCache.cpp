@@ -0,0 +1,119 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CHEMISTRY/TheoreticalSpectrumCache.h>
+
+#include <functional>
+
+namespace OpenMS
+{
+
+  TheoreticalSpectrumCache::TheoreticalSpectrumCache(Size capacity, Size shards)
+  {
+    shards = std::max(shards, Size(1));
+    shards_.reserve(shards);
+    for (Size i = 0; i < shards; ++i)
+    {
+      shards_.push_back(std::make_unique<Shard>());
+    }
+    capacity_per_shard_ = std::max(capacity / shards, Size(1));
+  }
+
+  std::shared_ptr<const PeakSpectrum> TheoreticalSpectrumCache::getSpectrum(const TheoreticalSpectrumGenerator& generator,
+                                                                            const AASequence& peptide,
+                                                                            Int min_charge,
+                                                                            Int max_charge)
+  {
+    // the peptide string includes its modifications
+    std::string key = peptide.toString();
+    key += '/';
+    key += std::to_string(min_charge);
+    key += '/';
+    key += std::to_string(max_charge);
+
+    Shard& shard = shardFor_(key);
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      auto it = shard.index.find(key);
+      if (it != shard.index.end())
+      {
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return shard.lru.front().second;
+      }
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+
+    // generate outside the lock; other threads may generate the same spectrum
+    // concurrently, but the duplicate work is preferable to a lock around it
+    auto spec = std::make_shared<PeakSpectrum>();
+    generator.getSpectrum(*spec, peptide, min_charge, max_charge);
+    spec->sortByPosition();
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end())
+    {
+      return it->second->second; // another thread inserted it in the meantime
+    }
+    shard.lru.emplace_front(key, std::move(spec));
+    shard.index[shard.lru.front().first] = shard.lru.begin();
+    while (shard.lru.size() > capacity_per_shard_)
+    {
+      shard.index.erase(shard.lru.back().first);
+      shard.lru.pop_back();
+    }
+    return shard.lru.front().second;
+  }
+
+  UInt64 TheoreticalSpectrumCache::getHits() const
+  {
+    return hits_.load(std::memory_order_relaxed);
+  }
+
+  UInt64 TheoreticalSpectrumCache::getMisses() const
+  {
+    return misses_.load(std::memory_order_relaxed);
+  }
+
+  double TheoreticalSpectrumCache::getHitRate() const
+  {
+    const UInt64 hits = getHits();
+    const UInt64 total = hits + getMisses();
+    return total == 0 ? 0.0 : double(hits) / double(total);
+  }
+
+  Size TheoreticalSpectrumCache::size() const
+  {
+    Size n = 0;
+    for (const auto& shard : shards_)
+    {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      n += shard->lru.size();
+    }
+    return n;
+  }
+
+  void TheoreticalSpectrumCache::clear()
+  {
+    for (auto& shard : shards_)
+    {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->lru.clear();
+      shard->index.clear();
+    }
+    hits_.store(0, std::memory_order_relaxed);
+    misses_.store(0, std::memory_order_relaxed);
+  }
+
+  TheoreticalSpectrumCache::Shard& TheoreticalSpectrumCache::shardFor_(const std::string& key)
+  {
+    return *shards_[std::hash<std::string> {}(key) % shards_.size()];
+  }
+
+} // namespace OpenMS
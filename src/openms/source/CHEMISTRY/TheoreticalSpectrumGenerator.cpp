@@ -297,6 +297,43 @@ namespace OpenMS
     return theo_spectrum;
   }
 
+  void TheoreticalSpectrumGenerator::getBYIonMZs(const AASequence& peptide, std::vector<double>& b_ion_mzs, std::vector<double>& y_ion_mzs)
+  {
+    b_ion_mzs.clear();
+    y_ion_mzs.clear();
+    if (peptide.size() < 2)
+    {
+      return;
+    }
+    b_ion_mzs.reserve(peptide.size() - 1);
+    y_ion_mzs.reserve(peptide.size() - 1);
+
+    // same mass bookkeeping as addPeaks_(), restricted to singly charged b/y ions
+    static const double stat_b = Residue::getInternalToBIon().getMonoWeight();
+    static const double stat_y = Residue::getInternalToYIon().getMonoWeight();
+
+    double mono_weight(Constants::PROTON_MASS_U);
+    if (peptide.hasNTerminalModification())
+    {
+      mono_weight += peptide.getNTerminalModification()->getDiffMonoMass();
+    }
+    for (Size i = 0; i < peptide.size() - 1; ++i)
+    {
+      mono_weight += peptide[i].getMonoWeight(Residue::Internal);
+      b_ion_mzs.push_back(mono_weight + stat_b);
+    }
+
+    mono_weight = Constants::PROTON_MASS_U;
+    if (peptide.hasCTerminalModification())
+    {
+      mono_weight += peptide.getCTerminalModification()->getDiffMonoMass();
+    }
+    for (Size i = peptide.size() - 1; i > 0; --i)
+    {
+      mono_weight += peptide[i].getMonoWeight(Residue::Internal);
+      y_ion_mzs.push_back(mono_weight + stat_y);
+    }
+  }
 
   void TheoreticalSpectrumGenerator::addAbundantImmoniumIons_(PeakSpectrum& spectrum, const AASequence& peptide, DataArrays::StringDataArray& ion_names, DataArrays::IntegerDataArray& charges) const
   {
@@ -7,6 +7,7 @@ AASequence.cpp
 AdductInfo.cpp
 CrossLinksDB.cpp
 DecoyGenerator.cpp
+DigestCache.cpp
 Element.cpp
 ElementDB.cpp
 EmpiricalFormula.cpp
@@ -34,6 +35,7 @@ RibonucleotideDB.cpp
 SpectrumAnnotator.cpp
 SimpleTSGXLMS.cpp
 Tagger.cpp
+TheoreticalSpectrumCache.cpp
 TheoreticalSpectrumGenerator.cpp
 TheoreticalSpectrumGeneratorXLMS.cpp
 WeightWrapper.cpp
@@ -9,10 +9,136 @@
 
 #include <OpenMS/COMPARISON/CLUSTERING/ClusterHierarchical.h>
 
+#include <algorithm>
+
 //using namespace std;
 
 namespace OpenMS
 {
+  namespace
+  {
+    // finds the root of element i and its cluster representative (the lowest
+    // element index of the cluster), with path compression
+    Size findRoot_(std::vector<Size>& parent, Size i)
+    {
+      while (parent[i] != i)
+      {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+      }
+      return i;
+    }
+  }
+
+  void ClusterHierarchical::clusterSparse(SparseDistanceMatrix<float>& sparse_distance, std::vector<BinaryTreeNode>& cluster_tree) const
+  {
+    // attention: clustering process is done by clustering the indices
+    // pointing to elements in input vector and distances in the sparse store
+
+    // input MUST have >= 2 elements!
+    if (sparse_distance.dimensionsize() < 2)
+    {
+      throw ClusterFunctor::InsufficientInput(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Distance matrix to start from only contains one element");
+    }
+
+    const Size n = sparse_distance.dimensionsize();
+    cluster_tree.clear();
+    cluster_tree.reserve(n - 1);
+
+    // nearest-neighbor-chain: follow nearest neighbors until a reciprocal
+    // pair is found, merge it and continue from the remaining chain top.
+    // Single linkage is reducible, so merges never invalidate the chain.
+    // Each active cluster is addressed by the row slot of one of its elements.
+    std::vector<BinaryTreeNode> merges;
+    merges.reserve(n - 1);
+    std::vector<Size> chain;
+    chain.reserve(n);
+    std::vector<bool> merged_away(n, false);
+    for (Size seed = 0; seed < n; ++seed)
+    {
+      if (merged_away[seed] || sparse_distance.row(seed).empty())
+      {
+        continue;
+      }
+      chain.clear();
+      chain.push_back(seed);
+      while (!chain.empty())
+      {
+        const Size top = chain.back();
+        if (sparse_distance.row(top).empty())
+        {
+          // no neighbor below the cutoff left, cluster is final
+          chain.pop_back();
+          continue;
+        }
+        std::pair<Size, float> nearest = sparse_distance.nearestNeighbor(top);
+        if (chain.size() >= 2)
+        {
+          // prefer the predecessor on ties, so reciprocity is detected
+          const Size previous = chain[chain.size() - 2];
+          if (sparse_distance.hasValue(top, previous) && sparse_distance.getValue(top, previous) <= nearest.second)
+          {
+            nearest = std::make_pair(previous, sparse_distance.getValue(top, previous));
+          }
+        }
+        if (chain.size() >= 2 && nearest.first == chain[chain.size() - 2])
+        {
+          // reciprocal nearest neighbors: merge the smaller neighborhood into the larger
+          merges.emplace_back(std::min(top, nearest.first), std::max(top, nearest.first), nearest.second);
+          Size from = top, to = nearest.first;
+          if (sparse_distance.row(from).size() > sparse_distance.row(to).size())
+          {
+            std::swap(from, to);
+          }
+          sparse_distance.mergeRowsMin(from, to);
+          merged_away[from] = true;
+          chain.pop_back();
+          chain.pop_back();
+          if (chain.empty() && !sparse_distance.row(to).empty())
+          {
+            chain.push_back(to);
+          }
+        }
+        else
+        {
+          chain.push_back(nearest.first);
+        }
+      }
+    }
+
+    // the merges form a spanning forest, but the chain does not find them in
+    // ascending distance order: sort and replay them to get the strict
+    // BinaryTreeNode format (children are the lowest element indices of the
+    // merged clusters, nodes ordered by clustering step)
+    std::sort(merges.begin(), merges.end(), compareBinaryTreeNode);
+    std::vector<Size> parent(n), representative(n);
+    for (Size i = 0; i < n; ++i)
+    {
+      parent[i] = representative[i] = i;
+    }
+    for (const BinaryTreeNode& merge : merges)
+    {
+      const Size root_left = findRoot_(parent, merge.left_child);
+      const Size root_right = findRoot_(parent, merge.right_child);
+      cluster_tree.emplace_back(std::min(representative[root_left], representative[root_right]),
+                                std::max(representative[root_left], representative[root_right]),
+                                merge.distance);
+      parent[root_left] = root_right;
+      representative[root_right] = std::min(representative[root_left], representative[root_right]);
+    }
+
+    // fill tree with dummy nodes for clusters still apart at the cutoff
+    Size sad = representative[findRoot_(parent, 0)];
+    for (Size i = 1; i < n && (cluster_tree.size() < cluster_tree.capacity()); ++i)
+    {
+      const Size root = findRoot_(parent, i);
+      if (representative[root] == i) // i is the representative, i.e. a remaining cluster
+      {
+        cluster_tree.emplace_back(sad, i, -1.0);
+      }
+    }
+  }
+
   UnnormalizedComparator::UnnormalizedComparator(const char * file, int line, const char * function, const char * message) throw() :
     BaseException(file, line, function, "ClusterHierarchical::UnnormalizedComparator", message)
   {
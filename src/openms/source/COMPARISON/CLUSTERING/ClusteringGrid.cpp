@@ -32,28 +32,19 @@ std::vector<double> ClusteringGrid::getGridSpacingY() const
 
 void ClusteringGrid::addCluster(const CellIndex &cell_index, const int &cluster_index)
 {
-    if (cells_.find(cell_index) == cells_.end())
-    {
-        // If hash grid cell does not yet exist, create a new one.
-        std::list<int> clusters;
-        clusters.push_back(cluster_index);
-        cells_.insert(std::make_pair(cell_index, clusters));
-    }
-    else
-    {
-        // If hash grid cell already exists, add the new cluster index to the existing list of clusters.
-        cells_.find(cell_index)->second.push_back(cluster_index);
-    }
+    // creates the hash grid cell if it does not yet exist
+    cells_[cell_index].push_back(cluster_index);
 }
 
 void ClusteringGrid::removeCluster(const CellIndex &cell_index, const int &cluster_index)
 {
-    if (cells_.find(cell_index) != cells_.end())
+    auto it = cells_.find(cell_index);
+    if (it != cells_.end())
     {
-        cells_.find(cell_index)->second.remove(cluster_index);
-        if (cells_.find(cell_index)->second.empty())
+        it->second.remove(cluster_index);
+        if (it->second.empty())
         {
-            cells_.erase(cell_index);
+            cells_.erase(it);
         }
     }
 }
@@ -63,7 +54,12 @@ void ClusteringGrid::removeAllClusters()
     cells_.clear();
 }
 
-std::list<int> ClusteringGrid::getClusters(const CellIndex &cell_index) const
+void ClusteringGrid::reserve(std::size_t expected_cells)
+{
+    cells_.reserve(expected_cells);
+}
+
+const std::list<int>& ClusteringGrid::getClusters(const CellIndex &cell_index) const
 {
     return cells_.find(cell_index)->second;
 }
@@ -8,6 +8,8 @@
 
 #include <OpenMS/COMPARISON/CLUSTERING/GridBasedClustering.h>
 
+#include <tuple>
+
 using namespace std;
 
 namespace OpenMS
@@ -28,19 +30,21 @@ namespace OpenMS
     return  nearest_neighbour_index_;
   }
 
+  // The cluster index breaks ties between equal distances, so that the order in the
+  // minimum distance multiset (and hence the merge order) is deterministic.
   bool MinimumDistance::operator<(const MinimumDistance& other) const
   {
-    return distance_ < other.distance_;
+    return std::tie(distance_, cluster_index_) < std::tie(other.distance_, other.cluster_index_);
   }
-  
+
   bool MinimumDistance::operator>(const MinimumDistance& other) const
   {
-    return distance_ > other.distance_;
+    return std::tie(distance_, cluster_index_) > std::tie(other.distance_, other.cluster_index_);
   }
-  
+
   bool MinimumDistance::operator==(const MinimumDistance& other) const
   {
-    return distance_ == other.distance_;
+    return std::tie(distance_, cluster_index_) == std::tie(other.distance_, other.cluster_index_);
   }
 
 }
@@ -0,0 +1,222 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/COMPARISON/CLUSTERING/SpectrumClusteringEngine.h>
+
+#include <OpenMS/COMPARISON/SPECTRA/BinnedSpectrum.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+using namespace std;
+
+namespace OpenMS
+{
+  SpectrumClusteringEngine::SpectrumClusteringEngine() :
+    DefaultParamHandler("SpectrumClusteringEngine"),
+    ProgressLogger()
+  {
+    defaults_.setValue("bin_size", (double)BinnedSpectrum::DEFAULT_BIN_WIDTH_HIRES, "Bin size in Th used to discretize the fragment spectra");
+    defaults_.setMinFloat("bin_size", 0.0);
+    defaults_.setValue("bin_offset", (double)BinnedSpectrum::DEFAULT_BIN_OFFSET_HIRES, "Bin offset (see BinnedSpectrum)");
+    defaults_.setValue("precursor_mz_tolerance", 1.0, "Maximum precursor m/z difference (in Th) between two spectra considered as cluster candidates");
+    defaults_.setMinFloat("precursor_mz_tolerance", 0.0);
+    defaults_.setValue("min_cosine", 0.7, "Minimum cosine similarity of the binned spectra for two candidates to be merged into one cluster");
+    defaults_.setMinFloat("min_cosine", 0.0);
+    defaults_.setMaxFloat("min_cosine", 1.0);
+    defaults_.setValue("min_peaks", 5, "Spectra with fewer filled bins are not compared and stay singleton clusters");
+    defaults_.setMinInt("min_peaks", 1);
+    defaultsToParam_();
+  }
+
+  void SpectrumClusteringEngine::packSpectra_(const vector<PeakSpectrum>& spectra, CSRBinnedSpectra& packed) const
+  {
+    const double bin_size = param_.getValue("bin_size");
+    const double bin_offset = param_.getValue("bin_offset");
+    const Size n = spectra.size();
+
+    // bin each spectrum independently (see BinnedSpectrum::getBinIndex for the indexing scheme)
+    vector<vector<pair<Int, float> > > rows(n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+    for (SignedSize i = 0; i < (SignedSize)n; ++i)
+    {
+      vector<pair<Int, float> >& row = rows[i];
+      row.reserve(spectra[i].size());
+      for (const Peak1D& p : spectra[i])
+      {
+        row.emplace_back(Int(floor(p.getMZ() / bin_size + bin_offset)), p.getIntensity());
+      }
+      sort(row.begin(), row.end());
+
+      // sum up intensities falling into the same bin
+      Size out = 0;
+      for (Size k = 0; k < row.size(); ++k)
+      {
+        if (out > 0 && row[out - 1].first == row[k].first)
+        {
+          row[out - 1].second += row[k].second;
+        }
+        else
+        {
+          row[out++] = row[k];
+        }
+      }
+      row.resize(out);
+
+      // L2-normalize, so dot products directly yield cosine similarities
+      double norm(0);
+      for (const auto& b : row) { norm += (double)b.second * b.second; }
+      if (norm > 0)
+      {
+        const float inv_norm = float(1.0 / sqrt(norm));
+        for (auto& b : row) { b.second *= inv_norm; }
+      }
+    }
+
+    // concatenate the rows into the CSR structure
+    Size nnz(0);
+    for (const auto& row : rows) { nnz += row.size(); }
+    packed.bin_indices.clear();
+    packed.bin_indices.reserve(nnz);
+    packed.intensities.clear();
+    packed.intensities.reserve(nnz);
+    packed.row_offsets.clear();
+    packed.row_offsets.reserve(n + 1);
+    packed.row_offsets.push_back(0);
+    for (const auto& row : rows)
+    {
+      for (const auto& b : row)
+      {
+        packed.bin_indices.push_back(b.first);
+        packed.intensities.push_back(b.second);
+      }
+      packed.row_offsets.push_back(packed.bin_indices.size());
+    }
+  }
+
+  float SpectrumClusteringEngine::dotProduct_(const CSRBinnedSpectra& packed, Size a, Size b)
+  {
+    Size ia = packed.row_offsets[a];
+    Size ib = packed.row_offsets[b];
+    const Size ea = packed.row_offsets[a + 1];
+    const Size eb = packed.row_offsets[b + 1];
+    float dot(0);
+    while (ia < ea && ib < eb)
+    {
+      const Int bin_a = packed.bin_indices[ia];
+      const Int bin_b = packed.bin_indices[ib];
+      if (bin_a == bin_b)
+      {
+        dot += packed.intensities[ia] * packed.intensities[ib];
+        ++ia;
+        ++ib;
+      }
+      else if (bin_a < bin_b)
+      {
+        ++ia;
+      }
+      else
+      {
+        ++ib;
+      }
+    }
+    return dot;
+  }
+
+  Size SpectrumClusteringEngine::findRoot_(vector<Size>& parent, Size i)
+  {
+    while (parent[i] != i)
+    {
+      parent[i] = parent[parent[i]]; // path halving
+      i = parent[i];
+    }
+    return i;
+  }
+
+  vector<Size> SpectrumClusteringEngine::cluster(const vector<PeakSpectrum>& spectra) const
+  {
+    const double precursor_mz_tolerance = param_.getValue("precursor_mz_tolerance");
+    const float min_cosine = (float)(double)param_.getValue("min_cosine");
+    const Size min_peaks = (Size)(Int)param_.getValue("min_peaks");
+    const Size n = spectra.size();
+
+    CSRBinnedSpectra packed;
+    packSpectra_(spectra, packed);
+
+    // sort comparable spectra by precursor m/z; spectra without precursor
+    // or with too few filled bins stay singletons
+    vector<pair<double, Size> > by_precursor;
+    by_precursor.reserve(n);
+    for (Size i = 0; i < n; ++i)
+    {
+      if (!spectra[i].getPrecursors().empty() && packed.rowSize(i) >= min_peaks)
+      {
+        by_precursor.emplace_back(spectra[i].getPrecursors()[0].getMZ(), i);
+      }
+    }
+    sort(by_precursor.begin(), by_precursor.end());
+
+    // compare every spectrum against the precursor m/z window to its right;
+    // record matched pairs per spectrum, so the loop stays embarrassingly parallel
+    vector<vector<Size> > matches(n);
+    startProgress(0, by_precursor.size(), "clustering spectra");
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for (SignedSize k = 0; k < (SignedSize)by_precursor.size(); ++k)
+    {
+      setProgress(k);
+      const Size i = by_precursor[k].second;
+      for (Size l = k + 1; l < by_precursor.size()
+          && by_precursor[l].first - by_precursor[k].first <= precursor_mz_tolerance; ++l)
+      {
+        const Size j = by_precursor[l].second;
+        if (dotProduct_(packed, i, j) >= min_cosine)
+        {
+          matches[i].push_back(j);
+        }
+      }
+    }
+    endProgress();
+
+    // merge matched pairs into connected components
+    vector<Size> parent(n);
+    iota(parent.begin(), parent.end(), Size(0));
+    for (Size i = 0; i < n; ++i)
+    {
+      for (Size j : matches[i])
+      {
+        const Size root_i = findRoot_(parent, i);
+        const Size root_j = findRoot_(parent, j);
+        if (root_i != root_j)
+        {
+          parent[root_j] = root_i;
+        }
+      }
+    }
+
+    // relabel roots to consecutive cluster indices in order of first occurrence
+    vector<Size> result(n);
+    vector<Size> label(n, n);
+    Size n_clusters(0);
+    for (Size i = 0; i < n; ++i)
+    {
+      const Size root = findRoot_(parent, i);
+      if (label[root] == n)
+      {
+        label[root] = n_clusters++;
+      }
+      result[i] = label[root];
+    }
+    return result;
+  }
+
+}
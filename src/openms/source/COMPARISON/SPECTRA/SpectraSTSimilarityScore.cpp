@@ -98,6 +98,35 @@ namespace OpenMS
     return bin;
   }
 
+  std::vector<std::pair<Size, double>> SpectraSTSimilarityScore::score(const BinnedSpectrum & query, const std::vector<BinnedSpectrum> & library, Size top_k) const
+  {
+    // keep the k best hits in a min-heap on the score, so each of the n library
+    // comparisons costs at most O(log k) bookkeeping instead of sorting all n scores
+    auto worse_score = [](const std::pair<Size, double> & a, const std::pair<Size, double> & b)
+    {
+      return a.second > b.second;
+    };
+    std::vector<std::pair<Size, double>> hits;
+    hits.reserve(top_k + 1);
+    for (Size i = 0; i < library.size(); ++i)
+    {
+      const double dot_product = query.getBins()->dot(*library[i].getBins());
+      if (hits.size() < top_k)
+      {
+        hits.emplace_back(i, dot_product);
+        std::push_heap(hits.begin(), hits.end(), worse_score);
+      }
+      else if (!hits.empty() && dot_product > hits.front().second)
+      {
+        std::pop_heap(hits.begin(), hits.end(), worse_score);
+        hits.back() = std::make_pair(i, dot_product);
+        std::push_heap(hits.begin(), hits.end(), worse_score);
+      }
+    }
+    std::sort_heap(hits.begin(), hits.end(), worse_score); // ascending by 'worse_score' == descending by score
+    return hits;
+  }
+
   double SpectraSTSimilarityScore::dot_bias(const BinnedSpectrum & bin1, const BinnedSpectrum & bin2, double dot_product) const
   {
     double numerator = (bin1.getBins()->cwiseProduct(*bin2.getBins())).norm();
@@ -661,6 +661,8 @@ namespace OpenMS::Internal::ClassTest
         fsc.setAcceptableRelative(ratio_max_allowed);
         fsc.setVerboseLevel(2);
         fsc.setWhitelist(whitelist);
+        // digests first; the line-by-line diff only runs on digest mismatch
+        fsc.setCompareDigestFirst(true);
         std::ostringstream os;
         fsc.setLogDestination(os);
         fsc.use_prefix_ = true;
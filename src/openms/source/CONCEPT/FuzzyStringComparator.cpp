@@ -12,6 +12,8 @@
 #include <OpenMS/FORMAT/TextFile.h>
 #include <OpenMS/SYSTEM/File.h>
 #include <QtCore/QDir>
+#include <cmath>
+#include <cstdlib>
 #include <fstream>
 #include <istream>
 #include <iomanip>
@@ -46,6 +48,7 @@ namespace OpenMS
     first_column_(1),
     is_status_success_(true),
     use_prefix_(false),
+    compare_digest_first_(false),
     whitelist_(),
     whitelist_cases_()
   {
@@ -107,6 +110,16 @@ namespace OpenMS
     return matched_whitelist_;
   }
 
+  bool FuzzyStringComparator::getCompareDigestFirst() const
+  {
+    return compare_digest_first_;
+  }
+
+  void FuzzyStringComparator::setCompareDigestFirst(bool rhs)
+  {
+    compare_digest_first_ = rhs;
+  }
+
   const int& FuzzyStringComparator::getVerboseLevel() const
   {
     return verbose_level_;
@@ -520,6 +533,109 @@ namespace OpenMS
     return is_status_success_;
   } // compareLines_()
 
+  void FuzzyStringComparator::digestStream(std::istream& input, StreamDigest& digest) const
+  {
+    std::string line;
+    int line_number = 0;
+
+    while (input)
+    {
+      readNextLine_(input, line, line_number);
+      if (line.empty())
+      {
+        break; // end of input (readNextLine_ skips empty lines)
+      }
+
+      const char* pos = line.c_str();
+      const char* const end = pos + line.size();
+      while (pos != end)
+      {
+        const unsigned char c = (unsigned char)*pos;
+        if (isspace(c))
+        {
+          ++pos;
+          continue;
+        }
+        if (isdigit(c) || c == '+' || c == '-' || c == '.')
+        {
+          // candidate number; strtod accepts the same tokens as the
+          // stream extraction used by the line-by-line comparison
+          char* number_end = nullptr;
+          const double number = strtod(pos, &number_end);
+          if (number_end != pos)
+          {
+            Int magnitude = 0;
+            const double abs_number = std::fabs(number);
+            if (abs_number > 0.0)
+            {
+              magnitude = (Int)std::floor(std::log10(abs_number));
+            }
+            StreamDigest::Bucket& bucket = digest.buckets[magnitude];
+            ++bucket.count;
+            bucket.sum += number;
+            if (number < bucket.min) bucket.min = number;
+            if (number > bucket.max) bucket.max = number;
+            pos = number_end;
+            continue;
+          }
+        }
+        // non-numeric content: fold into the hash (FNV-1a)
+        digest.text_hash = (digest.text_hash ^ (UInt64)c) * 0x100000001b3ull;
+        ++pos;
+      }
+    }
+  } // digestStream()
+
+  bool FuzzyStringComparator::digestsSimilar(const StreamDigest& d1, const StreamDigest& d2) const
+  {
+    if (d1.text_hash != d2.text_hash)
+    {
+      return false;
+    }
+    if (d1.buckets.size() != d2.buckets.size())
+    {
+      return false;
+    }
+
+    // acceptable if within the absolute OR the relative tolerance,
+    // like a single pair of numbers in the line-by-line comparison
+    auto similar = [this](double number_1, double number_2) -> bool
+    {
+      if (std::fabs(number_1 - number_2) <= absdiff_max_allowed_)
+      {
+        return true;
+      }
+      if ((number_1 <= 0.0) != (number_2 <= 0.0))
+      {
+        return false;
+      }
+      double ratio = number_1 / number_2;
+      if (ratio < 1.0)
+      {
+        ratio = 1.0 / ratio;
+      }
+      return ratio <= ratio_max_allowed_;
+    };
+
+    std::map<Int, StreamDigest::Bucket>::const_iterator it_1 = d1.buckets.begin();
+    std::map<Int, StreamDigest::Bucket>::const_iterator it_2 = d2.buckets.begin();
+    for (; it_1 != d1.buckets.end(); ++it_1, ++it_2)
+    {
+      if (it_1->first != it_2->first || it_1->second.count != it_2->second.count)
+      {
+        return false;
+      }
+      if (!similar(it_1->second.min, it_2->second.min) ||
+          !similar(it_1->second.max, it_2->second.max) ||
+          !similar(it_1->second.sum / (double)it_1->second.count,
+                   it_2->second.sum / (double)it_2->second.count))
+      {
+        return false;
+      }
+    }
+    return true;
+  } // digestsSimilar()
+
   bool FuzzyStringComparator::compareStrings(std::string const& lhs, std::string const& rhs)
   {
     std::istringstream input_1(lhs);
@@ -609,6 +725,33 @@ namespace OpenMS
       return false;
     }
 
+    //------------------------------------------------------------
+    // digest fast path: one cheap streaming pass per file; only run the
+    // synchronized line-by-line comparison if the digests disagree
+    // (whitelists skip lines pairwise, which a digest cannot model)
+
+    if (compare_digest_first_ && whitelist_.empty() && matched_whitelist_.empty())
+    {
+      StreamDigest digest_1;
+      StreamDigest digest_2;
+      digestStream(input_1_f, digest_1);
+      digestStream(input_2_f, digest_2);
+      if (digestsSimilar(digest_1, digest_2))
+      {
+        if (verbose_level_ >= 2)
+        {
+          *log_dest_ << (use_prefix_ ? "   :|:  " : "") <<
+            "PASSED (digests agree, line-by-line comparison skipped).\n";
+        }
+        return true;
+      }
+      // rewind for the precise comparison, which also produces the report
+      input_1_f.clear();
+      input_1_f.seekg(0);
+      input_2_f.clear();
+      input_2_f.seekg(0);
+    }
+
     //------------------------------------------------------------
     // main loop
 
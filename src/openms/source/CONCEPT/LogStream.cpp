@@ -228,8 +228,6 @@ namespace OpenMS
           char *line_start = pbase();
           char *line_end = pbase();
 
-          static char buf[BUFFER_LENGTH];
-
           while (line_end < pptr())
           {
             // search for the first end of line
@@ -239,31 +237,19 @@ namespace OpenMS
 
             if (line_end >= pptr())
             {
-              // Copy the incomplete line to the incomplete_line_ buffer
-              size_t length = line_end - line_start;
-              length = std::min(length, (size_t) (BUFFER_LENGTH - 1));
-              strncpy(&(buf[0]), line_start, length);
-
-              // if length was too large, we copied one byte less than BUFFER_LENGTH to have
-              // room for the final \0
-              buf[length] = '\0';
-
-              incomplete_line_ += &(buf[0]);
+              // append the incomplete line to the incomplete_line_ buffer
+              incomplete_line_.append(line_start, line_end - line_start);
 
               // mark everything as read
               line_end = pptr() + 1;
             }
             else
             {
-              // note: pptr() - pbase() should be bounded by BUFFER_LENGTH, so this should always work
-              memcpy(&(buf[0]), line_start, line_end - line_start + 1);
-              buf[line_end - line_start] = '\0';
-
-              // assemble the string to be written
+              // assemble the string to be written, without the trailing '\n'
               // (consider leftovers of the last buffer from incomplete_line_)
               std::string outstring;
               std::swap(outstring, incomplete_line_); // init outstring, while resetting incomplete_line_
-              outstring += &(buf[0]);
+              outstring.append(line_start, line_end - line_start);
 
               // avoid adding empty lines to the cache
               if (outstring.empty())
@@ -544,6 +530,23 @@ namespace OpenMS
       std::ostream::flush();
     }
 
+    LogLineBuffer::LogLineBuffer(LogStream& log) :
+      log_(log)
+    {
+    }
+
+    LogLineBuffer::~LogLineBuffer()
+    {
+      // the message was assembled in the thread-private buffer_; only the
+      // hand-over to the shared stream buffer needs to be synchronized
+      const std::string text = buffer_.str();
+      OPENMS_THREAD_CRITICAL(LOGSTREAM)
+      {
+        log_ << text;
+        log_.flush(); // distribute complete lines right away; partial text is kept in incomplete_line_
+      }
+    }
+
   }   // namespace Logger
 
 
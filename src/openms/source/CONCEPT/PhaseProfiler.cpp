@@ -0,0 +1,146 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/PhaseProfiler.h>
+
+#include <OpenMS/CONCEPT/LogStream.h>
+#include <OpenMS/SYSTEM/SysInfo.h>
+
+#include <nlohmann/json.hpp>
+
+#include <cstdlib> // for getenv and atexit
+#include <fstream>
+
+using namespace std;
+
+namespace OpenMS
+{
+  namespace
+  {
+    void dumpPhaseProfileAtExit()
+    {
+      PhaseProfiler::getInstance()->dump();
+    }
+  }
+
+  PhaseProfiler* PhaseProfiler::instance_ = nullptr;
+
+  PhaseProfiler* PhaseProfiler::getInstance()
+  {
+    if (PhaseProfiler::instance_ == nullptr)
+    {
+      PhaseProfiler::instance_ = new PhaseProfiler();
+    }
+    return PhaseProfiler::instance_;
+  }
+
+  PhaseProfiler::PhaseProfiler()
+  {
+    const char* filename = getenv("OPENMS_PHASE_PROFILE");
+    if (filename != nullptr && filename[0] != '\0')
+    {
+      enable(filename);
+    }
+  }
+
+  void PhaseProfiler::enable(const String& filename)
+  {
+    lock_guard<mutex> lock(mutex_);
+    filename_ = filename;
+    if (!enabled_)
+    {
+      enabled_ = true;
+      atexit(dumpPhaseProfileAtExit);
+    }
+  }
+
+  void PhaseProfiler::startPhase(const String& label)
+  {
+    if (!enabled_)
+    {
+      return;
+    }
+    lock_guard<mutex> lock(mutex_);
+    PhaseRecord_ record;
+    record.label = label;
+    record.depth = stack_.size();
+    record.wall_time = -1.0; // marks the phase as incomplete until endPhase()
+    record.cpu_time = 0.0;
+    record.mem_kb = 0;
+    record.mem_peak_kb = 0;
+    records_.push_back(std::move(record));
+
+    OpenPhase_ phase;
+    phase.record_index = records_.size() - 1;
+    stack_.push_back(std::move(phase));
+    stack_.back().watch.start();
+  }
+
+  void PhaseProfiler::endPhase()
+  {
+    if (!enabled_)
+    {
+      return;
+    }
+    lock_guard<mutex> lock(mutex_);
+    if (stack_.empty())
+    {
+      return; // unbalanced call; ignore
+    }
+    OpenPhase_& phase = stack_.back();
+    phase.watch.stop();
+
+    PhaseRecord_& record = records_[phase.record_index];
+    record.wall_time = phase.watch.getClockTime();
+    record.cpu_time = phase.watch.getCPUTime();
+    SysInfo::getProcessMemoryConsumption(record.mem_kb); // sets 0 on failure
+    SysInfo::getProcessPeakMemoryConsumption(record.mem_peak_kb);
+
+    stack_.pop_back();
+  }
+
+  void PhaseProfiler::dump() const
+  {
+    lock_guard<mutex> lock(mutex_);
+    if (!enabled_ || filename_.empty())
+    {
+      return;
+    }
+
+    using json = nlohmann::ordered_json;
+    json out;
+    out["phases"] = json::array();
+    for (const PhaseRecord_& record : records_)
+    {
+      if (record.wall_time < 0.0)
+      {
+        continue; // phase was never ended (e.g. tool aborted); skip
+      }
+      json phase;
+      phase["label"] = std::string(record.label);
+      phase["depth"] = record.depth;
+      phase["wall_time"] = record.wall_time;
+      phase["cpu_time"] = record.cpu_time;
+      phase["mem_kb"] = record.mem_kb;
+      phase["mem_peak_kb"] = record.mem_peak_kb;
+      out["phases"].push_back(phase);
+    }
+    size_t mem_peak(0);
+    SysInfo::getProcessPeakMemoryConsumption(mem_peak);
+    out["mem_peak_kb"] = mem_peak;
+
+    ofstream os(filename_.c_str());
+    if (!os)
+    {
+      OPENMS_LOG_ERROR << "PhaseProfiler: cannot write profile to '" << filename_ << "'" << endl;
+      return;
+    }
+    os << out.dump(2) << "\n";
+  }
+
+} // namespace OpenMS
@@ -0,0 +1,82 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/TaskPool.h>
+
+namespace OpenMS
+{
+#ifdef _OPENMP
+  namespace
+  {
+    // thread budget before enableNestedParallelism(), restored by disableNestedParallelism()
+    int previous_thread_budget = -1;
+  }
+#endif
+
+  int TaskPool::numberOfThreads()
+  {
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+  }
+
+  void TaskPool::setNumberOfThreads(int threads)
+  {
+#ifdef _OPENMP
+    omp_set_num_threads(std::max(1, threads));
+#else
+    (void)threads;
+#endif
+  }
+
+  bool TaskPool::inParallelRegion()
+  {
+#ifdef _OPENMP
+    return omp_in_parallel() != 0;
+#else
+    return false;
+#endif
+  }
+
+  int TaskPool::enableNestedParallelism(int outer_threads)
+  {
+#ifdef _OPENMP
+    const int total = omp_get_max_threads();
+    previous_thread_budget = total;
+    outer_threads = std::max(1, std::min(outer_threads, total));
+    omp_set_nested(1);
+    omp_set_num_threads(outer_threads);
+    return std::max(1, total / outer_threads);
+#else
+    (void)outer_threads;
+    return 1;
+#endif
+  }
+
+  void TaskPool::disableNestedParallelism()
+  {
+#ifdef _OPENMP
+    omp_set_nested(0);
+    if (previous_thread_budget > 0)
+    {
+      omp_set_num_threads(previous_thread_budget);
+      previous_thread_budget = -1;
+    }
+#endif
+  }
+
+  void TaskPool::parallelInvoke(const std::vector<std::function<void()>>& tasks)
+  {
+    parallelFor(0, static_cast<SignedSize>(tasks.size()), 1, [&tasks](SignedSize i) {
+      tasks[i]();
+    });
+  }
+
+} // namespace OpenMS
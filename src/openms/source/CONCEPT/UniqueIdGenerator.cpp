@@ -9,92 +9,99 @@
 #include <OpenMS/CONCEPT/UniqueIdGenerator.h>
 
 #include <boost/date_time/posix_time/posix_time_types.hpp> //no i/o just types
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int.hpp>
+
+#include <limits>
+#include <mutex>
 
 namespace OpenMS
 {
-  UInt64 UniqueIdGenerator::seed_ = 0;
-  UniqueIdGenerator* UniqueIdGenerator::instance_ = nullptr;
-  boost::mt19937_64* UniqueIdGenerator::rng_ = nullptr;
-  boost::uniform_int<UInt64>* UniqueIdGenerator::dist_ = nullptr;
+  std::atomic<UInt64> UniqueIdGenerator::seed_(0);
+  std::atomic<UInt32> UniqueIdGenerator::seed_version_(0);
+  std::atomic<UInt32> UniqueIdGenerator::thread_counter_(0);
+
+  namespace
+  {
+    /// Per-thread generator state; re-seeded whenever the global seed version changes
+    struct ThreadLocalRng
+    {
+      boost::mt19937_64 rng;
+      UInt32 seed_version = 0; // 0 = not seeded yet
+    };
+  }
 
   UInt64 UniqueIdGenerator::getUniqueId()
   {
-    UniqueIdGenerator& instance = getInstance_();
-#ifdef _OPENMP
-    UInt64 val;
-#pragma omp critical (OPENMS_UniqueIdGenerator_getUniqueId)
+    ensureInitialized_();
+
+    // ordinal of this thread, assigned on its first call
+    thread_local const UInt32 thread_ordinal = thread_counter_.fetch_add(1, std::memory_order_relaxed);
+    thread_local ThreadLocalRng state;
+
+    const UInt32 version = seed_version_.load(std::memory_order_acquire);
+    if (state.seed_version != version)
     {
-      val = (*instance.dist_)(*instance.rng_);
+      // Derive a per-thread stream from the base seed. The first thread (in
+      // tests and single-threaded tools: the only thread) uses the base seed
+      // unchanged, which keeps the id sequence identical to the one produced
+      // by the former shared, lock-protected generator.
+      UInt64 thread_seed = seed_.load(std::memory_order_relaxed);
+      if (thread_ordinal != 0)
+      {
+        thread_seed ^= 0x9e3779b97f4a7c15ULL * (UInt64(thread_ordinal) + 1); // golden-ratio scramble
+      }
+      state.rng.seed(thread_seed);
+      state.seed_version = version;
     }
-    // note: OpenMP can only work on a structured block, return needs to be outside that block
-    return val; 
-#else
-    return (*instance.dist_)(*instance.rng_);
-#endif
+
+    static const boost::uniform_int<UInt64> dist(0, std::numeric_limits<UInt64>::max());
+    return dist(state.rng);
   }
 
   UInt64 UniqueIdGenerator::getSeed()
   {
-    return getInstance_().seed_;
+    ensureInitialized_();
+    return seed_.load(std::memory_order_relaxed);
   }
 
   void UniqueIdGenerator::setSeed(UInt64 seed)
   {
-  // modifies static members
-#ifdef _OPENMP
-#pragma omp critical (OPENMS_UniqueIdGenerator_setSeed)
-#endif
+    seed_.store(seed, std::memory_order_relaxed);
+    // invalidate all thread-local generators (version 0 is reserved for "uninitialized")
+    if (seed_version_.fetch_add(1, std::memory_order_release) + 1 == 0)
     {
-      UniqueIdGenerator& instance = getInstance_();
-      instance.seed_ = seed;
-      instance.rng_->seed( instance.seed_ );
-      instance.dist_->reset();
+      seed_version_.fetch_add(1, std::memory_order_release);
     }
   }
 
-  UniqueIdGenerator::UniqueIdGenerator() = default;
-
-  UniqueIdGenerator & UniqueIdGenerator::getInstance_()
+  void UniqueIdGenerator::ensureInitialized_()
   {
-  // modifies static members
-#ifdef _OPENMP
-#pragma omp critical (OPENMS_UniqueIdGenerator_getInstance_)
-#endif
+    if (seed_version_.load(std::memory_order_acquire) != 0)
     {
-      if (!instance_)
+      return;
+    }
+    static std::once_flag init_flag;
+    std::call_once(init_flag, []()
+    {
+      if (seed_version_.load(std::memory_order_acquire) != 0)
       {
-        instance_ = new UniqueIdGenerator();
-        instance_->init_();
+        return; // setSeed() won the race
       }
-    }
-    return *instance_;
-  }
-
-  void UniqueIdGenerator::init_()
-  {
-  // modifies static members
-#ifdef _OPENMP
-#pragma omp critical (OPENMS_UniqueIdGenerator_init_)
-#endif
-    { 
       // find a seed:
       // get something with high resolution (around microseconds) -- its hard to do better on Windows --
-      // which has absolute system time (there is higher resolution available for the time since program startup, but 
+      // which has absolute system time (there is higher resolution available for the time since program startup, but
       // we do not want this here since this seed usually gets initialized at the same program uptime).
       // Reason for high-res: in pipelines, instances of TOPP tools can get initialized almost simultaneously (i.e., resolution in seconds is not enough),
       // leading to identical random numbers (e.g. feature-IDs) in two or more distinct files.
-      // C++11 note: C++ build-in alternative once C++11 can be presumed: 'std::chrono::high_resolution_clock'
       boost::posix_time::ptime t(boost::posix_time::microsec_clock::local_time() );
-      seed_ = t.time_of_day().ticks();  // independent of implementation; as opposed to nanoseconds(), which need not be available on every platform
-      rng_ = new boost::mt19937_64 (seed_);
-      dist_ = new boost::uniform_int<UInt64> (0, std::numeric_limits<UInt64>::max());
-    }
+      seed_.store(t.time_of_day().ticks(), std::memory_order_relaxed);  // independent of implementation; as opposed to nanoseconds(), which need not be available on every platform
+      seed_version_.store(1, std::memory_order_release);
+    });
   }
 
-  UniqueIdGenerator::~UniqueIdGenerator()
-  {
-    delete rng_;
-    delete dist_;
-  }
+  UniqueIdGenerator::UniqueIdGenerator() = default;
+
+  UniqueIdGenerator::~UniqueIdGenerator() = default;
 
 }
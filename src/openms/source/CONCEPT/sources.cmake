@@ -13,10 +13,12 @@ GlobalExceptionHandler.cpp
 Init.cpp
 LogConfigHandler.cpp
 LogStream.cpp
+PhaseProfiler.cpp
 PrecisionWrapper.cpp
 ProgressLogger.cpp
 RAIICleanup.cpp
 StreamHandler.cpp
+TaskPool.cpp
 Types.cpp
 UniqueIdGenerator.cpp
 UniqueIdIndexer.cpp
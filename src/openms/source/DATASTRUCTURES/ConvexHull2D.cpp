@@ -229,6 +229,31 @@ namespace OpenMS
     return saved_points;
   }
 
+  bool ConvexHull2D::compact()
+  {
+    if (!map_points_.empty())
+    {
+      return true; // already stored compactly (any outer points are just the lazy cache)
+    }
+    if (outer_points_.empty())
+    {
+      return true; // nothing to store
+    }
+
+    // rebuild the per-scan m/z ranges from the points and check that walking
+    // them (see getHullPoints()) yields exactly the points we started from
+    ConvexHull2D candidate;
+    candidate.addPoints(outer_points_);
+    if (candidate.getHullPoints() == outer_points_)
+    {
+      map_points_ = std::move(candidate.map_points_);
+      outer_points_.clear(); // lazily regenerated by getHullPoints()
+      return true;
+    }
+
+    return false; // not a scan-walk shape (e.g. legacy true convex hull)
+  }
+
   bool ConvexHull2D::encloses(const PointType& point) const
   {
     if ((map_points_.empty()) && !outer_points_.empty()) // we cannot answer the query as we lack the internal data structure
@@ -13,6 +13,7 @@
 
 #include <QtCore/QString>
 
+#include <new> // for placement new (string values are stored inline in the union)
 #include <sstream>
 
 using namespace std;
@@ -118,25 +119,31 @@ namespace OpenMS
   DataValue::DataValue(const char* p) :
     value_type_(STRING_VALUE), unit_type_(OTHER), unit_(-1)
   {
-    data_.str_ = new String(p);
+    new (&data_.str_) String(p);
   }
 
   DataValue::DataValue(const string& p) :
     value_type_(STRING_VALUE), unit_type_(OTHER), unit_(-1)
   {
-    data_.str_ = new String(p);
+    new (&data_.str_) String(p);
   }
 
   DataValue::DataValue(const QString& p) :
     value_type_(STRING_VALUE), unit_type_(OTHER), unit_(-1)
   {
-    data_.str_ = new String(p);
+    new (&data_.str_) String(p);
   }
 
   DataValue::DataValue(const String& p) :
     value_type_(STRING_VALUE), unit_type_(OTHER), unit_(-1)
   {
-    data_.str_ = new String(p);
+    new (&data_.str_) String(p);
+  }
+
+  DataValue::DataValue(String&& p) noexcept :
+    value_type_(STRING_VALUE), unit_type_(OTHER), unit_(-1)
+  {
+    new (&data_.str_) String(std::move(p));
   }
 
   DataValue::DataValue(const StringList& p) :
@@ -145,6 +152,12 @@ namespace OpenMS
     data_.str_list_ = new StringList(p);
   }
 
+  DataValue::DataValue(StringList&& p) :
+    value_type_(STRING_LIST), unit_type_(OTHER), unit_(-1)
+  {
+    data_.str_list_ = new StringList(std::move(p));
+  }
+
   DataValue::DataValue(const IntList& p) :
     value_type_(INT_LIST), unit_type_(OTHER), unit_(-1)
   {
@@ -175,7 +188,7 @@ namespace OpenMS
     break;
     case ParamValue::STRING_VALUE:
         value_type_ = STRING_VALUE;
-        data_.str_ = new String(p.toChar());
+        new (&data_.str_) String(p.toChar());
     break;
     case ParamValue::INT_LIST:
         value_type_ = INT_LIST;
@@ -198,12 +211,11 @@ namespace OpenMS
   DataValue::DataValue(const DataValue& p) :
     value_type_(p.value_type_),
     unit_type_(p.unit_type_),
-    unit_(p.unit_),
-    data_(p.data_)
+    unit_(p.unit_)
   {
     if (value_type_ == STRING_VALUE)
     {
-      data_.str_ = new String(*(p.data_.str_));
+      new (&data_.str_) String(p.data_.str_);
     }
     else if (value_type_ == STRING_LIST)
     {
@@ -217,21 +229,58 @@ namespace OpenMS
     {
       data_.dou_list_ = new DoubleList(*(p.data_.dou_list_));
     }
+    else if (value_type_ == INT_VALUE)
+    {
+      data_.ssize_ = p.data_.ssize_;
+    }
+    else if (value_type_ == DOUBLE_VALUE)
+    {
+      data_.dou_ = p.data_.dou_;
+    }
   }
 
   DataValue::DataValue(DataValue&& rhs) noexcept :
-    value_type_(std::move(rhs.value_type_)),
-    unit_type_(std::move(rhs.unit_type_)),
-    unit_(std::move(rhs.unit_)),
-    data_(std::move(rhs.data_))
+    value_type_(rhs.value_type_),
+    unit_type_(rhs.unit_type_),
+    unit_(rhs.unit_)
   {
-    // clean up rhs, take ownership of data_
-    // NOTE: value_type_ == EMPTY_VALUE implies data_ is empty and can be reset
+    // take ownership of rhs' data and leave it in the EMPTY state
+    moveData_(std::move(rhs));
     rhs.value_type_ = EMPTY_VALUE;
     rhs.unit_type_ = OTHER;
     rhs.unit_ = -1;
   }
 
+  // precondition: the union of *this holds no constructed member (cleared or uninitialized)
+  void DataValue::moveData_(DataValue&& rhs) noexcept
+  {
+    if (rhs.value_type_ == STRING_VALUE)
+    {
+      new (&data_.str_) String(std::move(rhs.data_.str_));
+      rhs.data_.str_.~String();
+    }
+    else if (rhs.value_type_ == STRING_LIST)
+    {
+      data_.str_list_ = rhs.data_.str_list_;
+    }
+    else if (rhs.value_type_ == INT_LIST)
+    {
+      data_.int_list_ = rhs.data_.int_list_;
+    }
+    else if (rhs.value_type_ == DOUBLE_LIST)
+    {
+      data_.dou_list_ = rhs.data_.dou_list_;
+    }
+    else if (rhs.value_type_ == INT_VALUE)
+    {
+      data_.ssize_ = rhs.data_.ssize_;
+    }
+    else if (rhs.value_type_ == DOUBLE_VALUE)
+    {
+      data_.dou_ = rhs.data_.dou_;
+    }
+  }
+
   void DataValue::clear_() noexcept
   {
     if (value_type_ == STRING_LIST)
@@ -240,7 +289,7 @@ namespace OpenMS
     }
     else if (value_type_ == STRING_VALUE)
     {
-      delete(data_.str_);
+      data_.str_.~String();
     }
     else if (value_type_ == INT_LIST)
     {
@@ -277,7 +326,7 @@ namespace OpenMS
     }
     else if (p.value_type_ == STRING_VALUE)
     {
-      data_.str_ = new String(*(p.data_.str_));
+      new (&data_.str_) String(p.data_.str_);
     }
     else if (p.value_type_ == INT_LIST)
     {
@@ -287,9 +336,13 @@ namespace OpenMS
     {
       data_.dou_list_ = new DoubleList(*(p.data_.dou_list_));
     }
-    else
+    else if (p.value_type_ == INT_VALUE)
+    {
+      data_.ssize_ = p.data_.ssize_;
+    }
+    else if (p.value_type_ == DOUBLE_VALUE)
     {
-      data_ = p.data_;
+      data_.dou_ = p.data_.dou_;
     }
 
     // copy type
@@ -313,12 +366,12 @@ namespace OpenMS
     clear_();
 
     // assign values to *this
-    data_ = rhs.data_;
+    moveData_(std::move(rhs));
     value_type_ = rhs.value_type_;
     unit_type_ = rhs.unit_type_;
     unit_ = rhs.unit_;
 
-    // clean up rhs 
+    // clean up rhs
     rhs.value_type_ = EMPTY_VALUE;
     rhs.unit_type_ = OTHER;
     rhs.unit_ = -1;
@@ -333,7 +386,7 @@ namespace OpenMS
   DataValue& DataValue::operator=(const char* arg)
   {
     clear_();
-    data_.str_ = new String(arg);
+    new (&data_.str_) String(arg);
     value_type_ = STRING_VALUE;
     return *this;
   }
@@ -341,7 +394,7 @@ namespace OpenMS
   DataValue& DataValue::operator=(const std::string& arg)
   {
     clear_();
-    data_.str_ = new String(arg);
+    new (&data_.str_) String(arg);
     value_type_ = STRING_VALUE;
     return *this;
   }
@@ -349,7 +402,15 @@ namespace OpenMS
   DataValue& DataValue::operator=(const String& arg)
   {
     clear_();
-    data_.str_ = new String(arg);
+    new (&data_.str_) String(arg);
+    value_type_ = STRING_VALUE;
+    return *this;
+  }
+
+  DataValue& DataValue::operator=(String&& arg) noexcept
+  {
+    clear_();
+    new (&data_.str_) String(std::move(arg));
     value_type_ = STRING_VALUE;
     return *this;
   }
@@ -357,7 +418,7 @@ namespace OpenMS
   DataValue& DataValue::operator=(const QString& arg)
   {
     clear_();
-    data_.str_ = new String(arg);
+    new (&data_.str_) String(arg);
     value_type_ = STRING_VALUE;
     return *this;
   }
@@ -370,6 +431,14 @@ namespace OpenMS
     return *this;
   }
 
+  DataValue& DataValue::operator=(StringList&& arg)
+  {
+    clear_();
+    data_.str_list_ = new StringList(std::move(arg));
+    value_type_ = STRING_LIST;
+    return *this;
+  }
+
   DataValue& DataValue::operator=(const IntList& arg)
   {
     clear_();
@@ -652,7 +721,7 @@ namespace OpenMS
       throw Exception::ConversionError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, 
         "Could not convert non-string DataValue of type '" + NamesOfDataType[value_type_] + "' and value '" + this->toString(true) + "' to string");
     }
-    return *(data_.str_);
+    return data_.str_;
   }
 
   DataValue::operator StringList() const
@@ -676,7 +745,7 @@ namespace OpenMS
     switch (value_type_)
     {
     case DataValue::STRING_VALUE: 
-      return const_cast<const char*>(data_.str_->c_str());
+      return const_cast<const char*>(data_.str_.c_str());
 
     case DataValue::EMPTY_VALUE: 
       return nullptr;
@@ -726,7 +795,7 @@ namespace OpenMS
       case DataValue::EMPTY_VALUE: 
         break;
       case DataValue::STRING_VALUE: 
-        return *(data_.str_);
+        return data_.str_;
       case DataValue::STRING_LIST: ss << *(data_.str_list_); 
         break;
       case DataValue::INT_LIST: ss << *(data_.int_list_); 
@@ -766,14 +835,14 @@ namespace OpenMS
       throw Exception::ConversionError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, 
         "Could not convert non-string DataValue of type '" + NamesOfDataType[value_type_] + "' and value '" + this->toString(true) + "' to bool");
     }
-    else if (*(data_.str_) != "true" &&  *(data_.str_) != "false")
+    else if (data_.str_ != "true" &&  data_.str_ != "false")
     {
       throw Exception::ConversionError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, 
         String("Could not convert non-string DataValue of type '") + NamesOfDataType[value_type_] + 
-        "' and value '" + *(data_.str_) + "' to bool. Valid stings are 'true' and 'false'.");
+        "' and value '" + data_.str_ + "' to bool. Valid stings are 'true' and 'false'.");
     }
 
-    return *(data_.str_) == "true";
+    return data_.str_ == "true";
   }
 
   // ----------------- Comparator ----------------------
@@ -786,7 +855,7 @@ namespace OpenMS
       {
       case DataValue::EMPTY_VALUE: return b.value_type_ == DataValue::EMPTY_VALUE;
 
-      case DataValue::STRING_VALUE: return *(a.data_.str_) == *(b.data_.str_);
+      case DataValue::STRING_VALUE: return a.data_.str_ == b.data_.str_;
 
       case DataValue::STRING_LIST: return *(a.data_.str_list_) == *(b.data_.str_list_);
 
@@ -812,7 +881,7 @@ namespace OpenMS
       {
       case DataValue::EMPTY_VALUE: return false;
 
-      case DataValue::STRING_VALUE: return *(a.data_.str_) < *(b.data_.str_);
+      case DataValue::STRING_VALUE: return a.data_.str_ < b.data_.str_;
 
       case DataValue::STRING_LIST: return a.data_.str_list_->size() < b.data_.str_list_->size();
 
@@ -838,7 +907,7 @@ namespace OpenMS
       {
       case DataValue::EMPTY_VALUE: return false;
 
-      case DataValue::STRING_VALUE: return *(a.data_.str_) > *(b.data_.str_);
+      case DataValue::STRING_VALUE: return a.data_.str_ > b.data_.str_;
 
       case DataValue::STRING_LIST: return a.data_.str_list_->size() > b.data_.str_list_->size();
 
@@ -869,7 +938,7 @@ namespace OpenMS
   {
     switch (p.value_type_)
     {
-    case DataValue::STRING_VALUE: os << *(p.data_.str_); break;
+    case DataValue::STRING_VALUE: os << p.data_.str_; break;
 
     case DataValue::STRING_LIST: os << *(p.data_.str_list_); break;
 
@@ -422,31 +422,41 @@ namespace OpenMS
   //********************************* Param **************************************
 
   Param::Param() :
-    root_("ROOT", "")
+    root_(std::make_shared<ParamNode>("ROOT", ""))
   {
   }
 
   Param::~Param() = default;
 
   Param::Param(const ParamNode& node) :
-    root_(node)
+    root_(std::make_shared<ParamNode>(node))
   {
-    root_.name = "ROOT";
-    root_.description = "";
+    root_->name = "ROOT";
+    root_->description = "";
+  }
+
+  void Param::detach_()
+  {
+    if (root_.use_count() > 1)
+    {
+      root_ = std::make_shared<ParamNode>(*root_);
+    }
   }
 
   bool Param::operator==(const Param& rhs) const
   {
-    return root_ == rhs.root_;
+    return root_ == rhs.root_ || *root_ == *rhs.root_;
   }
 
   void Param::setValue(const std::string& key, const ParamValue& value, const std::string& description, const std::vector<std::string>& tags)
   {
-    root_.insert(ParamEntry("", value, description, tags), key);
+    detach_();
+    root_->insert(ParamEntry("", value, description, tags), key);
   }
 
   void Param::setValidStrings(const std::string& key, const std::vector<std::string>& strings)
   {
+    detach_();
     ParamEntry& entry = getEntry_(key);
     //check if correct parameter type
     if (entry.value.valueType() != ParamValue::STRING_VALUE && entry.value.valueType() != ParamValue::STRING_LIST)
@@ -477,6 +487,7 @@ namespace OpenMS
 
   void Param::setMinInt(const std::string& key, int min)
   {
+    detach_();
     ParamEntry& entry = getEntry_(key);
     if (entry.value.valueType() != ParamValue::INT_VALUE && entry.value.valueType() != ParamValue::INT_LIST)
     {
@@ -487,6 +498,7 @@ namespace OpenMS
 
   void Param::setMaxInt(const std::string& key, int max)
   {
+    detach_();
     ParamEntry& entry = getEntry_(key);
     if (entry.value.valueType() != ParamValue::INT_VALUE && entry.value.valueType() != ParamValue::INT_LIST)
     {
@@ -497,6 +509,7 @@ namespace OpenMS
 
   void Param::setMinFloat(const std::string& key, double min)
   {
+    detach_();
     ParamEntry& entry = getEntry_(key);
     if (entry.value.valueType() != ParamValue::DOUBLE_VALUE && entry.value.valueType() != ParamValue::DOUBLE_LIST)
     {
@@ -507,6 +520,7 @@ namespace OpenMS
 
   void Param::setMaxFloat(const std::string& key, double max)
   {
+    detach_();
     ParamEntry& entry = getEntry_(key);
     if (entry.value.valueType() != ParamValue::DOUBLE_VALUE && entry.value.valueType() != ParamValue::DOUBLE_LIST)
     {
@@ -526,7 +540,7 @@ namespace OpenMS
     //static initialization and thus cannot rely on String::EMPTY been initialized.
     static std::string empty;
 
-    ParamNode* node = root_.findParentOf(key);
+    ParamNode* node = root_->findParentOf(key);
     if (node == nullptr)
     {
       return empty;
@@ -544,13 +558,14 @@ namespace OpenMS
   void Param::insert(const std::string& prefix, const Param& param)
   {
     //std::cerr << "INSERT PARAM (" << prefix << ")" << std::endl;
-    for (Param::ParamNode::NodeIterator it = param.root_.nodes.begin(); it != param.root_.nodes.end(); ++it)
+    detach_();
+    for (Param::ParamNode::NodeIterator it = param.root_->nodes.begin(); it != param.root_->nodes.end(); ++it)
     {
-      root_.insert(*it, prefix);
+      root_->insert(*it, prefix);
     }
-    for (Param::ParamNode::EntryIterator it = param.root_.entries.begin(); it != param.root_.entries.end(); ++it)
+    for (Param::ParamNode::EntryIterator it = param.root_->entries.begin(); it != param.root_->entries.end(); ++it)
     {
-      root_.insert(*it, prefix);
+      root_->insert(*it, prefix);
     }
   }
 
@@ -573,7 +588,8 @@ namespace OpenMS
         if (showMessage)
           std::cerr << "Setting " << prefix2 + it.getName() << " to " << it->value << std::endl;
         std::string name = prefix2 + it.getName();
-        root_.insert(ParamEntry("", it->value, it->description), name);
+        detach_();
+        root_->insert(ParamEntry("", it->value, it->description), name);
         //copy tags
         for (std::set<std::string>::const_iterator tag_it = it->tags.begin(); tag_it != it->tags.end(); ++tag_it)
         {
@@ -613,7 +629,9 @@ namespace OpenMS
         {
           std::string description_old = getSectionDescription(prefix + real_pathname);
           const std::string& description_new = defaults.getSectionDescription(real_pathname);
-          if (description_old.empty())
+          // only touch the tree if there is something to set -- otherwise a no-op
+          // call would detach from copies sharing the parameter tree
+          if (description_old.empty() && !description_new.empty())
           {
             //std::cerr << "## Setting description of " << prefix+real_pathname << " to"<< std::endl;
             //std::cerr << "## " << description_new << std::endl;
@@ -631,7 +649,8 @@ namespace OpenMS
     {
       keyname = key.substr(0, key.length() - 1);
 
-      ParamNode* node_parent = root_.findParentOf(keyname);
+      detach_();
+      ParamNode* node_parent = root_->findParentOf(keyname);
       if (node_parent != nullptr)
       {
         Param::ParamNode::NodeIterator it = node_parent->findNode(node_parent->suffix(keyname));
@@ -649,7 +668,8 @@ namespace OpenMS
     }
     else
     {
-      ParamNode* node = root_.findParentOf(keyname);
+      detach_();
+      ParamNode* node = root_->findParentOf(keyname);
       if (node != nullptr)
       {
         std::string entryname = node->suffix(keyname); // get everything beyond last ':'
@@ -671,7 +691,8 @@ namespace OpenMS
   {
     if (!prefix.empty() && prefix.back() == ':')//we have to delete one node only (and its subnodes)
     {
-      ParamNode* node = root_.findParentOf(prefix.substr(0, prefix.length() - 1));
+      detach_();
+      ParamNode* node = root_->findParentOf(prefix.substr(0, prefix.length() - 1));
       if (node != nullptr)
       {
         Param::ParamNode::NodeIterator it = node->findNode(node->suffix(prefix.substr(0, prefix.length() - 1)));
@@ -689,7 +710,8 @@ namespace OpenMS
     }
     else //we have to delete all entries and nodes starting with the prefix
     {
-      ParamNode* node = root_.findParentOf(prefix);
+      detach_();
+      ParamNode* node = root_->findParentOf(prefix);
       if (node != nullptr)
       {
         std::string suffix = node->suffix(prefix); // name behind last ":"
@@ -730,10 +752,10 @@ namespace OpenMS
   {
     ParamNode out("ROOT", "");
 
-    for (const auto& entry : subset.root_.entries)
+    for (const auto& entry : subset.root_->entries)
     {
-      const auto& n = root_.findEntry(entry.name);
-      if (n == root_.entries.end())
+      const auto& n = root_->findEntry(entry.name);
+      if (n == root_->entries.end())
       {
         OPENMS_LOG_WARN << "Warning: Trying to copy non-existent parameter entry " << entry.name << std::endl;
       }
@@ -743,10 +765,10 @@ namespace OpenMS
       }
     }
 
-    for (const auto& node : subset.root_.nodes)
+    for (const auto& node : subset.root_->nodes)
     {
-      const auto& n = root_.findNode(node.name);
-      if (n == root_.nodes.end())
+      const auto& n = root_->findNode(node.name);
+      if (n == root_->nodes.end())
       {
         OPENMS_LOG_WARN << "Warning: Trying to copy non-existent parameter node " << node.name << std::endl;
       }
@@ -762,7 +784,7 @@ namespace OpenMS
   {
     ParamNode out("ROOT", "");
 
-    ParamNode* node = root_.findParentOf(prefix);
+    ParamNode* node = root_->findParentOf(prefix);
     if (node == nullptr)
     {
       return Param();
@@ -833,6 +855,7 @@ namespace OpenMS
     }
 
     //parse arguments
+    detach_();
     std::string arg, arg1;
     for (int i = 1; i < argc; ++i)
     {
@@ -860,25 +883,25 @@ namespace OpenMS
       //flag (option without text argument)
       if (arg_is_option && arg1_is_option)
       {
-        root_.insert(ParamEntry(arg, std::string(), ""), prefix2);
+        root_->insert(ParamEntry(arg, std::string(), ""), prefix2);
       }
       //option with argument
       else if (arg_is_option && !arg1_is_option)
       {
-        root_.insert(ParamEntry(arg, arg1, ""), prefix2);
+        root_->insert(ParamEntry(arg, arg1, ""), prefix2);
         ++i;
       }
       //just text arguments (not preceded by an option)
       else
       {
 
-        ParamEntry* misc_entry = root_.findEntryRecursive(prefix2 + "misc");
+        ParamEntry* misc_entry = root_->findEntryRecursive(prefix2 + "misc");
         if (misc_entry == nullptr)
         {
           std::vector<std::string> sl;
           sl.push_back(arg);
           // create "misc"-Node:
-          root_.insert(ParamEntry("misc", sl, ""), prefix2);
+          root_->insert(ParamEntry("misc", sl, ""), prefix2);
         }
         else
         {
@@ -893,10 +916,11 @@ namespace OpenMS
   void Param::parseCommandLine(const int argc, const char** argv, const std::map<std::string, std::string>& options_with_one_argument, const std::map<std::string, std::string>& options_without_argument, const std::map<std::string, std::string>& options_with_multiple_argument, const std::string& misc, const std::string& unknown)
   {
     //determine misc key
-    
+
     //determine unknown key
-    
+
     //parse arguments
+    detach_();
     std::string arg, arg1;
     for (int i = 1; i < argc; ++i)
     {
@@ -926,7 +950,7 @@ namespace OpenMS
         //next argument is an option
         if (arg1_is_option)
         {
-          root_.insert(ParamEntry("", std::vector<std::string>(), ""), options_with_multiple_argument.find(arg)->second);
+          root_->insert(ParamEntry("", std::vector<std::string>(), ""), options_with_multiple_argument.find(arg)->second);
         }
         //next argument is not an option
         else
@@ -943,14 +967,14 @@ namespace OpenMS
             }
           }
 
-          root_.insert(ParamEntry("", sl, ""), options_with_multiple_argument.find(arg)->second);
+          root_->insert(ParamEntry("", sl, ""), options_with_multiple_argument.find(arg)->second);
           i = j - 1;
         }
       }
       //without argument
       else if (options_without_argument.find(arg) != options_without_argument.end())
       {
-        root_.insert(ParamEntry("", "true", ""), options_without_argument.find(arg)->second);
+        root_->insert(ParamEntry("", "true", ""), options_without_argument.find(arg)->second);
       }
       //with one argument
       else if (options_with_one_argument.find(arg) != options_with_one_argument.end())
@@ -958,25 +982,25 @@ namespace OpenMS
         //next argument is not an option
         if (!arg1_is_option)
         {
-          root_.insert(ParamEntry("", arg1, ""), options_with_one_argument.find(arg)->second);
+          root_->insert(ParamEntry("", arg1, ""), options_with_one_argument.find(arg)->second);
           ++i;
         }
         //next argument is an option
         else
         {
 
-          root_.insert(ParamEntry("", std::string(), ""), options_with_one_argument.find(arg)->second);
+          root_->insert(ParamEntry("", std::string(), ""), options_with_one_argument.find(arg)->second);
         }
       }
       //unknown option
       else if (arg_is_option)
       {
-        ParamEntry* unknown_entry = root_.findEntryRecursive(unknown);
+        ParamEntry* unknown_entry = root_->findEntryRecursive(unknown);
         if (unknown_entry == nullptr)
         {
           std::vector<std::string> sl;
           sl.push_back(arg);
-          root_.insert(ParamEntry("", sl, ""), unknown);
+          root_->insert(ParamEntry("", sl, ""), unknown);
         }
         else
         {
@@ -988,13 +1012,13 @@ namespace OpenMS
       //just text argument
       else
       {
-        ParamEntry* misc_entry = root_.findEntryRecursive(misc);
+        ParamEntry* misc_entry = root_->findEntryRecursive(misc);
         if (misc_entry == nullptr)
         {
           std::vector<std::string> sl;
           sl.push_back(arg);
           // create "misc"-Node:
-          root_.insert(ParamEntry("", sl, ""), misc);
+          root_->insert(ParamEntry("", sl, ""), misc);
         }
         else
         {
@@ -1027,7 +1051,7 @@ namespace OpenMS
 
   size_t Param::size() const
   {
-    return root_.size();
+    return root_->size();
   }
 
   bool Param::empty() const
@@ -1037,7 +1061,7 @@ namespace OpenMS
 
   void Param::clear()
   {
-    root_ = ParamNode("ROOT", "");
+    root_ = std::make_shared<ParamNode>("ROOT", "");
   }
 
   void Param::checkDefaults(const std::string& name, const Param& defaults, const std::string& prefix) const
@@ -1068,7 +1092,7 @@ namespace OpenMS
       }
 
       //different types
-      ParamEntry* default_value = defaults.root_.findEntryRecursive(prefix2 + it.getName());
+      ParamEntry* default_value = defaults.root_->findEntryRecursive(prefix2 + it.getName());
       if (default_value == nullptr)
       {
         continue;
@@ -1275,7 +1299,8 @@ OPENMS_THREAD_CRITICAL(LOGSTREAM)
             {
               prefix = it.getName().substr(0, 1 + it.getName().find_last_of(':'));
             }
-            this->root_.insert(local_entry, prefix); //->setValue(it.getName(), local_entry.value, local_entry.description, local_entry.tags);
+            this->detach_();
+            this->root_->insert(local_entry, prefix); //->setValue(it.getName(), local_entry.value, local_entry.description, local_entry.tags);
           }
           else if (verbose)
           {
@@ -1367,7 +1392,8 @@ OPENMS_THREAD_CRITICAL(LOGSTREAM)
       {
         Param::ParamEntry entry = *it;
         OPENMS_LOG_DEBUG << "[Param::merge] merging " << it.getName() << std::endl;
-        this->root_.insert(entry, prefix);
+        this->detach_();
+        this->root_->insert(entry, prefix);
       }
 
       //copy section descriptions
@@ -1403,7 +1429,8 @@ OPENMS_THREAD_CRITICAL(LOGSTREAM)
 
   void Param::setSectionDescription(const std::string& key, const std::string& description)
   {
-    ParamNode* node = root_.findParentOf(key);
+    detach_();
+    ParamNode* node = root_->findParentOf(key);
     if (node == nullptr)
     {
       throw Exception::ElementNotFound(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, key);
@@ -1419,12 +1446,13 @@ OPENMS_THREAD_CRITICAL(LOGSTREAM)
 
   void Param::addSection(const std::string& key, const std::string& description)
   {
-    root_.insert(ParamNode("",description),key);
+    detach_();
+    root_->insert(ParamNode("",description),key);
   }
 
   Param::ParamIterator Param::begin() const
   {
-    return ParamIterator(root_);
+    return ParamIterator(*root_);
   }
 
   Param::ParamIterator Param::end() const
@@ -1601,11 +1629,13 @@ OPENMS_THREAD_CRITICAL(LOGSTREAM)
     {
       throw Exception::InvalidValue(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Param tags may not contain comma characters", tag);
     }
+    detach_();
     getEntry_(key).tags.insert(tag);
   }
 
   void Param::addTags(const std::string& key, const std::vector<std::string>& tags)
   {
+    detach_();
     ParamEntry& entry = getEntry_(key);
     for (size_t i = 0; i != tags.size(); ++i)
     {
@@ -1630,6 +1660,7 @@ OPENMS_THREAD_CRITICAL(LOGSTREAM)
 
   void Param::clearTags(const std::string& key)
   {
+    detach_();
     getEntry_(key).tags.clear();
   }
 
@@ -1640,7 +1671,7 @@ OPENMS_THREAD_CRITICAL(LOGSTREAM)
 
   bool Param::exists(const std::string& key) const
   {
-    return root_.findEntryRecursive(key);
+    return root_->findEntryRecursive(key);
   }
 
   bool Param::hasSection(const std::string &key) const
@@ -1648,17 +1679,17 @@ OPENMS_THREAD_CRITICAL(LOGSTREAM)
     if (key.back() == ':')
     {
       // Remove trailing colon from key
-      return root_.findParentOf(key.substr(0, key.size() - 1)) != nullptr;
+      return root_->findParentOf(key.substr(0, key.size() - 1)) != nullptr;
     }
     else
     {
-      return root_.findParentOf(key) != nullptr;
+      return root_->findParentOf(key) != nullptr;
     }
   }
 
   Param::ParamEntry& Param::getEntry_(const std::string& key) const
   {
-    ParamEntry* entry = root_.findEntryRecursive(key);
+    ParamEntry* entry = root_->findEntryRecursive(key);
     if (entry == nullptr)
     {
       throw Exception::ElementNotFound(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, key);
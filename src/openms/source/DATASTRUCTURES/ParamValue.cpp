@@ -11,6 +11,7 @@
 #include <OpenMS/CONCEPT/Exception.h>
 #include <sstream>
 #include <cmath>
+#include <new> // for placement new (string values are stored inline in the union)
 
 namespace OpenMS
 {
@@ -100,13 +101,19 @@ namespace OpenMS
   ParamValue::ParamValue(const char* p) :
     value_type_(STRING_VALUE)
   {
-    data_.str_ = new std::string(p);
+    new (&data_.str_) std::string(p);
   }
 
   ParamValue::ParamValue(const std::string& p) :
     value_type_(STRING_VALUE)
   {
-    data_.str_ = new std::string(p);
+    new (&data_.str_) std::string(p);
+  }
+
+  ParamValue::ParamValue(std::string&& p) noexcept :
+    value_type_(STRING_VALUE)
+  {
+    new (&data_.str_) std::string(std::move(p));
   }
 
   ParamValue::ParamValue(const std::vector<std::string>& p) :
@@ -115,6 +122,12 @@ namespace OpenMS
     data_.str_list_ = new std::vector<std::string>(p);
   }
 
+  ParamValue::ParamValue(std::vector<std::string>&& p) :
+    value_type_(STRING_LIST)
+  {
+    data_.str_list_ = new std::vector<std::string>(std::move(p));
+  }
+
   ParamValue::ParamValue(const std::vector<int>& p) :
     value_type_(INT_LIST)
   {
@@ -136,7 +149,7 @@ namespace OpenMS
     switch (value_type_) 
     {
     case STRING_VALUE:
-        data_.str_ = new std::string(*p.data_.str_);
+        new (&data_.str_) std::string(p.data_.str_);
     break;
     case STRING_LIST:
         data_.str_list_ = new std::vector<std::string>(*p.data_.str_list_);
@@ -147,18 +160,45 @@ namespace OpenMS
     case DOUBLE_LIST:
         data_.dou_list_ = new std::vector<double>(*p.data_.dou_list_);
     break;
-    default:
-        data_ = p.data_;
+    case INT_VALUE:
+        data_.ssize_ = p.data_.ssize_;
+    break;
+    case DOUBLE_VALUE:
+        data_.dou_ = p.data_.dou_;
+    break;
+    default: // EMPTY_VALUE
     break;
     }
   }
 
   ParamValue::ParamValue(ParamValue&& rhs) noexcept :
-    value_type_(std::move(rhs.value_type_)),
-    data_(std::move(rhs.data_))
+    value_type_(rhs.value_type_)
   {
-    // clean up rhs, take ownership of data_
-    // NOTE: value_type_ == EMPTY_VALUE implies data_ is empty and can be reset
+    // take ownership of rhs' data and leave it in the EMPTY state
+    switch (value_type_)
+    {
+    case STRING_VALUE:
+        new (&data_.str_) std::string(std::move(rhs.data_.str_));
+        rhs.data_.str_.~basic_string();
+    break;
+    case STRING_LIST:
+        data_.str_list_ = rhs.data_.str_list_;
+    break;
+    case INT_LIST:
+        data_.int_list_ = rhs.data_.int_list_;
+    break;
+    case DOUBLE_LIST:
+        data_.dou_list_ = rhs.data_.dou_list_;
+    break;
+    case INT_VALUE:
+        data_.ssize_ = rhs.data_.ssize_;
+    break;
+    case DOUBLE_VALUE:
+        data_.dou_ = rhs.data_.dou_;
+    break;
+    default: // EMPTY_VALUE
+    break;
+    }
     rhs.value_type_ = EMPTY_VALUE;
   }
 
@@ -167,7 +207,7 @@ namespace OpenMS
     switch (value_type_) 
     {
       case STRING_VALUE:
-        delete data_.str_;
+        data_.str_.~basic_string();
       break;
       case STRING_LIST:
         delete data_.str_list_;
@@ -202,7 +242,7 @@ namespace OpenMS
     switch (p.value_type_) 
     {
     case STRING_VALUE:
-        data_.str_ = new std::string(*p.data_.str_);
+        new (&data_.str_) std::string(p.data_.str_);
         break;
     case STRING_LIST:
         data_.str_list_ = new std::vector<std::string>(*p.data_.str_list_);
@@ -213,8 +253,13 @@ namespace OpenMS
     case DOUBLE_LIST:
         data_.dou_list_ = new std::vector<double>(*p.data_.dou_list_);
         break;
-    default:
-        data_ = p.data_;
+    case INT_VALUE:
+        data_.ssize_ = p.data_.ssize_;
+        break;
+    case DOUBLE_VALUE:
+        data_.dou_ = p.data_.dou_;
+        break;
+    default: // EMPTY_VALUE
         break;
     }
 
@@ -236,10 +281,32 @@ namespace OpenMS
     // clean up *this
     clear_();
 
-    // assign values to *this
-    data_ = rhs.data_;
+    // take ownership of rhs' data and leave it in the EMPTY state
+    switch (rhs.value_type_)
+    {
+    case STRING_VALUE:
+        new (&data_.str_) std::string(std::move(rhs.data_.str_));
+        rhs.data_.str_.~basic_string();
+        break;
+    case STRING_LIST:
+        data_.str_list_ = rhs.data_.str_list_;
+        break;
+    case INT_LIST:
+        data_.int_list_ = rhs.data_.int_list_;
+        break;
+    case DOUBLE_LIST:
+        data_.dou_list_ = rhs.data_.dou_list_;
+        break;
+    case INT_VALUE:
+        data_.ssize_ = rhs.data_.ssize_;
+        break;
+    case DOUBLE_VALUE:
+        data_.dou_ = rhs.data_.dou_;
+        break;
+    default: // EMPTY_VALUE
+        break;
+    }
     value_type_ = rhs.value_type_;
-    // clean up rhs 
     rhs.value_type_ = EMPTY_VALUE;
 
     return *this;
@@ -252,7 +319,7 @@ namespace OpenMS
   ParamValue& ParamValue::operator=(const char* arg)
   {
     clear_();
-    data_.str_ = new std::string(arg);
+    new (&data_.str_) std::string(arg);
     value_type_ = STRING_VALUE;
     return *this;
   }
@@ -260,7 +327,15 @@ namespace OpenMS
   ParamValue& ParamValue::operator=(const std::string& arg)
   {
     clear_();
-    data_.str_ = new std::string(arg);
+    new (&data_.str_) std::string(arg);
+    value_type_ = STRING_VALUE;
+    return *this;
+  }
+
+  ParamValue& ParamValue::operator=(std::string&& arg) noexcept
+  {
+    clear_();
+    new (&data_.str_) std::string(std::move(arg));
     value_type_ = STRING_VALUE;
     return *this;
   }
@@ -273,6 +348,14 @@ namespace OpenMS
     return *this;
   }
 
+  ParamValue& ParamValue::operator=(std::vector<std::string>&& arg)
+  {
+    clear_();
+    data_.str_list_ = new std::vector<std::string>(std::move(arg));
+    value_type_ = STRING_LIST;
+    return *this;
+  }
+
   ParamValue& ParamValue::operator=(const std::vector<int>& arg)
   {
     clear_();
@@ -513,7 +596,7 @@ namespace OpenMS
     {
       throw Exception::ConversionError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Could not convert non-string ParamValue to string");
     }
-    return *(data_.str_);
+    return data_.str_;
   }
 
   ParamValue::operator std::vector<std::string>() const
@@ -537,7 +620,7 @@ namespace OpenMS
     switch (value_type_)
     {
     case STRING_VALUE:
-        return data_.str_->c_str();
+        return data_.str_.c_str();
     break;
     case EMPTY_VALUE:
         return nullptr;
@@ -557,7 +640,7 @@ namespace OpenMS
         return "";
     break;
     case STRING_VALUE:
-        return *data_.str_;
+        return data_.str_;
     break;
     case INT_VALUE:
         return std::to_string(data_.ssize_);
@@ -642,12 +725,12 @@ namespace OpenMS
     {
       throw Exception::ConversionError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Could not convert non-string ParamValue to bool.");
     }
-    else if (!(*(data_.str_) == "true" || *(data_.str_) == "false"))
+    else if (!(data_.str_ == "true" || data_.str_ == "false"))
     {
-      throw Exception::ConversionError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Could not convert '" + *(data_.str_) + "' to bool. Valid stings are 'true' and 'false'.");
+      throw Exception::ConversionError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Could not convert '" + data_.str_ + "' to bool. Valid stings are 'true' and 'false'.");
     }
 
-    return *(data_.str_) == "true";
+    return data_.str_ == "true";
   }
 
   // ----------------- Comparator ----------------------
@@ -662,7 +745,7 @@ namespace OpenMS
           return true;
       break;
       case ParamValue::STRING_VALUE:
-          return *(a.data_.str_) == *(b.data_.str_);
+          return a.data_.str_ == b.data_.str_;
       break;
       case ParamValue::STRING_LIST:
           return *(a.data_.str_list_) == *(b.data_.str_list_);
@@ -695,7 +778,7 @@ namespace OpenMS
           return false;
       break;
       case ParamValue::STRING_VALUE:
-          return *(a.data_.str_) < *(b.data_.str_);
+          return a.data_.str_ < b.data_.str_;
       break;
       case ParamValue::STRING_LIST:
           return a.data_.str_list_->size() < b.data_.str_list_->size();
@@ -727,7 +810,7 @@ namespace OpenMS
           return false;
       break;
       case ParamValue::STRING_VALUE:
-          return *(a.data_.str_) > *(b.data_.str_);
+          return a.data_.str_ > b.data_.str_;
       break;
       case ParamValue::STRING_LIST:
           return a.data_.str_list_->size() > b.data_.str_list_->size();
@@ -762,7 +845,7 @@ namespace OpenMS
     switch (p.value_type_)
     {
     case ParamValue::STRING_VALUE:
-        os << *(p.data_.str_);
+        os << p.data_.str_;
     break;
     case ParamValue::STRING_LIST:
         os << "[";
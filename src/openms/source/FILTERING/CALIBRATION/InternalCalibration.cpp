@@ -19,6 +19,9 @@
 #include <QtCore/QStringList>
 
 #include <cstdio>
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
 
 namespace OpenMS
 {
@@ -43,13 +46,8 @@ namespace OpenMS
   
   void InternalCalibration::applyTransformation_(PeakMap::SpectrumType& spec, const MZTrafoModel& trafo)
   {
-    typedef PeakMap::SpectrumType::Iterator SpecIt;
-
-    // calibrate the spectrum itself
-    for (SpecIt it = spec.begin(); it != spec.end(); ++it)
-    {
-      it->setMZ(trafo.predict(it->getMZ()));
-    }
+    // calibrate the spectrum itself (vectorized batch version of predict())
+    trafo.applyToSpectrum(spec);
   }
 
   void InternalCalibration::applyTransformation(PeakMap::SpectrumType& spec, const IntList& target_mslvl, const MZTrafoModel& trafo)
@@ -68,9 +66,11 @@ namespace OpenMS
 
   void InternalCalibration::applyTransformation(PeakMap& exp, const IntList& target_mslvl, const MZTrafoModel& trafo)
   {
-    for (PeakMap::Iterator it = exp.begin(); it != exp.end(); ++it)
+    // spectra are independent of each other
+#pragma omp parallel for schedule(dynamic)
+    for (SignedSize i = 0; i < (SignedSize)exp.size(); ++i)
     {
-      applyTransformation(*it, target_mslvl, trafo);
+      applyTransformation(exp[i], target_mslvl, trafo);
     }
   }
 
@@ -315,35 +315,47 @@ namespace OpenMS
     }
     else
     { // one model per spectrum (not all might be needed, if certain MS levels are excluded from calibration)
-      tms.reserve(exp.size());
-      // go through spectra and calibrate
-      Size i(0), i_mslvl(0);
-      for (PeakMap::Iterator it = exp.begin(); it != exp.end(); ++it, ++i)
+      // collect the spectra which require calibration, so the training loop below has stable
+      // indices into tms[] and exp[]
+      std::vector<Size> spec_idx;
+      spec_idx.reserve(exp.size());
+      for (Size i = 0; i < exp.size(); ++i)
       {
-        setProgress(i);
-
         // skip this MS level?
-        if (!(ListUtils::contains(target_mslvl, it->getMSLevel()) ||     // scan m/z needs correction
-              ListUtils::contains(target_mslvl, it->getMSLevel() - 1)))  // precursor m/z needs correction
+        if (!(ListUtils::contains(target_mslvl, exp[i].getMSLevel()) ||     // scan m/z needs correction
+              ListUtils::contains(target_mslvl, exp[i].getMSLevel() - 1)))  // precursor m/z needs correction
         {
           continue;
         }
+        spec_idx.push_back(i);
+      }
 
-        //
-        // build model
-        //
-        tms.emplace_back();
-        tms.back().train(cal_data_, model_type, use_RANSAC, it->getRT() - rt_chunk, it->getRT() + rt_chunk);
-        if (!MZTrafoModel::isValidModel(tms.back())) // model not trained or coefficients are too extreme
+      //
+      // build the models (in parallel)
+      //
+      // Each iteration only reads cal_data_ and writes its own model and spectrum, and
+      // MZTrafoModel::train() seeds RANSAC identically on every call, so the result does not
+      // depend on the processing order and is identical to a serial run.
+      tms.resize(spec_idx.size());
+#pragma omp parallel for schedule(dynamic)
+      for (SignedSize j = 0; j < (SignedSize)spec_idx.size(); ++j)
+      {
+        IF_MASTERTHREAD setProgress(spec_idx[j]);
+
+        PeakMap::SpectrumType& spec = exp[spec_idx[j]];
+        tms[j].train(cal_data_, model_type, use_RANSAC, spec.getRT() - rt_chunk, spec.getRT() + rt_chunk);
+        if (MZTrafoModel::isValidModel(tms[j]))
         {
-          invalid_models[i_mslvl] = i;
+          applyTransformation(spec, target_mslvl, tms[j]);
         }
-        else
+      }
+      for (Size j = 0; j < tms.size(); ++j)
+      {
+        if (!MZTrafoModel::isValidModel(tms[j])) // model not trained or coefficients are too extreme
         {
-          applyTransformation(*it, target_mslvl, tms.back());
+          invalid_models[j] = spec_idx[j];
         }
-        ++i_mslvl;
-      } // MSExp::iter
+      }
 
       //////////////////////////////////////////////////////////////////////////
       // CHECK Models -- use neighbors if needed
@@ -13,6 +13,7 @@
 #include <OpenMS/MATH/STATISTICS/StatisticFunctions.h>
 #include <OpenMS/MATH/MISC/RANSACModelQuadratic.h>
 #include <OpenMS/MATH/MISC/MathFunctions.h>
+#include <OpenMS/KERNEL/MSSpectrum.h>
 
 #include <OpenMS/CONCEPT/LogStream.h>
 
@@ -120,6 +121,32 @@ namespace OpenMS
     return predict;
   }
 
+  void MZTrafoModel::applyToSpectrum(MSSpectrum& spec) const
+  {
+    // same arithmetic as predict(), but with the coefficients and the ppm
+    // branch hoisted out of the loop, so it can be vectorized
+    const double a = coeff_[0];
+    const double b = coeff_[1];
+    const double c = coeff_[2];
+    if (use_ppm_)
+    {
+      for (Peak1D& peak : spec)
+      {
+        const double mz = peak.getMZ();
+        const double ppm_error = a + b * mz + c * mz * mz;
+        peak.setMZ(Math::ppmToMass(-ppm_error, mz) + mz);
+      }
+    }
+    else
+    {
+      for (Peak1D& peak : spec)
+      {
+        const double mz = peak.getMZ();
+        peak.setMZ(-(a + b * mz + c * mz * mz) + mz);
+      }
+    }
+  }
+
   bool MZTrafoModel::train( const CalibrationData& cd, MODELTYPE md, bool use_RANSAC, double rt_left /*= -std::numeric_limits<double>::max()*/, double rt_right /*= std::numeric_limits<double>::max() */ )
   {
     std::vector<double> obs_mz;
@@ -73,69 +73,40 @@ namespace OpenMS
                                                             vector<double> & rts)
     {
       set<Size> corrected_precursors;
-      // load experiment and extract precursors
-      vector<Precursor> precursors;  // precursor
-      vector<double> precursors_rt;  // RT of precursor MS2 spectrum
-      vector<Size> precursor_scan_index;
-      getPrecursors(exp, precursors, precursors_rt, precursor_scan_index);
+      // group MS2 scans under their survey scan, so each MS1 is looked up once
+      // and shared by all its dependent MS2 scans
+      vector<pair<Size, vector<Size>>> groups = groupBySurveyScan_(exp);
 
-      for (Size i = 0; i != precursors_rt.size(); ++i)
-      {
-        // get precursor rt
-        double rt = precursors_rt[i];
-
-        // get precursor MZ
-        double mz = precursors[i].getMZ();
-
-        //cout << rt << " " << mz << endl;
-
-        // get precursor spectrum
-        MSExperiment::ConstIterator rt_it = exp.RTBegin(rt - 1e-8);
-
-        // store index of MS2 spectrum
-        UInt precursor_spectrum_idx = rt_it - exp.begin();
-
-        // get parent (MS1) of precursor spectrum
-        rt_it = exp.getPrecursorSpectrum(rt_it);
-
-        if (rt_it == exp.end() 
-        || rt_it->getMSLevel() != 1)
-        {
-          OPENMS_LOG_WARN << "Warning: no MS1 spectrum for this precursor" << endl;
-          continue;          
-        }
+      // per-scan result slots; merged in scan order below so the output does not
+      // depend on the OpenMP schedule
+      vector<double> scan_delta_mz(exp.size(), 0.0);
+      vector<char> scan_corrected(exp.size(), 0);
 
-        //cout << rt_it->getRT() << " " << rt_it->size() << endl;
-
-        // find peak (index) closest to expected position
-        Size nearest_peak_idx = rt_it->findNearest(mz);
-
-        // get actual position of closest peak
-        double nearest_peak_mz = (*rt_it)[nearest_peak_idx].getMZ();
-
-        // calculate error between expected and actual position
-        double nearestPeakError = ppm ? abs(nearest_peak_mz - mz)/mz * 1e6 : abs(nearest_peak_mz - mz);
-
-        // check if error is small enough
-        if (nearestPeakError < mz_tolerance)
+#pragma omp parallel for
+      for (SignedSize g = 0; g < (SignedSize)groups.size(); ++g)
+      {
+        const MSSpectrum& ms1 = exp[groups[g].first];
+        for (Size scan : groups[g].second)
         {
-          // sanity check: do we really have the same precursor in the original and the picked spectrum
-          if (fabs(exp[precursor_spectrum_idx].getPrecursors()[0].getMZ() - mz) > 0.0001)
+          double delta_mz;
+          if (correctToMS1Peak(ms1, exp[scan], mz_tolerance, ppm, false, delta_mz))
           {
-            OPENMS_LOG_WARN << "Error: index is referencing different precursors in original and picked spectrum." << endl;
+            scan_delta_mz[scan] = delta_mz;
+            scan_corrected[scan] = 1;
           }
+        }
+      }
 
-          // cout << mz << " -> " << nearest_peak_mz << endl;
-          double delta_mz = nearest_peak_mz - mz;
-          delta_mzs.push_back(delta_mz);
-          mzs.push_back(mz);
-          rts.push_back(rt);
-          // correct entries
-          Precursor corrected_prec = precursors[i];
-          corrected_prec.setMZ(nearest_peak_mz);
-          exp[precursor_spectrum_idx].getPrecursors()[0] = corrected_prec;
-          corrected_precursors.insert(precursor_spectrum_idx);
+      for (Size i = 0; i != exp.size(); ++i)
+      {
+        if (scan_corrected[i] == 0)
+        {
+          continue;
         }
+        delta_mzs.push_back(scan_delta_mz[i]);
+        mzs.push_back(exp[i].getPrecursors()[0].getMZ() - scan_delta_mz[i]); // uncorrected m/z
+        rts.push_back(exp[i].getRT());
+        corrected_precursors.insert(i);
       }
       return corrected_precursors;
     }
@@ -149,62 +120,50 @@ namespace OpenMS
                                                                     vector<double> & rts)
     {
       set<Size> corrected_precursors;
-      // load experiment and extract precursors
-      vector<Precursor> precursors;  // precursor
-      vector<double> precursors_rt;  // RT of precursor MS2 spectrum
-      vector<Size> precursor_scan_index;
-      getPrecursors(exp, precursors, precursors_rt, precursor_scan_index);
-      int count_error_highest_intenstiy = 0;
-
-      for (Size i = 0; i != precursors_rt.size(); ++i)
+      // group MS2 scans under their survey scan, so each MS1 is looked up once
+      // and shared by all its dependent MS2 scans
+      vector<pair<Size, vector<Size>>> groups = groupBySurveyScan_(exp);
+      Size grouped_scans = 0;
+      for (const auto& group : groups)
       {
-        double rt = precursors_rt[i]; // get precursor rt        
-        double mz = precursors[i].getMZ(); // get precursor MZ
-
-        // retrieves iterator of the MS2 fragment spectrum
-        MSExperiment::ConstIterator rt_it = exp.RTBegin(rt - 1e-8);
-
-        // store index of MS2 spectrum
-        UInt precursor_spectrum_idx = rt_it - exp.begin();
+        grouped_scans += group.second.size();
+      }
 
-        // get parent (MS1) of precursor spectrum
-        rt_it = exp.getPrecursorSpectrum(rt_it);
+      // per-scan result slots; merged in scan order below so the output does not
+      // depend on the OpenMP schedule
+      vector<double> scan_delta_mz(exp.size(), 0.0);
+      vector<char> scan_corrected(exp.size(), 0);
 
-        if (rt_it == exp.end() 
-        || rt_it->getMSLevel() != 1)
+#pragma omp parallel for
+      for (SignedSize g = 0; g < (SignedSize)groups.size(); ++g)
+      {
+        const MSSpectrum& ms1 = exp[groups[g].first];
+        for (Size scan : groups[g].second)
         {
-          OPENMS_LOG_WARN << "Warning: no MS1 spectrum for this precursor" << endl;
-          continue;
+          double delta_mz;
+          if (correctToMS1Peak(ms1, exp[scan], mz_tolerance, ppm, true, delta_mz))
+          {
+            scan_delta_mz[scan] = delta_mz;
+            scan_corrected[scan] = 1;
+          }
         }
+      }
 
-        // get tolerance window and index of highest peak
-        std::pair<double,double> tolerance_window = Math::getTolWindow(mz, mz_tolerance, ppm);
-        int highest_peak_idx = rt_it->findHighestInWindow(mz, mz-tolerance_window.first, tolerance_window.second-mz);
-
-        // no MS1 precursor peak in +- tolerance window found
-        if (highest_peak_idx == -1)
+      for (Size i = 0; i != exp.size(); ++i)
+      {
+        if (scan_corrected[i] == 0)
         {
-          count_error_highest_intenstiy += 1;
           continue;
         }
-
-        // get actual position and intensity of highest intensity peak
-        double highest_peak_mz = (*rt_it)[highest_peak_idx].getMZ();
-        double highest_peak_int = (*rt_it)[highest_peak_idx].getIntensity();
-
-        // cout << mz << " -> " << nearest_peak_mz << endl;
-        double delta_mz = highest_peak_mz - mz;
-        delta_mzs.push_back(delta_mz);
-        mzs.push_back(mz);
-        rts.push_back(rt);
-        // correct entries
-        Precursor corrected_prec = precursors[i];
-        corrected_prec.setMZ(highest_peak_mz);
-        corrected_prec.setIntensity(highest_peak_int);
-        exp[precursor_spectrum_idx].getPrecursors()[0] = corrected_prec;
-        corrected_precursors.insert(precursor_spectrum_idx);
+        delta_mzs.push_back(scan_delta_mz[i]);
+        mzs.push_back(exp[i].getPrecursors()[0].getMZ() - scan_delta_mz[i]); // uncorrected m/z
+        rts.push_back(exp[i].getRT());
+        corrected_precursors.insert(i);
       }
 
+      // no MS1 precursor peak in +- tolerance window found
+      int count_error_highest_intenstiy = (int)(grouped_scans - corrected_precursors.size());
+
       if (count_error_highest_intenstiy != 0)
       {
         OPENMS_LOG_INFO << "Correction to the highest intensity peak failed " 
@@ -216,6 +175,88 @@ namespace OpenMS
       return corrected_precursors;
     }
 
+    bool PrecursorCorrection::correctToMS1Peak(const MSSpectrum& ms1,
+                                               MSSpectrum& ms2,
+                                               double mz_tolerance,
+                                               bool ppm,
+                                               bool highest_intensity,
+                                               double& delta_mz)
+    {
+      delta_mz = 0.0;
+      if (ms1.empty() || ms2.getPrecursors().empty())
+      {
+        return false;
+      }
+
+      Precursor& precursor = ms2.getPrecursors()[0];
+      const double mz = precursor.getMZ();
+
+      if (highest_intensity)
+      {
+        // get tolerance window and index of highest peak
+        std::pair<double, double> tolerance_window = Math::getTolWindow(mz, mz_tolerance, ppm);
+        int highest_peak_idx = ms1.findHighestInWindow(mz, mz - tolerance_window.first, tolerance_window.second - mz);
+
+        // no MS1 precursor peak in +- tolerance window found
+        if (highest_peak_idx == -1)
+        {
+          return false;
+        }
+        delta_mz = ms1[highest_peak_idx].getMZ() - mz;
+        precursor.setMZ(ms1[highest_peak_idx].getMZ());
+        precursor.setIntensity(ms1[highest_peak_idx].getIntensity());
+        return true;
+      }
+
+      // find peak (index) closest to expected position
+      Size nearest_peak_idx = ms1.findNearest(mz);
+
+      // get actual position of closest peak
+      double nearest_peak_mz = ms1[nearest_peak_idx].getMZ();
+
+      // calculate error between expected and actual position
+      double nearest_peak_error = ppm ? fabs(nearest_peak_mz - mz) / mz * 1e6 : fabs(nearest_peak_mz - mz);
+
+      // check if error is small enough
+      if (nearest_peak_error >= mz_tolerance)
+      {
+        return false;
+      }
+      delta_mz = nearest_peak_mz - mz;
+      precursor.setMZ(nearest_peak_mz);
+      return true;
+    }
+
+    vector<pair<Size, vector<Size>>> PrecursorCorrection::groupBySurveyScan_(const MSExperiment& exp)
+    {
+      vector<pair<Size, vector<Size>>> groups;
+      SignedSize current_ms1 = -1;
+      for (Size i = 0; i != exp.size(); ++i)
+      {
+        if (exp[i].getMSLevel() == 1)
+        {
+          current_ms1 = (SignedSize)i;
+          continue;
+        }
+        if (exp[i].getPrecursors().empty())
+        {
+          continue;
+        }
+        // MSn (n > 2) scans have no MS1 parent either
+        if (exp[i].getMSLevel() != 2 || current_ms1 == -1)
+        {
+          OPENMS_LOG_WARN << "Warning: no MS1 spectrum for this precursor" << endl;
+          continue;
+        }
+        if (groups.empty() || groups.back().first != (Size)current_ms1)
+        {
+          groups.emplace_back((Size)current_ms1, vector<Size>());
+        }
+        groups.back().second.push_back(i);
+      }
+      return groups;
+    }
+
     set<Size> PrecursorCorrection::correctToNearestFeature(const FeatureMap& features,
                                                            MSExperiment & exp,
                                                            double rt_tolerance_s,
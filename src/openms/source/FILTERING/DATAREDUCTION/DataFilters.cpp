@@ -8,9 +8,12 @@
 
 #include <OpenMS/FILTERING/DATAREDUCTION/DataFilters.h>
 #include <OpenMS/KERNEL/Feature.h>
+#include <OpenMS/KERNEL/MSExperiment.h>
 #include <OpenMS/METADATA/MetaInfo.h>
 #include <OpenMS/KERNEL/ConsensusFeature.h>
 
+#include <numeric>
+
 using namespace std;
 
 namespace OpenMS
@@ -266,6 +269,155 @@ namespace OpenMS
     return filters_[index];
   }
 
+  namespace
+  {
+    /// A peak filter "compiled" against the data arrays of one spectrum:
+    /// all name look-ups are done, only the comparisons remain
+    struct CompiledPeakFilter
+    {
+      DataFilters::FilterOperation op;
+      double value;
+      const MSSpectrum::FloatDataArray* f_array; // meta data filter on a float data array
+      const MSSpectrum::IntegerDataArray* i_array; // meta data filter on an integer data array
+      // both null: filter on the peak intensity
+    };
+
+    /// Translates @p filters into comparisons against @p spectrum, mirroring
+    /// the semantics of DataFilters::passes() for peaks. Returns false if
+    /// some filter can never pass (i.e. a meta data array is missing).
+    bool compilePeakFilters_(const std::vector<DataFilters::DataFilter>& filters,
+                             const MSSpectrum& spectrum,
+                             std::vector<CompiledPeakFilter>& compiled)
+    {
+      compiled.clear();
+      for (const DataFilters::DataFilter& filter : filters)
+      {
+        if (filter.op == DataFilters::EXISTS)
+        {
+          continue; // only relevant for META_DATA, checked via array presence below
+        }
+        if (filter.field == DataFilters::INTENSITY)
+        {
+          compiled.push_back({filter.op, filter.value, nullptr, nullptr});
+        }
+        else if (filter.field == DataFilters::META_DATA)
+        {
+          bool found = false;
+          for (const MSSpectrum::FloatDataArray& f_array : spectrum.getFloatDataArrays())
+          {
+            if (f_array.getName() == filter.meta_name)
+            {
+              compiled.push_back({filter.op, filter.value, &f_array, nullptr});
+              found = true;
+              break;
+            }
+          }
+          for (const MSSpectrum::IntegerDataArray& i_array : spectrum.getIntegerDataArrays())
+          {
+            if (i_array.getName() == filter.meta_name)
+            {
+              compiled.push_back({filter.op, filter.value, nullptr, &i_array});
+              found = true;
+              break;
+            }
+          }
+          if (!found) return false; // no peak can pass this filter
+        }
+        // QUALITY, CHARGE, SIZE do not apply to peaks (as in passes())
+      }
+      return true;
+    }
+
+    /// Evaluates the compiled filter list for one peak
+    inline bool peakPasses_(const MSSpectrum& spectrum, Size peak_index,
+                            const std::vector<CompiledPeakFilter>& compiled)
+    {
+      for (const CompiledPeakFilter& filter : compiled)
+      {
+        double value;
+        if (filter.f_array != nullptr) value = (*filter.f_array)[peak_index];
+        else if (filter.i_array != nullptr) value = (*filter.i_array)[peak_index];
+        else value = spectrum[peak_index].getIntensity();
+
+        switch (filter.op)
+        {
+          case DataFilters::GREATER_EQUAL:
+            if (value < filter.value) return false;
+            break;
+
+          case DataFilters::EQUAL:
+            if (value != filter.value) return false;
+            break;
+
+          case DataFilters::LESS_EQUAL:
+            if (value > filter.value) return false;
+            break;
+
+          default:
+            break;
+        }
+      }
+      return true;
+    }
+  }
+
+  void DataFilters::passedIndices(const MSSpectrum& spectrum, std::vector<Size>& indices) const
+  {
+    indices.clear();
+    if (!is_active_)
+    {
+      indices.resize(spectrum.size());
+      std::iota(indices.begin(), indices.end(), Size(0));
+      return;
+    }
+
+    std::vector<CompiledPeakFilter> compiled;
+    if (!compilePeakFilters_(filters_, spectrum, compiled))
+    {
+      return; // a required meta data array is missing - nothing passes
+    }
+
+    // specialized loop for the most common (interactive) setting, a single
+    // intensity threshold:
+    if ((compiled.size() == 1) && (compiled[0].f_array == nullptr) &&
+        (compiled[0].i_array == nullptr) && (compiled[0].op == GREATER_EQUAL))
+    {
+      const double threshold = compiled[0].value;
+      for (Size i = 0; i < spectrum.size(); ++i)
+      {
+        if (spectrum[i].getIntensity() >= threshold) indices.push_back(i);
+      }
+      return;
+    }
+
+    for (Size i = 0; i < spectrum.size(); ++i)
+    {
+      if (peakPasses_(spectrum, i, compiled)) indices.push_back(i);
+    }
+  }
+
+  void DataFilters::filterPeakMap(MSExperiment& exp) const
+  {
+    if (!is_active_)
+    {
+      return;
+    }
+#pragma omp parallel
+    {
+      std::vector<Size> indices; // reused across spectra of this thread
+#pragma omp for schedule(dynamic)
+      for (SignedSize s = 0; s < (SignedSize)exp.size(); ++s)
+      {
+        MSSpectrum& spectrum = exp.getSpectra()[s];
+        passedIndices(spectrum, indices);
+        if (indices.size() < spectrum.size())
+        {
+          spectrum.select(indices); // keeps the data arrays in sync
+        }
+      }
+    }
+  }
+
   bool DataFilters::passes(const Feature & feature) const
   {
     if (!is_active_)
@@ -12,30 +12,25 @@
 #include <OpenMS/FILTERING/DATAREDUCTION/Deisotoper.h>
 #include <OpenMS/FILTERING/TRANSFORMERS/NLargest.h>
 #include <OpenMS/FILTERING/TRANSFORMERS/ThresholdMower.h>
+#include <OpenMS/KERNEL/MSExperiment.h>
 #include <OpenMS/KERNEL/MSSpectrum.h>
 #include <OpenMS/KERNEL/StandardTypes.h>
 #include <OpenMS/MATH/MISC/MathFunctions.h>
 
+#include <algorithm>
+
 namespace OpenMS
 {
 
-// static
-void Deisotoper::deisotopeWithAveragineModel(MSSpectrum& spec,
-  double fragment_tolerance,
-  bool fragment_unit_ppm,
-  int number_of_final_peaks,
-  int min_charge,
-  int max_charge,
-  bool keep_only_deisotoped,
-  unsigned int min_isopeaks,
-  unsigned int max_isopeaks,
-  bool make_single_charged,
-  bool annotate_charge,
-  bool annotate_iso_peak_count,
-  bool add_up_intensity)
+namespace
 {
-  OPENMS_PRECONDITION(spec.isSorted(), "Spectrum must be sorted.");
 
+// common argument validation of all deisotoping entry points
+void checkDeisotopingArguments(double fragment_tolerance,
+                               bool fragment_unit_ppm,
+                               unsigned int min_isopeaks,
+                               unsigned int max_isopeaks)
+{
     if ((fragment_unit_ppm && fragment_tolerance > 100) || (!fragment_unit_ppm && fragment_tolerance > 0.1))
     {
         throw Exception::IllegalArgument(
@@ -52,6 +47,80 @@ void Deisotoper::deisotopeWithAveragineModel(MSSpectrum& spec,
       OPENMS_PRETTY_FUNCTION,
       "Minimum/maximum number of isotopic peaks must be at least 2 (and min_isopeaks <= max_isopeaks).");
   }
+}
+
+// reusable working buffers for the deisotoping of a single spectrum; the
+// experiment-level drivers keep one instance per thread so that the buffers
+// are allocated only once instead of once per spectrum
+struct DeisotoperWorkspace
+{
+  std::vector<Size> mono_isotopic_peak_charge;
+  std::vector<Int> features;
+  std::vector<double> mono_iso_peak_intensity;
+  std::vector<Size> iso_peak_count;
+  std::vector<Size> extensions;
+  std::vector<Size> clusters;
+  std::vector<Size> stored_cluster_size;
+  std::vector<int> charges_of_extensions;
+  std::vector<double> extensions_intensities;
+  std::vector<double> distr;
+  std::vector<Size> select_idx;
+};
+
+// precomputed averagine intensity approximations for the KL-divergence check:
+// one row of CoarseIsotopePatternGenerator::approximateIntensities() per
+// MASS_STEP Da, shared read-only by all threads of the experiment-level driver
+class AveragineLookupTable
+{
+public:
+  static constexpr double MASS_STEP = 10.0;
+
+  AveragineLookupTable(double max_mass, UInt num_peaks) :
+    num_peaks_(num_peaks),
+    rows_(Size(std::max(max_mass, 0.0) / MASS_STEP) + 2)
+  {
+    table_.reserve(rows_ * num_peaks_);
+    for (Size row = 0; row < rows_; ++row)
+    {
+      const std::vector<double> distr = CoarseIsotopePatternGenerator::approximateIntensities(row * MASS_STEP, num_peaks_);
+      table_.insert(table_.end(), distr.begin(), distr.end());
+    }
+  }
+
+  /// approximate intensities for the tabulated mass closest to @p mass
+  const double* intensities(double mass) const
+  {
+    Size row = (mass <= 0.0) ? 0 : Size(mass / MASS_STEP + 0.5);
+    if (row >= rows_) { row = rows_ - 1; }
+    return &table_[row * num_peaks_];
+  }
+
+private:
+  UInt num_peaks_;
+  Size rows_;
+  std::vector<double> table_;
+};
+
+// implementation of Deisotoper::deisotopeWithAveragineModel(); assumes validated
+// arguments, uses the buffers of @p wsp and - if given - the averagine intensities
+// from @p averagine_table instead of regenerating the model per peak and charge
+void deisotopeWithAveragineModel_(MSSpectrum& spec,
+  double fragment_tolerance,
+  bool fragment_unit_ppm,
+  int number_of_final_peaks,
+  int min_charge,
+  int max_charge,
+  bool keep_only_deisotoped,
+  unsigned int min_isopeaks,
+  unsigned int max_isopeaks,
+  bool make_single_charged,
+  bool annotate_charge,
+  bool annotate_iso_peak_count,
+  bool add_up_intensity,
+  DeisotoperWorkspace& wsp,
+  const AveragineLookupTable* averagine_table)
+{
+  OPENMS_PRECONDITION(spec.isSorted(), "Spectrum must be sorted.");
 
   if (spec.empty()) { return; }
 
@@ -65,7 +134,7 @@ void Deisotoper::deisotopeWithAveragineModel(MSSpectrum& spec,
     // only keep number_of_final_peaks highest peaks
     NLargest nlargest_filter = NLargest(number_of_final_peaks);
     nlargest_filter.filterPeakSpectrum(spec);
-    
+
     spec.sortByPosition();
   }
 
@@ -93,19 +162,23 @@ void Deisotoper::deisotopeWithAveragineModel(MSSpectrum& spec,
   const MSSpectrum& old_spectrum = spec;
 
   // determine charge seeds and extend them
-  std::vector<Size> mono_isotopic_peak_charge(old_spectrum.size(), 0);
-  std::vector<Int> features(old_spectrum.size(), -1);
-  std::vector<double> mono_iso_peak_intensity(old_spectrum.size(), 0);
-  std::vector<Size> iso_peak_count(old_spectrum.size(), 1);
+  std::vector<Size>& mono_isotopic_peak_charge = wsp.mono_isotopic_peak_charge;
+  mono_isotopic_peak_charge.assign(old_spectrum.size(), 0);
+  std::vector<Int>& features = wsp.features;
+  features.assign(old_spectrum.size(), -1);
+  std::vector<double>& mono_iso_peak_intensity = wsp.mono_iso_peak_intensity;
+  mono_iso_peak_intensity.assign(old_spectrum.size(), 0);
+  std::vector<Size>& iso_peak_count = wsp.iso_peak_count;
+  iso_peak_count.assign(old_spectrum.size(), 1);
   int feature_number = 0;
 
-  std::vector<Size> extensions;
+  std::vector<Size>& extensions = wsp.extensions;
 
   // this should be a vector of vectors of length <= max_isopeaks to reflect multiple possible extensions, but for runtime, this is implemented as a flat vector
-  std::vector<Size> clusters;
+  std::vector<Size>& clusters = wsp.clusters;
   // keeps track of the stored clusters sizes
-  std::vector<Size> stored_cluster_size;
-  std::vector<int> charges_of_extensions;
+  std::vector<Size>& stored_cluster_size = wsp.stored_cluster_size;
+  std::vector<int>& charges_of_extensions = wsp.charges_of_extensions;
 
   const float averagine_check_threshold[7] = {0.0f, 0.0f, 0.05f, 0.1f, 0.2f, 0.4f, 0.6f};
 
@@ -133,7 +206,7 @@ void Deisotoper::deisotopeWithAveragineModel(MSSpectrum& spec,
     charges_of_extensions.clear();
 
     for (int q = min_charge; q <= max_charge; ++q) // all charges are always considered -> order does not matter
-    {      
+    {
       // try to extend isotopes from mono-isotopic peak
 
       // do not bother testing charges q (and masses m) with: m/q > precursor_mass/q (or m > precursor_mass)
@@ -150,7 +223,7 @@ void Deisotoper::deisotopeWithAveragineModel(MSSpectrum& spec,
       const double expected_first_mz = current_mz + Constants::C13C12_MASSDIFF_U / static_cast<double>(q);
       Int p = old_spectrum.findNearest(expected_first_mz, tolerance_dalton);
       if (p == -1) // test for missing peak
-      { 
+      {
         continue;
       }
 
@@ -162,11 +235,22 @@ void Deisotoper::deisotopeWithAveragineModel(MSSpectrum& spec,
       extensions.push_back(current_peak);
 
       // Save frequently used values for performance reasons
-      std::vector<double> extensions_intensities = {current_intensity};
-      
+      std::vector<double>& extensions_intensities = wsp.extensions_intensities;
+      extensions_intensities.clear();
+      extensions_intensities.push_back(current_intensity);
+
       // generate averagine distribution for peptide mass corresponding to current mz and charge
-      std::vector<double> distr = CoarseIsotopePatternGenerator::approximateIntensities(q * (current_mz - Constants::PROTON_MASS_U), max_isopeaks);
-      
+      const double* distr;
+      if (averagine_table != nullptr)
+      {
+        distr = averagine_table->intensities(q * (current_mz - Constants::PROTON_MASS_U));
+      }
+      else
+      {
+        wsp.distr = CoarseIsotopePatternGenerator::approximateIntensities(q * (current_mz - Constants::PROTON_MASS_U), max_isopeaks);
+        distr = wsp.distr.data();
+      }
+
       // sum of intensities of both observed and generated peaks is needed for normalization
       double spec_total_intensity = current_intensity;
       double dist_total_intensity = distr[0];
@@ -202,7 +286,7 @@ void Deisotoper::deisotopeWithAveragineModel(MSSpectrum& spec,
         float KL = 0;
         for (unsigned int peak = 0; peak != extensions.size() + 1; ++peak)
         {
-          // normalize spectrum intensities and averagine distribution intensities as this is a density measure and 
+          // normalize spectrum intensities and averagine distribution intensities as this is a density measure and
           // thresholds were probably determined for distributions adding up to 1
           double Px = extensions_intensities[peak] / spec_total_intensity;
           KL += Px * log(Px / (distr[peak] / dist_total_intensity));
@@ -210,7 +294,7 @@ void Deisotoper::deisotopeWithAveragineModel(MSSpectrum& spec,
 
         // choose threshold corresponding to cluster size
         float curr_threshold = (extensions.size() + 1 >= 6) ? averagine_check_threshold[6] : averagine_check_threshold[extensions.size() + 1];
-          
+
         // compare to threshold and stop extension if distribution does not fit well enough
         if (KL > curr_threshold)
         {
@@ -276,7 +360,8 @@ void Deisotoper::deisotopeWithAveragineModel(MSSpectrum& spec,
   }
 
   // apply changes, i.e. select the indices which should survive
-  std::vector<Size> select_idx;
+  std::vector<Size>& select_idx = wsp.select_idx;
+  select_idx.clear();
 
   for (size_t i = 0; i != spec.size(); ++i)
   {
@@ -325,8 +410,9 @@ void Deisotoper::deisotopeWithAveragineModel(MSSpectrum& spec,
   return;
 }
 
-// static
-void Deisotoper::deisotopeAndSingleCharge(MSSpectrum& spec,
+// implementation of Deisotoper::deisotopeAndSingleCharge(); assumes validated
+// arguments and uses the buffers of @p wsp
+void deisotopeAndSingleCharge_(MSSpectrum& spec,
                       double fragment_tolerance,
                       bool fragment_unit_ppm,
                       int min_charge,
@@ -339,30 +425,14 @@ void Deisotoper::deisotopeAndSingleCharge(MSSpectrum& spec,
                       bool annotate_iso_peak_count,
                       bool use_decreasing_model,
                       unsigned int start_intensity_check,
-                      bool add_up_intensity)
+                      bool add_up_intensity,
+                      DeisotoperWorkspace& wsp)
 {
   OPENMS_PRECONDITION(spec.isSorted(), "Spectrum must be sorted.");
 
-    if ((fragment_unit_ppm && fragment_tolerance > 100) || (!fragment_unit_ppm && fragment_tolerance > 0.1))
-    {
-        throw Exception::IllegalArgument(
-                __FILE__,
-                __LINE__,
-                OPENMS_PRETTY_FUNCTION,
-                "Fragment tolerance must not be greater than 100 ppm or 0.1 Da");
-    }
-
-  if (min_isopeaks < 2 || max_isopeaks < 2 || min_isopeaks > max_isopeaks)
-  {
-    throw Exception::IllegalArgument(__FILE__,
-		    __LINE__,
-		    OPENMS_PRETTY_FUNCTION,
-		    "Minimum/maximum number of isotopic peaks must be at least 2 (and min_isopeaks <= max_isopeaks).");
-  }
-
   if (spec.empty())
-  { 
-    return; 
+  {
+    return;
   }
 
   Size charge_index(0);
@@ -388,13 +458,17 @@ void Deisotoper::deisotopeAndSingleCharge(MSSpectrum& spec,
   const MSSpectrum& old_spectrum = spec;
 
   // determine charge seeds and extend them
-  std::vector<size_t> mono_isotopic_peak(old_spectrum.size(), 0);
-  std::vector<int> features(old_spectrum.size(), -1);
-  std::vector<double> mono_iso_peak_intensity(old_spectrum.size(), 0);
-  std::vector<Size> iso_peak_count(old_spectrum.size(), 1);
+  std::vector<Size>& mono_isotopic_peak = wsp.mono_isotopic_peak_charge;
+  mono_isotopic_peak.assign(old_spectrum.size(), 0);
+  std::vector<Int>& features = wsp.features;
+  features.assign(old_spectrum.size(), -1);
+  std::vector<double>& mono_iso_peak_intensity = wsp.mono_iso_peak_intensity;
+  mono_iso_peak_intensity.assign(old_spectrum.size(), 0);
+  std::vector<Size>& iso_peak_count = wsp.iso_peak_count;
+  iso_peak_count.assign(old_spectrum.size(), 1);
   int feature_number = 0;
 
-  std::vector<size_t> extensions;
+  std::vector<Size>& extensions = wsp.extensions;
 
   bool has_precursor_data(false);
   double precursor_mass(0);
@@ -485,7 +559,8 @@ void Deisotoper::deisotopeAndSingleCharge(MSSpectrum& spec,
   }
 
   // apply changes, i.e. select the indices which should survive
-  std::vector<Size> select_idx;
+  std::vector<Size>& select_idx = wsp.select_idx;
+  select_idx.clear();
 
   for (size_t i = 0; i != spec.size(); ++i)
   {
@@ -529,4 +604,137 @@ void Deisotoper::deisotopeAndSingleCharge(MSSpectrum& spec,
   spec.sortByPosition();
   return;
 }
+
+} // anonymous namespace
+
+// static
+void Deisotoper::deisotopeWithAveragineModel(MSSpectrum& spec,
+  double fragment_tolerance,
+  bool fragment_unit_ppm,
+  int number_of_final_peaks,
+  int min_charge,
+  int max_charge,
+  bool keep_only_deisotoped,
+  unsigned int min_isopeaks,
+  unsigned int max_isopeaks,
+  bool make_single_charged,
+  bool annotate_charge,
+  bool annotate_iso_peak_count,
+  bool add_up_intensity)
+{
+  checkDeisotopingArguments(fragment_tolerance, fragment_unit_ppm, min_isopeaks, max_isopeaks);
+
+  DeisotoperWorkspace wsp;
+  deisotopeWithAveragineModel_(spec, fragment_tolerance, fragment_unit_ppm,
+    number_of_final_peaks, min_charge, max_charge, keep_only_deisotoped,
+    min_isopeaks, max_isopeaks, make_single_charged, annotate_charge,
+    annotate_iso_peak_count, add_up_intensity, wsp, nullptr);
+}
+
+// static
+void Deisotoper::deisotopeWithAveragineModel(MSExperiment& exp,
+  double fragment_tolerance,
+  bool fragment_unit_ppm,
+  UInt ms_level,
+  int number_of_final_peaks,
+  int min_charge,
+  int max_charge,
+  bool keep_only_deisotoped,
+  unsigned int min_isopeaks,
+  unsigned int max_isopeaks,
+  bool make_single_charged,
+  bool annotate_charge,
+  bool annotate_iso_peak_count,
+  bool add_up_intensity)
+{
+  // validate here; throwing from inside the parallel region would terminate
+  checkDeisotopingArguments(fragment_tolerance, fragment_unit_ppm, min_isopeaks, max_isopeaks);
+
+  // the largest mass that can be queried determines the size of the lookup table
+  double max_mz = 0.0;
+  for (const MSSpectrum& spec : exp)
+  {
+    if (spec.getMSLevel() == ms_level && !spec.empty())
+    {
+      max_mz = std::max(max_mz, spec.back().getMZ());
+    }
+  }
+  const AveragineLookupTable averagine_table(max_mz * max_charge, max_isopeaks);
+
+#pragma omp parallel
+  {
+    DeisotoperWorkspace wsp;
+#pragma omp for schedule(dynamic)
+    for (SignedSize i = 0; i < (SignedSize)exp.size(); ++i)
+    {
+      if (exp[i].getMSLevel() != ms_level) continue;
+
+      deisotopeWithAveragineModel_(exp[i], fragment_tolerance, fragment_unit_ppm,
+        number_of_final_peaks, min_charge, max_charge, keep_only_deisotoped,
+        min_isopeaks, max_isopeaks, make_single_charged, annotate_charge,
+        annotate_iso_peak_count, add_up_intensity, wsp, &averagine_table);
+    }
+  }
+}
+
+// static
+void Deisotoper::deisotopeAndSingleCharge(MSSpectrum& spec,
+                      double fragment_tolerance,
+                      bool fragment_unit_ppm,
+                      int min_charge,
+                      int max_charge,
+                      bool keep_only_deisotoped,
+                      unsigned int min_isopeaks,
+                      unsigned int max_isopeaks,
+                      bool make_single_charged,
+                      bool annotate_charge,
+                      bool annotate_iso_peak_count,
+                      bool use_decreasing_model,
+                      unsigned int start_intensity_check,
+                      bool add_up_intensity)
+{
+  checkDeisotopingArguments(fragment_tolerance, fragment_unit_ppm, min_isopeaks, max_isopeaks);
+
+  DeisotoperWorkspace wsp;
+  deisotopeAndSingleCharge_(spec, fragment_tolerance, fragment_unit_ppm,
+    min_charge, max_charge, keep_only_deisotoped, min_isopeaks, max_isopeaks,
+    make_single_charged, annotate_charge, annotate_iso_peak_count,
+    use_decreasing_model, start_intensity_check, add_up_intensity, wsp);
+}
+
+// static
+void Deisotoper::deisotopeAndSingleCharge(MSExperiment& exp,
+                      double fragment_tolerance,
+                      bool fragment_unit_ppm,
+                      UInt ms_level,
+                      int min_charge,
+                      int max_charge,
+                      bool keep_only_deisotoped,
+                      unsigned int min_isopeaks,
+                      unsigned int max_isopeaks,
+                      bool make_single_charged,
+                      bool annotate_charge,
+                      bool annotate_iso_peak_count,
+                      bool use_decreasing_model,
+                      unsigned int start_intensity_check,
+                      bool add_up_intensity)
+{
+  // validate here; throwing from inside the parallel region would terminate
+  checkDeisotopingArguments(fragment_tolerance, fragment_unit_ppm, min_isopeaks, max_isopeaks);
+
+#pragma omp parallel
+  {
+    DeisotoperWorkspace wsp;
+#pragma omp for schedule(dynamic)
+    for (SignedSize i = 0; i < (SignedSize)exp.size(); ++i)
+    {
+      if (exp[i].getMSLevel() != ms_level) continue;
+
+      deisotopeAndSingleCharge_(exp[i], fragment_tolerance, fragment_unit_ppm,
+        min_charge, max_charge, keep_only_deisotoped, min_isopeaks, max_isopeaks,
+        make_single_charged, annotate_charge, annotate_iso_peak_count,
+        use_decreasing_model, start_intensity_check, add_up_intensity, wsp);
+    }
+  }
+}
 } // namespace
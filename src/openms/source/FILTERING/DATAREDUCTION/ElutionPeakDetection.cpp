@@ -14,6 +14,9 @@
 
 #include <boost/dynamic_bitset.hpp>
 
+#include <algorithm>
+#include <numeric>
+
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -311,8 +314,22 @@ namespace OpenMS
 
     this->startProgress(0, mt_vec.size(), "elution peak detection");
     Size progress(0);
+
+    // trace lengths are highly skewed (some span the whole gradient); hand the longest
+    // traces out first and schedule dynamically, so a long trace picked up last cannot
+    // stall the tail of the loop
+    std::vector<Size> order(mt_vec.size());
+    std::iota(order.begin(), order.end(), Size(0));
+#ifdef _OPENMP
+    std::stable_sort(order.begin(), order.end(),
+                     [&mt_vec](Size a, Size b)
+                     {
+                       return mt_vec[a].getSize() > mt_vec[b].getSize();
+                     });
+#endif
+
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for schedule(dynamic)
 #endif
     for (SignedSize i = 0; i < (SignedSize) mt_vec.size(); ++i)
     {
@@ -324,7 +341,7 @@ namespace OpenMS
       ++progress;
 
       // push_back to 'single_mtraces' is protected, so threading is ok
-      detectElutionPeaks_(mt_vec[i], single_mtraces);
+      detectElutionPeaks_(mt_vec[order[i]], single_mtraces);
     }
 
     this->endProgress();
@@ -472,6 +489,8 @@ namespace OpenMS
         // *********************************************************************
         std::vector<PeakType> tmp_mt;
         std::vector<double> smoothed_tmp;
+        tmp_mt.reserve(mins[min_idx] - last_idx + 1);
+        smoothed_tmp.reserve(mins[min_idx] - last_idx + 1);
         while (last_idx <= mins[min_idx])
         {
           tmp_mt.push_back(*cp_it);
@@ -480,9 +499,9 @@ namespace OpenMS
           ++last_idx;
         }
 
-        // Create new mass trace, copy smoothed intensities
-        MassTrace new_mt(tmp_mt);
-        new_mt.setSmoothedIntensities(smoothed_tmp);
+        // Create new mass trace, handing over the peaks and smoothed intensities
+        MassTrace new_mt(std::move(tmp_mt));
+        new_mt.setSmoothedIntensities(std::move(smoothed_tmp));
 
         // check filter criteria
         bool pw_ok = true;
@@ -528,7 +547,7 @@ namespace OpenMS
 #pragma omp critical (OPENMS_ElutionPeakDetection_mtraces)
 #endif
           {
-            single_mtraces.push_back(new_mt);
+            single_mtraces.push_back(std::move(new_mt));
           }
         }
       }
@@ -543,20 +562,31 @@ namespace OpenMS
     // looking at the unit test, this method gives better fits than lowess smoothing
     // reference paper uses lowess smoothing
 
-    MSSpectrum spectrum;
+    // this function runs once per mass trace; reuse the buffers and the filter (whose
+    // coefficient tables only depend on the frame length) across calls within each thread
+    static thread_local MSSpectrum spectrum;
+    static thread_local std::vector<double> smoothed_intensities;
+    static thread_local SavitzkyGolayFilter sg;
+    static thread_local int sg_frame_length = -1;
+
+    spectrum.clear(true);
     for (Size i = 0; i != mt.getSize(); ++i)
     {
       spectrum.push_back(Peak1D(mt[i].getRT(), mt[i].getIntensity()));
     }
 
-    SavitzkyGolayFilter sg;
-    Param param;
-    param.setValue("polynomial_order", 2);
-    param.setValue("frame_length", std::max(3, win_size)); // frame length must be at least polynomial_order+1, otherwise SG will fail
-    sg.setParameters(param);
+    const int frame_length = std::max(3, win_size); // frame length must be at least polynomial_order+1, otherwise SG will fail
+    if (frame_length != sg_frame_length)
+    {
+      Param param;
+      param.setValue("polynomial_order", 2);
+      param.setValue("frame_length", frame_length);
+      sg.setParameters(param);
+      sg_frame_length = frame_length;
+    }
     sg.filter(spectrum);
     MSSpectrum::iterator iter = spectrum.begin();
-    std::vector<double> smoothed_intensities;
+    smoothed_intensities.clear();
     for (; iter != spectrum.end(); ++iter)
     {
       smoothed_intensities.push_back(iter->getIntensity());
@@ -8,11 +8,12 @@
 
 #include <OpenMS/FILTERING/DATAREDUCTION/FeatureOverlapFilter.h>
 
-#include <Quadtree.h>
-#include <Box.h>
-#include <unordered_set>
+#include <OpenMS/CONCEPT/TaskPool.h>
 
-#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <unordered_set>
 
 namespace OpenMS
 {
@@ -127,24 +128,7 @@ namespace OpenMS
     // Sort all features according to the comparator. After the sort, the "smallest" == best feature will be the first entry we will start processing with...
     std::stable_sort(fmap.begin(), fmap.end(), FeatureComparator);
 
-    const auto getBox = [](const Feature* f)
-    {
-        const auto& bb = f->getConvexHull().getBoundingBox();
-        return quadtree::Box<float>(bb.minY(), bb.minX(), bb.maxY()-bb.minY(), bb.maxX()-bb.minX());
-    };
-
-    float minMZ = fmap.getMinMZ();
-    float maxMZ = fmap.getMaxMZ();
-    float minRT = fmap.getMinRT();
-    float maxRT = fmap.getMaxRT();
-
-    // build quadtree with all features
-    quadtree::Box<float> fullExp(minMZ-1, minRT-1, maxMZ-minMZ+2, maxRT-minRT+2);
-    auto quadtree = quadtree::Quadtree<Feature*, decltype(getBox)>(fullExp, getBox);
-    for (auto& f : fmap)
-    {
-        quadtree.add(&f);
-    }        
+    const Size n = fmap.size();
 
     // if we check for overlapping traces we need a faster lookup structure
     FeatureBoundsMap fbm;
@@ -153,30 +137,85 @@ namespace OpenMS
       fbm = getFeatureBounds(fmap);
     }
 
+    // bounding boxes of the feature hulls (float, like the quadtree boxes used previously)
+    struct BoxBounds
+    {
+      float rt_min, rt_max, mz_min, mz_max;
+    };
+    std::vector<BoxBounds> boxes(n);
+    for (Size i = 0; i < n; ++i)
+    {
+      const auto& bb = fmap[i].getConvexHull().getBoundingBox();
+      boxes[i] = BoxBounds{(float)bb.minX(), (float)bb.maxX(), (float)bb.minY(), (float)bb.maxY()};
+    }
+
+    // sweep order over RT: features sorted by the start of their RT interval
+    std::vector<Size> order(n);
+    std::iota(order.begin(), order.end(), Size(0));
+    std::sort(order.begin(), order.end(), [&boxes](Size a, Size b)
+    {
+      return std::tie(boxes[a].rt_min, a) < std::tie(boxes[b].rt_min, b);
+    });
+
+    // RT sweep-line, parallelized over sweep positions: each position scans the features
+    // whose RT interval starts before its own box ends (= its active set in the sweep) and
+    // records the overlapping pairs; every pair is found exactly once, at the box starting
+    // earlier. This enumerates pairs output-sensitively instead of querying a spatial tree
+    // per feature. Overlap semantics are unchanged from the quadtree boxes used before:
+    // boxes must overlap strictly in both RT and m/z, i.e. shared edges do not count.
+    std::vector<std::vector<Size>> pairs(n); // pairs[k]: sweep positions of partners starting at or after order[k]
+    TaskPool::parallelFor(0, (SignedSize)n, 0, [&](SignedSize k)
+    {
+      const BoxBounds& box = boxes[order[k]];
+      for (Size j = k + 1; j < n && boxes[order[j]].rt_min < box.rt_max; ++j)
+      {
+        const BoxBounds& other = boxes[order[j]];
+        if (box.rt_min < other.rt_max && // the scan bound guarantees the other RT direction
+            box.mz_min < other.mz_max && other.mz_min < box.mz_max)
+        {
+          pairs[k].push_back(j);
+        }
+      }
+    });
+
+    // symmetric adjacency, indexed in feature (i.e. quality) order
+    std::vector<std::vector<Size>> overlapping(n);
+    for (Size k = 0; k < n; ++k)
+    {
+      for (Size j : pairs[k])
+      {
+        overlapping[order[k]].push_back(order[j]);
+        overlapping[order[j]].push_back(order[k]);
+      }
+    }
+    for (auto& o : overlapping)
+    {
+      std::sort(o.begin(), o.end()); // deterministic callback order
+    }
+
     std::unordered_set<Size> removed_uids;
-    for (auto& f : fmap)
+    for (Size i = 0; i < n; ++i)
     {
+      Feature& f = fmap[i];
       if (removed_uids.count(f.getUniqueId()) == 0)
       {
-        for (auto& overlap : quadtree.query(getBox(&f)))
+        for (Size j : overlapping[i])
         {
-          if ((overlap != &f))
+          Feature& overlap = fmap[j];
+          // Because feature boundaries might be large and lead to many overlapps, we (optionally) also can check if the boundaries of traces overlap
+          bool is_true_overlap = true;
+          if (check_overlap_at_trace_level)
           {
-            // Because feature boundaries might be large and lead to many overlapps, we (optionally) also can check if the boundaries of traces overlap
-            bool is_true_overlap = true;
-            if (check_overlap_at_trace_level)
-            {            
-              is_true_overlap = tracesOverlap(f, *overlap, fbm);
-            }
+            is_true_overlap = tracesOverlap(f, overlap, fbm);
+          }
 
-            if (is_true_overlap)
+          if (is_true_overlap)
+          {
+            // callback allows to e.g., transfer information from the to-be-removed feature to the representative feature
+            // if the callback returns false, overlap will not be removed (at least not because of an overlap with f)
+            if (FeatureOverlapCallback(f, overlap))
             {
-              // callback allows to e.g., transfer information from the to-be-removed feature to the representative feature
-              // if the callback returns false, overlap will not be removed (at least not because of an overlap with f)
-              if (FeatureOverlapCallback(f, *overlap)) 
-              {
-                removed_uids.insert(overlap->getUniqueId());
-              }                            
+              removed_uids.insert(overlap.getUniqueId());
             }
           }
         }
@@ -8,6 +8,7 @@
 
 #include <OpenMS/FILTERING/DATAREDUCTION/MassTraceDetection.h>
 
+#include <OpenMS/MATH/STATISTICS/QuantileSketch.h>
 #include <OpenMS/MATH/STATISTICS/StatisticFunctions.h>
 
 #include <boost/dynamic_bitset.hpp>
@@ -35,6 +36,8 @@ namespace OpenMS
       defaults_.setValue("min_sample_rate", 0.5, "Minimum fraction of scans along the mass trace that must contain a peak.", {"advanced"});
       defaults_.setValue("min_trace_length", 5.0, "Minimum expected length of a mass trace (in seconds).", {"advanced"});
       defaults_.setValue("max_trace_length", -1.0, "Maximum expected length of a mass trace (in seconds). Set to a negative value to disable maximal length check during mass trace detection.", {"advanced"});
+      defaults_.setValue("mz_bands", 1, "Number of overlapping m/z bands processed concurrently (requires OpenMS to be built with OpenMP to give a speedup). The default of 1 reproduces the classic single-threaded processing exactly; with more bands, traces wandering across a band border by more than the overlap margin can differ marginally and 'max_traces' is applied after merging the bands.", {"advanced"});
+      defaults_.setMinInt("mz_bands", 1);
 
       defaultsToParam_();
 
@@ -236,7 +239,14 @@ namespace OpenMS
       // Step 2: start extending mass traces beginning with the apex peak (go
       // through all peaks in order of decreasing intensity)
       // *********************************************************************
-      run_(chrom_apices, total_peak_count, work_exp, spec_offsets, found_masstraces, max_traces);
+      if (mz_bands_ > 1)
+      {
+        runTiled_(chrom_apices, total_peak_count, work_exp, spec_offsets, found_masstraces, max_traces);
+      }
+      else
+      {
+        run_(chrom_apices, total_peak_count, work_exp, spec_offsets, found_masstraces, max_traces);
+      }
 
       return;
     } // end of MassTraceDetection::run
@@ -247,6 +257,119 @@ namespace OpenMS
                                   const std::vector<Size>& spec_offsets,
                                   std::vector<MassTrace>& found_masstraces,
                                   const Size max_traces)
+    {
+      // keep_low >= keep_high disables the band filter: all traces are reported
+      extendApices_(chrom_apices, total_peak_count, work_exp, spec_offsets, found_masstraces, max_traces, 0.0, -1.0, nullptr, true);
+    }
+
+    void MassTraceDetection::runTiled_(const std::vector<Apex>& chrom_apices,
+                                       const Size total_peak_count,
+                                       const PeakMap& work_exp,
+                                       const std::vector<Size>& spec_offsets,
+                                       std::vector<MassTrace>& found_masstraces,
+                                       const Size max_traces)
+    {
+      const Size n_bands = mz_bands_;
+      if (chrom_apices.empty())
+      {
+        return;
+      }
+
+      std::vector<double> apex_mzs;
+      apex_mzs.reserve(chrom_apices.size());
+      for (const Apex& a : chrom_apices)
+      {
+        apex_mzs.push_back(work_exp[a.scan_idx][a.peak_idx].getMZ());
+      }
+
+      // band borders at apex m/z quantiles, so every band extends a similar number
+      // of apices; the bounded-memory sketch avoids sorting all apex m/z, and
+      // approximate quantiles are fine here -- any near-quantile split balances the bands
+      Math::QuantileSketch mz_sketch;
+      for (const double mz : apex_mzs)
+      {
+        mz_sketch.add(mz);
+      }
+      std::vector<double> bounds(n_bands + 1);
+      bounds[0] = -std::numeric_limits<double>::max();
+      bounds[n_bands] = std::numeric_limits<double>::max();
+      for (Size b = 1; b < n_bands; ++b)
+      {
+        bounds[b] = mz_sketch.quantile(double(b) / n_bands);
+      }
+
+      // Traces wander in m/z while being extended (3 sigma around a re-estimated centroid),
+      // so each band also extends apices within a generous margin around its borders; only
+      // traces whose apex falls into the band core are reported, the margin apices merely
+      // reproduce the competition for peaks which the untiled run would have.
+      const double margin_factor = 10.0 * mass_error_ppm_ * 1e-6;
+
+      std::vector<std::vector<MassTrace> > band_traces(n_bands);
+      std::vector<std::vector<double> > band_apex_ints(n_bands);
+
+      this->startProgress(0, n_bands, "mass trace detection (tiled)");
+      SignedSize bands_done(0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for (SignedSize b = 0; b < (SignedSize)n_bands; ++b)
+      {
+        std::vector<Apex> band_apices; // keeps the global (ascending intensity) sorting
+        for (Size i = 0; i < chrom_apices.size(); ++i)
+        {
+          const double margin = apex_mzs[i] * margin_factor;
+          if (apex_mzs[i] + margin >= bounds[b] && apex_mzs[i] - margin < bounds[b + 1])
+          {
+            band_apices.push_back(chrom_apices[i]);
+          }
+        }
+        extendApices_(band_apices, total_peak_count, work_exp, spec_offsets, band_traces[b], 0, bounds[b], bounds[b + 1], &band_apex_ints[b], false);
+#ifdef _OPENMP
+#pragma omp critical (MassTraceDetection_tiled)
+#endif
+        this->setProgress(++bands_done);
+      }
+      this->endProgress();
+
+      // merge the bands back into the global (descending apex intensity) processing order,
+      // relabel the traces and apply the trace limit
+      std::vector<std::pair<double, std::pair<Size, Size> > > order; // (apex intensity, (band, index))
+      for (Size b = 0; b < n_bands; ++b)
+      {
+        for (Size i = 0; i < band_traces[b].size(); ++i)
+        {
+          order.emplace_back(band_apex_ints[b][i], std::make_pair(b, i));
+        }
+      }
+      std::sort(order.begin(), order.end(),
+                [](const std::pair<double, std::pair<Size, Size> >& a,
+                   const std::pair<double, std::pair<Size, Size> >& b) -> bool
+      {
+        return a.first > b.first;
+      });
+
+      for (Size i = 0; i < order.size(); ++i)
+      {
+        MassTrace& trace = band_traces[order[i].second.first][order[i].second.second];
+        trace.setLabel("T" + String(i + 1));
+        found_masstraces.push_back(std::move(trace));
+        if (max_traces > 0 && found_masstraces.size() == max_traces)
+        {
+          break;
+        }
+      }
+    }
+
+    void MassTraceDetection::extendApices_(const std::vector<Apex>& chrom_apices,
+                                           const Size total_peak_count,
+                                           const PeakMap& work_exp,
+                                           const std::vector<Size>& spec_offsets,
+                                           std::vector<MassTrace>& found_masstraces,
+                                           const Size max_traces,
+                                           const double keep_low,
+                                           const double keep_high,
+                                           std::vector<double>* apex_intensities,
+                                           const bool with_progress)
     {
       boost::dynamic_bitset<> peak_visited(total_peak_count);
       Size trace_number(1);
@@ -274,9 +397,18 @@ namespace OpenMS
       }
 
 
-      this->startProgress(0, total_peak_count, "mass trace detection");
+      if (with_progress)
+      {
+        this->startProgress(0, total_peak_count, "mass trace detection");
+      }
       Size peaks_detected(0);
 
+      // scratch buffers for assembling traces; hoisted out of the loop so their capacity is
+      // reused across all candidate traces (the std::list used previously paid one heap
+      // allocation per collected peak, which dominates the runtime on large metabolomics maps)
+      std::vector<PeakType> trace_down_peaks; // peaks collected while walking down in RT (reverse RT order)
+      std::vector<PeakType> trace_up_peaks;   // apex plus peaks collected while walking up in RT
+
       for (auto m_it = chrom_apices.crbegin(); m_it != chrom_apices.crend(); ++m_it)
       {
         Size apex_scan_idx(m_it->scan_idx);
@@ -295,8 +427,9 @@ namespace OpenMS
         Size trace_up_idx(apex_scan_idx);
         Size trace_down_idx(apex_scan_idx);
 
-        std::list<PeakType> current_trace;
-        current_trace.push_back(apex_peak);
+        trace_down_peaks.clear();
+        trace_up_peaks.clear();
+        trace_up_peaks.push_back(apex_peak);
         std::vector<double> fwhms_mz; // peak-FWHM meta values of collected peaks
 
         // Initialization for the iterative version of weighted m/z mean calculation
@@ -360,7 +493,7 @@ namespace OpenMS
                 next_peak.setMZ(next_down_peak_mz);
                 next_peak.setIntensity(next_down_peak_int);
 
-                current_trace.push_front(next_peak);
+                trace_down_peaks.push_back(next_peak);
                 // FWHM average
                 if (fwhm_meta_idx != -1)
                 {
@@ -437,7 +570,7 @@ namespace OpenMS
                 next_peak.setMZ(next_up_peak_mz);
                 next_peak.setIntensity(next_up_peak_int);
 
-                current_trace.push_back(next_peak);
+                trace_up_peaks.push_back(next_peak);
                 if (fwhm_meta_idx != -1)
                 {
                   fwhms_mz.push_back(spec_trace_up.getFloatDataArrays()[fwhm_meta_idx][next_up_peak_idx]);
@@ -495,9 +628,11 @@ namespace OpenMS
         // std::cout << "current sr: " << current_sample_rate << std::endl;
         double num_scans(down_scan_counter + up_scan_counter + 1 - conseq_missed_peak_down - conseq_missed_peak_up);
 
-        double mt_quality((double)current_trace.size() / (double)num_scans);
+        const Size current_trace_size = trace_down_peaks.size() + trace_up_peaks.size();
+        double mt_quality((double)current_trace_size / (double)num_scans);
         // std::cout << "mt quality: " << mt_quality << std::endl;
-        double rt_range(std::fabs(current_trace.rbegin()->getRT() - current_trace.begin()->getRT()));
+        const PeakType& first_trace_peak = trace_down_peaks.empty() ? trace_up_peaks.front() : trace_down_peaks.back();
+        double rt_range(std::fabs(trace_up_peaks.back().getRT() - first_trace_peak.getRT()));
 
         // *********************************************************** //
         // Step 2.3 check if minimum length and quality of mass trace criteria are met
@@ -513,8 +648,20 @@ namespace OpenMS
             peak_visited[spec_offsets[gathered_idx[i].first] +  gathered_idx[i].second] = true;
           }
 
-          // create new MassTrace object and store collected peaks from list current_trace
-          MassTrace new_trace(current_trace);
+          // in tiled mode, traces whose apex lies outside the band core claim their peaks
+          // (see above), but are reported by the neighboring band
+          if (keep_low < keep_high && (apex_peak.getMZ() < keep_low || apex_peak.getMZ() >= keep_high))
+          {
+            continue;
+          }
+
+          // assemble the collected peaks into one contiguous, RT-sorted buffer and hand it
+          // over to the new MassTrace without copying the peaks again
+          std::vector<PeakType> trace_peaks;
+          trace_peaks.reserve(current_trace_size);
+          trace_peaks.insert(trace_peaks.end(), trace_down_peaks.rbegin(), trace_down_peaks.rend());
+          trace_peaks.insert(trace_peaks.end(), trace_up_peaks.begin(), trace_up_peaks.end());
+          MassTrace new_trace(std::move(trace_peaks));
           new_trace.updateWeightedMeanRT();
           new_trace.updateWeightedMeanMZ();
           if (!fwhms_mz.empty())
@@ -527,10 +674,17 @@ namespace OpenMS
           new_trace.setLabel("T" + String(trace_number));
           ++trace_number;
 
-          found_masstraces.push_back(new_trace);
-
           peaks_detected += new_trace.getSize();
-          this->setProgress(peaks_detected);
+          found_masstraces.push_back(std::move(new_trace));
+          if (apex_intensities != nullptr)
+          {
+            apex_intensities->push_back(m_it->intensity);
+          }
+
+          if (with_progress)
+          {
+            this->setProgress(peaks_detected);
+          }
 
           // check if we already reached the (optional) maximum number of traces
           if (max_traces > 0 && found_masstraces.size() == max_traces)
@@ -540,8 +694,10 @@ namespace OpenMS
         }
       }
 
-      this->endProgress();
-
+      if (with_progress)
+      {
+        this->endProgress();
+      }
     }
 
     void MassTraceDetection::updateMembers_()
@@ -557,6 +713,7 @@ namespace OpenMS
       min_trace_length_ = (double)param_.getValue("min_trace_length");
       max_trace_length_ = (double)param_.getValue("max_trace_length");
       reestimate_mt_sd_ = param_.getValue("reestimate_mt_sd").toBool();
+      mz_bands_ = (Size)param_.getValue("mz_bands");
     }
 
 }
@@ -12,6 +12,9 @@
 #include <OpenMS/KERNEL/MSSpectrum.h>
 #include <OpenMS/KERNEL/MSExperiment.h>
 
+#include <algorithm>
+#include <functional>
+
 using namespace std;
 
 namespace OpenMS
@@ -225,18 +228,60 @@ namespace OpenMS
     return 0.0;
   }
 
+  void SplineInterpolatedPeaks::Navigator::eval(const std::vector<double>& pos, std::vector<double>& intensity)
+  {
+    if (std::adjacent_find(pos.begin(), pos.end(), std::greater<double>()) != pos.end())
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Position vector is not sorted.");
+    }
+
+    const std::vector<SplinePackage>& packages = *packages_;
+    intensity.resize(pos.size());
+    if (pos.empty())
+    {
+      return;
+    }
+
+    size_t i = 0;
+    size_t package = 0;
+    while (i < pos.size())
+    {
+      // skip packages entirely left of the current position
+      while (package < packages.size() && pos[i] > packages[package].getPosMax())
+      {
+        ++package;
+      }
+      if (package == packages.size())
+      { // all remaining positions lie right of the last package
+        std::fill(intensity.begin() + i, intensity.end(), 0.0);
+        break;
+      }
+      // evaluate the run of positions up to the end of this package in one go
+      // (positions in the gap left of the package evaluate to zero)
+      size_t run_end = i + 1;
+      while (run_end < pos.size() && pos[run_end] <= packages[package].getPosMax())
+      {
+        ++run_end;
+      }
+      packages[package].eval(pos.begin() + i, pos.begin() + run_end, intensity.begin() + i);
+      i = run_end;
+    }
+    last_package_ = (package < packages.size()) ? package : packages.size() - 1;
+  }
+
   double SplineInterpolatedPeaks::Navigator::getNextPos(double pos)
   {
 
     int min_index = 0;
     int max_index = static_cast<Int>((*packages_).size()) - 1;
     int i = static_cast<Int>(last_package_);
-    SplinePackage package = (*packages_)[i];
+    // (note the reference: copying the package would copy all its spline coefficients)
+    const SplinePackage* package = &(*packages_)[i];
 
     // find correct package
-    while (!(package.isInPackage(pos)))
+    while (!(package->isInPackage(pos)))
     {
-      if (pos < package.getPosMin())
+      if (pos < package->getPosMin())
       {
         --i;
         // check index limit
@@ -246,14 +291,14 @@ namespace OpenMS
           return (*packages_)[min_index].getPosMin();
         }
         // m/z in the gap?
-        package = (*packages_)[i];
-        if (pos > package.getPosMax())
+        package = &(*packages_)[i];
+        if (pos > package->getPosMax())
         {
           last_package_ = i + 1;
           return (*packages_)[i + 1].getPosMin();
         }
       }
-      else if (pos > package.getPosMax())
+      else if (pos > package->getPosMax())
       {
 
         ++i;
@@ -264,17 +309,17 @@ namespace OpenMS
           return pos_max_;
         }
         // m/z in the gap?
-        package = (*packages_)[i];
-        if (pos < package.getPosMin())
+        package = &(*packages_)[i];
+        if (pos < package->getPosMin())
         {
           last_package_ = i;
-          return package.getPosMin();
+          return package->getPosMin();
         }
       }
     }
 
     // find m/z in the package
-    if (pos + pos_step_width_scaling_ * package.getPosStepWidth() > package.getPosMax())
+    if (pos + pos_step_width_scaling_ * package->getPosStepWidth() > package->getPosMax())
     {
       // The next step gets us outside the current package.
       // Let's move to the package to the right.
@@ -293,7 +338,7 @@ namespace OpenMS
     {
       // make a small step within the package
       last_package_ = i;
-      return pos + pos_step_width_scaling_ * package.getPosStepWidth();
+      return pos + pos_step_width_scaling_ * package->getPosStepWidth();
     }
   }
 
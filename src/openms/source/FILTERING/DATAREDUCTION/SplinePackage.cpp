@@ -9,6 +9,8 @@
 #include <OpenMS/KERNEL/StandardTypes.h>
 #include <OpenMS/FILTERING/DATAREDUCTION/SplinePackage.h>
 
+#include <algorithm>
+
 using namespace std;
 
 namespace OpenMS
@@ -61,4 +63,20 @@ namespace OpenMS
     }
   }
 
+  void SplinePackage::eval(std::vector<double>::const_iterator pos_begin, std::vector<double>::const_iterator pos_end, std::vector<double>::iterator intensity_begin) const
+  {
+    // positions left or right of the package evaluate to zero
+    std::vector<double>::const_iterator in_begin = lower_bound(pos_begin, pos_end, pos_min_);
+    std::vector<double>::const_iterator in_end = upper_bound(in_begin, pos_end, pos_max_);
+    intensity_begin = fill_n(intensity_begin, in_begin - pos_begin, 0.0);
+
+    spline_.eval(in_begin, in_end, intensity_begin);
+    for (std::vector<double>::const_iterator it = in_begin; it != in_end; ++it, ++intensity_begin)
+    {
+      *intensity_begin = max(0.0, *intensity_begin);
+    }
+
+    fill_n(intensity_begin, pos_end - in_end, 0.0);
+  }
+
 }
@@ -43,12 +43,26 @@ namespace OpenMS
   }
 
   void GaussFilter::filter(MSSpectrum & spectrum)
+  {
+    std::vector<double> mz_in, int_in, mz_out, int_out;
+    filterSpectrum_(spectrum, gauss_algo_, mz_in, int_in, mz_out, int_out);
+  }
+
+  void GaussFilter::filterSpectrum_(MSSpectrum & spectrum,
+                                    GaussFilterAlgorithm & algo,
+                                    std::vector<double> & mz_in,
+                                    std::vector<double> & int_in,
+                                    std::vector<double> & mz_out,
+                                    std::vector<double> & int_out)
   {
     // make sure the right data type is set
     spectrum.setType(SpectrumSettings::PROFILE);
     bool found_signal = false;
     const Size data_size = spectrum.size();
-    std::vector<double> mz_in(data_size), int_in(data_size), mz_out(data_size), int_out(data_size);
+    mz_in.resize(data_size);
+    int_in.resize(data_size);
+    mz_out.resize(data_size);
+    int_out.resize(data_size);
 
     // copy spectrum to container
     for (Size p = 0; p < spectrum.size(); ++p)
@@ -60,7 +74,7 @@ namespace OpenMS
     // apply filter
     auto mz_out_it = mz_out.begin();
     auto int_out_it = int_out.begin();
-    found_signal = gauss_algo_.filter(mz_in.begin(), mz_in.end(), int_in.begin(), mz_out_it, int_out_it);
+    found_signal = algo.filter(mz_in.begin(), mz_in.end(), int_in.begin(), mz_out_it, int_out_it);
 
     // If all intensities are zero in the scan and the scan has a reasonable size, throw an exception.
     // This is the case if the Gaussian filter is smaller than the spacing of raw data
@@ -93,13 +107,27 @@ namespace OpenMS
   {
     if (param_.getValue("use_ppm_tolerance").toBool())
     {
-      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, 
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
         "GaussFilter: Cannot use ppm tolerance on chromatograms");
     }
 
+    std::vector<double> rt_in, int_in, rt_out, int_out;
+    filterChromatogram_(chromatogram, gauss_algo_, rt_in, int_in, rt_out, int_out);
+  }
+
+  void GaussFilter::filterChromatogram_(MSChromatogram & chromatogram,
+                                        GaussFilterAlgorithm & algo,
+                                        std::vector<double> & rt_in,
+                                        std::vector<double> & int_in,
+                                        std::vector<double> & rt_out,
+                                        std::vector<double> & int_out)
+  {
     bool found_signal = false;
     const Size data_size = chromatogram.size();
-    std::vector<double> rt_in(data_size), int_in(data_size), rt_out(data_size), int_out(data_size);
+    rt_in.resize(data_size);
+    int_in.resize(data_size);
+    rt_out.resize(data_size);
+    int_out.resize(data_size);
 
     // copy spectrum to container
     for (Size p = 0; p < chromatogram.size(); ++p)
@@ -111,7 +139,7 @@ namespace OpenMS
     // apply filter
     auto mz_out_it = rt_out.begin();
     auto int_out_it = int_out.begin();
-    found_signal = gauss_algo_.filter(rt_in.begin(), rt_in.end(), int_in.begin(), mz_out_it, int_out_it);
+    found_signal = algo.filter(rt_in.begin(), rt_in.end(), int_in.begin(), mz_out_it, int_out_it);
 
     // If all intensities are zero in the scan and the scan has a reasonable size, throw an exception.
     // This is the case if the Gaussian filter is smaller than the spacing of raw data
@@ -142,18 +170,50 @@ namespace OpenMS
 
   void GaussFilter::filterExperiment(PeakMap & map)
   {
-    Size progress = 0;
-    startProgress(0, map.size() + map.getChromatograms().size(), "smoothing data");
-    for (Size i = 0; i < map.size(); ++i)
+    // fail before any spectrum was modified, as filter(MSChromatogram&) would
+    if (!map.getChromatograms().empty() && param_.getValue("use_ppm_tolerance").toBool())
     {
-      filter(map[i]);
-      setProgress(++progress);
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+        "GaussFilter: Cannot use ppm tolerance on chromatograms");
     }
 
-    for (Size i = 0; i < map.getChromatograms().size(); ++i)
+    Size progress = 0;
+    const SignedSize n_spectra = (SignedSize)map.size();
+    const SignedSize n_chroms = (SignedSize)map.getChromatograms().size();
+    startProgress(0, n_spectra + n_chroms, "smoothing data");
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     {
-      filter(map.getChromatogram(i));
-      setProgress(++progress);
+      // per-thread kernel and scratch buffers, reused across scans
+      // (the algorithm re-tabulates its coefficients per data point in ppm mode, so it must not be shared)
+      GaussFilterAlgorithm algo = gauss_algo_;
+      std::vector<double> mz_in, int_in, mz_out, int_out;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 100)
+#endif
+      for (SignedSize i = 0; i < n_spectra; ++i)
+      {
+        filterSpectrum_(map[i], algo, mz_in, int_in, mz_out, int_out);
+#ifdef _OPENMP
+#pragma omp critical (GaussFilterProgress)
+#endif
+        setProgress(++progress);
+      }
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 100)
+#endif
+      for (SignedSize i = 0; i < n_chroms; ++i)
+      {
+        filterChromatogram_(map.getChromatogram(i), algo, mz_in, int_in, mz_out, int_out);
+#ifdef _OPENMP
+#pragma omp critical (GaussFilterProgress)
+#endif
+        setProgress(++progress);
+      }
     }
     endProgress();
   }
@@ -8,7 +8,67 @@
 
 #include <OpenMS/FILTERING/TRANSFORMERS/LinearResamplerAlign.h>
 
+#include <cmath>
+
 namespace OpenMS
 {
+
+  void LinearResamplerAlign::raster_uniform(const double* mz_raw, const double* int_raw, Size n_raw,
+      double start_pos, double spacing, double* int_resampled, Size n_resampled)
+  {
+    OPENMS_PRECONDITION(n_resampled > 0, "Output grid cannot be empty") // as we use +1
+    OPENMS_PRECONDITION(spacing > 0, "Grid spacing needs to be positive")
+
+    const double inv_spacing = 1.0 / spacing;
+    const double end_pos = start_pos + (n_resampled - 1) * spacing;
+    for (Size i = 0; i < n_raw; ++i)
+    {
+      const double mz = mz_raw[i];
+
+      // intensity outside the grid is added to the first / last grid point (see raster())
+      if (mz <= start_pos)
+      {
+        int_resampled[0] += int_raw[i];
+        continue;
+      }
+      if (mz >= end_pos)
+      {
+        int_resampled[n_resampled - 1] += int_raw[i];
+        continue;
+      }
+
+      // index of the grid point left of the raw point; the guard catches the
+      // case that rounding pushes a point just below end_pos onto the last index
+      Size idx = static_cast<Size>((mz - start_pos) * inv_spacing);
+      if (idx >= n_resampled - 1)
+      {
+        int_resampled[n_resampled - 1] += int_raw[i];
+        continue;
+      }
+
+      const double pos_left = start_pos + idx * spacing;
+      double dist_left = std::fabs(mz - pos_left);
+      double dist_right = std::fabs(mz - (pos_left + spacing));
+
+      // distribute the intensity of the raw point according to the distance to the two neighboring grid points
+      int_resampled[idx] += int_raw[i] * dist_right / (dist_left + dist_right);
+      int_resampled[idx + 1] += int_raw[i] * dist_left / (dist_left + dist_right);
+    }
+  }
+
+  void LinearResamplerAlign::raster_uniform(const std::vector<const double*>& mz_arrays,
+      const std::vector<const double*>& int_arrays,
+      const std::vector<Size>& sizes,
+      double start_pos, double spacing, double* int_resampled, Size n_resampled)
+  {
+    OPENMS_PRECONDITION(mz_arrays.size() == int_arrays.size(), "Need one intensity array per m/z array")
+    OPENMS_PRECONDITION(mz_arrays.size() == sizes.size(), "Need one size per m/z array")
+
+    for (Size s = 0; s < mz_arrays.size(); ++s)
+    {
+      raster_uniform(mz_arrays[s], int_arrays[s], sizes[s], start_pos, spacing, int_resampled, n_resampled);
+    }
+  }
+
 }
 
@@ -0,0 +1,65 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+//
+#include <OpenMS/FILTERING/TRANSFORMERS/TopNPerWindowFilter.h>
+
+using namespace std;
+
+namespace OpenMS
+{
+  TopNPerWindowFilter::TopNPerWindowFilter() :
+    DefaultParamHandler("TopNPerWindowFilter")
+  {
+    defaults_.setValue("threshold", 0.0, "Intensity threshold, peaks below this threshold are discarded (0 keeps all peaks)");
+    defaults_.setValue("windowsize", 100.0, "The size of the jumping window along the m/z axis.");
+    defaults_.setValue("peakcount", 20, "The number of peaks that should be kept per window.");
+    defaults_.setValue("nlargest", 400, "The overall number of peaks to keep after the window filter.");
+    defaultsToParam_();
+  }
+
+  TopNPerWindowFilter::~TopNPerWindowFilter() = default;
+
+  TopNPerWindowFilter::TopNPerWindowFilter(const TopNPerWindowFilter& source) :
+    DefaultParamHandler(source)
+  {
+    updateMembers_();
+  }
+
+  TopNPerWindowFilter& TopNPerWindowFilter::operator=(const TopNPerWindowFilter& source)
+  {
+    if (this != &source)
+    {
+      DefaultParamHandler::operator=(source);
+      updateMembers_();
+    }
+    return *this;
+  }
+
+  void TopNPerWindowFilter::filterPeakSpectrum(PeakSpectrum& spectrum)
+  {
+    filterSpectrum(spectrum);
+  }
+
+  void TopNPerWindowFilter::filterPeakMap(PeakMap& exp)
+  {
+#pragma omp parallel for schedule(dynamic)
+    for (SignedSize i = 0; i < (SignedSize)exp.size(); ++i)
+    {
+      filterSpectrum(exp[i]);
+    }
+  }
+
+  void TopNPerWindowFilter::updateMembers_()
+  {
+    threshold_ = (double)param_.getValue("threshold");
+    windowsize_ = (double)param_.getValue("windowsize");
+    peakcount_ = (UInt)param_.getValue("peakcount");
+    nlargest_ = (UInt)param_.getValue("nlargest");
+  }
+
+}
@@ -19,6 +19,7 @@ SpectraMerger.cpp
 SqrtMower.cpp
 TICFilter.cpp
 ThresholdMower.cpp
+TopNPerWindowFilter.cpp
 WindowMower.cpp
 )
 
@@ -128,6 +128,12 @@ namespace OpenMS
 
     simde__m128i data {};
     // loop  through input as long as it's safe to access memory
+    // (each block reads 16 and writes 16 bytes at independent offsets, so blocks
+    // can be encoded concurrently for large arrays; the threshold keeps small
+    // arrays -- the common case for single spectra -- free of thread overhead)
+#ifdef _OPENMP
+#pragma omp parallel for if (loop > 4096) firstprivate(data)
+#endif
     for (int i = 0; i < loop; i++)
     {
       // each time the last 4 out of 16 byte string data get lost through processing, therefore jumps of 12 bytes (/characters)
@@ -182,11 +188,20 @@ namespace OpenMS
     char* outPtr = &out[0];
     int loop = in.size() / 16;
 
+    // each block reads 16 bytes and produces 12; a full 16-byte store would
+    // scribble over the first 4 bytes of the next block (harmless when running
+    // serially in order, but a race when blocks are decoded concurrently), so
+    // only the 12 meaningful bytes are written out
+#ifdef _OPENMP
+#pragma omp parallel for if (loop > 4096)
+#endif
     for (int i = 0; i < loop; i++)
     {
       simde__m128i data = simde_mm_lddqu_si128((simde__m128i*)(inPtr + i * 16));
       registerDecoder_(data);
-      simde_mm_storeu_si128((simde__m128*)(outPtr + i * 12), data);
+      std::array<char, 16> block;
+      simde_mm_storeu_si128((simde__m128*)block.data(), data);
+      memcpy(outPtr + i * 12, block.data(), 12);
     }
 
     size_t read = loop * 16;
@@ -36,9 +36,11 @@ namespace OpenMS
     meta_ms_experiment_(rhs.meta_ms_experiment_),
     ifs_(rhs.filename_cached_.c_str(), std::ios::binary),
     filename_(rhs.filename_),
+    filename_cached_(rhs.filename_cached_),
     spectra_index_(rhs.spectra_index_),
     chrom_index_(rhs.chrom_index_)
   {
+    mmap_file_.open(filename_cached_); // mappings cannot be shared, create a new one
   }
 
   void CachedmzML::load_(const String& filename)
@@ -52,6 +54,10 @@ namespace OpenMS
     spectra_index_ = cache.getSpectraIndex();
     chrom_index_ = cache.getChromatogramIndex();;
 
+    // map the cached file into memory (zero seek/read syscalls per access);
+    // if this fails, the filestream below is used as fallback
+    mmap_file_.open(filename_cached_);
+
     // open the filestream
     ifs_.open(filename_cached_.c_str(), std::ios::binary);
 
@@ -63,6 +69,14 @@ namespace OpenMS
   {
     OPENMS_PRECONDITION(id < getNrSpectra(), "Id cannot be larger than number of spectra");
 
+    if (mmap_file_.isOpen())
+    {
+      Size offset = static_cast<Size>(spectra_index_[id]);
+      MSSpectrum s = meta_ms_experiment_.getSpectrum(id);
+      Internal::CachedMzMLHandler::readSpectrum(s, mmap_file_.data(), mmap_file_.size(), offset);
+      return s;
+    }
+
     if ( !ifs_.seekg(spectra_index_[id]) )
     {
       std::cerr << "Error while reading spectrum " << id << " - seekg created an error when trying to change position to " << spectra_index_[id] << "." << std::endl;
@@ -80,6 +94,14 @@ namespace OpenMS
   {
     OPENMS_PRECONDITION(id < getNrChromatograms(), "Id cannot be larger than number of chromatograms");
 
+    if (mmap_file_.isOpen())
+    {
+      Size offset = static_cast<Size>(chrom_index_[id]);
+      MSChromatogram c = meta_ms_experiment_.getChromatogram(id);
+      Internal::CachedMzMLHandler::readChromatogram(c, mmap_file_.data(), mmap_file_.size(), offset);
+      return c;
+    }
+
     if ( !ifs_.seekg(chrom_index_[id]) )
     {
       std::cerr << "Error while reading chromatogram " << id << " - seekg created an error when trying to change position to " << chrom_index_[id] << "." << std::endl;
@@ -12,9 +12,15 @@
 #include <OpenMS/FORMAT/HANDLERS/XMLHandler.h>
 #include <OpenMS/SYSTEM/File.h>
 
+#include <QtCore/QDir>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <fstream>
 #include <map>
+#include <sstream>
 
 using namespace std;
 
@@ -146,11 +152,290 @@ namespace OpenMS
 
   ControlledVocabulary::~ControlledVocabulary() = default;
 
+  namespace
+  {
+    // magic bytes and format version of the binary CV cache;
+    // bump the version whenever the serialization layout below changes
+    const char CV_CACHE_MAGIC[8] = "OMSCVCH";
+    const UInt32 CV_CACHE_VERSION = 1;
+
+    // sanity limit for string/container sizes read from a cache file;
+    // protects against huge allocations when reading a corrupted cache
+    const UInt32 CV_CACHE_MAX_COUNT = 0x0FFFFFFF;
+
+    // FNV-1a; no cryptographic strength needed, only change detection
+    UInt64 hashCacheBytes(const char* data, Size count, UInt64 hash)
+    {
+      for (Size i = 0; i < count; ++i)
+      {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ull;
+      }
+      return hash;
+    }
+
+    void writeCacheString(ostream& os, const String& str)
+    {
+      UInt32 length = static_cast<UInt32>(str.size());
+      os.write(reinterpret_cast<const char*>(&length), sizeof(length));
+      os.write(str.data(), length);
+    }
+
+    bool readCacheString(istream& is, String& str)
+    {
+      UInt32 length(0);
+      if (!is.read(reinterpret_cast<char*>(&length), sizeof(length)) || length > CV_CACHE_MAX_COUNT)
+      {
+        return false;
+      }
+      str.resize(length);
+      return (length == 0) || bool(is.read(&str[0], length));
+    }
+
+    template <typename ContainerType>
+    void writeCacheStrings(ostream& os, const ContainerType& strings)
+    {
+      UInt32 count = static_cast<UInt32>(strings.size());
+      os.write(reinterpret_cast<const char*>(&count), sizeof(count));
+      for (typename ContainerType::const_iterator it = strings.begin(); it != strings.end(); ++it)
+      {
+        writeCacheString(os, *it);
+      }
+    }
+
+    bool readCacheStrings(istream& is, StringList& strings)
+    {
+      UInt32 count(0);
+      if (!is.read(reinterpret_cast<char*>(&count), sizeof(count)) || count > CV_CACHE_MAX_COUNT)
+      {
+        return false;
+      }
+      strings.resize(count);
+      for (UInt32 i = 0; i < count; ++i)
+      {
+        if (!readCacheString(is, strings[i])) return false;
+      }
+      return true;
+    }
+
+    bool readCacheStrings(istream& is, set<String>& strings)
+    {
+      UInt32 count(0);
+      if (!is.read(reinterpret_cast<char*>(&count), sizeof(count)) || count > CV_CACHE_MAX_COUNT)
+      {
+        return false;
+      }
+      String str;
+      for (UInt32 i = 0; i < count; ++i)
+      {
+        if (!readCacheString(is, str)) return false;
+        strings.insert(str);
+      }
+      return true;
+    }
+  }
+
+  String ControlledVocabulary::cacheFilename_(const String& filename) const
+  {
+    if (getenv("OPENMS_DISABLE_CV_CACHE") != nullptr)
+    {
+      return "";
+    }
+
+    ifstream is(filename.c_str(), ios::binary);
+    if (!is)
+    {
+      return ""; // loadFromOBO will throw FileNotFound
+    }
+
+    // hash the raw file content: the cache is keyed on it, so any change to
+    // the OBO file automatically invalidates the cached representation
+    char buffer[65536];
+    UInt64 hash = 14695981039346656037ull; // FNV-1a offset basis
+    while (is)
+    {
+      is.read(buffer, sizeof(buffer));
+      hash = hashCacheBytes(buffer, Size(is.gcount()), hash);
+    }
+
+    ostringstream hash_hex;
+    hash_hex << hex << hash;
+
+    // follow the freedesktop basedir spec on unix (like getSystemParameters() does for the config dir)
+#ifdef __unix__
+    String cache_dir;
+    if (getenv("XDG_CACHE_HOME"))
+    {
+      cache_dir = String(getenv("XDG_CACHE_HOME")) + "/OpenMS";
+    }
+    else
+    {
+      cache_dir = File::getOpenMSHomePath() + "/.cache/OpenMS";
+    }
+#else
+    String cache_dir = File::getOpenMSHomePath() + "/.OpenMS/cache";
+#endif
+
+    return cache_dir + "/" + name_ + "_" + hash_hex.str() + ".cvb";
+  }
+
+  bool ControlledVocabulary::loadFromCache_(const String& cache_filename, String& version, String& label, String& url)
+  {
+    ifstream is(cache_filename.c_str(), ios::binary);
+    if (!is)
+    {
+      return false;
+    }
+
+    char magic[sizeof(CV_CACHE_MAGIC)];
+    if (!is.read(magic, sizeof(magic)) || memcmp(magic, CV_CACHE_MAGIC, sizeof(magic)) != 0)
+    {
+      return false;
+    }
+    UInt32 cache_version(0);
+    if (!is.read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version)) || cache_version != CV_CACHE_VERSION)
+    {
+      return false;
+    }
+
+    if (!readCacheString(is, version) || !readCacheString(is, label) || !readCacheString(is, url))
+    {
+      return false;
+    }
+
+    UInt32 term_count(0);
+    if (!is.read(reinterpret_cast<char*>(&term_count), sizeof(term_count)) || term_count > CV_CACHE_MAX_COUNT)
+    {
+      return false;
+    }
+
+    // read into a temporary container first, so a truncated cache cannot
+    // leave the vocabulary half-filled
+    vector<CVTerm> file_terms(term_count);
+    for (UInt32 i = 0; i < term_count; ++i)
+    {
+      CVTerm& term = file_terms[i];
+      UInt8 obsolete(0);
+      Int32 xref_type(CVTerm::NONE);
+      if (!readCacheString(is, term.id) || !readCacheString(is, term.name) || !readCacheString(is, term.description) ||
+          !readCacheStrings(is, term.parents) || !readCacheStrings(is, term.synonyms) || !readCacheStrings(is, term.unparsed) ||
+          !readCacheStrings(is, term.xref_binary) || !readCacheStrings(is, term.units) ||
+          !is.read(reinterpret_cast<char*>(&obsolete), sizeof(obsolete)) ||
+          !is.read(reinterpret_cast<char*>(&xref_type), sizeof(xref_type)))
+      {
+        return false;
+      }
+      term.obsolete = (obsolete != 0);
+      term.xref_type = CVTerm::XRefType(xref_type);
+    }
+
+    for (vector<CVTerm>::iterator it = file_terms.begin(); it != file_terms.end(); ++it)
+    {
+      terms_[it->id] = *it;
+    }
+    return true;
+  }
+
+  void ControlledVocabulary::writeCache_(const String& cache_filename, const std::vector<String>& file_term_ids, const String& version, const String& label, const String& url) const
+  {
+    QDir().mkpath(File::path(cache_filename).toQString());
+
+    // write to a temporary file and move it into place, so concurrently
+    // starting tools never see a partial cache
+    String tmp_filename = cache_filename + "." + File::getUniqueName();
+    ofstream os(tmp_filename.c_str(), ios::binary | ios::trunc);
+    if (!os)
+    {
+      return;
+    }
+
+    os.write(CV_CACHE_MAGIC, sizeof(CV_CACHE_MAGIC));
+    os.write(reinterpret_cast<const char*>(&CV_CACHE_VERSION), sizeof(CV_CACHE_VERSION));
+    writeCacheString(os, version);
+    writeCacheString(os, label);
+    writeCacheString(os, url);
+
+    UInt32 term_count = static_cast<UInt32>(file_term_ids.size());
+    os.write(reinterpret_cast<const char*>(&term_count), sizeof(term_count));
+    for (vector<String>::const_iterator it = file_term_ids.begin(); it != file_term_ids.end(); ++it)
+    {
+      // children are not serialized; they are rebuilt after every load
+      const CVTerm& term = terms_.find(*it)->second;
+      writeCacheString(os, term.id);
+      writeCacheString(os, term.name);
+      writeCacheString(os, term.description);
+      writeCacheStrings(os, term.parents);
+      writeCacheStrings(os, term.synonyms);
+      writeCacheStrings(os, term.unparsed);
+      writeCacheStrings(os, term.xref_binary);
+      writeCacheStrings(os, term.units);
+      UInt8 obsolete = term.obsolete ? 1 : 0;
+      Int32 xref_type = Int32(term.xref_type);
+      os.write(reinterpret_cast<const char*>(&obsolete), sizeof(obsolete));
+      os.write(reinterpret_cast<const char*>(&xref_type), sizeof(xref_type));
+    }
+
+    bool failed = os.fail();
+    os.close();
+    if (failed || std::rename(tmp_filename.c_str(), cache_filename.c_str()) != 0)
+    {
+      File::remove(tmp_filename);
+    }
+  }
+
   void ControlledVocabulary::loadFromOBO(const String& name, const String& filename)
   {
-    bool in_term = false;
     name_ = name;
 
+    // header values of this file (only assigned to the members below, if present)
+    String file_version, file_label, file_url;
+
+    // try the binary cache first: parsing the OBO text files dominates the
+    // startup time of short-running tools, while the cached representation
+    // loads in a few milliseconds
+    const String cache_filename = cacheFilename_(filename);
+    if (cache_filename.empty() || !loadFromCache_(cache_filename, file_version, file_label, file_url))
+    {
+      std::vector<String> file_term_ids; // ids parsed from this file (for writing the cache)
+      parseOBOFile_(filename, file_term_ids, file_version, file_label, file_url);
+      if (!cache_filename.empty())
+      {
+        writeCache_(cache_filename, file_term_ids, file_version, file_label, file_url);
+      }
+    }
+
+    if (!file_version.empty()) version_ = file_version;
+    if (!file_label.empty()) label_ = file_label;
+    if (!file_url.empty()) url_ = file_url;
+
+    // now build all child terms
+    for (std::map<String, CVTerm>::iterator it = terms_.begin(); it != terms_.end(); ++it)
+    {
+      //cerr << it->first << "\n";
+      for (set<String>::const_iterator pit = it->second.parents.begin(); pit != it->second.parents.end(); ++pit)
+      {
+        //cerr << "Parent: " << *pit << "\n";
+        terms_[*pit].children.insert(it->first);
+      }
+
+      std::map<String, String>::iterator mit = namesToIds_.find(it->second.name);
+      if (mit == namesToIds_.end())
+      {
+        namesToIds_.insert(pair<String, String>(it->second.name, it->first));
+      }
+      else
+      {
+        //~ TODO that case would be bad do something
+        String s = it->second.name + it->second.description;
+        namesToIds_.insert(pair<String, String>(s, it->first));
+      }
+    }
+  }
+
+  void ControlledVocabulary::parseOBOFile_(const String& filename, std::vector<String>& file_term_ids, String& version, String& label, String& url)
+  {
+    bool in_term = false;
+
     ifstream is(filename.c_str());
     if (!is)
     {
@@ -175,16 +460,16 @@ namespace OpenMS
 
       if (line_wo_spaces.hasPrefix("data-version:"))
       {
-        version_ = line.substr(line.find(':') + 1).trim();
+        version = line.substr(line.find(':') + 1).trim();
       }
       if (line_wo_spaces.hasPrefix("default-namespace:"))
       {
-        label_ = line.substr(line.find(':') + 1).trim();
+        label = line.substr(line.find(':') + 1).trim();
       }
       if (line_wo_spaces.hasPrefix("remark:URL:"))
       {
         // https://
-        url_ = line.substr(line.find_first_of('/') - 7).trim();
+        url = line.substr(line.find_first_of('/') - 7).trim();
       }
 
       //********************************************************************************
@@ -198,6 +483,7 @@ namespace OpenMS
           if (!term.id.empty()) //store last term
           {
             terms_[term.id] = term;
+            file_term_ids.push_back(term.id);
           }
 
           //clear temporary term members
@@ -398,29 +684,7 @@ namespace OpenMS
     if (!term.id.empty()) //store last term
     {
       terms_[term.id] = term;
-    }
-
-    // now build all child terms
-    for (std::map<String, CVTerm>::iterator it = terms_.begin(); it != terms_.end(); ++it)
-    {
-      //cerr << it->first << "\n";
-      for (set<String>::const_iterator pit = it->second.parents.begin(); pit != it->second.parents.end(); ++pit)
-      {
-        //cerr << "Parent: " << *pit << "\n";
-        terms_[*pit].children.insert(it->first);
-      }
-
-      std::map<String, String>::iterator mit = namesToIds_.find(it->second.name);
-      if (mit == namesToIds_.end())
-      {
-        namesToIds_.insert(pair<String, String>(it->second.name, it->first));
-      }
-      else
-      {
-        //~ TODO that case would be bad do something
-        String s = it->second.name + it->second.description;
-        namesToIds_.insert(pair<String, String>(s, it->first));
-      }
+      file_term_ids.push_back(term.id);
     }
   }
 
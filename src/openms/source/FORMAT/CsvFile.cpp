@@ -8,6 +8,11 @@
 
 #include <OpenMS/FORMAT/CsvFile.h>
 
+#include <OpenMS/DATASTRUCTURES/StringUtilsSimple.h>
+
+#include <algorithm>
+#include <string_view>
+
 using namespace std;
 
 namespace OpenMS
@@ -67,19 +72,32 @@ namespace OpenMS
       throw Exception::InvalidIterator(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION);
     }
 
-    bool splitted = buffer_[row].split(itemseperator_, list);
-    if (!splitted)
+    const String& line = buffer_[row];
+    if (line.empty())
     {
-      return splitted;
+      list.clear();
+      return false;
     }
-    for (Size i = 0; i < list.size(); i++)
+
+    // split into views and copy into the reused list entries (same semantics as
+    // String::split(), but without allocating a fresh string per item and call)
+    std::vector<std::string_view> fields;
+    StringUtils::splitView(line, itemseperator_, fields);
+    list.resize(fields.size());
+    for (Size i = 0; i < fields.size(); i++)
     {
+      std::string_view field = fields[i];
       if (itemenclosed_)
-      {
-        list[i] = list[i].substr(1, list[i].size() - 2);
+      { // strip the enclosing characters
+        field.remove_prefix(std::min<size_t>(1, field.size()));
+        if (!field.empty())
+        {
+          field.remove_suffix(1);
+        }
       }
+      list[i].assign(field.data(), field.size());
     }
-    return true;
+    return fields.size() > 1;
   }
 
   std::vector<String>::size_type CsvFile::rowCount() const
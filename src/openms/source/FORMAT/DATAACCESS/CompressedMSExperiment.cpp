@@ -0,0 +1,191 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/FORMAT/DATAACCESS/CompressedMSExperiment.h>
+
+#include <OpenMS/CONCEPT/Exception.h>
+
+namespace OpenMS
+{
+
+  namespace
+  {
+    MSNumpressCoder::NumpressConfig mzConfig()
+    {
+      MSNumpressCoder::NumpressConfig config;
+      config.np_compression = MSNumpressCoder::LINEAR;
+      return config;
+    }
+
+    MSNumpressCoder::NumpressConfig intensityConfig()
+    {
+      MSNumpressCoder::NumpressConfig config;
+      config.np_compression = MSNumpressCoder::SLOF;
+      return config;
+    }
+  }
+
+  CompressedMSExperiment::CompressedMSExperiment(const MSExperiment& exp, Size working_set_size)
+  {
+    setWorkingSetSize(working_set_size);
+    compress(exp);
+  }
+
+  void CompressedMSExperiment::compress(const MSExperiment& exp)
+  {
+    spectra_.clear();
+    working_set_.clear();
+    working_set_index_.clear();
+
+    settings_ = exp;
+    chromatograms_ = exp.getChromatograms();
+
+    spectra_.resize(exp.getNrSpectra());
+    const MSNumpressCoder::NumpressConfig mz_config = mzConfig();
+    const MSNumpressCoder::NumpressConfig int_config = intensityConfig();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 50)
+#endif
+    for (SignedSize i = 0; i < (SignedSize)exp.getNrSpectra(); ++i)
+    {
+      const MSSpectrum& spec = exp[i];
+      CompressedSpectrum& comp = spectra_[i];
+      comp.meta = spec;
+      comp.meta.clear(false); // drop the peaks, keep meta data and data arrays
+
+      if (spec.empty())
+      {
+        continue;
+      }
+
+      std::vector<double> mz(spec.size()), intensity(spec.size());
+      for (Size k = 0; k < spec.size(); ++k)
+      {
+        mz[k] = spec[k].getMZ();
+        intensity[k] = spec[k].getIntensity();
+      }
+
+      MSNumpressCoder coder;
+      coder.encodeNPRaw(mz, comp.mz_data, mz_config);
+      coder.encodeNPRaw(intensity, comp.intensity_data, int_config);
+      if (comp.mz_data.empty() || comp.intensity_data.empty())
+      {
+        // encoding failed (e.g. negative intensities); keep this spectrum uncompressed
+        comp.mz_data.clear();
+        comp.intensity_data.clear();
+        comp.meta = spec;
+      }
+      else
+      {
+        comp.n_peaks = spec.size();
+      }
+    }
+  }
+
+  const MSSpectrum& CompressedMSExperiment::getSpectrum(Size id)
+  {
+    if (id >= spectra_.size())
+    {
+      throw Exception::IndexOverflow(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, id, spectra_.size());
+    }
+
+    auto cached = working_set_index_.find(id);
+    if (cached != working_set_index_.end())
+    {
+      // move to the front of the LRU list
+      working_set_.splice(working_set_.begin(), working_set_, cached->second);
+      return working_set_.front().second;
+    }
+
+    working_set_.emplace_front(id, MSSpectrum());
+    decompressInto_(id, working_set_.front().second);
+    working_set_index_[id] = working_set_.begin();
+
+    while (working_set_.size() > working_set_size_)
+    {
+      working_set_index_.erase(working_set_.back().first);
+      working_set_.pop_back();
+    }
+    return working_set_.front().second;
+  }
+
+  Size CompressedMSExperiment::getNrSpectra() const
+  {
+    return spectra_.size();
+  }
+
+  const ExperimentalSettings& CompressedMSExperiment::getExperimentalSettings() const
+  {
+    return settings_;
+  }
+
+  MSExperiment CompressedMSExperiment::toExperiment()
+  {
+    MSExperiment exp;
+    static_cast<ExperimentalSettings&>(exp) = settings_;
+    exp.setChromatograms(chromatograms_);
+    exp.resize(spectra_.size());
+    for (Size i = 0; i < spectra_.size(); ++i)
+    {
+      decompressInto_(i, exp[i]);
+    }
+    return exp;
+  }
+
+  Size CompressedMSExperiment::getCompressedSizeInBytes() const
+  {
+    Size bytes = 0;
+    for (const CompressedSpectrum& comp : spectra_)
+    {
+      bytes += comp.mz_data.size() + comp.intensity_data.size();
+    }
+    return bytes;
+  }
+
+  Size CompressedMSExperiment::getWorkingSetSize() const
+  {
+    return working_set_size_;
+  }
+
+  void CompressedMSExperiment::setWorkingSetSize(Size working_set_size)
+  {
+    working_set_size_ = std::max(working_set_size, Size(1));
+    while (working_set_.size() > working_set_size_)
+    {
+      working_set_index_.erase(working_set_.back().first);
+      working_set_.pop_back();
+    }
+  }
+
+  void CompressedMSExperiment::decompressInto_(Size id, MSSpectrum& spec)
+  {
+    const CompressedSpectrum& comp = spectra_[id];
+    spec = comp.meta;
+    if (comp.n_peaks == 0)
+    {
+      return; // empty or stored uncompressed in the meta spectrum
+    }
+
+    std::vector<double> mz, intensity;
+    coder_.decodeNPRaw(comp.mz_data, mz, mzConfig());
+    coder_.decodeNPRaw(comp.intensity_data, intensity, intensityConfig());
+    if (mz.size() != comp.n_peaks || intensity.size() != comp.n_peaks)
+    {
+      throw Exception::ConversionError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+          "Compressed spectrum " + String(id) + " decoded to an unexpected number of peaks.");
+    }
+
+    spec.resize(comp.n_peaks);
+    for (Size k = 0; k < comp.n_peaks; ++k)
+    {
+      spec[k].setMZ(mz[k]);
+      spec[k].setIntensity(intensity[k]);
+    }
+  }
+
+} // namespace OpenMS
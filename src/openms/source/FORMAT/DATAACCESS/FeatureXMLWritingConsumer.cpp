@@ -0,0 +1,100 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/FORMAT/DATAACCESS/FeatureXMLWritingConsumer.h>
+
+#include <OpenMS/CONCEPT/LogStream.h>
+#include <OpenMS/FORMAT/FileHandler.h>
+#include <OpenMS/FORMAT/FileTypes.h>
+
+namespace OpenMS
+{
+
+  FeatureXMLWritingConsumer::FeatureXMLWritingConsumer(const String& filename) :
+    meta_(),
+    handler_(static_cast<const FeatureMap&>(meta_), filename),
+    ofs_(filename.c_str())
+  {
+    if (!FileHandler::hasValidExtension(filename, FileTypes::FEATUREXML))
+    {
+      throw Exception::UnableToCreateFile(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename,
+        "invalid file extension, expected '" + FileTypes::typeToName(FileTypes::FEATUREXML) + "'");
+    }
+    if (!ofs_)
+    {
+      throw Exception::UnableToCreateFile(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename);
+    }
+    ofs_.precision(writtenDigits(double()));
+  }
+
+  FeatureXMLWritingConsumer::~FeatureXMLWritingConsumer()
+  {
+    try
+    {
+      close();
+    }
+    catch (...)
+    {
+      // ignore errors while closing in the destructor
+    }
+  }
+
+  void FeatureXMLWritingConsumer::setExpectedSize(Size size)
+  {
+    OPENMS_PRECONDITION(!header_written_, "setExpectedSize() has to be called before the first feature is consumed")
+    expected_size_ = size;
+  }
+
+  void FeatureXMLWritingConsumer::setMetaData(const FeatureMap& map)
+  {
+    OPENMS_PRECONDITION(!header_written_, "setMetaData() has to be called before the first feature is consumed")
+    meta_ = map;
+    meta_.clear(false); // drop the features, keep the meta data
+  }
+
+  void FeatureXMLWritingConsumer::consumeFeature(const Feature& feature)
+  {
+    if (footer_written_)
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+        "Cannot consume features after close() was called");
+    }
+    writeHeaderIfNecessary_();
+    handler_.writeFeature(ofs_, feature);
+    ++features_written_;
+  }
+
+  void FeatureXMLWritingConsumer::close()
+  {
+    if (footer_written_)
+    {
+      return;
+    }
+    writeHeaderIfNecessary_(); // produce a valid (empty) document even without features
+    if (features_written_ != expected_size_)
+    {
+      OPENMS_LOG_WARN << "FeatureXMLWritingConsumer: " << features_written_ << " features were written but "
+                      << expected_size_ << " were announced via setExpectedSize(). "
+                      << "The count attribute of the featureList will be incorrect." << std::endl;
+    }
+    handler_.writeFooter(ofs_);
+    footer_written_ = true;
+    ofs_.close();
+  }
+
+  void FeatureXMLWritingConsumer::writeHeaderIfNecessary_()
+  {
+    if (header_written_)
+    {
+      return;
+    }
+    handler_.writeHeader(ofs_, expected_size_);
+    header_written_ = true;
+  }
+
+} // namespace OpenMS
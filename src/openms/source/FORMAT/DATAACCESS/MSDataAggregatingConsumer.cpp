@@ -12,6 +12,8 @@
 #include <OpenMS/ANALYSIS/OPENSWATH/SpectrumAddition.h>
 #include <OpenMS/KERNEL/SpectrumHelper.h>
 
+#include <utility>
+
 namespace OpenMS
 {
 
@@ -19,6 +21,20 @@ namespace OpenMS
   {
     // flush remaining spectra
     if (!s_list.empty())
+    {
+      flushSpectrumList_();
+    }
+  }
+
+  void MSDataAggregatingConsumer::flushSpectrumList_()
+  {
+    if (s_list.size() == 1)
+    {
+      // nothing to aggregate: pass the single spectrum on as-is, sharing its
+      // peak data instead of copying it through SpectrumAddition
+      next_consumer_->consumeSpectrum(s_list[0]);
+    }
+    else
     {
       MSSpectrum tmps = SpectrumAddition::addUpSpectra(s_list, -1, true);
       copySpectrumMeta(s_list[0], tmps, false);
@@ -33,24 +49,22 @@ namespace OpenMS
 
     if (rt_initialized_ && std::fabs(RT - previous_rt_) < 1e-5)
     {
-      // need to aggregate spectrum
-      s_list.push_back(s);
+      // need to aggregate spectrum (moving it, to avoid copying peak data)
+      s_list.push_back(std::move(s));
     }
     else
     {
       // consume the previous list
       if (rt_initialized_ && !s_list.empty())
       {
-        MSSpectrum tmps = SpectrumAddition::addUpSpectra(s_list, -1, true);
-        copySpectrumMeta(s_list[0], tmps, false);
-        next_consumer_->consumeSpectrum(tmps);
+        flushSpectrumList_();
       }
 
       // start new spectrum list
       int expected_size = s_list.size();
       s_list.clear();
       s_list.reserve(expected_size);
-      s_list.push_back(s);
+      s_list.push_back(std::move(s));
     }
 
     previous_rt_ = RT;
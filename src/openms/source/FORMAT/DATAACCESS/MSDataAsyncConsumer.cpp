@@ -0,0 +1,153 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataAsyncConsumer.h>
+
+#include <OpenMS/CONCEPT/Exception.h>
+#include <OpenMS/KERNEL/MSSpectrum.h>
+#include <OpenMS/KERNEL/MSChromatogram.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace OpenMS
+{
+
+  MSDataAsyncConsumer::MSDataAsyncConsumer(Interfaces::IMSDataConsumer* downstream, Size queue_capacity) :
+    downstream_(downstream),
+    queue_capacity_(std::max(queue_capacity, Size(1))),
+    finished_(false)
+  {
+    if (downstream_ == nullptr)
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+          "Downstream consumer must not be null.");
+    }
+    worker_ = std::thread(&MSDataAsyncConsumer::run_, this);
+  }
+
+  MSDataAsyncConsumer::~MSDataAsyncConsumer()
+  {
+    if (worker_.joinable())
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished_ = true;
+      }
+      queue_has_data_.notify_all();
+      worker_.join();
+      // a pending error_ cannot be rethrown from the destructor;
+      // call waitForCompletion() to surface downstream exceptions
+    }
+  }
+
+  void MSDataAsyncConsumer::setExperimentalSettings(const ExperimentalSettings& settings)
+  {
+    downstream_->setExperimentalSettings(settings);
+  }
+
+  void MSDataAsyncConsumer::setExpectedSize(Size s_size, Size c_size)
+  {
+    downstream_->setExpectedSize(s_size, c_size);
+  }
+
+  void MSDataAsyncConsumer::consumeSpectrum(SpectrumType& s)
+  {
+    QueueItem item;
+    item.is_spectrum = true;
+    item.spectrum = s;
+    enqueue_(std::move(item));
+  }
+
+  void MSDataAsyncConsumer::consumeChromatogram(ChromatogramType& c)
+  {
+    QueueItem item;
+    item.is_spectrum = false;
+    item.chromatogram = c;
+    enqueue_(std::move(item));
+  }
+
+  void MSDataAsyncConsumer::enqueue_(QueueItem&& item)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (finished_)
+    {
+      throw Exception::Precondition(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+          "Cannot consume data after waitForCompletion() was called.");
+    }
+    queue_has_room_.wait(lock, [this]() { return queue_.size() < queue_capacity_ || error_; });
+    if (error_)
+    { // the downstream consumer failed; stop the producer right here
+      std::exception_ptr error = error_;
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+    queue_.push_back(std::move(item));
+    lock.unlock();
+    queue_has_data_.notify_all();
+  }
+
+  void MSDataAsyncConsumer::waitForCompletion()
+  {
+    if (worker_.joinable())
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished_ = true;
+      }
+      queue_has_data_.notify_all();
+      worker_.join();
+    }
+    if (error_)
+    {
+      std::exception_ptr error = error_;
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  void MSDataAsyncConsumer::run_()
+  {
+    while (true)
+    {
+      QueueItem item;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        queue_has_data_.wait(lock, [this]() { return !queue_.empty() || finished_; });
+        if (queue_.empty())
+        { // finished_ is set and all queued data was handed over
+          return;
+        }
+        item = std::move(queue_.front());
+        queue_.pop_front();
+      }
+      queue_has_room_.notify_all();
+
+      try
+      {
+        if (item.is_spectrum)
+        {
+          downstream_->consumeSpectrum(item.spectrum);
+        }
+        else
+        {
+          downstream_->consumeChromatogram(item.chromatogram);
+        }
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        error_ = std::current_exception();
+        queue_.clear(); // drop pending items; the producer is woken up and rethrows
+        queue_has_room_.notify_all();
+        return;
+      }
+    }
+  }
+
+} //end namespace OpenMS
@@ -0,0 +1,90 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Eugen Netz $
+// $Authors: Eugen Netz $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataFAIMSSplittingConsumer.h>
+
+#include <OpenMS/CONCEPT/LogStream.h>
+#include <OpenMS/IONMOBILITY/IMTypes.h>
+
+namespace OpenMS
+{
+
+  MSDataFAIMSSplittingConsumer::MSDataFAIMSSplittingConsumer(ConsumerFactory consumer_factory) :
+    consumer_factory_(std::move(consumer_factory)),
+    consumers_(),
+    settings_(),
+    settings_set_(false),
+    warned_chromatograms_(false)
+  {
+    if (!consumer_factory_)
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+                                       "MSDataFAIMSSplittingConsumer: the consumer factory must not be empty!");
+    }
+  }
+
+  void MSDataFAIMSSplittingConsumer::consumeSpectrum(SpectrumType& s)
+  {
+    if (s.getDriftTimeUnit() != DriftTimeUnit::FAIMS_COMPENSATION_VOLTAGE)
+    {
+      throw Exception::MissingInformation(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Not FAIMS data!");
+    }
+    const double cv = s.getDriftTime();
+    if (cv == IMTypes::DRIFTTIME_NOT_SET)
+    {
+      OPENMS_LOG_WARN << "Warning: FAIMS compensation voltage is missing for at least one spectrum!" << std::endl;
+    }
+    consumerForCV_(cv)->consumeSpectrum(s);
+  }
+
+  void MSDataFAIMSSplittingConsumer::consumeChromatogram(ChromatogramType& /* c */)
+  {
+    if (!warned_chromatograms_)
+    {
+      OPENMS_LOG_WARN << "Warning: chromatograms cannot be assigned to a FAIMS compensation voltage and are dropped!" << std::endl;
+      warned_chromatograms_ = true;
+    }
+  }
+
+  void MSDataFAIMSSplittingConsumer::setExperimentalSettings(const OpenMS::ExperimentalSettings& settings)
+  {
+    settings_ = settings;
+    settings_set_ = true;
+    // consumers created before this call get the settings as well
+    for (auto& consumer : consumers_)
+    {
+      consumer.second->setExperimentalSettings(settings_);
+    }
+  }
+
+  const std::map<double, Interfaces::IMSDataConsumer*>& MSDataFAIMSSplittingConsumer::getConsumers() const
+  {
+    return consumers_;
+  }
+
+  Interfaces::IMSDataConsumer* MSDataFAIMSSplittingConsumer::consumerForCV_(double cv)
+  {
+    auto it = consumers_.find(cv);
+    if (it == consumers_.end())
+    {
+      Interfaces::IMSDataConsumer* consumer = consumer_factory_(cv);
+      if (consumer == nullptr)
+      {
+        throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+                                         "MSDataFAIMSSplittingConsumer: the consumer factory returned a null consumer!");
+      }
+      if (settings_set_)
+      {
+        consumer->setExperimentalSettings(settings_);
+      }
+      it = consumers_.emplace(cv, consumer).first;
+    }
+    return it->second;
+  }
+
+} //end namespace OpenMS
@@ -0,0 +1,83 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataMergingConsumer.h>
+
+#include <OpenMS/ANALYSIS/OPENSWATH/SpectrumAddition.h>
+#include <OpenMS/KERNEL/SpectrumHelper.h>
+
+namespace OpenMS
+{
+
+  MSDataMergingConsumer::MSDataMergingConsumer(Interfaces::IMSDataConsumer* next_consumer,
+                                               Size block_size,
+                                               double rt_max_length,
+                                               UInt ms_level) :
+    next_consumer_(next_consumer),
+    block_size_(std::max(block_size, Size(1))),
+    rt_max_length_(rt_max_length),
+    ms_level_(ms_level)
+  {
+  }
+
+  MSDataMergingConsumer::~MSDataMergingConsumer()
+  {
+    // flush remaining spectra
+    flush_();
+  }
+
+  void MSDataMergingConsumer::flush_()
+  {
+    if (block_.empty())
+    {
+      return;
+    }
+    if (block_.size() == 1)
+    { // nothing to merge
+      next_consumer_->consumeSpectrum(block_[0]);
+    }
+    else
+    {
+      MSSpectrum tmps = SpectrumAddition::addUpSpectra(block_, -1, true);
+      copySpectrumMeta(block_[0], tmps, false);
+      next_consumer_->consumeSpectrum(tmps);
+    }
+    block_.clear();
+  }
+
+  void MSDataMergingConsumer::consumeSpectrum(SpectrumType & s)
+  {
+    if (s.getMSLevel() != ms_level_)
+    {
+      // other levels are not merged and pass through unchanged
+      next_consumer_->consumeSpectrum(s);
+      return;
+    }
+
+    // close the active block if this spectrum would exceed its RT span
+    if (!block_.empty() && rt_max_length_ > 0.0 &&
+        (s.getRT() - block_.front().getRT()) >= rt_max_length_)
+    {
+      flush_();
+    }
+
+    block_.push_back(s);
+
+    if (block_.size() >= block_size_)
+    {
+      flush_();
+    }
+  }
+
+  void MSDataMergingConsumer::consumeChromatogram(ChromatogramType & c)
+  {
+    // NOP
+    next_consumer_->consumeChromatogram(c);
+  }
+
+} // namespace OpenMS
@@ -0,0 +1,92 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataNoiseFilteringConsumer.h>
+
+#include <OpenMS/CONCEPT/Exception.h>
+
+#include <algorithm>
+
+namespace OpenMS
+{
+
+  MSDataNoiseFilteringConsumer::MSDataNoiseFilteringConsumer(Interfaces::IMSDataConsumer* next_consumer,
+                                                             double percentile,
+                                                             double multiplier,
+                                                             UInt ms_level) :
+    next_consumer_(next_consumer),
+    percentile_(percentile),
+    multiplier_(multiplier),
+    ms_level_(ms_level)
+  {
+    if (percentile < 0.0 || percentile > 100.0)
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+        "Percentile needs to be in [0, 100], but is " + String(percentile));
+    }
+  }
+
+  void MSDataNoiseFilteringConsumer::addKeepRange(double mz_start, double mz_end)
+  {
+    keep_ranges_.emplace_back(mz_start, mz_end);
+  }
+
+  bool MSDataNoiseFilteringConsumer::inKeepRange_(double mz) const
+  {
+    for (const auto& range : keep_ranges_)
+    {
+      if (range.first <= mz && mz <= range.second)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void MSDataNoiseFilteringConsumer::consumeSpectrum(SpectrumType& s)
+  {
+    if ((ms_level_ != 0 && s.getMSLevel() != ms_level_) || s.size() < 2)
+    {
+      // other levels (and trivial spectra) are not filtered and pass through unchanged
+      next_consumer_->consumeSpectrum(s);
+      return;
+    }
+
+    // estimate the noise floor by one-pass selection of the requested
+    // intensity percentile (no full sort, no allocation after the first spectrum)
+    intensities_.resize(s.size());
+    for (Size i = 0; i != s.size(); ++i)
+    {
+      intensities_[i] = s[i].getIntensity();
+    }
+    const Size rank = std::min((Size)(percentile_ / 100.0 * (double)s.size()), s.size() - 1);
+    std::nth_element(intensities_.begin(), intensities_.begin() + rank, intensities_.end());
+    const double threshold = intensities_[rank] * multiplier_;
+
+    indices_.clear();
+    for (Size i = 0; i != s.size(); ++i)
+    {
+      if (s[i].getIntensity() >= threshold || inKeepRange_(s[i].getMZ()))
+      {
+        indices_.push_back(i);
+      }
+    }
+    if (indices_.size() < s.size())
+    {
+      s.select(indices_); // keeps the associated data arrays consistent
+    }
+
+    next_consumer_->consumeSpectrum(s);
+  }
+
+  void MSDataNoiseFilteringConsumer::consumeChromatogram(ChromatogramType& c)
+  {
+    next_consumer_->consumeChromatogram(c);
+  }
+
+} //end namespace OpenMS
@@ -0,0 +1,79 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataPrecursorCorrectingConsumer.h>
+
+#include <OpenMS/FILTERING/CALIBRATION/PrecursorCorrection.h>
+
+namespace OpenMS
+{
+
+  MSDataPrecursorCorrectingConsumer::MSDataPrecursorCorrectingConsumer(Interfaces::IMSDataConsumer* next_consumer,
+                                                                       double mz_tolerance,
+                                                                       bool ppm,
+                                                                       bool highest_intensity) :
+    next_consumer_(next_consumer),
+    mz_tolerance_(mz_tolerance),
+    ppm_(ppm),
+    highest_intensity_(highest_intensity)
+  {
+  }
+
+  void MSDataPrecursorCorrectingConsumer::consumeSpectrum(SpectrumType& s)
+  {
+    if (s.getMSLevel() == 1)
+    {
+      last_ms1_ = s;
+    }
+    else if (s.getMSLevel() == 2 && !s.getPrecursors().empty())
+    {
+      const double uncorrected_mz = s.getPrecursors()[0].getMZ();
+      double delta_mz;
+      if (PrecursorCorrection::correctToMS1Peak(last_ms1_, s, mz_tolerance_, ppm_, highest_intensity_, delta_mz))
+      {
+        delta_mzs_.push_back(delta_mz);
+        mzs_.push_back(uncorrected_mz);
+        rts_.push_back(s.getRT());
+      }
+    }
+
+    if (next_consumer_ != nullptr)
+    {
+      next_consumer_->consumeSpectrum(s);
+    }
+  }
+
+  void MSDataPrecursorCorrectingConsumer::consumeChromatogram(ChromatogramType& c)
+  {
+    if (next_consumer_ != nullptr)
+    {
+      next_consumer_->consumeChromatogram(c);
+    }
+  }
+
+  Size MSDataPrecursorCorrectingConsumer::getNumberOfCorrectedPrecursors() const
+  {
+    return delta_mzs_.size();
+  }
+
+  const std::vector<double>& MSDataPrecursorCorrectingConsumer::getDeltaMZs() const
+  {
+    return delta_mzs_;
+  }
+
+  const std::vector<double>& MSDataPrecursorCorrectingConsumer::getMZs() const
+  {
+    return mzs_;
+  }
+
+  const std::vector<double>& MSDataPrecursorCorrectingConsumer::getRTs() const
+  {
+    return rts_;
+  }
+
+} //end namespace OpenMS
@@ -11,6 +11,7 @@
 // TODO move getVersion to Handler
 #include <OpenMS/FORMAT/MzMLFile.h>
 
+#include <sstream>
 #include <utility>
 
 namespace OpenMS
@@ -89,11 +90,49 @@ namespace OpenMS
       ofs_ << "\t\t<spectrumList count=\"" << spectra_expected_ << "\" defaultDataProcessingRef=\"dp_sp_0\">\n";
       writing_spectra_ = true;
     }
+    // Buffer the processed spectrum; flushSpectraBuffer_() serializes the
+    // buffered spectra in parallel and writes them out in order. Without
+    // OpenMP the buffer size is 1, i.e. each spectrum is written immediately.
+#ifdef _OPENMP
+    const Size buffer_size = 64;
+#else
+    const Size buffer_size = 1;
+#endif
+    spectra_buffer_.push_back(std::move(scpy));
+    ++spectra_written_;
+    if (spectra_buffer_.size() >= buffer_size)
+    {
+      flushSpectraBuffer_();
+    }
+  }
+
+   void MSDataWritingConsumer::flushSpectraBuffer_()
+  {
+    if (spectra_buffer_.empty())
+    {
+      return;
+    }
+
     bool renew_native_ids = false;
     // TODO writeSpectrum assumes that dps_ has at least one value -> assert
     // this here ...
-    Internal::MzMLHandler::writeSpectrum_(ofs_, scpy,
-            spectra_written_++, *validator_, renew_native_ids, dps_);
+    const Size base_idx = spectra_written_ - spectra_buffer_.size();
+    std::vector<std::ostringstream> buffers(spectra_buffer_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (SignedSize k = 0; k < (SignedSize)spectra_buffer_.size(); ++k)
+    {
+      buffers[k].precision(ofs_.precision());
+      Internal::MzMLHandler::writeSpectrum_(buffers[k], spectra_buffer_[k],
+              base_idx + k, *validator_, renew_native_ids, dps_);
+    }
+    for (Size k = 0; k < spectra_buffer_.size(); ++k)
+    {
+      Internal::MzMLHandler::addSpectrumOffset_(spectra_buffer_[k], base_idx + k, renew_native_ids, ofs_.tellp());
+      ofs_ << buffers[k].str();
+    }
+    spectra_buffer_.clear();
   }
 
    void MSDataWritingConsumer::consumeChromatogram(ChromatogramType & c)
@@ -101,6 +140,7 @@ namespace OpenMS
     // make sure to close an open List tag
     if (writing_spectra_)
     {
+      flushSpectraBuffer_();
       ofs_ << "\t\t</spectrumList>\n";
       writing_spectra_ = false;
     }
@@ -134,6 +174,7 @@ namespace OpenMS
       ofs_ << "\t\t<chromatogramList count=\"" << chromatograms_expected_ << "\" defaultDataProcessingRef=\"dp_sp_0\">\n";
       writing_chromatograms_ = true;
     }
+    Internal::MzMLHandler::addChromatogramOffset_(ccpy, ofs_.tellp());
     Internal::MzMLHandler::writeChromatogram_(ofs_, ccpy,
             chromatograms_written_++, *validator_);
   }
@@ -156,6 +197,7 @@ namespace OpenMS
     // make sure to close an open List tag
     if (writing_spectra_)
     {
+      flushSpectraBuffer_();
       ofs_ << "\t\t</spectrumList>\n";
     }
     else if (writing_chromatograms_)
@@ -0,0 +1,124 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/FORMAT/DATAACCESS/MzMLTailReader.h>
+
+#include <OpenMS/CONCEPT/Exception.h>
+#include <OpenMS/FORMAT/HANDLERS/MzMLSpectrumDecoder.h>
+#include <OpenMS/KERNEL/MSSpectrum.h>
+
+#include <algorithm>
+#include <fstream>
+
+namespace OpenMS
+{
+
+  namespace
+  {
+    const char SPECTRUM_OPEN[] = "<spectrum"; // may also match e.g. "<spectrumList" -> check next char
+    const Size SPECTRUM_OPEN_LEN = 9;
+    const char SPECTRUM_CLOSE[] = "</spectrum>";
+    const Size SPECTRUM_CLOSE_LEN = 11;
+  }
+
+  MzMLTailReader::MzMLTailReader(const String& filename) :
+    filename_(filename),
+    scan_offset_(0),
+    n_spectra_read_(0),
+    skip_xml_checks_(false)
+  {
+  }
+
+  Size MzMLTailReader::consumeNewSpectra(Interfaces::IMSDataConsumer* consumer)
+  {
+    if (consumer == nullptr)
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+          "Consumer must not be null.");
+    }
+
+    // reopen on every call - a freshly opened stream is guaranteed to see the
+    // current size of the growing file
+    std::ifstream filestream(filename_.c_str(), std::ios::binary);
+    if (!filestream)
+    {
+      throw Exception::FileNotFound(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename_);
+    }
+    filestream.seekg(0, std::ios::end);
+    const std::streamoff file_size = filestream.tellg();
+    if (file_size <= scan_offset_)
+    {
+      return 0; // nothing was appended since the last call
+    }
+
+    // read everything that was appended since the last call
+    std::string buffer(file_size - scan_offset_, '\0');
+    filestream.seekg(scan_offset_);
+    filestream.read(&buffer[0], buffer.size());
+    buffer.resize(filestream.gcount());
+
+    MzMLSpectrumDecoder decoder(skip_xml_checks_);
+    Size delivered = 0;
+    std::size_t consumed = 0; // prefix of the buffer that is fully handled
+    std::size_t search_pos = 0;
+    while (true)
+    {
+      // find the next real <spectrum> element (skipping e.g. <spectrumList>)
+      std::size_t start = buffer.find(SPECTRUM_OPEN, search_pos);
+      bool start_may_be_truncated = false;
+      while (start != std::string::npos)
+      {
+        if (start + SPECTRUM_OPEN_LEN >= buffer.size())
+        { // the tag name ends at the current end of file - it may still grow
+          start_may_be_truncated = true;
+          break;
+        }
+        const char next = buffer[start + SPECTRUM_OPEN_LEN];
+        if ((next == ' ') || (next == '\t') || (next == '\r') || (next == '\n') || (next == '>'))
+        {
+          break;
+        }
+        start = buffer.find(SPECTRUM_OPEN, start + SPECTRUM_OPEN_LEN);
+      }
+
+      if (start == std::string::npos)
+      {
+        // no further spectrum begins here; skip ahead, but keep the last few
+        // bytes in case an opening tag is currently being written
+        std::size_t tail = (buffer.size() > SPECTRUM_OPEN_LEN) ? buffer.size() - SPECTRUM_OPEN_LEN : 0;
+        consumed = std::max(consumed, std::max(search_pos, tail));
+        break;
+      }
+
+      std::size_t end = start_may_be_truncated ? std::string::npos : buffer.find(SPECTRUM_CLOSE, start);
+      if (end == std::string::npos)
+      { // the spectrum is not completely written yet; retry from here next time
+        consumed = std::max(consumed, start);
+        break;
+      }
+      end += SPECTRUM_CLOSE_LEN;
+
+      MSSpectrum s;
+      decoder.domParseSpectrum(buffer.substr(start, end - start), s);
+      consumer->consumeSpectrum(s);
+      ++delivered;
+      ++n_spectra_read_;
+      consumed = end;
+      search_pos = end;
+    }
+
+    scan_offset_ += (std::streamoff)consumed;
+    return delivered;
+  }
+
+  Size MzMLTailReader::getNrSpectraRead() const
+  {
+    return n_spectra_read_;
+  }
+
+} //end namespace OpenMS
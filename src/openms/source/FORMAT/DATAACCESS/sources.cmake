@@ -3,15 +3,23 @@ set(directory source/FORMAT/DATAACCESS)
 
 ### list all filenames of the directory here
 set(sources_list
+  CompressedMSExperiment.cpp
+  FeatureXMLWritingConsumer.cpp
   MSDataWritingConsumer.cpp
   MSDataTransformingConsumer.cpp
   MSDataAggregatingConsumer.cpp
+  MSDataAsyncConsumer.cpp
   MSDataCachedConsumer.cpp
   MSDataChainingConsumer.cpp
+  MSDataFAIMSSplittingConsumer.cpp
   MSDataStoringConsumer.cpp
+  MSDataMergingConsumer.cpp
+  MSDataNoiseFilteringConsumer.cpp
+  MSDataPrecursorCorrectingConsumer.cpp
   MSDataSqlConsumer.cpp
   MSDataTransformingConsumer.cpp
   MSDataWritingConsumer.cpp
+  MzMLTailReader.cpp
   NoopMSDataConsumer.cpp
   SiriusFragmentAnnotation.cpp
   SwathFileConsumer.cpp
@@ -457,8 +457,18 @@ namespace OpenMS
 
     ExperimentalDesign ExperimentalDesignFile::load(const String &tsv_file, const bool require_spectra_file)
     {
+      // tools of a quantification chain typically load the same design several times;
+      // cache the parsed and validated result so only the first load pays for parsing,
+      // spectra file lookup and validation
+      static std::map<std::pair<String, bool>, ExperimentalDesign> design_cache;
+      const auto key = std::make_pair(File::absolutePath(tsv_file), require_spectra_file);
+      auto it = design_cache.find(key);
+      if (it != design_cache.end())
+      {
+        return it->second;
+      }
       const TextFile text_file(tsv_file, true);
-      return load(text_file, require_spectra_file, tsv_file);
+      return design_cache.emplace(key, load(text_file, require_spectra_file, tsv_file)).first->second;
     }
 
 }
@@ -17,8 +17,11 @@
 #include <OpenMS/KERNEL/OnDiscMSExperiment.h>
 #include <OpenMS/KERNEL/MSSpectrum.h>
 
+#include <cmath>
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <unordered_map>
 
 using namespace std;
 
@@ -37,6 +40,9 @@ namespace OpenMS
     defaults_.setValue("ms2_bin_size", DEF_MERGE_BIN_SIZE, "Bin size (Da) for fragment ions when merging ms2 scans.");
     defaults_.setMinFloat("ms2_bin_size", 0);
 
+    defaults_.setValue("precursor_mz_tolerance", DEF_PREC_MASS_TOL, "Tolerance (Da) for matching a consensus element to an MS2 precursor m/z if no spectrum reference is annotated.");
+    defaults_.setMinFloat("precursor_mz_tolerance", 0);
+
     defaults_.setValue("merged_spectra:cos_similarity", DEF_COSINE_SIMILARITY, "Cosine similarity threshold for merged_spectra output.");
     defaults_.setMinFloat("merged_spectra:cos_similarity", 0);
 
@@ -132,7 +138,7 @@ namespace OpenMS
    * @param feature_rt ConsensusFeature's retention time specified in input mzXML file
    */
   void writeMSMSBlockHeader_(
-    ofstream &output_file,
+    ostream &output_file,
     const String &output_type,
     const int &scan_index,
     const String &feature_id,
@@ -142,7 +148,6 @@ namespace OpenMS
     const String &feature_rt
   )
   {
-    if (output_file.is_open())
     {
       output_file << "BEGIN IONS" << "\n"
                   << "OUTPUT=" << output_type << "\n"
@@ -162,11 +167,10 @@ namespace OpenMS
    * @param peaks Vector of peaks that will be outputted
    */
   void writeMSMSBlock_(
-    ofstream &output_file,
+    ostream &output_file,
     const vector<Peak1D> &peaks
   )
   {
-    if (output_file.is_open())
     {
       output_file << setprecision(4) << fixed;
       for (auto& peak : peaks)
@@ -215,8 +219,8 @@ namespace OpenMS
     for (pair<int,double>& element_pair : sorted_element_maps)
     {
       int element_map = element_pair.first;
-      vector<PeptideIdentification> feature_pepts = feature.getPeptideIdentifications();
-      for (PeptideIdentification& pept_id : feature_pepts)
+      const vector<PeptideIdentification>& feature_pepts = feature.getPeptideIdentifications();
+      for (const PeptideIdentification& pept_id : feature_pepts)
       {
         if (pept_id.metaValueExists("spectrum_index") && pept_id.metaValueExists("map_index")
             && (int)pept_id.getMetaValue("map_index") == element_map)
@@ -241,6 +245,8 @@ namespace OpenMS
 
     double cos_sim_threshold = getParameters().getValue("merged_spectra:cos_similarity");
 
+    double precursor_mz_tol = getParameters().getValue("precursor_mz_tolerance");
+
     ofstream output_file(out);
 
     //-------------------------------------------------------------
@@ -258,27 +264,71 @@ namespace OpenMS
     map<size_t, size_t> map_index2file_index; // <K, V> = <map_index, file_index>
     Size num_msmaps_cached = 0;
 
+    // open an on-disc experiment (load meta-data only) if we have not seen its map index yet
+    auto openMap = [&](size_t map_index) -> size_t
+    {
+      auto it = map_index2file_index.find(map_index);
+      if (it != map_index2file_index.end())
+      {
+        return it->second;
+      }
+      specs_list[num_msmaps_cached].openFile(mzml_file_paths[map_index], false);
+      map_index2file_index[map_index] = num_msmaps_cached;
+      return num_msmaps_cached++;
+    };
+
+    // per file: MS2 spectrum indices hashed by precursor m/z bucket (built on first use);
+    // fallback join key for features without an annotated spectrum reference
+    vector<unordered_map<long, vector<Size>>> mz_buckets(mzml_file_paths.size());
+    auto lookupByPrecursorMZ = [&](size_t file_index, double mz) -> int
+    {
+      unordered_map<long, vector<Size>>& buckets = mz_buckets[file_index];
+      if (buckets.empty())
+      {
+        const PeakMap& meta = *specs_list[file_index].getMetaData();
+        for (Size i = 0; i < meta.size(); ++i)
+        {
+          if (meta[i].getMSLevel() == 2 && !meta[i].getPrecursors().empty())
+          {
+            buckets[(long)floor(meta[i].getPrecursors()[0].getMZ() / precursor_mz_tol)].push_back(i);
+          }
+        }
+      }
+      const PeakMap& meta = *specs_list[file_index].getMetaData();
+      int best_index = -1;
+      double best_diff = precursor_mz_tol;
+      long key = (long)floor(mz / precursor_mz_tol);
+      for (long k = key - 1; k <= key + 1; ++k)
+      {
+        auto bucket = buckets.find(k);
+        if (bucket == buckets.end())
+        {
+          continue;
+        }
+        for (Size spec_index : bucket->second)
+        {
+          double diff = fabs(meta[spec_index].getPrecursors()[0].getMZ() - mz);
+          if (diff <= best_diff)
+          {
+            best_diff = diff;
+            best_index = (int)spec_index;
+          }
+        }
+      }
+      return best_index;
+    };
+
     //-------------------------------------------------------------
-    // write output (+ merge computations)
+    // build side of the join: resolve each feature to its
+    // (map_index, spectrum_index) pairs once, opening every referenced
+    // file a single time
     //-------------------------------------------------------------
-    startProgress(0, consensus_map.size(), "parsing features and ms2 identifications...");
+    vector<vector<pair<int, int>>> feature_pepts(consensus_map.size());
 
     for (Size cons_i = 0; cons_i < consensus_map.size(); ++cons_i)
     {
-      setProgress(cons_i);
-
       const ConsensusFeature& feature = consensus_map[cons_i];
 
-      // determine feature's charge as maximum feature handle charge
-      int charge = feature.getCharge();
-      for (auto& fh : feature)
-      { 
-        if (fh.getCharge() > charge)
-        {
-          charge = fh.getCharge();
-        }
-      }
-
       // compute most intense peptide identifications (based on precursor intensity)
       vector<pair<int,double>> element_maps;
       sortElementMapsByIntensity_(feature, element_maps);
@@ -294,27 +344,67 @@ namespace OpenMS
       // validate all peptide annotation maps have been loaded
       for (const auto& pep : pepts)
       {
-        int map_index = pep.first;
+        openMap(pep.first);
+      }
 
-        // open on-disc experiments
-        if (map_index2file_index.find(map_index) == map_index2file_index.end())
+      // no annotated spectrum reference: fall back to the precursor m/z
+      // buckets of the most intense element map
+      if (pepts.empty() && !element_maps.empty())
+      {
+        int map_index = element_maps[0].first;
+        int spec_index = lookupByPrecursorMZ(openMap(map_index), feature.getMZ());
+        if (spec_index != -1)
         {
-          specs_list[num_msmaps_cached].openFile(mzml_file_paths[map_index], false); // open on-disc experiment and load meta-data
-          map_index2file_index[map_index] = num_msmaps_cached;
-          ++num_msmaps_cached;
+          pepts.emplace_back(map_index, spec_index);
+        }
+      }
+
+      feature_pepts[cons_i] = std::move(pepts);
+    }
+
+    //-------------------------------------------------------------
+    // probe side: render one MGF block per feature in parallel; blocks
+    // are streamed to disk in feature order afterwards
+    //-------------------------------------------------------------
+    startProgress(0, consensus_map.size(), "parsing features and ms2 identifications...");
+
+    vector<String> blocks(consensus_map.size());
+    SignedSize progress = 0;
+
+#pragma omp parallel for
+    for (SignedSize cons_i = 0; cons_i < (SignedSize)consensus_map.size(); ++cons_i)
+    {
+#pragma omp critical (OPENMS_GNPSMGFFile_progress)
+      setProgress(progress++);
+
+      const ConsensusFeature& feature = consensus_map[cons_i];
+      const vector<pair<int, int>>& pepts = feature_pepts[cons_i];
+      if (pepts.empty()) continue; // nothing to export for this feature
+
+      // determine feature's charge as maximum feature handle charge
+      int charge = feature.getCharge();
+      for (auto& fh : feature)
+      { 
+        if (fh.getCharge() > charge)
+        {
+          charge = fh.getCharge();
         }
       }
 
       // identify most intense spectrum
       const int best_mapi = pepts[0].first;
       const int best_speci = pepts[0].second;
-      auto best_spec = specs_list[map_index2file_index[best_mapi]][best_speci];
+      MSSpectrum best_spec;
+#pragma omp critical (OPENMS_GNPSMGFFile_ondisc)
+      best_spec = specs_list[map_index2file_index.at(best_mapi)][best_speci];
 
       if (best_spec.empty()) continue; // some Bruker files have MS2 spectra without peaks. skip those during exprot
 
+      ostringstream block;
+
       // write block output header
       writeMSMSBlockHeader_(
-        output_file,
+        block,
         output_type,
         (cons_i + 1),
         feature.getUniqueId(),
@@ -338,11 +428,13 @@ namespace OpenMS
         BinnedSpectrum binned_highest_int(best_spec, bin_width, false, 1, BinnedSpectrum::DEFAULT_BIN_OFFSET_HIRES);
 
         // Retain peptide annotations that do not meet user-specified cosine similarity threshold
-        for (pair<int,int> &pept : pepts)
+        for (const pair<int,int> &pept : pepts)
         {
           int map_index = pept.first;
           int spec_index = pept.second;
-          auto test_spec = specs_list[map_index2file_index[map_index]][spec_index];
+          MSSpectrum test_spec;
+#pragma omp critical (OPENMS_GNPSMGFFile_ondisc)
+          test_spec = specs_list[map_index2file_index.at(map_index)][spec_index];
 
           BinnedSpectrum binned_spectrum(test_spec, bin_width, false, 1, BinnedSpectrum::DEFAULT_BIN_OFFSET_HIRES);
 
@@ -366,9 +458,21 @@ namespace OpenMS
 
       // write peaks to output block
       writeMSMSBlock_(
-        output_file,
+        block,
         peaks
       );
+
+      blocks[cons_i] = block.str();
+    }
+    endProgress();
+
+    // stream blocks in feature order
+    for (const String& block : blocks)
+    {
+      if (!block.empty())
+      {
+        output_file << block;
+      }
     }
 
     output_file.close();
@@ -0,0 +1,131 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/FORMAT/GzipOfstream.h>
+
+namespace OpenMS
+{
+  namespace Internal
+  {
+    namespace
+    {
+      const size_t GZIP_STREAMBUF_BLOCKSIZE = 64 * 1024; // deflate in 64 KiB blocks
+    }
+
+    GzipStreamBuf::GzipStreamBuf() :
+      buffer_(GZIP_STREAMBUF_BLOCKSIZE)
+    {
+      setp(buffer_.data(), buffer_.data() + buffer_.size());
+    }
+
+    GzipStreamBuf::~GzipStreamBuf()
+    {
+      close();
+    }
+
+    bool GzipStreamBuf::isOpen() const
+    {
+      return gzfile_ != nullptr;
+    }
+
+    void GzipStreamBuf::open(const char* filename)
+    {
+      close();
+      gzfile_ = gzopen(filename, "wb");
+      setp(buffer_.data(), buffer_.data() + buffer_.size());
+    }
+
+    void GzipStreamBuf::close()
+    {
+      if (gzfile_ != nullptr)
+      {
+        flushBuffer_();
+        gzclose(gzfile_);
+        gzfile_ = nullptr;
+      }
+    }
+
+    bool GzipStreamBuf::flushBuffer_()
+    {
+      const int n = static_cast<int>(pptr() - pbase());
+      if (n == 0)
+      {
+        return true;
+      }
+      if (gzfile_ == nullptr || gzwrite(gzfile_, pbase(), static_cast<unsigned>(n)) != n)
+      {
+        return false;
+      }
+      pbump(-n);
+      return true;
+    }
+
+    int GzipStreamBuf::overflow(int c)
+    {
+      if (!flushBuffer_())
+      {
+        return traits_type::eof();
+      }
+      if (c != traits_type::eof())
+      {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+      }
+      return traits_type::not_eof(c);
+    }
+
+    int GzipStreamBuf::sync()
+    {
+      return flushBuffer_() ? 0 : -1;
+    }
+
+  } // namespace Internal
+
+  GzipOfstream::GzipOfstream() :
+    std::ostream(nullptr),
+    buf_()
+  {
+    init(&buf_);
+  }
+
+  GzipOfstream::GzipOfstream(const char* filename) :
+    std::ostream(nullptr),
+    buf_()
+  {
+    init(&buf_);
+    open(filename);
+  }
+
+  GzipOfstream::~GzipOfstream()
+  {
+    buf_.close();
+  }
+
+  void GzipOfstream::open(const char* filename)
+  {
+    buf_.open(filename);
+    if (!buf_.isOpen())
+    {
+      setstate(std::ios::failbit);
+    }
+    else
+    {
+      clear();
+    }
+  }
+
+  void GzipOfstream::close()
+  {
+    if (buf_.isOpen())
+    {
+      flush();
+      buf_.close();
+    }
+  }
+
+} //namespace OpenMS
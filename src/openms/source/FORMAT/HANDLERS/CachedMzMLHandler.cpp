@@ -11,6 +11,8 @@
 #include <OpenMS/KERNEL/MSExperiment.h>
 #include <OpenMS/FORMAT/MzMLFile.h>
 
+#include <cstring>
+
 namespace OpenMS::Internal
 {
   CachedMzMLHandler::CachedMzMLHandler() = default;
@@ -303,6 +305,113 @@ namespace OpenMS::Internal
     return data;
   }
 
+  std::vector<OpenSwath::BinaryDataArrayPtr> CachedMzMLHandler::readSpectrumFast(std::ifstream& ifs, int& ms_level, double& rt, double mz_start, double mz_end)
+  {
+    std::vector<OpenSwath::BinaryDataArrayPtr> data;
+    data.push_back(OpenSwath::BinaryDataArrayPtr(new OpenSwath::BinaryDataArray));
+    data.push_back(OpenSwath::BinaryDataArrayPtr(new OpenSwath::BinaryDataArray));
+
+    Size spec_size = -1;
+    Size nr_float_arrays = -1;
+    ifs.read((char*) &spec_size, sizeof(spec_size));
+    ifs.read((char*) &nr_float_arrays, sizeof(nr_float_arrays));
+    ifs.read((char*) &ms_level, sizeof(ms_level));
+    ifs.read((char*) &rt, sizeof(rt));
+
+    if (static_cast<int>(spec_size) < 0)
+    {
+      throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+        "Read an invalid spectrum length, something is wrong here. Aborting.", "filestream");
+    }
+
+    std::streampos mz_block = ifs.tellg();
+
+    // locate the strip with a binary search on the sorted on-disk m/z block
+    // (a handful of single-datum reads instead of decoding the full array)
+    auto mz_at = [&ifs, mz_block](Size i) -> DatumSingleton
+    {
+      DatumSingleton value;
+      ifs.seekg(mz_block + static_cast<std::streamoff>(i * sizeof(DatumSingleton)));
+      ifs.read((char*) &value, sizeof(value));
+      return value;
+    };
+    Size left = 0;
+    Size right = spec_size;
+    while (left < right) // first peak with m/z >= mz_start
+    {
+      Size mid = left + (right - left) / 2;
+      if (mz_at(mid) < mz_start) { left = mid + 1; }
+      else { right = mid; }
+    }
+    const Size strip_begin = left;
+    right = spec_size;
+    while (left < right) // first peak with m/z > mz_end
+    {
+      Size mid = left + (right - left) / 2;
+      if (mz_at(mid) <= mz_end) { left = mid + 1; }
+      else { right = mid; }
+    }
+    const Size strip_end = left;
+    const Size strip_size = strip_end - strip_begin;
+
+    data[0]->data.resize(strip_size);
+    data[1]->data.resize(strip_size);
+    if (strip_size > 0)
+    {
+      ifs.seekg(mz_block + static_cast<std::streamoff>(strip_begin * sizeof(DatumSingleton)));
+      ifs.read((char*) &(data[0]->data)[0], strip_size * sizeof(DatumSingleton));
+      ifs.seekg(mz_block + static_cast<std::streamoff>((spec_size + strip_begin) * sizeof(DatumSingleton)));
+      ifs.read((char*) &(data[1]->data)[0], strip_size * sizeof(DatumSingleton));
+    }
+    ifs.seekg(mz_block + static_cast<std::streamoff>(2 * spec_size * sizeof(DatumSingleton)));
+
+    if (nr_float_arrays == 0)
+    {
+      return data;
+    }
+    char* buffer = new(std::nothrow) char[1024];
+    for (Size k = 0; k < nr_float_arrays; k++)
+    {
+      data.push_back(OpenSwath::BinaryDataArrayPtr(new OpenSwath::BinaryDataArray));
+      Size len, len_name;
+      ifs.read((char*)&len, sizeof(len));
+      ifs.read((char*)&len_name, sizeof(len_name));
+
+      // We will not read data longer than 1024 bytes as this will not fit into
+      // our buffer (and is user-generated input data)
+      if (len_name > 1023)
+      {
+        ifs.seekg(len_name * sizeof(char), ifs.cur);
+      }
+      else
+      {
+        ifs.read(buffer, len_name);
+        buffer[len_name] = '\0';
+      }
+      data.back()->description = buffer;
+      if (len == spec_size)
+      { // per-peak array (e.g. ion mobility): only the strip is needed
+        data.back()->data.resize(strip_size);
+        ifs.seekg(strip_begin * sizeof(DatumSingleton), ifs.cur);
+        if (strip_size > 0)
+        {
+          ifs.read((char*)&(data.back()->data)[0], strip_size * sizeof(DatumSingleton));
+        }
+        ifs.seekg((len - strip_end) * sizeof(DatumSingleton), ifs.cur);
+      }
+      else
+      {
+        data.back()->data.resize(len);
+        if (len > 0)
+        {
+          ifs.read((char*)&(data.back()->data)[0], len * sizeof(DatumSingleton));
+        }
+      }
+    }
+    delete[] buffer;
+    return data;
+  }
+
   void CachedMzMLHandler::readDataFast_(std::ifstream& ifs,
                                         std::vector<OpenSwath::BinaryDataArrayPtr>& data,
                                         const Size& data_size,
@@ -349,6 +458,224 @@ namespace OpenMS::Internal
     return;
   }
 
+  namespace
+  {
+    // bounds-checked plain-old-data read from an in-memory buffer
+    template <typename T>
+    inline void readFromBuffer(const char* buffer, const Size buffer_size, Size& offset, T& target)
+    {
+      if (offset + sizeof(T) > buffer_size)
+      {
+        throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+          "Unexpected end of cached file while reading, something is wrong here. Aborting.", "memory buffer");
+      }
+      memcpy(&target, buffer + offset, sizeof(T));
+      offset += sizeof(T);
+    }
+  }
+
+  std::vector<OpenSwath::BinaryDataArrayPtr> CachedMzMLHandler::readSpectrumFast(const char* buffer, Size buffer_size, Size& offset, int& ms_level, double& rt)
+  {
+    std::vector<OpenSwath::BinaryDataArrayPtr> data;
+    data.push_back(OpenSwath::BinaryDataArrayPtr(new OpenSwath::BinaryDataArray));
+    data.push_back(OpenSwath::BinaryDataArrayPtr(new OpenSwath::BinaryDataArray));
+
+    Size spec_size = -1;
+    Size nr_float_arrays = -1;
+    readFromBuffer(buffer, buffer_size, offset, spec_size);
+    readFromBuffer(buffer, buffer_size, offset, nr_float_arrays);
+    readFromBuffer(buffer, buffer_size, offset, ms_level);
+    readFromBuffer(buffer, buffer_size, offset, rt);
+
+    if (static_cast<int>(spec_size) < 0)
+    {
+      throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+        "Read an invalid spectrum length, something is wrong here. Aborting.", "memory buffer");
+    }
+
+    readDataFast_(buffer, buffer_size, offset, data, spec_size, nr_float_arrays);
+    return data;
+  }
+
+  std::vector<OpenSwath::BinaryDataArrayPtr> CachedMzMLHandler::readSpectrumFast(const char* buffer, Size buffer_size, Size& offset, int& ms_level, double& rt, double mz_start, double mz_end)
+  {
+    std::vector<OpenSwath::BinaryDataArrayPtr> data;
+    data.push_back(OpenSwath::BinaryDataArrayPtr(new OpenSwath::BinaryDataArray));
+    data.push_back(OpenSwath::BinaryDataArrayPtr(new OpenSwath::BinaryDataArray));
+
+    Size spec_size = -1;
+    Size nr_float_arrays = -1;
+    readFromBuffer(buffer, buffer_size, offset, spec_size);
+    readFromBuffer(buffer, buffer_size, offset, nr_float_arrays);
+    readFromBuffer(buffer, buffer_size, offset, ms_level);
+    readFromBuffer(buffer, buffer_size, offset, rt);
+
+    if (static_cast<int>(spec_size) < 0)
+    {
+      throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+        "Read an invalid spectrum length, something is wrong here. Aborting.", "memory buffer");
+    }
+
+    if (offset + 2 * spec_size * sizeof(DatumSingleton) > buffer_size)
+    {
+      throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+        "Unexpected end of cached file while reading, something is wrong here. Aborting.", "memory buffer");
+    }
+
+    // locate the strip with a binary search on the sorted m/z block; only the
+    // probed values and the strip itself are touched (and thus paged in)
+    auto mz_at = [buffer, offset](Size i) -> DatumSingleton
+    {
+      DatumSingleton value;
+      memcpy(&value, buffer + offset + i * sizeof(DatumSingleton), sizeof(value));
+      return value;
+    };
+    Size left = 0;
+    Size right = spec_size;
+    while (left < right) // first peak with m/z >= mz_start
+    {
+      Size mid = left + (right - left) / 2;
+      if (mz_at(mid) < mz_start) { left = mid + 1; }
+      else { right = mid; }
+    }
+    const Size strip_begin = left;
+    right = spec_size;
+    while (left < right) // first peak with m/z > mz_end
+    {
+      Size mid = left + (right - left) / 2;
+      if (mz_at(mid) <= mz_end) { left = mid + 1; }
+      else { right = mid; }
+    }
+    const Size strip_end = left;
+    const Size strip_size = strip_end - strip_begin;
+
+    data[0]->data.resize(strip_size);
+    data[1]->data.resize(strip_size);
+    if (strip_size > 0)
+    {
+      memcpy(&(data[0]->data)[0], buffer + offset + strip_begin * sizeof(DatumSingleton), strip_size * sizeof(DatumSingleton));
+      memcpy(&(data[1]->data)[0], buffer + offset + (spec_size + strip_begin) * sizeof(DatumSingleton), strip_size * sizeof(DatumSingleton));
+    }
+    offset += 2 * spec_size * sizeof(DatumSingleton);
+
+    for (Size k = 0; k < nr_float_arrays; k++)
+    {
+      data.push_back(OpenSwath::BinaryDataArrayPtr(new OpenSwath::BinaryDataArray));
+      Size len, len_name;
+      readFromBuffer(buffer, buffer_size, offset, len);
+      readFromBuffer(buffer, buffer_size, offset, len_name);
+
+      if (offset + len_name * sizeof(char) + len * sizeof(DatumSingleton) > buffer_size)
+      {
+        throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+          "Unexpected end of cached file while reading, something is wrong here. Aborting.", "memory buffer");
+      }
+
+      // We will not read names longer than 1024 bytes (user-generated input data)
+      if (len_name <= 1023)
+      {
+        data.back()->description = std::string(buffer + offset, len_name);
+      }
+      offset += len_name * sizeof(char);
+
+      if (len == spec_size)
+      { // per-peak array (e.g. ion mobility): only the strip is needed
+        data.back()->data.resize(strip_size);
+        if (strip_size > 0)
+        {
+          memcpy(&(data.back()->data)[0], buffer + offset + strip_begin * sizeof(DatumSingleton), strip_size * sizeof(DatumSingleton));
+        }
+      }
+      else
+      {
+        data.back()->data.resize(len);
+        if (len > 0)
+        {
+          memcpy(&(data.back()->data)[0], buffer + offset, len * sizeof(DatumSingleton));
+        }
+      }
+      offset += len * sizeof(DatumSingleton);
+    }
+    return data;
+  }
+
+  std::vector<OpenSwath::BinaryDataArrayPtr> CachedMzMLHandler::readChromatogramFast(const char* buffer, Size buffer_size, Size& offset)
+  {
+    std::vector<OpenSwath::BinaryDataArrayPtr> data;
+    data.push_back(OpenSwath::BinaryDataArrayPtr(new OpenSwath::BinaryDataArray));
+    data.push_back(OpenSwath::BinaryDataArrayPtr(new OpenSwath::BinaryDataArray));
+
+    Size chrom_size = -1;
+    Size nr_float_arrays = -1;
+    readFromBuffer(buffer, buffer_size, offset, chrom_size);
+    readFromBuffer(buffer, buffer_size, offset, nr_float_arrays);
+
+    if (static_cast<int>(chrom_size) < 0)
+    {
+      throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+        "Read an invalid chromatogram length, something is wrong here. Aborting.", "memory buffer");
+    }
+
+    readDataFast_(buffer, buffer_size, offset, data, chrom_size, nr_float_arrays);
+    return data;
+  }
+
+  void CachedMzMLHandler::readDataFast_(const char* buffer, Size buffer_size, Size& offset,
+                                        std::vector<OpenSwath::BinaryDataArrayPtr>& data,
+                                        const Size& data_size,
+                                        const Size& nr_float_arrays)
+  {
+    OPENMS_PRECONDITION(data.size() == 2, "Input data needs to have 2 slots.")
+
+    if (offset + 2 * data_size * sizeof(DatumSingleton) > buffer_size)
+    {
+      throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+        "Unexpected end of cached file while reading, something is wrong here. Aborting.", "memory buffer");
+    }
+
+    data[0]->data.resize(data_size);
+    data[1]->data.resize(data_size);
+
+    if (data_size > 0)
+    {
+      memcpy(&(data[0]->data)[0], buffer + offset, data_size * sizeof(DatumSingleton));
+      offset += data_size * sizeof(DatumSingleton);
+      memcpy(&(data[1]->data)[0], buffer + offset, data_size * sizeof(DatumSingleton));
+      offset += data_size * sizeof(DatumSingleton);
+    }
+    if (nr_float_arrays == 0)
+    {
+      return;
+    }
+    for (Size k = 0; k < nr_float_arrays; k++)
+    {
+      data.push_back(OpenSwath::BinaryDataArrayPtr(new OpenSwath::BinaryDataArray));
+      Size len, len_name;
+      readFromBuffer(buffer, buffer_size, offset, len);
+      readFromBuffer(buffer, buffer_size, offset, len_name);
+
+      if (offset + len_name * sizeof(char) + len * sizeof(DatumSingleton) > buffer_size)
+      {
+        throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+          "Unexpected end of cached file while reading, something is wrong here. Aborting.", "memory buffer");
+      }
+
+      // We will not read names longer than 1024 bytes (user-generated input data)
+      if (len_name <= 1023)
+      {
+        data.back()->description = std::string(buffer + offset, len_name);
+      }
+      offset += len_name * sizeof(char);
+
+      data.back()->data.resize(len);
+      if (len > 0)
+      {
+        memcpy(&(data.back()->data)[0], buffer + offset, len * sizeof(DatumSingleton));
+      }
+      offset += len * sizeof(DatumSingleton);
+    }
+  }
+
   std::vector<OpenSwath::BinaryDataArrayPtr> CachedMzMLHandler::readChromatogramFast(std::ifstream& ifs)
   {
     std::vector<OpenSwath::BinaryDataArrayPtr> data;
@@ -370,55 +697,84 @@ namespace OpenMS::Internal
     return data;
   }
 
-  void CachedMzMLHandler::readSpectrum(SpectrumType& spectrum, std::ifstream& ifs)
+  namespace
   {
-    int ms_level;
-    double rt;
-    std::vector<OpenSwath::BinaryDataArrayPtr> data = readSpectrumFast(ifs, ms_level, rt);
-    spectrum.reserve(data[0]->data.size());
-    spectrum.setMSLevel(ms_level);
-    spectrum.setRT(rt);
-
-    for (Size j = 0; j < data[0]->data.size(); j++)
+    // assemble an MSSpectrum from the raw data arrays of a cached spectrum
+    void fillSpectrumFromArrays(MSSpectrum& spectrum, const std::vector<OpenSwath::BinaryDataArrayPtr>& data, int ms_level, double rt)
     {
-      Peak1D p;
-      p.setMZ(data[0]->data[j]);
-      p.setIntensity(data[1]->data[j]);
-      spectrum.push_back(p);
+      spectrum.reserve(data[0]->data.size());
+      spectrum.setMSLevel(ms_level);
+      spectrum.setRT(rt);
+
+      for (Size j = 0; j < data[0]->data.size(); j++)
+      {
+        Peak1D p;
+        p.setMZ(data[0]->data[j]);
+        p.setIntensity(data[1]->data[j]);
+        spectrum.push_back(p);
+      }
+
+      for (Size j = 2; j < data.size(); j++)
+      {
+        spectrum.getFloatDataArrays().push_back(MSSpectrum::FloatDataArray());
+        spectrum.getFloatDataArrays().back().reserve(data[j]->data.size());
+        spectrum.getFloatDataArrays().back().setName(data[j]->description);
+        for (const auto& k : data[j]->data) spectrum.getFloatDataArrays().back().push_back(k);
+      }
     }
 
-    for (Size j = 2; j < data.size(); j++)
+    // assemble an MSChromatogram from the raw data arrays of a cached chromatogram
+    void fillChromatogramFromArrays(MSChromatogram& chromatogram, const std::vector<OpenSwath::BinaryDataArrayPtr>& data)
     {
-      spectrum.getFloatDataArrays().push_back(MSSpectrum::FloatDataArray());
-      spectrum.getFloatDataArrays().back().reserve(data[j]->data.size());
-      spectrum.getFloatDataArrays().back().setName(data[j]->description);
-      for (const auto& k : data[j]->data) spectrum.getFloatDataArrays().back().push_back(k);
+      chromatogram.reserve(data[0]->data.size());
+
+      for (Size j = 0; j < data[0]->data.size(); j++)
+      {
+        ChromatogramPeak p;
+        p.setRT(data[0]->data[j]);
+        p.setIntensity(data[1]->data[j]);
+        chromatogram.push_back(p);
+      }
+
+      MSChromatogram::FloatDataArrays fdas;
+      for (Size j = 2; j < data.size(); j++)
+      {
+        MSChromatogram::FloatDataArray fda;
+        fda.reserve(data[j]->data.size());
+        for (const auto& k : fda) fda.push_back(k);
+        fda.setName(data[j]->description);
+        fdas.push_back(fda);
+      }
+      chromatogram.setFloatDataArrays(fdas);
     }
   }
 
+  void CachedMzMLHandler::readSpectrum(SpectrumType& spectrum, std::ifstream& ifs)
+  {
+    int ms_level;
+    double rt;
+    std::vector<OpenSwath::BinaryDataArrayPtr> data = readSpectrumFast(ifs, ms_level, rt);
+    fillSpectrumFromArrays(spectrum, data, ms_level, rt);
+  }
+
+  void CachedMzMLHandler::readSpectrum(SpectrumType& spectrum, const char* buffer, Size buffer_size, Size& offset)
+  {
+    int ms_level;
+    double rt;
+    std::vector<OpenSwath::BinaryDataArrayPtr> data = readSpectrumFast(buffer, buffer_size, offset, ms_level, rt);
+    fillSpectrumFromArrays(spectrum, data, ms_level, rt);
+  }
+
   void CachedMzMLHandler::readChromatogram(ChromatogramType& chromatogram, std::ifstream& ifs)
   {
     std::vector<OpenSwath::BinaryDataArrayPtr> data = readChromatogramFast(ifs);
-    chromatogram.reserve(data[0]->data.size());
-
-    for (Size j = 0; j < data[0]->data.size(); j++)
-    {
-      ChromatogramPeak p;
-      p.setRT(data[0]->data[j]);
-      p.setIntensity(data[1]->data[j]);
-      chromatogram.push_back(p);
-    }
+    fillChromatogramFromArrays(chromatogram, data);
+  }
 
-    MSChromatogram::FloatDataArrays fdas;
-    for (Size j = 2; j < data.size(); j++)
-    {
-      MSChromatogram::FloatDataArray fda;
-      fda.reserve(data[j]->data.size());
-      for (const auto& k : fda) fda.push_back(k);
-      fda.setName(data[j]->description);
-      fdas.push_back(fda);
-    }
-    chromatogram.setFloatDataArrays(fdas);
+  void CachedMzMLHandler::readChromatogram(ChromatogramType& chromatogram, const char* buffer, Size buffer_size, Size& offset)
+  {
+    std::vector<OpenSwath::BinaryDataArrayPtr> data = readChromatogramFast(buffer, buffer_size, offset);
+    fillChromatogramFromArrays(chromatogram, data);
   }
 
   void CachedMzMLHandler::writeSpectrum_(const SpectrumType& spectrum, std::ofstream& ofs) const
@@ -478,7 +478,7 @@ namespace OpenMS::Internal
     {
       setProgress(++progress_);
       pep_hit_ = PeptideHit();
-      peptide_evidences_ = vector<PeptideEvidence>();
+      peptide_evidences_.clear();
       pep_hit_.setCharge(attributeAsInt_(attributes, "charge"));
       pep_hit_.setScore(attributeAsDouble_(attributes, "score"));
       pep_hit_.setSequence(AASequence::fromString(String(attributeAsString_(attributes, "sequence"))));
@@ -868,13 +868,13 @@ namespace OpenMS::Internal
       os << " sequence=\"" << writeXMLEscape(id.getHits()[j].getSequence().toString()) << "\"";
       os << " charge=\"" << id.getHits()[j].getCharge() << "\"";
 
-      vector<PeptideEvidence> pes = id.getHits()[j].getPeptideEvidences();
+      const PeptideHit::PeptideEvidences& pes = id.getHits()[j].getPeptideEvidences();
 
       IdXMLFile::createFlankingAAXMLString_(pes, os);
       IdXMLFile::createPositionXMLString_(pes, os);
 
       String accs;
-      for (vector<PeptideEvidence>::const_iterator pe = pes.begin(); pe != pes.end(); ++pe)
+      for (auto pe = pes.begin(); pe != pes.end(); ++pe)
       {
         if (!accs.empty())
         {
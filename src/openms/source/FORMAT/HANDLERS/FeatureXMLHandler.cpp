@@ -70,6 +70,24 @@ namespace OpenMS::Internal
   {
     const FeatureMap& feature_map = *(cmap_);
 
+    writeHeader(os, feature_map.size());
+
+    startProgress(0, feature_map.size(), "Storing featureXML file");
+    for (Size s = 0; s < feature_map.size(); s++)
+    {
+      writeFeature_(file_, os, feature_map[s], "f_", feature_map[s].getUniqueId(), 0);
+      setProgress(s);
+      // writeFeature_(file_, os, feature_map[s], "f_", s, 0);
+    }
+    endProgress();
+
+    writeFooter(os);
+  }
+
+  void FeatureXMLHandler::writeHeader(std::ostream& os, Size count)
+  {
+    const FeatureMap& feature_map = *(cmap_);
+
     os << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>\n"
        << "<featureMap version=\"" << version_ << "\"";
     // file id
@@ -204,16 +222,16 @@ namespace OpenMS::Internal
     }
 
     // write features with their corresponding attributes
-    os << "\t<featureList count=\"" << feature_map.size() << "\">\n";
-    startProgress(0, feature_map.size(), "Storing featureXML file");
-    for (Size s = 0; s < feature_map.size(); s++)
-    {
-      writeFeature_(file_, os, feature_map[s], "f_", feature_map[s].getUniqueId(), 0);
-      setProgress(s);
-      // writeFeature_(file_, os, feature_map[s], "f_", s, 0);
-    }
-    endProgress();
+    os << "\t<featureList count=\"" << count << "\">\n";
+  }
 
+  void FeatureXMLHandler::writeFeature(std::ostream& os, const Feature& feature)
+  {
+    writeFeature_(file_, os, feature, "f_", feature.getUniqueId(), 0);
+  }
+
+  void FeatureXMLHandler::writeFooter(std::ostream& os)
+  {
     os << "\t</featureList>\n";
     os << "</featureMap>\n";
 
@@ -591,7 +609,7 @@ namespace OpenMS::Internal
     else if (tag == "PeptideHit")
     {
       pep_hit_ = PeptideHit();
-      vector<PeptideEvidence> peptide_evidences_;
+      PeptideHit::PeptideEvidences peptide_evidences_;
 
       pep_hit_.setCharge(attributeAsInt_(attributes, "charge"));
       pep_hit_.setScore(attributeAsDouble_(attributes, "score"));
@@ -776,6 +794,9 @@ namespace OpenMS::Internal
     {
       ConvexHull2D hull;
       hull.setHullPoints(current_chull_);
+      // restore the compact per-scan representation (cheaper to keep in memory and
+      // re-enables ConvexHull2D::encloses()); legacy hulls stay as plain points
+      hull.compact();
       current_feature_->getConvexHulls().push_back(hull);
     }
     else if (tag == "subordinate")
@@ -989,13 +1010,13 @@ namespace OpenMS::Internal
       os << " sequence=\"" << writeXMLEscape(h.getSequence().toString()) << "\"";
       os << " charge=\"" << h.getCharge() << "\"";
 
-      const vector<PeptideEvidence>& pes = id.getHits()[j].getPeptideEvidences();
+      const PeptideHit::PeptideEvidences& pes = id.getHits()[j].getPeptideEvidences();
 
       IdXMLFile::createFlankingAAXMLString_(pes, os);
       IdXMLFile::createPositionXMLString_(pes, os);
 
       String accs;
-      for (vector<PeptideEvidence>::const_iterator pe = pes.begin(); pe != pes.end(); ++pe)
+      for (auto pe = pes.begin(); pe != pes.end(); ++pe)
       {
         if (!accs.empty())
         {
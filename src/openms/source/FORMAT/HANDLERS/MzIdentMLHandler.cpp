@@ -1270,9 +1270,9 @@ namespace OpenMS::Internal
         std::vector<String> pevid_ids;
         if (!duplicate)
         {
-          std::vector<PeptideEvidence> peptide_evidences = hit.getPeptideEvidences();
+          const PeptideHit::PeptideEvidences& peptide_evidences = hit.getPeptideEvidences();
           // TODO idXML allows peptide hits without protein references! Fails in that case - run PeptideIndexer first
-          for (std::vector<PeptideEvidence>::const_iterator pe = peptide_evidences.begin(); pe != peptide_evidences.end(); ++pe)
+          for (auto pe = peptide_evidences.begin(); pe != peptide_evidences.end(); ++pe)
           {
             String pevid =  "PEV_" + String(UniqueIdGenerator::getUniqueId());
             String dBSequence_ref;
@@ -1816,11 +1816,11 @@ namespace OpenMS::Internal
       {
         if (alpha_peptide)
         {
-          std::vector<PeptideEvidence> peptide_evidences = hit.getPeptideEvidences();
+          const PeptideHit::PeptideEvidences& peptide_evidences = hit.getPeptideEvidences();
           // TODO idXML allows peptide hits without protein references! Fails in that case - run PeptideIndexer first
 
           // TODO BETA PEPTIDE Protein Info
-          for (std::vector<PeptideEvidence>::const_iterator pe = peptide_evidences.begin(); pe != peptide_evidences.end(); ++pe)
+          for (auto pe = peptide_evidences.begin(); pe != peptide_evidences.end(); ++pe)
           {
             String pevid =  "PEV_" + String(UniqueIdGenerator::getUniqueId());
             String dBSequence_ref;
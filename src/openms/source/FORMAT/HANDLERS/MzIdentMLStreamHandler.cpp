@@ -0,0 +1,663 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Mathias Walzer $
+// $Authors: Mathias Walzer $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/FORMAT/HANDLERS/MzIdentMLStreamHandler.h>
+
+#include <OpenMS/CHEMISTRY/ModificationsDB.h>
+#include <OpenMS/CONCEPT/Constants.h>
+#include <OpenMS/CONCEPT/LogStream.h>
+#include <OpenMS/CONCEPT/UniqueIdGenerator.h>
+#include <OpenMS/DATASTRUCTURES/DateTime.h>
+
+#include <set>
+
+using namespace std;
+
+namespace OpenMS
+{
+  namespace Internal
+  {
+
+    MzIdentMLStreamHandler::MzIdentMLStreamHandler(vector<ProteinIdentification>& pro_id, vector<PeptideIdentification>& pep_id, const String& filename, const String& version, const ProgressLogger& logger) :
+      XMLHandler(filename, version),
+      logger_(logger),
+      cv_(ControlledVocabulary::getPSIMSCV()),
+      pro_id_(&pro_id),
+      pep_id_(&pep_id)
+    {
+      // same score term sets as MzIdentMLDOMHandler, built once per file
+      cv_.getAllChildTerms(q_score_terms_, "MS:1002354"); //q-value for peptides
+      cv_.getAllChildTerms(e_score_terms_, "MS:1001872");
+      set<String> e_score_tmp;
+      cv_.getAllChildTerms(e_score_tmp, "MS:1002353"); //E-value for peptides
+      e_score_terms_.insert(e_score_tmp.begin(), e_score_tmp.end());
+      cv_.getAllChildTerms(specific_score_terms_, "MS:1001143"); //search engine specific score for PSMs
+    }
+
+    MzIdentMLStreamHandler::~MzIdentMLStreamHandler()
+    = default;
+
+    CVTerm MzIdentMLStreamHandler::makeCVTerm_(const CVParam& param) const
+    {
+      CVTerm::Unit u;
+      if (!param.unit_accession.empty() && !param.unit_name.empty())
+      {
+        u = CVTerm::Unit(param.unit_accession, param.unit_name, param.unit_cv_ref);
+        if (param.unit_cv_ref.empty())
+        {
+          OPENMS_LOG_WARN << "This mzid file uses a cv term with units, but without "
+                          << "unit cv reference (required)! Please notify the mzid "
+                          << "producer of this file. \"" << param.name << "\" will be read as \""
+                          << param.unit_name << "\" but further actions on this unit may fail."
+                          << endl;
+        }
+      }
+      return CVTerm(param.accession, param.name, param.cv_ref, param.value, u);
+    }
+
+    void MzIdentMLStreamHandler::startElement(const XMLCh* const /*uri*/, const XMLCh* const /*local_name*/, const XMLCh* const qname, const xercesc::Attributes& attributes)
+    {
+      String tag = sm_.convert(qname);
+      open_tags_.push_back(tag);
+
+      String parent_tag;
+      if (open_tags_.size() > 1)
+      {
+        parent_tag = *(open_tags_.end() - 2);
+      }
+
+      if (tag == "cvParam")
+      {
+        CVParam param;
+        param.accession = attributeAsString_(attributes, "accession");
+        optionalAttributeAsString_(param.name, attributes, "name");
+        optionalAttributeAsString_(param.cv_ref, attributes, "cvRef");
+        optionalAttributeAsString_(param.value, attributes, "value");
+        optionalAttributeAsString_(param.unit_accession, attributes, "unitAccession");
+        optionalAttributeAsString_(param.unit_name, attributes, "unitName");
+        optionalAttributeAsString_(param.unit_cv_ref, attributes, "unitCvRef");
+
+        if (param.accession == "MS:1002494") //cross-linking search
+        {
+          throw Exception::NotImplemented(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION);
+        }
+
+        if (parent_tag == "Modification" && !current_mods_.empty())
+        {
+          current_mods_.back().params.push_back(param);
+        }
+        else if (parent_tag == "SpectrumIdentificationItem" && in_item_)
+        {
+          item_cv_params_[param.accession].push_back(makeCVTerm_(param));
+        }
+        else if (parent_tag == "SpectrumIdentificationResult" && in_result_)
+        {
+          result_cv_params_[param.accession].push_back(makeCVTerm_(param));
+        }
+        else if (parent_tag == "SoftwareName" && !current_software_id_.empty())
+        {
+          as_map_[current_software_id_] = make_pair(param.name, current_software_version_);
+        }
+        // cvParams of skipped sections (ProteinDetectionList, Fragmentation,
+        // protocol details, ...) are dropped here without being materialized
+        return;
+      }
+
+      if (tag == "userParam")
+      {
+        String name = attributeAsString_(attributes, "name");
+        String value, type;
+        bool has_value = optionalAttributeAsString_(value, attributes, "value");
+        optionalAttributeAsString_(type, attributes, "type");
+        DataValue dv = has_value ? fromXSDString(type, value) : DataValue::EMPTY;
+
+        if (parent_tag == "SpectrumIdentificationItem" && in_item_)
+        {
+          item_user_params_[name] = dv;
+        }
+        else if (parent_tag == "SpectrumIdentificationResult" && in_result_)
+        {
+          result_user_params_[name] = dv;
+        }
+        else if (parent_tag == "SoftwareName" && !current_software_id_.empty())
+        {
+          as_map_[current_software_id_] = make_pair(name, current_software_version_);
+        }
+        return;
+      }
+
+      if (tag == "AnalysisSoftware")
+      {
+        current_software_id_ = attributeAsString_(attributes, "id");
+        current_software_version_ = "";
+        optionalAttributeAsString_(current_software_version_, attributes, "version");
+        return;
+      }
+
+      if (tag == "DBSequence")
+      {
+        // only the accession is kept; the Seq text and the protein-level
+        // cvParams are skipped (this is where the DOM memory goes)
+        String acc;
+        if (optionalAttributeAsString_(acc, attributes, "accession") && !acc.empty())
+        {
+          db_accession_[attributeAsString_(attributes, "id")] = acc;
+        }
+        return;
+      }
+
+      if (tag == "Peptide")
+      {
+        current_peptide_id_ = attributeAsString_(attributes, "id");
+        current_peptide_name_ = "";
+        optionalAttributeAsString_(current_peptide_name_, attributes, "name");
+        current_peptide_seq_ = "";
+        current_mods_.clear();
+        current_subs_.clear();
+        return;
+      }
+
+      if (tag == "PeptideSequence")
+      {
+        in_peptide_sequence_ = true;
+        return;
+      }
+
+      if (tag == "Modification")
+      {
+        ModificationInfo mod;
+        if (!optionalAttributeAsInt_(mod.location, attributes, "location"))
+        {
+          OPENMS_LOG_WARN << "Found unreadable modification location." << endl;
+          mod.location = -2;
+        }
+        current_mods_.push_back(mod);
+        return;
+      }
+
+      if (tag == "SubstitutionModification")
+      {
+        SubstitutionInfo sub;
+        optionalAttributeAsInt_(sub.location, attributes, "location");
+        String residue;
+        if (optionalAttributeAsString_(residue, attributes, "originalResidue") && !residue.empty())
+        {
+          sub.original = residue[0];
+        }
+        residue = "";
+        if (optionalAttributeAsString_(residue, attributes, "replacementResidue") && !residue.empty())
+        {
+          sub.replacement = residue[0];
+        }
+        current_subs_.push_back(sub);
+        return;
+      }
+
+      if (tag == "PeptideEvidence")
+      {
+        String id = attributeAsString_(attributes, "id");
+        String peptide_ref = attributeAsString_(attributes, "peptide_ref");
+        PeptideEvidenceInfo evidence;
+        evidence.db_sequence_ref = attributeAsString_(attributes, "dBSequence_ref");
+        if (!optionalAttributeAsInt_(evidence.start, attributes, "start") ||
+            !optionalAttributeAsInt_(evidence.stop, attributes, "end"))
+        {
+          OPENMS_LOG_WARN << "'PeptideEvidence' without reference to the position in the originating sequence found." << endl;
+        }
+        String border;
+        if (optionalAttributeAsString_(border, attributes, "pre") && !border.empty())
+        {
+          evidence.pre = border[0];
+        }
+        border = "";
+        if (optionalAttributeAsString_(border, attributes, "post") && !border.empty())
+        {
+          evidence.post = border[0];
+        }
+        String decoy;
+        if (optionalAttributeAsString_(decoy, attributes, "isDecoy"))
+        {
+          evidence.decoy = decoy.hasPrefix('t') || decoy.hasPrefix('1');
+        }
+        pe_ev_map_[id] = evidence;
+        p_pv_map_.insert(make_pair(peptide_ref, id));
+        return;
+      }
+
+      if (tag == "SpectrumIdentification")
+      {
+        // one identification run per SpectrumIdentification, as in the DOM handler
+        String sil_ref = attributeAsString_(attributes, "spectrumIdentificationList_ref");
+        String sip_ref = attributeAsString_(attributes, "spectrumIdentificationProtocol_ref");
+        String date;
+        optionalAttributeAsString_(date, attributes, "activityDate");
+
+        pro_id_->push_back(ProteinIdentification());
+        if (!date.empty())
+        {
+          pro_id_->back().setDateTime(DateTime::fromString(date));
+        }
+        else
+        {
+          pro_id_->back().setDateTime(DateTime::now());
+        }
+        pro_id_->back().setIdentifier(UniqueIdGenerator::getUniqueId());
+        sil_to_run_[sil_ref] = pro_id_->size() - 1;
+        sip_to_runs_[sip_ref].push_back(pro_id_->size() - 1);
+        return;
+      }
+
+      if (tag == "InputSpectra" && parent_tag == "SpectrumIdentification" && !pro_id_->empty())
+      {
+        String ref;
+        if (optionalAttributeAsString_(ref, attributes, "spectraData_ref"))
+        {
+          run_sdata_ref_[pro_id_->size() - 1] = ref;
+        }
+        return;
+      }
+
+      if (tag == "SearchDatabaseRef" && parent_tag == "SpectrumIdentification" && !pro_id_->empty())
+      {
+        String ref;
+        if (optionalAttributeAsString_(ref, attributes, "searchDatabase_ref"))
+        {
+          run_db_ref_[pro_id_->size() - 1] = ref;
+        }
+        return;
+      }
+
+      if (tag == "SpectrumIdentificationProtocol")
+      {
+        // only the search engine is taken from the protocol; the detailed
+        // search parameters are skipped in streamed mode
+        String id = attributeAsString_(attributes, "id");
+        String software_ref;
+        optionalAttributeAsString_(software_ref, attributes, "analysisSoftware_ref");
+        map<String, vector<Size> >::const_iterator runs = sip_to_runs_.find(id);
+        map<String, pair<String, String> >::const_iterator software = as_map_.find(software_ref);
+        if (runs != sip_to_runs_.end() && software != as_map_.end())
+        {
+          for (Size run : runs->second)
+          {
+            pro_id_->at(run).setSearchEngine(software->second.first);
+            pro_id_->at(run).setSearchEngineVersion(software->second.second);
+          }
+        }
+        return;
+      }
+
+      if (tag == "SearchDatabase")
+      {
+        String location, db_version;
+        optionalAttributeAsString_(location, attributes, "location");
+        optionalAttributeAsString_(db_version, attributes, "version");
+        db_map_[attributeAsString_(attributes, "id")] = make_pair(location, db_version);
+        return;
+      }
+
+      if (tag == "SpectraData")
+      {
+        String location;
+        optionalAttributeAsString_(location, attributes, "location");
+        sd_map_[attributeAsString_(attributes, "id")] = location;
+        return;
+      }
+
+      if (tag == "SpectrumIdentificationList")
+      {
+        current_sil_id_ = attributeAsString_(attributes, "id");
+        return;
+      }
+
+      if (tag == "SpectrumIdentificationResult")
+      {
+        current_result_ = PeptideIdentification();
+        current_result_.setHigherScoreBetter(false); //either a q-value or an e-value, only if neither available there will be another
+        current_result_.setSpectrumReference(attributeAsString_(attributes, "spectrumID"));
+        result_cv_params_.clear();
+        result_user_params_.clear();
+        in_result_ = true;
+        return;
+      }
+
+      if (tag == "SpectrumIdentificationItem")
+      {
+        current_item_peptide_ref_ = attributeAsString_(attributes, "peptide_ref");
+        current_item_rank_ = 0;
+        if (!optionalAttributeAsInt_(current_item_rank_, attributes, "rank"))
+        {
+          OPENMS_LOG_WARN << "Found unreadable PSM rank." << endl;
+        }
+        current_item_charge_ = 0;
+        if (!optionalAttributeAsInt_(current_item_charge_, attributes, "chargeState"))
+        {
+          OPENMS_LOG_WARN << "Found unreadable 'chargeState'." << endl;
+        }
+        current_item_exp_mz_ = 0.0;
+        optionalAttributeAsDouble_(current_item_exp_mz_, attributes, "experimentalMassToCharge");
+        current_item_calc_mz_ = 0.0;
+        optionalAttributeAsDouble_(current_item_calc_mz_, attributes, "calculatedMassToCharge");
+        String pass;
+        current_item_pass_threshold_ = optionalAttributeAsString_(pass, attributes, "passThreshold") && asBool_(pass);
+        item_cv_params_.clear();
+        item_user_params_.clear();
+        in_item_ = true;
+        return;
+      }
+
+      // everything else (ProteinDetection section, Fragmentation, protocol
+      // details, audit and provenance data, ...) is skipped
+    }
+
+    void MzIdentMLStreamHandler::characters(const XMLCh* const chars, const XMLSize_t /*length*/)
+    {
+      if (in_peptide_sequence_)
+      {
+        current_peptide_seq_ += sm_.convert(chars);
+      }
+      // all other text content (most notably protein Seq elements) is skipped
+    }
+
+    void MzIdentMLStreamHandler::endElement(const XMLCh* const /*uri*/, const XMLCh* const /*local_name*/, const XMLCh* const qname)
+    {
+      String tag = sm_.convert(qname);
+      open_tags_.pop_back();
+
+      if (tag == "PeptideSequence")
+      {
+        in_peptide_sequence_ = false;
+      }
+      else if (tag == "Peptide")
+      {
+        finishPeptide_();
+      }
+      else if (tag == "SpectrumIdentificationItem")
+      {
+        finishSpectrumIdentificationItem_();
+        in_item_ = false;
+      }
+      else if (tag == "SpectrumIdentificationResult")
+      {
+        finishSpectrumIdentificationResult_();
+        in_result_ = false;
+      }
+      else if (tag == "AnalysisSoftware")
+      {
+        current_software_id_ = "";
+      }
+      else if (tag == "Inputs")
+      {
+        // Inputs closes before the first result; resolve the database and
+        // spectra data references collected from the AnalysisCollection
+        for (map<Size, String>::const_iterator it = run_db_ref_.begin(); it != run_db_ref_.end(); ++it)
+        {
+          ProteinIdentification::SearchParameters sp;
+          sp.db = db_map_[it->second].first;
+          sp.db_version = db_map_[it->second].second;
+          pro_id_->at(it->first).setSearchParameters(sp);
+        }
+        for (map<Size, String>::const_iterator it = run_sdata_ref_.begin(); it != run_sdata_ref_.end(); ++it)
+        {
+          // internally we store a list of files so convert the mzIdentML file String to a StringList
+          StringList spectra_data_list;
+          spectra_data_list.push_back(sd_map_[it->second]);
+          pro_id_->at(it->first).setMetaValue("spectra_data", spectra_data_list);
+        }
+      }
+      else if (tag == "MzIdentML")
+      {
+        for (vector<ProteinIdentification>::iterator it = pro_id_->begin(); it != pro_id_->end(); ++it)
+        {
+          it->sort();
+        }
+      }
+    }
+
+    void MzIdentMLStreamHandler::finishPeptide_()
+    {
+      AASequence aas;
+      try
+      {
+        String seq = current_peptide_seq_;
+        seq.trim();
+        for (vector<SubstitutionInfo>::const_iterator sub = current_subs_.begin(); sub != current_subs_.end(); ++sub)
+        {
+          if (sub->location > 0 && sub->location <= (Int)seq.size())
+          {
+            seq[sub->location - 1] = sub->replacement;
+          }
+          else if (seq.hasSubstring(sub->original)) //no location - every occurrence will be replaced
+          {
+            seq.substitute(sub->original, sub->replacement);
+          }
+        }
+        aas = AASequence::fromString(seq);
+
+        for (vector<ModificationInfo>::const_iterator mod = current_mods_.begin(); mod != current_mods_.end(); ++mod)
+        {
+          for (vector<CVParam>::const_iterator param = mod->params.begin(); param != mod->params.end(); ++param)
+          {
+            // resolve the modification by name; MS:1001460 carries the OpenMS
+            // name in its value (same common cases as the DOM handler covers,
+            // mass-delta-only modifications are not supported in streamed mode)
+            String mod_name = (param->accession == "MS:1001460") ? param->value : param->name;
+            if (mod_name.empty() || !ModificationsDB::getInstance()->has(mod_name))
+            {
+              OPENMS_LOG_WARN << "Modification: " << mod_name << " not found in ModificationsDB." << endl;
+              continue;
+            }
+            if (mod->location == 0)
+            {
+              aas.setNTerminalModification(mod_name);
+            }
+            else if (mod->location == (Int)aas.size() + 1)
+            {
+              aas.setCTerminalModification(mod_name);
+            }
+            else if (mod->location > 0 && mod->location <= (Int)aas.size())
+            {
+              aas.setModification(mod->location - 1, mod_name);
+            }
+          }
+        }
+      }
+      catch (...)
+      {
+        // the "name" attribute, if present, may be parsable (same rescue as the DOM handler)
+        aas = AASequence();
+        if (!current_peptide_name_.empty())
+        {
+          try
+          {
+            aas = AASequence::fromString(current_peptide_name_);
+          }
+          catch (...)
+          {
+            OPENMS_LOG_ERROR << "No amino acid sequence readable from 'Peptide'" << endl;
+          }
+        }
+        else
+        {
+          OPENMS_LOG_ERROR << "No amino acid sequence readable from 'Peptide'" << endl;
+        }
+      }
+      pep_map_[current_peptide_id_] = aas;
+    }
+
+    void MzIdentMLStreamHandler::finishSpectrumIdentificationItem_()
+    {
+      // score type selection, same precedence as the DOM handler
+      double score = 0;
+      bool scoretype = false;
+      for (map<String, vector<CVTerm> >::const_iterator scoreit = item_cv_params_.begin(); scoreit != item_cv_params_.end(); ++scoreit)
+      {
+        if (q_score_terms_.find(scoreit->first) != q_score_terms_.end() || scoreit->first == "MS:1002354")
+        {
+          if (scoreit->first != "MS:1002055") // do not use peptide-level q-values for now
+          {
+            score = scoreit->second.front().getValue().toString().toDouble();
+            current_result_.setHigherScoreBetter(false);
+            current_result_.setScoreType("q-value"); //higherIsBetter = false
+            scoretype = true;
+            break;
+          }
+        }
+        else if (specific_score_terms_.find(scoreit->first) != specific_score_terms_.end())
+        {
+          score = scoreit->second.front().getValue().toString().toDouble();
+          current_result_.setHigherScoreBetter(ControlledVocabulary::CVTerm::isHigherBetterScore(cv_.getTerm(scoreit->first)));
+          current_result_.setScoreType(scoreit->second.front().getName());
+          scoretype = true;
+          break;
+        }
+        else if (e_score_terms_.find(scoreit->first) != e_score_terms_.end())
+        {
+          score = scoreit->second.front().getValue().toString().toDouble();
+          current_result_.setHigherScoreBetter(false);
+          current_result_.setScoreType("E-value"); //higherIsBetter = false
+          scoretype = true;
+          break;
+        }
+        else if (scoreit->first == "MS:1001143")
+        {
+          current_result_.setScoreType("PSM-level search engine specific statistic");
+          current_result_.setHigherScoreBetter(true);
+          scoretype = true;
+        }
+      }
+      if (!scoretype) //else (i.e. no q/E/raw score) no hit will be read, as in the DOM handler
+      {
+        return;
+      }
+
+      //build the PeptideHit from a SpectrumIdentificationItem
+      PeptideHit hit(score, current_item_rank_, current_item_charge_, pep_map_[current_item_peptide_ref_]);
+      for (map<String, vector<CVTerm> >::const_iterator cvs = item_cv_params_.begin(); cvs != item_cv_params_.end(); ++cvs)
+      {
+        for (vector<CVTerm>::const_iterator cv = cvs->second.begin(); cv != cvs->second.end(); ++cv)
+        {
+          if (cvs->first == "MS:1002540")
+          {
+            hit.setMetaValue(cvs->first, cv->getValue().toString());
+          }
+          else if (cvs->first == "MS:1001143") // this is the CV term "PSM-level search engine specific statistic" and it doesn't have a value
+          {
+            continue;
+          }
+          else
+          {
+            hit.setMetaValue(cvs->first, cvParamToValue(cv_, *cv));
+          }
+        }
+      }
+      for (map<String, DataValue>::const_iterator up = item_user_params_.begin(); up != item_user_params_.end(); ++up)
+      {
+        hit.setMetaValue(up->first, up->second);
+      }
+      hit.setMetaValue("calcMZ", current_item_calc_mz_);
+      current_result_.setMZ(current_item_exp_mz_);
+      hit.setMetaValue("pass_threshold", current_item_pass_threshold_);
+
+      //connect the PeptideHit with PeptideEvidences (for AABefore/After) and subsequently with DBSequence (for ProteinAccession)
+      Size run = 0;
+      map<String, Size>::const_iterator run_it = sil_to_run_.find(current_sil_id_);
+      if (run_it != sil_to_run_.end())
+      {
+        run = run_it->second;
+      }
+      pair<multimap<String, String>::const_iterator, multimap<String, String>::const_iterator> pev_its = p_pv_map_.equal_range(current_item_peptide_ref_);
+      for (multimap<String, String>::const_iterator pev_it = pev_its.first; pev_it != pev_its.second; ++pev_it)
+      {
+        bool idec = false;
+        OpenMS::PeptideEvidence pev;
+        map<String, PeptideEvidenceInfo>::const_iterator ev = pe_ev_map_.find(pev_it->second);
+        if (ev != pe_ev_map_.end())
+        {
+          const PeptideEvidenceInfo& pv = ev->second;
+          if (pv.pre != '-') pev.setAABefore(pv.pre);
+          if (pv.post != '-') pev.setAAAfter(pv.post);
+
+          if (pv.start != OpenMS::PeptideEvidence::UNKNOWN_POSITION && pv.stop != OpenMS::PeptideEvidence::UNKNOWN_POSITION)
+          {
+            hit.setMetaValue("start", pv.start);
+            hit.setMetaValue("end", pv.stop);
+            pev.setStart(pv.start);
+            pev.setEnd(pv.stop);
+          }
+
+          idec = pv.decoy;
+          String target_decoy = idec ? "decoy" : "target";
+          if (hit.metaValueExists(Constants::UserParam::TARGET_DECOY) &&
+              hit.getMetaValue(Constants::UserParam::TARGET_DECOY) != target_decoy)
+          {
+            target_decoy = "target+decoy";
+          }
+          hit.setMetaValue(Constants::UserParam::TARGET_DECOY, target_decoy);
+
+          map<String, String>::const_iterator db = db_accession_.find(pv.db_sequence_ref);
+          if (db != db_accession_.end())
+          {
+            pev.setProteinAccession(db->second);
+
+            if (run_it != sil_to_run_.end() &&
+                pro_id_->at(run).findHit(db->second) == pro_id_->at(run).getHits().end())
+            {
+              // protein sequences are skipped in streamed mode, so the hit only carries the accession
+              pro_id_->at(run).insertHit(ProteinHit());
+              pro_id_->at(run).getHits().back().setAccession(db->second);
+              pro_id_->at(run).getHits().back().setMetaValue("isDecoy", idec ? "true" : "false");
+            }
+          }
+        }
+        hit.addPeptideEvidence(pev);
+      }
+      current_result_.insertHit(hit);
+    }
+
+    void MzIdentMLStreamHandler::finishSpectrumIdentificationResult_()
+    {
+      map<String, Size>::const_iterator run_it = sil_to_run_.find(current_sil_id_);
+      if (run_it != sil_to_run_.end())
+      {
+        current_result_.setIdentifier(pro_id_->at(run_it->second).getIdentifier());
+      }
+      current_result_.sortByRank();
+
+      //adopt cv s
+      for (map<String, vector<CVTerm> >::const_iterator cvit = result_cv_params_.begin(); cvit != result_cv_params_.end(); ++cvit)
+      {
+        // check for retention time or scan time entry
+        if (cvit->first == "MS:1000894" || cvit->first == "MS:1000016") //TODO use subordinate terms which define units
+        {
+          double rt = cvit->second.front().getValue().toString().toDouble();
+          if (cvit->second.front().getUnit().accession == "UO:0000031") // minutes
+          {
+            rt *= 60.0;
+          }
+          current_result_.setRT(rt);
+        }
+        else
+        {
+          current_result_.setMetaValue(cvit->first, cvit->second.front().getValue());
+        }
+      }
+      //adopt up s
+      for (map<String, DataValue>::const_iterator upit = result_user_params_.begin(); upit != result_user_params_.end(); ++upit)
+      {
+        current_result_.setMetaValue(upit->first, upit->second);
+      }
+      if (current_result_.getRT() != current_result_.getRT())
+      {
+        OPENMS_LOG_WARN << "No retention time found for 'SpectrumIdentificationResult'" << endl;
+      }
+      pep_id_->push_back(current_result_);
+    }
+
+  } //namespace Internal
+} // namespace OpenMS
@@ -18,7 +18,48 @@
 #include <OpenMS/INTERFACES/IMSDataConsumer.h>
 #include <OpenMS/SYSTEM/File.h>
 
+#include <cmath>
+#include <cstring>
 #include <map>
+#include <sstream>
+
+namespace
+{
+  /**
+    @brief Round the significands of @p data to @p keep_bits bits
+
+    Zeroing the low significand bits (with round-to-nearest) makes the
+    subsequent zlib compression considerably more effective, while the
+    values remain ordinary IEEE floats that any mzML reader understands.
+    See PeakFileOptions::setIntensityMantissaBits().
+  */
+  template <typename FloatType, typename UIntType, int total_mantissa_bits>
+  void truncateMantissaT(std::vector<FloatType>& data, const OpenMS::Int keep_bits)
+  {
+    if (keep_bits >= total_mantissa_bits) return; // nothing to drop
+    const int drop_bits = total_mantissa_bits - keep_bits;
+    const UIntType mask = ~((UIntType(1) << drop_bits) - 1);
+    const UIntType round = UIntType(1) << (drop_bits - 1);
+    for (FloatType& value : data)
+    {
+      if (!std::isfinite(value)) continue; // keep NaN/Inf bit patterns as they are
+      UIntType bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      bits = (bits + round) & mask; // a carry into the exponent rounds up correctly
+      std::memcpy(&value, &bits, sizeof(bits));
+    }
+  }
+
+  void truncateMantissa(std::vector<float>& data, OpenMS::Int keep_bits)
+  {
+    truncateMantissaT<float, OpenMS::UInt32, 23>(data, keep_bits);
+  }
+
+  void truncateMantissa(std::vector<double>& data, OpenMS::Int keep_bits)
+  {
+    truncateMantissaT<double, OpenMS::UInt64, 52>(data, keep_bits);
+  }
+}
 
 namespace OpenMS::Internal
 {
@@ -57,7 +98,19 @@ namespace OpenMS::Internal
 
 
     /// Destructor
-    MzMLHandler::~MzMLHandler() = default;
+    MzMLHandler::~MzMLHandler()
+    {
+      // make sure no background decoding task outlives the handler (e.g. when
+      // parsing was aborted by an exception); errors are already lost here
+      if (spectrum_decode_future_.valid())
+      {
+        try { spectrum_decode_future_.wait(); } catch (...) {}
+      }
+      if (chromatogram_decode_future_.valid())
+      {
+        try { chromatogram_decode_future_.wait(); } catch (...) {}
+      }
+    }
 
     /// Set the peak file options
     void MzMLHandler::setOptions(const PeakFileOptions& opt)
@@ -111,7 +164,18 @@ namespace OpenMS::Internal
 
     void MzMLHandler::populateSpectraWithData_()
     {
+      // finish the previous batch first, so spectra stay in file order
+      flushDecodedSpectra_();
 
+      // hand the current batch over to a background task; the XML parse
+      // thread continues filling the next batch while this one is decoded
+      decoding_spectrum_data_.swap(spectrum_data_);
+      spectrum_data_.reserve(options_.getMaxDataPoolSize());
+      spectrum_decode_future_ = std::async(std::launch::async, [this]() { decodeSpectrumData_(decoding_spectrum_data_); });
+    }
+
+    void MzMLHandler::decodeSpectrumData_(std::vector<SpectrumData>& batch)
+    {
       // Whether spectrum should be populated with data
       if (options_.getFillData())
       {
@@ -120,20 +184,20 @@ namespace OpenMS::Internal
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for (SignedSize i = 0; i < (SignedSize)spectrum_data_.size(); i++)
+        for (SignedSize i = 0; i < (SignedSize)batch.size(); i++)
         {
           // parallel exception catching and re-throwing business
           if (!errCount) // no need to parse further if already an error was encountered
           {
             try
             {
-              populateSpectraWithData_(spectrum_data_[i].data,
-                                       spectrum_data_[i].default_array_length,
+              populateSpectraWithData_(batch[i].data,
+                                       batch[i].default_array_length,
                                        options_,
-                                       spectrum_data_[i].spectrum);
-              if (options_.getSortSpectraByMZ() && !spectrum_data_[i].spectrum.isSorted())
+                                       batch[i].spectrum);
+              if (options_.getSortSpectraByMZ() && !batch[i].spectrum.isSorted())
               {
-                spectrum_data_[i].spectrum.sortByPosition();
+                batch[i].spectrum.sortByPosition();
               }
             }
 
@@ -159,29 +223,49 @@ namespace OpenMS::Internal
           throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, file_, "Error during parsing of binary data: '" + error_message + "'");
         }
       }
+    }
+
+    void MzMLHandler::flushDecodedSpectra_()
+    {
+      if (spectrum_decode_future_.valid())
+      {
+        spectrum_decode_future_.get(); // re-throws decoding errors on the parsing thread
+      }
 
       // Append all spectra to experiment / consumer
-      for (Size i = 0; i < spectrum_data_.size(); i++)
+      for (Size i = 0; i < decoding_spectrum_data_.size(); i++)
       {
         if (consumer_ != nullptr)
         {
-          consumer_->consumeSpectrum(spectrum_data_[i].spectrum);
+          consumer_->consumeSpectrum(decoding_spectrum_data_[i].spectrum);
           if (options_.getAlwaysAppendData())
           {
-            exp_->addSpectrum(std::move(spectrum_data_[i].spectrum));
+            exp_->addSpectrum(std::move(decoding_spectrum_data_[i].spectrum));
           }
         }
         else
         {
-          exp_->addSpectrum(std::move(spectrum_data_[i].spectrum));
+          exp_->addSpectrum(std::move(decoding_spectrum_data_[i].spectrum));
         }
       }
 
       // Delete batch
-      spectrum_data_.clear();
+      decoding_spectrum_data_.clear();
     }
 
     void MzMLHandler::populateChromatogramsWithData_()
+    {
+      // finish the previous batch first, so chromatograms stay in file order
+      flushDecodedChromatograms_();
+
+      // hand the current batch over to a background task; the XML parse
+      // thread continues filling the next batch while this one is decoded
+      decoding_chromatogram_data_.swap(chromatogram_data_);
+      chromatogram_data_.reserve(options_.getMaxDataPoolSize());
+      chromatogram_decode_future_ = std::async(std::launch::async, [this]() { decodeChromatogramData_(decoding_chromatogram_data_); });
+    }
+
+    void MzMLHandler::decodeChromatogramData_(std::vector<ChromatogramData>& batch)
     {
       // Whether chromatogram should be populated with data
       if (options_.getFillData())
@@ -191,18 +275,18 @@ namespace OpenMS::Internal
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for (SignedSize i = 0; i < (SignedSize)chromatogram_data_.size(); i++)
+        for (SignedSize i = 0; i < (SignedSize)batch.size(); i++)
         {
           // parallel exception catching and re-throwing business
           try
           {
-            populateChromatogramsWithData_(chromatogram_data_[i].data,
-                                           chromatogram_data_[i].default_array_length,
+            populateChromatogramsWithData_(batch[i].data,
+                                           batch[i].default_array_length,
                                            options_,
-                                           chromatogram_data_[i].chromatogram);
-            if (options_.getSortChromatogramsByRT() && !chromatogram_data_[i].chromatogram.isSorted())
+                                           batch[i].chromatogram);
+            if (options_.getSortChromatogramsByRT() && !batch[i].chromatogram.isSorted())
             {
-              chromatogram_data_[i].chromatogram.sortByPosition();
+              batch[i].chromatogram.sortByPosition();
             }
           }
           catch (OpenMS::Exception::BaseException& e)
@@ -228,26 +312,34 @@ namespace OpenMS::Internal
         }
 
       }
+    }
+
+    void MzMLHandler::flushDecodedChromatograms_()
+    {
+      if (chromatogram_decode_future_.valid())
+      {
+        chromatogram_decode_future_.get(); // re-throws decoding errors on the parsing thread
+      }
 
       // Append all chromatograms to experiment / consumer
-      for (Size i = 0; i < chromatogram_data_.size(); i++)
+      for (Size i = 0; i < decoding_chromatogram_data_.size(); i++)
       {
         if (consumer_ != nullptr)
         {
-          consumer_->consumeChromatogram(chromatogram_data_[i].chromatogram);
+          consumer_->consumeChromatogram(decoding_chromatogram_data_[i].chromatogram);
           if (options_.getAlwaysAppendData())
           {
-            exp_->addChromatogram(std::move(chromatogram_data_[i].chromatogram));
+            exp_->addChromatogram(std::move(decoding_chromatogram_data_[i].chromatogram));
           }
         }
         else
         {
-          exp_->addChromatogram(std::move(chromatogram_data_[i].chromatogram));
+          exp_->addChromatogram(std::move(decoding_chromatogram_data_[i].chromatogram));
         }
       }
 
       // Delete batch
-      chromatogram_data_.clear();
+      decoding_chromatogram_data_.clear();
     }
 
     void MzMLHandler::addSpectrumMetaData_(const std::vector<MzMLHandlerHelper::BinaryData>& input_data,
@@ -1332,9 +1424,11 @@ namespace OpenMS::Internal
         instruments_.clear();
         processing_.clear();
 
-        // Flush the remaining data
+        // Flush the remaining data and drain the decoding pipeline
         populateSpectraWithData_();
         populateChromatogramsWithData_();
+        flushDecodedSpectra_();
+        flushDecodedChromatograms_();
         pg_outer.endProgress(File::fileSize(file_)); // we cannot query the offset within the file when SAX'ing it (Xerces does not support that)
                                                      // , so we can only report I/O at the very end
       }
@@ -1347,6 +1441,28 @@ namespace OpenMS::Internal
                                      const String& value,
                                      const String& unit_accession)
     {
+      // peaks-only mode: per-spectrum meta data is discarded anyway, so do not even
+      // materialize it. Keep what is needed to decode the peak data (binaryDataArray),
+      // the precursor information, RT / ion mobility (scan) and MS level / spectrum
+      // representation (spectrum). File-level meta data (before the spectrum list) and
+      // chromatograms are not affected.
+      if (options_.getPeaksOnly() && in_spectrum_list_)
+      {
+        if (!(parent_tag == "binaryDataArray" ||
+              parent_tag == "selectedIon" ||
+              parent_tag == "isolationWindow" ||
+              parent_tag == "activation" ||
+              (parent_tag == "scan" &&
+               (accession == "MS:1000016" || // scan start time
+                accession == "MS:1002476" || accession == "MS:1002815" || accession == "MS:1001581")) || // ion mobility / FAIMS CV
+              (parent_tag == "spectrum" &&
+               (accession == "MS:1000511" || // ms level
+                accession == "MS:1000127" || accession == "MS:1000128")))) // centroid / profile
+        {
+          return;
+        }
+      }
+
       // the actual value stored in the CVParam
       DataValue termValue = XMLHandler::cvParamToValue(cv_, parent_tag, accession, name, value, unit_accession);
       
@@ -3162,6 +3278,12 @@ namespace OpenMS::Internal
                                        const String& value,
                                        const String& unit_accession)
     {
+      // peaks-only mode: userParams of spectra are meta data only (see handleCVParam_())
+      if (options_.getPeaksOnly() && in_spectrum_list_)
+      {
+        return;
+      }
+
       // create a DataValue that contains the data in the right type
       DataValue data_value = fromXSDString(type, value);
 
@@ -3948,13 +4070,39 @@ namespace OpenMS::Internal
         }
 
         // write actual data
+#ifdef _OPENMP
+        // pipelined serialization: worker threads base64-encode and compress
+        // spectra out of order into per-spectrum buffers, which are then
+        // emitted in order. The output is byte-identical to the serial path.
+        const Size batch_size = 64;
+        for (Size batch_start = 0; batch_start < exp.size(); batch_start += batch_size)
+        {
+          const Size n = std::min(batch_size, exp.size() - batch_start);
+          std::vector<std::ostringstream> buffers(n);
+#pragma omp parallel for schedule(dynamic)
+          for (SignedSize k = 0; k < (SignedSize)n; ++k)
+          {
+            buffers[k].precision(os.precision());
+            writeSpectrum_(buffers[k], exp[batch_start + k], batch_start + k, validator, renew_native_ids, dps);
+          }
+          for (Size k = 0; k < n; ++k)
+          {
+            logger_.setProgress(progress++);
+            addSpectrumOffset_(exp[batch_start + k], batch_start + k, renew_native_ids, os.tellp());
+            os << buffers[k].str();
+            ++stored_spectra;
+          }
+        }
+#else
         for (Size s_idx = 0; s_idx < exp.size(); ++s_idx)
         {
           logger_.setProgress(progress++);
           const SpectrumType& spec = exp[s_idx];
+          addSpectrumOffset_(spec, s_idx, renew_native_ids, os.tellp());
           writeSpectrum_(os, spec, s_idx, validator, renew_native_ids, dps);
           ++stored_spectra;
         }
+#endif
         os << "\t\t</spectrumList>\n";
       }
 
@@ -3968,13 +4116,36 @@ namespace OpenMS::Internal
         // meta information needs to be stored here but the actual data is
         // stored somewhere else).
         os << "\t\t<chromatogramList count=\"" << exp.getChromatograms().size() << "\" defaultDataProcessingRef=\"dp_sp_0\">\n";
+#ifdef _OPENMP
+        const Size chrom_batch_size = 64;
+        for (Size batch_start = 0; batch_start < exp.getChromatograms().size(); batch_start += chrom_batch_size)
+        {
+          const Size n = std::min(chrom_batch_size, exp.getChromatograms().size() - batch_start);
+          std::vector<std::ostringstream> buffers(n);
+#pragma omp parallel for schedule(dynamic)
+          for (SignedSize k = 0; k < (SignedSize)n; ++k)
+          {
+            buffers[k].precision(os.precision());
+            writeChromatogram_(buffers[k], exp.getChromatograms()[batch_start + k], batch_start + k, validator);
+          }
+          for (Size k = 0; k < n; ++k)
+          {
+            logger_.setProgress(progress++);
+            addChromatogramOffset_(exp.getChromatograms()[batch_start + k], os.tellp());
+            os << buffers[k].str();
+            ++stored_chromatograms;
+          }
+        }
+#else
         for (Size c_idx = 0; c_idx != exp.getChromatograms().size(); ++c_idx)
         {
           logger_.setProgress(progress++);
           const ChromatogramType& chromatogram = exp.getChromatograms()[c_idx];
+          addChromatogramOffset_(chromatogram, os.tellp());
           writeChromatogram_(os, chromatogram, c_idx, validator);
           ++stored_chromatograms;
         }
+#endif
         os << "\t\t</chromatogramList>" << "\n";
       }
 
@@ -4924,6 +5095,23 @@ namespace OpenMS::Internal
 
     }
 
+    void MzMLHandler::addSpectrumOffset_(const SpectrumType& spec, Size spec_idx, bool renew_native_ids, Int64 os_offset)
+    {
+      String native_id = spec.getNativeID();
+      if (renew_native_ids)
+      {
+        native_id = String("spectrum=") + spec_idx;
+      }
+      // +3 accounts for the three leading tabs before the <spectrum tag
+      spectra_offsets_.emplace_back(native_id, os_offset + 3);
+    }
+
+    void MzMLHandler::addChromatogramOffset_(const ChromatogramType& chromatogram, Int64 os_offset)
+    {
+      // +3 accounts for the three leading tabs before the <chromatogram tag
+      chromatograms_offsets_.emplace_back(chromatogram.getNativeID(), os_offset + 3);
+    }
+
     void MzMLHandler::writeSpectrum_(std::ostream& os,
                                      const SpectrumType& spec,
                                      Size s,
@@ -4938,10 +5126,7 @@ namespace OpenMS::Internal
         native_id = String("spectrum=") + s;
       }
 
-      Int64 offset = os.tellp();
-      spectra_offsets_.emplace_back(native_id, offset + 3);
-
-      // IMPORTANT make sure the offset (above) corresponds to the start of the <spectrum tag
+      // IMPORTANT the offset recorded by addSpectrumOffset_() corresponds to the start of the <spectrum tag
       os << "\t\t\t<spectrum id=\"" << writeXMLEscape(native_id) << "\" index=\"" << s << "\" defaultArrayLength=\"" << spec.size() << "\"";
       if (spec.getSourceFile() != SourceFile())
       {
@@ -5363,6 +5548,14 @@ namespace OpenMS::Internal
         throw Exception::InvalidValue(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Unknown array type", array_type);
       }
 
+      // Lossy intensity truncation for better compression (not combined with
+      // numpress, which performs its own lossy encoding):
+      if ((array_type == "intensity") && (pf_options_.getIntensityMantissaBits() >= 0) &&
+          (np_config.np_compression == MSNumpressCoder::NONE))
+      {
+        truncateMantissa(data_to_encode, pf_options_.getIntensityMantissaBits());
+      }
+
       // Try numpress encoding (if it is enabled) and fall back to regular encoding if it fails
       if (np_config.np_compression != MSNumpressCoder::NONE)
       {
@@ -5518,11 +5711,8 @@ namespace OpenMS::Internal
                                          Size c,
                                          const Internal::MzMLValidator& validator)
     {
-      Int64 offset = os.tellp();
-      chromatograms_offsets_.emplace_back(chromatogram.getNativeID(), offset + 3);
-
       // TODO native id with chromatogram=?? prefix?
-      // IMPORTANT make sure the offset (above) corresponds to the start of the <chromatogram tag
+      // IMPORTANT the offset recorded by addChromatogramOffset_() corresponds to the start of the <chromatogram tag
       os << "\t\t\t<chromatogram id=\"" << writeXMLEscape(chromatogram.getNativeID()) << "\" index=\"" << c << "\" defaultArrayLength=\"" << chromatogram.size() << "\">" << "\n";
 
       // write cvParams (chromatogram type)
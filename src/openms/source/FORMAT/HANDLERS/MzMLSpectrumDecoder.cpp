@@ -324,8 +324,21 @@ namespace OpenMS
 
   OpenMS::Interfaces::SpectrumPtr MzMLSpectrumDecoder::decodeBinaryDataSpectrum_(std::vector<BinaryData>& data) const
   {
-    Internal::MzMLHandlerHelper::decodeBase64Arrays(data, skip_xml_checks_);
     OpenMS::Interfaces::SpectrumPtr sptr(new OpenMS::Interfaces::Spectrum);
+    decodeBinaryDataSpectrum_(data, sptr);
+    return sptr;
+  }
+
+  void MzMLSpectrumDecoder::decodeBinaryDataSpectrum_(std::vector<BinaryData>& data, OpenMS::Interfaces::SpectrumPtr& sptr) const
+  {
+    // recycle the previous spectrum object if the caller holds the only
+    // reference to it, otherwise start from a fresh one:
+    if (!sptr || (sptr.use_count() > 1))
+    {
+      sptr.reset(new OpenMS::Interfaces::Spectrum);
+    }
+
+    Internal::MzMLHandlerHelper::decodeBase64Arrays(data, skip_xml_checks_);
 
     //look up the precision and the index of the intensity and m/z array
     bool x_precision_64 = true;
@@ -339,7 +352,8 @@ namespace OpenMS
     if (int_index == -1 || x_index == -1)
     {
       std::cerr << "Error, intensity or m/z array is missing, skipping this spectrum" << std::endl;
-      return sptr;
+      sptr.reset(new OpenMS::Interfaces::Spectrum); // return an empty spectrum
+      return;
     }
 
     checkData_(data, x_index, int_index, x_precision_64, int_precision_64);
@@ -357,8 +371,21 @@ namespace OpenMS
     // TODO: handle meta data from the binaryDataArray tag -> currently ignored
     // since we have no place to store them
     // TODO: would need to adopt OpenMS::Interfaces::SpectrumPtr to store additional arrays
-    OpenMS::Interfaces::BinaryDataArrayPtr intensity_array(new OpenMS::Interfaces::BinaryDataArray);
-    OpenMS::Interfaces::BinaryDataArrayPtr x_array(new OpenMS::Interfaces::BinaryDataArray);
+
+    // re-use the data arrays of a recycled spectrum, unless they are still
+    // referenced elsewhere (the getters return copies, hence the count of 2):
+    OpenMS::Interfaces::BinaryDataArrayPtr x_array = sptr->getMZArray();
+    OpenMS::Interfaces::BinaryDataArrayPtr intensity_array = sptr->getIntensityArray();
+    if (!x_array || (x_array.use_count() > 2))
+    {
+      x_array.reset(new OpenMS::Interfaces::BinaryDataArray);
+    }
+    if (!intensity_array || (intensity_array.use_count() > 2))
+    {
+      intensity_array.reset(new OpenMS::Interfaces::BinaryDataArray);
+    }
+    x_array->data.clear();
+    intensity_array->data.clear();
     x_array->data.reserve(default_array_length_);
     intensity_array->data.reserve(default_array_length_);
 
@@ -369,7 +396,6 @@ namespace OpenMS
 
     sptr->setMZArray(x_array);
     sptr->setIntensityArray(intensity_array);
-    return sptr;
   }
 
   OpenMS::Interfaces::ChromatogramPtr MzMLSpectrumDecoder::decodeBinaryDataChrom_(std::vector<BinaryData>& data) const
@@ -424,8 +450,8 @@ namespace OpenMS
 
   void MzMLSpectrumDecoder::handleBinaryDataArray_(xercesc::DOMNode* indexListNode, std::vector<BinaryData>& data)
   {
-    // access result through data.back()
-    data.emplace_back();
+    // access result through data.back() - the element was appended (or
+    // recycled) by the caller
 
     // using CONST_XMLCH since writing a u16 char array each time is ugly. disadvantage = no constexpr.
     // Uses only reinterpret_cast, so usually no runtime cost though.
@@ -569,13 +595,29 @@ namespace OpenMS
     OpenMS::Internal::StringManager sm;
     std::string id = sm.convert(elementRoot->getAttribute(id_tag));
 
+    // Recycle buffer memory from a previous call if the caller re-uses the
+    // data vector; old content is discarded either way.
+    std::vector<BinaryData> spare;
+    spare.swap(data);
+
     // Extract the binaryDataArray elements (there may be multiple) and process them
     xercesc::DOMNodeList* li = elementRoot->getElementsByTagName(binary_data_array_tag);
     for (Size i = 0; i < li->getLength(); i++)
     {
-      // Will append one single BinaryData object to data      
+      if (!spare.empty()) // re-use a previous element, keeping its buffer memory
+      {
+        spare.back().clear();
+        data.push_back(std::move(spare.back()));
+        spare.pop_back();
+      }
+      else
+      {
+        data.emplace_back();
+      }
+
+      // Will fill the BinaryData object at data.back()
       handleBinaryDataArray_(li->item(i), data);
-      
+
       // Set the size correctly (otherwise MzMLHandlerHelper complains).
       data.back().size = default_array_length;
     }
@@ -598,6 +640,19 @@ namespace OpenMS
     s.setNativeID(id);
   }
 
+  void MzMLSpectrumDecoder::domParseSpectrum(const std::string& in, OpenMS::Interfaces::SpectrumPtr& sptr, std::vector<BinaryData>& binary_data)
+  {
+    domParseString_(in, binary_data);
+    decodeBinaryDataSpectrum_(binary_data, sptr);
+  }
+
+  void MzMLSpectrumDecoder::domParseSpectrum(const std::string& in, MSSpectrum& s, std::vector<BinaryData>& binary_data)
+  {
+    std::string id = domParseString_(in, binary_data);
+    decodeBinaryDataMSSpectrum_(binary_data, s);
+    s.setNativeID(id);
+  }
+
   void MzMLSpectrumDecoder::domParseChromatogram(const std::string& in, MSChromatogram& c)
   {
     std::vector<BinaryData> data;
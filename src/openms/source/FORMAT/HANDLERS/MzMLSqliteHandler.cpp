@@ -973,6 +973,11 @@ namespace OpenMS::Internal
       }
       SqliteConnector conn(filename_);
 
+      // The file is written from scratch, so there is no point in paying for
+      // crash-consistency; combined with the single transaction below this
+      // reduces the write path to one fsync per batch.
+      conn.executeStatement("PRAGMA synchronous = OFF");
+
       // prepare streams and set required precision (default is 6 digits)
       std::stringstream insert_spectra_sql;
       std::stringstream insert_precursor_sql;
@@ -997,6 +1002,10 @@ namespace OpenMS::Internal
       std::vector<String> data;
       int sql_it = 1;
 
+      // write all data of this batch in a single transaction; without it every
+      // flushed bind statement below would commit (and sync) individually
+      conn.executeStatement("BEGIN TRANSACTION");
+
       std::vector<String> encoded_strings_mz(spectra.size());
       std::vector<String> encoded_strings_int(spectra.size());
 #ifdef _OPENMP
@@ -1182,7 +1191,6 @@ namespace OpenMS::Internal
         conn.executeBindStatement(prepare_statement, data);
       }
 
-      conn.executeStatement("BEGIN TRANSACTION");
       conn.executeStatement(insert_spectra_sql.str());
       if (nr_precursors > 0)
       {
@@ -1204,6 +1212,11 @@ namespace OpenMS::Internal
       }
       SqliteConnector conn(filename_);
 
+      // The file is written from scratch, so there is no point in paying for
+      // crash-consistency; combined with the single transaction below this
+      // reduces the write path to one fsync per batch.
+      conn.executeStatement("PRAGMA synchronous = OFF");
+
       // prepare streams and set required precision (default is 6 digits)
       std::stringstream insert_chrom_sql;
       std::stringstream insert_precursor_sql;
@@ -1227,6 +1240,10 @@ namespace OpenMS::Internal
       String prepare_statement = "INSERT INTO DATA (CHROMATOGRAM_ID, DATA_TYPE, COMPRESSION, DATA) VALUES ";
       int sql_it = 1;
 
+      // write all data of this batch in a single transaction; without it every
+      // flushed bind statement below would commit (and sync) individually
+      conn.executeStatement("BEGIN TRANSACTION");
+
       // Perform encoding in parallel
       std::vector<String> encoded_strings_rt(chroms.size());
       std::vector<String> encoded_strings_int(chroms.size());
@@ -1383,7 +1400,6 @@ namespace OpenMS::Internal
         conn.executeBindStatement(prepare_statement, data);
       }
 
-      conn.executeStatement("BEGIN TRANSACTION");
       conn.executeStatement(insert_chrom_sql.str());
       conn.executeStatement(insert_precursor_sql.str());
       conn.executeStatement(insert_product_sql.str());
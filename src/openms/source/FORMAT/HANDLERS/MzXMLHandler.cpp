@@ -14,6 +14,7 @@
 
 #include <atomic>
 #include <stack>
+#include <utility>
 
 namespace OpenMS::Internal
 {
@@ -1248,12 +1249,12 @@ namespace OpenMS::Internal
           consumer_->consumeSpectrum(spectrum_data_[i].spectrum);
           if (options_.getAlwaysAppendData())
           {
-            exp_->addSpectrum(spectrum_data_[i].spectrum);
+            exp_->addSpectrum(std::move(spectrum_data_[i].spectrum));
           }
         }
         else
         {
-          exp_->addSpectrum(spectrum_data_[i].spectrum);
+          exp_->addSpectrum(std::move(spectrum_data_[i].spectrum));
         }
       }
 
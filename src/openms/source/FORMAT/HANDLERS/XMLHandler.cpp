@@ -12,9 +12,11 @@
 #include <OpenMS/FORMAT/FileHandler.h>
 #include <OpenMS/FORMAT/XMLFile.h>
 #include <OpenMS/CONCEPT/LogStream.h>
+#include <OpenMS/DATASTRUCTURES/StringUtils.h>
 #include <OpenMS/METADATA/ProteinIdentification.h>
 
 #include <algorithm>
+#include <cctype>
 #include <set>
 
 using namespace std;
@@ -451,7 +453,7 @@ namespace OpenMS::Internal
         ++it;
       }
 
-      // This is ca. 50 % faster than 
+      // This is ca. 50 % faster than
       // for (size_t i = 0; i < length; i++)
       // {
       //   result[curr_size + i] = (char)chars[i];
@@ -459,4 +461,35 @@ namespace OpenMS::Internal
 
     }
 
+    double StringManager::toDouble(const XMLCh* str)
+    {
+      // Numbers in attributes are plain ASCII, so all bytes except the least
+      // significant one are zero and we can narrow into a stack buffer and
+      // parse in place - no transcode and no String allocation.
+      char buffer[64];
+      Size length = 0;
+      for (; length < sizeof(buffer) - 1 && str[length] != 0; ++length)
+      {
+        if (str[length] > 127) break; // non-ASCII content: not a plain number
+        buffer[length] = (char)str[length];
+      }
+      if (str[length] == 0)
+      {
+        // allow surrounding whitespace, as String::toDouble() does:
+        const char* begin = &buffer[0];
+        const char* end = begin + length;
+        while (begin != end && isspace(*begin)) ++begin;
+        while (end != begin && isspace(*(end - 1))) --end;
+        double value;
+        const char* it = begin;
+        if (StringUtilsHelper::extractDouble(it, end, value) && it == end && begin != end)
+        {
+          return value;
+        }
+      }
+      // unusually long, non-ASCII or malformed content: take the slow path
+      // (for malformed content this throws the usual ConversionError)
+      return toNative_(str).toDouble();
+    }
+
 } // namespace OpenMS   // namespace Internal
@@ -13,6 +13,7 @@ set(sources_list
   MascotXMLHandler.cpp
   MzDataHandler.cpp
   MzIdentMLHandler.cpp
+  MzIdentMLStreamHandler.cpp
   MzIdentMLDOMHandler.cpp
   MzQuantMLHandler.cpp
   MzMLHandler.cpp
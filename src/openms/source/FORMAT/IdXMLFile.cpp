@@ -318,7 +318,7 @@ namespace OpenMS
              << " sequence=\"" << writeXMLEscape(p_hit.getSequence().toString()) << "\""
              << " charge=\"" << String(p_hit.getCharge()) << "\"";
 
-          const std::vector<PeptideEvidence>& pes = p_hit.getPeptideEvidences();
+          const PeptideHit::PeptideEvidences& pes = p_hit.getPeptideEvidences();
 
           createFlankingAAXMLString_(pes, os);
           createPositionXMLString_(pes, os);
@@ -329,7 +329,7 @@ namespace OpenMS
           // (for peptides matching multiple times in the same protein)
 
           protein_accessions.clear();
-          for (vector<PeptideEvidence>::const_iterator pe = pes.begin(); pe != pes.end(); ++pe)
+          for (auto pe = pes.begin(); pe != pes.end(); ++pe)
           {
             const String& protein_accession = pe->getProteinAccession();
 
@@ -435,205 +435,92 @@ namespace OpenMS
 
   void IdXMLFile::startElement(const XMLCh* const /*uri*/, const XMLCh* const /*local_name*/, const XMLCh* const qname, const xercesc::Attributes& attributes)
   {
-    String tag = sm_.convert(qname);
+    // hot path: elements that occur once per PSM or meta value are matched on the raw
+    // UTF-16 tag name (most frequent first), skipping the transcoding and the String
+    // comparison chain below
+    constexpr XMLCh s_user_param[] = { 'U','s','e','r','P','a','r','a','m', 0 };
+    constexpr XMLCh s_peptide_hit[] = { 'P','e','p','t','i','d','e','H','i','t', 0 };
+    constexpr XMLCh s_peptide_identification[] = { 'P','e','p','t','i','d','e','I','d','e','n','t','i','f','i','c','a','t','i','o','n', 0 };
+    constexpr XMLCh s_protein_hit[] = { 'P','r','o','t','e','i','n','H','i','t', 0 };
 
-    //START
-    if (tag == "IdXML")
+    // USERPARAM
+    if (equal_(qname, s_user_param))
     {
-      //check file version against schema version
-      String file_version = "";
-      prot_id_in_run_ = false;
-
-      optionalAttributeAsString_(file_version, attributes, "version");
-      if (file_version.empty())
-      {
-        file_version = "1.0";  //default version is 1.0
-      }
-      if (file_version.toDouble() > version_.toDouble())
+      if (last_meta_ == nullptr)
       {
-        warning(LOAD, "The XML file (" + file_version + ") is newer than the parser (" + version_ + "). This might lead to undefined program behavior.");
+        fatalError(LOAD, "Unexpected tag 'UserParam'!");
       }
 
-      //document id
-      String document_id = "";
-      optionalAttributeAsString_(document_id, attributes, "id");
-      (*document_id_) = document_id;
-    }
-    //SEARCH PARAMETERS
-    else if (tag == "SearchParameters")
-    {
-      //store id
-      id_ =  attributeAsString_(attributes, "id");
-
-      //reset parameters
-      param_ = ProteinIdentification::SearchParameters();
-
-      //load parameters
-      param_.db = attributeAsString_(attributes, "db");
-      param_.db_version = attributeAsString_(attributes, "db_version");
-
-      optionalAttributeAsString_(param_.taxonomy, attributes, "taxonomy");
-      param_.charges = attributeAsString_(attributes, "charges");
-      optionalAttributeAsUInt_(param_.missed_cleavages, attributes, "missed_cleavages");
-      param_.fragment_mass_tolerance = attributeAsDouble_(attributes, "peak_mass_tolerance");
-
-      String peak_unit;
-      optionalAttributeAsString_(peak_unit, attributes, "peak_mass_tolerance_ppm");
-      param_.fragment_mass_tolerance_ppm = peak_unit == "true" ? true : false;
-
-      param_.precursor_mass_tolerance = attributeAsDouble_(attributes, "precursor_peak_tolerance");
-      String precursor_unit;
-      optionalAttributeAsString_(precursor_unit, attributes, "precursor_peak_tolerance_ppm");
-      param_.precursor_mass_tolerance_ppm = precursor_unit == "true" ? true : false;
+      String name = attributeAsString_(attributes, "name");
+      String type = attributeAsString_(attributes, "type");
 
-      //mass type
-      String mass_type = attributeAsString_(attributes, "mass_type");
-      if (mass_type == "monoisotopic")
-      {
-        param_.mass_type = ProteinIdentification::MONOISOTOPIC;
-      }
-      else if (mass_type == "average")
-      {
-        param_.mass_type = ProteinIdentification::AVERAGE;
-      }
-      //enzyme
-      String enzyme;
-      optionalAttributeAsString_(enzyme, attributes, "enzyme");
-      if (ProteaseDB::getInstance()->hasEnzyme(enzyme))
+      // Handle specially encoded pepXML analysis results
+      if (name.hasPrefix("_ar_"))
       {
-        param_.digestion_enzyme = *(ProteaseDB::getInstance()->getEnzyme(enzyme));
+        // must be in PeptideHit (indicated by special _ar_ prefix)
+        String sfx = name.substr(4, name.size());
+        String val_name = sfx.substr(sfx.find("_") + 1, sfx.size());
+        if (val_name.hasPrefix("subscore"))
+        {
+          String score_name = val_name.substr(val_name.find("_") + 1, val_name.size());
+          current_analysis_result_.sub_scores[score_name] = attributeAsDouble_(attributes, "value");
+        }
+        else if (val_name == "score_type")
+        {
+          if (!current_analysis_result_.score_type.empty())
+          {
+            pep_hit_.addAnalysisResults(current_analysis_result_);
+          }
+          current_analysis_result_.score_type = attributeAsString_(attributes, "value");
+        }
+        else if (val_name == "score")
+        {
+          current_analysis_result_.main_score = attributeAsDouble_(attributes, "value");
+        }
+        return;
       }
-      last_meta_ = &param_;
-    }
-    else if (tag == "FixedModification")
-    {
-      param_.fixed_modifications.push_back(attributeAsString_(attributes, "name"));
-      //change this line as soon as there is a MetaInfoInterface for modifications (Andreas)
-      last_meta_ = nullptr;
-    }
-    else if (tag == "VariableModification")
-    {
-      param_.variable_modifications.push_back(attributeAsString_(attributes, "name"));
-      //change this line as soon as there is a MetaInfoInterface for modifications (Andreas)
-      last_meta_ = nullptr;
-    }
-    // RUN
-    else if (tag == "IdentificationRun")
-    {
-      pep_id_ = PeptideIdentification();
-      prot_id_ = ProteinIdentification();
-
-      prot_id_.setSearchEngine(attributeAsString_(attributes, "search_engine"));
-      prot_id_.setSearchEngineVersion(attributeAsString_(attributes, "search_engine_version"));
 
-      //search parameters
-      String ref = attributeAsString_(attributes, "search_parameters_ref");
-      if (parameters_.find(ref) == parameters_.end())
+      if (type == "int")
       {
-        fatalError(LOAD, String("Invalid search parameters reference '") + ref + "'");
+        last_meta_->setMetaValue(name, attributeAsInt_(attributes, "value"));
       }
-      prot_id_.setSearchParameters(parameters_[ref]);
-
-      //date
-      prot_id_.setDateTime(DateTime::fromString(attributeAsString_(attributes, "date")));
-
-      // set identifier (with UID to make downstream merging of prot_ids possible)
-      // Note: technically, it would be preferable to prefix the UID for faster string comparison, but this results in random write-orderings during file store (breaks tests)
-      prot_id_.setIdentifier(prot_id_.getSearchEngine() + '_' + attributeAsString_(attributes, "date") + '_' + String(UniqueIdGenerator::getUniqueId()));
-    }
-    //PROTEINS
-    else if (tag == "ProteinIdentification")
-    {
-      prot_id_.setScoreType(attributeAsString_(attributes, "score_type"));
-
-      //optional significance threshold
-      double tmp(0.0);
-      optionalAttributeAsDouble_(tmp, attributes, "significance_threshold");
-      if (tmp != 0.0)
+      else if (type == "float")
       {
-        prot_id_.setSignificanceThreshold(tmp);
+        last_meta_->setMetaValue(name, attributeAsDouble_(attributes, "value"));
       }
-
-      //score orientation
-      prot_id_.setHigherScoreBetter(asBool_(attributeAsString_(attributes, "higher_score_better")));
-
-      last_meta_ = &prot_id_;
-    }
-    else if (tag == "ProteinHit")
-    {
-      prot_hit_ = ProteinHit();
-      String accession = attributeAsString_(attributes, "accession");
-      prot_hit_.setAccession(accession);
-      prot_hit_.setScore(attributeAsDouble_(attributes, "score"));
-
-      // coverage
-      double coverage = -std::numeric_limits<double>::max();
-      optionalAttributeAsDouble_(coverage, attributes, "coverage");
-      if (coverage != -std::numeric_limits<double>::max())
+      else if (type == "string")
       {
-        prot_hit_.setCoverage(coverage);
-      }
-
-      // sequence
-      String tmp;
-      optionalAttributeAsString_(tmp, attributes, "sequence");
-      prot_hit_.setSequence(std::move(tmp));
-
-      last_meta_ = &prot_hit_;
+        String value = (String)attributeAsString_(attributes, "value");
 
-      // insert id and accession to map
-      proteinid_to_accession_[attributeAsString_(attributes, "id")] = accession;
-    }
-    // PEPTIDES
-    else if (tag == "PeptideIdentification")
-    {
-      // check whether a prot id has been given, add "empty" one to list else
-      if (!prot_id_in_run_)
-      {
-        prot_ids_->push_back(prot_id_);
-        prot_id_in_run_ = true; // set to true, cause we have created one; will be reset for next run
+        // TODO: check if we are parsing a peptide hit
+        if (name == Constants::UserParam::FRAGMENT_ANNOTATION_USERPARAM)
+        {
+          std::vector<PeptideHit::PeakAnnotation> annotations;
+          parseFragmentAnnotation_(value, annotations);
+          pep_hit_.setPeakAnnotations(annotations);
+          return;
+        }
+        last_meta_->setMetaValue(name, value);
       }
-
-      //set identifier
-      pep_id_.setIdentifier(prot_ids_->back().getIdentifier());
-
-      pep_id_.setScoreType(attributeAsString_(attributes, "score_type"));
-
-      //optional significance threshold
-      double tmp(0.0);
-      optionalAttributeAsDouble_(tmp, attributes, "significance_threshold");
-      if (tmp != 0.0)
+      else if (type == "intList")
       {
-        pep_id_.setSignificanceThreshold(tmp);
+        last_meta_->setMetaValue(name, attributeAsIntList_(attributes, "value"));
       }
-
-      //score orientation
-      pep_id_.setHigherScoreBetter(asBool_(attributeAsString_(attributes, "higher_score_better")));
-
-      //MZ
-      double tmp2 = -std::numeric_limits<double>::max();
-      optionalAttributeAsDouble_(tmp2, attributes, "MZ");
-      if (tmp2 != -std::numeric_limits<double>::max())
+      else if (type == "floatList")
       {
-        pep_id_.setMZ(tmp2);
+        last_meta_->setMetaValue(name, attributeAsDoubleList_(attributes, "value"));
       }
-      //RT
-      tmp2 = -std::numeric_limits<double>::max();
-      optionalAttributeAsDouble_(tmp2, attributes, "RT");
-      if (tmp2 != -std::numeric_limits<double>::max())
+      else if (type == "stringList")
       {
-        pep_id_.setRT(tmp2);
+        last_meta_->setMetaValue(name, attributeAsStringList_(attributes, "value"));
       }
-      String tmp3;
-      optionalAttributeAsString_(tmp3, attributes, "spectrum_reference");
-      if (!tmp3.empty())
+      else
       {
-        pep_id_.setSpectrumReference( tmp3);
+        fatalError(LOAD, String("Invalid UserParam type '") + type + "' of parameter '" + name + "'");
       }
-
-      last_meta_ = &pep_id_;
+      return;
     }
-    else if (tag == "PeptideHit")
+    else if (equal_(qname, s_peptide_hit))
     {
       pep_hit_ = PeptideHit();
       peptide_evidences_.clear();
@@ -643,7 +530,8 @@ namespace OpenMS
       pep_hit_.setSequence(AASequence::fromString(String(attributeAsString_(attributes, "sequence"))));
 
       //parse optional protein ids to determine accessions
-      const XMLCh* refs = attributes.getValue(sm_.convert("protein_refs").c_str());
+      constexpr XMLCh s_protein_refs[] = { 'p','r','o','t','e','i','n','_','r','e','f','s', 0 };
+      const XMLCh* refs = attributes.getValue(s_protein_refs);
       if (refs != nullptr)
       {
         String accession_string = sm_.convert(refs);
@@ -746,87 +634,247 @@ namespace OpenMS
       }
 
       last_meta_ = &pep_hit_;
+      return;
     }
-    // USERPARAM
-    else if (tag == "UserParam")
+    // PEPTIDES
+    else if (equal_(qname, s_peptide_identification))
     {
-      if (last_meta_ == nullptr)
+      // check whether a prot id has been given, add "empty" one to list else
+      if (!prot_id_in_run_)
       {
-        fatalError(LOAD, "Unexpected tag 'UserParam'!");
+        prot_ids_->push_back(prot_id_);
+        prot_id_in_run_ = true; // set to true, cause we have created one; will be reset for next run
       }
 
-      String name = attributeAsString_(attributes, "name");
-      String type = attributeAsString_(attributes, "type");
+      //set identifier
+      pep_id_.setIdentifier(prot_ids_->back().getIdentifier());
 
-      // Handle specially encoded pepXML analysis results
-      if (name.hasPrefix("_ar_"))
+      pep_id_.setScoreType(attributeAsString_(attributes, "score_type"));
+
+      //optional significance threshold
+      double tmp(0.0);
+      optionalAttributeAsDouble_(tmp, attributes, "significance_threshold");
+      if (tmp != 0.0)
       {
-        // must be in PeptideHit (indicated by special _ar_ prefix)
-        String sfx = name.substr(4, name.size());
-        String val_name = sfx.substr(sfx.find("_") + 1, sfx.size());
-        if (val_name.hasPrefix("subscore"))
-        {
-          String score_name = val_name.substr(val_name.find("_") + 1, val_name.size());
-          current_analysis_result_.sub_scores[score_name] = attributeAsDouble_(attributes, "value");
-        }
-        else if (val_name == "score_type")
-        {
-          if (!current_analysis_result_.score_type.empty())
-          {
-            pep_hit_.addAnalysisResults(current_analysis_result_);
-          }
-          current_analysis_result_.score_type = attributeAsString_(attributes, "value");
-        }
-        else if (val_name == "score")
-        {
-          current_analysis_result_.main_score = attributeAsDouble_(attributes, "value");
-        }
-        return;
+        pep_id_.setSignificanceThreshold(tmp);
       }
 
-      if (type == "int")
+      //score orientation
+      pep_id_.setHigherScoreBetter(asBool_(attributeAsString_(attributes, "higher_score_better")));
+
+      //MZ
+      double tmp2 = -std::numeric_limits<double>::max();
+      optionalAttributeAsDouble_(tmp2, attributes, "MZ");
+      if (tmp2 != -std::numeric_limits<double>::max())
       {
-        last_meta_->setMetaValue(name, attributeAsInt_(attributes, "value"));
+        pep_id_.setMZ(tmp2);
       }
-      else if (type == "float")
+      //RT
+      tmp2 = -std::numeric_limits<double>::max();
+      optionalAttributeAsDouble_(tmp2, attributes, "RT");
+      if (tmp2 != -std::numeric_limits<double>::max())
       {
-        last_meta_->setMetaValue(name, attributeAsDouble_(attributes, "value"));
+        pep_id_.setRT(tmp2);
       }
-      else if (type == "string")
+      String tmp3;
+      optionalAttributeAsString_(tmp3, attributes, "spectrum_reference");
+      if (!tmp3.empty())
       {
-        String value = (String)attributeAsString_(attributes, "value");
+        pep_id_.setSpectrumReference( tmp3);
+      }
 
-        // TODO: check if we are parsing a peptide hit
-        if (name == Constants::UserParam::FRAGMENT_ANNOTATION_USERPARAM)
-        {
-          std::vector<PeptideHit::PeakAnnotation> annotations;
-          parseFragmentAnnotation_(value, annotations);
-          pep_hit_.setPeakAnnotations(annotations);
-          return;
+      last_meta_ = &pep_id_;
+      return;
+    }
+    else if (equal_(qname, s_protein_hit))
+    {
+      prot_hit_ = ProteinHit();
+      String accession = attributeAsString_(attributes, "accession");
+      prot_hit_.setAccession(accession);
+      prot_hit_.setScore(attributeAsDouble_(attributes, "score"));
+
+      // coverage
+      double coverage = -std::numeric_limits<double>::max();
+      optionalAttributeAsDouble_(coverage, attributes, "coverage");
+      if (coverage != -std::numeric_limits<double>::max())
+      {
+        prot_hit_.setCoverage(coverage);
       }
-        last_meta_->setMetaValue(name, value);
+
+      // sequence
+      String tmp;
+      optionalAttributeAsString_(tmp, attributes, "sequence");
+      prot_hit_.setSequence(std::move(tmp));
+
+      last_meta_ = &prot_hit_;
+
+      // insert id and accession to map
+      proteinid_to_accession_[attributeAsString_(attributes, "id")] = accession;
+      return;
+    }
+
+    String tag = sm_.convert(qname);
+
+    //START
+    if (tag == "IdXML")
+    {
+      //check file version against schema version
+      String file_version = "";
+      prot_id_in_run_ = false;
+
+      optionalAttributeAsString_(file_version, attributes, "version");
+      if (file_version.empty())
+      {
+        file_version = "1.0";  //default version is 1.0
       }
-      else if (type == "intList")
+      if (file_version.toDouble() > version_.toDouble())
       {
-        last_meta_->setMetaValue(name, attributeAsIntList_(attributes, "value"));
+        warning(LOAD, "The XML file (" + file_version + ") is newer than the parser (" + version_ + "). This might lead to undefined program behavior.");
       }
-      else if (type == "floatList")
+
+      //document id
+      String document_id = "";
+      optionalAttributeAsString_(document_id, attributes, "id");
+      (*document_id_) = document_id;
+    }
+    //SEARCH PARAMETERS
+    else if (tag == "SearchParameters")
+    {
+      //store id
+      id_ =  attributeAsString_(attributes, "id");
+
+      //reset parameters
+      param_ = ProteinIdentification::SearchParameters();
+
+      //load parameters
+      param_.db = attributeAsString_(attributes, "db");
+      param_.db_version = attributeAsString_(attributes, "db_version");
+
+      optionalAttributeAsString_(param_.taxonomy, attributes, "taxonomy");
+      param_.charges = attributeAsString_(attributes, "charges");
+      optionalAttributeAsUInt_(param_.missed_cleavages, attributes, "missed_cleavages");
+      param_.fragment_mass_tolerance = attributeAsDouble_(attributes, "peak_mass_tolerance");
+
+      String peak_unit;
+      optionalAttributeAsString_(peak_unit, attributes, "peak_mass_tolerance_ppm");
+      param_.fragment_mass_tolerance_ppm = peak_unit == "true" ? true : false;
+
+      param_.precursor_mass_tolerance = attributeAsDouble_(attributes, "precursor_peak_tolerance");
+      String precursor_unit;
+      optionalAttributeAsString_(precursor_unit, attributes, "precursor_peak_tolerance_ppm");
+      param_.precursor_mass_tolerance_ppm = precursor_unit == "true" ? true : false;
+
+      //mass type
+      String mass_type = attributeAsString_(attributes, "mass_type");
+      if (mass_type == "monoisotopic")
       {
-        last_meta_->setMetaValue(name, attributeAsDoubleList_(attributes, "value"));
+        param_.mass_type = ProteinIdentification::MONOISOTOPIC;
       }
-      else if (type == "stringList")
+      else if (mass_type == "average")
       {
-        last_meta_->setMetaValue(name, attributeAsStringList_(attributes, "value"));
+        param_.mass_type = ProteinIdentification::AVERAGE;
       }
-      else
+      //enzyme
+      String enzyme;
+      optionalAttributeAsString_(enzyme, attributes, "enzyme");
+      if (ProteaseDB::getInstance()->hasEnzyme(enzyme))
       {
-        fatalError(LOAD, String("Invalid UserParam type '") + type + "' of parameter '" + name + "'");
+        param_.digestion_enzyme = *(ProteaseDB::getInstance()->getEnzyme(enzyme));
+      }
+      last_meta_ = &param_;
+    }
+    else if (tag == "FixedModification")
+    {
+      param_.fixed_modifications.push_back(attributeAsString_(attributes, "name"));
+      //change this line as soon as there is a MetaInfoInterface for modifications (Andreas)
+      last_meta_ = nullptr;
+    }
+    else if (tag == "VariableModification")
+    {
+      param_.variable_modifications.push_back(attributeAsString_(attributes, "name"));
+      //change this line as soon as there is a MetaInfoInterface for modifications (Andreas)
+      last_meta_ = nullptr;
+    }
+    // RUN
+    else if (tag == "IdentificationRun")
+    {
+      pep_id_ = PeptideIdentification();
+      prot_id_ = ProteinIdentification();
+
+      prot_id_.setSearchEngine(attributeAsString_(attributes, "search_engine"));
+      prot_id_.setSearchEngineVersion(attributeAsString_(attributes, "search_engine_version"));
+
+      //search parameters
+      String ref = attributeAsString_(attributes, "search_parameters_ref");
+      if (parameters_.find(ref) == parameters_.end())
+      {
+        fatalError(LOAD, String("Invalid search parameters reference '") + ref + "'");
+      }
+      prot_id_.setSearchParameters(parameters_[ref]);
+
+      //date
+      prot_id_.setDateTime(DateTime::fromString(attributeAsString_(attributes, "date")));
+
+      // set identifier (with UID to make downstream merging of prot_ids possible)
+      // Note: technically, it would be preferable to prefix the UID for faster string comparison, but this results in random write-orderings during file store (breaks tests)
+      prot_id_.setIdentifier(prot_id_.getSearchEngine() + '_' + attributeAsString_(attributes, "date") + '_' + String(UniqueIdGenerator::getUniqueId()));
+    }
+    //PROTEINS
+    else if (tag == "ProteinIdentification")
+    {
+      prot_id_.setScoreType(attributeAsString_(attributes, "score_type"));
+
+      //optional significance threshold
+      double tmp(0.0);
+      optionalAttributeAsDouble_(tmp, attributes, "significance_threshold");
+      if (tmp != 0.0)
+      {
+        prot_id_.setSignificanceThreshold(tmp);
       }
+
+      //score orientation
+      prot_id_.setHigherScoreBetter(asBool_(attributeAsString_(attributes, "higher_score_better")));
+
+      last_meta_ = &prot_id_;
     }
   }
 
   void IdXMLFile::endElement(const XMLCh* const /*uri*/, const XMLCh* const /*local_name*/, const XMLCh* const qname)
   {
+    // hot path: per-hit elements, matched on the raw UTF-16 tag name (see startElement())
+    constexpr XMLCh s_peptide_hit[] = { 'P','e','p','t','i','d','e','H','i','t', 0 };
+    constexpr XMLCh s_peptide_identification[] = { 'P','e','p','t','i','d','e','I','d','e','n','t','i','f','i','c','a','t','i','o','n', 0 };
+    constexpr XMLCh s_protein_hit[] = { 'P','r','o','t','e','i','n','H','i','t', 0 };
+
+    if (equal_(qname, s_peptide_hit))
+    {
+      pep_hit_.setPeptideEvidences(std::move(peptide_evidences_));
+      peptide_evidences_.clear(); // clear will reset the vector to a valid, known state
+
+      if (!current_analysis_result_.score_type.empty())
+      {
+        pep_hit_.addAnalysisResults(current_analysis_result_);
+      }
+      current_analysis_result_ = PeptideHit::PepXMLAnalysisResult();
+      pep_id_.insertHit(std::move(pep_hit_));
+      last_meta_ = &pep_id_;
+      return;
+    }
+    //PEPTIDES
+    else if (equal_(qname, s_peptide_identification))
+    {
+      pep_ids_->emplace_back(std::move(pep_id_));
+      pep_id_ = PeptideIdentification();
+      last_meta_ = nullptr;
+      return;
+    }
+    else if (equal_(qname, s_protein_hit))
+    {
+      prot_id_.insertHit(std::move(prot_hit_));
+      last_meta_ = &prot_id_;
+      return;
+    }
+
     String tag = sm_.convert(qname);
 
     // START
@@ -880,31 +928,6 @@ namespace OpenMS
       last_meta_ = nullptr;
       prot_id_in_run_ = false;
     }
-    else if (tag == "ProteinHit")
-    {
-      prot_id_.insertHit(std::move(prot_hit_));
-      last_meta_ = &prot_id_;
-    }
-    //PEPTIDES
-    else if (tag == "PeptideIdentification")
-    {
-      pep_ids_->emplace_back(std::move(pep_id_));
-      pep_id_ = PeptideIdentification();
-      last_meta_ = nullptr;
-    }
-    else if (tag == "PeptideHit")
-    {
-      pep_hit_.setPeptideEvidences(std::move(peptide_evidences_));
-      peptide_evidences_.clear(); // clear will reset the vector to a valid, known state
-
-      if (!current_analysis_result_.score_type.empty())
-      {
-        pep_hit_.addAnalysisResults(current_analysis_result_);
-      }
-      current_analysis_result_ = PeptideHit::PepXMLAnalysisResult();
-      pep_id_.insertHit(std::move(pep_hit_));
-      last_meta_ = &pep_id_;
-    }
   }
 
   void IdXMLFile::addProteinGroups_(
@@ -969,7 +992,7 @@ namespace OpenMS
     }
   }
 
-  std::ostream& IdXMLFile::createFlankingAAXMLString_(const std::vector<PeptideEvidence> & pes, std::ostream& os)
+  std::ostream& IdXMLFile::createFlankingAAXMLString_(const PeptideHit::PeptideEvidences & pes, std::ostream& os)
   {
     // Check if information on previous/following aa available. If not, we will not write it out
     bool has_aa_before_information(false);
@@ -991,7 +1014,7 @@ namespace OpenMS
     if (has_aa_before_information)
     {
       os << " aa_before=\"" << pes.begin()->getAABefore();;
-      for (std::vector<PeptideEvidence>::const_iterator it = pes.begin() + 1; it != pes.end(); ++it)
+      for (auto it = pes.begin() + 1; it != pes.end(); ++it)
       {
         os << " " << it->getAABefore();
       }
@@ -1001,7 +1024,7 @@ namespace OpenMS
     if (has_aa_after_information)
     {
       os << " aa_after=\"" << pes.begin()->getAAAfter();
-      for (std::vector<PeptideEvidence>::const_iterator it = pes.begin() + 1; it != pes.end(); ++it)
+      for (auto it = pes.begin() + 1; it != pes.end(); ++it)
       {
         os << " " << it->getAAAfter();
       }
@@ -1010,7 +1033,7 @@ namespace OpenMS
     return os;
   }
 
-  std::ostream& IdXMLFile::createPositionXMLString_(const std::vector<PeptideEvidence>& pes, std::ostream& os)
+  std::ostream& IdXMLFile::createPositionXMLString_(const PeptideHit::PeptideEvidences& pes, std::ostream& os)
   {
     bool has_aa_start_information(false);
     bool has_aa_end_information(false);
@@ -1032,7 +1055,7 @@ namespace OpenMS
       if (has_aa_start_information)
       {
         os << " start=\"" << String(pes.begin()->getStart());
-        for (std::vector<PeptideEvidence>::const_iterator it = pes.begin() + 1; it != pes.end(); ++it)
+        for (auto it = pes.begin() + 1; it != pes.end(); ++it)
         {
           os << " " << String(it->getStart());
         }
@@ -1042,7 +1065,7 @@ namespace OpenMS
       if (has_aa_end_information)
       {
         os << " end=\"" << String(pes.begin()->getEnd());
-        for (std::vector<PeptideEvidence>::const_iterator it = pes.begin() + 1; it != pes.end(); ++it)
+        for (auto it = pes.begin() + 1; it != pes.end(); ++it)
         {
           os << " " << String(it->getEnd());
         }
@@ -0,0 +1,253 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/FORMAT/IndexedFeatureXMLFile.h>
+
+#include <OpenMS/CONCEPT/Exception.h>
+
+#include <algorithm>
+#include <string>
+
+namespace OpenMS
+{
+
+  namespace
+  {
+    /// text content of the first child starting with @p open_tag in buf[begin, end); empty if absent
+    std::string childText(const std::string& buf, size_t begin, size_t end, const std::string& open_tag)
+    {
+      size_t p = buf.find(open_tag, begin);
+      if (p == std::string::npos || p >= end) return {};
+      p = buf.find('>', p);
+      if (p == std::string::npos || p >= end) return {};
+      ++p;
+      size_t q = buf.find('<', p);
+      if (q == std::string::npos || q > end) return {};
+      return buf.substr(p, q - p);
+    }
+
+    /// value of the attribute @p name in buf[begin, end); empty if absent
+    std::string attributeText(const std::string& buf, size_t begin, size_t end, const std::string& name)
+    {
+      const std::string needle = name + "=\"";
+      size_t p = buf.find(needle, begin);
+      if (p == std::string::npos || p >= end) return {};
+      p += needle.size();
+      size_t q = buf.find('"', p);
+      if (q == std::string::npos || q > end) return {};
+      return buf.substr(p, q - p);
+    }
+
+    /// position of the next opening tag @p tag in @p buf at or after @p pos,
+    /// i.e. "<tag" followed by a space or '>' (skips tags which merely share the prefix)
+    size_t findOpenTag(const std::string& buf, size_t pos, const std::string& tag)
+    {
+      const std::string needle = "<" + tag;
+      while (true)
+      {
+        size_t p = buf.find(needle, pos);
+        if (p == std::string::npos) return std::string::npos;
+        const size_t after = p + needle.size();
+        if (after < buf.size() && (buf[after] == ' ' || buf[after] == '>')) return p;
+        pos = p + 1;
+      }
+    }
+  }
+
+  IndexedFeatureXMLFile::IndexedFeatureXMLFile() = default;
+
+  IndexedFeatureXMLFile::IndexedFeatureXMLFile(const String& filename)
+  {
+    openFile(filename);
+  }
+
+  IndexedFeatureXMLFile::~IndexedFeatureXMLFile() = default;
+
+  void IndexedFeatureXMLFile::openFile(const String& filename)
+  {
+    filename_ = filename;
+    index_.clear();
+    consensus_ = false;
+    parsing_success_ = false;
+
+    if (filestream_.is_open()) filestream_.close();
+    filestream_.clear();
+    filestream_.open(filename.c_str(), std::ios::binary);
+    if (!filestream_.is_open())
+    {
+      throw Exception::FileNotFound(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename);
+    }
+
+    parseIndex_();
+    parsing_success_ = true;
+  }
+
+  void IndexedFeatureXMLFile::parseIndex_()
+  {
+    // one raw text scan over the whole file; the buffer is released again
+    // afterwards, only the offsets and centroids are kept
+    std::string buf((std::istreambuf_iterator<char>(filestream_)), std::istreambuf_iterator<char>());
+    filestream_.clear();
+    filestream_.seekg(0);
+
+    std::string element_tag;
+    if (findOpenTag(buf, 0, "featureMap") != std::string::npos)
+    {
+      element_tag = "feature";
+    }
+    else if (findOpenTag(buf, 0, "consensusXML") != std::string::npos)
+    {
+      consensus_ = true;
+      element_tag = "consensusElement";
+    }
+    else
+    {
+      throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename_,
+        "Root element is neither <featureMap> nor <consensusXML>");
+    }
+    const std::string close_tag = "</" + element_tag + ">";
+
+    size_t pos = 0;
+    Size depth = 0;
+    size_t top_start = std::string::npos;
+    while (pos < buf.size())
+    {
+      const size_t open_pos = findOpenTag(buf, pos, element_tag);
+      const size_t close_pos = buf.find(close_tag, pos);
+      if (open_pos == std::string::npos && close_pos == std::string::npos) break;
+
+      if (open_pos < close_pos) // next event is an opening tag
+      {
+        if (depth == 0) top_start = open_pos;
+        ++depth;
+        pos = open_pos + element_tag.size() + 1;
+      }
+      else // next event is a closing tag
+      {
+        if (depth == 0)
+        {
+          throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename_,
+            String("Unmatched '") + close_tag + "'");
+        }
+        --depth;
+        const size_t elem_end = close_pos + close_tag.size();
+        if (depth == 0) // a complete top-level element
+        {
+          ElementIndexEntry entry;
+          entry.offset = (std::streampos)top_start;
+          entry.length = elem_end - top_start;
+
+          const size_t tag_end = buf.find('>', top_start) + 1;
+          entry.id = attributeText(buf, top_start, tag_end, "id");
+
+          if (consensus_)
+          {
+            entry.quality = String(attributeText(buf, top_start, tag_end, "quality")).toDouble();
+            const std::string charge = attributeText(buf, top_start, tag_end, "charge");
+            if (!charge.empty()) entry.charge = String(charge).toInt();
+
+            const size_t centroid = buf.find("<centroid", tag_end);
+            if (centroid != std::string::npos && centroid < elem_end)
+            {
+              const size_t centroid_end = buf.find('>', centroid) + 1;
+              entry.rt = String(attributeText(buf, centroid, centroid_end, "rt")).toDouble();
+              entry.mz = String(attributeText(buf, centroid, centroid_end, "mz")).toDouble();
+              entry.intensity = String(attributeText(buf, centroid, centroid_end, "it")).toFloat();
+            }
+          }
+          else
+          {
+            // restrict to the element's own children; hulls, subordinates and
+            // meta values follow the centroid data in the writer's layout
+            size_t window_end = elem_end;
+            for (const char* stop : {"<convexhull", "<subordinate", "<UserParam"})
+            {
+              const size_t p = buf.find(stop, tag_end);
+              if (p != std::string::npos) window_end = std::min(window_end, p);
+            }
+            entry.rt = String(childText(buf, tag_end, window_end, "<position dim=\"0\"")).toDouble();
+            entry.mz = String(childText(buf, tag_end, window_end, "<position dim=\"1\"")).toDouble();
+            entry.intensity = String(childText(buf, tag_end, window_end, "<intensity")).toFloat();
+            const std::string quality = childText(buf, tag_end, window_end, "<overallquality");
+            if (!quality.empty()) entry.quality = String(quality).toDouble();
+            const std::string charge = childText(buf, tag_end, window_end, "<charge");
+            if (!charge.empty()) entry.charge = String(charge).toInt();
+          }
+          index_.push_back(std::move(entry));
+        }
+        pos = elem_end;
+      }
+    }
+    if (depth != 0)
+    {
+      throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename_,
+        String("Unclosed '<") + element_tag + ">'");
+    }
+  }
+
+  bool IndexedFeatureXMLFile::getParsingSuccess() const
+  {
+    return parsing_success_;
+  }
+
+  Size IndexedFeatureXMLFile::size() const
+  {
+    return index_.size();
+  }
+
+  const std::vector<IndexedFeatureXMLFile::ElementIndexEntry>& IndexedFeatureXMLFile::getIndex() const
+  {
+    return index_;
+  }
+
+  void IndexedFeatureXMLFile::getFeature(Size index, Feature& feature) const
+  {
+    if (index >= index_.size())
+    {
+      throw Exception::IndexOverflow(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, index, index_.size());
+    }
+    const ElementIndexEntry& entry = index_[index];
+    feature = Feature();
+    feature.setRT(entry.rt);
+    feature.setMZ(entry.mz);
+    feature.setIntensity(entry.intensity);
+    feature.setCharge(entry.charge);
+    feature.setOverallQuality(entry.quality);
+    if (!entry.id.empty()) feature.setUniqueId(entry.id);
+  }
+
+  Size IndexedFeatureXMLFile::getFeaturesInRange(double min_rt, double max_rt, double min_mz, double max_mz, FeatureMap& out) const
+  {
+    Size appended = 0;
+    Feature feature;
+    for (Size i = 0; i < index_.size(); ++i)
+    {
+      const ElementIndexEntry& entry = index_[i];
+      if (entry.rt < min_rt || entry.rt > max_rt || entry.mz < min_mz || entry.mz > max_mz) continue;
+      getFeature(i, feature);
+      out.push_back(feature);
+      ++appended;
+    }
+    return appended;
+  }
+
+  String IndexedFeatureXMLFile::getElementXML(Size index)
+  {
+    if (index >= index_.size())
+    {
+      throw Exception::IndexOverflow(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, index, index_.size());
+    }
+    const ElementIndexEntry& entry = index_[index];
+    std::string element(entry.length, '\0');
+    filestream_.clear();
+    filestream_.seekg(entry.offset);
+    filestream_.read(&element[0], entry.length);
+    return String(element);
+  }
+
+} // namespace OpenMS
@@ -0,0 +1,144 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Douglas McCloskey, Pasquale Domenico Colaianni $
+// $Authors: Douglas McCloskey, Pasquale Domenico Colaianni $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/FORMAT/IndexedMSPFile.h>
+
+#include <OpenMS/CONCEPT/LogStream.h>
+#include <OpenMS/KERNEL/MSExperiment.h>
+#include <OpenMS/MATH/MISC/MathFunctions.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+namespace OpenMS
+{
+  IndexedMSPFile::IndexedMSPFile() = default;
+
+  IndexedMSPFile::IndexedMSPFile(const String& filename)
+  {
+    openFile(filename);
+  }
+
+  IndexedMSPFile::~IndexedMSPFile() = default;
+
+  void IndexedMSPFile::openFile(const String& filename)
+  {
+    offsets_.clear();
+    precursor_mzs_.clear();
+    mz_index_.clear();
+    if (ifs_.is_open())
+    {
+      ifs_.close();
+    }
+    ifs_.clear();
+    ifs_.open(filename, std::ifstream::in | std::ifstream::binary);
+    if (!ifs_.is_open())
+    {
+      throw Exception::FileNotFound(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename);
+    }
+    filename_ = filename;
+
+    OPENMS_LOG_INFO << "Indexing spectra of .msp file. Please wait." << std::endl;
+
+    // scan the file once, recording where each entry starts;
+    // spectra are not parsed here
+    std::string line;
+    std::streamoff line_offset = ifs_.tellg();
+    while (std::getline(ifs_, line))
+    {
+      if ((line.rfind("Name: ", 0) == 0) || (line.rfind("NAME: ", 0) == 0))
+      {
+        offsets_.push_back(line_offset);
+        precursor_mzs_.push_back(std::numeric_limits<double>::quiet_NaN());
+      }
+      else if (!offsets_.empty() && (line.rfind("PRECURSORMZ: ", 0) == 0))
+      {
+        try
+        {
+          precursor_mzs_.back() = std::stod(line.substr(13));
+        }
+        catch (const std::logic_error&) // invalid value; entry stays without precursor
+        {
+        }
+      }
+      line_offset = ifs_.tellg();
+    }
+    ifs_.clear(); // reset the eof/fail bits so the stream can be reused for seeking
+    ifs_.seekg(0, std::ifstream::end);
+    offsets_.push_back(ifs_.tellg()); // end-of-file sentinel
+
+    // build the precursor m/z lookup table
+    for (Size i = 0; i < precursor_mzs_.size(); ++i)
+    {
+      if (!std::isnan(precursor_mzs_[i]))
+      {
+        mz_index_.emplace_back(precursor_mzs_[i], i);
+      }
+    }
+    std::sort(mz_index_.begin(), mz_index_.end());
+
+    OPENMS_LOG_INFO << "Indexed " << getNrSpectra() << " spectra ("
+                    << mz_index_.size() << " with precursor m/z)." << std::endl;
+  }
+
+  bool IndexedMSPFile::isOpen() const
+  {
+    return ifs_.is_open() && !offsets_.empty();
+  }
+
+  Size IndexedMSPFile::getNrSpectra() const
+  {
+    return offsets_.empty() ? 0 : offsets_.size() - 1; // minus the end-of-file sentinel
+  }
+
+  MSSpectrum IndexedMSPFile::getSpectrum(Size index)
+  {
+    if (index >= getNrSpectra())
+    {
+      throw Exception::IndexOverflow(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, index, getNrSpectra());
+    }
+    // read the entry's bytes and parse only them
+    const std::streamoff length = offsets_[index + 1] - offsets_[index];
+    std::string entry(length, '\0');
+    ifs_.clear();
+    ifs_.seekg(offsets_[index]);
+    ifs_.read(&entry[0], length);
+    std::istringstream iss(entry);
+    MSExperiment single;
+    msp_.load(iss, single);
+    if (single.empty())
+    {
+      throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+        filename_, "The library entry could not be parsed.");
+    }
+    return single.getSpectra()[0];
+  }
+
+  std::vector<Size> IndexedMSPFile::getSpectraByPrecursorMZ(const double mz, const double tolerance, const bool ppm) const
+  {
+    const double tol = ppm ? Math::ppmToMass(tolerance, mz) : tolerance;
+    std::vector<Size> results;
+    auto lower = std::lower_bound(mz_index_.begin(), mz_index_.end(), std::make_pair(mz - tol, Size(0)));
+    for (auto it = lower; (it != mz_index_.end()) && (it->first <= mz + tol); ++it)
+    {
+      results.push_back(it->second);
+    }
+    return results;
+  }
+
+  double IndexedMSPFile::getPrecursorMZ(Size index) const
+  {
+    if (index >= getNrSpectra())
+    {
+      throw Exception::IndexOverflow(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, index, getNrSpectra());
+    }
+    return precursor_mzs_[index];
+  }
+}
@@ -46,13 +46,20 @@ namespace OpenMS
 
   void MSPGenericFile::load(const String& filename, MSExperiment& library)
   {
-    loaded_spectra_names_.clear();
-    synonyms_.clear();
     std::ifstream ifs(filename, std::ifstream::in);
     if (!ifs.is_open())
     {
       throw Exception::FileNotFound(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename);
     }
+    OPENMS_LOG_INFO << "\nLoading spectra from .msp file. Please wait." << std::endl;
+    load(ifs, library);
+    OPENMS_LOG_INFO << "Loading spectra from .msp file completed." << std::endl;
+  }
+
+  void MSPGenericFile::load(std::istream& ifs, MSExperiment& library)
+  {
+    loaded_spectra_names_.clear();
+    synonyms_.clear();
     const Size BUFSIZE { 65536 };
     char line[BUFSIZE];
     library.clear(true);
@@ -75,7 +82,6 @@ namespace OpenMS
     boost::regex re_precursor_type("^PRECURSORTYPE: (.+)");
     // matches everything else
     boost::regex re_metadatum("^(.+): (.+)", boost::regex::no_mod_s);
-    OPENMS_LOG_INFO << "\nLoading spectra from .msp file. Please wait." << std::endl;
 
     while (!ifs.eof())
     {
@@ -162,7 +168,6 @@ namespace OpenMS
     }
     // To make sure a spectrum is added even if no empty line is present before EOF
     addSpectrumToLibrary(spectrum, library);
-    OPENMS_LOG_INFO << "Loading spectra from .msp file completed." << std::endl;
   }
 
   void MSPGenericFile::store(const String& filename, const MSExperiment& library) const
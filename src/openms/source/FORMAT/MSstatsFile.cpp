@@ -10,6 +10,8 @@
 
 #include <OpenMS/SYSTEM/File.h>
 #include <OpenMS/CONCEPT/LogStream.h>
+
+#include <fstream>
 #include <tuple>
 
 using namespace std;
@@ -103,7 +105,7 @@ MSstatsFile::AggregatedConsensusInfo MSstatsFile::aggregateInfo_(const Consensus
 template <class LineType>
 void MSstatsFile::constructFile_(const String& retention_time_summarization_method,
                                          const bool rt_summarization_manual,
-                                         TextFile& csv_out,
+                                         std::ostream& csv_out,
                                          const std::set<String>& peptideseq_quantifyable,
                                          LineType& peptideseq_to_prefix_to_intensities) const
 
@@ -111,6 +113,7 @@ void MSstatsFile::constructFile_(const String& retention_time_summarization_meth
   // sanity check that the triples (peptide_sequence, precursor_charge, run) only appears once
   set<tuple<String, String, String> > peptideseq_precursor_charge_run;
 
+  String row; // reused buffer for one output row
   int count_similar = 0;
   for (const auto &peptideseq : peptideseq_quantifyable)
   {
@@ -151,9 +154,9 @@ void MSstatsFile::constructFile_(const String& retention_time_summarization_meth
         for (const auto &ity_rt_file : line.second)
         {
           //RT, common prefix items, intensity, "unique ID (file+spectrumID)"
-          csv_out.addLine(
-              String(get<1>(ity_rt_file)) + ',' + line.first.toString() + ',' + String(get<0>(ity_rt_file)) + ','
-              + quote_ + get<2>(ity_rt_file) + quote_);
+          row = String(get<1>(ity_rt_file)) + ',' + line.first.toString() + ',' + String(get<0>(ity_rt_file)) + ','
+              + quote_ + get<2>(ity_rt_file) + quote_;
+          csv_out << row << '\n';
         }
       }
       // Otherwise, the intensities are resolved over the retention times
@@ -178,9 +181,9 @@ void MSstatsFile::constructFile_(const String& retention_time_summarization_meth
         }
         //common prefix items, aggregated intensity, "unique ID (file of first spectrum in the set of 'same')"
         //@todo we could collect all spectrum references contributing to this intensity instead
-        csv_out.addLine(
-            line.first.toString() + delim_ + String(intensity) + delim_ + quote_ +
-            get<2>(*line.second.begin()) + quote_);
+        row = line.first.toString() + delim_ + String(intensity) + delim_ + quote_ +
+            get<2>(*line.second.begin()) + quote_;
+        csv_out << row << '\n';
       }
     }
   }
@@ -280,13 +283,18 @@ void MSstatsFile::storeLFQ(const String& filename,
   // Extract information from the consensus features.
   MSstatsFile::AggregatedConsensusInfo aggregatedInfo = MSstatsFile::aggregateInfo_(consensus_map, spectra_paths);
 
-  // The output file of the MSstats converter
-  TextFile csv_out;
-  csv_out.addLine(
+  // The output file of the MSstats converter; rows are streamed to disk as
+  // they are assembled instead of collecting the whole table in memory first
+  ofstream csv_out(filename.c_str());
+  if (!csv_out)
+  {
+    throw Exception::UnableToCreateFile(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename);
+  }
+  csv_out <<
     String(rt_summarization_manual ? "RetentionTime,": "") +
     "ProteinName,PeptideSequence,PrecursorCharge,FragmentIon,"
     "ProductCharge,IsotopeLabelType,Condition,BioReplicate,Run," +
-    String(has_fraction ? "Fraction,": "") + "Intensity,Reference");
+    String(has_fraction ? "Fraction,": "") + "Intensity,Reference" << '\n';
 
   // From the MSstats user guide: endogenous peptides (use "L") or labeled reference peptides (use "H").
   String isotope_label_type = "L";
@@ -441,9 +449,6 @@ void MSstatsFile::storeLFQ(const String& filename,
                  csv_out,
                  peptideseq_quantifyable,
                  peptideseq_to_prefix_to_intensities);
-
-  // Store the final assembled CSV file
-  csv_out.store(filename);
 }
 
 void MSstatsFile::storeISO(const String& filename,
@@ -548,10 +553,15 @@ void MSstatsFile::storeISO(const String& filename,
   // Extract information from the consensus features.
   MSstatsFile::AggregatedConsensusInfo AggregatedInfo = MSstatsFile::aggregateInfo_(consensus_map, spectra_paths);
 
-  // The output file of the MSstatsConverter
-  TextFile csv_out;
-  csv_out.addLine(String(rt_summarization_manual ? "RetentionTime,": "") +
-    "ProteinName,PeptideSequence,Charge,Channel,Condition,BioReplicate,Run,Mixture,TechRepMixture,Fraction,Intensity,Reference");
+  // The output file of the MSstatsConverter; rows are streamed to disk as
+  // they are assembled instead of collecting the whole table in memory first
+  ofstream csv_out(filename.c_str());
+  if (!csv_out)
+  {
+    throw Exception::UnableToCreateFile(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename);
+  }
+  csv_out << String(rt_summarization_manual ? "RetentionTime,": "") +
+    "ProteinName,PeptideSequence,Charge,Channel,Condition,BioReplicate,Run,Mixture,TechRepMixture,Fraction,Intensity,Reference" << '\n';
 
   // We quantify indistinguishable groups with one (corner case) or multiple proteins.
   // If indistinguishable groups are not annotated (no inference or only trivial inference has been performed) we assume
@@ -670,9 +680,6 @@ void MSstatsFile::storeISO(const String& filename,
                  csv_out,
                  peptideseq_quantifyable,
                  peptideseq_to_prefix_to_intensities);
-
-  // Store the final assembled CSV file
-  csv_out.store(filename);
 }
 
 bool MSstatsFile::checkUnorderedContent_(const std::vector<String> &first, const std::vector<String> &second)
@@ -0,0 +1,93 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/FORMAT/MultiFileLoader.h>
+
+#include <OpenMS/FORMAT/FileHandler.h>
+
+#include <algorithm>
+#include <future>
+#include <vector>
+
+namespace OpenMS
+{
+
+  Size MultiFileLoader::getMaxFilesInFlight() const
+  {
+    return max_in_flight_;
+  }
+
+  void MultiFileLoader::setMaxFilesInFlight(Size max_in_flight)
+  {
+    max_in_flight_ = std::max(max_in_flight, Size(1));
+  }
+
+  void MultiFileLoader::load(const StringList& filenames,
+                             const std::function<void(Size, PeakMap&)>& consume,
+                             bool rewrite_source_file,
+                             bool compute_hash)
+  {
+    startProgress(0, filenames.size(), "Loading input files");
+
+    // sliding window of background parses; futures outside the window are not yet launched
+    std::vector<std::future<PeakMap> > futures(filenames.size());
+    auto launch = [&](Size i)
+    {
+      futures[i] = std::async(std::launch::async, [&filenames, i, rewrite_source_file, compute_hash]()
+      {
+        PeakMap exp;
+        FileHandler().loadExperiment(filenames[i], exp, {}, ProgressLogger::NONE, rewrite_source_file, compute_hash);
+        return exp;
+      });
+    };
+
+    Size next_to_launch = 0;
+    for (; next_to_launch < std::min(max_in_flight_, filenames.size()); ++next_to_launch)
+    {
+      launch(next_to_launch);
+    }
+
+    for (Size i = 0; i < filenames.size(); ++i)
+    {
+      PeakMap exp = futures[i].get(); // rethrows parse errors of file i here
+      // refill the window before consuming, so parsers keep running while the caller works
+      if (next_to_launch < filenames.size())
+      {
+        launch(next_to_launch++);
+      }
+      consume(i, exp);
+      setProgress(i + 1);
+    }
+    endProgress();
+  }
+
+  void MultiFileLoader::load(const StringList& filenames, PeakMap& out)
+  {
+    load(filenames, [&out](Size i, PeakMap& in)
+    {
+      if (i == 0)
+      {
+        out.ExperimentalSettings::operator=(in);
+      }
+      else
+      {
+        out.getSourceFiles().insert(out.getSourceFiles().end(), in.getSourceFiles().begin(), in.getSourceFiles().end());
+      }
+      out.reserveSpaceSpectra(out.size() + in.size());
+      for (MSSpectrum& spec : in)
+      {
+        out.addSpectrum(std::move(spec));
+      }
+      for (MSChromatogram& chrom : in.getChromatograms())
+      {
+        out.addChromatogram(std::move(chrom));
+      }
+    });
+  }
+
+} // namespace OpenMS
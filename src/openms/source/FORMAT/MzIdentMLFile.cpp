@@ -12,6 +12,7 @@
 #include <OpenMS/FORMAT/CVMappingFile.h>
 #include <OpenMS/FORMAT/HANDLERS/MzIdentMLHandler.h>
 #include <OpenMS/FORMAT/HANDLERS/MzIdentMLDOMHandler.h>
+#include <OpenMS/FORMAT/HANDLERS/MzIdentMLStreamHandler.h>
 #include <OpenMS/SYSTEM/File.h>
 #include <OpenMS/FORMAT/FileHandler.h>
 
@@ -31,6 +32,12 @@ namespace OpenMS
     handler.readMzIdentMLFile(filename);
   }
 
+  void MzIdentMLFile::loadStreamed(const String& filename, std::vector<ProteinIdentification>& poid, std::vector<PeptideIdentification>& peid)
+  {
+    Internal::MzIdentMLStreamHandler handler(poid, peid, filename, schema_version_, *this);
+    parse_(filename, &handler);
+  }
+
   void MzIdentMLFile::store(const String& filename, const Identification& id) const
   {
     Internal::MzIdentMLHandler handler(id, filename, schema_version_, *this);
@@ -492,7 +492,7 @@ namespace OpenMS
     return getOptionalColumnNames_(osm_data_);
   }
 
-  void MzTabPSMSectionRow::addPepEvidenceToRows(const vector<PeptideEvidence>& peptide_evidences)
+  void MzTabPSMSectionRow::addPepEvidenceToRows(const PeptideHit::PeptideEvidences& peptide_evidences)
   {
     if (peptide_evidences.empty())
     {
@@ -833,7 +833,7 @@ namespace OpenMS
     row.modifications = extractModificationList(best_ph, fixed_mods, vector<String>());
 
     const set<String>& accessions = best_ph.extractProteinAccessionsSet();
-    const vector<PeptideEvidence>& peptide_evidences = best_ph.getPeptideEvidences();
+    const PeptideHit::PeptideEvidences& peptide_evidences = best_ph.getPeptideEvidences();
 
     row.unique = accessions.size() == 1 ? MzTabBoolean(true) : MzTabBoolean(false);
     // select accession of first peptide_evidence as representative ("leading") accession
@@ -995,7 +995,7 @@ namespace OpenMS
       row.modifications = extractModificationList(best_ph, fixed_mods, vector<String>());
 
       const set<String>& accessions = best_ph.extractProteinAccessionsSet();
-      const vector<PeptideEvidence> &peptide_evidences = best_ph.getPeptideEvidences();
+      const PeptideHit::PeptideEvidences& peptide_evidences = best_ph.getPeptideEvidences();
 
       row.unique = accessions.size() == 1 ? MzTabBoolean(true) : MzTabBoolean(false);
       // select accession of first peptide_evidence as representative ("leading") accession
@@ -1263,7 +1263,7 @@ namespace OpenMS
     row.unique = accessions.size() == 1 ? MzTabBoolean(true) : MzTabBoolean(false);
 
     // create row for every PeptideEvidence entry (mapping to a protein)
-    const vector<PeptideEvidence>& peptide_evidences = current_ph.getPeptideEvidences();
+    const PeptideHit::PeptideEvidences& peptide_evidences = current_ph.getPeptideEvidences();
 
     // add peptide evidences to Rows
     row.addPepEvidenceToRows(peptide_evidences);
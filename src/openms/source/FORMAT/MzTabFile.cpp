@@ -9,6 +9,7 @@
 #include <OpenMS/FORMAT/MzTabFile.h>
 
 #include <OpenMS/FORMAT/FileHandler.h>
+#include <OpenMS/FORMAT/GzipOfstream.h>
 #include <OpenMS/SYSTEM/File.h>
 
 #include <OpenMS/FORMAT/TextFile.h>
@@ -2884,7 +2885,10 @@ namespace OpenMS
         bool export_all_psms,
         const String& title)
   {
-    if (!(FileHandler::hasValidExtension(filename, FileTypes::MZTAB) || FileHandler::hasValidExtension(filename, FileTypes::TSV)))
+    // a trailing ".gz" requests on-the-fly gzip compression; the extension check applies to the base name
+    const bool compress = filename.hasSuffix(".gz");
+    const String base_filename = compress ? filename.prefix(filename.size() - 3) : filename;
+    if (!(FileHandler::hasValidExtension(base_filename, FileTypes::MZTAB) || FileHandler::hasValidExtension(base_filename, FileTypes::TSV)))
     {
       throw Exception::UnableToCreateFile(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename, "invalid file extension, expected '"
       + FileTypes::typeToName(FileTypes::MZTAB) + "' or '" + FileTypes::typeToName(FileTypes::TSV) + "'");
@@ -2898,8 +2902,17 @@ namespace OpenMS
     prot_ids_ptr.reserve(protein_identifications.size());
     for (const ProteinIdentification& pi : protein_identifications) { prot_ids_ptr.push_back(&pi); }
 
-    ofstream tab_file;
-    tab_file.open(filename, ios::out | ios::trunc);
+    ofstream plain_file;
+    GzipOfstream gz_file;
+    if (compress)
+    {
+      gz_file.open(filename.c_str());
+    }
+    else
+    {
+      plain_file.open(filename, ios::out | ios::trunc);
+    }
+    std::ostream& tab_file = compress ? static_cast<std::ostream&>(gz_file) : plain_file;
 
     MzTab::IDMzTabStream s(
       prot_ids_ptr,
@@ -2973,12 +2986,18 @@ namespace OpenMS
       }
     }
 
-    tab_file.close();
-    
+    if (compress)
+    {
+      gz_file.close();
+    }
+    else
+    {
+      plain_file.close();
+    }
   }
 
   void MzTabFile::store(
-      const String& filename, 
+      const String& filename,
       const ConsensusMap& cmap,
       const bool first_run_inference_only,
       const bool export_unidentified_features,
@@ -2987,14 +3006,26 @@ namespace OpenMS
       const bool export_empty_pep_ids,
       const bool export_all_psms) const
   {
-    if (!(FileHandler::hasValidExtension(filename, FileTypes::MZTAB) || FileHandler::hasValidExtension(filename, FileTypes::TSV)))
+    // a trailing ".gz" requests on-the-fly gzip compression; the extension check applies to the base name
+    const bool compress = filename.hasSuffix(".gz");
+    const String base_filename = compress ? filename.prefix(filename.size() - 3) : filename;
+    if (!(FileHandler::hasValidExtension(base_filename, FileTypes::MZTAB) || FileHandler::hasValidExtension(base_filename, FileTypes::TSV)))
     {
       throw Exception::UnableToCreateFile(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, filename, "invalid file extension, expected '"
       + FileTypes::typeToName(FileTypes::MZTAB) + "' or '" + FileTypes::typeToName(FileTypes::TSV) + "'");
     }
 
-    ofstream tab_file;
-    tab_file.open(filename, ios::out | ios::trunc);
+    ofstream plain_file;
+    GzipOfstream gz_file;
+    if (compress)
+    {
+      gz_file.open(filename.c_str());
+    }
+    else
+    {
+      plain_file.open(filename, ios::out | ios::trunc);
+    }
+    std::ostream& tab_file = compress ? static_cast<std::ostream&>(gz_file) : plain_file;
 
     MzTab::CMMzTabStream s(
       cmap,
@@ -3105,7 +3136,14 @@ namespace OpenMS
       }
     }
 
-    tab_file.close();
+    if (compress)
+    {
+      gz_file.close();
+    }
+    else
+    {
+      plain_file.close();
+    }
   }
 
   void MzTabFile::store(const String& filename, const MzTab& mz_tab) const
@@ -20,19 +20,19 @@ namespace OpenMS
 {
   void OMSFile::store(const String& filename, const IdentificationData& id_data)
   {
-    OpenMS::Internal::OMSFileStore helper(filename, log_type_);
+    OpenMS::Internal::OMSFileStore helper(filename, log_type_, fast_store_);
     helper.store(id_data);
   }
 
   void OMSFile::store(const String& filename, const FeatureMap& features)
   {
-    OpenMS::Internal::OMSFileStore helper(filename, log_type_);
+    OpenMS::Internal::OMSFileStore helper(filename, log_type_, fast_store_);
     helper.store(features);
   }
 
   void OMSFile::store(const String& filename, const ConsensusMap& consensus)
   {
-    OpenMS::Internal::OMSFileStore helper(filename, log_type_);
+    OpenMS::Internal::OMSFileStore helper(filename, log_type_, fast_store_);
     helper.store(consensus);
   }
 
@@ -50,21 +50,32 @@ namespace OpenMS::Internal
     }
   }
 
-  OMSFileStore::OMSFileStore(const String& filename, LogType log_type)
+  OMSFileStore::OMSFileStore(const String& filename, LogType log_type, bool fast_store)
   {
     setLogType(log_type);
     File::remove(filename); // nuke the file (SQLite cannot overwrite it)
     db_ = make_unique<SQLite::Database>(filename, SQLite::OPEN_READWRITE | SQLite::OPEN_CREATE); // throws on error
-    // foreign key constraints are disabled by default - turn them on:
-    // @TODO: performance impact? (seems negligible, but should be tested more)
-    db_->exec("PRAGMA foreign_keys = ON");
     // disable synchronous filesystem access and the rollback journal to greatly
     // increase write performance - since we write a new output file every time,
     // we don't have to worry about database consistency:
     db_->exec("PRAGMA synchronous = OFF");
     db_->exec("PRAGMA journal_mode = OFF");
-    db_->exec("PRAGMA foreign_keys = ON");
-    db_->exec("PRAGMA foreign_keys = ON");
+    if (fast_store)
+    {
+      // bulk-ingestion mode: skip the per-insert foreign key checks (our keys
+      // are generated programmatically and consistent by construction) and
+      // keep pages, locks and temporary structures in memory:
+      db_->exec("PRAGMA foreign_keys = OFF");
+      db_->exec("PRAGMA locking_mode = EXCLUSIVE");
+      db_->exec("PRAGMA temp_store = MEMORY");
+      db_->exec("PRAGMA cache_size = -64000"); // 64 MB page cache
+    }
+    else
+    {
+      // foreign key constraints are disabled by default - turn them on:
+      // @TODO: performance impact? (seems negligible, but should be tested more)
+      db_->exec("PRAGMA foreign_keys = ON");
+    }
   }
 
   OMSFileStore::~OMSFileStore() = default;
@@ -27,6 +27,7 @@ namespace OpenMS
     intensity_range_(),
     ms_levels_(),
     zlib_compression_(false),
+    int_mantissa_bits_(-1),
     always_append_data_(false),
     skip_xml_checks_(false),
     sort_spectra_by_mz_(true),
@@ -37,7 +38,8 @@ namespace OpenMS
     np_config_int_(),
     np_config_fda_(),
     maximal_data_pool_size_(100),
-    precursor_mz_selected_ion_(true)
+    precursor_mz_selected_ion_(true),
+    peaks_only_(false)
   {
   }
 
@@ -173,6 +175,16 @@ namespace OpenMS
     return zlib_compression_;
   }
 
+  void PeakFileOptions::setIntensityMantissaBits(Int bits)
+  {
+    int_mantissa_bits_ = bits;
+  }
+
+  Int PeakFileOptions::getIntensityMantissaBits() const
+  {
+    return int_mantissa_bits_;
+  }
+
   bool PeakFileOptions::getAlwaysAppendData() const
   {
     return always_append_data_;
@@ -307,6 +319,16 @@ namespace OpenMS
     precursor_mz_selected_ion_ = choice;
   }
 
+  bool PeakFileOptions::getPeaksOnly() const
+  {
+    return peaks_only_;
+  }
+
+  void PeakFileOptions::setPeaksOnly(bool peaks_only)
+  {
+    peaks_only_ = peaks_only;
+  }
+
   bool PeakFileOptions::hasFilters() const
   {
     return (has_rt_range_ || hasMSLevels());
@@ -258,6 +258,8 @@ namespace OpenMS
 
       readTransitions_(swath_result);
 
+      swath_result.reserveProteins(conn_.countTableRows("PROTEIN"));
+
       String select_sql = "select PROTEIN.ID as prot_id, PROTEIN_ACCESSION as prot_accession from PROTEIN order by prot_id";
       sqlite3_stmt* stmt;
       conn_.prepareStatement(&stmt, select_sql);
@@ -512,6 +514,7 @@ namespace OpenMS
       if (index == ALL_PROTEINS)
       {
         swath_result.clearProteins();
+        swath_result.reserveProteins(conn_.countTableRows("PROTEIN"));
         protein_subselect = "PROTEIN";
       }
       else
@@ -631,7 +631,7 @@ namespace OpenMS
         f << ">\n";
         f << "\t<search_result>" << "\n";
 
-        vector<PeptideEvidence> pes = h.getPeptideEvidences();
+        const PeptideHit::PeptideEvidences& pes = h.getPeptideEvidences();
 
         // select first one if multiple are present as "leader"
         PeptideEvidence pe;
@@ -11,9 +11,10 @@
 #include <OpenMS/CONCEPT/LogStream.h>
 #include <OpenMS/CONCEPT/Constants.h>
 #include <OpenMS/METADATA/SpectrumLookup.h>
-#include <OpenMS/FORMAT/CsvFile.h>
+#include <OpenMS/FORMAT/TextFile.h>
 #include <OpenMS/KERNEL/MSExperiment.h>
 
+#include <fstream>
 #include <regex>
 #include <functional>
 #include <unordered_set>
@@ -23,14 +24,28 @@ namespace OpenMS
   using namespace std;
 
   void PercolatorInfile::store(const String& pin_file,
-    const vector<PeptideIdentification>& peptide_ids, 
-    const StringList& feature_set, 
-    const std::string& enz, 
-    int min_charge, 
+    const vector<PeptideIdentification>& peptide_ids,
+    const StringList& feature_set,
+    const std::string& enz,
+    int min_charge,
     int max_charge)
   {
-    TextFile txt = preparePin_(peptide_ids, feature_set, enz, min_charge, max_charge);
-    txt.store(pin_file);
+    ofstream os(pin_file.c_str());
+    if (!os)
+    {
+      throw Exception::UnableToCreateFile(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, pin_file);
+    }
+    preparePin_(peptide_ids, feature_set, enz, min_charge, max_charge, os);
+  }
+
+  void PercolatorInfile::store(std::ostream& os,
+    const vector<PeptideIdentification>& peptide_ids,
+    const StringList& feature_set,
+    const std::string& enz,
+    int min_charge,
+    int max_charge)
+  {
+    preparePin_(peptide_ids, feature_set, enz, min_charge, max_charge, os);
   }
 
   // uses spectrum_reference, if empty uses spectrum_id, if also empty fall back to using index
@@ -64,10 +79,24 @@ namespace OpenMS
     StringList& filenames,
     String decoy_prefix)
   {
-    CsvFile csv(pin_file, '\t');
+    // stream the file row by row instead of loading it into memory as a whole
+    // (pin files with millions of PSMs easily exceed several GB)
+    ifstream is(pin_file.c_str(), ios_base::in | ios_base::binary);
+    if (!is)
+    {
+      throw Exception::FileNotFound(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, pin_file);
+    }
+
+    String line;
     StringList header;
-    //TODO DANGEROUS! Our CSV reader does not support comment lines!!
-    csv.getRow(0, header);
+    do
+    {
+      if (!TextFile::getLine(is, line))
+      {
+        throw Exception::ParseError(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Error: file '" + pin_file + "' does not contain a header line!", "");
+      }
+    } while (line.hasPrefix("#")); // skip comment lines
+    line.split('\t', header);
 
     unordered_map<String, size_t> to_idx; // map column name to column index
     {
@@ -124,18 +153,19 @@ namespace OpenMS
       }
     }
 
-    auto n_rows = csv.rowCount();
-
     vector<PeptideIdentification> pids;
-    pids.reserve(n_rows);
     String spec_id;
     String raw_file_name("UNKNOWN");
     unordered_map<String, size_t> map_filename_to_idx; // fast lookup of filename to index in filenames vector
 
-    for (size_t i = 1; i != n_rows; ++i)
+    size_t i = 0; // row number (for error messages)
+    StringList row;
+    while (TextFile::getLine(is, line))
     {
-      StringList row;
-      csv.getRow(i, row);
+      ++i;
+      if (line.hasPrefix("#")) continue; // skip comment lines
+
+      line.split('\t', row);
 
       if (row.size() != header.size())
       {
@@ -265,19 +295,20 @@ namespace OpenMS
   }
 
 
-  TextFile PercolatorInfile::preparePin_(
-    const vector<PeptideIdentification>& peptide_ids, 
-    const StringList& feature_set, 
-    const std::string& enz, 
-    int min_charge, 
-    int max_charge)
+  void PercolatorInfile::preparePin_(
+    const vector<PeptideIdentification>& peptide_ids,
+    const StringList& feature_set,
+    const std::string& enz,
+    int min_charge,
+    int max_charge,
+    std::ostream& os)
   {
-    TextFile txt;  
-    txt.addLine(ListUtils::concatenate(feature_set, '\t'));
-    if (peptide_ids.empty()) 
+    // rows are streamed out as they are generated - the full table is never held in memory
+    os << ListUtils::concatenate(feature_set, '\t') << "\n";
+    if (peptide_ids.empty())
     {
       OPENMS_LOG_WARN << "No identifications provided. Creating empty percolator input." << endl;
-      return txt;
+      return;
     }
 
     // extract native id (usually in spectrum_reference)
@@ -428,8 +459,8 @@ namespace OpenMS
 
         if (feats.size() == feature_set.size())
         { // only if all feats were present add
-          txt.addLine(ListUtils::concatenate(feats, '\t'));
-        }        
+          os << ListUtils::concatenate(feats, '\t') << "\n";
+        }
         else
         { // at least one feature is missing in the current peptide hit
           missing_meta_value_count++;        
@@ -451,8 +482,6 @@ namespace OpenMS
         OPENMS_LOG_WARN << f << endl;
       }
     }
-
-    return txt;
   }
 
 
@@ -29,10 +29,13 @@ GNPSMetaValueFile.cpp
 GNPSMGFFile.cpp
 GNPSQuantificationFile.cpp
 GzipIfstream.cpp
+GzipOfstream.cpp
 GzipInputStream.cpp
 IBSpectraFile.cpp
 IdXMLFile.cpp
 IndentedStream.cpp
+IndexedFeatureXMLFile.cpp
+IndexedMSPFile.cpp
 IndexedMzMLFileLoader.cpp
 InspectInfile.cpp
 InspectOutfile.cpp
@@ -49,6 +52,7 @@ MascotGenericFile.cpp
 MascotRemoteQuery.cpp
 MascotXMLFile.cpp
 MsInspectFile.cpp
+MultiFileLoader.cpp
 MzDataFile.cpp
 MzIdentMLFile.cpp
 MzMLFile.cpp
@@ -14,10 +14,16 @@
 #include <OpenMS/IONMOBILITY/FAIMSHelper.h>
 #include <OpenMS/FORMAT/ControlledVocabulary.h>
 #include <OpenMS/KERNEL/MSExperiment.h>
+#include <OpenMS/KERNEL/Mobilogram.h>
 #include <OpenMS/MATH/STATISTICS/Histogram.h>
 
+#include <algorithm>
 #include <map>
 
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+
 namespace OpenMS
 {
   std::vector<PeakMap> IMDataConverter::splitByFAIMSCV(PeakMap&& exp)
@@ -177,6 +183,81 @@ namespace OpenMS
     return result;
   }
 
+  Mobilogram IMDataConverter::aggregateToMobilogram(const MSSpectrum& im_frame, double mb_start, double mb_end, Size number_of_bins)
+  {
+    if (number_of_bins == 0 || mb_start >= mb_end)
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Invalid IM grid (requires number_of_bins > 0 and mb_start < mb_end)");
+    }
+
+    Mobilogram result;
+    result.setRT(im_frame.getRT());
+
+    if (im_frame.empty())
+    { // no peaks to aggregate; keep the grid empty as well
+      return result;
+    }
+
+    // can throw if IM float data array is missing
+    const auto [im_data_index, im_unit] = im_frame.getIMData();
+    const auto& im_data = im_frame.getFloatDataArrays()[im_data_index];
+    result.setDriftTimeUnit(im_unit);
+
+    // scatter-add into a flat accumulator (single pass; no per-peak allocation)
+    std::vector<double> bin_intensity(number_of_bins, 0.0);
+    const double inv_bin_width = double(number_of_bins) / (mb_end - mb_start);
+    const SignedSize last_bin = SignedSize(number_of_bins) - 1;
+    for (Size i = 0; i < im_frame.size(); ++i)
+    {
+      SignedSize bin = SignedSize((im_data[i] - mb_start) * inv_bin_width);
+      // clamp peaks outside the grid to the border bins
+      bin = std::max(SignedSize(0), std::min(bin, last_bin));
+      bin_intensity[bin] += im_frame[i].getIntensity();
+    }
+
+    const double bin_width = (mb_end - mb_start) / double(number_of_bins);
+    result.reserve(number_of_bins);
+    for (Size i_bin = 0; i_bin < number_of_bins; ++i_bin)
+    {
+      result.emplace_back(mb_start + (double(i_bin) + 0.5) * bin_width, MobilityPeak1D::IntensityType(bin_intensity[i_bin]));
+    }
+    result.updateRanges();
+    return result;
+  }
+
+  MSSpectrum IMDataConverter::extractIMRange(const MSSpectrum& im_frame, double im_start, double im_end)
+  {
+    // can throw if IM float data array is missing; resolve the column handle once
+    const Size im_data_index = im_frame.getIMData().first;
+
+    MSSpectrum result = im_frame;
+    result.selectByFloatDataArray(im_data_index, float(im_start), float(im_end));
+    return result;
+  }
+
+  std::vector<Mobilogram> IMDataConverter::aggregateToMobilograms(const MSExperiment& exp, double mb_start, double mb_end, Size number_of_bins)
+  {
+    if (number_of_bins == 0 || mb_start >= mb_end)
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Invalid IM grid (requires number_of_bins > 0 and mb_start < mb_end)");
+    }
+
+    std::vector<Mobilogram> result(exp.size());
+    #pragma omp parallel for schedule(dynamic)
+    for (SignedSize i = 0; i < (SignedSize)exp.size(); ++i)
+    {
+      if (exp[i].containsIMData())
+      {
+        result[i] = aggregateToMobilogram(exp[i], mb_start, mb_end, number_of_bins);
+      }
+      else
+      { // keep the output index-aligned with the input
+        result[i].setRT(exp[i].getRT());
+      }
+    }
+    return result;
+  }
+
   void annotateAsIM(OpenMS::DataArrays::FloatDataArray& fda, const DriftTimeUnit unit)
   {
     const auto& cv = ControlledVocabulary::getPSIMSCV();
@@ -0,0 +1,164 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/KERNEL/AreaTileIndex.h>
+
+#include <OpenMS/CONCEPT/Exception.h>
+#include <OpenMS/KERNEL/MSExperiment.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace OpenMS
+{
+
+  void AreaTileIndex::build(const MSExperiment& exp, Size mz_tiles, Size rt_block_size)
+  {
+    if (mz_tiles == 0 || rt_block_size == 0)
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+                                       "Number of m/z tiles and RT block size must not be zero.");
+    }
+    clear();
+
+    // global m/z range over all non-empty spectra (spectra are sorted by m/z)
+    double min_mz = std::numeric_limits<double>::max();
+    double max_mz = std::numeric_limits<double>::lowest();
+    for (const auto& spec : exp.getSpectra())
+    {
+      if (spec.empty())
+      {
+        continue;
+      }
+      min_mz = std::min(min_mz, spec.front().getMZ());
+      max_mz = std::max(max_mz, spec.back().getMZ());
+    }
+    if (min_mz > max_mz)
+    { // no peaks at all; leave the index empty (queries stay conservative)
+      return;
+    }
+
+    n_spectra_ = exp.size();
+    n_tiles_ = mz_tiles;
+    words_per_spectrum_ = (n_tiles_ + 63) / 64;
+    rt_block_size_ = rt_block_size;
+    min_mz_ = min_mz;
+    inv_tile_width_ = (max_mz > min_mz) ? double(n_tiles_) / (max_mz - min_mz) : 0.0;
+
+    const Size n_blocks = (n_spectra_ + rt_block_size_ - 1) / rt_block_size_;
+    occupied_.assign(n_spectra_ * words_per_spectrum_, 0);
+    block_min_intensity_.assign(n_blocks * n_tiles_, std::numeric_limits<float>::max());
+    block_max_intensity_.assign(n_blocks * n_tiles_, std::numeric_limits<float>::lowest());
+
+    for (Size i = 0; i < n_spectra_; ++i)
+    {
+      uint64_t* words = &occupied_[i * words_per_spectrum_];
+      float* block_min = &block_min_intensity_[(i / rt_block_size_) * n_tiles_];
+      float* block_max = &block_max_intensity_[(i / rt_block_size_) * n_tiles_];
+      for (const auto& peak : exp[i])
+      {
+        const Size t = tileOf_(peak.getMZ());
+        words[t / 64] |= uint64_t(1) << (t % 64);
+        block_min[t] = std::min(block_min[t], peak.getIntensity());
+        block_max[t] = std::max(block_max[t], peak.getIntensity());
+      }
+    }
+  }
+
+  void AreaTileIndex::clear()
+  {
+    n_spectra_ = 0;
+    n_tiles_ = 0;
+    words_per_spectrum_ = 0;
+    rt_block_size_ = 0;
+    min_mz_ = 0.0;
+    inv_tile_width_ = 0.0;
+    occupied_.clear();
+    block_min_intensity_.clear();
+    block_max_intensity_.clear();
+  }
+
+  Size AreaTileIndex::tileOf_(double mz) const
+  {
+    if (mz <= min_mz_)
+    {
+      return 0;
+    }
+    const Size t = Size((mz - min_mz_) * inv_tile_width_);
+    return std::min(t, n_tiles_ - 1);
+  }
+
+  std::pair<Size, Size> AreaTileIndex::tileRange_(double low_mz, double high_mz) const
+  {
+    return {tileOf_(low_mz), tileOf_(high_mz)};
+  }
+
+  bool AreaTileIndex::containsPeaks(Size scan_index, double low_mz, double high_mz) const
+  {
+    if (scan_index >= n_spectra_)
+    { // not covered by the index: claim peaks, so the caller falls back to searching
+      return true;
+    }
+    const auto [first_tile, last_tile] = tileRange_(low_mz, high_mz);
+    const uint64_t* words = &occupied_[scan_index * words_per_spectrum_];
+    for (Size w = first_tile / 64; w <= last_tile / 64; ++w)
+    {
+      uint64_t mask = ~uint64_t(0);
+      if (w == first_tile / 64)
+      {
+        mask &= ~uint64_t(0) << (first_tile % 64);
+      }
+      if (w == last_tile / 64 && last_tile % 64 != 63)
+      {
+        mask &= (uint64_t(1) << (last_tile % 64 + 1)) - 1;
+      }
+      if (words[w] & mask)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  float AreaTileIndex::maxIntensity(Size scan_index, double low_mz, double high_mz) const
+  {
+    if (scan_index >= n_spectra_)
+    {
+      return std::numeric_limits<float>::max();
+    }
+    if (!containsPeaks(scan_index, low_mz, high_mz))
+    {
+      return 0.0f;
+    }
+    const auto [first_tile, last_tile] = tileRange_(low_mz, high_mz);
+    const float* block_max = &block_max_intensity_[(scan_index / rt_block_size_) * n_tiles_];
+    float result = std::numeric_limits<float>::lowest();
+    for (Size t = first_tile; t <= last_tile; ++t)
+    {
+      result = std::max(result, block_max[t]);
+    }
+    return result;
+  }
+
+  float AreaTileIndex::minIntensity(Size scan_index, double low_mz, double high_mz) const
+  {
+    if (scan_index >= n_spectra_ || !containsPeaks(scan_index, low_mz, high_mz))
+    {
+      return 0.0f;
+    }
+    const auto [first_tile, last_tile] = tileRange_(low_mz, high_mz);
+    const float* block_min = &block_min_intensity_[(scan_index / rt_block_size_) * n_tiles_];
+    float result = std::numeric_limits<float>::max();
+    for (Size t = first_tile; t <= last_tile; ++t)
+    {
+      result = std::min(result, block_min[t]);
+    }
+    return result;
+  }
+
+} // namespace OpenMS
@@ -0,0 +1,110 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/KERNEL/ChromatogramBundle.h>
+
+#include <OpenMS/CONCEPT/Exception.h>
+#include <OpenMS/KERNEL/MSChromatogram.h>
+
+namespace OpenMS
+{
+
+  ChromatogramBundle::ChromatogramBundle(const std::vector<MSChromatogram>& chromatograms)
+  {
+    if (chromatograms.empty())
+    {
+      return;
+    }
+
+    rts_.reserve(chromatograms[0].size());
+    for (const ChromatogramPeak& peak : chromatograms[0])
+    {
+      rts_.push_back(peak.getRT());
+    }
+
+    reserve(chromatograms.size());
+    std::vector<IntensityType> intensities(rts_.size());
+    for (const MSChromatogram& chromatogram : chromatograms)
+    {
+      if (chromatogram.size() != rts_.size())
+      {
+        throw Exception::InvalidParameter(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+                                          "ChromatogramBundle: all chromatograms must share one RT axis!");
+      }
+      for (Size p = 0; p < rts_.size(); ++p)
+      {
+        if (chromatogram[p].getRT() != rts_[p])
+        {
+          throw Exception::InvalidParameter(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+                                            "ChromatogramBundle: all chromatograms must share one RT axis!");
+        }
+        intensities[p] = chromatogram[p].getIntensity();
+      }
+      addChromatogram(chromatogram, intensities);
+    }
+  }
+
+  void ChromatogramBundle::setRTs(RTArrayType rts)
+  {
+    if (!settings_.empty() && rts.size() != rts_.size())
+    {
+      throw Exception::InvalidParameter(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+                                        "ChromatogramBundle: cannot change the grid size of a filled bundle!");
+    }
+    rts_ = std::move(rts);
+  }
+
+  void ChromatogramBundle::clear()
+  {
+    rts_.clear();
+    intensities_.clear();
+    settings_.clear();
+  }
+
+  void ChromatogramBundle::reserve(Size n)
+  {
+    intensities_.reserve(n * rts_.size());
+    settings_.reserve(n);
+  }
+
+  void ChromatogramBundle::addChromatogram(const ChromatogramSettings& settings, const std::vector<IntensityType>& intensities)
+  {
+    if (intensities.size() != rts_.size())
+    {
+      throw Exception::InvalidParameter(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+                                        "ChromatogramBundle: intensity array does not match the RT axis!");
+    }
+    intensities_.insert(intensities_.end(), intensities.begin(), intensities.end());
+    settings_.push_back(settings);
+  }
+
+  MSChromatogram ChromatogramBundle::getChromatogram(Size i) const
+  {
+    MSChromatogram chromatogram;
+    static_cast<ChromatogramSettings&>(chromatogram) = settings_[i];
+    chromatogram.reserve(rts_.size());
+    const IntensityType* intensities = intensityData(i);
+    for (Size p = 0; p < rts_.size(); ++p)
+    {
+      chromatogram.push_back(PeakType(PeakType::PositionType(rts_[p]), intensities[p]));
+    }
+    return chromatogram;
+  }
+
+  std::vector<MSChromatogram> ChromatogramBundle::toChromatograms() const
+  {
+    std::vector<MSChromatogram> chromatograms;
+    chromatograms.reserve(size());
+    for (Size i = 0; i < size(); ++i)
+    {
+      chromatograms.push_back(getChromatogram(i));
+    }
+    return chromatograms;
+  }
+
+} // namespace OpenMS
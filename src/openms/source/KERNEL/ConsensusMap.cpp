@@ -46,7 +46,27 @@ namespace OpenMS
 
   ConsensusMap::ConsensusMap(ConsensusMap&& source) = default;
 
-  ConsensusMap::~ConsensusMap() = default;
+  ConsensusMap::~ConsensusMap()
+  {
+    releaseFeatureData_();
+  }
+
+  void ConsensusMap::releaseFeatureData_()
+  {
+    // only worth spinning up threads for large maps
+    if (data_.size() < 100000) return;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1000)
+#endif
+    for (SignedSize i = 0; i < (SignedSize)data_.size(); ++i)
+    {
+      // moving out the feature releases its separately allocated handles,
+      // ratios and peptide identifications on this thread and leaves an
+      // empty feature behind (moves are noexcept)
+      ConsensusFeature tmp(std::move(data_[i]));
+    }
+  }
 
   ConsensusMap::ConsensusMap(size_type n) :
     ExposedVector<ConsensusFeature>(n)
@@ -76,16 +96,17 @@ namespace OpenMS
                             rhs.data_processing_.end());
 
     // append fileDescription
-    column_description_.insert(rhs.column_description_.begin(), rhs.column_description_.end());
+    ColumnHeaders& col_desc = getColumnHeaders(); // detaches shared headers
+    col_desc.insert(rhs.column_description_->begin(), rhs.column_description_->end());
 
     // update filename and map size
-    std::map<UInt64, ColumnHeader>::const_iterator it = column_description_.begin();
-    std::map<UInt64, ColumnHeader>::const_iterator it2 = rhs.column_description_.begin();
+    ColumnHeaders::iterator it = col_desc.begin();
+    ColumnHeaders::const_iterator it2 = rhs.column_description_->begin();
 
-    for (; it != column_description_.end() && it2 != rhs.column_description_.end(); ++it, ++it2)
+    for (; it != col_desc.end() && it2 != rhs.column_description_->end(); ++it, ++it2)
     {
-      getColumnHeaders()[it->first].filename = "mergedConsensusXMLFile";
-      getColumnHeaders()[it->first].size = it->second.size + it2->second.size;
+      it->second.filename = "mergedConsensusXMLFile";
+      it->second.size = it->second.size + it2->second.size;
     }
 
     // append proteinIdentification
@@ -162,10 +183,11 @@ namespace OpenMS
                             rhs.data_processing_.end());
 
     // append column headers (file descriptions) and increase column index (map index)
-    Size lhs_map_size = column_description_.size();
-    for (const auto& rhsfd : rhs.column_description_)
+    ColumnHeaders& col_desc = getColumnHeaders(); // detaches shared headers
+    Size lhs_map_size = col_desc.size();
+    for (const auto& rhsfd : *rhs.column_description_)
     {
-      column_description_.insert(std::make_pair(lhs_map_size + rhsfd.first, rhsfd.second));
+      col_desc.insert(std::make_pair(lhs_map_size + rhsfd.first, rhsfd.second));
     }
 
     // append proteinIdentification
@@ -251,6 +273,7 @@ namespace OpenMS
 
   void ConsensusMap::clear(bool clear_meta_data)
   {
+    releaseFeatureData_();
     data_.clear();
 
     if (clear_meta_data)
@@ -260,7 +283,7 @@ namespace OpenMS
       // no "clear" method for DocumentIdentifier available
       this->DocumentIdentifier::operator=(DocumentIdentifier());
       clearUniqueId();
-      column_description_.clear();
+      column_description_ = std::make_shared<ColumnHeaders>(); // do not clear headers shared with copies
       experiment_type_ = "label-free";  // default
       protein_identifications_.clear();
       unassigned_peptide_identifications_.clear();
@@ -271,17 +294,31 @@ namespace OpenMS
 
   const ConsensusMap::ColumnHeaders& ConsensusMap::getColumnHeaders() const
   {
-    return column_description_;
+    return *column_description_;
   }
 
   ConsensusMap::ColumnHeaders& ConsensusMap::getColumnHeaders()
   {
-    return column_description_;
+    detachColumnHeaders_();
+    return *column_description_;
   }
 
   void ConsensusMap::setColumnHeaders(const ConsensusMap::ColumnHeaders& column_description)
   {
-    column_description_ = column_description;
+    column_description_ = std::make_shared<ColumnHeaders>(column_description);
+  }
+
+  void ConsensusMap::setColumnHeaders(ConsensusMap::ColumnHeaders&& column_description)
+  {
+    column_description_ = std::make_shared<ColumnHeaders>(std::move(column_description));
+  }
+
+  void ConsensusMap::detachColumnHeaders_()
+  {
+    if (column_description_.use_count() > 1)
+    { // headers are still shared with a copy of this map - get our own
+      column_description_ = std::make_shared<ColumnHeaders>(*column_description_);
+    }
   }
 
   const String& ConsensusMap::getExperimentType() const
@@ -482,20 +519,21 @@ namespace OpenMS
   {
     if (s.empty())
     {
-      OPENMS_LOG_WARN << "Setting empty MS runs paths. Expected one for each map. Resulting ConsensusMap contains " + String(column_description_.size()) + " maps." << std::endl;
-      for (auto & cd : column_description_)
+      OPENMS_LOG_WARN << "Setting empty MS runs paths. Expected one for each map. Resulting ConsensusMap contains " + String(column_description_->size()) + " maps." << std::endl;
+      for (auto & cd : getColumnHeaders()) // detaches shared headers
       {
         cd.second.filename = "UNKNOWN";
       }
     }
-    else if (!column_description_.empty() && s.size() != column_description_.size())
+    else if (!column_description_->empty() && s.size() != column_description_->size())
     {
       throw Exception::InvalidParameter(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
         "Number of MS runs paths (" + String(s.size()) +
-        ") must match number of columns (" + String(column_description_.size()) + ").");
+        ") must match number of columns (" + String(column_description_->size()) + ").");
     }
 
     Size i(0);
+    ColumnHeaders& col_desc = getColumnHeaders(); // detaches shared headers
     for (auto const & p : s)
     {
       if (!p.hasSuffix("mzML") && !p.hasSuffix("mzml"))
@@ -504,7 +542,7 @@ namespace OpenMS
                         << "Filename: '" << p << "'" << std::endl;
       }
 
-      column_description_[i].filename = p;
+      col_desc[i].filename = p;
       ++i;
     }
   }
@@ -526,7 +564,7 @@ namespace OpenMS
   void ConsensusMap::getPrimaryMSRunPath(StringList& toFill) const
   {
     /// get the file path to the MS run
-    for (auto const & fd : column_description_)
+    for (auto const & fd : *column_description_)
     {
       toFill.push_back(fd.second.filename);
     }
@@ -540,7 +578,7 @@ namespace OpenMS
            RangeManagerType::operator==(rhs) &&
            DocumentIdentifier::operator==(rhs) &&
            UniqueIdInterface::operator==(rhs) &&
-           column_description_ == rhs.column_description_ &&
+           *column_description_ == *rhs.column_description_ &&
            experiment_type_ == rhs.experiment_type_ &&
            protein_identifications_ == rhs.protein_identifications_ &&
            unassigned_peptide_identifications_ == rhs.unassigned_peptide_identifications_ &&
@@ -595,14 +633,14 @@ namespace OpenMS
     // check file descriptions
     std::set<String> maps;
     String all_maps; // for output later
-    for (ColumnHeaders::const_iterator it = column_description_.begin(); it != column_description_.end(); ++it)
+    for (ColumnHeaders::const_iterator it = column_description_->begin(); it != column_description_->end(); ++it)
     {
       String s = String("  file: ") + it->second.filename + " label: " + it->second.label;
       maps.insert(s);
       all_maps += s;
     }
 
-    if (maps.size() != column_description_.size())
+    if (maps.size() != column_description_->size())
     {
       if (stream != nullptr)
       {
@@ -618,7 +656,7 @@ OPENMS_THREAD_CRITICAL(LOGSTREAM)
       const ConsensusFeature& elem = (*this)[i];
       for (ConsensusFeature::HandleSetType::const_iterator it = elem.begin(); it != elem.end(); ++it)
       {
-        if (column_description_.find(it->getMapIndex()) == column_description_.end())
+        if (column_description_->find(it->getMapIndex()) == column_description_->end())
         {
           ++stats_wrongMID;
           ++wrong_ID_count[it->getMapIndex()];
@@ -650,7 +688,7 @@ OPENMS_THREAD_CRITICAL(LOGSTREAM)
   {
     // @TODO: handle IDs in new format (IdentificationData)
 
-    Size numbr_exps = column_description_.size();
+    Size numbr_exps = column_description_->size();
     std::vector<FeatureMap>fmaps(numbr_exps);
 
     // Check for Isobaric Analyzer
@@ -23,6 +23,9 @@ namespace OpenMS
     DimMapper<1> d({DIM_UNIT::RT});
     DimMapper<1> d2(d);
     bool x = (d == dims);
+    DimMapperRTMZ static_dims;
+    DimMapperIMInt static_dims_im(DimIM(DIM_UNIT::IM_MS), DimINT());
+    bool y = (static_dims == static_dims);
     Area<2> area(nullptr);
   }
 
@@ -0,0 +1,67 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/KERNEL/ExperimentView.h>
+
+namespace OpenMS
+{
+
+  ExperimentView::ExperimentView(Iterator first, Iterator last) :
+    begin_(first),
+    end_(last)
+  {
+  }
+
+  ExperimentView::ExperimentView(MSExperiment& exp, CoordinateType min_rt, CoordinateType max_rt) :
+    begin_(exp.RTBegin(min_rt)),
+    end_(exp.RTEnd(max_rt))
+  {
+    // an empty window below or above the experiment leaves begin_ > end_
+    if (end_ < begin_)
+    {
+      end_ = begin_;
+    }
+  }
+
+  void ExperimentView::updateRanges()
+  {
+    updateRanges(-1);
+  }
+
+  void ExperimentView::updateRanges(Int ms_level)
+  {
+    // same logic as MSExperiment::updateRanges(), restricted to the viewed spectra
+    this->clearRanges();
+    total_size_ = 0;
+
+    for (Iterator it = begin_; it != end_; ++it)
+    {
+      if (ms_level < Int(0) || Int(it->getMSLevel()) == ms_level)
+      {
+        // calculate size
+        total_size_ += it->size();
+
+        // ranges
+        this->extendRT(it->getRT()); // RT
+        this->extendMobility(it->getDriftTime()); // IM
+        it->updateRanges();
+        this->extend(*it);           // m/z and intensity from spectrum's range
+      }
+      // for MS level = 1 we extend the range for all the MS2 precursors
+      if (ms_level == 1 && it->getMSLevel() == 2)
+      {
+        if (!it->getPrecursors().empty())
+        {
+          this->extendRT(it->getRT());
+          this->extendMZ(it->getPrecursors()[0].getMZ());
+        }
+      }
+    }
+  }
+
+} // namespace OpenMS
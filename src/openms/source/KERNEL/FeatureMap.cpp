@@ -108,7 +108,27 @@ namespace OpenMS
 
   FeatureMap::FeatureMap(FeatureMap&& source) = default;
 
-  FeatureMap::~FeatureMap() = default;
+  FeatureMap::~FeatureMap()
+  {
+    releaseFeatureData_();
+  }
+
+  void FeatureMap::releaseFeatureData_()
+  {
+    // only worth spinning up threads for large maps
+    if (data_.size() < 100000) return;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1000)
+#endif
+    for (SignedSize i = 0; i < (SignedSize)data_.size(); ++i)
+    {
+      // moving out the feature releases its separately allocated subordinates,
+      // convex hulls and peptide identifications on this thread and leaves an
+      // empty feature behind (moves are noexcept)
+      Feature tmp(std::move(data_[i]));
+    }
+  }
 
   FeatureMap& FeatureMap::operator=(const FeatureMap& rhs)  // TODO: cannot be defaulted since OpenMS::IdentificationData is missing operator=
   {
@@ -407,6 +427,7 @@ namespace OpenMS
 
   void FeatureMap::clear(bool clear_meta_data)
   {
+    releaseFeatureData_();
     data_.clear();
 
     if (clear_meta_data)
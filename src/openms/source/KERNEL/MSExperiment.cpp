@@ -16,6 +16,7 @@
 #include <OpenMS/SYSTEM/File.h>
 
 #include <algorithm>
+#include <iterator>
 #include <limits>
 
 namespace OpenMS
@@ -45,6 +46,7 @@ namespace OpenMS
     total_size_ = source.total_size_;
     chromatograms_ = source.chromatograms_;
     spectra_ = source.spectra_;
+    area_tile_index_ = source.area_tile_index_; // immutable once built, so sharing is fine
 
     //no need to copy the alloc?!
     //alloc_
@@ -95,7 +97,7 @@ namespace OpenMS
     OPENMS_PRECONDITION(this->isSorted(true), "Experiment is not sorted by RT and m/z! Using AreaIterator will give invalid results!")
     auto [min_im, max_im] = RangeMobility{}.getNonEmptyRange(); // a full range
     auto area = AreaIterator::Param(spectra_.begin(), RTBegin(min_rt), RTEnd(max_rt), ms_level);
-    area.lowMZ(min_mz).highMZ(max_mz).lowIM(min_im).highIM(max_im);
+    area.lowMZ(min_mz).highMZ(max_mz).lowIM(min_im).highIM(max_im).skipIndex(area_tile_index_.get());
     return AreaIterator(area);
   }
 
@@ -106,7 +108,7 @@ namespace OpenMS
     auto [min_mz, max_mz] = range.RangeMZ::getNonEmptyRange();
     auto [min_im, max_im] = range.RangeMobility::getNonEmptyRange();
     auto area = AreaIterator::Param(spectra_.begin(), RTBegin(min_rt), RTEnd(max_rt), ms_level);
-    area.lowMZ(min_mz).highMZ(max_mz).lowIM(min_im).highIM(max_im);
+    area.lowMZ(min_mz).highMZ(max_mz).lowIM(min_im).highIM(max_im).skipIndex(area_tile_index_.get());
     return AreaIterator(area);
   }
 
@@ -124,7 +126,7 @@ namespace OpenMS
     OPENMS_PRECONDITION(this->isSorted(true), "Experiment is not sorted by RT and m/z! Using ConstAreaIterator will give invalid results!")
     auto [min_im, max_im] = RangeMobility{}.getNonEmptyRange(); // a full range
     auto area = ConstAreaIterator::Param(spectra_.begin(), RTBegin(min_rt), RTEnd(max_rt), ms_level);
-    area.lowMZ(min_mz).highMZ(max_mz).lowIM(min_im).highIM(max_im);
+    area.lowMZ(min_mz).highMZ(max_mz).lowIM(min_im).highIM(max_im).skipIndex(area_tile_index_.get());
     return ConstAreaIterator(area);
   }
 
@@ -135,7 +137,7 @@ namespace OpenMS
     auto [min_mz, max_mz] = range.RangeMZ::getNonEmptyRange();
     auto [min_im, max_im] = range.RangeMobility::getNonEmptyRange();
     auto area = ConstAreaIterator::Param(spectra_.begin(), RTBegin(min_rt), RTEnd(max_rt), ms_level);
-    area.lowMZ(min_mz).highMZ(max_mz).lowIM(min_im).highIM(max_im);
+    area.lowMZ(min_mz).highMZ(max_mz).lowIM(min_im).highIM(max_im).skipIndex(area_tile_index_.get());
     return ConstAreaIterator(area);
   }
 
@@ -145,6 +147,23 @@ namespace OpenMS
     return ConstAreaIterator();
   }
 
+  void MSExperiment::buildAreaTileIndex(Size mz_tiles, Size rt_block_size)
+  {
+    auto index = std::make_shared<AreaTileIndex>();
+    index->build(*this, mz_tiles, rt_block_size);
+    area_tile_index_ = std::move(index);
+  }
+
+  void MSExperiment::clearAreaTileIndex()
+  {
+    area_tile_index_.reset();
+  }
+
+  const AreaTileIndex* MSExperiment::getAreaTileIndex() const
+  {
+    return area_tile_index_.get();
+  }
+
   /**
   @brief Fast search for spectrum range begin
 
@@ -305,6 +324,74 @@ namespace OpenMS
     }
   }
 
+  void MSExperiment::updateRangesIncremental()
+  {
+    // clear MS levels
+    ms_levels_.clear();
+
+    // reset mz/rt/int range
+    this->clearRanges();
+    // reset point count
+    total_size_ = 0;
+
+    // empty
+    if (spectra_.empty() && chromatograms_.empty())
+    {
+      return;
+    }
+
+    for (Base::iterator it = spectra_.begin(); it != spectra_.end(); ++it)
+    {
+      //ms levels
+      if (std::find(ms_levels_.begin(), ms_levels_.end(), it->getMSLevel()) == ms_levels_.end())
+      {
+        ms_levels_.push_back(it->getMSLevel());
+      }
+
+      // calculate size
+      total_size_ += it->size();
+
+      // ranges
+      this->extendRT(it->getRT()); // RT
+      this->extendMobility(it->getDriftTime()); // IM
+      // the empty cached range is the dirty bit: only such spectra are rescanned
+      if (!it->empty() && it->hasRange() == HasRangeType::NONE)
+      {
+        it->updateRanges();
+      }
+      this->extend(*it);           // m/z and intensity from spectrum's cached range
+    }
+    std::sort(ms_levels_.begin(), ms_levels_.end());
+
+    if (this->chromatograms_.empty())
+    {
+      return;
+    }
+
+    // update intensity, m/z and RT according to chromatograms as well:
+    for (ChromatogramType& cp : chromatograms_)
+    {
+      // rescan only chromatograms with an invalidated (empty) cached range
+      if (!cp.empty() && cp.hasRange() == HasRangeType::NONE)
+      {
+        cp.updateRanges();
+      }
+
+      // ignore TICs and ECs for the whole experiments range (as these are usually positioned at 0 and therefor lead to a large white margin in plots if included)
+      if (cp.getChromatogramType() == ChromatogramSettings::TOTAL_ION_CURRENT_CHROMATOGRAM ||
+        cp.getChromatogramType() == ChromatogramSettings::EMISSION_CHROMATOGRAM)
+      {
+        continue;
+      }
+
+      total_size_ += cp.size();
+
+      // ranges
+      this->extendMZ(cp.getMZ());// MZ
+      this->extend(cp);// RT and intensity from chroms's cached range
+    }
+  }
+
   /// returns the total number of peaks
   UInt64 MSExperiment::getSize() const
   {
@@ -348,10 +435,11 @@ namespace OpenMS
 
     if (sort_mz)
     {
-      // sort each spectrum by m/z
-      for (Iterator iter = spectra_.begin(); iter != spectra_.end(); ++iter)
+      // sort each spectrum by m/z, parallel over spectra
+#pragma omp parallel for schedule(dynamic)
+      for (SignedSize i = 0; i < (SignedSize)spectra_.size(); ++i)
       {
-        iter->sortByPosition();
+        spectra_[i].sortByPosition();
       }
     }
   }
@@ -411,6 +499,7 @@ namespace OpenMS
   void MSExperiment::reset()
   {
     spectra_.clear();           //remove data
+    area_tile_index_.reset();           //remove the tile index
     RangeManagerType::clearRanges();           //reset range manager
     ExperimentalSettings::operator=(ExperimentalSettings());           //reset meta info
   }
@@ -595,6 +684,24 @@ namespace OpenMS
     spectra_.push_back(std::move(spectrum));
   }
 
+  void MSExperiment::addSpectra(const std::vector<MSSpectrum>& spectra)
+  {
+    spectra_.insert(spectra_.end(), spectra.begin(), spectra.end());
+  }
+
+  void MSExperiment::addSpectra(std::vector<MSSpectrum>&& spectra)
+  {
+    if (spectra_.empty())
+    { // take over the whole buffer
+      spectra_ = std::move(spectra);
+    }
+    else
+    {
+      spectra_.insert(spectra_.end(), std::make_move_iterator(spectra.begin()), std::make_move_iterator(spectra.end()));
+    }
+    spectra.clear();
+  }
+
   /// returns the spectrum list
   const std::vector<MSSpectrum>& MSExperiment::getSpectra() const
   {
@@ -630,6 +737,24 @@ namespace OpenMS
     chromatograms_.push_back(std::move(chrom));
   }  
 
+  void MSExperiment::addChromatograms(const std::vector<MSChromatogram>& chromatograms)
+  {
+    chromatograms_.insert(chromatograms_.end(), chromatograms.begin(), chromatograms.end());
+  }
+
+  void MSExperiment::addChromatograms(std::vector<MSChromatogram>&& chromatograms)
+  {
+    if (chromatograms_.empty())
+    { // take over the whole buffer
+      chromatograms_ = std::move(chromatograms);
+    }
+    else
+    {
+      chromatograms_.insert(chromatograms_.end(), std::make_move_iterator(chromatograms.begin()), std::make_move_iterator(chromatograms.end()));
+    }
+    chromatograms.clear();
+  }
+
   /// returns the chromatogram list
   const std::vector<MSChromatogram >& MSExperiment::getChromatograms() const
   {
@@ -716,6 +841,30 @@ namespace OpenMS
     }
   }
 
+  void MSExperiment::partitionForParallelAccess()
+  {
+    // Copying a spectrum allocates fresh buffers which are first touched by
+    // the copying thread; with first-touch placement the pages therefore end
+    // up on the NUMA node of the thread owning this index range under static
+    // scheduling. The move assignment back only swaps pointers.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (SignedSize i = 0; i < (SignedSize)spectra_.size(); ++i)
+    {
+      SpectrumType fresh(spectra_[i]);
+      spectra_[i] = std::move(fresh);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (SignedSize i = 0; i < (SignedSize)chromatograms_.size(); ++i)
+    {
+      MSChromatogram fresh(chromatograms_[i]);
+      chromatograms_[i] = std::move(fresh);
+    }
+  }
+
   // static
   bool MSExperiment::containsScanOfLevel(size_t ms_level) const
   {
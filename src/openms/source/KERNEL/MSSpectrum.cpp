@@ -98,6 +98,50 @@ namespace OpenMS
     return *this;
   }
 
+  Size MSSpectrum::findFloatDataArray(const String& name) const
+  {
+    for (Size i = 0; i < float_data_arrays_.size(); ++i)
+    {
+      if (float_data_arrays_[i].getName() == name)
+      {
+        return i;
+      }
+    }
+    return Size(-1);
+  }
+
+  Size MSSpectrum::findIntegerDataArray(const String& name) const
+  {
+    for (Size i = 0; i < integer_data_arrays_.size(); ++i)
+    {
+      if (integer_data_arrays_[i].getName() == name)
+      {
+        return i;
+      }
+    }
+    return Size(-1);
+  }
+
+  MSSpectrum& MSSpectrum::selectByFloatDataArray(const Size array_index, const float min_value, const float max_value)
+  {
+    const FloatDataArray& fda = float_data_arrays_.at(array_index);
+    if (fda.size() != size())
+    {
+      throw Exception::Precondition(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "FloatDataArray[" + String(array_index) + "] size (" +
+                                                                                String(fda.size()) + ") does not match spectrum size (" + String(size()) + ")");
+    }
+    std::vector<Size> indices;
+    indices.reserve(fda.size());
+    for (Size i = 0; i < fda.size(); ++i)
+    {
+      if (min_value <= fda[i] && fda[i] <= max_value)
+      {
+        indices.push_back(i);
+      }
+    }
+    return select(indices);
+  }
+
   SpectrumSettings::SpectrumType MSSpectrum::getType(const bool query_data) const
   {
     SpectrumSettings::SpectrumType t = SpectrumSettings::getType();
@@ -398,10 +442,24 @@ namespace OpenMS
       return;
     }
 
-    // sort index list
-    sort([this](const Size i1, const Size i2) -> bool {
-      return this->operator[](i1).getPosition() < this->operator[](i2).getPosition();
-    });
+    // sort packed (m/z, index) keys instead of bare indices: all comparisons stay within
+    // one contiguous buffer instead of dereferencing into the peak array for each one;
+    // buffers are per thread and reused across spectra
+    static thread_local std::vector<std::pair<CoordinateType, Size>> sort_keys;
+    static thread_local std::vector<Size> select_indices;
+    sort_keys.resize(this->size());
+    for (Size i = 0; i < sort_keys.size(); ++i)
+    {
+      sort_keys[i] = std::make_pair(ContainerType::operator[](i).getMZ(), i);
+    }
+    // the index tie-break keeps peaks of equal m/z in their original order (i.e. a stable sort)
+    std::sort(sort_keys.begin(), sort_keys.end());
+    select_indices.resize(sort_keys.size());
+    for (Size i = 0; i < sort_keys.size(); ++i)
+    {
+      select_indices[i] = sort_keys[i].second;
+    }
+    select(select_indices);
   }
 
   void MSSpectrum::sortByIntensity(bool reverse)
@@ -427,20 +485,33 @@ namespace OpenMS
       return;
     }
 
-    // sort index list
+    // as in sortByPosition(): sort packed (intensity, index) keys instead of bare indices
+    static thread_local std::vector<std::pair<PeakType::IntensityType, Size>> sort_keys;
+    static thread_local std::vector<Size> select_indices;
+    sort_keys.resize(this->size());
+    for (Size i = 0; i < sort_keys.size(); ++i)
+    {
+      sort_keys[i] = std::make_pair(ContainerType::operator[](i).getIntensity(), i);
+    }
     if (reverse)
     {
-      this->sort([this](const Size i1, const Size i2) -> bool 
+      std::sort(sort_keys.begin(), sort_keys.end(), [](const std::pair<PeakType::IntensityType, Size>& a, const std::pair<PeakType::IntensityType, Size>& b)
       {
-        return this->operator[](i2).getIntensity() < this->operator[](i1).getIntensity();
+        if (b.first < a.first) return true;
+        if (a.first < b.first) return false;
+        return a.second < b.second; // index tie-break keeps equal intensities in original order
       });
     }
     else
     {
-      this->sort([this](const Size i1, const Size i2) -> bool {
-        return this->operator[](i1).getIntensity() < this->operator[](i2).getIntensity();
-      });
-    };
+      std::sort(sort_keys.begin(), sort_keys.end());
+    }
+    select_indices.resize(sort_keys.size());
+    for (Size i = 0; i < sort_keys.size(); ++i)
+    {
+      select_indices[i] = sort_keys[i].second;
+    }
+    select(select_indices);
   }
 
   bool MSSpectrum::isSorted() const
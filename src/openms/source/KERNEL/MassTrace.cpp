@@ -45,6 +45,16 @@ namespace OpenMS
     {
     }
 
+    MassTrace::MassTrace(std::vector<PeakType>&& trace_peaks) :
+
+            trace_peaks_(std::move(trace_peaks)),
+
+            label_(),
+            smoothed_intensities_()
+
+    {
+    }
+
     PeakType& MassTrace::operator[](const Size& mt_idx)
     {
       return trace_peaks_[mt_idx];
@@ -14,6 +14,7 @@ namespace OpenMS
 {
   bool OnDiscMSExperiment::openFile(const String& filename, bool skipMetaData)
   {
+    waitForReadAhead_();
     filename_ = filename;
     indexed_mzml_file_.openFile(filename);
     if (!filename.empty() && !skipMetaData)
@@ -25,11 +26,13 @@ namespace OpenMS
 
   void OnDiscMSExperiment::setSkipXMLChecks(bool skip)
   {
+    waitForReadAhead_();
     indexed_mzml_file_.setSkipXMLChecks(skip);
   }
 
   OpenMS::Interfaces::ChromatogramPtr OnDiscMSExperiment::getChromatogramById(Size id)
   {
+    waitForReadAhead_();
     return indexed_mzml_file_.getChromatogramById(id);
   }
 
@@ -64,6 +67,7 @@ namespace OpenMS
 
   MSChromatogram OnDiscMSExperiment::getChromatogramByNativeId(const std::string& id)
   {
+    waitForReadAhead_();
     if (!meta_ms_experiment_)
     {
       MSChromatogram chromatogram;
@@ -96,6 +100,7 @@ namespace OpenMS
 
   MSSpectrum OnDiscMSExperiment::getSpectrumByNativeId(const std::string& id)
   {
+    waitForReadAhead_();
     if (!meta_ms_experiment_)
     {
       MSSpectrum spec;
@@ -0,0 +1,115 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/KERNEL/SoASpectrum.h>
+
+#include <OpenMS/CONCEPT/Exception.h>
+#include <OpenMS/KERNEL/MSSpectrum.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace OpenMS
+{
+  SoASpectrum::SoASpectrum(const MSSpectrum& spec)
+  {
+    mz_.reserve(spec.size());
+    intensity_.reserve(spec.size());
+    for (const Peak1D& p : spec)
+    {
+      mz_.push_back(p.getMZ());
+      intensity_.push_back(p.getIntensity());
+    }
+  }
+
+  SoASpectrum::SoASpectrum(MZArrayType&& mz, IntensityArrayType&& intensity) :
+    mz_(std::move(mz)),
+    intensity_(std::move(intensity))
+  {
+    if (mz_.size() != intensity_.size())
+    {
+      throw Exception::Precondition(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+                                    "m/z array size (" + String(mz_.size()) + ") does not match intensity array size (" +
+                                    String(intensity_.size()) + ")!");
+    }
+  }
+
+  MSSpectrum SoASpectrum::toSpectrum() const
+  {
+    MSSpectrum spec;
+    spec.reserve(size());
+    for (Size i = 0; i < size(); ++i)
+    {
+      spec.emplace_back(Peak1D::PositionType(mz_[i]), intensity_[i]);
+    }
+    return spec;
+  }
+
+  void SoASpectrum::clear()
+  {
+    mz_.clear();
+    intensity_.clear();
+  }
+
+  void SoASpectrum::reserve(Size n)
+  {
+    mz_.reserve(n);
+    intensity_.reserve(n);
+  }
+
+  void SoASpectrum::push_back(CoordinateType mz, IntensityType intensity)
+  {
+    mz_.push_back(mz);
+    intensity_.push_back(intensity);
+  }
+
+  Size SoASpectrum::findNearest(CoordinateType mz) const
+  {
+    // no peak => no search
+    if (empty())
+    {
+      throw Exception::Precondition(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "There must be at least one peak to determine the nearest peak!");
+    }
+    // search for position for inserting
+    const Size insert_pos = MZBegin(mz);
+    // border cases
+    if (insert_pos == 0)
+    {
+      return 0;
+    }
+    if (insert_pos == size())
+    {
+      return size() - 1;
+    }
+    // the peak before or the current peak are closest
+    if (std::fabs(mz_[insert_pos] - mz) < std::fabs(mz_[insert_pos - 1] - mz))
+    {
+      return insert_pos;
+    }
+    else
+    {
+      return insert_pos - 1;
+    }
+  }
+
+  Size SoASpectrum::MZBegin(CoordinateType mz) const
+  {
+    return Size(std::lower_bound(mz_.begin(), mz_.end(), mz) - mz_.begin());
+  }
+
+  Size SoASpectrum::MZEnd(CoordinateType mz) const
+  {
+    return Size(std::upper_bound(mz_.begin(), mz_.end(), mz) - mz_.begin());
+  }
+
+  bool SoASpectrum::isSorted() const
+  {
+    return std::is_sorted(mz_.begin(), mz_.end());
+  }
+
+} // namespace OpenMS
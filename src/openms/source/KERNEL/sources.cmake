@@ -4,12 +4,15 @@ set(directory source/KERNEL)
 ### list all filenames of the directory here
 set(sources_list
 AreaIterator.cpp
+AreaTileIndex.cpp
 BaseFeature.cpp
+ChromatogramBundle.cpp
 ConsensusFeature.cpp
 ConsensusMap.cpp
 ConversionHelper.cpp
 DimMapper.cpp
 DPeak.cpp
+ExperimentView.cpp
 Feature.cpp
 FeatureHandle.cpp
 FeatureMap.cpp
@@ -21,6 +24,7 @@ MRMFeature.cpp
 MRMTransitionGroup.cpp
 MSExperiment.cpp
 MSSpectrum.cpp
+SoASpectrum.cpp
 OnDiscMSExperiment.cpp
 Peak1D.cpp
 Peak2D.cpp
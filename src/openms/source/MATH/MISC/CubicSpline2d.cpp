@@ -76,7 +76,35 @@ namespace OpenMS
     }
     
     const double xx = x - x_[i];
-    return ((d_[i] * xx + c_[i]) * xx + b_[i]) * xx + a_[i];
+    const double* coeff = &coeffs_[4 * i];
+    return ((coeff[3] * xx + coeff[2]) * xx + coeff[1]) * xx + coeff[0];
+  }
+
+  void CubicSpline2d::eval(std::vector<double>::const_iterator x_begin, std::vector<double>::const_iterator x_end, std::vector<double>::iterator y_begin) const
+  {
+    if (x_begin == x_end)
+    {
+      return;
+    }
+
+    if (*x_begin < x_.front() || *(x_end - 1) > x_.back())
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Argument out of range of spline interpolation.");
+    }
+
+    const size_t last_segment = x_.size() - 2;
+    size_t i = 0;
+    for (std::vector<double>::const_iterator x_it = x_begin; x_it != x_end; ++x_it, ++y_begin)
+    {
+      // positions are ascending, so the segment index only ever moves right
+      while (i < last_segment && x_[i + 1] <= *x_it)
+      {
+        ++i;
+      }
+      const double xx = *x_it - x_[i];
+      const double* coeff = &coeffs_[4 * i];
+      *y_begin = ((coeff[3] * xx + coeff[2]) * xx + coeff[1]) * xx + coeff[0];
+    }
   }
 
   double CubicSpline2d::derivative(const double x) const
@@ -104,17 +132,18 @@ namespace OpenMS
     }
     
     const double xx = x - x_[i];
+    const double* coeff = &coeffs_[4 * i];
     if (order == 1)
     {
-      return b_[i] + 2 * c_[i] * xx + 3 * d_[i] * xx * xx;
+      return coeff[1] + 2 * coeff[2] * xx + 3 * coeff[3] * xx * xx;
     }
     else if (order == 2)
     {
-      return 2 * c_[i] + 6 * d_[i] * xx;
+      return 2 * coeff[2] + 6 * coeff[3] * xx;
     }
     else
     {
-      return 6 * d_[i];
+      return 6 * coeff[3];
     }
   }
 
@@ -124,12 +153,10 @@ namespace OpenMS
 
     std::vector<double> h;
     h.reserve(n);
-    a_.reserve(n);
     x_.reserve(n + 1);
     // do the 0'th element manually, since the loop below only starts at 1
     h.push_back(x[1] - x[0]);
     x_.push_back(x[0]);
-    a_.push_back(y[0]);
 
     std::vector<double> mu(n, 0.0);
     std::vector<double> z(n, 0.0);
@@ -139,22 +166,24 @@ namespace OpenMS
       const double l = 2 * (x[i + 1] - x[i - 1]) - h[i - 1] * mu[i - 1];
       mu[i] = h[i] / l;
       z[i] = (3 * (y[i + 1] * h[i - 1] - y[i] * (x[i + 1] - x[i - 1]) + y[i - 1] * h[i]) / (h[i - 1] * h[i]) - h[i - 1] * z[i - 1]) / l;
-      // store x,y -- required for evaluation later on
+      // store x -- required for evaluation later on
       x_.push_back(x[i]);
-      a_.push_back(y[i]);
     }
-    // 'x_' needs to be full length (all other member vectors (except c_) are one element shorter)
+    // 'x_' needs to be full length (one knot more than there are segments)
     x_.push_back(x[n]);
 
-    b_.resize(n); 
-    d_.resize(n);
-    c_.resize(n+1);
-    c_.back() = 0;
+    // back-substitution; the quadratic coefficients are needed one element ahead,
+    // so they are kept in a scratch vector and packed into 'coeffs_' along with
+    // the constant (= y), linear and cubic coefficient of each segment
+    std::vector<double> c(n + 1, 0.0);
+    coeffs_.resize(4 * n);
     for (int j = static_cast<int>(n) - 1; j >= 0; --j)
     {
-      c_[j] = z[j] - mu[j] * c_[j + 1];
-      b_[j] = (y[j + 1] - y[j]) / h[j] - h[j] * (c_[j + 1] + 2 * c_[j]) / 3;
-      d_[j] = (c_[j + 1] - c_[j]) / (3 * h[j]);
+      c[j] = z[j] - mu[j] * c[j + 1];
+      coeffs_[4 * j] = y[j];
+      coeffs_[4 * j + 1] = (y[j + 1] - y[j]) / h[j] - h[j] * (c[j + 1] + 2 * c[j]) / 3;
+      coeffs_[4 * j + 2] = c[j];
+      coeffs_[4 * j + 3] = (c[j + 1] - c[j]) / (3 * h[j]);
     }
 
   }
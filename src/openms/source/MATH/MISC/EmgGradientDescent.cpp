@@ -261,6 +261,57 @@ namespace OpenMS
     return result;
   }
 
+  void EmgGradientDescent::computeLossAndGradient_(
+    const std::vector<double>& xs,
+    const std::vector<double>& ys,
+    const double h,
+    const double mu,
+    const double sigma,
+    const double tau,
+    double& E,
+    double& diff_E_h,
+    double& diff_E_mu,
+    double& diff_E_sigma,
+    double& diff_E_tau
+  ) const
+  {
+    const double u = mu;
+    const double s = sigma;
+    const double t = tau;
+    E = diff_E_h = diff_E_mu = diff_E_sigma = diff_E_tau = 0.0;
+    // The per-point terms below are identical to those in Loss_function() and
+    // the E_wrt_*() methods; here they share a single pass over the points
+    // (and a single branch selection on z per point).
+    for (Size i = 0; i < xs.size(); ++i)
+    {
+      const double x = xs[i];
+      const double y = ys[i];
+      const double z = compute_z(x, mu, sigma, tau);
+      E += std::pow(emg_point(x, h, mu, sigma, tau) - y, 2.0) / xs.size();
+      if (z < 0)
+      {
+        diff_E_h += ((s * std::exp((std::pow(s,2.0) + 2.0 * t * u - 4.0 * t * x)/(2.0 * std::pow(t,2.0))) * std::erfc((std::pow(s,2.0) + t * (u - x))/(std::sqrt(2.0) * s * t)) * (PI * h * s * std::exp((std::pow(s,2.0) + 2 * t * u)/(2 * std::pow(t,2.0))) * std::erfc((std::pow(s,2.0) + t * (u - x))/(std::sqrt(2.0) * s * t)) - std::sqrt(2.0 * PI) * t * y * std::exp(x/t)))/std::pow(t,2.0)) / static_cast<double>(xs.size());
+        diff_E_mu += (2 * ((std::sqrt(PI/2.0) * h * s * std::exp(std::pow(s,2.0)/(2.0 * std::pow(t,2.0)) - (x - u)/t) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/std::pow(t,2.0) - (h * std::exp(std::pow(s,2.0)/(2.0 * std::pow(t,2.0)) - 1.0/2.0 * std::pow((s/t - (x - u)/s),2.0) - (x - u)/t))/t) * ((std::sqrt(PI/2.0) * h * s * std::exp(std::pow(s,2.0)/(2.0 * std::pow(t,2.0)) - (x - u)/t) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/t - y)) / static_cast<double>(xs.size());
+        diff_E_sigma += (2.0 * ((std::sqrt(PI/2.0) * h * std::exp(std::pow(s,2.0)/(2.0 * std::pow(t,2.0)) - (x - u)/t) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/t + (std::sqrt(PI/2.0) * h * std::pow(s,2.0) * std::exp(std::pow(s,2.0)/(2.0 * std::pow(t,2.0)) - (x - u)/t) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/std::pow(t,3.0) - (h * s * std::exp(std::pow(s,2.0)/(2.0 * std::pow(t,2.0)) - 1.0/2.0 * std::pow((s/t - (x - u)/s),2.0) - (x - u)/t) * ((x - u)/std::pow(s,2.0) + 1.0/t))/t) * ((std::sqrt(PI/2.0) * h * s * std::exp(std::pow(s,2.0)/(2.0 * std::pow(t,2.0)) - (x - u)/t) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/t - y)) / static_cast<double>(xs.size());
+        diff_E_tau += (2 * (-(std::sqrt(PI/2.0) * h * s * std::exp(std::pow(s,2.0)/(2 * std::pow(t,2.0)) - (x - u)/t) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/std::pow(t,2.0) + (std::sqrt(PI/2.0) * h * s * std::exp(std::pow(s,2.0)/(2.0 * std::pow(t,2.0)) - (x - u)/t) * ((x - u)/std::pow(t,2.0) - std::pow(s,2.0)/std::pow(t,3.0)) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/t + (h * std::pow(s,2.0) * std::exp(std::pow(s,2.0)/(2.0 * std::pow(t,2.0)) - 1.0/2.0 * std::pow((s/t - (x - u)/s),2.0) - (x - u)/t))/std::pow(t,3.0)) * ((std::sqrt(PI/2.0) * h * s * std::exp(std::pow(s,2.0)/(2.0 * std::pow(t,2.0)) - (x - u)/t) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/t - y)) / static_cast<double>(xs.size());
+      }
+      else if (z <= 6.71e7)
+      {
+        diff_E_h += ((std::sqrt(2.0 * PI) * s * std::exp(1.0/2.0 * std::pow((s/t - (x - u)/s),2.0) - std::pow((x - u),2.0)/(2.0 * std::pow(s,2.0))) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)) * ((std::sqrt(PI/2.0) * h * s * std::exp(1.0/2.0 * std::pow((s/t - (x - u)/s), 2.0) - std::pow((x - u),2.0)/(2 * std::pow(s,2.0))) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/t - y))/t) / static_cast<double>(xs.size());
+        diff_E_mu += (2 * ((std::sqrt(PI/2.0) * h * s * std::exp(1.0/2.0 * std::pow((s/t - (x - u)/s),2.0) - std::pow((x - u),2.0)/(2.0 * std::pow(s,2.0))) * ((x - u)/std::pow(s,2.0) + (s/t - (x - u)/s)/s) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/t - (h * std::exp(-std::pow((x - u),2.0)/(2.0 * std::pow(s,2.0))))/t) * ((std::sqrt(PI/2.0) * h * s * std::exp(1.0/2.0 * std::pow((s/t - (x - u)/s),2.0) - std::pow((x - u),2.0)/(2.0 * std::pow(s,2.0))) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/t - y)) / static_cast<double>(xs.size());
+        diff_E_sigma += (2.0 * ((std::sqrt(PI/2.0) * h * std::exp(1.0/2.0 * std::pow((s/t - (x - u)/s),2.0) - std::pow((x - u),2.0)/(2.0 * std::pow(s,2.0))) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/t + (std::sqrt(PI/2.0) * h * s * std::exp(1.0/2.0 * std::pow((s/t - (x - u)/s),2.0) - std::pow((x - u),2.0)/(2.0 * std::pow(s,2.0))) * (std::pow((x - u),2.0)/std::pow(s,3.0) + ((x - u)/std::pow(s,2.0) + 1.0/t) * (s/t - (x - u)/s)) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/t - (h * s * std::exp(-std::pow((x - u),2.0)/(2.0 * std::pow(s,2.0))) * ((x - u)/std::pow(s,2.0) + 1.0/t))/t) * ((std::sqrt(PI/2.0) * h * s * std::exp(1.0/2.0 * std::pow((s/t - (x - u)/s),2.0) - std::pow((x - u),2.0)/(2.0 * std::pow(s,2.0))) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/t - y)) / static_cast<double>(xs.size());
+        diff_E_tau += (2 * (-(std::sqrt(PI/2.0) * h * std::pow(s,2.0) * std::exp(1.0/2.0 * std::pow((s/t - (x - u)/s),2.0) - std::pow(x-u,2.0)/(2.0 * std::pow(s,2.0))) * (s/t - (x - u)/s) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/std::pow(t,3.0) - (std::sqrt(PI/2.0) * h * s * std::exp(1.0/2.0 * std::pow((s/t - (x - u)/s),2.0) - std::pow(x-u,2.0)/(2.0 * std::pow(s,2.0))) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/std::pow(t,2.0) + (h * std::pow(s,2.0) * std::exp(-std::pow(x-u,2.0)/(2 * std::pow(s,2.0))))/std::pow(t,3.0)) * ((std::sqrt(PI/2.0) * h * s * std::exp(1.0/2.0 * std::pow((s/t - (x - u)/s),2.0) - std::pow(x-u,2.0)/(2 * std::pow(s,2.0))) * std::erfc((s/t - (x - u)/s)/std::sqrt(2.0)))/t - y)) / static_cast<double>(xs.size());
+      }
+      else
+      {
+        diff_E_h += ((2 * std::exp(-std::pow((x - u),2.0)/(2.0 * std::pow(s,2.0))) * ((h * std::exp(-std::pow((x - u),2.0)/(2 * std::pow(s,2.0))))/(1 - (t * (x - u))/std::pow(s,2.0)) - y))/(1 - (t * (x - u))/std::pow(s,2.0))) / static_cast<double>(xs.size());
+        diff_E_mu += (2.0 * ((h * (x - u) * std::exp(-std::pow((x - u),2.0)/(2.0 * std::pow(s,2.0))))/(std::pow(s,2.0) * (1.0 - (t * (x - u))/std::pow(s,2.0))) - (h * t * std::exp(-std::pow((x - u),2.0)/(2.0 * std::pow(s,2.0))))/(std::pow(s,2.0) * std::pow((1.0 - (t * (x - u))/std::pow(s,2.0)),2.0))) * ((h * std::exp(-std::pow((x - u),2.0)/(2.0 * std::pow(s,2.0))))/(1.0 - (t * (x - u))/std::pow(s,2.0)) - y)) / static_cast<double>(xs.size());
+        diff_E_sigma += (2.0 * ((h * std::pow((x - u),2.0) * std::exp(-std::pow((x - u),2.0)/(2.0 * std::pow(s,2.0))))/(std::pow(s,3.0) * (1.0 - (t * (x - u))/std::pow(s,2.0))) - (2.0 * h * t * (x - u) * std::exp(-std::pow((x - u),2.0)/(2 * std::pow(s,2.0))))/(std::pow(s,3.0) * std::pow((1.0 - (t * (x - u))/std::pow(s,2.0)),2.0))) * ((h * std::exp(-std::pow(x-u,2.0)/(2 * std::pow(s,2.0))))/(1 - (t * (x - u))/std::pow(s,2.0)) - y)) / static_cast<double>(xs.size());
+        diff_E_tau += ((2.0 * h * (x - u) * std::exp(-std::pow(x-u,2.0)/(2.0 * std::pow(s,2.0))) * ((h * std::exp(-std::pow(x-u,2.0)/(2.0 * std::pow(s,2.0))))/(1.0 - (t * (x - u))/std::pow(s,2.0)) - y))/(std::pow(s,2.0) * std::pow((1.0 - (t * (x - u))/std::pow(s,2.0)),2.0))) / static_cast<double>(xs.size());
+      }
+    }
+  }
+
   void EmgGradientDescent::applyEstimatedParameters(
     const std::vector<double>& xs,
     const double h,
@@ -628,8 +679,21 @@ namespace OpenMS
         break;
       }
 
-      // Compute the cost given the current parameters
-      const double current_E = Loss_function(TrX, TrY, h, mu, sigma, tau);
+      // Compute the cost and the partial derivatives given the current
+      // parameters, in a single pass over the training set
+      double current_E, diff_E_h, diff_E_mu, diff_E_sigma, diff_E_tau;
+      if (print_debug_ == 2)
+      { // the individual cost functions print their per-point terms
+        current_E = Loss_function(TrX, TrY, h, mu, sigma, tau);
+        diff_E_h = E_wrt_h(TrX, TrY, h, mu, sigma, tau);
+        diff_E_mu = E_wrt_mu(TrX, TrY, h, mu, sigma, tau);
+        diff_E_sigma = E_wrt_sigma(TrX, TrY, h, mu, sigma, tau);
+        diff_E_tau = E_wrt_tau(TrX, TrY, h, mu, sigma, tau);
+      }
+      else
+      {
+        computeLossAndGradient_(TrX, TrY, h, mu, sigma, tau, current_E, diff_E_h, diff_E_mu, diff_E_sigma, diff_E_tau);
+      }
 
       // Break if the computed cost is an invalid value
       if (std::isnan(current_E) || std::isinf(current_E))
@@ -650,12 +714,6 @@ namespace OpenMS
         best_iter = iter_idx;
       }
 
-      // Compute the partial derivatives given the current parameters
-      double diff_E_h = E_wrt_h(TrX, TrY, h, mu, sigma, tau);
-      double diff_E_mu = E_wrt_mu(TrX, TrY, h, mu, sigma, tau);
-      double diff_E_sigma = E_wrt_sigma(TrX, TrY, h, mu, sigma, tau);
-      double diff_E_tau = E_wrt_tau(TrX, TrY, h, mu, sigma, tau);
-
       // Logging info to the terminal
       if (print_debug_ == 1 && iter_idx % info_iter_threshold == 0)
       {
@@ -780,6 +838,21 @@ namespace OpenMS
     }
   }
 
+  template <typename PeakContainerT>
+  void EmgGradientDescent::fitEMGPeakModelBatch(
+    const std::vector<PeakContainerT>& input_peaks,
+    std::vector<PeakContainerT>& output_peaks
+  ) const
+  {
+    output_peaks.resize(input_peaks.size());
+    // the individual fits are independent of each other
+    #pragma omp parallel for schedule(dynamic)
+    for (SignedSize i = 0; i < (SignedSize)input_peaks.size(); ++i)
+    {
+      fitEMGPeakModel(input_peaks[i], output_peaks[i]);
+    }
+  }
+
   template void OPENMS_DLLAPI EmgGradientDescent::fitEMGPeakModel<MSChromatogram>(
     const MSChromatogram& input_peak,
     MSChromatogram& output_peak,
@@ -793,4 +866,14 @@ namespace OpenMS
     const double left_pos,
     const double right_pos
   ) const;
+
+  template void OPENMS_DLLAPI EmgGradientDescent::fitEMGPeakModelBatch<MSChromatogram>(
+    const std::vector<MSChromatogram>& input_peaks,
+    std::vector<MSChromatogram>& output_peaks
+  ) const;
+
+  template void OPENMS_DLLAPI EmgGradientDescent::fitEMGPeakModelBatch<MSSpectrum>(
+    const std::vector<MSSpectrum>& input_peaks,
+    std::vector<MSSpectrum>& output_peaks
+  ) const;
 }
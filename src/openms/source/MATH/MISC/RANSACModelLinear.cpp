@@ -54,7 +54,8 @@ namespace OpenMS::Math
 
       for (DVecIt it = begin; it != end; ++it)
       {
-        rss += pow(it->second - (coefficients[0] + ( coefficients[1] * it->first)), 2);
+        const double diff = it->second - (coefficients[0] + (coefficients[1] * it->first));
+        rss += diff * diff;
       }
 
       return rss;
@@ -66,7 +67,8 @@ namespace OpenMS::Math
       //std::cerr << "\n\nRANSAC dists: ";
       for (DVecIt it = begin; it != end; ++it)
       {
-        double dist = pow(it->second - (coefficients[0] + ( coefficients[1] * it->first)), 2);
+        const double diff = it->second - (coefficients[0] + (coefficients[1] * it->first));
+        const double dist = diff * diff;
         //std::cerr << dist << ", ";
         if (dist < max_threshold)
         {
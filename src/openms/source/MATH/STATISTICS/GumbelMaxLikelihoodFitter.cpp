@@ -52,17 +52,18 @@ namespace OpenMS::Math
 
         int operator()(const Eigen::VectorXd &x, Eigen::VectorXd &fvec) const
         {
-          fvec(0) = 0.0;
           double sigma = fabs(x(1));
           double logsigma = log(sigma);
-          auto wit = m_weights.cbegin();
-          for (auto it = m_data.cbegin(); it != m_data.cend(); ++it, ++wit)
+          double mu = x(0);
+          double ll = 0.0;
+          // evaluated once per Levenberg-Marquardt iteration over all scores
+          #pragma omp parallel for reduction(+: ll)
+          for (SignedSize i = 0; i < (SignedSize)m_data.size(); ++i)
           {
-            double diff = (*it - x(0)) / sigma;
-            fvec(0) += *wit * (-logsigma - diff - exp(-diff));
+            double diff = (m_data[i] - mu) / sigma;
+            ll += m_weights[i] * (-logsigma - diff - exp(-diff));
           }
-          double foo = -fvec(0);
-          fvec(0) = foo;
+          fvec(0) = -ll;
           fvec(1) = 0.0;
           return 0;
         }
@@ -134,20 +134,18 @@ namespace OpenMS::Math
         //-------------------------------------------------------------
         // E-STEP (gauss)
         double newGaussMean = 0.0;
-        auto the_x = x_scores.cbegin();
-
-        for (auto incorrect = incorrect_posteriors.cbegin(); incorrect != incorrect_posteriors.cend(); ++incorrect, ++the_x)
+        #pragma omp parallel for reduction(+: newGaussMean)
+        for (SignedSize i = 0; i < (SignedSize)x_scores.size(); ++i)
         {
-          newGaussMean += (1.-*incorrect) * *the_x;
+          newGaussMean += (1. - incorrect_posteriors[i]) * x_scores[i];
         }
         newGaussMean /= sumCorrectPosteriors;
 
         double newGaussSigma = 0.0;
-        the_x = x_scores.cbegin();
-
-        for (auto incorrect = incorrect_posteriors.cbegin(); incorrect != incorrect_posteriors.cend(); ++incorrect, ++the_x)
+        #pragma omp parallel for reduction(+: newGaussSigma)
+        for (SignedSize i = 0; i < (SignedSize)x_scores.size(); ++i)
         {
-          newGaussSigma += (1. - *incorrect) * pow((*the_x) - newGaussMean, 2);
+          newGaussSigma += (1. - incorrect_posteriors[i]) * pow(x_scores[i] - newGaussMean, 2);
         }
         newGaussSigma = sqrt(newGaussSigma/sumCorrectPosteriors);
 
@@ -442,15 +440,12 @@ namespace OpenMS::Math
         incorrect_density.resize(x_scores.size());
         correct_density.resize(x_scores.size());
       }
-      auto incorrect(incorrect_density.begin());
-      auto correct(correct_density.begin());
-      for (double const & score : x_scores)
+      // TODO: incorrect is currently filled with gauss as fitting gumble is not supported
+      #pragma omp parallel for
+      for (SignedSize i = 0; i < (SignedSize)x_scores.size(); ++i)
       {
-        // TODO: incorrect is currently filled with gauss as fitting gumble is not supported
-        *incorrect = incorrectly_assigned_fit_param_.eval(score);
-        *correct = correctly_assigned_fit_param_.eval(score);
-        ++incorrect;
-        ++correct;
+        incorrect_density[i] = incorrectly_assigned_fit_param_.eval(x_scores[i]);
+        correct_density[i] = correctly_assigned_fit_param_.eval(x_scores[i]);
       }
     }
 
@@ -461,14 +456,11 @@ namespace OpenMS::Math
         incorrect_density.resize(x_scores.size());
         correct_density.resize(x_scores.size());
       }
-      auto incorrect(incorrect_density.begin());
-      auto correct(correct_density.begin());
-      for (double const & score : x_scores)
+      #pragma omp parallel for
+      for (SignedSize i = 0; i < (SignedSize)x_scores.size(); ++i)
       {
-        *incorrect = incorrectly_assigned_fit_gumbel_param_.log_eval_no_normalize(score);
-        *correct = correctly_assigned_fit_param_.log_eval_no_normalize(score);
-        ++incorrect;
-        ++correct;
+        incorrect_density[i] = incorrectly_assigned_fit_gumbel_param_.log_eval_no_normalize(x_scores[i]);
+        correct_density[i] = correctly_assigned_fit_param_.log_eval_no_normalize(x_scores[i]);
       }
     }
 
@@ -479,25 +471,22 @@ namespace OpenMS::Math
         incorrect_density.resize(x_scores.size());
         correct_density.resize(x_scores.size());
       }
-      auto incorrect(incorrect_density.begin());
-      auto correct(correct_density.begin());
-      for (double const & score : x_scores)
+      // TODO: incorrect is currently filled with gauss as fitting gumble is not supported
+      #pragma omp parallel for
+      for (SignedSize i = 0; i < (SignedSize)x_scores.size(); ++i)
       {
-        // TODO: incorrect is currently filled with gauss as fitting gumble is not supported
-        *incorrect = incorrectly_assigned_fit_param_.log_eval_no_normalize(score);
-        *correct = correctly_assigned_fit_param_.log_eval_no_normalize(score);
-        ++incorrect;
-        ++correct;
+        incorrect_density[i] = incorrectly_assigned_fit_param_.log_eval_no_normalize(x_scores[i]);
+        correct_density[i] = correctly_assigned_fit_param_.log_eval_no_normalize(x_scores[i]);
       }
     }
 
     double PosteriorErrorProbabilityModel::computeLogLikelihood(const vector<double>& incorrect_density, const vector<double>& correct_density) const
     {
       double maxlike(0);
-      auto incorrect = incorrect_density.cbegin();
-      for (auto correct = correct_density.cbegin(); correct < correct_density.cend(); ++correct, ++incorrect)
+      #pragma omp parallel for reduction(+: maxlike)
+      for (SignedSize i = 0; i < (SignedSize)correct_density.size(); ++i)
       {
-        maxlike += log10(negative_prior_ * (*incorrect) + (1 - negative_prior_) * (*correct));
+        maxlike += log10(negative_prior_ * incorrect_density[i] + (1 - negative_prior_) * correct_density[i]);
       }
       return maxlike;
     }
@@ -509,17 +498,16 @@ namespace OpenMS::Math
       double loglikelihood = 0.0;
       double log_prior_pos = log(1. - negative_prior_);
       double log_prior_neg = log(negative_prior_);
-      auto incorrect = incorrect_log_density.cbegin();
       if (incorrect_posterior.size() != incorrect_log_density.size())
       {
         incorrect_posterior.resize(incorrect_log_density.size());
       }
-      auto incorrect_posterior_it = incorrect_posterior.begin();
 
-      for (auto correct = correct_log_density.cbegin(); correct < correct_log_density.cend(); ++correct, ++incorrect, ++incorrect_posterior_it)
+      #pragma omp parallel for reduction(+: loglikelihood)
+      for (SignedSize i = 0; i < (SignedSize)correct_log_density.size(); ++i)
       {
-        double log_resp_correct = log_prior_pos + *correct;
-        double log_resp_incorrect = log_prior_neg + *incorrect;
+        double log_resp_correct = log_prior_pos + correct_log_density[i];
+        double log_resp_incorrect = log_prior_neg + incorrect_log_density[i];
         double max_log_resp = std::max(log_resp_correct,log_resp_incorrect);
         log_resp_correct -= max_log_resp;
         log_resp_incorrect -= max_log_resp;
@@ -527,7 +515,7 @@ namespace OpenMS::Math
         double resp_incorrect = exp(log_resp_incorrect);
         double sum = resp_correct + resp_incorrect;
         // normalize
-        *incorrect_posterior_it = resp_incorrect / sum; //TODO can we somehow stay in log space (i.e. fill as log posteriors?)
+        incorrect_posterior[i] = resp_incorrect / sum; //TODO can we somehow stay in log space (i.e. fill as log posteriors?)
         loglikelihood += max_log_resp + log(sum);
       }
       return loglikelihood;
@@ -537,12 +525,12 @@ namespace OpenMS::Math
     {
       double pos_x0(0);
       double neg_x0(0);
-      auto the_x = x_scores.cbegin();
 
-      for (auto incorrect = incorrect_posteriors.cbegin(); incorrect < incorrect_posteriors.end(); ++incorrect, ++the_x)
+      #pragma omp parallel for reduction(+: pos_x0, neg_x0)
+      for (SignedSize i = 0; i < (SignedSize)incorrect_posteriors.size(); ++i)
       {
-        pos_x0 += (1. - *incorrect) * (*the_x);
-        neg_x0 += (*incorrect) * (*the_x);
+        pos_x0 += (1. - incorrect_posteriors[i]) * x_scores[i];
+        neg_x0 += incorrect_posteriors[i] * x_scores[i];
       }
       return {pos_x0,neg_x0};
     }
@@ -556,12 +544,12 @@ namespace OpenMS::Math
     {
       double pos_sigma(0);
       double neg_sigma(0);
-      auto the_x = x_scores.cbegin();
 
-      for (auto incorrect = incorrect_posteriors.cbegin(); incorrect < incorrect_posteriors.end(); ++incorrect, ++the_x)
+      #pragma omp parallel for reduction(+: pos_sigma, neg_sigma)
+      for (SignedSize i = 0; i < (SignedSize)incorrect_posteriors.size(); ++i)
       {
-        pos_sigma += (1. - *incorrect) * pow((*the_x) - pos_neg_mean.first, 2);
-        neg_sigma += (*incorrect) * pow((*the_x) - pos_neg_mean.second, 2);
+        pos_sigma += (1. - incorrect_posteriors[i]) * pow(x_scores[i] - pos_neg_mean.first, 2);
+        neg_sigma += incorrect_posteriors[i] * pow(x_scores[i] - pos_neg_mean.second, 2);
       }
       return {pos_sigma, neg_sigma};
     }
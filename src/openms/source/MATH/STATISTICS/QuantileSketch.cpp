@@ -0,0 +1,192 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/MATH/STATISTICS/QuantileSketch.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace OpenMS
+{
+  namespace Math
+  {
+
+    QuantileSketch::QuantileSketch(Size k) :
+      k_(std::max(k, Size(4))),
+      levels_(1),
+      rng_(0x9e3779b9) // fixed seed: the same stream always yields the same summary
+    {
+      levels_[0].reserve(k_);
+    }
+
+    Size QuantileSketch::levelCapacity_(Size level) const
+    {
+      // the topmost level holds k_ items, lower (lighter) levels shrink
+      // geometrically, which bounds the total memory at O(k)
+      double capacity = k_ * std::pow(2.0 / 3.0, double(levels_.size() - 1 - level));
+      return std::max(Size(2), Size(std::ceil(capacity)));
+    }
+
+    void QuantileSketch::add(double value)
+    {
+      if (count_ == 0)
+      {
+        min_ = value;
+        max_ = value;
+      }
+      else
+      {
+        if (value < min_) min_ = value;
+        if (value > max_) max_ = value;
+      }
+      ++count_;
+
+      levels_[0].push_back(value);
+      if (levels_[0].size() > levelCapacity_(0))
+      {
+        compress_();
+      }
+    }
+
+    void QuantileSketch::compress_()
+    {
+      for (Size l = 0; l < levels_.size(); ++l)
+      {
+        if (levels_[l].size() <= levelCapacity_(l))
+        {
+          continue;
+        }
+
+        // promote every second item to the next level with doubled weight;
+        // the random start offset keeps the rank estimate unbiased
+        std::sort(levels_[l].begin(), levels_[l].end());
+        if (l + 1 == levels_.size())
+        {
+          levels_.emplace_back();
+        }
+        const Size offset = std::uniform_int_distribution<Size>(0, 1)(rng_);
+        for (Size i = offset; i < levels_[l].size(); i += 2)
+        {
+          levels_[l + 1].push_back(levels_[l][i]);
+        }
+        levels_[l].clear();
+      }
+    }
+
+    void QuantileSketch::collect_(std::vector<std::pair<double, UInt64>>& items) const
+    {
+      items.clear();
+      for (Size l = 0; l < levels_.size(); ++l)
+      {
+        const UInt64 weight = UInt64(1) << l;
+        for (double value : levels_[l])
+        {
+          items.emplace_back(value, weight);
+        }
+      }
+      std::sort(items.begin(), items.end());
+    }
+
+    double QuantileSketch::quantile(double phi) const
+    {
+      if (count_ == 0)
+      {
+        return 0.0;
+      }
+      if (phi <= 0.0)
+      {
+        return min_;
+      }
+      if (phi >= 1.0)
+      {
+        return max_;
+      }
+
+      std::vector<std::pair<double, UInt64>> items;
+      collect_(items);
+      UInt64 total_weight = 0;
+      for (const auto& item : items)
+      {
+        total_weight += item.second;
+      }
+
+      const double target = phi * double(total_weight);
+      double cumulative = 0.0;
+      for (const auto& item : items)
+      {
+        cumulative += double(item.second);
+        if (cumulative >= target)
+        {
+          return item.first;
+        }
+      }
+      return max_;
+    }
+
+    double QuantileSketch::cdf(double value) const
+    {
+      if (count_ == 0)
+      {
+        return 0.0;
+      }
+      if (value >= max_)
+      {
+        return 1.0;
+      }
+      if (value < min_)
+      {
+        return 0.0;
+      }
+
+      UInt64 total_weight = 0;
+      UInt64 below = 0;
+      for (Size l = 0; l < levels_.size(); ++l)
+      {
+        const UInt64 weight = UInt64(1) << l;
+        for (double item : levels_[l])
+        {
+          total_weight += weight;
+          if (item <= value)
+          {
+            below += weight;
+          }
+        }
+      }
+      return double(below) / double(total_weight);
+    }
+
+    void QuantileSketch::getCumulative(std::vector<double>& values, std::vector<double>& cumulative_fractions) const
+    {
+      values.clear();
+      cumulative_fractions.clear();
+      if (count_ == 0)
+      {
+        return;
+      }
+
+      std::vector<std::pair<double, UInt64>> items;
+      collect_(items);
+      UInt64 total_weight = 0;
+      for (const auto& item : items)
+      {
+        total_weight += item.second;
+      }
+
+      values.reserve(items.size());
+      cumulative_fractions.reserve(items.size());
+      UInt64 cumulative = 0;
+      for (const auto& item : items)
+      {
+        cumulative += item.second;
+        values.push_back(item.first);
+        cumulative_fractions.push_back(double(cumulative) / double(total_weight));
+      }
+    }
+
+  } // namespace Math
+} // namespace OpenMS
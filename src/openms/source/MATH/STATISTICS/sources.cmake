@@ -15,6 +15,7 @@ LinearRegression.cpp
 LinearRegressionWithoutIntercept.cpp
 PosteriorErrorProbabilityModel.cpp
 QuadraticRegression.cpp
+QuantileSketch.cpp
 ROCCurve.cpp
 )
 
@@ -396,6 +396,15 @@ namespace OpenMS
       const map<vector<String>, set<unsigned>>& rowContent2RowIdx = getConditionToSampleMapping();
 
       const map<pair<String, unsigned>, unsigned>& pathLab2Sample = getPathLabelToSampleMapping(false);
+
+      // invert once to sample -> [[foo.mzml, ch1],...] instead of scanning all
+      // (path, label) pairs for every sample of every condition
+      map<unsigned, vector<pair<String, unsigned>>> sample2PathLab;
+      for (const auto& pl2Sample : pathLab2Sample)
+      {
+        sample2PathLab[pl2Sample.second].emplace_back(pl2Sample.first);
+      }
+
       vector<vector<pair<String, unsigned>>> res{rowContent2RowIdx.size()};
       Size s(0);
       // ["wt","24h","10mg"] -> sample [1, 3]
@@ -404,15 +413,11 @@ namespace OpenMS
         // sample 1
         for (const auto& ri : rcri.second)
         {
-          // [foo.mzml, ch1] -> sample 1
-          for (const auto& pl2Sample : pathLab2Sample)
+          auto pls = sample2PathLab.find(ri);
+          if (pls != sample2PathLab.end())
           {
-            // sample 1 == sample 1
-            if (pl2Sample.second == ri)
-            {
-              // res[0] -> [[foo, 1],...]
-              res[s].emplace_back(pl2Sample.first);
-            }
+            // res[0] -> [[foo, 1],...]
+            res[s].insert(res[s].end(), pls->second.begin(), pls->second.end());
           }
         }
         ++s;
@@ -793,9 +793,9 @@ namespace OpenMS
       }
     }
     // sort the evidences:
-    vector<PeptideEvidence> evidences = hit.getPeptideEvidences();
+    PeptideHit::PeptideEvidences evidences = hit.getPeptideEvidences();
     sort(evidences.begin(), evidences.end());
-    hit.setPeptideEvidences(evidences);
+    hit.setPeptideEvidences(std::move(evidences));
   }
 
 
@@ -15,73 +15,20 @@ using namespace std;
 namespace OpenMS
 {
 
-  MetaInfoInterface::MetaInfoInterface() :
-    meta_(nullptr)
-  {
-  }
+  MetaInfoInterface::MetaInfoInterface() = default;
 
-  /// Copy constructor
-  MetaInfoInterface::MetaInfoInterface(const MetaInfoInterface& rhs) :
-    meta_(nullptr)
-  {
-    if (rhs.meta_ != nullptr)
-    {
-      meta_ = new MetaInfo(*(rhs.meta_));
-    }
-  }
+  /// Copy constructor (copy-on-write: shares the meta info until one side is modified)
+  MetaInfoInterface::MetaInfoInterface(const MetaInfoInterface& rhs) = default;
 
   /// Move constructor
-  MetaInfoInterface::MetaInfoInterface(MetaInfoInterface&& rhs) noexcept :
-    meta_(std::move(rhs.meta_))
-  {
-    // take ownership
-    rhs.meta_ = nullptr;
-  }
+  MetaInfoInterface::MetaInfoInterface(MetaInfoInterface&& rhs) noexcept = default;
 
-  MetaInfoInterface::~MetaInfoInterface()
-  {
-    delete(meta_);
-  }
+  MetaInfoInterface::~MetaInfoInterface() = default;
 
-  MetaInfoInterface& MetaInfoInterface::operator=(const MetaInfoInterface& rhs)
-  {
-    if (this == &rhs)
-    {
-      return *this;
-    }
-
-    if (rhs.meta_ != nullptr && meta_ != nullptr)
-    {
-      *meta_ = *(rhs.meta_);
-    }
-    else if (rhs.meta_ == nullptr && meta_ != nullptr)
-    {
-      delete(meta_);
-      meta_ = nullptr;
-    }
-    else if (rhs.meta_ != nullptr && meta_ == nullptr)
-    {
-      meta_ = new MetaInfo(*(rhs.meta_));
-    }
-
-    return *this;
-  }
+  MetaInfoInterface& MetaInfoInterface::operator=(const MetaInfoInterface& rhs) = default;
 
   // Move assignment
-  MetaInfoInterface& MetaInfoInterface::operator=(MetaInfoInterface&& rhs) noexcept
-  {
-    if (this == &rhs)
-    {
-      return *this;
-    }
-
-    // free memory and assign rhs memory
-    delete(meta_);
-    meta_ = rhs.meta_;
-    rhs.meta_ = nullptr;
-
-    return *this;
-  }
+  MetaInfoInterface& MetaInfoInterface::operator=(MetaInfoInterface&& rhs) noexcept = default;
 
   void MetaInfoInterface::swap(MetaInfoInterface& rhs)
   {
@@ -196,7 +143,11 @@ namespace OpenMS
   {
     if (meta_ == nullptr)
     {
-      meta_ = new MetaInfo();
+      meta_ = std::make_shared<MetaInfo>();
+    }
+    else if (meta_.use_count() > 1)
+    { // copy-on-write: detach from the copies sharing this meta info
+      meta_ = std::make_shared<MetaInfo>(*meta_);
     }
   }
 
@@ -227,14 +178,14 @@ namespace OpenMS
 
   void MetaInfoInterface::clearMetaInfo()
   {
-    delete meta_;
-    meta_ = nullptr;
+    meta_.reset();
   }
 
   void MetaInfoInterface::removeMetaValue(const String& name)
   {
     if (meta_ != nullptr)
     {
+      createIfNotExists_(); // detach if shared
       meta_->removeValue(name);
     }
   }
@@ -243,6 +194,7 @@ namespace OpenMS
   {
     if (meta_ != nullptr)
     {
+      createIfNotExists_(); // detach if shared
       meta_->removeValue(index);
     }
   }
@@ -210,26 +210,43 @@ namespace OpenMS
     charge_ = charge;
   }
 
-  const std::vector<PeptideEvidence>& PeptideHit::getPeptideEvidences() const
+  const PeptideHit::PeptideEvidences& PeptideHit::getPeptideEvidences() const
   {
     return peptide_evidences_;
   }
 
-  void PeptideHit::setPeptideEvidences(const std::vector<PeptideEvidence>& peptide_evidences)
+  void PeptideHit::setPeptideEvidences(const PeptideEvidences& peptide_evidences)
   {
     peptide_evidences_ = peptide_evidences;
   }
 
-  void PeptideHit::setPeptideEvidences(std::vector<PeptideEvidence>&& peptide_evidences)
+  void PeptideHit::setPeptideEvidences(PeptideEvidences&& peptide_evidences)
   {
     peptide_evidences_ = std::move(peptide_evidences);
   }
 
+  void PeptideHit::setPeptideEvidences(const std::vector<PeptideEvidence>& peptide_evidences)
+  {
+    peptide_evidences_.assign(peptide_evidences.begin(), peptide_evidences.end());
+  }
+
+  void PeptideHit::setPeptideEvidences(std::vector<PeptideEvidence>&& peptide_evidences)
+  {
+    peptide_evidences_.assign(std::make_move_iterator(peptide_evidences.begin()),
+                              std::make_move_iterator(peptide_evidences.end()));
+    peptide_evidences.clear();
+  }
+
   void PeptideHit::addPeptideEvidence(const PeptideEvidence& peptide_evidence)
   {
     peptide_evidences_.push_back(peptide_evidence);
   }
 
+  void PeptideHit::addPeptideEvidence(PeptideEvidence&& peptide_evidence)
+  {
+    peptide_evidences_.push_back(std::move(peptide_evidence));
+  }
+
   // sets the score of the peptide hit
   void PeptideHit::setScore(double score)
   {
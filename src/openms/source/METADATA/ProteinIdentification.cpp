@@ -616,7 +616,7 @@ namespace OpenMS
       const vector<PeptideHit>& peptide_hits = peptide_id.getHits();
       for (const auto & peptide_hit : peptide_hits)
       {
-        const std::vector<PeptideEvidence>& ph_evidences = peptide_hit.getPeptideEvidences();
+        const PeptideHit::PeptideEvidences& ph_evidences = peptide_hit.getPeptideEvidences();
         // matched proteins for hit
         for (const auto & evidence : ph_evidences)
         {
@@ -747,7 +747,7 @@ namespace OpenMS
       for (const auto & peptide_hit : peptide_hits)
       {
         const AASequence& aas = peptide_hit.getSequence();
-        const vector<PeptideEvidence>& ph_evidences = peptide_hit.getPeptideEvidences();
+        const PeptideHit::PeptideEvidences& ph_evidences = peptide_hit.getPeptideEvidences();
 
         // skip unmodified peptides
         if (aas.isModified())
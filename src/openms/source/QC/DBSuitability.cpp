@@ -363,9 +363,9 @@ namespace OpenMS
     PeptideIndexing indexer;
     FASTAContainer<TFI_Vector> proteins(fasta_data);
     OPENMS_LOG_DEBUG << "Running PeptideIndexer functionalities ..." << endl << endl;
-    OPENMS_LOG_INFO.remove(cout); // prevent indexer from writing statistic
+    OpenMS_Log_info.remove(cout); // prevent indexer from writing statistic
     PeptideIndexing::ExitCodes indexer_exit = indexer.run(proteins, prot_ids, pep_ids);
-    OPENMS_LOG_INFO.insert(cout); // revert logging change
+    OpenMS_Log_info.insert(cout); // revert logging change
     if (indexer_exit != PeptideIndexing::ExitCodes::EXECUTION_OK)
     {
       OPENMS_LOG_ERROR << "An error occured while trying to index the search results." << endl;
@@ -0,0 +1,228 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+
+#include <OpenMS/FORMAT/SqliteConnector.h>
+#include <OpenMS/KERNEL/MSExperiment.h>
+#include <OpenMS/QC/SpectrumMetricStore.h>
+#include <OpenMS/SYSTEM/File.h>
+
+#include <sqlite3.h>
+
+#include <sstream>
+
+using namespace std;
+
+namespace OpenMS
+{
+  namespace Sql = Internal::SqliteHelper;
+
+  namespace
+  {
+    /// escape single quotes for use inside an SQL string literal
+    String escapeSql(const String& s)
+    {
+      String result = s;
+      result.substitute("'", "''");
+      return result;
+    }
+
+    void createTables(SqliteConnector& conn)
+    {
+      conn.executeStatement("CREATE TABLE IF NOT EXISTS QC_RUN (" \
+                            "ID INTEGER PRIMARY KEY AUTOINCREMENT," \
+                            "FILENAME TEXT NOT NULL," \
+                            "FILEHASH TEXT UNIQUE NOT NULL)");
+      conn.executeStatement("CREATE TABLE IF NOT EXISTS QC_SPECTRUM (" \
+                            "RUN_ID INT NOT NULL," \
+                            "SCAN_INDEX INT NOT NULL," \
+                            "NATIVE_ID TEXT NOT NULL," \
+                            "MS_LEVEL INT NOT NULL," \
+                            "RT REAL NOT NULL," \
+                            "TIC REAL NOT NULL," \
+                            "BASE_PEAK_MZ REAL NOT NULL," \
+                            "BASE_PEAK_INTENSITY REAL NOT NULL," \
+                            "PEAK_COUNT INT NOT NULL)");
+      conn.executeStatement("CREATE INDEX IF NOT EXISTS QC_SPECTRUM_RUN_IDX ON QC_SPECTRUM (RUN_ID)");
+    }
+  } // namespace
+
+  bool SpectrumMetricStore::SpectrumMetrics::operator==(const SpectrumMetrics& rhs) const
+  {
+    return native_id == rhs.native_id && ms_level == rhs.ms_level && rt == rhs.rt && tic == rhs.tic && base_peak_mz == rhs.base_peak_mz &&
+           base_peak_intensity == rhs.base_peak_intensity && peak_count == rhs.peak_count;
+  }
+
+  void SpectrumMetricStore::addSpectrum(const MSSpectrum& spec)
+  {
+    SpectrumMetrics m;
+    m.native_id = spec.getNativeID();
+    m.ms_level = spec.getMSLevel();
+    m.rt = spec.getRT();
+    m.peak_count = spec.size();
+    for (const auto& peak : spec)
+    {
+      m.tic += peak.getIntensity();
+      if (peak.getIntensity() > m.base_peak_intensity)
+      {
+        m.base_peak_intensity = peak.getIntensity();
+        m.base_peak_mz = peak.getMZ();
+      }
+    }
+    metrics_.push_back(std::move(m));
+  }
+
+  std::function<void(MSSpectrum&)> SpectrumMetricStore::getSpectrumFunc()
+  {
+    return [this](MSSpectrum& spec) { addSpectrum(spec); };
+  }
+
+  void SpectrumMetricStore::compute(const MSExperiment& exp)
+  {
+    metrics_.reserve(metrics_.size() + exp.size());
+    for (const auto& spec : exp)
+    {
+      addSpectrum(spec);
+    }
+  }
+
+  const std::vector<SpectrumMetricStore::SpectrumMetrics>& SpectrumMetricStore::getResults() const
+  {
+    return metrics_;
+  }
+
+  void SpectrumMetricStore::clear()
+  {
+    metrics_.clear();
+  }
+
+  bool SpectrumMetricStore::contains(const String& db_filename, const String& file_hash)
+  {
+    if (!File::exists(db_filename))
+    {
+      return false;
+    }
+    SqliteConnector conn(db_filename, SqliteConnector::SqlOpenMode::READONLY);
+    if (!conn.tableExists("QC_RUN"))
+    {
+      return false;
+    }
+    sqlite3_stmt* stmt;
+    conn.prepareStatement(&stmt, "SELECT COUNT(*) FROM QC_RUN WHERE FILEHASH='" + escapeSql(file_hash) + "'");
+    Sql::nextRow(stmt);
+    const int count = Sql::extractInt(stmt, 0);
+    sqlite3_finalize(stmt);
+    return count > 0;
+  }
+
+  void SpectrumMetricStore::store(const String& db_filename, const String& raw_filename, const String& file_hash) const
+  {
+    SqliteConnector conn(db_filename, SqliteConnector::SqlOpenMode::READWRITE_OR_CREATE);
+    createTables(conn);
+
+    conn.executeStatement("BEGIN TRANSACTION");
+    // replace a previous run of the same raw file (idempotent re-run)
+    sqlite3_stmt* stmt;
+    conn.prepareStatement(&stmt, "SELECT ID FROM QC_RUN WHERE FILEHASH='" + escapeSql(file_hash) + "'");
+    if (Sql::nextRow(stmt) == Sql::SqlState::SQL_ROW)
+    {
+      const Int64 old_run_id = Sql::extractInt64(stmt, 0);
+      conn.executeStatement("DELETE FROM QC_SPECTRUM WHERE RUN_ID=" + String(old_run_id));
+      conn.executeStatement("DELETE FROM QC_RUN WHERE ID=" + String(old_run_id));
+    }
+    sqlite3_finalize(stmt);
+
+    conn.executeStatement("INSERT INTO QC_RUN (FILENAME, FILEHASH) VALUES ('" + escapeSql(raw_filename) + "','" + escapeSql(file_hash) + "')");
+    const Int64 run_id = sqlite3_last_insert_rowid(conn.getDB());
+
+    stringstream insert_sql;
+    Size batch_count = 0;
+    for (Size i = 0; i < metrics_.size(); ++i)
+    {
+      const SpectrumMetrics& m = metrics_[i];
+      if (batch_count == 0)
+      {
+        insert_sql << "INSERT INTO QC_SPECTRUM (RUN_ID, SCAN_INDEX, NATIVE_ID, MS_LEVEL, RT, TIC, BASE_PEAK_MZ, BASE_PEAK_INTENSITY, PEAK_COUNT) VALUES ";
+      }
+      else
+      {
+        insert_sql << ",";
+      }
+      insert_sql << "(" << run_id << "," << i << ",'" << escapeSql(m.native_id) << "'," << m.ms_level << "," << m.rt << "," << m.tic << "," << m.base_peak_mz << ","
+                 << m.base_peak_intensity << "," << m.peak_count << ")";
+      ++batch_count;
+      if (batch_count == 500) // keep single statements at a manageable size
+      {
+        insert_sql << ";";
+        conn.executeStatement(insert_sql.str());
+        insert_sql.str("");
+        batch_count = 0;
+      }
+    }
+    if (batch_count > 0)
+    {
+      insert_sql << ";";
+      conn.executeStatement(insert_sql.str());
+    }
+    conn.executeStatement("END TRANSACTION");
+  }
+
+  bool SpectrumMetricStore::load(const String& db_filename, const String& file_hash)
+  {
+    metrics_.clear();
+    if (!File::exists(db_filename))
+    {
+      return false;
+    }
+    SqliteConnector conn(db_filename, SqliteConnector::SqlOpenMode::READONLY);
+    if (!conn.tableExists("QC_RUN"))
+    {
+      return false;
+    }
+    sqlite3_stmt* stmt;
+    conn.prepareStatement(&stmt, "SELECT ID FROM QC_RUN WHERE FILEHASH='" + escapeSql(file_hash) + "'");
+    if (Sql::nextRow(stmt) != Sql::SqlState::SQL_ROW)
+    {
+      sqlite3_finalize(stmt);
+      return false;
+    }
+    const Int64 run_id = Sql::extractInt64(stmt, 0);
+    sqlite3_finalize(stmt);
+
+    conn.prepareStatement(&stmt, "SELECT NATIVE_ID, MS_LEVEL, RT, TIC, BASE_PEAK_MZ, BASE_PEAK_INTENSITY, PEAK_COUNT FROM QC_SPECTRUM WHERE RUN_ID=" + String(run_id) +
+                                   " ORDER BY SCAN_INDEX");
+    Sql::SqlState state = Sql::SqlState::SQL_ROW;
+    while ((state = Sql::nextRow(stmt, state)) == Sql::SqlState::SQL_ROW)
+    {
+      SpectrumMetrics m;
+      m.native_id = Sql::extractString(stmt, 0);
+      m.ms_level = Sql::extractInt(stmt, 1);
+      m.rt = Sql::extractDouble(stmt, 2);
+      m.tic = Sql::extractDouble(stmt, 3);
+      m.base_peak_mz = Sql::extractDouble(stmt, 4);
+      m.base_peak_intensity = Sql::extractDouble(stmt, 5);
+      m.peak_count = Sql::extractInt(stmt, 6);
+      metrics_.push_back(std::move(m));
+    }
+    sqlite3_finalize(stmt);
+    return true;
+  }
+
+  /// Returns the name of the metric
+  const String& SpectrumMetricStore::getName() const
+  {
+    return name_;
+  }
+
+  /// Returns required file input i.e. MzML.
+  /// This is encoded as a bit in a Status object.
+  QCBase::Status SpectrumMetricStore::requirements() const
+  {
+    return QCBase::Status(QCBase::Requires::RAWMZML);
+  }
+} // namespace OpenMS
@@ -20,6 +20,7 @@ set(sources_list
   QCBase.cpp
   RTAlignment.cpp
   SpectrumCount.cpp
+  SpectrumMetricStore.cpp
   DBSuitability.cpp
   TIC.cpp
 )
@@ -0,0 +1,178 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/SYSTEM/ExternalProcessPool.h>
+
+#include <OpenMS/CONCEPT/Exception.h>
+#include <OpenMS/SYSTEM/StopWatch.h>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QProcess>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+namespace OpenMS
+{
+
+  ExternalProcessPool::ExternalProcessPool(Size max_concurrent) :
+    max_concurrent_(max_concurrent)
+  {
+    if (max_concurrent == 0)
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+        "Pool needs at least one concurrent process");
+    }
+  }
+
+  void ExternalProcessPool::setCallbacks(std::function<void(Size, const String&)> callbackStdOut, std::function<void(Size, const String&)> callbackStdErr)
+  {
+    callbackStdOut_ = std::move(callbackStdOut);
+    callbackStdErr_ = std::move(callbackStdErr);
+  }
+
+  Size ExternalProcessPool::enqueue(const QString& exe, const QStringList& args, const QString& working_dir)
+  {
+    jobs_.push_back({exe, args, working_dir});
+    return jobs_.size() - 1;
+  }
+
+  const std::vector<ExternalProcessPool::JobResult>& ExternalProcessPool::runAll(bool verbose)
+  {
+    /// a running job: the child process, the index of its job and its running wall clock
+    struct ActiveJob
+    {
+      std::unique_ptr<QProcess> process;
+      Size job;
+      StopWatch timer;
+    };
+
+    results_.assign(jobs_.size(), JobResult());
+
+    // drain whatever the child has written so far into its per-job buffers
+    auto drain = [&](ActiveJob& active)
+    {
+      String out(QString(active.process->readAllStandardOutput()));
+      if (!out.empty())
+      {
+        results_[active.job].stdout_output += out;
+        if (callbackStdOut_) callbackStdOut_(active.job, out);
+      }
+      String err(QString(active.process->readAllStandardError()));
+      if (!err.empty())
+      {
+        results_[active.job].stderr_output += err;
+        if (callbackStdErr_) callbackStdErr_(active.job, err);
+      }
+    };
+
+    std::vector<ActiveJob> active_jobs;
+    Size next_job = 0;
+    while (next_job < jobs_.size() || !active_jobs.empty())
+    {
+      // fan out until the concurrency bound is reached
+      while (active_jobs.size() < max_concurrent_ && next_job < jobs_.size())
+      {
+        const PendingJob_& job = jobs_[next_job];
+        const Size job_index = next_job++;
+        if (verbose && callbackStdOut_)
+        {
+          callbackStdOut_(job_index, "Running: " + (QStringList() << job.exe << job.args).join(' ') + '\n');
+        }
+        ActiveJob active {std::make_unique<QProcess>(), job_index, StopWatch()};
+        if (!job.working_dir.isEmpty())
+        {
+          active.process->setWorkingDirectory(job.working_dir);
+        }
+        active.timer.start();
+        active.process->start(job.exe, job.args, QIODevice::ReadWrite);
+        if (!active.process->waitForStarted())
+        {
+          JobResult& res = results_[job_index];
+          res.state = ExternalProcess::RETURNSTATE::FAILED_TO_START;
+          res.error_msg = "Process '" + job.exe + "' failed to start. Does it exist? Is it executable?";
+          if (verbose && callbackStdErr_)
+          {
+            callbackStdErr_(job_index, res.error_msg + '\n');
+          }
+          continue;
+        }
+        active_jobs.push_back(std::move(active));
+      }
+      if (active_jobs.empty())
+      {
+        continue; // all remaining jobs failed to start
+      }
+
+      QCoreApplication::processEvents();
+      // small blocking wait on one child to avoid busy spinning (same granularity as ExternalProcess::run())
+      active_jobs.front().process->waitForReadyRead(50);
+      for (ActiveJob& active : active_jobs)
+      {
+        drain(active);
+      }
+
+      // collect finished children (in whatever order they exit; results stay in submission order)
+      for (auto it = active_jobs.begin(); it != active_jobs.end();)
+      {
+        if (it->process->state() != QProcess::NotRunning)
+        {
+          ++it;
+          continue;
+        }
+        it->timer.stop();
+        drain(*it); // pick up any output written right before the exit
+        JobResult& res = results_[it->job];
+        res.wall_time_sec = it->timer.getClockTime();
+        res.exit_code = it->process->exitCode();
+        if (it->process->exitStatus() != QProcess::NormalExit)
+        {
+          res.state = ExternalProcess::RETURNSTATE::CRASH;
+          res.error_msg = "Process '" + jobs_[it->job].exe + "' crashed hard (segfault-like). Please check the log.";
+        }
+        else if (it->process->exitCode() != 0)
+        {
+          res.state = ExternalProcess::RETURNSTATE::NONZERO_EXIT;
+          res.error_msg = "Process '" + jobs_[it->job].exe + "' did not finish successfully (exit code: " + String(res.exit_code).toQString() + "). Please check the log.";
+        }
+        else
+        {
+          res.state = ExternalProcess::RETURNSTATE::SUCCESS;
+        }
+        if (res.state != ExternalProcess::RETURNSTATE::SUCCESS && verbose && callbackStdErr_)
+        {
+          callbackStdErr_(it->job, res.error_msg + '\n');
+        }
+        it = active_jobs.erase(it);
+      }
+    }
+
+    return results_;
+  }
+
+  const std::vector<ExternalProcessPool::JobResult>& ExternalProcessPool::getResults() const
+  {
+    return results_;
+  }
+
+  bool ExternalProcessPool::allSucceeded() const
+  {
+    return std::all_of(results_.begin(), results_.end(), [](const JobResult& res)
+    {
+      return res.state == ExternalProcess::RETURNSTATE::SUCCESS;
+    });
+  }
+
+  void ExternalProcessPool::clear()
+  {
+    jobs_.clear();
+    results_.clear();
+  }
+
+} // namespace OpenMS
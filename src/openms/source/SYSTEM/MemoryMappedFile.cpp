@@ -0,0 +1,134 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/SYSTEM/MemoryMappedFile.h>
+
+#ifdef OPENMS_WINDOWSPLATFORM
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace OpenMS
+{
+namespace Internal
+{
+
+  MemoryMappedFile::MemoryMappedFile() = default;
+
+  MemoryMappedFile::~MemoryMappedFile()
+  {
+    close();
+  }
+
+#ifdef OPENMS_WINDOWSPLATFORM
+
+  bool MemoryMappedFile::open(const String& filename)
+  {
+    close();
+
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+      return false;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+    {
+      CloseHandle(file);
+      return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+      CloseHandle(file);
+      return false;
+    }
+
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+    {
+      CloseHandle(mapping);
+      CloseHandle(file);
+      return false;
+    }
+
+    data_ = static_cast<const char*>(view);
+    size_ = static_cast<std::size_t>(file_size.QuadPart);
+    file_handle_ = file;
+    mapping_handle_ = mapping;
+    return true;
+  }
+
+  void MemoryMappedFile::close()
+  {
+    if (data_ != nullptr)
+    {
+      UnmapViewOfFile(data_);
+      CloseHandle(mapping_handle_);
+      CloseHandle(file_handle_);
+      data_ = nullptr;
+      size_ = 0;
+      file_handle_ = nullptr;
+      mapping_handle_ = nullptr;
+    }
+  }
+
+#else
+
+  bool MemoryMappedFile::open(const String& filename)
+  {
+    close();
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+      return false;
+    }
+
+    struct stat file_info;
+    if (fstat(fd, &file_info) != 0 || file_info.st_size == 0)
+    {
+      ::close(fd);
+      return false;
+    }
+
+    void* addr = mmap(nullptr, static_cast<std::size_t>(file_info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping stays valid after closing the descriptor
+    ::close(fd);
+    if (addr == MAP_FAILED)
+    {
+      return false;
+    }
+
+    data_ = static_cast<const char*>(addr);
+    size_ = static_cast<std::size_t>(file_info.st_size);
+    return true;
+  }
+
+  void MemoryMappedFile::close()
+  {
+    if (data_ != nullptr)
+    {
+      munmap(const_cast<char*>(data_), size_);
+      data_ = nullptr;
+      size_ = 0;
+    }
+  }
+
+#endif
+
+} // namespace Internal
+} // namespace OpenMS
@@ -5,9 +5,11 @@ set(directory source/SYSTEM)
 set(sources_list
 BuildInfo.cpp
 ExternalProcess.cpp
+ExternalProcessPool.cpp
 File.cpp
 FileWatcher.cpp
 JavaInfo.cpp
+MemoryMappedFile.cpp
 NetworkGetRequest.cpp
 PythonInfo.cpp
 RWrapper.cpp
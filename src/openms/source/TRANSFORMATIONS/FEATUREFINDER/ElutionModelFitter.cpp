@@ -103,9 +103,12 @@ void ElutionModelFitter::fitAndValidateModel_(
   }
   catch (Exception::UnableToFit& except)
   {
-    OPENMS_LOG_ERROR << "Error fitting model to feature '"
-                     << feature.getUniqueId() << "': " << except.getName()
-                     << " - " << except.what() << endl;
+#pragma omp critical (LOG_ERROR_access)
+    {
+      OPENMS_LOG_ERROR << "Error fitting model to feature '"
+                       << feature.getUniqueId() << "': " << except.getName()
+                       << " - " << except.what() << endl;
+    }
     fit_success = false;
   }
 
@@ -189,124 +192,135 @@ void ElutionModelFitter::fitElutionModels(FeatureMap& features)
   double asym_limit = (asymmetric ?
                        double(param_.getValue("check:asymmetry")) : 0.0);
 
-  TraceFitter* fitter;
-  if (asymmetric)
-  {
-    fitter = new EGHTraceFitter();
-  }
-  else
-  {
-    fitter = new GaussTraceFitter();
-  }
-  if (weighted)
+  // validate the input up front - exceptions must not escape the parallel
+  // fitting loop below:
+  for (Feature& feat : features)
   {
-    Param params = fitter->getDefaults();
-    params.setValue("weighted", "true");
-    fitter->setParameters(params);
+    if (feat.getSubordinates().empty())
+    {
+      throw Exception::MissingInformation(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "No subordinate features for mass traces available.");
+    }
+    if (feat.getSubordinates()[0].getConvexHulls().empty())
+    {
+      throw Exception::MissingInformation(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "No hull points for mass trace in subordinate feature available.");
+    }
   }
 
-  // collect peaks that constitute mass traces:
+  // collect peaks that constitute mass traces and fit the models; the
+  // features are independent, so this runs in parallel
   //TODO make progress logger?
   OPENMS_LOG_DEBUG << "Fitting elution models to features:" << endl;
-  Size index = 0;
-  for (Feature& feat : features)
+#pragma omp parallel
   {
-    // OPENMS_LOG_DEBUG << String(feat->getMetaValue("PeptideRef")) << endl;
-    double region_start = double(feat.getMetaValue("leftWidth"));
-    double region_end = double(feat.getMetaValue("rightWidth"));
-
-    if (feat.getSubordinates().empty())
+    // per-thread fitter, so the solver workspace is allocated once per thread
+    // and reused across all features the thread processes
+    TraceFitter* fitter;
+    if (asymmetric)
     {
-      throw Exception::MissingInformation(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "No subordinate features for mass traces available.");
+      fitter = new EGHTraceFitter();
     }
-    const Feature& sub = feat.getSubordinates()[0];
-    if (sub.getConvexHulls().empty())
+    else
     {
-      throw Exception::MissingInformation(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "No hull points for mass trace in subordinate feature available.");
+      fitter = new GaussTraceFitter();
+    }
+    if (weighted)
+    {
+      Param params = fitter->getDefaults();
+      params.setValue("weighted", "true");
+      fitter->setParameters(params);
     }
 
-    vector<Peak1D> peaks;
-    // reserve space once, to avoid copying and invalidating pointers:
-    Size points_per_hull = sub.getConvexHulls()[0].getHullPoints().size();
-    peaks.reserve(feat.getSubordinates().size() * points_per_hull +
-                  (add_zeros > 0.0)); // don't forget additional zero point
-    MassTraces traces;
-    traces.max_trace = 0;
-    // need a mass trace for every transition, plus maybe one for add. zeros:
-    traces.reserve(feat.getSubordinates().size() + (add_zeros > 0.0));
-    for (Feature& sub : feat.getSubordinates())
+#pragma omp for schedule(dynamic)
+    for (SignedSize f = 0; f < (SignedSize)features.size(); ++f)
     {
-      MassTrace trace;
-      trace.peaks.reserve(points_per_hull);
-      const ConvexHull2D& hull = sub.getConvexHulls()[0];
-      for (ConvexHull2D::PointArrayTypeConstIterator point_it =
-             hull.getHullPoints().begin(); point_it !=
-             hull.getHullPoints().end(); ++point_it)
+      Feature& feat = features[f];
+      // OPENMS_LOG_DEBUG << String(feat->getMetaValue("PeptideRef")) << endl;
+      double region_start = double(feat.getMetaValue("leftWidth"));
+      double region_end = double(feat.getMetaValue("rightWidth"));
+
+      const Feature& sub = feat.getSubordinates()[0];
+
+      vector<Peak1D> peaks;
+      // reserve space once, to avoid copying and invalidating pointers:
+      Size points_per_hull = sub.getConvexHulls()[0].getHullPoints().size();
+      peaks.reserve(feat.getSubordinates().size() * points_per_hull +
+                    (add_zeros > 0.0)); // don't forget additional zero point
+      MassTraces traces;
+      traces.max_trace = 0;
+      // need a mass trace for every transition, plus maybe one for add. zeros:
+      traces.reserve(feat.getSubordinates().size() + (add_zeros > 0.0));
+      for (Feature& sub : feat.getSubordinates())
       {
-        double intensity = point_it->getY();
-        if (intensity > 0.0) // only use non-zero intensities for fitting
+        MassTrace trace;
+        trace.peaks.reserve(points_per_hull);
+        const ConvexHull2D& hull = sub.getConvexHulls()[0];
+        for (ConvexHull2D::PointArrayTypeConstIterator point_it =
+               hull.getHullPoints().begin(); point_it !=
+               hull.getHullPoints().end(); ++point_it)
         {
-          Peak1D peak;
-          peak.setMZ(sub.getMZ());
-          peak.setIntensity(intensity);
-          peaks.push_back(peak);
-          trace.peaks.emplace_back(point_it->getX(), &peaks.back());
+          double intensity = point_it->getY();
+          if (intensity > 0.0) // only use non-zero intensities for fitting
+          {
+            Peak1D peak;
+            peak.setMZ(sub.getMZ());
+            peak.setIntensity(intensity);
+            peaks.push_back(peak);
+            trace.peaks.emplace_back(point_it->getX(), &peaks.back());
+          }
         }
+        trace.updateMaximum();
+        if (trace.peaks.empty())
+        {
+          continue;
+        }
+        if (each_trace)
+        {
+          MassTraces temp;
+          trace.theoretical_int = 1.0;
+          temp.push_back(trace);
+          temp.max_trace = 0;
+          fitAndValidateModel_(fitter, temp, sub, region_start, region_end,
+                               asymmetric, area_limit, check_boundaries);
+        }
+        trace.theoretical_int = sub.getMetaValue("isotope_probability");
+        traces.push_back(trace);
       }
-      trace.updateMaximum();
-      if (trace.peaks.empty())
-      {
-        ++index;
-        continue;
-      }
-      if (each_trace)
+
+      // find the trace with maximal intensity:
+      Size max_trace = 0;
+      double max_intensity = 0;
+      for (Size i = 0; i < traces.size(); ++i)
       {
-        MassTraces temp;
-        trace.theoretical_int = 1.0;
-        temp.push_back(trace);
-        temp.max_trace = 0;
-        fitAndValidateModel_(fitter, temp, sub, region_start, region_end,
-                             asymmetric, area_limit, check_boundaries);
+        if (traces[i].max_peak->getIntensity() > max_intensity)
+        {
+          max_trace = i;
+          max_intensity = traces[i].max_peak->getIntensity();
+        }
       }
-      trace.theoretical_int = sub.getMetaValue("isotope_probability");
-      traces.push_back(trace);
-    }
+      traces.max_trace = max_trace;
+      traces.baseline = 0.0;
 
-    // find the trace with maximal intensity:
-    Size max_trace = 0;
-    double max_intensity = 0;
-    for (Size i = 0; i < traces.size(); ++i)
-    {
-      if (traces[i].max_peak->getIntensity() > max_intensity)
+      if (add_zeros > 0.0)
       {
-        max_trace = i;
-        max_intensity = traces[i].max_peak->getIntensity();
+        MassTrace trace;
+        trace.peaks.reserve(2);
+        trace.theoretical_int = add_zeros;
+        Peak1D peak;
+        peak.setMZ(feat.getSubordinates()[0].getMZ());
+        peak.setIntensity(0.0);
+        peaks.push_back(peak);
+        double offset = 0.2 * (region_start - region_end);
+        trace.peaks.emplace_back(region_start - offset, &peaks.back());
+        trace.peaks.emplace_back(region_end + offset, &peaks.back());
+        traces.push_back(trace);
       }
-    }
-    traces.max_trace = max_trace;
-    traces.baseline = 0.0;
 
-    if (add_zeros > 0.0)
-    {
-      MassTrace trace;
-      trace.peaks.reserve(2);
-      trace.theoretical_int = add_zeros;
-      Peak1D peak;
-      peak.setMZ(feat.getSubordinates()[0].getMZ());
-      peak.setIntensity(0.0);
-      peaks.push_back(peak);
-      double offset = 0.2 * (region_start - region_end);
-      trace.peaks.emplace_back(region_start - offset, &peaks.back());
-      trace.peaks.emplace_back(region_end + offset, &peaks.back());
-      traces.push_back(trace);
+      // fit the model:
+      fitAndValidateModel_(fitter, traces, feat, region_start, region_end,
+                           asymmetric, area_limit, check_boundaries);
     }
-
-    // fit the model:
-    fitAndValidateModel_(fitter, traces, feat, region_start, region_end,
-                         asymmetric, area_limit, check_boundaries);
-    ++index;
+    delete fitter;
   }
-  delete fitter;
 
   // check if fit worked for at least one feature
   bool has_valid_models{false};
@@ -404,7 +418,7 @@ void ElutionModelFitter::fitElutionModels(FeatureMap& features)
   Size model_successes = 0, model_failures = 0;
 
   for (FeatureMap::Iterator feat_it = features.begin();
-       feat_it != features.end(); ++feat_it, ++index)
+       feat_it != features.end(); ++feat_it)
   {
     feat_it->setMetaValue("raw_intensity", feat_it->getIntensity());
     if (String(feat_it->getMetaValue("model_status"))[0] != '0')
@@ -299,10 +299,14 @@ namespace OpenMS
     {
       Size end_iteration = map_.size() - std::min((Size)min_spectra_, map_.size());
       startProgress(min_spectra_, end_iteration, "Precalculating mass trace scores");
+      int trace_progress = (int)min_spectra_;
       // skip first and last scans since we cannot extend the mass traces there
-      for (Size s = min_spectra_; s < end_iteration; ++s)
+      // each iteration only writes to the float data arrays of its own spectrum
+      // (neighboring spectra are read-only), so spectra can be scored in parallel
+#pragma omp parallel for schedule(dynamic)
+      for (SignedSize s = (SignedSize)min_spectra_; s < (SignedSize)end_iteration; ++s)
       {
-        setProgress(s);
+        IF_MASTERTHREAD setProgress(trace_progress++);
         SpectrumType& spectrum = map_[s];
         //iterate over all peaks of the scan
         for (Size p = 0; p < spectrum.size(); ++p)
@@ -594,7 +598,17 @@ namespace OpenMS
       int gl_progress = 0;
       startProgress(0, seeds.size(), String("Extending seeds for charge ") + String(c));
 
-#pragma omp parallel for
+      // one reusable fitter per thread; constructing a DefaultParamHandler for
+      // every seed is measurably expensive
+#ifdef _OPENMP
+      std::vector<std::shared_ptr<TraceFitter>> thread_fitters(omp_get_max_threads());
+#else
+      std::vector<std::shared_ptr<TraceFitter>> thread_fitters(1);
+#endif
+
+      // seeds are sorted by descending intensity, so the amount of extension and
+      // fitting work per seed varies a lot; dynamic scheduling keeps threads busy
+#pragma omp parallel for schedule(dynamic)
       for (SignedSize i = 0; i < (SignedSize)seeds.size(); ++i)
       {
         //------------------------------------------------------------------
@@ -664,11 +678,23 @@ namespace OpenMS
 
         traces[traces.max_trace].updateMaximum();
 
-        //choose fitter
+        //choose fitter (reused across seeds of this thread)
         double egh_tau = 0.0;
-        std::shared_ptr<TraceFitter> fitter = chooseTraceFitter_(egh_tau);
+#ifdef _OPENMP
+        std::shared_ptr<TraceFitter>& fitter = thread_fitters[omp_get_thread_num()];
+#else
+        std::shared_ptr<TraceFitter>& fitter = thread_fitters[0];
+#endif
+        if (!fitter)
+        {
+          fitter = chooseTraceFitter_(egh_tau);
+          fitter->setParameters(trace_fitter_params);
+        }
+        if (std::dynamic_pointer_cast<EGHTraceFitter>(fitter))
+        {
+          egh_tau = -1.0;
+        }
 
-        fitter->setParameters(trace_fitter_params);
         fitter->fit(traces);
 
 #if 0
@@ -823,20 +849,11 @@ namespace OpenMS
       // features of seeds with higher intensities. Only if the seed is not
       // used in any feature with higher intensity, we can add it to the
       // features_ list.
-      std::vector<Size> seeds_contained;
+      std::set<Size> seeds_contained;
       for (auto& f : tmp_feature_map)
       {
         Size seed_nr = f.first;
-        bool is_used = false;
-        for (Size i : seeds_contained)
-        {
-          if (seed_nr == i)
-          {
-            is_used = true;
-            break;
-          }
-        }
-        if (!is_used)
+        if (seeds_contained.find(seed_nr) == seeds_contained.end())
         {
           ++feature_candidates;
 
@@ -845,11 +862,8 @@ namespace OpenMS
           ++feature_nr_global;
           features_->push_back(f.second);
 
-          std::vector<Size> curr_seed = seeds_in_features[seed_nr];
-          for (Size k : curr_seed)
-          {
-            seeds_contained.push_back(k);
-          }
+          const std::vector<Size>& curr_seed = seeds_in_features[seed_nr];
+          seeds_contained.insert(curr_seed.begin(), curr_seed.end());
         }
       }
 
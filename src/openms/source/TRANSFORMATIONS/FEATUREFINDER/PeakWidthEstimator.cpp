@@ -8,6 +8,11 @@
 
 #include <OpenMS/TRANSFORMATIONS/FEATUREFINDER/PeakWidthEstimator.h>
 
+#include <OpenMS/MATH/STATISTICS/QuantileSketch.h>
+
+#include <algorithm>
+#include <limits>
+
 namespace OpenMS
 {
 
@@ -42,6 +47,71 @@ namespace OpenMS
     }
   }
   
+  PeakWidthEstimator::PeakWidthEstimator(const PeakMap & exp_picked, const std::vector<std::vector<PeakPickerHiRes::PeakBoundary> > & boundaries, Size mz_buckets)
+  {
+    if (mz_buckets < 2)
+    {
+      mz_buckets = 2;
+    }
+
+    // first pass: determine the m/z range (no samples are materialized)
+    mz_min_ = std::numeric_limits<double>::max();
+    mz_max_ = -std::numeric_limits<double>::max();
+    PeakMap::ConstIterator it_rt;
+    std::vector<std::vector<PeakPickerHiRes::PeakBoundary> >::const_iterator it_rt_boundaries;
+    for (it_rt = exp_picked.begin(), it_rt_boundaries = boundaries.begin();
+         it_rt < exp_picked.end() && it_rt_boundaries < boundaries.end();
+         ++it_rt, ++it_rt_boundaries)
+    {
+      if (it_rt->empty()) continue;
+      mz_min_ = std::min(mz_min_, it_rt->front().getMZ());
+      mz_max_ = std::max(mz_max_, it_rt->back().getMZ());
+    }
+    if (mz_min_ > mz_max_)
+    {
+      throw Exception::UnableToFit(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "No peaks to estimate the peak width from.", "");
+    }
+
+    // second pass: collect one bounded-memory width sketch per m/z bucket
+    const double bucket_width = (mz_max_ - mz_min_) / mz_buckets;
+    std::vector<Math::QuantileSketch> width_sketches(mz_buckets);
+    std::vector<double> mz_sums(mz_buckets, 0.0);
+    for (it_rt = exp_picked.begin(), it_rt_boundaries = boundaries.begin();
+         it_rt < exp_picked.end() && it_rt_boundaries < boundaries.end();
+         ++it_rt, ++it_rt_boundaries)
+    {
+      MSSpectrum::ConstIterator it_mz;
+      std::vector<PeakPickerHiRes::PeakBoundary>::const_iterator it_mz_boundary;
+      for (it_mz = it_rt->begin(), it_mz_boundary = it_rt_boundaries->begin();
+           it_mz < it_rt->end() && it_mz_boundary < it_rt_boundaries->end();
+           ++it_mz, ++it_mz_boundary)
+      {
+        Size bucket = (bucket_width > 0.0) ? Size((it_mz->getMZ() - mz_min_) / bucket_width) : 0;
+        if (bucket >= mz_buckets) bucket = mz_buckets - 1; // mz == mz_max_
+        width_sketches[bucket].add((*it_mz_boundary).mz_max - (*it_mz_boundary).mz_min);
+        mz_sums[bucket] += it_mz->getMZ();
+      }
+    }
+
+    // fit the spline to the median width of each non-empty bucket
+    std::vector<double> peaks_mz;
+    std::vector<double> peaks_width;
+    for (Size b = 0; b < mz_buckets; ++b)
+    {
+      if (width_sketches[b].count() > 0)
+      {
+        peaks_mz.push_back(mz_sums[b] / width_sketches[b].count());
+        peaks_width.push_back(width_sketches[b].quantile(0.5));
+      }
+    }
+    bspline_ = new BSpline2d(peaks_mz, peaks_width, std::min(500.0, (mz_max_ - mz_min_)/2), BSpline2d::BC_ZERO_SECOND, 1);
+
+    if (!(*bspline_).ok())
+    {
+      throw Exception::UnableToFit(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "Unable to fit B-spline to data.", "");
+    }
+  }
+
   PeakWidthEstimator::~PeakWidthEstimator()
   {
     delete bspline_;
@@ -60,6 +60,32 @@ namespace OpenMS
 
   TraceFitter::~TraceFitter() = default;
 
+  std::vector<char> TraceFitter::fitBatch(std::vector<FeatureFinderAlgorithmPickedHelperStructs::MassTraces>& traces_vec,
+                                          std::vector<std::shared_ptr<TraceFitter>>& fitters)
+  {
+    if (traces_vec.size() != fitters.size())
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+        "Need exactly one fitter per set of mass traces");
+    }
+
+    std::vector<char> success(traces_vec.size(), 0);
+#pragma omp parallel for schedule(dynamic)
+    for (SignedSize i = 0; i < (SignedSize)traces_vec.size(); ++i)
+    {
+      try
+      {
+        fitters[i]->fit(traces_vec[i]);
+        success[i] = 1;
+      }
+      catch (Exception::UnableToFit&)
+      {
+        // reported via the flag; the fitter state is unspecified
+      }
+    }
+    return success;
+  }
+
   double TraceFitter::computeTheoretical(const FeatureFinderAlgorithmPickedHelperStructs::MassTrace& trace, Size k) const
   {
     double rt = trace.peaks[k].first;
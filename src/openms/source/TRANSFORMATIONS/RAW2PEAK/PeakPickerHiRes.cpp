@@ -9,6 +9,7 @@
 
 #include <OpenMS/TRANSFORMATIONS/RAW2PEAK/PeakPickerHiRes.h>
 
+#include <OpenMS/CONCEPT/TaskPool.h>
 #include <OpenMS/FILTERING/NOISEESTIMATION/SignalToNoiseEstimatorMedian.h>
 #include <OpenMS/KERNEL/OnDiscMSExperiment.h>
 #include <OpenMS/KERNEL/MSChromatogram.h>
@@ -455,11 +456,16 @@ namespace OpenMS
 
     if (input.getNrSpectra() > 0)
     {
-      for (Size scan_idx = 0; scan_idx != input.size(); ++scan_idx)
+      // pick the spectra in parallel; per-spectrum results are kept in
+      // scan order so the output and the boundary vectors stay deterministic
+      std::vector<std::vector<PeakBoundary> > boundaries_all(input.size());
+      std::vector<char> was_picked_all(input.size(), 0);
+      // TaskPool rethrows the first exception after the loop has joined and
+      // skips the remaining iterations once an error was encountered
+      TaskPool::parallelFor(0, (SignedSize)input.size(), 50, [&](SignedSize scan_idx)
       {
-        bool was_picked{false};
         // auto mode
-        if (ms_levels_.empty()) 
+        if (ms_levels_.empty())
         {
           SpectrumSettings::SpectrumType spectrum_type = input[scan_idx].getType(true); // uses meta-info and inspects data if needed
           if (spectrum_type == SpectrumSettings::CENTROID)
@@ -468,45 +474,56 @@ namespace OpenMS
           }
           else
           {
-            std::vector<PeakBoundary> boundaries_s; // peak boundaries of a single spectrum
-            pick(input[scan_idx], output[scan_idx], boundaries_s);
-            was_picked = true;
-            boundaries_spec.push_back(std::move(boundaries_s));
+            pick(input[scan_idx], output[scan_idx], boundaries_all[scan_idx]);
+            was_picked_all[scan_idx] = 1;
           }
         }
         // manual mode
-        else if (!ListUtils::contains(ms_levels_, input[scan_idx].getMSLevel())) 
+        else if (!ListUtils::contains(ms_levels_, input[scan_idx].getMSLevel()))
         {
           output[scan_idx] = input[scan_idx];
         }
         else
         {
-          std::vector<PeakBoundary> boundaries_s; // peak boundaries of a single spectrum
           SpectrumSettings::SpectrumType spectrum_type = input[scan_idx].getType(true); // uses meta-info and inspects data if needed
           if (spectrum_type == SpectrumSettings::CENTROID && check_spectrum_type)
           {
             throw OpenMS::Exception::IllegalArgument(__FILE__, __LINE__, __FUNCTION__, "Error: Centroided data provided but profile spectra expected.");
           }
 
-          pick(input[scan_idx], output[scan_idx], boundaries_s);
-          was_picked = true;
-          boundaries_spec.push_back(std::move(boundaries_s));
+          pick(input[scan_idx], output[scan_idx], boundaries_all[scan_idx]);
+          was_picked_all[scan_idx] = 1;
+        }
+      });
+
+      // collect statistics and boundaries in scan order
+      for (Size scan_idx = 0; scan_idx != input.size(); ++scan_idx)
+      {
+        if (was_picked_all[scan_idx])
+        {
+          boundaries_spec.push_back(std::move(boundaries_all[scan_idx]));
         }
-        pick_info[input[scan_idx].getMSLevel()].picked += was_picked;
+        pick_info[input[scan_idx].getMSLevel()].picked += was_picked_all[scan_idx];
         ++pick_info[input[scan_idx].getMSLevel()].total;
         setProgress(++progress);
       }
     }
 
 
-    for (Size i = 0; i < input.getChromatograms().size(); ++i)
+    if (!input.getChromatograms().empty())
     {
-      MSChromatogram chromatogram;
-      std::vector<PeakBoundary> boundaries_c; // peak boundaries of a single chromatogram
-      pick(input.getChromatograms()[i], chromatogram, boundaries_c);
-      output.addChromatogram(chromatogram);
-      boundaries_chrom.push_back(boundaries_c);
-      setProgress(++progress);
+      std::vector<MSChromatogram> picked_chroms(input.getChromatograms().size());
+      std::vector<std::vector<PeakBoundary> > boundaries_all(input.getChromatograms().size());
+      TaskPool::parallelFor(0, (SignedSize)input.getChromatograms().size(), 50, [&](SignedSize i)
+      {
+        pick(input.getChromatograms()[i], picked_chroms[i], boundaries_all[i]);
+      });
+      for (Size i = 0; i < picked_chroms.size(); ++i)
+      {
+        output.addChromatogram(std::move(picked_chroms[i]));
+        boundaries_chrom.push_back(std::move(boundaries_all[i]));
+        setProgress(++progress);
+      }
     }
     endProgress();
 
@@ -535,31 +552,33 @@ namespace OpenMS
 
     if (input.getNrSpectra() > 0)
     {
+      // decode each scan only once and overlap decoding of the next scan with picking the current one
+      input.setReadAhead(true);
       for (Size scan_idx = 0; scan_idx != input.size(); ++scan_idx)
       {
+        MSSpectrum s = input[scan_idx];
         if (ms_levels_.empty()) //auto mode
         {
-          MSSpectrum s = input[scan_idx];
-          s.sortByPosition();
+          MSSpectrum sorted(s);
+          sorted.sortByPosition();
 
           // determine type of spectral data (profile or centroided)
-          SpectrumSettings::SpectrumType spectrumType = s.getType();
+          SpectrumSettings::SpectrumType spectrumType = sorted.getType();
           if (spectrumType == SpectrumSettings::CENTROID)
           {
-            output[scan_idx] = input[scan_idx];
+            output[scan_idx] = std::move(s);
           }
           else
           {
-            pick(s, output[scan_idx]);
+            pick(sorted, output[scan_idx]);
           }
         }
-        else if (!ListUtils::contains(ms_levels_, input[scan_idx].getMSLevel())) // manual mode
+        else if (!ListUtils::contains(ms_levels_, s.getMSLevel())) // manual mode
         {
-          output[scan_idx] = input[scan_idx];
+          output[scan_idx] = std::move(s);
         }
         else
         {
-          MSSpectrum s = input[scan_idx];
           s.sortByPosition();
 
           // determine type of spectral data (profile or centroided)
@@ -574,6 +593,7 @@ namespace OpenMS
         }
         setProgress(++progress);
       }
+      input.setReadAhead(false);
     }
 
     for (Size i = 0; i < input.getNrChromatograms(); ++i)
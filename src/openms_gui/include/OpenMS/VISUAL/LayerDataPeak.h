@@ -19,6 +19,7 @@
 namespace OpenMS
 {
   class Annotation1DItem;
+  class Plot2DIntensityPyramid;
 
   /**
   @brief Class that stores the data for one layer of type PeakMap
@@ -54,6 +55,7 @@ namespace OpenMS
     void updateRanges() override
     {
       peak_map_->updateRanges();
+      intensity_pyramid_.reset(); // derived from the peak data, so it is stale now
       // on_disc_peaks_->updateRanges(); // note: this is not going to work since its on disk! We currently don't have a good way to access these ranges
     }
 
@@ -118,8 +120,18 @@ namespace OpenMS
     void setPeakData(ExperimentSharedPtrType p)
     {
       peak_map_ = p;
+      intensity_pyramid_.reset();
     }
 
+    /**
+    @brief Returns the multi-resolution maximum-intensity cache of the peak data, building it on first use
+
+    Used by Painter2DPeak to sample overview renderings instead of re-binning all
+    peaks on every zoom/pan. The cache is invalidated when the peak data changes
+    (see setPeakData() and updateRanges()).
+    */
+    const Plot2DIntensityPyramid& getIntensityPyramid() const;
+
     /// Set the current on-disc data
     void setOnDiscPeakData(ODExperimentSharedPtrType p)
     {
@@ -192,6 +204,9 @@ namespace OpenMS
 
     /// on disc peak data
     ODExperimentSharedPtrType on_disc_peaks_ = ODExperimentSharedPtrType(new OnDiscMSExperiment());
+
+    /// lazily built maximum-intensity cache for 2D overview rendering (shared_ptr, so layer copies share it)
+    mutable std::shared_ptr<Plot2DIntensityPyramid> intensity_pyramid_;
   };
 
 }// namespace OpenMS
@@ -0,0 +1,92 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#pragma once
+
+#include <OpenMS/VISUAL/OpenMS_GUIConfig.h>
+
+#include <OpenMS/CONCEPT/Types.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+  class MSExperiment;
+
+  /**
+    @brief Multi-resolution maximum-intensity cache of a peak map for 2D overview rendering
+
+    Stores the MS1 peaks of an experiment as a pyramid of regular grids over the
+    scan dimension (RT, or ion mobility for IM frames) and m/z, where each cell holds
+    the maximum intensity of the peaks it covers. Every level above the base halves
+    the resolution of the one below it (a max-intensity mipmap).
+
+    Painting an overview of the map then samples the level matching the current
+    pixel size instead of re-binning all peaks, so zoom/pan latency depends on the
+    number of pixels rather than the number of peaks. The pyramid is built in one
+    pass over the peak data and is read-only afterwards.
+
+    The cache answers window maxima only down to its base resolution (see
+    coversStepSize()); when zoomed in further, rendering has to fall back to the
+    peak data itself - which is cheap at that point, since only few peaks are visible.
+
+    @note Peak intensities are assumed to be non-negative (negative intensities are
+          indistinguishable from empty cells).
+  */
+  class OPENMS_GUI_DLLAPI Plot2DIntensityPyramid
+  {
+  public:
+    /**
+      @brief Builds the pyramid from the MS1 peaks of @p map (replacing any previous content)
+
+      @param map The experiment; its ranges must be up to date (see MSExperiment::updateRanges())
+      @param use_mobility Bin spectra by drift time instead of RT (for IM frames)
+      @param base_bins_scan Number of scan (RT or IM) bins of the base level (capped to the number of MS1 scans)
+      @param base_bins_mz Number of m/z bins of the base level
+    */
+    void build(const MSExperiment& map, bool use_mobility, Size base_bins_scan = 2048, Size base_bins_mz = 2048);
+
+    /// Does the pyramid contain any data?
+    bool empty() const
+    {
+      return levels_.empty();
+    }
+
+    /// Was the pyramid built over ion mobility (instead of RT) as scan dimension?
+    bool usesMobility() const
+    {
+      return use_mobility_;
+    }
+
+    /// True if windows of the given extents (in data units) are no finer than the base
+    /// resolution, i.e. sampleMax() is a faithful replacement for scanning the peaks
+    bool coversStepSize(double scan_step_size, double mz_step_size) const;
+
+    /// Maximum intensity over the window [scan_start, scan_end) x [mz_start, mz_end),
+    /// sampled from the coarsest level whose cells still fit into the window; -1 if the
+    /// window contains no peak
+    float sampleMax(double scan_start, double scan_end, double mz_start, double mz_end) const;
+
+  private:
+    /// One resolution level; cells store the maximum intensity (-1 for empty cells) in row-major scan x m/z order
+    struct Level
+    {
+      Size rows = 0; ///< number of scan (RT or IM) bins
+      Size cols = 0; ///< number of m/z bins
+      double scan_step = 0.0; ///< extent of one cell in the scan dimension
+      double mz_step = 0.0; ///< extent of one cell in m/z
+      std::vector<float> max_intensity;
+    };
+
+    std::vector<Level> levels_; ///< levels_[0] is the base (finest) level
+    double scan_min_ = 0.0; ///< lower edge of the grids in the scan dimension
+    double mz_min_ = 0.0; ///< lower edge of the grids in m/z
+    bool use_mobility_ = false;
+  };
+
+} // namespace OpenMS
@@ -41,6 +41,7 @@ ParamEditor.h
 Plot1DCanvas.h
 Plot1DWidget.h
 Plot2DCanvas.h
+Plot2DIntensityPyramid.h
 Plot2DWidget.h
 Plot3DCanvas.h
 Plot3DOpenGLCanvas.h
@@ -15,6 +15,7 @@
 #include <OpenMS/VISUAL/LayerData1DChrom.h>
 #include <OpenMS/VISUAL/LayerData1DPeak.h>
 #include <OpenMS/VISUAL/Painter2DBase.h>
+#include <OpenMS/VISUAL/Plot2DIntensityPyramid.h>
 #include <OpenMS/VISUAL/VISITORS/LayerStatistics.h>
 #include <OpenMS/VISUAL/VISITORS/LayerStoreData.h>
 
@@ -39,6 +40,16 @@ namespace OpenMS
     return make_unique<Painter2DPeak>(this);
   }
 
+  const Plot2DIntensityPyramid& LayerDataPeak::getIntensityPyramid() const
+  {
+    if (!intensity_pyramid_)
+    {
+      intensity_pyramid_ = make_shared<Plot2DIntensityPyramid>();
+      intensity_pyramid_->build(*peak_map_, peak_map_->isIMFrame());
+    }
+    return *intensity_pyramid_;
+  }
+
   std::unique_ptr<LayerData1DBase> LayerDataPeak::to1DLayer() const
   {
     return make_unique<LayerData1DPeak>(*this);
@@ -20,6 +20,7 @@
 #include <OpenMS/VISUAL/LayerDataPeak.h>
 
 #include <OpenMS/VISUAL/Plot2DCanvas.h>
+#include <OpenMS/VISUAL/Plot2DIntensityPyramid.h>
 
 #include <QColor>
 #include <QPainter>
@@ -348,6 +349,38 @@ namespace OpenMS
       double rt_step_size = (rt_max - rt_min) / rt_pixel_count;
       double mz_step_size = (mz_max - mz_min) / mz_pixel_count;
 
+      // overview zoom levels: sample the precomputed maximum-intensity pyramid of the
+      // layer instead of re-binning all peaks, so latency depends on the pixel count,
+      // not the map size. Only usable without data filters (the pyramid ignores them)
+      // and down to its base resolution - beyond that the exact scan below is cheap anyway.
+      if (layer_->filters.size() == 0)
+      {
+        const auto& pyramid = layer_->getIntensityPyramid();
+        if (!pyramid.empty() && pyramid.usesMobility() == map.isIMFrame() && pyramid.coversStepSize(rt_step_size, mz_step_size))
+        {
+          for (Size rt = 0; rt < rt_pixel_count; ++rt)
+          {
+            double rt_start = rt_min + rt_step_size * rt;
+            double rt_end = rt_start + rt_step_size;
+            if (rt_end >= mapper.getMaximum())
+            {
+              break;
+            }
+            for (Size mz = 0; mz < mz_pixel_count; ++mz)
+            {
+              double mz_start = mz_min + mz_step_size * mz;
+              float max = pyramid.sampleMax(rt_start, rt_end, mz_start, mz_start + mz_step_size);
+              if (max >= 0.0)
+              {
+                QPoint pos = canvas->dataToWidget_(mapper.mapToPoint(rt_start + 0.5 * rt_step_size, mz_start + 0.5 * mz_step_size));
+                canvas->buffer_.setPixel(pos.x(), pos.y(), canvas->heightColor_(max, layer_->gradient, snap_factor).rgb());
+              }
+            }
+          }
+          return;
+        }
+      }
+
       // start at first visible RT scan
       Size scan_index = std::distance(map.begin(), mapper.getFirstScan(rt_min));
       vector<Size> scan_indices, peak_indices;
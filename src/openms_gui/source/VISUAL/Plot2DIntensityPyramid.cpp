@@ -0,0 +1,148 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/VISUAL/Plot2DIntensityPyramid.h>
+
+#include <OpenMS/KERNEL/MSExperiment.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace OpenMS
+{
+  void Plot2DIntensityPyramid::build(const MSExperiment& map, bool use_mobility, Size base_bins_scan, Size base_bins_mz)
+  {
+    levels_.clear();
+    use_mobility_ = use_mobility;
+
+    // count MS1 scans with peaks (the only data painted in the 2D view)
+    Size n_scans = 0;
+    for (const auto& spec : map)
+    {
+      if (spec.getMSLevel() == 1 && !spec.empty())
+      {
+        ++n_scans;
+      }
+    }
+    if (n_scans == 0)
+    {
+      return;
+    }
+
+    double scan_max;
+    if (use_mobility_)
+    {
+      scan_min_ = map.getMinMobility();
+      scan_max = map.getMaxMobility();
+    }
+    else
+    {
+      scan_min_ = map.getMinRT();
+      scan_max = map.getMaxRT();
+    }
+    mz_min_ = map.getMinMZ();
+    const double mz_max = map.getMaxMZ();
+
+    Level base;
+    base.rows = std::min(base_bins_scan, n_scans);
+    base.cols = (mz_max > mz_min_) ? base_bins_mz : 1;
+    // degenerate ranges (single scan / single m/z) collapse to one bin of arbitrary extent
+    base.scan_step = (scan_max > scan_min_) ? (scan_max - scan_min_) / base.rows : 1.0;
+    base.mz_step = (mz_max > mz_min_) ? (mz_max - mz_min_) / base.cols : 1.0;
+    base.max_intensity.assign(base.rows * base.cols, -1.0f);
+
+    for (const auto& spec : map)
+    {
+      if (spec.getMSLevel() != 1 || spec.empty())
+      {
+        continue;
+      }
+      const double scan_value = use_mobility_ ? spec.getDriftTime() : spec.getRT();
+      const Size row = std::min(base.rows - 1, (Size)std::max(0.0, (scan_value - scan_min_) / base.scan_step));
+      float* row_cells = &base.max_intensity[row * base.cols];
+      for (const auto& peak : spec)
+      {
+        const Size col = std::min(base.cols - 1, (Size)std::max(0.0, (peak.getMZ() - mz_min_) / base.mz_step));
+        row_cells[col] = std::max(row_cells[col], peak.getIntensity());
+      }
+    }
+    levels_.push_back(std::move(base));
+
+    // reduce 2x2 cell blocks to their maximum until the coarsest overview level is reached
+    while (levels_.back().rows > 64 || levels_.back().cols > 64)
+    {
+      Level next;
+      {
+        const Level& prev = levels_.back();
+        next.rows = (prev.rows + 1) / 2;
+        next.cols = (prev.cols + 1) / 2;
+        next.scan_step = prev.scan_step * 2;
+        next.mz_step = prev.mz_step * 2;
+        next.max_intensity.assign(next.rows * next.cols, -1.0f);
+        for (Size r = 0; r < prev.rows; ++r)
+        {
+          const float* prev_cells = &prev.max_intensity[r * prev.cols];
+          float* next_cells = &next.max_intensity[(r / 2) * next.cols];
+          for (Size c = 0; c < prev.cols; ++c)
+          {
+            next_cells[c / 2] = std::max(next_cells[c / 2], prev_cells[c]);
+          }
+        }
+      }
+      levels_.push_back(std::move(next));
+    }
+  }
+
+  bool Plot2DIntensityPyramid::coversStepSize(double scan_step_size, double mz_step_size) const
+  {
+    return !levels_.empty() && scan_step_size >= levels_[0].scan_step && mz_step_size >= levels_[0].mz_step;
+  }
+
+  float Plot2DIntensityPyramid::sampleMax(double scan_start, double scan_end, double mz_start, double mz_end) const
+  {
+    // pick the coarsest level whose cells still fit into the window, so only a handful of cells are touched
+    const Level* level = &levels_[0];
+    for (const Level& l : levels_)
+    {
+      if (l.scan_step > scan_end - scan_start || l.mz_step > mz_end - mz_start)
+      {
+        break;
+      }
+      level = &l;
+    }
+
+    const double row_hi = (scan_end - scan_min_) / level->scan_step;
+    const double col_hi = (mz_end - mz_min_) / level->mz_step;
+    if (row_hi <= 0.0 || col_hi <= 0.0)
+    {
+      return -1.0f;
+    }
+    const Size row_begin = (Size)std::max(0.0, std::floor((scan_start - scan_min_) / level->scan_step));
+    const Size col_begin = (Size)std::max(0.0, std::floor((mz_start - mz_min_) / level->mz_step));
+    if (row_begin >= level->rows || col_begin >= level->cols)
+    {
+      return -1.0f;
+    }
+    const Size row_end = std::min(level->rows - 1, (Size)row_hi);
+    const Size col_end = std::min(level->cols - 1, (Size)col_hi);
+
+    float max = -1.0f;
+    for (Size r = row_begin; r <= row_end; ++r)
+    {
+      const float* cells = &level->max_intensity[r * level->cols];
+      for (Size c = col_begin; c <= col_end; ++c)
+      {
+        max = std::max(max, cells[c]);
+      }
+    }
+    return max;
+  }
+
+} // namespace OpenMS
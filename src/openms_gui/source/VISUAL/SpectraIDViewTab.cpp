@@ -171,7 +171,7 @@ namespace OpenMS
             //add id_accession as the key of the map and push the peptideID to the vector value-
             for (const auto & pep_hit : pep_hits)
             {
-              const vector<PeptideEvidence>& evidences = pep_hit.getPeptideEvidences();
+              const PeptideHit::PeptideEvidences& evidences = pep_hit.getPeptideEvidences();
 
               for (const auto & evidence : evidences)
               {
@@ -305,7 +305,7 @@ namespace OpenMS
           // or we generally should only look at the first hit
           for (const auto & pep_hit : pep_hits)
           {
-            const vector<PeptideEvidence>& evidences = pep_hit.getPeptideEvidences();
+            const PeptideHit::PeptideEvidences& evidences = pep_hit.getPeptideEvidences();
             const AASequence& aaseq = pep_hit.getSequence();
             const auto qstrseq = aaseq.toString().toQString();
 
@@ -47,6 +47,7 @@ ParamEditor.ui
 Plot1DCanvas.cpp
 Plot1DWidget.cpp
 Plot2DCanvas.cpp
+Plot2DIntensityPyramid.cpp
 Plot2DWidget.cpp
 Plot3DCanvas.cpp
 Plot3DOpenGLCanvas.cpp
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <numeric>
 #include <map>
 #include <vector>
@@ -105,18 +106,29 @@ public:
 
     /// Calculate crosscorrelation on std::vector data that is already normalized
     OPENSWATHALGO_DLLAPI XCorrArrayType normalizedCrossCorrelationPost(std::vector<double>& normalized_data1,
-                                                                       std::vector<double>& normalized_data2, const int maxdelay, const int lag);                                                                   
+                                                                       std::vector<double>& normalized_data2, const int maxdelay, const int lag);
+
+    /// Calculate crosscorrelation on contiguous, already normalized data of length @p n (e.g. rows of a packed intensity matrix)
+    OPENSWATHALGO_DLLAPI XCorrArrayType normalizedCrossCorrelationPost(const double* normalized_data1,
+                                                                       const double* normalized_data2, const std::size_t n, const int maxdelay, const int lag);
 
     /// Calculate crosscorrelation on std::vector data without normalization
     OPENSWATHALGO_DLLAPI XCorrArrayType calculateCrossCorrelation(const std::vector<double>& data1,
                                                                   const std::vector<double>& data2, const int maxdelay, const int lag);
 
+    /// Calculate crosscorrelation on contiguous data of length @p n without normalization
+    OPENSWATHALGO_DLLAPI XCorrArrayType calculateCrossCorrelation(const double* data1,
+                                                                  const double* data2, const std::size_t n, const int maxdelay, const int lag);
+
     /// Find best peak in an cross-correlation (highest apex)
     OPENSWATHALGO_DLLAPI XCorrArrayType::const_iterator xcorrArrayGetMaxPeak(const XCorrArrayType & array);
 
     /// Standardize a vector (subtract mean, divide by standard deviation)
     OPENSWATHALGO_DLLAPI void standardize_data(std::vector<double>& data);
 
+    /// Standardize contiguous data of length @p n (subtract mean, divide by standard deviation)
+    OPENSWATHALGO_DLLAPI void standardize_data(double* data, const std::size_t n);
+
     /// Divide each element of x by the sum of the vector
     OPENSWATHALGO_DLLAPI void normalize_sum(double x[], unsigned int n);
 
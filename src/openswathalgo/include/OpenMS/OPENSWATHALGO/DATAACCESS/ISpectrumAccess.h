@@ -52,6 +52,17 @@ public:
     /// Return pointer to a spectrum at the given id, the spectrum will be filtered by drift time
     SpectrumPtr getSpectrumById(int id, double drift_start, double drift_end );
 
+    /**
+      @brief Return a pointer to a spectrum at the given id, restricted to the m/z strip [mz_start, mz_end]
+
+      The result contains at least all peaks whose m/z lies inside the strip;
+      returning more data (up to the full spectrum, which is what the default
+      implementation does) is valid. Implementations backed by seekable
+      storage can override this to read and decode only the part of the data
+      overlapping the strip.
+    */
+    virtual SpectrumPtr getSpectrumMzSliceById(int id, double mz_start, double mz_end);
+
     /// Return a vector of ids of spectra that are within RT +/- deltaRT
     virtual std::vector<std::size_t> getSpectraByRT(double RT, double deltaRT) const = 0;
     /// Returns the number of spectra available
@@ -101,19 +101,24 @@ namespace OpenSwath::Scoring
 
     void standardize_data(std::vector<double>& data)
     {
-      if (data.empty())
+      standardize_data(data.data(), data.size());
+    }
+
+    void standardize_data(double* data, const std::size_t n)
+    {
+      if (n == 0)
       {
 	      return;
       }
 
       // subtract the mean and divide by the standard deviation
-      double mean = std::accumulate(data.begin(), data.end(), 0.0) / (double) data.size();
+      double mean = std::accumulate(data, data + n, 0.0) / (double) n;
       double sqsum = 0;
-      for (std::vector<double>::iterator it = data.begin(); it != data.end(); ++it)
+      for (std::size_t i = 0; i < n; i++)
       {
-        sqsum += (*it - mean) * (*it - mean);
+        sqsum += (data[i] - mean) * (data[i] - mean);
       }
-      double stdev = sqrt(sqsum / data.size()); // standard deviation
+      double stdev = sqrt(sqsum / n); // standard deviation
 
       if (mean == 0 && stdev == 0)
       {
@@ -123,7 +128,7 @@ namespace OpenSwath::Scoring
       {
         stdev = 1; // all data is equal
       }
-      for (std::size_t i = 0; i < data.size(); i++)
+      for (std::size_t i = 0; i < n; i++)
       {
         data[i] = (data[i] - mean) / stdev;
       }
@@ -143,11 +148,19 @@ namespace OpenSwath::Scoring
     XCorrArrayType normalizedCrossCorrelationPost(std::vector<double>& normalized_data1,
                                                   std::vector<double>& normalized_data2, const int maxdelay, const int lag = 1)
     {
-      XCorrArrayType result = calculateCrossCorrelation(normalized_data1, normalized_data2, maxdelay, lag);
+      OPENSWATH_PRECONDITION(normalized_data1.size() == normalized_data2.size(), "Both data vectors need to have the same length");
+
+      return normalizedCrossCorrelationPost(normalized_data1.data(), normalized_data2.data(), normalized_data1.size(), maxdelay, lag);
+    }
+
+    XCorrArrayType normalizedCrossCorrelationPost(const double* normalized_data1,
+                                                  const double* normalized_data2, const std::size_t n, const int maxdelay, const int lag)
+    {
+      XCorrArrayType result = calculateCrossCorrelation(normalized_data1, normalized_data2, n, maxdelay, lag);
 
       for (XCorrArrayType::iterator it = result.begin(); it != result.end(); ++it)
       {
-        it->second /= normalized_data1.size();
+        it->second /= n;
       }
       return result;
     }
@@ -157,22 +170,27 @@ namespace OpenSwath::Scoring
     {
       OPENSWATH_PRECONDITION(data1.size() == data2.size(), "Both data vectors need to have the same length");
 
+      return calculateCrossCorrelation(data1.data(), data2.data(), data1.size(), maxdelay, lag);
+    }
+
+    XCorrArrayType calculateCrossCorrelation(const double* data1,
+                                             const double* data2, const std::size_t n, const int maxdelay, const int lag)
+    {
       XCorrArrayType result;
       result.data.reserve( (size_t)std::ceil((2*maxdelay + 1) / lag));
-      int datasize = static_cast<int>(data1.size());
-      int i, j, delay;
+      int datasize = static_cast<int>(n);
 
-      for (delay = -maxdelay; delay <= maxdelay; delay = delay + lag)
+      for (int delay = -maxdelay; delay <= maxdelay; delay = delay + lag)
       {
+        // restrict i to the overlap of both windows (0 <= i + delay < datasize),
+        // which turns the inner loop into a plain dot product on packed doubles
+        // that compilers can vectorize (no per-element bounds check)
+        const int i_start = std::max(0, -delay);
+        const int i_end = std::min(datasize, datasize - delay);
         double sxy = 0;
-        for (i = 0; i < datasize; ++i)
+        for (int i = i_start; i < i_end; ++i)
         {
-          j = i + delay;
-          if (j < 0 || j >= datasize)
-          {
-            continue;
-          }
-          sxy += (data1[i]) * (data2[j]);
+          sxy += (data1[i]) * (data2[i + delay]);
         }
         result.data.push_back(std::make_pair(delay, sxy));
       }
@@ -190,7 +208,7 @@ namespace OpenSwath::Scoring
       double mean2 = std::accumulate(data2.begin(), data2.end(), 0.) / (double)data2.size();
       double denominator = 1.0;
       int datasize = static_cast<int>(data1.size());
-      int i, j, delay;
+      int i, delay;
 
       // Normalized cross-correlation = subtract the mean and divide by the standard deviation
       if (normalize)
@@ -211,27 +229,32 @@ namespace OpenSwath::Scoring
       }
       //avoids division in the for loop
       denominator = 1/denominator;
+
+      // center the data once up front (if requested), so the inner loop below
+      // is a branch-free dot product on packed doubles which compilers can
+      // vectorize, instead of re-subtracting the means for every delay
+      std::vector<double> centered1(data1);
+      std::vector<double> centered2(data2);
+      if (normalize)
+      {
+        for (i = 0; i < datasize; i++)
+        {
+          centered1[i] -= mean1;
+          centered2[i] -= mean2;
+        }
+      }
+
       XCorrArrayType result;
       result.data.reserve( (size_t)std::ceil((2*maxdelay + 1) / lag));
-      int cnt = 0;
-      for (delay = -maxdelay; delay <= maxdelay; delay = delay + lag, cnt++)
+      for (delay = -maxdelay; delay <= maxdelay; delay = delay + lag)
       {
+        // restrict i to the overlap of both windows (0 <= i + delay < datasize)
+        const int i_start = std::max(0, -delay);
+        const int i_end = std::min(datasize, datasize - delay);
         double sxy = 0;
-        for (i = 0; i < datasize; i++)
+        for (i = i_start; i < i_end; i++)
         {
-          j = i + delay;
-          if (j < 0 || j >= datasize)
-          {
-            continue;
-          }
-          if (normalize)
-          {
-            sxy += (data1[i] - mean1) * (data2[j] - mean2);
-          }
-          else
-          {
-            sxy += (data1[i]) * (data2[j]);
-          }
+          sxy += centered1[i] * centered2[i + delay];
         }
 
         if (denominator > 0)
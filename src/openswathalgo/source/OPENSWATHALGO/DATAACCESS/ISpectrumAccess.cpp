@@ -19,6 +19,13 @@ namespace OpenSwath
   {
   }
 
+  SpectrumPtr ISpectrumAccess::getSpectrumMzSliceById(int id, double /* mz_start */, double /* mz_end */)
+  {
+    // the strip is only a hint which data the caller will look at, so the
+    // default is to return the full spectrum
+    return getSpectrumById(id);
+  }
+
   SpectrumSequence ISpectrumAccess::getMultipleSpectra(double RT, int nr_spectra_to_fetch)
   {
     std::vector<std::size_t> indices = getSpectraByRT(RT, 0.0);
@@ -0,0 +1,118 @@
+#ifndef __PYTHON_PEAK_VIEWS_HPP__
+#define __PYTHON_PEAK_VIEWS_HPP__
+
+#include <OpenMS/CONCEPT/Types.h>
+#include <OpenMS/KERNEL/MSExperiment.h>
+
+#include <cstring>
+#include <vector>
+
+// Helpers to expose the peak storage of MSSpectrum / MSChromatogram to Python
+// without copying. Peaks are stored as an array of structs (Peak1D: f8 m/z
+// followed by f4 intensity, padded to sizeof(Peak1D)), so a numpy array with
+// dtype {'names': ['mz', 'intensity'], 'formats': ['f8', 'f4'],
+// 'itemsize': peak_itemsize()} over the raw buffer gives zero-copy, read-only
+// per-dimension views (arr['mz'], arr['intensity']).
+// The owning spectrum/experiment object must be kept alive by the wrapper for
+// as long as a view exists (tie the base object reference to the array).
+// see ../pxds/ for the Cython defs
+
+namespace pyopenms_peak_views
+{
+
+    /// Verify at runtime that Peak1D has the assumed record layout
+    /// (f8 m/z at offset 0, f4 intensity at offset 8). Call once at import;
+    /// fall back to copying get_peaks() if this returns false.
+    inline bool peak_layout_is_structured()
+    {
+        OpenMS::Peak1D probe;
+        probe.setMZ(1.5);
+        probe.setIntensity(2.5f);
+        const char* base = reinterpret_cast<const char*>(&probe);
+        double mz;
+        float intensity;
+        std::memcpy(&mz, base, sizeof(double));
+        std::memcpy(&intensity, base + sizeof(double), sizeof(float));
+        return mz == 1.5 && intensity == 2.5f;
+    }
+
+    /// same check for ChromatogramPeak (f8 RT at offset 0, f4 intensity at offset 8)
+    inline bool chromatogram_peak_layout_is_structured()
+    {
+        OpenMS::ChromatogramPeak probe;
+        probe.setRT(1.5);
+        probe.setIntensity(2.5f);
+        const char* base = reinterpret_cast<const char*>(&probe);
+        double rt;
+        float intensity;
+        std::memcpy(&rt, base, sizeof(double));
+        std::memcpy(&intensity, base + sizeof(double), sizeof(float));
+        return rt == 1.5 && intensity == 2.5f;
+    }
+
+    /// Base pointer of the peak record array (NULL for an empty spectrum)
+    inline const void* peak_data_ptr(const OpenMS::MSSpectrum& spec)
+    {
+        return spec.empty() ? nullptr : static_cast<const void*>(&spec[0]);
+    }
+
+    /// Base pointer of the peak record array (NULL for an empty chromatogram)
+    inline const void* peak_data_ptr(const OpenMS::MSChromatogram& chrom)
+    {
+        return chrom.empty() ? nullptr : static_cast<const void*>(&chrom[0]);
+    }
+
+    /// Byte size of one peak record (the numpy dtype itemsize)
+    inline size_t peak_itemsize()
+    {
+        return sizeof(OpenMS::Peak1D);
+    }
+
+    /// Byte size of one chromatogram peak record
+    inline size_t chromatogram_peak_itemsize()
+    {
+        return sizeof(OpenMS::ChromatogramPeak);
+    }
+
+    /// Concatenated peak data of a whole experiment plus per-spectrum offsets.
+    /// Filled by get_all_peaks() in one pass; the vectors are contiguous and
+    /// can be handed to numpy as three flat arrays (wrap without copy via the
+    /// std::vector data pointers, keeping this object alive as the base).
+    struct AllPeaksData
+    {
+        std::vector<double> mz;          ///< m/z values of all spectra, concatenated
+        std::vector<float> intensity;    ///< intensities of all spectra, concatenated
+        std::vector<size_t> offsets;     ///< spectrum i covers [offsets[i], offsets[i+1]); size = #spectra + 1
+    };
+
+    /// Extract all peaks of @p exp into @p out (replacing its content).
+    /// One pass, two allocations; avoids per-spectrum Python call overhead.
+    inline void get_all_peaks(const OpenMS::MSExperiment& exp, AllPeaksData& out)
+    {
+        size_t total = 0;
+        for (OpenMS::Size s = 0; s < exp.getNrSpectra(); ++s)
+        {
+            total += exp[s].size();
+        }
+        out.mz.clear();
+        out.intensity.clear();
+        out.offsets.clear();
+        out.mz.reserve(total);
+        out.intensity.reserve(total);
+        out.offsets.reserve(exp.getNrSpectra() + 1);
+
+        out.offsets.push_back(0);
+        for (OpenMS::Size s = 0; s < exp.getNrSpectra(); ++s)
+        {
+            const OpenMS::MSSpectrum& spec = exp[s];
+            for (const OpenMS::Peak1D& p : spec)
+            {
+                out.mz.push_back(p.getMZ());
+                out.intensity.push_back(p.getIntensity());
+            }
+            out.offsets.push_back(out.mz.size());
+        }
+    }
+}
+
+#endif
@@ -292,6 +292,22 @@ START_SECTION(AASequence fromString(const String& s, bool permissive = true))
 }
 END_SECTION
 
+START_SECTION(static std::vector<AASequence> fromStrings(const std::vector<String>& sequences, bool permissive = true))
+{
+  std::vector<String> sequences = {"CNARCKNCNCNARCDRE", "VPQVSTPTLVEVSRSLGK(Label:18O(2))", "PEPS[167]TIDEK"};
+  std::vector<AASequence> parsed = AASequence::fromStrings(sequences);
+  TEST_EQUAL(parsed.size(), 3)
+  TEST_EQUAL(parsed[0], AASequence::fromString("CNARCKNCNCNARCDRE"))
+  TEST_EQUAL(parsed[1], AASequence::fromString("VPQVSTPTLVEVSRSLGK(Label:18O(2))"))
+  TEST_EQUAL(parsed[2], AASequence::fromString("PEPS[167]TIDEK"))
+
+  TEST_EQUAL(AASequence::fromStrings({}).empty(), true)
+
+  // an invalid sequence throws, like fromString() does
+  TEST_EXCEPTION(Exception::ParseError, AASequence::fromStrings({"PEPTIDE", "PEPT1DE"}))
+}
+END_SECTION
+
 START_SECTION(AASequence& operator=(const AASequence& rhs))
   AASequence seq = AASequence::fromString("AAA");
   AASequence seq2 = AASequence::fromString("AAA");
@@ -1553,7 +1569,7 @@ END_SECTION
 
 START_SECTION([EXTRA] multithreaded example)
 {
-  OPENMS_LOG_WARN.remove(std::cout);
+  OpenMS_Log_warn.remove(std::cout);
   // All measurements are best of three (wall time, Linux, 8 threads)
   //
   // Serial execution of code:
@@ -685,6 +685,37 @@ START_SECTION(PeptideHit AScore::compute(const PeptideHit& hit, PeakSpectrum& re
 }
 END_SECTION 
 
+START_SECTION(std::vector<PeptideHit> compute(const std::vector<PeptideHit>& hits, const std::vector<PeakSpectrum*>& real_spectra))
+{
+  AScore ascore;
+  Param params;
+  params.setValue("fragment_mass_tolerance", 0.6);
+  ascore.setParameters(params);
+
+  PeakSpectrum spectrum_1, spectrum_3;
+  DTAFile().load(OPENMS_GET_TEST_DATA_PATH("Ascore_test_input1.dta"), spectrum_1);
+  DTAFile().load(OPENMS_GET_TEST_DATA_PATH("Ascore_test_input3.dta"), spectrum_3);
+
+  vector<PeptideHit> hits;
+  hits.push_back(PeptideHit(1.0, 1, 1, AASequence::fromString("QSSVT(Phospho)QSK")));
+  hits.push_back(PeptideHit(1.0, 1, 1, AASequence::fromString("QSSVTQVTEQS(Phospho)PK")));
+  hits.push_back(PeptideHit(1.0, 1, 1, AASequence::fromString("QSSVT(Phospho)QSK"))); // same peptide again, served from the permutation cache
+  vector<PeakSpectrum*> spectra { &spectrum_1, &spectrum_3, &spectrum_1 };
+
+  vector<PeptideHit> scored = ascore.compute(hits, spectra);
+  ABORT_IF(scored.size() != 3);
+
+  // batch results have to be identical to the single PSM interface
+  for (Size i = 0; i < hits.size(); ++i)
+  {
+    PeptideHit expected = ascore.compute(hits[i], *spectra[i]);
+    TEST_EQUAL(scored[i].getSequence().toString(), expected.getSequence().toString());
+    TEST_REAL_SIMILAR(scored[i].getScore(), expected.getScore());
+    TEST_REAL_SIMILAR(static_cast<double>(scored[i].getMetaValue("AScore_1")), static_cast<double>(expected.getMetaValue("AScore_1")));
+  }
+}
+END_SECTION
+
 delete ptr_test;
 /////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////
@@ -14,6 +14,7 @@
 
 #include <OpenMS/CONCEPT/LogStream.h>
 #include <OpenMS/DATASTRUCTURES/ListUtils.h>
+#include <OpenMS/SYSTEM/File.h>
 
 #include <array>
 #include <cassert>
@@ -125,7 +126,50 @@ START_SECTION(void addNeedles(const std::vector<std::string>& needle))
 END_SECTION
 
 START_SECTION(void compressTrie())
-  NOT_TESTABLE // needs context...            
+  NOT_TESTABLE // needs context...
+END_SECTION
+
+START_SECTION(void store(const String& filename, const String& source_checksum) const)
+  ACTrie t;
+  // storing an empty or uncompressed trie is not allowed
+  TEST_EXCEPTION(Exception::Precondition, t.store("not_written.actrie", "checksum"))
+  t.addNeedle("PEPTIDE");
+  TEST_EXCEPTION(Exception::Precondition, t.store("not_written.actrie", "checksum"))
+  t.compressTrie();
+  String tmp_filename;
+  NEW_TMP_FILE(tmp_filename)
+  t.store(tmp_filename, "checksum");
+  TEST_EQUAL(File::exists(tmp_filename), true)
+END_SECTION
+
+START_SECTION(bool load(const String& filename, const String& expected_source_checksum))
+  ACTrie t;
+  t.addNeedlesAndCompress({"PEPTIDE", "PEPTIDER", "EPTIDE"});
+  String tmp_filename;
+  NEW_TMP_FILE(tmp_filename)
+  t.store(tmp_filename, "checksum");
+
+  TEST_EXCEPTION(Exception::FileNotFound, ACTrie().load("does_not_exist.actrie", "checksum"))
+
+  // stale checksum: nothing is loaded
+  ACTrie stale;
+  TEST_EQUAL(stale.load(tmp_filename, "other_checksum"), false)
+  TEST_EQUAL(stale.getNeedleCount(), 0)
+
+  // valid load: searching gives the same hits as the original trie
+  ACTrie loaded;
+  TEST_EQUAL(loaded.load(tmp_filename, "checksum"), true)
+  TEST_EQUAL(loaded.getNeedleCount(), 3)
+  ACTrieState state, state_loaded;
+  state.setQuery("XXPEPTIDERXX");
+  t.getAllHits(state);
+  state_loaded.setQuery("XXPEPTIDERXX");
+  loaded.getAllHits(state_loaded);
+  TEST_EQUAL(state_loaded.hits.size(), state.hits.size())
+  for (Size i = 0; i < state.hits.size(); ++i)
+  {
+    TEST_EQUAL(state_loaded.hits[i] == state.hits[i], true)
+  }
 END_SECTION
 
 
@@ -0,0 +1,193 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+
+///////////////////////////
+
+#include <OpenMS/KERNEL/AreaTileIndex.h>
+
+///////////////////////////
+
+#include <OpenMS/KERNEL/MSExperiment.h>
+
+START_TEST(AreaTileIndex, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+using namespace OpenMS;
+
+namespace
+{
+  // spectra at RT 1..4 with peaks at distinct m/z positions:
+  // scan 0: 100 (int 10), 500 (int 20)
+  // scan 1: 300 (int 30)
+  // scan 2: (empty)
+  // scan 3: 900 (int 40)
+  MSExperiment makeExperiment()
+  {
+    MSExperiment exp;
+    const std::vector<std::vector<std::pair<double, float>>> peaks = {
+      {{100.0, 10.0f}, {500.0, 20.0f}},
+      {{300.0, 30.0f}},
+      {},
+      {{900.0, 40.0f}}
+    };
+    for (Size i = 0; i < peaks.size(); ++i)
+    {
+      MSSpectrum s;
+      s.setRT(double(i + 1));
+      s.setMSLevel(1);
+      for (const auto& [mz, intensity] : peaks[i])
+      {
+        s.emplace_back(Peak1D::PositionType(mz), intensity);
+      }
+      exp.addSpectrum(std::move(s));
+    }
+    return exp;
+  }
+}
+
+AreaTileIndex* ptr = nullptr;
+AreaTileIndex* null_ptr = nullptr;
+
+START_SECTION(AreaTileIndex())
+{
+  ptr = new AreaTileIndex();
+  TEST_NOT_EQUAL(ptr, null_ptr)
+  TEST_EQUAL(ptr->empty(), true)
+  delete ptr;
+}
+END_SECTION
+
+START_SECTION((void build(const MSExperiment& exp, Size mz_tiles = 256, Size rt_block_size = 64)))
+{
+  MSExperiment exp = makeExperiment();
+  AreaTileIndex index;
+  index.build(exp, 16, 2);
+  TEST_EQUAL(index.empty(), false)
+  TEST_EQUAL(index.getNrSpectra(), 4)
+  TEST_EQUAL(index.getNrMZTiles(), 16)
+
+  TEST_EXCEPTION(Exception::IllegalArgument, index.build(exp, 0))
+  TEST_EXCEPTION(Exception::IllegalArgument, index.build(exp, 16, 0))
+
+  // an experiment without peaks yields an empty (conservative) index
+  MSExperiment no_peaks;
+  no_peaks.addSpectrum(MSSpectrum());
+  AreaTileIndex empty_index;
+  empty_index.build(no_peaks);
+  TEST_EQUAL(empty_index.empty(), true)
+  TEST_EQUAL(empty_index.containsPeaks(0, 0.0, 1000.0), true)
+}
+END_SECTION
+
+START_SECTION((bool containsPeaks(Size scan_index, double low_mz, double high_mz) const))
+{
+  MSExperiment exp = makeExperiment();
+  AreaTileIndex index;
+  index.build(exp, 16, 2); // tile width = (900 - 100) / 16 = 50 Th
+
+  // windows covering actual peaks
+  TEST_EQUAL(index.containsPeaks(0, 99.0, 101.0), true)
+  TEST_EQUAL(index.containsPeaks(0, 499.0, 501.0), true)
+  TEST_EQUAL(index.containsPeaks(1, 299.0, 301.0), true)
+  TEST_EQUAL(index.containsPeaks(3, 899.0, 901.0), true)
+
+  // windows provably empty at tile granularity
+  TEST_EQUAL(index.containsPeaks(0, 299.0, 301.0), false)
+  TEST_EQUAL(index.containsPeaks(1, 99.0, 101.0), false)
+  TEST_EQUAL(index.containsPeaks(2, 0.0, 1000.0), false)
+  TEST_EQUAL(index.containsPeaks(3, 200.0, 700.0), false)
+
+  // windows beyond the m/z range clamp to the outermost tiles
+  TEST_EQUAL(index.containsPeaks(0, 0.0, 50.0), true)     // clamps onto the tile of m/z 100
+  TEST_EQUAL(index.containsPeaks(3, 950.0, 2000.0), true) // clamps onto the tile of m/z 900
+
+  // scans not covered by the index are conservatively reported as occupied
+  TEST_EQUAL(index.containsPeaks(4, 299.0, 301.0), true)
+}
+END_SECTION
+
+START_SECTION((float maxIntensity(Size scan_index, double low_mz, double high_mz) const))
+{
+  MSExperiment exp = makeExperiment();
+  AreaTileIndex index;
+  index.build(exp, 16, 2);
+
+  // scans 0 and 1 share a block; the bound covers both
+  TEST_REAL_SIMILAR(index.maxIntensity(0, 99.0, 101.0), 10.0)
+  TEST_REAL_SIMILAR(index.maxIntensity(0, 99.0, 501.0), 30.0) // includes scan 1's peak at 300
+  TEST_REAL_SIMILAR(index.maxIntensity(3, 899.0, 901.0), 40.0)
+  // provably empty windows yield 0
+  TEST_REAL_SIMILAR(index.maxIntensity(2, 0.0, 1000.0), 0.0)
+}
+END_SECTION
+
+START_SECTION((float minIntensity(Size scan_index, double low_mz, double high_mz) const))
+{
+  MSExperiment exp = makeExperiment();
+  AreaTileIndex index;
+  index.build(exp, 16, 2);
+
+  TEST_REAL_SIMILAR(index.minIntensity(0, 99.0, 501.0), 10.0)
+  TEST_REAL_SIMILAR(index.minIntensity(1, 299.0, 301.0), 30.0)
+  TEST_REAL_SIMILAR(index.minIntensity(2, 0.0, 1000.0), 0.0)
+}
+END_SECTION
+
+START_SECTION((void clear()))
+{
+  MSExperiment exp = makeExperiment();
+  AreaTileIndex index;
+  index.build(exp);
+  TEST_EQUAL(index.empty(), false)
+  index.clear();
+  TEST_EQUAL(index.empty(), true)
+  TEST_EQUAL(index.containsPeaks(0, 299.0, 301.0), true) // conservative again
+}
+END_SECTION
+
+START_SECTION([EXTRA] area iteration with and without the index yields the same peaks)
+{
+  MSExperiment exp = makeExperiment();
+
+  std::vector<std::pair<double, double>> reference; // (RT, m/z) of all visited peaks
+  for (auto it = exp.areaBeginConst(0.0, 10.0, 250.0, 950.0); it != exp.areaEndConst(); ++it)
+  {
+    reference.emplace_back(it.getRT(), it->getMZ());
+  }
+  TEST_EQUAL(reference.size(), 3) // 300, 500, 900
+
+  exp.buildAreaTileIndex(16, 2);
+  TEST_NOT_EQUAL(exp.getAreaTileIndex(), nullptr)
+  std::vector<std::pair<double, double>> indexed;
+  for (auto it = exp.areaBeginConst(0.0, 10.0, 250.0, 950.0); it != exp.areaEndConst(); ++it)
+  {
+    indexed.emplace_back(it.getRT(), it->getMZ());
+  }
+  TEST_EQUAL(indexed == reference, true)
+
+  // narrow window which the index proves empty for all but one scan
+  Size count = 0;
+  for (auto it = exp.areaBeginConst(0.0, 10.0, 299.0, 301.0); it != exp.areaEndConst(); ++it)
+  {
+    ++count;
+    TEST_REAL_SIMILAR(it->getMZ(), 300.0)
+  }
+  TEST_EQUAL(count, 1)
+
+  exp.clearAreaTileIndex();
+  TEST_EQUAL(exp.getAreaTileIndex() == nullptr, true)
+}
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
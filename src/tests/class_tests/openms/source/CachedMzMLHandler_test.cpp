@@ -335,6 +335,103 @@ START_SECTION(static inline void readSpectrumFast(OpenSwath::BinaryDataArrayPtr
 }
 END_SECTION
 
+START_SECTION(static std::vector<OpenSwath::BinaryDataArrayPtr> readSpectrumFast(std::ifstream& ifs, int& ms_level, double& rt, double mz_start, double mz_end))
+{
+  std::vector<std::streampos> spectra_index = cache_.getSpectraIndex();
+  TEST_EQUAL(spectra_index.size(), 4)
+  std::ifstream ifs_(tmp_filename.c_str(), std::ios::binary);
+
+  // full read of spectrum 1 (the one with extra data arrays) as reference
+  int ms_level = -1;
+  double rt = -1.0;
+  ifs_.seekg(spectra_index[1]);
+  std::vector<OpenSwath::BinaryDataArrayPtr> full = CachedMzMLHandler::readSpectrumFast(ifs_, ms_level, rt);
+  TEST_EQUAL(full.size(), 4)
+  ABORT_IF(full[0]->data.size() < 3)
+
+  // strip bounds that cut off exactly the first and the last peak
+  double mz_start = full[0]->data[1];
+  double mz_end = full[0]->data[full[0]->data.size() - 2];
+
+  ifs_.seekg(spectra_index[1]);
+  int strip_ms_level = -1;
+  double strip_rt = -1.0;
+  std::vector<OpenSwath::BinaryDataArrayPtr> strip = CachedMzMLHandler::readSpectrumFast(ifs_, strip_ms_level, strip_rt, mz_start, mz_end);
+
+  TEST_EQUAL(strip_ms_level, ms_level)
+  TEST_REAL_SIMILAR(strip_rt, rt)
+  TEST_EQUAL(strip.size(), 4)
+  TEST_EQUAL(strip[2]->description, full[2]->description)
+  TEST_EQUAL(strip[3]->description, full[3]->description)
+  TEST_EQUAL(strip[0]->data.size(), full[0]->data.size() - 2)
+  for (Size i = 0; i < strip[0]->data.size(); i++)
+  {
+    TEST_REAL_SIMILAR(strip[0]->data[i], full[0]->data[i + 1])
+    TEST_REAL_SIMILAR(strip[1]->data[i], full[1]->data[i + 1])
+  }
+  // extra data arrays with one entry per peak are sliced alongside the peaks,
+  // others are returned in full
+  for (Size k = 2; k < full.size(); k++)
+  {
+    if (full[k]->data.size() == full[0]->data.size())
+    {
+      TEST_EQUAL(strip[k]->data.size(), strip[0]->data.size())
+    }
+    else
+    {
+      TEST_EQUAL(strip[k]->data.size(), full[k]->data.size())
+    }
+  }
+  // like a full read, a strip read leaves the stream past the spectrum
+  TEST_EQUAL(ifs_.tellg() == spectra_index[2], true)
+
+  // a strip outside the m/z range yields empty peak arrays
+  ifs_.seekg(spectra_index[1]);
+  std::vector<OpenSwath::BinaryDataArrayPtr> none = CachedMzMLHandler::readSpectrumFast(ifs_, strip_ms_level, strip_rt, full[0]->data.back() + 1.0, full[0]->data.back() + 2.0);
+  TEST_EQUAL(none[0]->data.size(), 0)
+  TEST_EQUAL(none[1]->data.size(), 0)
+  TEST_EQUAL(ifs_.tellg() == spectra_index[2], true)
+}
+END_SECTION
+
+START_SECTION(static std::vector<OpenSwath::BinaryDataArrayPtr> readSpectrumFast(const char* buffer, Size buffer_size, Size& offset, int& ms_level, double& rt, double mz_start, double mz_end))
+{
+  std::vector<std::streampos> spectra_index = cache_.getSpectraIndex();
+  TEST_EQUAL(spectra_index.size(), 4)
+
+  // read the whole cached file into memory (stand-in for a memory mapping)
+  std::ifstream ifs_(tmp_filename.c_str(), std::ios::binary);
+  std::vector<char> content((std::istreambuf_iterator<char>(ifs_)), std::istreambuf_iterator<char>());
+
+  // reference: stream-based strip read
+  int ms_level = -1;
+  double rt = -1.0;
+  ifs_.clear();
+  ifs_.seekg(spectra_index[1]);
+  std::vector<OpenSwath::BinaryDataArrayPtr> full = CachedMzMLHandler::readSpectrumFast(ifs_, ms_level, rt);
+  ABORT_IF(full[0]->data.size() < 3)
+  double mz_start = full[0]->data[1];
+  double mz_end = full[0]->data[full[0]->data.size() - 2];
+
+  Size offset = static_cast<Size>(spectra_index[1]);
+  int strip_ms_level = -1;
+  double strip_rt = -1.0;
+  std::vector<OpenSwath::BinaryDataArrayPtr> strip = CachedMzMLHandler::readSpectrumFast(content.data(), content.size(), offset, strip_ms_level, strip_rt, mz_start, mz_end);
+
+  TEST_EQUAL(strip_ms_level, ms_level)
+  TEST_REAL_SIMILAR(strip_rt, rt)
+  TEST_EQUAL(strip.size(), full.size())
+  TEST_EQUAL(strip[0]->data.size(), full[0]->data.size() - 2)
+  for (Size i = 0; i < strip[0]->data.size(); i++)
+  {
+    TEST_REAL_SIMILAR(strip[0]->data[i], full[0]->data[i + 1])
+    TEST_REAL_SIMILAR(strip[1]->data[i], full[1]->data[i + 1])
+  }
+  // like a full read, a strip read advances the offset past the spectrum
+  TEST_EQUAL(offset, static_cast<Size>(spectra_index[2]))
+}
+END_SECTION
+
 START_SECTION( static inline void readChromatogramFast(OpenSwath::BinaryDataArrayPtr data1, OpenSwath::BinaryDataArrayPtr data2, std::ifstream& ifs) )
 {
   // Check whether chromatograms were written to disk correctly...
@@ -0,0 +1,165 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/KERNEL/ChromatogramBundle.h>
+
+///////////////////////////
+
+#include <OpenMS/KERNEL/MSChromatogram.h>
+
+using namespace OpenMS;
+using namespace std;
+
+namespace
+{
+  MSChromatogram makeChromatogram(const String& native_id, float base_intensity)
+  {
+    MSChromatogram c;
+    c.setNativeID(native_id);
+    for (Size i = 0; i < 4; ++i)
+    {
+      c.push_back(ChromatogramPeak(ChromatogramPeak::PositionType(10.0 * (i + 1)), base_intensity + float(i)));
+    }
+    return c;
+  }
+}
+
+START_TEST(ChromatogramBundle, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+ChromatogramBundle* bundle_ptr = nullptr;
+ChromatogramBundle* bundle_nullPointer = nullptr;
+
+START_SECTION((ChromatogramBundle()))
+{
+  bundle_ptr = new ChromatogramBundle();
+  TEST_NOT_EQUAL(bundle_ptr, bundle_nullPointer)
+  TEST_EQUAL(bundle_ptr->empty(), true)
+  TEST_EQUAL(bundle_ptr->size(), 0)
+  TEST_EQUAL(bundle_ptr->gridSize(), 0)
+  delete bundle_ptr;
+}
+END_SECTION
+
+START_SECTION((explicit ChromatogramBundle(const std::vector<MSChromatogram>& chromatograms)))
+{
+  std::vector<MSChromatogram> chromatograms;
+  chromatograms.push_back(makeChromatogram("tr1", 100.0f));
+  chromatograms.push_back(makeChromatogram("tr2", 200.0f));
+
+  ChromatogramBundle bundle(chromatograms);
+  TEST_EQUAL(bundle.size(), 2)
+  TEST_EQUAL(bundle.gridSize(), 4)
+  TEST_REAL_SIMILAR(bundle.getRTs()[0], 10.0)
+  TEST_REAL_SIMILAR(bundle.getRTs()[3], 40.0)
+  TEST_STRING_EQUAL(bundle.getSettings(0).getNativeID(), "tr1")
+  TEST_STRING_EQUAL(bundle.getSettings(1).getNativeID(), "tr2")
+  TEST_REAL_SIMILAR(bundle.intensityData(0)[0], 100.0)
+  TEST_REAL_SIMILAR(bundle.intensityData(1)[3], 203.0)
+
+  // chromatograms on a different RT axis are rejected
+  chromatograms.push_back(makeChromatogram("tr3", 300.0f));
+  chromatograms.back().resize(3);
+  TEST_EXCEPTION(Exception::InvalidParameter, ChromatogramBundle bundle2(chromatograms))
+  chromatograms.back() = makeChromatogram("tr3", 300.0f);
+  chromatograms.back()[2].setRT(31.0);
+  TEST_EXCEPTION(Exception::InvalidParameter, ChromatogramBundle bundle3(chromatograms))
+}
+END_SECTION
+
+START_SECTION((void setRTs(RTArrayType rts)))
+{
+  ChromatogramBundle bundle;
+  bundle.setRTs({ 1.0, 2.0, 3.0 });
+  TEST_EQUAL(bundle.gridSize(), 3)
+
+  ChromatogramSettings settings;
+  bundle.addChromatogram(settings, { 1.0f, 2.0f, 3.0f });
+  // the grid size of a filled bundle cannot change
+  TEST_EXCEPTION(Exception::InvalidParameter, bundle.setRTs({ 1.0, 2.0 }))
+}
+END_SECTION
+
+START_SECTION((void addChromatogram(const ChromatogramSettings& settings, const std::vector<IntensityType>& intensities)))
+{
+  ChromatogramBundle bundle;
+  bundle.setRTs({ 1.0, 2.0, 3.0 });
+
+  ChromatogramSettings settings;
+  settings.setNativeID("tr1");
+  bundle.addChromatogram(settings, { 5.0f, 6.0f, 7.0f });
+  TEST_EQUAL(bundle.size(), 1)
+  TEST_STRING_EQUAL(bundle.getSettings(0).getNativeID(), "tr1")
+  TEST_REAL_SIMILAR(bundle.intensityData(0)[1], 6.0)
+  TEST_EQUAL(bundle.getIntensityMatrix().size(), 3)
+
+  // intensity arrays must match the RT axis
+  TEST_EXCEPTION(Exception::InvalidParameter, bundle.addChromatogram(settings, { 1.0f, 2.0f }))
+}
+END_SECTION
+
+START_SECTION((MSChromatogram getChromatogram(Size i) const))
+{
+  std::vector<MSChromatogram> chromatograms;
+  chromatograms.push_back(makeChromatogram("tr1", 100.0f));
+  chromatograms.push_back(makeChromatogram("tr2", 200.0f));
+
+  ChromatogramBundle bundle(chromatograms);
+  MSChromatogram back = bundle.getChromatogram(1);
+  TEST_EQUAL(back == chromatograms[1], true)
+}
+END_SECTION
+
+START_SECTION((std::vector<MSChromatogram> toChromatograms() const))
+{
+  std::vector<MSChromatogram> chromatograms;
+  chromatograms.push_back(makeChromatogram("tr1", 100.0f));
+  chromatograms.push_back(makeChromatogram("tr2", 200.0f));
+
+  ChromatogramBundle bundle(chromatograms);
+  std::vector<MSChromatogram> back = bundle.toChromatograms();
+  TEST_EQUAL(back.size(), 2)
+  TEST_EQUAL(back[0] == chromatograms[0], true)
+  TEST_EQUAL(back[1] == chromatograms[1], true)
+}
+END_SECTION
+
+START_SECTION((bool operator==(const ChromatogramBundle& rhs) const))
+{
+  std::vector<MSChromatogram> chromatograms;
+  chromatograms.push_back(makeChromatogram("tr1", 100.0f));
+
+  ChromatogramBundle bundle_1(chromatograms);
+  ChromatogramBundle bundle_2(chromatograms);
+  TEST_EQUAL(bundle_1 == bundle_2, true)
+
+  bundle_2.intensityData(0)[0] += 1.0f;
+  TEST_EQUAL(bundle_1 == bundle_2, false)
+}
+END_SECTION
+
+START_SECTION((bool operator!=(const ChromatogramBundle& rhs) const))
+{
+  ChromatogramBundle bundle_1;
+  ChromatogramBundle bundle_2;
+  TEST_EQUAL(bundle_1 != bundle_2, false)
+  bundle_2.setRTs({ 1.0 });
+  TEST_EQUAL(bundle_1 != bundle_2, true)
+}
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
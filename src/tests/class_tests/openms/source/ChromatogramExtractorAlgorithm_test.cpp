@@ -514,6 +514,60 @@ START_SECTION([EXTRA]void extract_value_tophat(const std::vector< double >::cons
 }
 END_SECTION
 
+START_SECTION([EXTRA] RT-restricted coordinates skip spectra outside all RT windows)
+{
+  double extract_window = 0.05;
+  boost::shared_ptr<PeakMap > exp(new PeakMap);
+  MzMLFile().load(OPENMS_GET_TEST_DATA_PATH("ChromatogramExtractor_input.mzML"), *exp);
+  OpenSwath::SpectrumAccessPtr expptr = SimpleOpenMSSpectraFactory::getSpectrumAccessOpenMSPtr(exp);
+
+  ChromatogramExtractorAlgorithm extractor;
+
+  std::vector< ChromatogramExtractorAlgorithm::ExtractionCoordinates > coordinates;
+  std::vector< OpenSwath::ChromatogramPtr > out_exp;
+  for (int i = 0; i < 3; i++)
+  {
+    OpenSwath::ChromatogramPtr s(new OpenSwath::Chromatogram);
+    out_exp.push_back(s);
+  }
+
+  {
+    ChromatogramExtractorAlgorithm::ExtractionCoordinates coord;
+    coord.mz = 618.31; coord.rt_start = 3050; coord.rt_end = 3130; coord.id = "tr1";
+    coordinates.push_back(coord);
+    coord.mz = 628.45; coord.rt_start = 3050; coord.rt_end = 3130; coord.id = "tr2";
+    coordinates.push_back(coord);
+    coord.mz = 654.38; coord.rt_start = 3050; coord.rt_end = 3130; coord.id = "tr3";
+    coordinates.push_back(coord);
+  }
+  extractor.extractChromatograms(expptr, out_exp, coordinates, extract_window, false, -1, "tophat");
+
+  // only data points inside the RT windows are produced ...
+  for (Size k = 0; k < out_exp.size(); ++k)
+  {
+    TEST_EQUAL(out_exp[k]->getTimeArray()->data.size() < 59, true)
+    for (double rt : out_exp[k]->getTimeArray()->data)
+    {
+      TEST_EQUAL(rt >= 3050 && rt <= 3130, true)
+    }
+  }
+
+  // ... and the signal maxima (which lie inside the windows) are unchanged
+  double max_value = -1; double foundat = -1;
+  find_max_helper(out_exp[1], max_value, foundat);
+  TEST_REAL_SIMILAR(max_value, 169.792);
+  TEST_REAL_SIMILAR(foundat, 3120.26);
+
+  find_max_helper(out_exp[2], max_value, foundat);
+  TEST_REAL_SIMILAR(max_value, 577.33);
+  TEST_REAL_SIMILAR(foundat, 3120.26);
+
+  find_max_helper(out_exp[0], max_value, foundat);
+  TEST_REAL_SIMILAR(max_value, 35.593);
+  TEST_REAL_SIMILAR(foundat, 3055.16);
+}
+END_SECTION
+
 START_SECTION( [ChromatogramExtractorAlgorithm::ExtractionCoordinates] static bool SortExtractionCoordinatesByMZ(const ChromatogramExtractorAlgorithm::ExtractionCoordinates &left, const ChromatogramExtractorAlgorithm::ExtractionCoordinates &right))    
 {
   NOT_TESTABLE
@@ -214,6 +214,75 @@ START_SECTION((template <typename Data, typename SimilarityComparator> void clus
 }
 END_SECTION
 
+START_SECTION((template <typename Data, typename SimilarityComparator> void clusterSparse(std::vector<Data>& data, const SimilarityComparator& comparator, std::vector<BinaryTreeNode>& cluster_tree)))
+{
+ vector<Size> d(6,0);
+ for (Size i = 0; i<d.size(); ++i)
+ {
+  d[i]=i;
+ }
+ ClusterHierarchical ch;
+ LowlevelComparator lc;
+ vector< BinaryTreeNode > result;
+ vector< BinaryTreeNode > tree;
+ tree.push_back(BinaryTreeNode(1,2,0.3f));
+ tree.push_back(BinaryTreeNode(3,4,0.4f));
+ tree.push_back(BinaryTreeNode(0,1,0.5f));
+ tree.push_back(BinaryTreeNode(0,3,0.6f));
+ tree.push_back(BinaryTreeNode(0,5,0.7f));
+
+ // with the default threshold of 1 the sparse clustering yields the same
+ // single linkage tree as the dense variant
+ ch.clusterSparse<Size,LowlevelComparator>(d,lc,result);
+
+ TEST_EQUAL(tree.size(), result.size());
+ for (Size i = 0; i < tree.size(); ++i)
+ {
+   TOLERANCE_ABSOLUTE(0.0001);
+   TEST_EQUAL(tree[i].left_child, result[i].left_child);
+   TEST_EQUAL(tree[i].right_child, result[i].right_child);
+   TEST_REAL_SIMILAR(tree[i].distance, result[i].distance);
+ }
+}
+END_SECTION
+
+START_SECTION((void clusterSparse(SparseDistanceMatrix<float>& sparse_distance, std::vector<BinaryTreeNode>& cluster_tree)))
+{
+ LowlevelComparator lc;
+ SparseDistanceMatrix<float> sparse_distance(6, 0.45f);
+ for (Size i = 0; i < 6; ++i)
+ {
+  for (Size j = 0; j < i; ++j)
+  {
+   sparse_distance.setValue(i, j, (float)(1 - lc(i, j)));
+  }
+ }
+ // only the two pairs closer than the cutoff are kept
+ TEST_EQUAL(sparse_distance.storedPairs(), 2);
+
+ vector< BinaryTreeNode > result;
+ ClusterHierarchical ch;
+ ch.clusterSparse(sparse_distance, result);
+
+ // merges below the cutoff, the remaining clusters appended as dummy nodes
+ vector< BinaryTreeNode > tree;
+ tree.push_back(BinaryTreeNode(1,2,0.3f));
+ tree.push_back(BinaryTreeNode(3,4,0.4f));
+ tree.push_back(BinaryTreeNode(0,1,-1.0f));
+ tree.push_back(BinaryTreeNode(0,3,-1.0f));
+ tree.push_back(BinaryTreeNode(0,5,-1.0f));
+
+ TEST_EQUAL(tree.size(), result.size());
+ for (Size i = 0; i < tree.size(); ++i)
+ {
+   TOLERANCE_ABSOLUTE(0.0001);
+   TEST_EQUAL(tree[i].left_child, result[i].left_child);
+   TEST_EQUAL(tree[i].right_child, result[i].right_child);
+   TEST_REAL_SIMILAR(tree[i].distance, result[i].distance);
+ }
+}
+END_SECTION
+
 START_SECTION((void cluster(std::vector<PeakSpectrum>& data, const BinnedSpectrumCompareFunctor& comparator, double sz, UInt sp, const ClusterFunctor& clusterer, std::vector<BinaryTreeNode>& cluster_tree, DistanceMatrix<float>& original_distance)))
 {
 
@@ -265,6 +265,66 @@ START_SECTION(IsotopeDitribution CoarseIsotopePatternGenerator::estimateFromPept
 }
 END_SECTION
 
+START_SECTION(void CoarseIsotopePatternGenerator::buildAveragineTable(double max_weight, double resolution))
+{
+    CoarseIsotopePatternGenerator gen(3);
+    TEST_EQUAL(gen.hasAveragineTable(), false)
+    gen.buildAveragineTable(2000.0, 25.0);
+    TEST_EQUAL(gen.hasAveragineTable(), true)
+    TEST_EXCEPTION(Exception::Precondition, gen.buildAveragineTable(10.0, 25.0))
+}
+END_SECTION
+
+START_SECTION(IsotopeDistribution CoarseIsotopePatternGenerator::estimateFromPeptideWeightFast(double average_weight))
+{
+    CoarseIsotopePatternGenerator gen(3);
+    // without a table, identical to the exact calculation
+    IsotopeDistribution exact = gen.estimateFromPeptideWeight(1000.0);
+    IsotopeDistribution fast = gen.estimateFromPeptideWeightFast(1000.0);
+    TEST_EQUAL(exact.size(), fast.size())
+    TEST_REAL_SIMILAR(exact.begin()->getIntensity(), fast.begin()->getIntensity())
+
+    // on a table grid point, the intensities match the exact calculation
+    gen.buildAveragineTable(2000.0, 25.0);
+    fast = gen.estimateFromPeptideWeightFast(1000.0);
+    TEST_EQUAL(exact.size(), fast.size())
+    for (Size i = 0; i < exact.size(); ++i)
+    {
+      TEST_REAL_SIMILAR(exact.getContainer()[i].getIntensity(), fast.getContainer()[i].getIntensity())
+      TEST_REAL_SIMILAR(exact.getContainer()[i].getMZ(), fast.getContainer()[i].getMZ())
+    }
+
+    // off the grid, the masses follow the query weight and intensities stay close
+    exact = gen.estimateFromPeptideWeight(1010.0);
+    fast = gen.estimateFromPeptideWeightFast(1010.0);
+    TEST_EQUAL(exact.size(), fast.size())
+    TOLERANCE_ABSOLUTE(0.01)
+    TEST_REAL_SIMILAR(exact.begin()->getIntensity(), fast.begin()->getIntensity())
+    TOLERANCE_ABSOLUTE(0.2)
+    TEST_REAL_SIMILAR(exact.begin()->getMZ(), fast.begin()->getMZ())
+
+    // weights beyond the table use its last entry
+    fast = gen.estimateFromPeptideWeightFast(5000.0);
+    TEST_EQUAL(fast.size() > 0, true)
+}
+END_SECTION
+
+START_SECTION(std::vector<IsotopeDistribution> CoarseIsotopePatternGenerator::estimateFromPeptideWeights(const std::vector<double>& average_weights))
+{
+    CoarseIsotopePatternGenerator gen(3);
+    gen.buildAveragineTable(2000.0, 25.0);
+    std::vector<double> weights = {500.0, 1000.0, 1500.0};
+    std::vector<IsotopeDistribution> patterns = gen.estimateFromPeptideWeights(weights);
+    TEST_EQUAL(patterns.size(), 3)
+    for (Size i = 0; i < weights.size(); ++i)
+    {
+      IsotopeDistribution single = gen.estimateFromPeptideWeightFast(weights[i]);
+      TEST_EQUAL(patterns[i].size(), single.size())
+      TEST_REAL_SIMILAR(patterns[i].begin()->getIntensity(), single.begin()->getIntensity())
+    }
+}
+END_SECTION
+
 START_SECTION(IsotopeDitribution CoarseIsotopePatternGenerator::approximateFromPeptideWeight(double mass, int num_peaks))
 {
   std::vector<float> masses_to_test = {20, 300, 1000, 2500};
@@ -0,0 +1,103 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/FORMAT/DATAACCESS/CompressedMSExperiment.h>
+
+///////////////////////////
+
+START_TEST(CompressedMSExperiment, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+using namespace OpenMS;
+
+// build a small test experiment
+MSExperiment exp;
+exp.setIdentifier("compressed_test");
+for (Size s = 0; s < 5; ++s)
+{
+  MSSpectrum spec;
+  spec.setRT(100.0 + 10.0 * s);
+  spec.setMSLevel(1);
+  for (Size k = 0; k < 100; ++k)
+  {
+    Peak1D p;
+    p.setMZ(400.0 + 0.5 * k);
+    p.setIntensity(1000.0f + 17.0f * k);
+    spec.push_back(p);
+  }
+  exp.addSpectrum(spec);
+}
+
+CompressedMSExperiment* ptr = nullptr;
+CompressedMSExperiment* null_ptr = nullptr;
+
+START_SECTION((CompressedMSExperiment()))
+  ptr = new CompressedMSExperiment();
+  TEST_NOT_EQUAL(ptr, null_ptr)
+  TEST_EQUAL(ptr->getNrSpectra(), 0)
+  delete ptr;
+END_SECTION
+
+START_SECTION((CompressedMSExperiment(const MSExperiment& exp, Size working_set_size = 32)))
+  CompressedMSExperiment compressed(exp);
+  TEST_EQUAL(compressed.getNrSpectra(), 5)
+  TEST_EQUAL(compressed.getExperimentalSettings().getIdentifier(), "compressed_test")
+  // numpress should shrink the peak data well below the raw 12 bytes / peak
+  TEST_EQUAL(compressed.getCompressedSizeInBytes() < 5 * 100 * 12, true)
+END_SECTION
+
+START_SECTION((const MSSpectrum& getSpectrum(Size id)))
+  CompressedMSExperiment compressed(exp, 2); // working set smaller than spectrum count
+  for (Size s = 0; s < exp.getNrSpectra(); ++s)
+  {
+    const MSSpectrum& spec = compressed.getSpectrum(s);
+    TEST_EQUAL(spec.size(), 100)
+    TEST_REAL_SIMILAR(spec.getRT(), exp[s].getRT())
+    TEST_REAL_SIMILAR(spec[0].getMZ(), exp[s][0].getMZ())
+    TEST_REAL_SIMILAR(spec[99].getMZ(), exp[s][99].getMZ())
+    TEST_REAL_SIMILAR(spec[42].getIntensity(), exp[s][42].getIntensity())
+  }
+  // repeated access (cache hit) gives the same data
+  TEST_REAL_SIMILAR(compressed.getSpectrum(4)[0].getMZ(), exp[4][0].getMZ())
+  // invalid index
+  TEST_EXCEPTION(Exception::IndexOverflow, compressed.getSpectrum(5))
+END_SECTION
+
+START_SECTION((MSExperiment toExperiment()))
+  CompressedMSExperiment compressed(exp);
+  MSExperiment round_trip = compressed.toExperiment();
+  TEST_EQUAL(round_trip.getNrSpectra(), exp.getNrSpectra())
+  TEST_EQUAL(round_trip.getIdentifier(), "compressed_test")
+  for (Size s = 0; s < exp.getNrSpectra(); ++s)
+  {
+    TEST_EQUAL(round_trip[s].size(), exp[s].size())
+    TEST_REAL_SIMILAR(round_trip[s][50].getMZ(), exp[s][50].getMZ())
+  }
+END_SECTION
+
+START_SECTION((void setWorkingSetSize(Size working_set_size)))
+  CompressedMSExperiment compressed(exp, 5);
+  for (Size s = 0; s < 5; ++s)
+  {
+    compressed.getSpectrum(s);
+  }
+  compressed.setWorkingSetSize(1); // shrinking evicts, access still works
+  TEST_EQUAL(compressed.getWorkingSetSize(), 1)
+  TEST_REAL_SIMILAR(compressed.getSpectrum(0)[0].getMZ(), exp[0][0].getMZ())
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
@@ -47,6 +47,49 @@ START_SECTION((static void normalizeMaps(ConsensusMap &map)))
 }
 END_SECTION
 
+START_SECTION((static void normalizeMapsApproximate(ConsensusMap &map, Size sketch_accuracy)))
+{
+  ConsensusMap map;
+  map.getColumnHeaders()[0].size = 3;
+  map.getColumnHeaders()[1].size = 3;
+  // three consensus features; map 1 intensities are map 0 intensities scaled by 10
+  double ints_0[3] = {100.0, 200.0, 300.0};
+  double ints_1[3] = {1000.0, 2000.0, 3000.0};
+  for (Size i = 0; i < 3; ++i)
+  {
+    ConsensusFeature cf;
+    FeatureHandle h0;
+    h0.setMapIndex(0);
+    h0.setIntensity(ints_0[i]);
+    h0.setUniqueId(i);
+    cf.insert(h0);
+    FeatureHandle h1;
+    h1.setMapIndex(1);
+    h1.setIntensity(ints_1[i]);
+    h1.setUniqueId(i);
+    cf.insert(h1);
+    map.push_back(cf);
+  }
+
+  ConsensusMapNormalizerAlgorithmQuantile::normalizeMapsApproximate(map);
+
+  // with only 3 values per map the sketches are exact: features of the same
+  // rank in both maps end up with the same intensity, the mean of the two
+  // original ones
+  for (Size i = 0; i < 3; ++i)
+  {
+    double int_0 = -1, int_1 = -1;
+    for (ConsensusFeature::HandleSetType::const_iterator f_it = map[i].getFeatures().begin(); f_it != map[i].getFeatures().end(); ++f_it)
+    {
+      if (f_it->getMapIndex() == 0) int_0 = f_it->getIntensity();
+      else int_1 = f_it->getIntensity();
+    }
+    TEST_REAL_SIMILAR(int_0, int_1)
+    TEST_REAL_SIMILAR(int_0, (ints_0[i] + ints_1[i]) / 2.0)
+  }
+}
+END_SECTION
+
 START_SECTION((static void resample(const std::vector< double > &data_in, std::vector< double > &data_out, UInt n_resampling_points)))
 {
   // TODO
@@ -47,6 +47,18 @@ START_SECTION(void loadFromOBO(const String &name, const String &filename))
 	TEST_EQUAL(cv.name(),"bla")
 END_SECTION
 
+START_SECTION([EXTRA] binary cache roundtrip)
+	// the first load writes the binary cache (unless disabled), later loads read it back;
+	// both paths must yield the same vocabulary
+	ControlledVocabulary cv1, cv2;
+	cv1.loadFromOBO("bla",OPENMS_GET_TEST_DATA_PATH("ControlledVocabulary.obo"));
+	cv2.loadFromOBO("bla",OPENMS_GET_TEST_DATA_PATH("ControlledVocabulary.obo"));
+	TEST_EQUAL(cv1.getTerms().size(),cv2.getTerms().size())
+	TEST_EQUAL(cv1.getTerm("OpenMS:1").name,cv2.getTerm("OpenMS:1").name)
+	TEST_EQUAL(cv1.getTerm("OpenMS:1").synonyms.size(),cv2.getTerm("OpenMS:1").synonyms.size())
+	TEST_EQUAL(cv1.getTerm("OpenMS:2").parents.size(),cv2.getTerm("OpenMS:2").parents.size())
+END_SECTION
+
 START_SECTION(bool exists(const String& id) const)
 	TEST_EQUAL(cv.exists("OpenMS:1"),true)
 	TEST_EQUAL(cv.exists("OpenMS:2"),true)
@@ -281,6 +281,45 @@ START_SECTION((Size compress()))
 END_SECTION
 
 
+START_SECTION((bool compact()))
+{
+  // build a scan-shaped hull and simulate a featureXML round trip
+  // (only the outer points survive the round trip)
+  ConvexHull2D tmp;
+  tmp.addPoint(DPosition<2>(1., 1.));
+  tmp.addPoint(DPosition<2>(1., 10.));
+  tmp.addPoint(DPosition<2>(2., 2.));
+  tmp.addPoint(DPosition<2>(2., 9.));
+  tmp.addPoint(DPosition<2>(3., 1.));
+  tmp.addPoint(DPosition<2>(3., 10.));
+
+  ConvexHull2D loaded;
+  loaded.setHullPoints(tmp.getHullPoints());
+  // only outer points -> encloses() not supported
+  TEST_EXCEPTION(Exception::NotImplemented, loaded.encloses(DPosition<2>(2., 5.)))
+
+  // compact representation can be restored from the scan-walk shape
+  TEST_EQUAL(loaded.compact(), true)
+  TEST_EQUAL(loaded.getHullPoints() == tmp.getHullPoints(), true)
+  TEST_EQUAL(loaded.encloses(DPosition<2>(2., 5.)), true)
+  TEST_EQUAL(loaded.encloses(DPosition<2>(2., 0.5)), false)
+
+  // second call is a no-op
+  TEST_EQUAL(loaded.compact(), true)
+
+  // empty hull is trivially compact
+  ConvexHull2D empty;
+  TEST_EQUAL(empty.compact(), true)
+
+  // a true convex hull (points not in scan-walk order) cannot be compacted and stays untouched
+  ConvexHull2D legacy;
+  legacy.setHullPoints(vec);
+  TEST_EQUAL(legacy.compact(), false)
+  TEST_EQUAL(legacy.getHullPoints() == vec, true)
+  TEST_EXCEPTION(Exception::NotImplemented, legacy.encloses(DPosition<2>(2.0, 2.0)))
+}
+END_SECTION
+
 START_SECTION((void expandToBoundingBox()))
 {
   ConvexHull2D tmp;
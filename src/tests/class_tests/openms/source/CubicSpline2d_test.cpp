@@ -111,6 +111,26 @@ START_SECTION(double eval(double x))
   }
 END_SECTION
 
+START_SECTION(void eval(std::vector<double>::const_iterator x_begin, std::vector<double>::const_iterator x_end, std::vector<double>::iterator y_begin))
+  // batch evaluation over ascending positions matches the scalar version
+  std::vector<double> positions;
+  for (Size i=0; i<(n+6); ++i)
+  {
+    positions.push_back(x_min + (double)i/(n+5)*(x_max-x_min));
+  }
+  std::vector<double> values(positions.size());
+  sp5.eval(positions.begin(), positions.end(), values.begin());
+  for (Size i=0; i<positions.size(); ++i)
+  {
+    TEST_REAL_SIMILAR(values[i], sp5.eval(positions[i]));
+  }
+  // empty range is allowed
+  sp5.eval(positions.begin(), positions.begin(), values.begin());
+  // out-of-range positions throw
+  std::vector<double> out_of_range(1, x_max + 1.0);
+  TEST_EXCEPTION(Exception::IllegalArgument, sp5.eval(out_of_range.begin(), out_of_range.end(), values.begin()));
+END_SECTION
+
 START_SECTION(double derivatives(double x, unsigned order))
   // near border of spline range
   TEST_REAL_SIMILAR(sp1.derivatives(486.785,1), 39270152.2996247)
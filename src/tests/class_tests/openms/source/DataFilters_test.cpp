@@ -14,6 +14,7 @@
 #include <OpenMS/FILTERING/DATAREDUCTION/DataFilters.h>
 #include <OpenMS/KERNEL/Feature.h>
 #include <OpenMS/KERNEL/ConsensusFeature.h>
+#include <OpenMS/KERNEL/MSExperiment.h>
 #include <OpenMS/KERNEL/Peak1D.h>
 
 ///////////////////////////
@@ -336,6 +337,51 @@ START_SECTION((template < class PeakType > bool passes(const MSSpectrum &spectru
 
 END_SECTION
 
+START_SECTION((void passedIndices(const MSSpectrum& spectrum, std::vector<Size>& indices) const))
+
+	filters.clear();
+	std::vector<Size> indices;
+	filters.passedIndices(spec, indices); // inactive filters: everything passes
+	TEST_EQUAL(indices.size(), 3)
+
+	filters.add(filter_1); // "Intensity <= 201.334"
+	filters.passedIndices(spec, indices);
+	ABORT_IF(indices.size() != 2)
+	TEST_EQUAL(indices[0], 0)
+	TEST_EQUAL(indices[1], 2)
+
+	filters.add(filter_5); // && "Meta::test_int <= 0"
+	filters.passedIndices(spec, indices);
+	ABORT_IF(indices.size() != 1)
+	TEST_EQUAL(indices[0], 2)
+
+	filters.clear();
+	filters.add(filter_2); // "Intensity >= 1000" (single-threshold fast path)
+	filters.passedIndices(spec, indices);
+	ABORT_IF(indices.size() != 1)
+	TEST_EQUAL(indices[0], 1)
+
+	filters.clear();
+	filters.add(filter_12); // "Meta::test_dummy2 exists" - array is missing
+	filters.passedIndices(spec, indices);
+	TEST_EQUAL(indices.size(), 0)
+
+END_SECTION
+
+START_SECTION((void filterPeakMap(MSExperiment& exp) const))
+
+	MSExperiment exp;
+	exp.addSpectrum(spec);
+	filters.clear();
+	filters.add(filter_2); // "Intensity >= 1000"
+	filters.filterPeakMap(exp);
+	ABORT_IF(exp[0].size() != 1)
+	TEST_REAL_SIMILAR(exp[0][0].getIntensity(), 2008.2)
+	TEST_EQUAL(exp[0].getFloatDataArrays()[0].size(), 1) // data arrays kept in sync
+	TEST_REAL_SIMILAR(exp[0].getFloatDataArrays()[0][0], 10)
+
+END_SECTION
+
 
 START_SECTION((bool passes(const Feature& feature) const))
 
@@ -161,6 +161,12 @@ START_SECTION((DataValue(const String&)))
   TEST_EQUAL((String)d, "test string")
 END_SECTION
 
+START_SECTION((DataValue(String&&)))
+  String s = "test string with enough characters to require heap storage";
+  DataValue d(std::move(s));
+  TEST_EQUAL((String)d, "test string with enough characters to require heap storage")
+END_SECTION
+
 START_SECTION((DataValue(const StringList &)))
   StringList sl;
   sl << "test string" << "test String 2";
@@ -168,6 +174,13 @@ START_SECTION((DataValue(const StringList &)))
   TEST_TRUE(d == sl)
 END_SECTION
 
+START_SECTION((DataValue(StringList&&)))
+  StringList sl;
+  sl << "test string" << "test String 2";
+  DataValue d(StringList(sl));
+  TEST_TRUE(d == sl)
+END_SECTION
+
 START_SECTION((DataValue(const IntList &)))
   IntList il;
   il.push_back(1);
@@ -885,6 +898,15 @@ START_SECTION((DataValue& operator=(const String&)))
 }
 END_SECTION
 
+START_SECTION((DataValue& operator=(String&&)))
+{
+  String v = "a value with enough characters to require heap storage";
+  DataValue a("v");
+  a = std::move(v);
+  TEST_EQUAL((String)a, "a value with enough characters to require heap storage")
+}
+END_SECTION
+
 START_SECTION((DataValue& operator=(const QString&)))
 {
   QString v = "value";
@@ -907,6 +929,19 @@ START_SECTION((DataValue& operator=(const StringList&)))
 }
 END_SECTION
 
+START_SECTION((DataValue& operator=(StringList&&)))
+{
+  StringList v = ListUtils::create<String>("value,value2");
+  DataValue a("v");
+  a = StringList(v);
+  StringList sla = a;
+  TEST_EQUAL(sla.size(), 2)
+  ABORT_IF(sla.size() != 2)
+  TEST_EQUAL(sla[0], "value")
+  TEST_EQUAL(sla[1], "value2")
+}
+END_SECTION
+
 START_SECTION((DataValue& operator=(const IntList&)))
 {
   IntList v = ListUtils::create<Int>("2,-3");
@@ -8,8 +8,11 @@
 
 #include <OpenMS/CONCEPT/ClassTest.h>
 #include <OpenMS/CHEMISTRY/AASequence.h>
+#include <OpenMS/CHEMISTRY/ProteaseDigestion.h>
 #include <OpenMS/test_config.h>
 
+#include <algorithm>
+
 ///////////////////////////
 
 #include <OpenMS/CHEMISTRY/DecoyGenerator.h>
@@ -59,6 +62,81 @@ START_SECTION((AASequence shufflePeptides(const AASequence& aas, const String& p
   TEST_EQUAL(dg->shufflePeptides(AASequence::fromString("TESTRPEPTRIDE"), "Trypsin").toString(), "ETPSERTTPREID")
 END_SECTION
 
+START_SECTION((static String generateDecoySequence(const String& sequence, Method method, const ProteaseDigestion& digestion, int max_attempts, Math::RandomShuffler& shuffler)))
+  ProteaseDigestion digestion;
+  digestion.setMissedCleavages(0);
+  digestion.setEnzyme("Trypsin");
+  digestion.setSpecificity(EnzymaticDigestion::SPEC_NONE);
+
+  Math::RandomShuffler shuffler;
+  shuffler.seed(4711);
+
+  // byte-level results match the AASequence-based methods
+  TEST_EQUAL(DecoyGenerator::generateDecoySequence("PRTEINE", DecoyGenerator::Method::REVERSE_PROTEIN, digestion, 100, shuffler), "ENIETRP")
+  TEST_EQUAL(DecoyGenerator::generateDecoySequence("TESTPEPTIDE", DecoyGenerator::Method::REVERSE_PEPTIDES, digestion, 100, shuffler), "EDITPEPTSET")
+  TEST_EQUAL(DecoyGenerator::generateDecoySequence("TESTRPEPTRIDE", DecoyGenerator::Method::REVERSE_PEPTIDES, digestion, 100, shuffler), "TPEPRTSETREDI")
+  TEST_EQUAL(DecoyGenerator::generateDecoySequence("", DecoyGenerator::Method::REVERSE_PEPTIDES, digestion, 100, shuffler), "")
+
+  // shuffling is reproducible for a fixed seed, permutes the sequence and keeps cutting sites
+  shuffler.seed(4711);
+  String shuffled = DecoyGenerator::generateDecoySequence("TESTRPEPTRIDE", DecoyGenerator::Method::SHUFFLE_PEPTIDES, digestion, 100, shuffler);
+  shuffler.seed(4711);
+  String shuffled2 = DecoyGenerator::generateDecoySequence("TESTRPEPTRIDE", DecoyGenerator::Method::SHUFFLE_PEPTIDES, digestion, 100, shuffler);
+  TEST_EQUAL(shuffled, shuffled2)
+  TEST_EQUAL(shuffled.size(), 13)
+  TEST_EQUAL(shuffled[9], 'R') // cutting site stays in place (Trypsin does not cleave TR|ID)
+  String sorted_shuffled = shuffled, sorted_target = "TESTRPEPTRIDE";
+  std::sort(sorted_shuffled.begin(), sorted_shuffled.end());
+  std::sort(sorted_target.begin(), sorted_target.end());
+  TEST_EQUAL(sorted_shuffled, sorted_target)
+END_SECTION
+
+START_SECTION((void appendDecoys(std::vector<FASTAFile::FASTAEntry>& db, Method method, const String& protease, const String& decoy_string, bool decoy_string_prefix, int max_attempts) const))
+  std::vector<FASTAFile::FASTAEntry> db;
+  db.emplace_back("P1", "first", "PRTEINE");
+  db.emplace_back("P2", "second", "TESTPEPTIDE");
+  dg->appendDecoys(db, DecoyGenerator::Method::REVERSE_PROTEIN, "Trypsin");
+  TEST_EQUAL(db.size(), 4)
+  TEST_EQUAL(db[2].identifier, "DECOY_P1")
+  TEST_EQUAL(db[2].sequence, "ENIETRP")
+  TEST_EQUAL(db[3].identifier, "DECOY_P2")
+  TEST_EQUAL(db[3].sequence, "EDITPEPTSET")
+
+  // reproducible shuffling, independent of the thread count
+  std::vector<FASTAFile::FASTAEntry> db2(db.begin(), db.begin() + 2);
+  std::vector<FASTAFile::FASTAEntry> db3(db.begin(), db.begin() + 2);
+  dg->setSeed(4711);
+  dg->appendDecoys(db2, DecoyGenerator::Method::SHUFFLE_PEPTIDES, "Trypsin");
+  dg->setSeed(4711);
+  dg->appendDecoys(db3, DecoyGenerator::Method::SHUFFLE_PEPTIDES, "Trypsin");
+  TEST_EQUAL(db2[2].sequence, db3[2].sequence)
+  TEST_EQUAL(db2[3].sequence, db3[3].sequence)
+END_SECTION
+
+START_SECTION((void generateDecoyDatabase(const String& in_fasta, const String& out_fasta, Method method, const String& protease, const String& decoy_string, bool decoy_string_prefix, int max_attempts, Size batch_size) const))
+  std::vector<FASTAFile::FASTAEntry> db;
+  db.emplace_back("P1", "first", "PRTEINE");
+  db.emplace_back("P2", "second", "TESTPEPTIDE");
+  String in_fasta, out_fasta;
+  NEW_TMP_FILE(in_fasta)
+  NEW_TMP_FILE(out_fasta)
+  FASTAFile().store(in_fasta, db);
+
+  // batch size of 1 exercises the batching logic
+  dg->generateDecoyDatabase(in_fasta, out_fasta, DecoyGenerator::Method::REVERSE_PEPTIDES, "Trypsin", "DECOY_", true, 100, 1);
+
+  std::vector<FASTAFile::FASTAEntry> result;
+  FASTAFile().load(out_fasta, result);
+  TEST_EQUAL(result.size(), 4)
+  TEST_EQUAL(result[0].identifier, "P1")
+  TEST_EQUAL(result[0].sequence, "PRTEINE")
+  TEST_EQUAL(result[1].identifier, "DECOY_P1")
+  TEST_EQUAL(result[1].sequence, "PRENIET") // Trypsin cleaves PR|TEINE; the cutting site stays in place
+  TEST_EQUAL(result[2].identifier, "P2")
+  TEST_EQUAL(result[3].identifier, "DECOY_P2")
+  TEST_EQUAL(result[3].sequence, "EDITPEPTSET")
+END_SECTION
+
 delete dg;
 
 /////////////////////////////////////////////////////////////
@@ -289,6 +289,60 @@ START_SECTION(static void deisotopeWithAveragineModel(MSSpectrum& spectrum,
 }
 END_SECTION
 
+START_SECTION(static void deisotopeAndSingleCharge(MSExperiment& exp,
+                                                   double fragment_tolerance,
+                                                   bool fragment_unit_ppm,
+                                                   UInt ms_level = 2))
+{
+  MzMLFile file;
+  PeakMap exp;
+  file.load(OPENMS_GET_TEST_DATA_PATH("Deisotoper_test_in.mzML"), exp);
+
+  const UInt level = exp.getSpectrum(0).getMSLevel();
+
+  // reference: per-spectrum deisotoping in a serial loop
+  PeakMap ref = exp;
+  for (Size i = 0; i != ref.size(); ++i)
+  {
+    if (ref[i].getMSLevel() != level) continue;
+    Deisotoper::deisotopeAndSingleCharge(ref[i], 10.0, true, 1, 3, true);
+  }
+
+  Deisotoper::deisotopeAndSingleCharge(exp, 10.0, true, level, 1, 3, true);
+  TEST_EQUAL(exp.size(), ref.size());
+  for (Size i = 0; i != exp.size(); ++i)
+  {
+    TEST_EQUAL(exp[i], ref[i]);
+  }
+
+  // spectra of other MS levels are left untouched
+  PeakMap untouched = ref;
+  Deisotoper::deisotopeAndSingleCharge(untouched, 10.0, true, level + 1, 1, 3, true);
+  for (Size i = 0; i != untouched.size(); ++i)
+  {
+    TEST_EQUAL(untouched[i], ref[i]);
+  }
+}
+END_SECTION
+
+START_SECTION(static void deisotopeWithAveragineModel(MSExperiment& exp,
+                                                      double fragment_tolerance,
+                                                      bool fragment_unit_ppm,
+                                                      UInt ms_level = 2))
+{
+  MzMLFile file;
+  PeakMap exp;
+  file.load(OPENMS_GET_TEST_DATA_PATH("Deisotoper_test_in.mzML"), exp);
+
+  PeakMap out;
+  file.load(OPENMS_GET_TEST_DATA_PATH("Deisotoper_test_out.mzML"), out);
+
+  // the averagine lookup table of the driver reproduces the per-spectrum results here
+  Deisotoper::deisotopeWithAveragineModel(exp, 10.0, true, exp.getSpectrum(0).getMSLevel(), 5000, 1, 3, true);// keep only deisotoped
+  TEST_EQUAL(exp.getSpectrum(0), out.getSpectrum(0));
+}
+END_SECTION
+
 /////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////
 
@@ -0,0 +1,128 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/CHEMISTRY/DigestCache.h>
+#include <OpenMS/CHEMISTRY/ProteaseDigestion.h>
+#include <OpenMS/DATASTRUCTURES/StringView.h>
+#include <cmath>
+#include <vector>
+using namespace OpenMS;
+using namespace std;
+
+///////////////////////////
+
+START_TEST(DigestCache, "$Id$")
+
+/////////////////////////////////////////////////////////////
+
+DigestCache* dc_ptr = nullptr;
+DigestCache* dc_null = nullptr;
+
+START_SECTION((DigestCache()))
+  dc_ptr = new DigestCache;
+  TEST_NOT_EQUAL(dc_ptr, dc_null)
+  TEST_EQUAL(dc_ptr->isLoaded(), false)
+END_SECTION
+
+START_SECTION(([EXTRA] ~DigestCache()))
+  delete dc_ptr;
+  NOT_TESTABLE
+END_SECTION
+
+// small database shared by the remaining sections
+vector<FASTAFile::FASTAEntry> fasta_db;
+fasta_db.emplace_back("P1", "first", "MKWVTFISLLLLFSSAYSRGVFRR");
+fasta_db.emplace_back("P2", "second", "DTHKSEIAHRFKDLGE");
+fasta_db.emplace_back("P3", "third", "RR"); // digests to nothing with the length limits below
+
+ProteaseDigestion digestion;
+digestion.setEnzyme("Trypsin");
+digestion.setMissedCleavages(1);
+
+START_SECTION((static String cacheKey(const std::vector<FASTAFile::FASTAEntry>& fasta_db, const EnzymaticDigestion& digestion, Size min_length, Size max_length)))
+  const String key = DigestCache::cacheKey(fasta_db, digestion, 5, 40);
+  TEST_EQUAL(key.size(), 16)
+  // same input, same key
+  TEST_STRING_EQUAL(DigestCache::cacheKey(fasta_db, digestion, 5, 40), key)
+  // any parameter or database change gives a different key
+  TEST_NOT_EQUAL(DigestCache::cacheKey(fasta_db, digestion, 6, 40) == key, true)
+  ProteaseDigestion digestion2(digestion);
+  digestion2.setMissedCleavages(2);
+  TEST_NOT_EQUAL(DigestCache::cacheKey(fasta_db, digestion2, 5, 40) == key, true)
+  vector<FASTAFile::FASTAEntry> fasta_db2(fasta_db);
+  fasta_db2.pop_back();
+  TEST_NOT_EQUAL(DigestCache::cacheKey(fasta_db2, digestion, 5, 40) == key, true)
+END_SECTION
+
+START_SECTION((static String cacheFileName(const String& cache_dir, const String& key)))
+  TEST_STRING_EQUAL(DigestCache::cacheFileName("/tmp/cache", "0123456789abcdef"), "/tmp/cache/0123456789abcdef.digestcache")
+END_SECTION
+
+START_SECTION((static void store(const String& filename, const String& key, const std::vector<FASTAFile::FASTAEntry>& fasta_db, const EnzymaticDigestion& digestion, Size min_length, Size max_length)))
+  String tmp_filename;
+  NEW_TMP_FILE(tmp_filename);
+  const String key = DigestCache::cacheKey(fasta_db, digestion, 5, 40);
+  DigestCache::store(tmp_filename, key, fasta_db, digestion, 5, 40);
+  DigestCache cache;
+  TEST_EQUAL(cache.load(tmp_filename, key), true)
+  TEST_EQUAL(cache.getNrProteins(), fasta_db.size())
+END_SECTION
+
+START_SECTION((bool load(const String& filename, const String& key)))
+  String tmp_filename;
+  NEW_TMP_FILE(tmp_filename);
+  const String key = DigestCache::cacheKey(fasta_db, digestion, 5, 40);
+  DigestCache::store(tmp_filename, key, fasta_db, digestion, 5, 40);
+
+  DigestCache cache;
+  TEST_EQUAL(cache.load(tmp_filename, key), true)
+  TEST_EQUAL(cache.isLoaded(), true)
+
+  // a different key is rejected and leaves the cache unloaded
+  TEST_EQUAL(cache.load(tmp_filename, "00ffee00ffee00ff"), false)
+  TEST_EQUAL(cache.isLoaded(), false)
+
+  // missing file
+  TEST_EQUAL(cache.load(tmp_filename + ".does_not_exist", key), false)
+END_SECTION
+
+START_SECTION((DigestView getDigest(Size protein_index) const))
+  String tmp_filename;
+  NEW_TMP_FILE(tmp_filename);
+  const String key = DigestCache::cacheKey(fasta_db, digestion, 5, 40);
+  DigestCache::store(tmp_filename, key, fasta_db, digestion, 5, 40);
+  DigestCache cache;
+  TEST_EQUAL(cache.load(tmp_filename, key), true)
+
+  // every protein matches a fresh digest with the same settings
+  for (Size i = 0; i < fasta_db.size(); ++i)
+  {
+    vector<EnzymaticDigestion::PeptideMass> expected;
+    digestion.digestUnmodifiedWithMasses(StringView(fasta_db[i].sequence), expected, 5, 40);
+    DigestCache::DigestView view = cache.getDigest(i);
+    TEST_EQUAL(view.size(), expected.size())
+    ABORT_IF(view.size() != expected.size())
+    for (Size j = 0; j < expected.size(); ++j)
+    {
+      TEST_EQUAL(view[j].position, expected[j].position)
+      TEST_EQUAL(view[j].length, expected[j].length)
+      TEST_REAL_SIMILAR(view[j].mass, expected[j].mass)
+    }
+  }
+  // the protein without products yields an empty view
+  TEST_EQUAL(cache.getDigest(2).size(), 0)
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
@@ -64,6 +64,42 @@ START_SECTION(ValueTypes map(const MSSpectrum& spec) const override)
 }
 END_SECTION
 
+START_SECTION(void map(const MSSpectrum& spec, ValueTypes& out) const override)
+{
+  MSSpectrum spec;
+  spec.push_back({1, 2});
+  spec.push_back({3, 4});
+  DimMZ mz;
+  DimBase::ValueTypes buffer {42}; // stale content is discarded
+  mz.map(spec, buffer);
+  TEST_EQUAL(buffer.size(), 2)
+  TEST_REAL_SIMILAR(buffer[0], 1)
+  TEST_REAL_SIMILAR(buffer[1], 3)
+  DimRT rt;
+  TEST_EXCEPTION(Exception::InvalidRange, rt.map(spec, buffer))
+}
+END_SECTION
+
+START_SECTION(void map(const MSChromatogram& chrom, ValueTypes& out) const override)
+{
+  MSChromatogram chrom;
+  chrom.push_back(ChromatogramPeak(ChromatogramPeak::PositionType(1.0), 2.0f));
+  chrom.push_back(ChromatogramPeak(ChromatogramPeak::PositionType(3.0), 4.0f));
+  DimRT rt;
+  DimBase::ValueTypes buffer;
+  rt.map(chrom, buffer);
+  TEST_EQUAL(buffer.size(), 2)
+  TEST_REAL_SIMILAR(buffer[0], 1)
+  TEST_REAL_SIMILAR(buffer[1], 3)
+  DimINT intensity;
+  intensity.map(chrom, buffer);
+  TEST_EQUAL(buffer.size(), 2)
+  TEST_REAL_SIMILAR(buffer[1], 4)
+  DimMZ mz;
+  TEST_EXCEPTION(Exception::InvalidRange, mz.map(chrom, buffer))
+}
+END_SECTION
+
 START_SECTION(ValueType map(MSExperiment::ConstAreaIterator it) const override)
 {
   DimRT rt;
@@ -188,6 +224,22 @@ START_SECTION(template<typename T> Point map(const T& data))
 }
 END_SECTION
 
+START_SECTION(template<typename Container> void map(const Container& data, std::array<DimBase::ValueTypes, N_DIM>& out) const)
+{
+  MSSpectrum spec;
+  spec.push_back({1, 2});
+  spec.push_back({3, 4});
+  const DIM_UNIT unitsMI[2] {DIM_UNIT::MZ, DIM_UNIT::INT};
+  DimMapper<2> d1(unitsMI);
+  std::array<DimBase::ValueTypes, 2> buffers;
+  d1.map(spec, buffers);
+  TEST_EQUAL(buffers[0].size(), 2)
+  TEST_EQUAL(buffers[1].size(), 2)
+  TEST_REAL_SIMILAR(buffers[0][1], 3)
+  TEST_REAL_SIMILAR(buffers[1][0], 2)
+}
+END_SECTION
+
 using FullRange = RangeManager<RangeRT, RangeMZ, RangeIntensity, RangeMobility>;
 
 //auto na = nan("");
@@ -258,6 +310,102 @@ START_SECTION(const DimBase& getDim(DIM d) const)
 }
 END_SECTION
 
+using StaticMapperRMI = StaticDimMapper<DimRT, DimMZ, DimINT>;
+
+/////// TEST for StaticDimMapper class
+START_SECTION(StaticDimMapper())
+{
+  DimMapperMZInt dm;
+  TEST_TRUE(dm.getDim(DIM::X).getUnit() == DIM_UNIT::MZ)
+  TEST_TRUE(dm.getDim(DIM::Y).getUnit() == DIM_UNIT::INT)
+}
+END_SECTION
+
+START_SECTION(explicit StaticDimMapper(DimTypes... dims))
+{
+  DimMapperIMInt dm(DimIM(DIM_UNIT::IM_MS), DimINT());
+  TEST_TRUE(dm.getDim(DIM::X).getUnit() == DIM_UNIT::IM_MS)
+  TEST_TRUE(dm.getDim(DIM::Y).getUnit() == DIM_UNIT::INT)
+}
+END_SECTION
+
+START_SECTION(bool operator==(const StaticDimMapper& rhs) const)
+{
+  DimMapperIMInt dm1(DimIM(DIM_UNIT::IM_MS), DimINT());
+  DimMapperIMInt dm2(DimIM(DIM_UNIT::IM_MS), DimINT());
+  TEST_TRUE(dm1 == dm2)
+  DimMapperIMInt dm3(DimIM(DIM_UNIT::FAIMS_CV), DimINT());
+  TEST_FALSE(dm1 == dm3)
+}
+END_SECTION
+
+START_SECTION(bool operator!=(const StaticDimMapper& rhs) const)
+{
+  DimMapperIMInt dm1(DimIM(DIM_UNIT::IM_MS), DimINT());
+  DimMapperIMInt dm3(DimIM(DIM_UNIT::FAIMS_CV), DimINT());
+  TEST_TRUE(dm1 != dm3)
+  TEST_FALSE(dm1 != dm1)
+}
+END_SECTION
+
+START_SECTION(template<typename T> Point map(const T& data) const)
+{
+  StaticMapperRMI dm;
+  Feature f1;
+  f1.setRT(1);
+  f1.setMZ(2);
+  f1.setIntensity(3);
+  TEST_EQUAL(dm.map(f1), StaticMapperRMI::Point(1, 2, 3))
+}
+END_SECTION
+
+START_SECTION(template<typename Container> Point map(const Container& data, const Size index) const)
+{
+  MSSpectrum spec;
+  spec.push_back({1, 2});
+  spec.push_back({3, 4});
+  DimMapperMZInt dm;
+  TEST_EQUAL(dm.map(spec, 1), DimMapperMZInt::Point(3, 4))
+}
+END_SECTION
+
+START_SECTION(template<typename Container> void map(const Container& data, std::array<DimBase::ValueTypes, N_DIM>& out) const)
+{
+  MSSpectrum spec;
+  spec.push_back({1, 2});
+  spec.push_back({3, 4});
+  DimMapperMZInt dm;
+  std::array<DimBase::ValueTypes, 2> buffers;
+  dm.map(spec, buffers);
+  TEST_EQUAL(buffers[0].size(), 2)
+  TEST_EQUAL(buffers[1].size(), 2)
+  TEST_REAL_SIMILAR(buffers[0][0], 1)
+  TEST_REAL_SIMILAR(buffers[1][1], 4)
+}
+END_SECTION
+
+START_SECTION(template<typename... Ranges> DRange<N_DIM> mapRange(const RangeManager<Ranges...>& ranges) const)
+{
+  RangeManager<RangeRT, RangeMZ, RangeIntensity, RangeMobility> fr;
+  fr.extendMobility(4); // not considered
+  fr.extendRT(1);
+  fr.extendRT(1.1);
+  fr.extendIntensity(3);
+  DimMapperRTInt dm;
+  auto areaXY = dm.mapRange(fr);
+  DRange<2> res;
+  res.setDimMinMax(0, {1, 1.1});
+  res.setDimMinMax(1, {3, 3});
+  TEST_EQUAL(areaXY, res)
+}
+END_SECTION
+
+START_SECTION(const DimBase& getDim(DIM d) const)
+{
+  NOT_TESTABLE // tested in the constructor sections above
+}
+END_SECTION
+
 DimMapper3 dm_IMR(unitsIMR);
 DimMapper3 dm_RMI(unitsRMI);
 using Area3 = Area<3>;
@@ -296,6 +296,43 @@ START_SECTION((void fit(FeatureFinderAlgorithmPickedHelperStructs::MassTraces& t
 }
 END_SECTION
 
+START_SECTION((static std::vector<char> fitBatch(std::vector<FeatureFinderAlgorithmPickedHelperStructs::MassTraces>& traces_vec, std::vector<std::shared_ptr<TraceFitter>>& fitters)))
+{
+  // restore the trace weights changed by the weighted fit above
+  mts[0].theoretical_int = 0.8;
+  mts[1].theoretical_int = 0.2;
+
+  // two identical fits plus one which cannot be fitted (fewer data points than parameters)
+  std::vector<FeatureFinderAlgorithmPickedHelperStructs::MassTraces> traces_vec(2, mts);
+
+  FeatureFinderAlgorithmPickedHelperStructs::MassTrace short_mt;
+  short_mt.theoretical_int = 1.0;
+  short_mt.peaks.push_back(make_pair(677.1, &p1_1));
+  FeatureFinderAlgorithmPickedHelperStructs::MassTraces short_mts;
+  short_mts.push_back(short_mt);
+  short_mts.max_trace = 0;
+  traces_vec.push_back(short_mts);
+
+  std::vector<std::shared_ptr<TraceFitter>> fitters;
+  for (Size i = 0; i < traces_vec.size(); ++i)
+  {
+    fitters.push_back(std::make_shared<EGHTraceFitter>());
+  }
+
+  std::vector<char> success = TraceFitter::fitBatch(traces_vec, fitters);
+  TEST_EQUAL(success.size(), 3)
+  TEST_EQUAL(success[0], 1)
+  TEST_EQUAL(success[1], 1)
+  TEST_EQUAL(success[2], 0)
+  TEST_REAL_SIMILAR(fitters[0]->getCenter(), expected_x0)
+  TEST_REAL_SIMILAR(fitters[0]->getHeight(), expected_H)
+  TEST_REAL_SIMILAR(fitters[1]->getCenter(), expected_x0)
+
+  fitters.pop_back();
+  TEST_EXCEPTION(Exception::IllegalArgument, TraceFitter::fitBatch(traces_vec, fitters))
+}
+END_SECTION
+
 START_SECTION((double getLowerRTBound() const))
 {
   TEST_REAL_SIMILAR(egh_trace_fitter.getLowerRTBound(), expected_x0 - 2.5 * expected_sigma)
@@ -353,6 +353,35 @@ START_SECTION(void fitEMGPeakModel(
 }
 END_SECTION
 
+START_SECTION(void fitEMGPeakModelBatch(
+  const std::vector<MSChromatogram>& input_peaks,
+  std::vector<MSChromatogram>& output_peaks
+) const)
+{
+  EmgGradientDescent emg;
+
+  const std::vector<MSChromatogram> inputs { chromatogram, saturated_chrom_min, cutoff_chrom_min };
+  std::vector<MSChromatogram> outputs;
+  emg.fitEMGPeakModelBatch(inputs, outputs);
+  ABORT_IF(outputs.size() != 3)
+
+  // same results as fitting the peaks one by one
+  for (Size i = 0; i < inputs.size(); ++i)
+  {
+    MSChromatogram out_single;
+    emg.fitEMGPeakModel(inputs[i], out_single);
+    TEST_EQUAL(outputs[i].size(), out_single.size())
+    const MSChromatogram::FloatDataArray& fda_batch = outputs[i].getFloatDataArrays()[0];
+    const MSChromatogram::FloatDataArray& fda_single = out_single.getFloatDataArrays()[0];
+    TEST_EQUAL(fda_batch.getName(), "emg_parameters")
+    for (Size j = 0; j < 4; ++j)
+    {
+      TEST_REAL_SIMILAR(fda_batch[j], fda_single[j])
+    }
+  }
+}
+END_SECTION
+
 START_SECTION(double Loss_function(
   const std::vector<double>& xs,
   const std::vector<double>& ys,
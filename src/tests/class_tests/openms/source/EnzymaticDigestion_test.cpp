@@ -11,9 +11,11 @@
 
 ///////////////////////////
 
+#include <OpenMS/CHEMISTRY/AASequence.h>
 #include <OpenMS/CHEMISTRY/EnzymaticDigestion.h>
 #include <OpenMS/DATASTRUCTURES/StringView.h>
 #include <OpenMS/CHEMISTRY/ProteaseDB.h>
+#include <cmath>
 #include <vector>
 using namespace OpenMS;
 using namespace std;
@@ -82,6 +84,45 @@ START_SECTION((void setEnzyme(const DigestionEnzyme* enzyme)))
     TEST_EQUAL(ed.getEnzymeName(), "Trypsin/P");
 END_SECTION
 
+START_SECTION([EXTRA] table-driven cleavage matching equals the regex engine)
+{
+  // enzymes whose regex is a lookbehind/lookahead set are matched with byte
+  // tables; wrapping the same pattern in a group forces the regex engine, so
+  // both paths can be compared on identical rules
+  std::vector<std::pair<String, String> > rules = {
+    { "(?<=[KR])(?!P)", "((?<=[KR])(?!P))" }, // Trypsin
+    { "(?<=[KR])", "((?<=[KR]))" },           // Trypsin/P
+    { "(?<=K)(?!P)", "((?<=K)(?!P))" },       // Lys-C
+    { "(?<=[A-Z])", "((?<=[A-Z]))" }          // unspecific cleavage
+  };
+  std::vector<String> sequences = {
+    "ARCDKPEKRAKGR", "KKK", "RPRPRP", "MNOPQ", "K"
+  };
+  for (const auto& rule : rules)
+  {
+    DigestionEnzyme fast_enzyme("fast_rule", rule.first, std::set<String>());
+    DigestionEnzyme slow_enzyme("slow_rule", rule.second, std::set<String>());
+    EnzymaticDigestion fast, slow;
+    fast.setEnzyme(&fast_enzyme);
+    slow.setEnzyme(&slow_enzyme);
+    fast.setMissedCleavages(1);
+    slow.setMissedCleavages(1);
+    for (const String& seq : sequences)
+    {
+      std::vector<StringView> out_fast, out_slow;
+      fast.digestUnmodified(StringView(seq), out_fast);
+      slow.digestUnmodified(StringView(seq), out_slow);
+      ABORT_IF(out_fast.size() != out_slow.size())
+      for (Size i = 0; i < out_fast.size(); ++i)
+      {
+        TEST_EQUAL(out_fast[i].getString(), out_slow[i].getString())
+      }
+      TEST_EQUAL(fast.countInternalCleavageSites(seq), slow.countInternalCleavageSites(seq))
+    }
+  }
+}
+END_SECTION
+
 START_SECTION((Specificity getSpecificity() const))
     EnzymaticDigestion ed;
     TEST_EQUAL(ed.getSpecificity(), EnzymaticDigestion::SPEC_FULL);
@@ -282,6 +323,49 @@ START_SECTION((Size digestUnmodified(const StringView sequence, std::vector<Stri
 }
 END_SECTION
 
+START_SECTION((Size digestUnmodifiedWithMasses(const StringView& sequence, std::vector<PeptideMass>& output, Size min_length, Size max_length)))
+{
+    EnzymaticDigestion ed;
+    ed.setMissedCleavages(1);
+    vector<StringView> peptides;
+    vector<EnzymaticDigestion::PeptideMass> out;
+
+    // products and their order match the plain digest; masses match AASequence
+    std::string s = "ARCDRE";
+    ed.digestUnmodified(s, peptides);
+    ed.digestUnmodifiedWithMasses(s, out);
+    TEST_EQUAL(out.size(), peptides.size())
+    TEST_EQUAL(out.size(), 5)
+    for (Size i = 0; i < out.size(); ++i)
+    {
+      String pep = s.substr(out[i].position, out[i].length);
+      TEST_EQUAL(pep, peptides[i].getString())
+      TEST_REAL_SIMILAR(out[i].mass, AASequence::fromString(pep).getMonoWeight())
+    }
+
+    // length restrictions are applied identically
+    TEST_EQUAL(ed.digestUnmodifiedWithMasses(s, out, 3, 5), 2)
+    TEST_EQUAL(out.size(), 3)
+
+    // peptides containing 'X' are reported with NaN mass; others are unaffected
+    s = "ARCXRE";
+    ed.digestUnmodifiedWithMasses(s, out);
+    TEST_EQUAL(out.size(), 5)
+    for (const auto& p : out)
+    {
+      String pep = s.substr(p.position, p.length);
+      if (pep.has('X'))
+      {
+        TEST_EQUAL(std::isnan(p.mass), true)
+      }
+      else
+      {
+        TEST_REAL_SIMILAR(p.mass, AASequence::fromString(pep).getMonoWeight())
+      }
+    }
+}
+END_SECTION
+
 START_SECTION((bool isValidProduct(const String& sequence, int pos, int length, bool ignore_missed_cleavages)))
 {
     EnzymaticDigestion ed;
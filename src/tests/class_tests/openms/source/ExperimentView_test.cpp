@@ -0,0 +1,102 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/KERNEL/ExperimentView.h>
+using namespace OpenMS;
+using namespace std;
+
+///////////////////////////
+
+START_TEST(ExperimentView, "$Id$")
+
+/////////////////////////////////////////////////////////////
+
+// experiment with 5 spectra at RT 1..5, each with one peak at m/z (100 + RT)
+MSExperiment exp;
+for (Size i = 1; i <= 5; ++i)
+{
+  MSSpectrum spec;
+  spec.setRT(i);
+  spec.setMSLevel(1);
+  spec.emplace_back(Peak1D(100.0 + i, 10.0f * i));
+  exp.addSpectrum(spec);
+}
+
+START_SECTION((ExperimentView(Iterator first, Iterator last)))
+  ExperimentView view(exp.begin() + 1, exp.begin() + 4);
+  TEST_EQUAL(view.size(), 3)
+  TEST_EQUAL(view.empty(), false)
+  TEST_REAL_SIMILAR(view.begin()->getRT(), 2.0)
+  TEST_REAL_SIMILAR((view.end() - 1)->getRT(), 4.0)
+END_SECTION
+
+START_SECTION((ExperimentView(MSExperiment& exp, CoordinateType min_rt, CoordinateType max_rt)))
+  ExperimentView view(exp, 2.0, 4.0);
+  TEST_EQUAL(view.size(), 3)
+  TEST_REAL_SIMILAR(view[0].getRT(), 2.0)
+  TEST_REAL_SIMILAR(view[2].getRT(), 4.0)
+
+  // no copies: the view references the spectra of the experiment
+  TEST_EQUAL(&view[0], &exp[1])
+
+  // empty window
+  ExperimentView empty_view(exp, 10.0, 20.0);
+  TEST_EQUAL(empty_view.empty(), true)
+  TEST_EQUAL(empty_view.size(), 0)
+END_SECTION
+
+START_SECTION((void updateRanges()))
+  ExperimentView view(exp, 2.0, 4.0);
+  view.updateRanges();
+  TEST_REAL_SIMILAR(view.getMinRT(), 2.0)
+  TEST_REAL_SIMILAR(view.getMaxRT(), 4.0)
+  TEST_REAL_SIMILAR(view.getMinMZ(), 102.0)
+  TEST_REAL_SIMILAR(view.getMaxMZ(), 104.0)
+  TEST_REAL_SIMILAR(view.getMaxIntensity(), 40.0)
+  TEST_EQUAL(view.getSize(), 3)
+END_SECTION
+
+START_SECTION((void updateRanges(Int ms_level)))
+  // add an MS2 spectrum inside the window
+  MSExperiment exp2(exp);
+  MSSpectrum ms2;
+  ms2.setRT(2.5);
+  ms2.setMSLevel(2);
+  ms2.emplace_back(Peak1D(500.0, 99.0f));
+  exp2.addSpectrum(ms2);
+  exp2.sortSpectra();
+
+  ExperimentView view(exp2, 2.0, 4.0);
+  TEST_EQUAL(view.size(), 4)
+
+  view.updateRanges(2);
+  TEST_REAL_SIMILAR(view.getMinMZ(), 500.0)
+  TEST_REAL_SIMILAR(view.getMaxMZ(), 500.0)
+  TEST_EQUAL(view.getSize(), 1)
+
+  view.updateRanges(1);
+  TEST_REAL_SIMILAR(view.getMinMZ(), 102.0)
+  TEST_REAL_SIMILAR(view.getMaxMZ(), 104.0)
+  TEST_EQUAL(view.getSize(), 3)
+END_SECTION
+
+START_SECTION((SpectrumType& operator[](Size n)))
+  ExperimentView view(exp, 2.0, 4.0);
+  // modifications through the view hit the underlying experiment
+  view[0][0].setIntensity(123.0f);
+  TEST_REAL_SIMILAR(exp[1][0].getIntensity(), 123.0)
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
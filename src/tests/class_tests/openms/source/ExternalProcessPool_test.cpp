@@ -0,0 +1,118 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+#include <OpenMS/SYSTEM/ExternalProcessPool.h>
+///////////////////////////
+
+#include <OpenMS/config.h>
+
+using namespace OpenMS;
+using namespace std;
+
+// we just need ANY commandline tool available on (hopefully) all boxes.
+// note that commands like "dir" or "type" are only known within cmd.exe and are not actual executables (unlike on Linux)
+#ifdef OPENMS_WINDOWSPLATFORM
+  const QString exe = "cmd";
+  const QStringList args = QStringList() << "/C" << "echo hi";
+  const QStringList args_broken = QStringList() << "/C" << "doesnotexist";
+#else
+  const QString exe = "ls";
+  const QStringList args("-l");
+  const QStringList args_broken = QStringList() << "-0";
+#endif //
+
+START_TEST(ExternalProcessPool, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+START_SECTION(ExternalProcessPool(Size max_concurrent = 1))
+  ExternalProcessPool pool(2);
+  TEST_EQUAL(pool.getResults().empty(), true)
+  TEST_EXCEPTION(Exception::IllegalArgument, ExternalProcessPool(0))
+END_SECTION
+
+START_SECTION(Size enqueue(const QString& exe, const QStringList& args, const QString& working_dir = QString()))
+  ExternalProcessPool pool(2);
+  TEST_EQUAL(pool.enqueue(exe, args), 0)
+  TEST_EQUAL(pool.enqueue(exe, args), 1)
+END_SECTION
+
+START_SECTION(const std::vector<JobResult>& runAll(bool verbose = false))
+{
+  { // three jobs, two at a time; results in submission order
+    ExternalProcessPool pool(2);
+    pool.enqueue(exe, args);
+    pool.enqueue(exe, args_broken);
+    pool.enqueue("this_exe_does_not_exist", args);
+    const auto& results = pool.runAll();
+    TEST_EQUAL(results.size(), 3)
+    TEST_EQUAL(results[0].state == ExternalProcess::RETURNSTATE::SUCCESS, true)
+    TEST_EQUAL(results[0].exit_code, 0)
+    TEST_NOT_EQUAL(results[0].stdout_output.size(), 0)
+    TEST_EQUAL(results[0].error_msg.size(), 0)
+    TEST_EQUAL(results[1].state == ExternalProcess::RETURNSTATE::NONZERO_EXIT, true)
+    TEST_NOT_EQUAL(results[1].error_msg.size(), 0)
+    TEST_EQUAL(results[2].state == ExternalProcess::RETURNSTATE::FAILED_TO_START, true)
+    TEST_NOT_EQUAL(results[2].error_msg.size(), 0)
+  }
+  { // with live callbacks, tagged with the job index
+    String all_out, all_err;
+    Size out_job = 4711;
+    ExternalProcessPool pool(1);
+    pool.setCallbacks([&](Size job, const String& out) { out_job = job; all_out += out; },
+                      [&](Size /*job*/, const String& err) { all_err += err; });
+    pool.enqueue(exe, args);
+    const auto& results = pool.runAll(true);
+    TEST_EQUAL(results.size(), 1)
+    TEST_EQUAL(results[0].state == ExternalProcess::RETURNSTATE::SUCCESS, true)
+    TEST_EQUAL(out_job, 0)
+    TEST_NOT_EQUAL(all_out.size(), 0)
+    TEST_EQUAL(all_err.size(), 0)
+  }
+}
+END_SECTION
+
+START_SECTION(const std::vector<JobResult>& getResults() const)
+  ExternalProcessPool pool(2);
+  pool.enqueue(exe, args);
+  pool.runAll();
+  TEST_EQUAL(pool.getResults().size(), 1)
+  TEST_EQUAL(pool.getResults()[0].wall_time_sec >= 0.0, true)
+END_SECTION
+
+START_SECTION(bool allSucceeded() const)
+  ExternalProcessPool pool(2);
+  pool.enqueue(exe, args);
+  pool.runAll();
+  TEST_EQUAL(pool.allSucceeded(), true)
+  pool.enqueue(exe, args_broken);
+  pool.runAll();
+  TEST_EQUAL(pool.allSucceeded(), false)
+END_SECTION
+
+START_SECTION(void setCallbacks(std::function<void(Size, const String&)> callbackStdOut, std::function<void(Size, const String&)> callbackStdErr))
+  NOT_TESTABLE; // tested above
+END_SECTION
+
+START_SECTION(void clear())
+  ExternalProcessPool pool(2);
+  pool.enqueue(exe, args);
+  pool.runAll();
+  pool.clear();
+  TEST_EQUAL(pool.getResults().empty(), true)
+  TEST_EQUAL(pool.runAll().empty(), true)
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
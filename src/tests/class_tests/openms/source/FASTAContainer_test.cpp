@@ -194,6 +194,33 @@ START_SECTION(size_t size() const)
 
 END_SECTION
 
+START_SECTION([AccessionIndex] Size find(std::string_view key) const)
+  std::vector<std::string> accs = { "P12345", "DECOY_P12345", "Q99999" };
+  AccessionIndex idx;
+  idx.build({ accs[0], accs[1], accs[2] });
+  TEST_EQUAL(idx.size(), 3)
+  TEST_EQUAL(idx.find("P12345"), 0)
+  TEST_EQUAL(idx.find("DECOY_P12345"), 1)
+  TEST_EQUAL(idx.find("Q99999"), 2)
+  TEST_EQUAL(idx.find("P1234"), AccessionIndex::npos)
+  TEST_EQUAL(idx.find(""), AccessionIndex::npos)
+  // duplicates resolve to the first occurrence
+  idx.build({ accs[0], accs[0], accs[2] });
+  TEST_EQUAL(idx.find("P12345"), 0)
+  // empty index
+  AccessionIndex empty_idx;
+  TEST_EQUAL(empty_idx.find("P12345"), AccessionIndex::npos)
+END_SECTION
+
+START_SECTION([AccessionIndex] bool has(std::string_view key) const)
+  std::vector<std::string> accs = { "P12345", "Q99999" };
+  AccessionIndex idx;
+  idx.build({ accs[0], accs[1] });
+  TEST_EQUAL(idx.has("P12345"), true)
+  TEST_EQUAL(idx.has("Q99999"), true)
+  TEST_EQUAL(idx.has("A00001"), false)
+END_SECTION
+
 START_SECTION(Result findDecoyString(FASTAContainer<T>& proteins))
 // test without decoys in input
   FASTAContainer<TFI_File> f1{OPENMS_GET_TEST_DATA_PATH("FASTAFile_test.fasta")};
@@ -44,6 +44,77 @@ START_SECTION((virtual void group(const std::vector<ConsensusMap>& maps, Consens
 	NOT_TESTABLE;
 END_SECTION
 
+// fixture for the incremental session: two corresponding features per map,
+// well within the default linking tolerances (RT: 100 s, m/z: 0.3 Da)
+Feature feat;
+vector<FeatureMap> maps(2);
+feat.setRT(100.0); feat.setMZ(500.0); feat.setIntensity(1000.0f);
+maps[0].push_back(feat);
+feat.setRT(300.0); feat.setMZ(600.0);
+maps[0].push_back(feat);
+feat.setRT(101.0); feat.setMZ(500.05);
+maps[1].push_back(feat);
+feat.setRT(301.0); feat.setMZ(600.05);
+maps[1].push_back(feat);
+maps[0].updateRanges();
+maps[1].updateRanges();
+
+FeatureMap third_map;
+feat.setRT(102.0); feat.setMZ(500.1); // links to the first group
+third_map.push_back(feat);
+feat.setRT(500.0); feat.setMZ(700.0); // far from everything -> singleton
+third_map.push_back(feat);
+third_map.updateRanges();
+
+FeatureGroupingAlgorithmQT algo;
+ConsensusMap result;
+
+START_SECTION((void beginIncremental(const std::vector<FeatureMap>& maps, ConsensusMap& out)))
+	algo.beginIncremental(maps, result);
+	TEST_EQUAL(result.size(), 2);
+	ABORT_IF(result.size() != 2);
+	TEST_EQUAL(result[0].size(), 2);
+	TEST_EQUAL(result[1].size(), 2);
+END_SECTION
+
+START_SECTION((Size addMap(const FeatureMap& map, ConsensusMap& out)))
+	// without a session an exception is thrown:
+	FeatureGroupingAlgorithmQT no_session;
+	TEST_EXCEPTION(Exception::IllegalArgument, no_session.addMap(third_map, result));
+
+	Size map_index = algo.addMap(third_map, result);
+	TEST_EQUAL(map_index, 2);
+	// same result as a full rerun: one group of three, one pair, one singleton
+	TEST_EQUAL(result.size(), 3);
+	ABORT_IF(result.size() != 3);
+	Size total_handles = 0;
+	for (const ConsensusFeature& cf : result) total_handles += cf.size();
+	TEST_EQUAL(total_handles, 6);
+END_SECTION
+
+START_SECTION((void retireMap(Size map_index, ConsensusMap& out)))
+	TEST_EXCEPTION(Exception::IllegalArgument, algo.retireMap(5, result));
+
+	algo.retireMap(0, result);
+	// the first map contributed one feature to each of the two linked groups:
+	TEST_EQUAL(result.size(), 3);
+	ABORT_IF(result.size() != 3);
+	Size total_handles = 0;
+	for (const ConsensusFeature& cf : result)
+	{
+		total_handles += cf.size();
+		// no handle of the retired map may remain:
+		for (const FeatureHandle& handle : cf.getFeatures())
+		{
+			TEST_NOT_EQUAL(handle.getMapIndex(), 0);
+		}
+	}
+	TEST_EQUAL(total_handles, 4);
+
+	// retiring the same map twice is an error:
+	TEST_EXCEPTION(Exception::IllegalArgument, algo.retireMap(0, result));
+END_SECTION
+
 /////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////
 END_TEST
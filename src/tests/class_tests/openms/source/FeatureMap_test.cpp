@@ -705,6 +705,25 @@ START_SECTION([EXTRA] ExposedVector Ctor)
   TEST_EQUAL(fm2[6].getPosition()[0], 5.25)
 END_SECTION
 
+START_SECTION([EXTRA] ExposedVector emplace and move insertion)
+  FeatureMap fm;
+  Feature f5;
+  f5.setRT(1.0);
+  fm.emplace_back(f5);
+  Feature f6;
+  f6.setRT(2.0);
+  fm.push_back(std::move(f6));
+  fm.emplace(fm.begin()); // default-constructed in place
+  Feature f7;
+  f7.setRT(3.0);
+  fm.insert(fm.begin(), std::move(f7));
+  TEST_EQUAL(fm.size(), 4)
+  TEST_REAL_SIMILAR(fm.front().getRT(), 3.0)
+  TEST_REAL_SIMILAR(fm[1].getRT(), 0.0)
+  TEST_REAL_SIMILAR(fm[2].getRT(), 1.0)
+  TEST_REAL_SIMILAR(fm.back().getRT(), 2.0)
+END_SECTION
+
 /////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////
 END_TEST
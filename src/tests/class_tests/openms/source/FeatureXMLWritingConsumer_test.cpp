@@ -0,0 +1,112 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/FORMAT/DATAACCESS/FeatureXMLWritingConsumer.h>
+#include <OpenMS/FORMAT/FeatureXMLFile.h>
+#include <OpenMS/KERNEL/FeatureMap.h>
+
+///////////////////////////
+
+START_TEST(FeatureXMLWritingConsumer, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+using namespace OpenMS;
+
+FeatureXMLWritingConsumer* ptr = nullptr;
+FeatureXMLWritingConsumer* null_ptr = nullptr;
+
+START_SECTION((FeatureXMLWritingConsumer(const String& filename)))
+  std::string tmp_filename;
+  NEW_TMP_FILE_EXT(tmp_filename, ".featureXML");
+  ptr = new FeatureXMLWritingConsumer(tmp_filename);
+  TEST_NOT_EQUAL(ptr, null_ptr)
+END_SECTION
+
+START_SECTION((~FeatureXMLWritingConsumer()))
+  delete ptr;
+END_SECTION
+
+START_SECTION((void consumeFeature(const Feature& feature)))
+  std::string tmp_filename;
+  NEW_TMP_FILE_EXT(tmp_filename, ".featureXML");
+
+  Feature f1;
+  f1.setRT(100.0);
+  f1.setMZ(500.5);
+  f1.setIntensity(1000.0f);
+  f1.ensureUniqueId();
+  Feature f2;
+  f2.setRT(200.0);
+  f2.setMZ(600.5);
+  f2.setIntensity(2000.0f);
+  f2.ensureUniqueId();
+
+  {
+    FeatureXMLWritingConsumer consumer(tmp_filename);
+    consumer.setExpectedSize(2);
+    consumer.consumeFeature(f1);
+    consumer.consumeFeature(f2);
+    TEST_EQUAL(consumer.getNrFeaturesWritten(), 2)
+    consumer.close();
+  }
+
+  // written file is readable by the regular featureXML reader
+  FeatureMap map;
+  FeatureXMLFile().load(tmp_filename, map);
+  TEST_EQUAL(map.size(), 2)
+  TEST_REAL_SIMILAR(map[0].getRT(), 100.0)
+  TEST_REAL_SIMILAR(map[0].getMZ(), 500.5)
+  TEST_REAL_SIMILAR(map[1].getRT(), 200.0)
+  TEST_REAL_SIMILAR(map[1].getIntensity(), 2000.0)
+END_SECTION
+
+START_SECTION((void close()))
+  std::string tmp_filename;
+  NEW_TMP_FILE_EXT(tmp_filename, ".featureXML");
+
+  // closing without features produces a valid, empty document
+  {
+    FeatureXMLWritingConsumer consumer(tmp_filename);
+    consumer.close();
+  }
+  FeatureMap map;
+  FeatureXMLFile().load(tmp_filename, map);
+  TEST_EQUAL(map.size(), 0)
+END_SECTION
+
+START_SECTION((void setMetaData(const FeatureMap& map)))
+  std::string tmp_filename;
+  NEW_TMP_FILE_EXT(tmp_filename, ".featureXML");
+
+  FeatureMap meta;
+  meta.setIdentifier("test_document");
+  Feature dummy; // features passed via setMetaData are dropped
+  dummy.ensureUniqueId();
+  meta.push_back(dummy);
+
+  {
+    FeatureXMLWritingConsumer consumer(tmp_filename);
+    consumer.setMetaData(meta);
+    consumer.close();
+  }
+  FeatureMap map;
+  FeatureXMLFile().load(tmp_filename, map);
+  TEST_EQUAL(map.size(), 0)
+  TEST_EQUAL(map.getIdentifier(), "test_document")
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
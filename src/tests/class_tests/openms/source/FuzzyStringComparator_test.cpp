@@ -433,6 +433,91 @@ END_SECTION
 
 //------------------------------------------------------------
 
+START_SECTION((void setCompareDigestFirst(bool rhs)))
+{
+	FuzzyStringComparator fsc;
+	// default should be false
+	TEST_EQUAL(fsc.getCompareDigestFirst(),false);
+	fsc.setCompareDigestFirst(true);
+	TEST_EQUAL(fsc.getCompareDigestFirst(),true);
+}
+END_SECTION
+
+START_SECTION((bool getCompareDigestFirst() const))
+{
+	// tested above
+	NOT_TESTABLE;
+}
+END_SECTION
+
+START_SECTION((void digestStream(std::istream & input, StreamDigest & digest) const))
+{
+	FuzzyStringComparator fsc;
+
+	std::istringstream input_1("abc 1.5 2.5\n\n  150 \n");
+	FuzzyStringComparator::StreamDigest digest_1;
+	fsc.digestStream(input_1, digest_1);
+
+	TEST_EQUAL(digest_1.buckets.size(),2);
+	// 1.5 and 2.5 share the magnitude class 0
+	TEST_EQUAL(digest_1.buckets[0].count,2);
+	TEST_REAL_SIMILAR(digest_1.buckets[0].sum,4.0);
+	TEST_REAL_SIMILAR(digest_1.buckets[0].min,1.5);
+	TEST_REAL_SIMILAR(digest_1.buckets[0].max,2.5);
+	// 150 ends up in the magnitude class 2
+	TEST_EQUAL(digest_1.buckets[2].count,1);
+	TEST_REAL_SIMILAR(digest_1.buckets[2].sum,150.0);
+
+	// whitespace and line breaks do not contribute to the digest
+	std::istringstream input_2("a b	c\n1.5\n2.5 150");
+	FuzzyStringComparator::StreamDigest digest_2;
+	fsc.digestStream(input_2, digest_2);
+	TEST_EQUAL(digest_1.text_hash == digest_2.text_hash,true);
+	TEST_EQUAL(fsc.digestsSimilar(digest_1,digest_2),true);
+}
+END_SECTION
+
+START_SECTION((bool digestsSimilar(const StreamDigest & d1, const StreamDigest & d2) const))
+{
+	FuzzyStringComparator fsc;
+	fsc.setAcceptableRelative(1.01);
+	fsc.setAcceptableAbsolute(0.0);
+
+	FuzzyStringComparator::StreamDigest digest_1;
+	FuzzyStringComparator::StreamDigest digest_2;
+	{
+		std::istringstream input_1("peak 100.0 intensity 5.0");
+		std::istringstream input_2("peak 100.5 intensity 5.01");
+		fsc.digestStream(input_1, digest_1);
+		fsc.digestStream(input_2, digest_2);
+	}
+	// numbers within tolerance, text identical
+	TEST_EQUAL(fsc.digestsSimilar(digest_1,digest_2),true);
+	// numbers outside tolerance
+	fsc.setAcceptableRelative(1.001);
+	TEST_EQUAL(fsc.digestsSimilar(digest_1,digest_2),false);
+
+	// different non-numeric content
+	FuzzyStringComparator::StreamDigest digest_3;
+	{
+		std::istringstream input_3("Peak 100.0 intensity 5.0");
+		fsc.digestStream(input_3, digest_3);
+	}
+	fsc.setAcceptableRelative(1.01);
+	TEST_EQUAL(fsc.digestsSimilar(digest_1,digest_3),false);
+
+	// different number of values
+	FuzzyStringComparator::StreamDigest digest_4;
+	{
+		std::istringstream input_4("peak 100.0 intensity 5.0 5.0");
+		fsc.digestStream(input_4, digest_4);
+	}
+	TEST_EQUAL(fsc.digestsSimilar(digest_1,digest_4),false);
+}
+END_SECTION
+
+//------------------------------------------------------------
+
 // START_SECTION(void reportFailure_( char const * const message ) const throw(Failure))
 // {
 // 	// Tested in compare...() methods
@@ -0,0 +1,105 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+#include <OpenMS/FORMAT/GzipOfstream.h>
+
+#include <OpenMS/FORMAT/GzipIfstream.h>
+using namespace OpenMS;
+
+///////////////////////////
+
+START_TEST(GzipOfstream, "$Id$")
+
+GzipOfstream* ptr = nullptr;
+GzipOfstream* nullPointer = nullptr;
+START_SECTION((GzipOfstream()))
+	ptr = new GzipOfstream;
+	TEST_NOT_EQUAL(ptr, nullPointer)
+	TEST_EQUAL(ptr->isOpen(), false)
+END_SECTION
+
+START_SECTION((~GzipOfstream()))
+	delete ptr;
+END_SECTION
+
+START_SECTION(GzipOfstream(const char* filename))
+	String filename;
+	NEW_TMP_FILE(filename)
+	{
+		GzipOfstream gzip(filename.c_str());
+		TEST_EQUAL(gzip.isOpen(), true)
+		gzip << "Was compression successful?";
+	}
+	// read back via GzipIfstream
+	GzipIfstream in(filename.c_str());
+	char buffer[28];
+	buffer[27] = '\0';
+	TEST_EQUAL(27, in.read(buffer, 27))
+	TEST_EQUAL(String(buffer), String("Was compression successful?"))
+END_SECTION
+
+START_SECTION(void open(const char* filename))
+	String filename;
+	NEW_TMP_FILE(filename)
+	GzipOfstream gzip;
+	gzip.open(filename.c_str());
+	TEST_EQUAL(gzip.isOpen(), true)
+	gzip << "Was compression successful?" << '\n';
+	gzip.close();
+	TEST_EQUAL(gzip.isOpen(), false)
+
+	GzipIfstream in(filename.c_str());
+	char buffer[29];
+	buffer[28] = '\0';
+	TEST_EQUAL(28, in.read(buffer, 28))
+	TEST_EQUAL(String(buffer), String("Was compression successful?\n"))
+END_SECTION
+
+START_SECTION(void close())
+	// tested in open(const char* filename)
+	NOT_TESTABLE
+END_SECTION
+
+START_SECTION(bool isOpen() const)
+	// tested above
+	NOT_TESTABLE
+END_SECTION
+
+START_SECTION([EXTRA] large writes survive the round trip)
+	String filename;
+	NEW_TMP_FILE(filename)
+	String line = "0123456789abcdefghijklmnopqrstuvwxyz\n";
+	Size repeats = 10000; // well beyond the internal buffer size
+	{
+		GzipOfstream gzip(filename.c_str());
+		for (Size i = 0; i < repeats; ++i)
+		{
+			gzip << line;
+		}
+	}
+	GzipIfstream in(filename.c_str());
+	String all;
+	char buffer[4096];
+	while (in.isOpen())
+	{
+		size_t n = in.read(buffer, sizeof(buffer));
+		all += String(buffer, buffer + n);
+	}
+	TEST_EQUAL(all.size(), line.size() * repeats)
+	TEST_EQUAL(all.prefix(line.size()) == line, true)
+	TEST_EQUAL(all.suffix(line.size()) == line, true)
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+END_TEST
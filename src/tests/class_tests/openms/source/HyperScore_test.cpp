@@ -91,6 +91,114 @@ START_SECTION((static double compute(double fragment_mass_tolerance, bool fragme
 }
 END_SECTION
 
+START_SECTION((static double computeWithDetail(double fragment_mass_tolerance, bool fragment_mass_tolerance_unit_ppm, const PeakSpectrum &exp_spectrum, const std::vector<double>& b_ion_mzs, const std::vector<double>& y_ion_mzs, PSMDetail& d)))
+{
+  AASequence peptide = AASequence::fromString("PEPTIDE");
+
+  TheoreticalSpectrumGenerator tsg_by;
+  Param p = tsg_by.getParameters();
+  p.setValue("add_metainfo", "true");
+  p.setValue("add_first_prefix_ion", "true");
+  tsg_by.setParameters(p);
+
+  PeakSpectrum exp_spectrum, theo_spectrum;
+  tsg_by.getSpectrum(exp_spectrum, peptide, 1, 1);
+  tsg_by.getSpectrum(theo_spectrum, peptide, 1, 1);
+
+  std::vector<double> b_mzs, y_mzs;
+  TheoreticalSpectrumGenerator::getBYIonMZs(peptide, b_mzs, y_mzs);
+  TEST_EQUAL(b_mzs.size(), 6)
+  TEST_EQUAL(y_mzs.size(), 6)
+
+  // the array-based overload must reproduce the spectrum-based score
+  HyperScore::PSMDetail detail_spec, detail_array;
+  const double score_spec = HyperScore::computeWithDetail(0.1, false, exp_spectrum, theo_spectrum, detail_spec);
+  const double score_array = HyperScore::computeWithDetail(0.1, false, exp_spectrum, b_mzs, y_mzs, detail_array);
+  TEST_REAL_SIMILAR(score_array, score_spec)
+  TEST_EQUAL(detail_array.matched_b_ions, detail_spec.matched_b_ions)
+  TEST_EQUAL(detail_array.matched_y_ions, detail_spec.matched_y_ions)
+  TEST_REAL_SIMILAR(detail_array.mean_error, detail_spec.mean_error)
+
+  // same for ppm tolerances
+  HyperScore::PSMDetail detail_ppm_spec, detail_ppm_array;
+  const double score_ppm_spec = HyperScore::computeWithDetail(10, true, exp_spectrum, theo_spectrum, detail_ppm_spec);
+  const double score_ppm_array = HyperScore::computeWithDetail(10, true, exp_spectrum, b_mzs, y_mzs, detail_ppm_array);
+  TEST_REAL_SIMILAR(score_ppm_array, score_ppm_spec)
+
+  // no match
+  HyperScore::PSMDetail detail_none;
+  std::vector<double> b_off, y_off;
+  TheoreticalSpectrumGenerator::getBYIonMZs(AASequence::fromString("YYYYYY"), b_off, y_off);
+  TEST_REAL_SIMILAR(HyperScore::computeWithDetail(1e-5, false, exp_spectrum, b_off, y_off, detail_none), 0.0)
+
+  // empty input
+  HyperScore::PSMDetail detail_empty;
+  TEST_REAL_SIMILAR(HyperScore::computeWithDetail(0.1, false, exp_spectrum, {}, {}, detail_empty), 0.0)
+}
+END_SECTION
+
+START_SECTION((static void computeBatch(double fragment_mass_tolerance, bool fragment_mass_tolerance_unit_ppm, const PeakSpectrum &exp_spectrum, const PackedCandidates& candidates, std::vector<double>& scores, std::vector<PSMDetail>* details = nullptr)))
+{
+  TheoreticalSpectrumGenerator tsg_by;
+  Param p = tsg_by.getParameters();
+  p.setValue("add_metainfo", "true");
+  p.setValue("add_first_prefix_ion", "true");
+  tsg_by.setParameters(p);
+
+  AASequence target = AASequence::fromString("PEPTIDE");
+  PeakSpectrum exp_spectrum;
+  tsg_by.getSpectrum(exp_spectrum, target, 1, 1);
+
+  const std::vector<AASequence> peptides = {
+    target,
+    AASequence::fromString("PEPTIDER"),
+    AASequence::fromString("YYYYYY"),
+    AASequence::fromString("DEPTIDE")
+  };
+
+  // pack all candidates and keep the per-candidate arrays for the reference scores
+  HyperScore::PackedCandidates candidates;
+  std::vector<std::vector<double>> all_b(peptides.size()), all_y(peptides.size());
+  for (Size i = 0; i < peptides.size(); ++i)
+  {
+    TheoreticalSpectrumGenerator::getBYIonMZs(peptides[i], all_b[i], all_y[i]);
+    candidates.addCandidate(all_b[i], all_y[i]);
+  }
+  TEST_EQUAL(candidates.size(), peptides.size())
+
+  // batch scores must reproduce the per-candidate array-based scores
+  std::vector<double> scores;
+  std::vector<HyperScore::PSMDetail> details;
+  HyperScore::computeBatch(0.1, false, exp_spectrum, candidates, scores, &details);
+  TEST_EQUAL(scores.size(), peptides.size())
+  TEST_EQUAL(details.size(), peptides.size())
+  for (Size i = 0; i < peptides.size(); ++i)
+  {
+    HyperScore::PSMDetail d;
+    const double ref = HyperScore::computeWithDetail(0.1, false, exp_spectrum, all_b[i], all_y[i], d);
+    TEST_REAL_SIMILAR(scores[i], ref)
+    TEST_EQUAL(details[i].matched_b_ions, d.matched_b_ions)
+    TEST_EQUAL(details[i].matched_y_ions, d.matched_y_ions)
+    TEST_REAL_SIMILAR(details[i].mean_error, d.mean_error)
+  }
+
+  // same for ppm tolerances, without the detail output
+  std::vector<double> scores_ppm;
+  HyperScore::computeBatch(10, true, exp_spectrum, candidates, scores_ppm);
+  for (Size i = 0; i < peptides.size(); ++i)
+  {
+    HyperScore::PSMDetail d;
+    TEST_REAL_SIMILAR(scores_ppm[i], HyperScore::computeWithDetail(10, true, exp_spectrum, all_b[i], all_y[i], d))
+  }
+
+  // clear() keeps the delimiter invariant intact
+  candidates.clear();
+  TEST_EQUAL(candidates.size(), 0)
+  HyperScore::computeBatch(0.1, false, exp_spectrum, candidates, scores);
+  TEST_EQUAL(scores.size(), 0)
+}
+END_SECTION
+
 /////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////
 END_TEST
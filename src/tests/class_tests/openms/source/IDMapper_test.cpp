@@ -442,6 +442,56 @@ START_SECTION((template < typename FeatureType > void annotate(FeatureMap< Featu
 END_SECTION
 
 
+START_SECTION((void annotate(FeatureMap& map, const IdentificationData& id_data, bool use_centroid_rt = false, bool use_centroid_mz = false)))
+{
+  using ID = IdentificationData;
+
+  // two features without convex hulls -> centroid matching:
+  FeatureMap fm;
+  Feature feat;
+  feat.setRT(100.0);
+  feat.setMZ(500.0);
+  feat.setCharge(2);
+  fm.push_back(feat);
+  feat.setRT(300.0);
+  feat.setMZ(700.0);
+  feat.setCharge(3);
+  fm.push_back(feat);
+
+  ID id_data;
+  ID::InputFileRef file_ref = id_data.registerInputFile(ID::InputFile("test.mzML"));
+  ID::IdentifiedPeptideRef pep_ref = id_data.registerIdentifiedPeptide(
+      ID::IdentifiedPeptide(AASequence::fromString("PEPTIDE")));
+
+  // matches the first feature:
+  ID::ObservationRef obs_ref = id_data.registerObservation(ID::Observation("spec_1", file_ref, 101.0, 500.2));
+  id_data.registerObservationMatch(ID::ObservationMatch(pep_ref, obs_ref, 2));
+  // RT and m/z fit the second feature, but the charge does not:
+  obs_ref = id_data.registerObservation(ID::Observation("spec_2", file_ref, 300.0, 700.1));
+  id_data.registerObservationMatch(ID::ObservationMatch(pep_ref, obs_ref, 2));
+  // RT far from everything:
+  obs_ref = id_data.registerObservation(ID::Observation("spec_3", file_ref, 500.0, 500.0));
+  id_data.registerObservationMatch(ID::ObservationMatch(pep_ref, obs_ref, 2));
+
+  IDMapper mapper;
+  Param p = mapper.getParameters();
+  p.setValue("rt_tolerance", 5.0);
+  p.setValue("mz_tolerance", 1.0);
+  p.setValue("mz_measure", "Da");
+  mapper.setParameters(p);
+
+  mapper.annotate(fm, id_data);
+
+  // all matches were merged into the map:
+  TEST_EQUAL(fm.getIdentificationData().getObservationMatches().size(), 3);
+  TEST_EQUAL(fm[0].getIDMatches().size(), 1);
+  TEST_EQUAL((*fm[0].getIDMatches().begin())->observation_ref->data_id, "spec_1");
+  TEST_EQUAL(fm[1].getIDMatches().size(), 0); // charge mismatch
+  TEST_EQUAL(fm.getUnassignedIDMatches().size(), 2);
+}
+END_SECTION
+
+
 START_SECTION((void annotate(ConsensusMap& map, const std::vector<PeptideIdentification>& ids, const std::vector<ProteinIdentification>& protein_ids, bool measure_from_subelements=false)))
 {
   IDMapper mapper;
@@ -167,6 +167,48 @@ START_TEST(IDMergerAlgorithm, "$Id$")
     }
     END_SECTION
 
+    START_SECTION(merge with disk spilling)
+    {
+      IdXMLFile f;
+      vector<ProteinIdentification> pr1;
+      vector<PeptideIdentification> pe1;
+      f.load(OPENMS_GET_TEST_DATA_PATH("newIDMergerTest1.idXML"),pr1,pe1);
+      Size pe1size = pe1.size();
+
+      vector<ProteinIdentification> pr2;
+      vector<PeptideIdentification> pe2;
+      f.load(OPENMS_GET_TEST_DATA_PATH("newIDMergerTest2.idXML"),pr2,pe2);
+      Size pe2size = pe2.size();
+
+      IDMergerAlgorithm ima("mymerge");
+      Param p = ima.getParameters();
+      p.setValue("max_psms_in_memory", 1); // spill after every insert
+      ima.setParameters(p);
+      ima.insertRuns(std::move(pr1), std::move(pe1));
+      ima.insertRuns(std::move(pr2), std::move(pe2));
+
+      ProteinIdentification prres;
+      vector<PeptideIdentification> peres;
+      ima.returnResultsAndClear(prres,peres);
+
+      // same results as the in-memory merge above ...
+      TEST_EQUAL(prres.getHits().size(),6)
+      TEST_EQUAL(peres.size(),pe1size + pe2size)
+      TEST_EQUAL(prres.getIdentifier().hasPrefix("mymerge"), true)
+      StringList toFill; prres.getPrimaryMSRunPath(toFill);
+      TEST_EQUAL(toFill.size(), 2)
+      // ... but sorted by RT
+      for (Size i = 1; i < peres.size(); ++i)
+      {
+        TEST_EQUAL(peres[i - 1].getRT() <= peres[i].getRT(), true)
+      }
+      for (const auto& pid : peres)
+      {
+        TEST_STRING_EQUAL(pid.getIdentifier(), prres.getIdentifier())
+      }
+    }
+    END_SECTION
+
     START_SECTION(check search setting consistency)
         {
           IdXMLFile f;
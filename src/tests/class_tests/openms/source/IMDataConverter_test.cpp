@@ -14,6 +14,7 @@
 
 #include <OpenMS/IONMOBILITY/IMDataConverter.h>
 #include <OpenMS/KERNEL/MSExperiment.h>
+#include <OpenMS/KERNEL/Mobilogram.h>
 #include <OpenMS/FORMAT/MzMLFile.h>
 
 using namespace OpenMS;
@@ -171,6 +172,70 @@ START_SECTION(static MSExperiment collapseFramesToSingle(const MSExperiment& in)
 	NOT_TESTABLE // tested_above
 END_SECTION
 
+START_SECTION(static Mobilogram aggregateToMobilogram(const MSSpectrum& im_frame, double mb_start, double mb_end, Size number_of_bins))
+	TEST_EXCEPTION(Exception::MissingInformation, IMDataConverter::aggregateToMobilogram(spec, 1.0, 7.0, 6))
+	TEST_EXCEPTION(Exception::IllegalArgument, IMDataConverter::aggregateToMobilogram(frame, 1.0, 7.0, 0))
+	TEST_EXCEPTION(Exception::IllegalArgument, IMDataConverter::aggregateToMobilogram(frame, 7.0, 1.0, 6))
+	{
+		auto mb = IMDataConverter::aggregateToMobilogram(frame, 1.0, 7.0, 6);
+		TEST_EQUAL(mb.size(), 6);
+		TEST_EQUAL(mb.getRT(), 1);
+		TEST_EQUAL(mb.getDriftTimeUnit() == DriftTimeUnit::MILLISECOND, true);
+		TEST_REAL_SIMILAR(mb[0].getMobility(), 1.5);
+		TEST_REAL_SIMILAR(mb[5].getMobility(), 6.5);
+		TEST_REAL_SIMILAR(mb[0].getIntensity(), 29.0);   // IM 1.1
+		TEST_REAL_SIMILAR(mb[1].getIntensity(), 60.0);   // IM 2.2
+		TEST_REAL_SIMILAR(mb[2].getIntensity(), 63.0);   // IM 3.3 + 3.3
+		TEST_REAL_SIMILAR(mb[3].getIntensity(), 0.0);
+		TEST_REAL_SIMILAR(mb[4].getIntensity(), 37.0);   // IM 5.5
+		TEST_REAL_SIMILAR(mb[5].getIntensity(), 31.0);   // IM 6.6
+	}
+	{ // peaks outside the grid are clamped to the border bins
+		auto mb = IMDataConverter::aggregateToMobilogram(frame, 2.0, 6.0, 4);
+		TEST_EQUAL(mb.size(), 4);
+		TEST_REAL_SIMILAR(mb[0].getIntensity(), 89.0);   // IM 1.1 (clamped) + 2.2
+		TEST_REAL_SIMILAR(mb[1].getIntensity(), 63.0);   // IM 3.3 + 3.3
+		TEST_REAL_SIMILAR(mb[2].getIntensity(), 0.0);
+		TEST_REAL_SIMILAR(mb[3].getIntensity(), 68.0);   // IM 5.5 + 6.6 (clamped)
+	}
+END_SECTION
+
+START_SECTION(static MSSpectrum extractIMRange(const MSSpectrum& im_frame, double im_start, double im_end))
+	TEST_EXCEPTION(Exception::MissingInformation, IMDataConverter::extractIMRange(spec, 2.0, 4.0))
+	{
+		auto sub = IMDataConverter::extractIMRange(frame, 2.0, 4.0); // keeps IM 2.2, 3.3, 3.3
+		TEST_EQUAL(sub.size(), 3);
+		TEST_EQUAL(sub.getRT(), frame.getRT());
+		const auto [im_index, im_unit] = sub.getIMData(); // IM column is retained and subset
+		TEST_EQUAL(sub.getFloatDataArrays()[im_index].size(), 3);
+		TEST_REAL_SIMILAR(sub.getFloatDataArrays()[im_index][0], 2.2);
+		TEST_REAL_SIMILAR(sub.getFloatDataArrays()[im_index][2], 3.3);
+	}
+	{ // empty window
+		auto sub = IMDataConverter::extractIMRange(frame, 8.0, 9.0);
+		TEST_EQUAL(sub.size(), 0);
+	}
+END_SECTION
+
+START_SECTION(static std::vector<Mobilogram> aggregateToMobilograms(const MSExperiment& exp, double mb_start, double mb_end, Size number_of_bins))
+	MSExperiment e_in;
+	e_in.addSpectrum(frame);
+	e_in.addSpectrum(spec); // no IM data
+	auto frame3 = frame;
+	frame3.setRT(3);
+	e_in.addSpectrum(frame3);
+
+	auto mbs = IMDataConverter::aggregateToMobilograms(e_in, 1.0, 7.0, 6);
+	TEST_EQUAL(mbs.size(), 3);
+	TEST_EQUAL(mbs[0].size(), 6);
+	TEST_REAL_SIMILAR(mbs[0][2].getIntensity(), 63.0);
+	TEST_EQUAL(mbs[1].empty(), true); // no IM data -> empty mobilogram ...
+	TEST_EQUAL(mbs[1].getRT(), 2);    // ... but index-aligned with the input
+	TEST_EQUAL(mbs[2].getRT(), 3);
+	TEST_EQUAL(mbs[0].size() == mbs[2].size(), true);
+	TEST_REAL_SIMILAR(mbs[2][5].getIntensity(), 31.0);
+END_SECTION
+
 /////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////
 END_TEST
@@ -106,7 +106,7 @@ START_SECTION(void load(const String& filename, std::vector<ProteinIdentificatio
   TEST_REAL_SIMILAR(peptide_ids[0].getHits()[0].getScore(),0.9)
   TEST_EQUAL(peptide_ids[0].getHits()[0].getSequence(), AASequence::fromString("PEPTIDER"))
   TEST_EQUAL(peptide_ids[0].getHits()[0].getCharge(),1)
-  vector<PeptideEvidence> pes0 = peptide_ids[0].getHits()[0].getPeptideEvidences();
+  PeptideHit::PeptideEvidences pes0 = peptide_ids[0].getHits()[0].getPeptideEvidences();
   TEST_EQUAL(pes0.size(),2)
   TEST_EQUAL(pes0[0].getProteinAccession(),"PROT1")
   TEST_EQUAL(pes0[1].getProteinAccession(),"PROT2")
@@ -115,7 +115,7 @@ START_SECTION(void load(const String& filename, std::vector<ProteinIdentificatio
   TEST_EQUAL((String)(peptide_ids[0].getHits()[0].getMetaValue("name")),"PeptideHit")
   //peptide hit 2
   TEST_REAL_SIMILAR(peptide_ids[0].getHits()[1].getScore(),1.4)
-  vector<PeptideEvidence> pes1 = peptide_ids[0].getHits()[1].getPeptideEvidences();
+  PeptideHit::PeptideEvidences pes1 = peptide_ids[0].getHits()[1].getPeptideEvidences();
   TEST_EQUAL(peptide_ids[0].getHits()[1].getSequence(), AASequence::fromString("PEPTIDERR"))
   TEST_EQUAL(peptide_ids[0].getHits()[1].getCharge(),1)
   TEST_EQUAL(pes1.size(),0)
@@ -128,13 +128,13 @@ START_SECTION(void load(const String& filename, std::vector<ProteinIdentificatio
   TEST_REAL_SIMILAR(peptide_ids[1].getHits()[0].getScore(),44.4)
   TEST_EQUAL(peptide_ids[1].getHits()[0].getSequence(), AASequence::fromString("PEPTIDERRR"))
   TEST_EQUAL(peptide_ids[1].getHits()[0].getCharge(),2)
-  vector<PeptideEvidence> pes2 = peptide_ids[1].getHits()[0].getPeptideEvidences();
+  PeptideHit::PeptideEvidences pes2 = peptide_ids[1].getHits()[0].getPeptideEvidences();
   TEST_EQUAL(pes2.size(),0)
   //peptide hit 2
   TEST_REAL_SIMILAR(peptide_ids[1].getHits()[1].getScore(),33.3)
   TEST_EQUAL(peptide_ids[1].getHits()[1].getSequence(), AASequence::fromString("PEPTIDERRRR"))
   TEST_EQUAL(peptide_ids[1].getHits()[1].getCharge(),2)
-  vector<PeptideEvidence> pes3 = peptide_ids[1].getHits()[1].getPeptideEvidences();
+  PeptideHit::PeptideEvidences pes3 = peptide_ids[1].getHits()[1].getPeptideEvidences();
   TEST_EQUAL(pes3.size(),0)
 
   /////////////// protein id 2 //////////////////
@@ -171,7 +171,7 @@ START_SECTION(void load(const String& filename, std::vector<ProteinIdentificatio
   TEST_REAL_SIMILAR(peptide_ids[2].getHits()[0].getScore(),1.4)
   TEST_EQUAL(peptide_ids[2].getHits()[0].getSequence(), AASequence::fromString("PEPTIDERRRRR"))
   TEST_EQUAL(peptide_ids[2].getHits()[0].getCharge(),1)
-  vector<PeptideEvidence> pes4 = peptide_ids[2].getHits()[0].getPeptideEvidences();
+  PeptideHit::PeptideEvidences pes4 = peptide_ids[2].getHits()[0].getPeptideEvidences();
   TEST_EQUAL(pes4.size(),1)
   TEST_EQUAL(pes4[0].getProteinAccession(),"PROT3")
   TEST_EQUAL(pes4[0].getAABefore(), PeptideEvidence::UNKNOWN_AA)
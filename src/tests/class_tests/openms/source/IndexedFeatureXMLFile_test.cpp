@@ -0,0 +1,159 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+#include <OpenMS/FORMAT/IndexedFeatureXMLFile.h>
+///////////////////////////
+
+#include <OpenMS/FORMAT/ConsensusXMLFile.h>
+#include <OpenMS/FORMAT/FeatureXMLFile.h>
+#include <OpenMS/KERNEL/ConsensusMap.h>
+
+using namespace OpenMS;
+using namespace std;
+
+START_TEST(IndexedFeatureXMLFile, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+IndexedFeatureXMLFile* ptr = nullptr;
+IndexedFeatureXMLFile* null_ptr = nullptr;
+
+// write a small featureXML with hulls, subordinates and meta values
+// (none of which should end up in the index)
+std::string feature_filename;
+{
+  FeatureMap map;
+  for (Size i = 0; i < 4; ++i)
+  {
+    Feature f;
+    f.setRT(100.0 + 50.0 * i);
+    f.setMZ(400.0 + 10.0 * i);
+    f.setIntensity(1000.0f + i);
+    f.setCharge(2);
+    f.setOverallQuality(0.5 + 0.1 * i);
+    f.setUniqueId(i + 1);
+    ConvexHull2D hull;
+    hull.addPoint(DPosition<2>(f.getRT() - 1.0, f.getMZ() - 0.1));
+    hull.addPoint(DPosition<2>(f.getRT() + 1.0, f.getMZ() + 0.1));
+    f.getConvexHulls().push_back(hull);
+    f.setMetaValue("label", String("feature_") + i);
+    if (i == 0)
+    {
+      Feature sub;
+      sub.setRT(f.getRT() + 0.5);
+      sub.setMZ(f.getMZ() + 0.5);
+      sub.setIntensity(1.0f);
+      sub.setUniqueId(100);
+      f.getSubordinates().push_back(sub);
+    }
+    map.push_back(f);
+  }
+  NEW_TMP_FILE_EXT(feature_filename, ".featureXML");
+  FeatureXMLFile().store(feature_filename, map);
+}
+
+START_SECTION((IndexedFeatureXMLFile()))
+  ptr = new IndexedFeatureXMLFile();
+  TEST_NOT_EQUAL(ptr, null_ptr)
+  TEST_EQUAL(ptr->getParsingSuccess(), false)
+  delete ptr;
+END_SECTION
+
+START_SECTION((void openFile(const String& filename)))
+  IndexedFeatureXMLFile indexed;
+  indexed.openFile(feature_filename);
+  TEST_EQUAL(indexed.getParsingSuccess(), true)
+  TEST_EQUAL(indexed.size(), 4) // the subordinate feature is not indexed separately
+  TEST_EXCEPTION(Exception::FileNotFound, indexed.openFile("does_not_exist.featureXML"))
+END_SECTION
+
+START_SECTION((const std::vector<ElementIndexEntry>& getIndex() const))
+  IndexedFeatureXMLFile indexed(feature_filename);
+  const auto& index = indexed.getIndex();
+  TEST_EQUAL(index.size(), 4)
+  TEST_REAL_SIMILAR(index[0].rt, 100.0)
+  TEST_REAL_SIMILAR(index[0].mz, 400.0)
+  TEST_REAL_SIMILAR(index[0].intensity, 1000.0)
+  TEST_EQUAL(index[0].charge, 2)
+  TEST_REAL_SIMILAR(index[0].quality, 0.5)
+  TEST_REAL_SIMILAR(index[3].rt, 250.0)
+  TEST_REAL_SIMILAR(index[3].mz, 430.0)
+END_SECTION
+
+START_SECTION((void getFeature(Size index, Feature& feature) const))
+  IndexedFeatureXMLFile indexed(feature_filename);
+  Feature f;
+  indexed.getFeature(1, f);
+  TEST_REAL_SIMILAR(f.getRT(), 150.0)
+  TEST_REAL_SIMILAR(f.getMZ(), 410.0)
+  TEST_REAL_SIMILAR(f.getIntensity(), 1001.0)
+  TEST_EQUAL(f.getCharge(), 2)
+  TEST_EQUAL(f.getUniqueId(), 2)
+  // subelements are not parsed
+  TEST_EQUAL(f.getConvexHulls().empty(), true)
+  TEST_EQUAL(f.metaValueExists("label"), false)
+  TEST_EXCEPTION(Exception::IndexOverflow, indexed.getFeature(4, f))
+END_SECTION
+
+START_SECTION((Size getFeaturesInRange(double min_rt, double max_rt, double min_mz, double max_mz, FeatureMap& out) const))
+  IndexedFeatureXMLFile indexed(feature_filename);
+  FeatureMap out;
+  TEST_EQUAL(indexed.getFeaturesInRange(120.0, 220.0, 0.0, 1000.0, out), 2)
+  TEST_EQUAL(out.size(), 2)
+  TEST_REAL_SIMILAR(out[0].getRT(), 150.0)
+  TEST_REAL_SIMILAR(out[1].getRT(), 200.0)
+  TEST_EQUAL(indexed.getFeaturesInRange(0.0, 1000.0, 425.0, 435.0, out), 1)
+  TEST_EQUAL(out.size(), 3)
+END_SECTION
+
+START_SECTION((String getElementXML(Size index)))
+  IndexedFeatureXMLFile indexed(feature_filename);
+  String xml = indexed.getElementXML(0);
+  TEST_EQUAL(xml.hasPrefix("<feature "), true)
+  TEST_EQUAL(xml.hasSuffix("</feature>"), true)
+  TEST_EQUAL(xml.hasSubstring("<convexhull"), true) // full record, incl. subelements
+  TEST_EXCEPTION(Exception::IndexOverflow, indexed.getElementXML(4))
+END_SECTION
+
+START_SECTION([EXTRA] consensusXML support)
+  ConsensusMap cmap;
+  cmap.getColumnHeaders()[0].filename = "file1.mzML";
+  cmap.getColumnHeaders()[0].size = 2;
+  for (Size i = 0; i < 2; ++i)
+  {
+    Feature f;
+    f.setRT(300.0 + 100.0 * i);
+    f.setMZ(500.0 + 5.0 * i);
+    f.setIntensity(2000.0f + i);
+    f.setUniqueId(i + 1);
+    ConsensusFeature cf(0, f);
+    cf.setUniqueId(i + 10);
+    cmap.push_back(cf);
+  }
+  std::string consensus_filename;
+  NEW_TMP_FILE_EXT(consensus_filename, ".consensusXML");
+  ConsensusXMLFile().store(consensus_filename, cmap);
+
+  IndexedFeatureXMLFile indexed(consensus_filename);
+  TEST_EQUAL(indexed.size(), 2)
+  TEST_REAL_SIMILAR(indexed.getIndex()[0].rt, 300.0)
+  TEST_REAL_SIMILAR(indexed.getIndex()[1].mz, 505.0)
+  TEST_REAL_SIMILAR(indexed.getIndex()[1].intensity, 2001.0)
+  FeatureMap out;
+  TEST_EQUAL(indexed.getFeaturesInRange(350.0, 450.0, 0.0, 1000.0, out), 1)
+  TEST_EQUAL(indexed.getElementXML(0).hasPrefix("<consensusElement "), true)
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
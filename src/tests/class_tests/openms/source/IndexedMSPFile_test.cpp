@@ -0,0 +1,149 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Douglas McCloskey, Pasquale Domenico Colaianni $
+// $Authors: Douglas McCloskey, Pasquale Domenico Colaianni $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+#include <OpenMS/FORMAT/IndexedMSPFile.h>
+///////////////////////////
+
+#include <OpenMS/FORMAT/MSPGenericFile.h>
+#include <OpenMS/KERNEL/MSExperiment.h>
+
+using namespace OpenMS;
+using namespace std;
+
+START_TEST(IndexedMSPFile, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+IndexedMSPFile* ptr = nullptr;
+IndexedMSPFile* null_ptr = nullptr;
+
+// Build a small library file to index
+MSExperiment library;
+{
+  MSSpectrum s;
+  s.setName("Apricot");
+  s.setMetaValue("PRECURSORMZ", "100.05");
+  s.push_back(Peak1D(35.0, 310.0));
+  s.push_back(Peak1D(36.0, 1230.0));
+  library.addSpectrum(s);
+  s.clear(true);
+  s.setName("Banana");
+  s.setMetaValue("PRECURSORMZ", "200.1");
+  s.push_back(Peak1D(47.0, 5240.0));
+  library.addSpectrum(s);
+  s.clear(true);
+  s.setName("Cherry"); // no precursor m/z
+  s.push_back(Peak1D(66.0, 203.0));
+  s.push_back(Peak1D(67.0, 68.0));
+  s.push_back(Peak1D(68.0, 77.0));
+  library.addSpectrum(s);
+}
+String input_filepath;
+NEW_TMP_FILE(input_filepath)
+MSPGenericFile msp;
+msp.store(input_filepath, library);
+
+START_SECTION(IndexedMSPFile())
+{
+  ptr = new IndexedMSPFile();
+  TEST_NOT_EQUAL(ptr, null_ptr)
+  TEST_EQUAL(ptr->isOpen(), false)
+}
+END_SECTION
+
+START_SECTION(~IndexedMSPFile())
+{
+  delete ptr;
+}
+END_SECTION
+
+START_SECTION(void openFile(const String& filename))
+{
+  IndexedMSPFile imsp;
+  TEST_EXCEPTION(Exception::FileNotFound, imsp.openFile("this_file_does_not_exist.msp"))
+  imsp.openFile(input_filepath);
+  TEST_EQUAL(imsp.isOpen(), true)
+  TEST_EQUAL(imsp.getNrSpectra(), 3)
+}
+END_SECTION
+
+START_SECTION(MSSpectrum getSpectrum(Size index))
+{
+  IndexedMSPFile imsp(input_filepath);
+  MSSpectrum s = imsp.getSpectrum(0);
+  TEST_EQUAL(s.getName(), "Apricot")
+  ABORT_IF(s.size() != 2)
+  TEST_REAL_SIMILAR(s[0].getPos(), 35.0)
+  TEST_REAL_SIMILAR(s[0].getIntensity(), 310.0)
+  TEST_REAL_SIMILAR(s[1].getPos(), 36.0)
+  ABORT_IF(s.getPrecursors().size() != 1)
+  TEST_REAL_SIMILAR(s.getPrecursors()[0].getMZ(), 100.05)
+
+  // entries can be accessed in any order
+  s = imsp.getSpectrum(2);
+  TEST_EQUAL(s.getName(), "Cherry")
+  TEST_EQUAL(s.size(), 3)
+  s = imsp.getSpectrum(1);
+  TEST_EQUAL(s.getName(), "Banana")
+  TEST_EQUAL(s.size(), 1)
+
+  TEST_EXCEPTION(Exception::IndexOverflow, imsp.getSpectrum(3))
+}
+END_SECTION
+
+START_SECTION(std::vector<Size> getSpectraByPrecursorMZ(const double mz, const double tolerance, const bool ppm = false))
+{
+  IndexedMSPFile imsp(input_filepath);
+  std::vector<Size> hits = imsp.getSpectraByPrecursorMZ(100.05, 0.01);
+  ABORT_IF(hits.size() != 1)
+  TEST_EQUAL(hits[0], 0)
+
+  hits = imsp.getSpectraByPrecursorMZ(150.0, 100.0); // both precursors in window
+  ABORT_IF(hits.size() != 2)
+  TEST_EQUAL(hits[0], 0)
+  TEST_EQUAL(hits[1], 1)
+
+  hits = imsp.getSpectraByPrecursorMZ(200.1, 10.0, true); // 10 ppm
+  ABORT_IF(hits.size() != 1)
+  TEST_EQUAL(hits[0], 1)
+
+  hits = imsp.getSpectraByPrecursorMZ(500.0, 0.01); // no match
+  TEST_EQUAL(hits.empty(), true)
+}
+END_SECTION
+
+START_SECTION(double getPrecursorMZ(Size index) const)
+{
+  IndexedMSPFile imsp(input_filepath);
+  TEST_REAL_SIMILAR(imsp.getPrecursorMZ(0), 100.05)
+  TEST_REAL_SIMILAR(imsp.getPrecursorMZ(1), 200.1)
+  TEST_EQUAL(std::isnan(imsp.getPrecursorMZ(2)), true) // no PRECURSORMZ field
+  TEST_EXCEPTION(Exception::IndexOverflow, imsp.getPrecursorMZ(3))
+}
+END_SECTION
+
+START_SECTION(Size getNrSpectra() const)
+{
+  NOT_TESTABLE // tested above
+}
+END_SECTION
+
+START_SECTION(bool isOpen() const)
+{
+  NOT_TESTABLE // tested above
+}
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
@@ -149,6 +149,21 @@ START_SECTION((void getNeighborhood(Size index, std::vector<Size>& result_indice
   NOT_TESTABLE;
 END_SECTION
 
+START_SECTION((void getNeighborhoods(const std::vector<Size>& indices, std::vector<std::vector<Size> >& result_indices, double rt_tol, double mz_tol, bool mz_ppm, bool include_features_from_same_map = false, double max_pairwise_log_fc = -1.0) const))
+  vector<Size> indices = {0, 1};
+  vector<vector<Size> > neighborhoods;
+  kd_data_1.getNeighborhoods(indices, neighborhoods, 3000.0, 300.0, false, true);
+  TEST_EQUAL(neighborhoods.size(), 2)
+  // the batch results equal the single queries
+  for (Size i = 0; i < indices.size(); ++i)
+  {
+    vector<Size> single;
+    kd_data_1.getNeighborhood(indices[i], single, 3000.0, 300.0, false, true);
+    TEST_EQUAL(neighborhoods[i] == single, true)
+    TEST_EQUAL(neighborhoods[i].size(), 2) // both features within tolerances
+  }
+END_SECTION
+
 START_SECTION((void queryRegion(double rt_low, double rt_high, double mz_low, double mz_high, std::vector<Size>& result_indices, Size ignored_map_index = std::numeric_limits<Size>::max()) const))
   NOT_TESTABLE;
 END_SECTION
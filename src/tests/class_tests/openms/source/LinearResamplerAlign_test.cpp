@@ -547,6 +547,57 @@ START_SECTION([EXTRA] test_linear_res_align_input)
 }
 END_SECTION
 
+START_SECTION(( static void raster_uniform(const double* mz_raw, const double* int_raw, Size n_raw, double start_pos, double spacing, double* int_resampled, Size n_resampled)))
+{
+  // same input and grid as the iterator-based raster test above: grid at 0, 0.75, 1.5, 2.25
+  std::vector<double> mz_raw = {0, 0.5, 1.0, 1.6, 1.8};
+  std::vector<double> int_raw = {3.0, 6.0, 8.0, 2.0, 1.0};
+  std::vector<double> resampled(4, 0.0);
+
+  LinearResamplerAlign::raster_uniform(mz_raw.data(), int_raw.data(), mz_raw.size(), 0.0, 0.75, resampled.data(), resampled.size());
+
+  double sum = 0.0;
+  for (Size i = 0; i < resampled.size(); ++i)
+  {
+    sum += resampled[i];
+  }
+  TEST_REAL_SIMILAR(sum, 20);
+
+  TEST_REAL_SIMILAR(resampled[0], 3 + 2);
+  TEST_REAL_SIMILAR(resampled[1], 4 + 2.0 / 3 * 8);
+  TEST_REAL_SIMILAR(resampled[2], 1.0 / 3 * 8 + 2 + 1.0 / 3);
+  TEST_REAL_SIMILAR(resampled[3], 2.0 / 3);
+
+  // intensity outside the grid goes to the first / last grid point
+  std::vector<double> mz_outside = {-1.0, 3.0};
+  std::vector<double> int_outside = {5.0, 7.0};
+  LinearResamplerAlign::raster_uniform(mz_outside.data(), int_outside.data(), mz_outside.size(), 0.0, 0.75, resampled.data(), resampled.size());
+  TEST_REAL_SIMILAR(resampled[0], 3 + 2 + 5)
+  TEST_REAL_SIMILAR(resampled[3], 2.0 / 3 + 7)
+}
+END_SECTION
+
+START_SECTION(( static void raster_uniform(const std::vector<const double*>& mz_arrays, const std::vector<const double*>& int_arrays, const std::vector<Size>& sizes, double start_pos, double spacing, double* int_resampled, Size n_resampled)))
+{
+  // splitting the input over two spectra gives the same sum as one fused pass over both
+  std::vector<double> mz_a = {0, 0.5, 1.0};
+  std::vector<double> int_a = {3.0, 6.0, 8.0};
+  std::vector<double> mz_b = {1.6, 1.8};
+  std::vector<double> int_b = {2.0, 1.0};
+  std::vector<double> resampled(4, 0.0);
+
+  std::vector<const double*> mz_arrays = {mz_a.data(), mz_b.data()};
+  std::vector<const double*> int_arrays = {int_a.data(), int_b.data()};
+  std::vector<Size> sizes = {mz_a.size(), mz_b.size()};
+  LinearResamplerAlign::raster_uniform(mz_arrays, int_arrays, sizes, 0.0, 0.75, resampled.data(), resampled.size());
+
+  TEST_REAL_SIMILAR(resampled[0], 3 + 2);
+  TEST_REAL_SIMILAR(resampled[1], 4 + 2.0 / 3 * 8);
+  TEST_REAL_SIMILAR(resampled[2], 1.0 / 3 * 8 + 2 + 1.0 / 3);
+  TEST_REAL_SIMILAR(resampled[3], 2.0 / 3);
+}
+END_SECTION
+
 #endif
 
 /////////////////////////////////////////////////////////////
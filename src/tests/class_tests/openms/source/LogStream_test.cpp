@@ -372,6 +372,31 @@ START_SECTION(([EXTRA]Test log caching))
 }
 END_SECTION
 
+START_SECTION(([EXTRA] LogLineBuffer - statement-wise buffering))
+{
+  LogStream l1(new LogStreamBuf());
+  ostringstream stream_by_logger;
+  l1.insert(stream_by_logger);
+
+  // a complete line is distributed as soon as the statement ends,
+  // no explicit flush or endl required
+  {
+    LogLineBuffer(l1) << "complete line " << 1 << "\n";
+  }
+  TEST_EQUAL(stream_by_logger.str(), "complete line 1\n")
+
+  // text without a newline is assembled across statements
+  {
+    LogLineBuffer(l1) << "incomplete ";
+  }
+  TEST_EQUAL(stream_by_logger.str(), "complete line 1\n")
+  {
+    LogLineBuffer(l1) << "line" << endl;
+  }
+  TEST_EQUAL(stream_by_logger.str(), "complete line 1\nincomplete line\n")
+}
+END_SECTION
+
 START_SECTION(([EXTRA] Macro test - OPENMS_LOG_FATAL_ERROR))
 {
   // remove cout/cerr streams from global instances
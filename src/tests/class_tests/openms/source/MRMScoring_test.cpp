@@ -235,6 +235,44 @@ mean(xcorr_max) # shape score
         }
     END_SECTION
 
+    BOOST_AUTO_TEST_CASE(initializeXCorrMatrix_packed)
+        {
+          // the packed row-major overload produces the same matrix as the
+          // IMRMFeature-based initialization
+          MockMRMFeature * imrmfeature = new MockMRMFeature();
+          MRMScoring mrmscore;
+
+          std::vector<std::string> native_ids;
+          fill_mock_objects(imrmfeature, native_ids);
+
+          // pack both transition intensity vectors into one contiguous matrix
+          std::vector<double> packed;
+          std::vector<double> tmp;
+          for (const auto& native_id : native_ids)
+          {
+            imrmfeature->getFeature(native_id)->getIntensity(tmp);
+            packed.insert(packed.end(), tmp.begin(), tmp.end());
+          }
+          delete imrmfeature;
+
+          mrmscore.initializeXCorrMatrix(packed.data(), 2, packed.size() / 2);
+
+          TEST_EQUAL(mrmscore.getXCorrMatrix().rows(), 2)
+          TEST_EQUAL(mrmscore.getXCorrMatrix().cols(), 2)
+          TEST_EQUAL(mrmscore.getXCorrMatrix()(0, 0).data.size(), 23)
+
+          const OpenSwath::Scoring::XCorrArrayType auto_correlation =
+                  mrmscore.getXCorrMatrix()(0, 0);
+          TEST_REAL_SIMILAR(auto_correlation.data[11].second , 1)                   // find(0)->second,
+          TEST_REAL_SIMILAR(auto_correlation.data[12].second , -0.227352707759245)  // find(1)->second,
+
+          const OpenSwath::Scoring::XCorrArrayType cross_correlation =
+                  mrmscore.getXCorrMatrix()(0, 1);
+          TEST_REAL_SIMILAR(cross_correlation.data[11].second, 0.03129565)    // find(0)->second,
+          TEST_REAL_SIMILAR(cross_correlation.data[10].second,  0.30204049)   // find(-1)->second,
+        }
+    END_SECTION
+
     BOOST_AUTO_TEST_CASE(initializeXCorrPrecursorContrastMatrix)
         {
           MockMRMFeature * imrmfeature = new MockMRMFeature();
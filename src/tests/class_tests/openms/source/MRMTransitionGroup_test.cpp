@@ -190,7 +190,39 @@ START_SECTION (  bool hasChromatogram(String key))
 }
 END_SECTION
 
-START_SECTION (  void addPrecusorChromatogram(SpectrumType &chromatogram, String key)) 
+START_SECTION (  ChromatogramMatrix getChromatogramMatrix() const)
+{
+  MRMTransitionGroupType mrmtrgroup;
+  MSChromatogram c1, c2;
+  for (Size i = 0; i < 4; ++i)
+  {
+    MSChromatogram::PeakType p;
+    p.setRT(i);
+    p.setIntensity(i + 1.0f);
+    c1.push_back(p);
+    p.setIntensity(10.0f * (i + 1.0f));
+    c2.push_back(p);
+  }
+  mrmtrgroup.addChromatogram(c1, "tr1");
+  mrmtrgroup.addChromatogram(c2, "tr2");
+
+  MRMTransitionGroupType::ChromatogramMatrix m = mrmtrgroup.getChromatogramMatrix();
+  TEST_EQUAL(m.rows, 2)
+  TEST_EQUAL(m.cols, 4)
+  TEST_EQUAL(m.intensities.size(), 8)
+  TEST_EQUAL(m.rowIndex("tr1"), 0)
+  TEST_EQUAL(m.rowIndex("tr2"), 1)
+  TEST_REAL_SIMILAR(m.row(0)[2], 3.0)
+  TEST_REAL_SIMILAR(m.row(1)[3], 40.0)
+
+  // chromatograms of differing length cannot share one matrix
+  MSChromatogram c3;
+  mrmtrgroup.addChromatogram(c3, "tr3");
+  TEST_EXCEPTION(Exception::InvalidValue, mrmtrgroup.getChromatogramMatrix())
+}
+END_SECTION
+
+START_SECTION (  void addPrecusorChromatogram(SpectrumType &chromatogram, String key))
 {
   // tested below
   NOT_TESTABLE
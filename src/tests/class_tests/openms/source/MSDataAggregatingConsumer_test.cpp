@@ -69,6 +69,37 @@ START_SECTION((void consumeSpectrum(SpectrumType & s)))
     delete storage;
   }
 
+  // no adding up, spectra with unique RT are passed through unchanged
+  {
+    MSDataStoringConsumer * storage = new MSDataStoringConsumer();
+    MSDataAggregatingConsumer * agg_consumer = new MSDataAggregatingConsumer(storage);
+
+    MSSpectrum s;
+    s.setName("spec1");
+    s.setRT(5);
+    s.push_back(Peak1D(5, 7));
+    s.push_back(Peak1D(10, 20));
+    agg_consumer->consumeSpectrum(s);
+    s.clear(true);
+
+    s.setName("spec2");
+    s.setRT(15);
+    s.push_back(Peak1D(7, 9));
+    agg_consumer->consumeSpectrum(s);
+    s.clear(true);
+
+    delete agg_consumer;
+
+    TEST_EQUAL(storage->getData().getNrSpectra(), 2)
+    TEST_EQUAL(storage->getData().getSpectra()[0].size(), 2)
+    TEST_REAL_SIMILAR(storage->getData().getSpectra()[0][0].getMZ(), 5)
+    TEST_REAL_SIMILAR(storage->getData().getSpectra()[0][1].getIntensity(), 20)
+    TEST_EQUAL(storage->getData().getSpectra()[1].size(), 1)
+    TEST_REAL_SIMILAR(storage->getData().getSpectra()[1][0].getMZ(), 7)
+
+    delete storage;
+  }
+
   // adding empty spectra
   {
     MSDataStoringConsumer * storage = new MSDataStoringConsumer();
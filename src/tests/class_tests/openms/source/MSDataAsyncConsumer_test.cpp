@@ -0,0 +1,161 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataAsyncConsumer.h>
+#include <OpenMS/INTERFACES/IMSDataConsumer.h>
+
+///////////////////////////
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataStoringConsumer.h>
+
+START_TEST(MSDataAsyncConsumer, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+using namespace OpenMS;
+
+// a downstream consumer that fails on the second spectrum
+struct FailingConsumer :
+  public Interfaces::IMSDataConsumer
+{
+  int consumed = 0;
+  void consumeSpectrum(SpectrumType& /* s */) override
+  {
+    if (++consumed >= 2)
+    {
+      throw Exception::InvalidValue(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "writing failed", "2");
+    }
+  }
+  void consumeChromatogram(ChromatogramType& /* c */) override {}
+  void setExpectedSize(Size /* s */, Size /* c */) override {}
+  void setExperimentalSettings(const ExperimentalSettings& /* exp */) override {}
+};
+
+MSDataAsyncConsumer* async_consumer_ptr = nullptr;
+MSDataAsyncConsumer* async_consumer_nullPointer = nullptr;
+MSDataStoringConsumer storing_consumer_for_ctor;
+
+START_SECTION((MSDataAsyncConsumer(Interfaces::IMSDataConsumer* downstream, Size queue_capacity = 16)))
+  async_consumer_ptr = new MSDataAsyncConsumer(&storing_consumer_for_ctor);
+  TEST_NOT_EQUAL(async_consumer_ptr, async_consumer_nullPointer)
+  TEST_EXCEPTION(Exception::IllegalArgument, MSDataAsyncConsumer(nullptr))
+END_SECTION
+
+START_SECTION((~MSDataAsyncConsumer()))
+  delete async_consumer_ptr;
+END_SECTION
+
+START_SECTION((void consumeSpectrum(SpectrumType& s)))
+{
+  MSDataStoringConsumer storing_consumer;
+  MSDataAsyncConsumer async_consumer(&storing_consumer, 2);
+
+  MSSpectrum s;
+  for (Size i = 0; i < 10; ++i)
+  {
+    s.setName("spec" + String(i));
+    s.setRT(5.0 + 10.0 * i);
+    async_consumer.consumeSpectrum(s);
+  }
+  async_consumer.waitForCompletion();
+
+  // all spectra were handed over, in consumption order
+  TEST_EQUAL(storing_consumer.getData().getNrSpectra(), 10)
+  for (Size i = 0; i < 10; ++i)
+  {
+    TEST_EQUAL(storing_consumer.getData().getSpectra()[i].getName(), "spec" + String(i))
+    TEST_REAL_SIMILAR(storing_consumer.getData().getSpectra()[i].getRT(), 5.0 + 10.0 * i)
+  }
+}
+END_SECTION
+
+START_SECTION((void consumeChromatogram(ChromatogramType& c)))
+{
+  MSDataStoringConsumer storing_consumer;
+  MSDataAsyncConsumer async_consumer(&storing_consumer, 2);
+
+  MSChromatogram c;
+  c.setNativeID("chrom1");
+  async_consumer.consumeChromatogram(c);
+  c.setNativeID("chrom2");
+  async_consumer.consumeChromatogram(c);
+  async_consumer.waitForCompletion();
+
+  TEST_EQUAL(storing_consumer.getData().getNrChromatograms(), 2)
+  TEST_EQUAL(storing_consumer.getData().getChromatograms()[0].getNativeID(), "chrom1")
+  TEST_EQUAL(storing_consumer.getData().getChromatograms()[1].getNativeID(), "chrom2")
+}
+END_SECTION
+
+START_SECTION((void setExperimentalSettings(const ExperimentalSettings& settings)))
+{
+  MSDataStoringConsumer storing_consumer;
+  MSDataAsyncConsumer async_consumer(&storing_consumer);
+
+  ExperimentalSettings settings;
+  settings.setComment("forwarded");
+  async_consumer.setExperimentalSettings(settings);
+  async_consumer.waitForCompletion();
+
+  TEST_EQUAL(storing_consumer.getData().getComment(), "forwarded")
+}
+END_SECTION
+
+START_SECTION((void setExpectedSize(Size s_size, Size c_size)))
+{
+  // forwarded synchronously; nothing observable with a storing consumer
+  MSDataStoringConsumer storing_consumer;
+  MSDataAsyncConsumer async_consumer(&storing_consumer);
+  async_consumer.setExpectedSize(2, 1);
+  async_consumer.waitForCompletion();
+  NOT_TESTABLE
+}
+END_SECTION
+
+START_SECTION((void waitForCompletion()))
+{
+  // a downstream exception surfaces on the producer thread (in
+  // waitForCompletion(), or already in consumeSpectrum() if the worker was
+  // faster) ...
+  {
+    FailingConsumer failing_consumer;
+    MSDataAsyncConsumer async_consumer(&failing_consumer);
+    MSSpectrum s;
+    bool caught = false;
+    try
+    {
+      async_consumer.consumeSpectrum(s);
+      async_consumer.consumeSpectrum(s);
+      async_consumer.waitForCompletion();
+    }
+    catch (Exception::InvalidValue&)
+    {
+      caught = true;
+    }
+    TEST_EQUAL(caught, true)
+  }
+  // ... and consuming after waitForCompletion() is not allowed
+  {
+    MSDataStoringConsumer storing_consumer;
+    MSDataAsyncConsumer async_consumer(&storing_consumer);
+    async_consumer.waitForCompletion();
+    MSSpectrum s;
+    TEST_EXCEPTION(Exception::Precondition, async_consumer.consumeSpectrum(s))
+  }
+}
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
@@ -0,0 +1,140 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Eugen Netz $
+// $Authors: Eugen Netz $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataFAIMSSplittingConsumer.h>
+
+///////////////////////////
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataStoringConsumer.h>
+#include <OpenMS/IONMOBILITY/IMTypes.h>
+
+#include <map>
+#include <memory>
+
+using namespace OpenMS;
+
+namespace
+{
+  MSSpectrum makeSpectrum(double rt, double cv)
+  {
+    MSSpectrum s;
+    s.setRT(rt);
+    s.setMSLevel(1);
+    s.setDriftTime(cv);
+    s.setDriftTimeUnit(DriftTimeUnit::FAIMS_COMPENSATION_VOLTAGE);
+    return s;
+  }
+}
+
+START_TEST(MSDataFAIMSSplittingConsumer, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+MSDataFAIMSSplittingConsumer* splitting_consumer_ptr = nullptr;
+MSDataFAIMSSplittingConsumer* splitting_consumer_nullPointer = nullptr;
+
+START_SECTION((MSDataFAIMSSplittingConsumer(ConsumerFactory consumer_factory)))
+  splitting_consumer_ptr = new MSDataFAIMSSplittingConsumer([](double) { return nullptr; });
+  TEST_NOT_EQUAL(splitting_consumer_ptr, splitting_consumer_nullPointer)
+  delete splitting_consumer_ptr;
+  TEST_EXCEPTION(Exception::IllegalArgument, MSDataFAIMSSplittingConsumer(MSDataFAIMSSplittingConsumer::ConsumerFactory()))
+END_SECTION
+
+START_SECTION((void consumeSpectrum(SpectrumType& s)))
+{
+  // spectra end up at the consumer of their compensation voltage
+  {
+    std::map<double, std::unique_ptr<MSDataStoringConsumer>> storages;
+    MSDataFAIMSSplittingConsumer splitter([&storages](double cv)
+      {
+        storages[cv] = std::make_unique<MSDataStoringConsumer>();
+        return storages[cv].get();
+      });
+
+    std::vector<double> cvs = { -45.0, -65.0, -45.0, -25.0, -65.0, -45.0 };
+    for (Size i = 0; i < cvs.size(); ++i)
+    {
+      MSSpectrum s = makeSpectrum(10.0 * (i + 1), cvs[i]);
+      splitter.consumeSpectrum(s);
+    }
+
+    TEST_EQUAL(storages.size(), 3)
+    TEST_EQUAL(splitter.getConsumers().size(), 3)
+    TEST_EQUAL(storages[-45.0]->getData().getNrSpectra(), 3)
+    TEST_EQUAL(storages[-65.0]->getData().getNrSpectra(), 2)
+    TEST_EQUAL(storages[-25.0]->getData().getNrSpectra(), 1)
+    // order within one CV is preserved
+    TEST_REAL_SIMILAR(storages[-45.0]->getData().getSpectra()[0].getRT(), 10.0)
+    TEST_REAL_SIMILAR(storages[-45.0]->getData().getSpectra()[1].getRT(), 30.0)
+    TEST_REAL_SIMILAR(storages[-45.0]->getData().getSpectra()[2].getRT(), 60.0)
+  }
+
+  // spectra without a FAIMS drift time unit are rejected
+  {
+    MSDataStoringConsumer storage;
+    MSDataFAIMSSplittingConsumer splitter([&storage](double) { return &storage; });
+
+    MSSpectrum s;
+    s.setMSLevel(1);
+    TEST_EXCEPTION(Exception::MissingInformation, splitter.consumeSpectrum(s))
+  }
+}
+END_SECTION
+
+START_SECTION((void setExperimentalSettings(const OpenMS::ExperimentalSettings& settings)))
+{
+  // settings reach consumers created before and after the call
+  std::map<double, std::unique_ptr<MSDataStoringConsumer>> storages;
+  MSDataFAIMSSplittingConsumer splitter([&storages](double cv)
+    {
+      storages[cv] = std::make_unique<MSDataStoringConsumer>();
+      return storages[cv].get();
+    });
+
+  MSSpectrum s1 = makeSpectrum(10.0, -45.0);
+  splitter.consumeSpectrum(s1);
+
+  ExperimentalSettings settings;
+  settings.setComment("split run");
+  splitter.setExperimentalSettings(settings);
+
+  MSSpectrum s2 = makeSpectrum(20.0, -65.0);
+  splitter.consumeSpectrum(s2);
+
+  TEST_STRING_EQUAL(storages[-45.0]->getData().getComment(), "split run")
+  TEST_STRING_EQUAL(storages[-65.0]->getData().getComment(), "split run")
+}
+END_SECTION
+
+START_SECTION((void consumeChromatogram(ChromatogramType& c)))
+{
+  // chromatograms are dropped and no consumer is created for them
+  MSDataFAIMSSplittingConsumer splitter([](double) -> Interfaces::IMSDataConsumer* { return nullptr; });
+
+  MSChromatogram c;
+  splitter.consumeChromatogram(c);
+  TEST_EQUAL(splitter.getConsumers().empty(), true)
+}
+END_SECTION
+
+START_SECTION((const std::map<double, Interfaces::IMSDataConsumer*>& getConsumers() const))
+{
+  // tested above
+  NOT_TESTABLE
+}
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
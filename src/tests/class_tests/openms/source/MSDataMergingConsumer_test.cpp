@@ -0,0 +1,152 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataMergingConsumer.h>
+
+///////////////////////////
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataStoringConsumer.h>
+
+using namespace OpenMS;
+
+namespace
+{
+  // a simple profile-like spectrum on a fixed m/z grid
+  MSSpectrum makeSpectrum(double rt, UInt ms_level, float intensity)
+  {
+    MSSpectrum s;
+    s.setRT(rt);
+    s.setMSLevel(ms_level);
+    for (Size i = 0; i < 3; ++i)
+    {
+      Peak1D p;
+      p.setMZ(400.0 + i);
+      p.setIntensity(intensity);
+      s.push_back(p);
+    }
+    return s;
+  }
+}
+
+START_TEST(MSDataMergingConsumer, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+MSDataMergingConsumer* merge_consumer_ptr = nullptr;
+MSDataMergingConsumer* merge_consumer_nullPointer = nullptr;
+
+START_SECTION((MSDataMergingConsumer(Interfaces::IMSDataConsumer* next_consumer, Size block_size, double rt_max_length = 0.0, UInt ms_level = 1)))
+  merge_consumer_ptr = new MSDataMergingConsumer(nullptr, 2); // don't do that ...
+  TEST_NOT_EQUAL(merge_consumer_ptr, merge_consumer_nullPointer)
+END_SECTION
+
+START_SECTION((~MSDataMergingConsumer()))
+    delete merge_consumer_ptr;
+END_SECTION
+
+START_SECTION((void consumeSpectrum(SpectrumType & s)))
+{
+  // merge blocks of 2; 5 spectra -> 2 merged blocks plus 1 flushed remainder
+  {
+    MSDataStoringConsumer * storage = new MSDataStoringConsumer();
+    MSDataMergingConsumer * merger = new MSDataMergingConsumer(storage, 2);
+
+    for (Size i = 0; i < 5; ++i)
+    {
+      MSSpectrum s = makeSpectrum(10.0 * (i + 1), 1, 100.0f);
+      merger->consumeSpectrum(s);
+    }
+    // deleting the merger flushes the last (incomplete) block
+    delete merger;
+
+    TEST_EQUAL(storage->getData().getNrSpectra(), 3)
+    // merged spectra carry the meta data of the first spectrum of their block
+    TEST_REAL_SIMILAR(storage->getData().getSpectra()[0].getRT(), 10.0)
+    TEST_REAL_SIMILAR(storage->getData().getSpectra()[1].getRT(), 30.0)
+    TEST_REAL_SIMILAR(storage->getData().getSpectra()[2].getRT(), 50.0)
+
+    // intensities of the two block spectra are summed up
+    double total = 0.0;
+    for (const Peak1D& p : storage->getData().getSpectra()[0])
+    {
+      total += p.getIntensity();
+    }
+    TOLERANCE_ABSOLUTE(1.0)
+    TEST_REAL_SIMILAR(total, 600.0) // 2 spectra x 3 peaks x 100
+
+    delete storage;
+  }
+
+  // spectra of other MS levels pass through unchanged
+  {
+    MSDataStoringConsumer * storage = new MSDataStoringConsumer();
+    MSDataMergingConsumer * merger = new MSDataMergingConsumer(storage, 2);
+
+    MSSpectrum s1 = makeSpectrum(10.0, 1, 100.0f);
+    MSSpectrum s2 = makeSpectrum(11.0, 2, 50.0f);
+    MSSpectrum s3 = makeSpectrum(12.0, 1, 100.0f);
+    merger->consumeSpectrum(s1);
+    merger->consumeSpectrum(s2);
+    merger->consumeSpectrum(s3);
+    delete merger;
+
+    TEST_EQUAL(storage->getData().getNrSpectra(), 2)
+    // the MS2 spectrum was forwarded before the MS1 block completed
+    TEST_EQUAL(storage->getData().getSpectra()[0].getMSLevel(), 2)
+    TEST_EQUAL(storage->getData().getSpectra()[1].getMSLevel(), 1)
+    TEST_REAL_SIMILAR(storage->getData().getSpectra()[1].getRT(), 10.0)
+
+    delete storage;
+  }
+
+  // rt_max_length closes blocks early
+  {
+    MSDataStoringConsumer * storage = new MSDataStoringConsumer();
+    MSDataMergingConsumer * merger = new MSDataMergingConsumer(storage, 10, 15.0);
+
+    for (Size i = 0; i < 4; ++i)
+    {
+      MSSpectrum s = makeSpectrum(10.0 * (i + 1), 1, 100.0f);
+      merger->consumeSpectrum(s);
+    }
+    delete merger;
+
+    // RT 10/20 span < 15, RT 30 starts a new block
+    TEST_EQUAL(storage->getData().getNrSpectra(), 2)
+    TEST_REAL_SIMILAR(storage->getData().getSpectra()[0].getRT(), 10.0)
+    TEST_REAL_SIMILAR(storage->getData().getSpectra()[1].getRT(), 30.0)
+
+    delete storage;
+  }
+}
+END_SECTION
+
+START_SECTION((void consumeChromatogram(ChromatogramType & c)))
+{
+  MSDataStoringConsumer * storage = new MSDataStoringConsumer();
+  MSDataMergingConsumer * merger = new MSDataMergingConsumer(storage, 2);
+
+  MSChromatogram c;
+  c.setNativeID("chrom1");
+  merger->consumeChromatogram(c);
+  delete merger;
+
+  TEST_EQUAL(storage->getData().getNrChromatograms(), 1)
+  delete storage;
+}
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
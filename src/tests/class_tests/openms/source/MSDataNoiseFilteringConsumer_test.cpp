@@ -0,0 +1,129 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataNoiseFilteringConsumer.h>
+
+///////////////////////////
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataStoringConsumer.h>
+
+using namespace OpenMS;
+
+namespace
+{
+  // 8 low "baseline" peaks plus 2 high signal peaks
+  MSSpectrum makeSpectrum(UInt ms_level)
+  {
+    MSSpectrum s;
+    s.setMSLevel(ms_level);
+    for (Size i = 0; i < 10; ++i)
+    {
+      Peak1D p;
+      p.setMZ(400.0 + i);
+      p.setIntensity((i == 3 || i == 7) ? 1000.0f : 1.0f);
+      s.push_back(p);
+    }
+    return s;
+  }
+}
+
+START_TEST(MSDataNoiseFilteringConsumer, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+MSDataNoiseFilteringConsumer* noise_consumer_ptr = nullptr;
+MSDataNoiseFilteringConsumer* noise_consumer_nullPointer = nullptr;
+
+START_SECTION((MSDataNoiseFilteringConsumer(Interfaces::IMSDataConsumer* next_consumer, double percentile = 50.0, double multiplier = 2.0, UInt ms_level = 0)))
+  noise_consumer_ptr = new MSDataNoiseFilteringConsumer(nullptr, 50.0); // don't do that ...
+  TEST_NOT_EQUAL(noise_consumer_ptr, noise_consumer_nullPointer)
+  delete noise_consumer_ptr;
+  TEST_EXCEPTION(Exception::IllegalArgument, MSDataNoiseFilteringConsumer(nullptr, 101.0))
+END_SECTION
+
+START_SECTION((void consumeSpectrum(SpectrumType& s)))
+{
+  // the median of the test spectrum is 1.0, so with multiplier 2 only the
+  // two signal peaks survive
+  {
+    MSDataStoringConsumer storage;
+    MSDataNoiseFilteringConsumer filter(&storage, 50.0, 2.0);
+
+    MSSpectrum s = makeSpectrum(1);
+    filter.consumeSpectrum(s);
+
+    TEST_EQUAL(storage.getData().getNrSpectra(), 1)
+    TEST_EQUAL(storage.getData().getSpectra()[0].size(), 2)
+    TEST_REAL_SIMILAR(storage.getData().getSpectra()[0][0].getMZ(), 403.0)
+    TEST_REAL_SIMILAR(storage.getData().getSpectra()[0][1].getMZ(), 407.0)
+  }
+
+  // spectra of other MS levels pass through unchanged
+  {
+    MSDataStoringConsumer storage;
+    MSDataNoiseFilteringConsumer filter(&storage, 50.0, 2.0, 1);
+
+    MSSpectrum s = makeSpectrum(2);
+    filter.consumeSpectrum(s);
+
+    TEST_EQUAL(storage.getData().getSpectra()[0].size(), 10)
+  }
+
+  // a percentile of 0 (minimum) with multiplier 1 keeps everything
+  {
+    MSDataStoringConsumer storage;
+    MSDataNoiseFilteringConsumer filter(&storage, 0.0, 1.0);
+
+    MSSpectrum s = makeSpectrum(1);
+    filter.consumeSpectrum(s);
+
+    TEST_EQUAL(storage.getData().getSpectra()[0].size(), 10)
+  }
+}
+END_SECTION
+
+START_SECTION((void addKeepRange(double mz_start, double mz_end)))
+{
+  // peaks inside keep ranges survive regardless of intensity
+  MSDataStoringConsumer storage;
+  MSDataNoiseFilteringConsumer filter(&storage, 50.0, 2.0);
+  filter.addKeepRange(400.0, 401.0);
+
+  MSSpectrum s = makeSpectrum(1);
+  filter.consumeSpectrum(s);
+
+  TEST_EQUAL(storage.getData().getSpectra()[0].size(), 4)
+  TEST_REAL_SIMILAR(storage.getData().getSpectra()[0][0].getMZ(), 400.0)
+  TEST_REAL_SIMILAR(storage.getData().getSpectra()[0][1].getMZ(), 401.0)
+}
+END_SECTION
+
+START_SECTION((void consumeChromatogram(ChromatogramType& c)))
+{
+  // chromatograms pass through unchanged
+  MSDataStoringConsumer storage;
+  MSDataNoiseFilteringConsumer filter(&storage, 50.0, 2.0);
+
+  MSChromatogram c;
+  c.push_back(ChromatogramPeak(1.0, 100.0));
+  filter.consumeChromatogram(c);
+
+  TEST_EQUAL(storage.getData().getNrChromatograms(), 1)
+  TEST_EQUAL(storage.getData().getChromatograms()[0].size(), 1)
+}
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
@@ -0,0 +1,158 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataPrecursorCorrectingConsumer.h>
+
+///////////////////////////
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataStoringConsumer.h>
+
+using namespace OpenMS;
+
+namespace
+{
+  MSSpectrum makeMS1()
+  {
+    MSSpectrum s;
+    s.setMSLevel(1);
+    s.setRT(100.0);
+    Peak1D p;
+    p.setMZ(509.9994);
+    p.setIntensity(200.0f);
+    s.push_back(p);
+    p.setMZ(510.0000);
+    p.setIntensity(250.0f);
+    s.push_back(p);
+    return s;
+  }
+
+  MSSpectrum makeMS2(double precursor_mz)
+  {
+    MSSpectrum s;
+    s.setMSLevel(2);
+    s.setRT(100.1);
+    Precursor precursor;
+    precursor.setMZ(precursor_mz);
+    s.setPrecursors({precursor});
+    return s;
+  }
+}
+
+START_TEST(MSDataPrecursorCorrectingConsumer, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+MSDataPrecursorCorrectingConsumer* pc_consumer_ptr = nullptr;
+MSDataPrecursorCorrectingConsumer* pc_consumer_nullPointer = nullptr;
+
+START_SECTION((MSDataPrecursorCorrectingConsumer(Interfaces::IMSDataConsumer* next_consumer, double mz_tolerance, bool ppm = true, bool highest_intensity = false)))
+  pc_consumer_ptr = new MSDataPrecursorCorrectingConsumer(nullptr, 5.0);
+  TEST_NOT_EQUAL(pc_consumer_ptr, pc_consumer_nullPointer)
+  delete pc_consumer_ptr;
+END_SECTION
+
+START_SECTION((void consumeSpectrum(SpectrumType& s)))
+{
+  MSDataStoringConsumer storage;
+  MSDataPrecursorCorrectingConsumer corrector(&storage, 5.0, true);
+
+  MSSpectrum ms1 = makeMS1();
+  MSSpectrum ms2 = makeMS2(509.9999); // corrected to the nearest MS1 peak at 510.0000
+  corrector.consumeSpectrum(ms1);
+  corrector.consumeSpectrum(ms2);
+
+  TEST_EQUAL(storage.getData().getNrSpectra(), 2)
+  TEST_REAL_SIMILAR(storage.getData().getSpectra()[1].getPrecursors()[0].getMZ(), 510.0000)
+  TEST_REAL_SIMILAR(ms2.getPrecursors()[0].getMZ(), 510.0000)
+
+  // MS2 before the first survey scan is passed through unchanged
+  MSDataPrecursorCorrectingConsumer orphan_corrector(nullptr, 5.0, true);
+  MSSpectrum orphan_ms2 = makeMS2(509.9999);
+  orphan_corrector.consumeSpectrum(orphan_ms2);
+  TEST_REAL_SIMILAR(orphan_ms2.getPrecursors()[0].getMZ(), 509.9999)
+  TEST_EQUAL(orphan_corrector.getNumberOfCorrectedPrecursors(), 0)
+}
+END_SECTION
+
+START_SECTION((void consumeChromatogram(ChromatogramType& c)))
+{
+  MSDataStoringConsumer storage;
+  MSDataPrecursorCorrectingConsumer corrector(&storage, 5.0, true);
+  MSChromatogram c;
+  corrector.consumeChromatogram(c);
+  TEST_EQUAL(storage.getData().getNrChromatograms(), 1)
+}
+END_SECTION
+
+START_SECTION((Size getNumberOfCorrectedPrecursors() const))
+{
+  MSDataPrecursorCorrectingConsumer corrector(nullptr, 5.0, true);
+  MSSpectrum ms1 = makeMS1();
+  MSSpectrum ms2 = makeMS2(509.9999);
+  MSSpectrum ms2_far = makeMS2(700.0); // no MS1 peak within tolerance
+  corrector.consumeSpectrum(ms1);
+  corrector.consumeSpectrum(ms2);
+  corrector.consumeSpectrum(ms2_far);
+  TEST_EQUAL(corrector.getNumberOfCorrectedPrecursors(), 1)
+}
+END_SECTION
+
+START_SECTION((const std::vector<double>& getDeltaMZs() const))
+{
+  MSDataPrecursorCorrectingConsumer corrector(nullptr, 5.0, true);
+  MSSpectrum ms1 = makeMS1();
+  MSSpectrum ms2 = makeMS2(509.9999);
+  corrector.consumeSpectrum(ms1);
+  corrector.consumeSpectrum(ms2);
+  TEST_EQUAL(corrector.getDeltaMZs().size(), 1)
+  TEST_REAL_SIMILAR(corrector.getDeltaMZs()[0], 0.0001)
+}
+END_SECTION
+
+START_SECTION((const std::vector<double>& getMZs() const))
+{
+  MSDataPrecursorCorrectingConsumer corrector(nullptr, 5.0, true);
+  MSSpectrum ms1 = makeMS1();
+  MSSpectrum ms2 = makeMS2(509.9999);
+  corrector.consumeSpectrum(ms1);
+  corrector.consumeSpectrum(ms2);
+  TEST_EQUAL(corrector.getMZs().size(), 1)
+  TEST_REAL_SIMILAR(corrector.getMZs()[0], 509.9999)
+}
+END_SECTION
+
+START_SECTION((const std::vector<double>& getRTs() const))
+{
+  MSDataPrecursorCorrectingConsumer corrector(nullptr, 5.0, true);
+  MSSpectrum ms1 = makeMS1();
+  MSSpectrum ms2 = makeMS2(509.9999);
+  corrector.consumeSpectrum(ms1);
+  corrector.consumeSpectrum(ms2);
+  TEST_EQUAL(corrector.getRTs().size(), 1)
+  TEST_REAL_SIMILAR(corrector.getRTs()[0], 100.1)
+}
+END_SECTION
+
+START_SECTION((void setExpectedSize(Size, Size)))
+  NOT_TESTABLE // ignored
+END_SECTION
+
+START_SECTION((void setExperimentalSettings(const OpenMS::ExperimentalSettings&)))
+  NOT_TESTABLE // ignored
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+END_TEST
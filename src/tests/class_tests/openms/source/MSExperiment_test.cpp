@@ -1137,6 +1137,73 @@ START_SECTION(void clear(bool clear_meta_data))
 }
 END_SECTION
 
+START_SECTION(void updateRangesIncremental())
+{
+  PeakMap edit;
+  MSSpectrum s;
+  s.setRT(10.0);
+  s.setMSLevel(1);
+  s.push_back(Peak1D(500.0, 100.0));
+  s.push_back(Peak1D(600.0, 200.0));
+  edit.addSpectrum(s);
+  s.clear(true);
+  s.setRT(20.0);
+  s.setMSLevel(1);
+  s.push_back(Peak1D(550.0, 50.0));
+  edit.addSpectrum(s);
+
+  // all caches empty: behaves like a full updateRanges()
+  edit.updateRangesIncremental();
+  TEST_REAL_SIMILAR(edit.getMinMZ(), 500.0)
+  TEST_REAL_SIMILAR(edit.getMaxMZ(), 600.0)
+  TEST_REAL_SIMILAR(edit.getMinRT(), 10.0)
+  TEST_REAL_SIMILAR(edit.getMaxRT(), 20.0)
+  TEST_EQUAL(edit.getSize(), 3)
+
+  // mutation without invalidation: the stale cached range is folded
+  edit[1].push_back(Peak1D(700.0, 10.0));
+  edit.updateRangesIncremental();
+  TEST_REAL_SIMILAR(edit.getMaxMZ(), 600.0)
+  TEST_EQUAL(edit.getSize(), 4) // the peak count is always recomputed
+
+  // after marking the modified spectrum dirty it is rescanned
+  edit[1].clearRanges();
+  edit.updateRangesIncremental();
+  TEST_REAL_SIMILAR(edit.getMaxMZ(), 700.0)
+
+  // matches the full rescan
+  PeakMap full(edit);
+  full.updateRanges();
+  TEST_REAL_SIMILAR(edit.getMinMZ(), full.getMinMZ())
+  TEST_REAL_SIMILAR(edit.getMaxMZ(), full.getMaxMZ())
+  TEST_REAL_SIMILAR(edit.getMinIntensity(), full.getMinIntensity())
+  TEST_REAL_SIMILAR(edit.getMaxIntensity(), full.getMaxIntensity())
+}
+END_SECTION
+
+START_SECTION(void partitionForParallelAccess())
+{
+  PeakMap edit;
+  MSSpectrum s;
+  s.setRT(1.0);
+  s.setMSLevel(1);
+  s.push_back(Peak1D(500.0, 100.0));
+  s.push_back(Peak1D(501.0, 200.0));
+  edit.addSpectrum(s);
+  s.setRT(2.0);
+  edit.addSpectrum(s);
+  MSChromatogram c;
+  c.push_back(ChromatogramPeak(1.0, 300.0));
+  edit.addChromatogram(c);
+
+  PeakMap copy(edit);
+  edit.partitionForParallelAccess();
+
+  // only the placement of the data may change, not the data itself
+  TEST_EQUAL(edit == copy, true)
+}
+END_SECTION
+
 START_SECTION(bool MSExperiment::isIMFrame() const)
 {
   PeakMap tmp;
@@ -1270,6 +1337,88 @@ START_SECTION((void addChromatogram(const MSChromatogram &chromatogram)))
 }
 END_SECTION
 
+START_SECTION((void addSpectra(const std::vector<MSSpectrum>& spectra)))
+{
+  PeakMap exp;
+  MSSpectrum spec1, spec2;
+  spec1.setRT(1.0);
+  spec2.setRT(2.0);
+  exp.addSpectrum(spec1);
+
+  std::vector<MSSpectrum> batch = { spec1, spec2 };
+  exp.addSpectra(batch);
+  TEST_EQUAL(exp.getSpectra().size(), 3)
+  TEST_EQUAL(batch.size(), 2)
+  TEST_EQUAL(exp.getSpectra()[1] == spec1, true)
+  TEST_EQUAL(exp.getSpectra()[2] == spec2, true)
+}
+END_SECTION
+
+START_SECTION((void addSpectra(std::vector<MSSpectrum>&& spectra)))
+{
+  PeakMap exp;
+  MSSpectrum spec1, spec2;
+  spec1.setRT(1.0);
+  spec2.setRT(2.0);
+
+  // empty target: buffer is taken over
+  std::vector<MSSpectrum> batch = { spec1, spec2 };
+  exp.addSpectra(std::move(batch));
+  TEST_EQUAL(exp.getSpectra().size(), 2)
+  TEST_EQUAL(batch.empty(), true)
+  TEST_EQUAL(exp.getSpectra()[0] == spec1, true)
+  TEST_EQUAL(exp.getSpectra()[1] == spec2, true)
+
+  // non-empty target: spectra are moved in
+  batch = { spec1 };
+  exp.addSpectra(std::move(batch));
+  TEST_EQUAL(exp.getSpectra().size(), 3)
+  TEST_EQUAL(batch.empty(), true)
+  TEST_EQUAL(exp.getSpectra()[2] == spec1, true)
+}
+END_SECTION
+
+START_SECTION((void addChromatograms(const std::vector<MSChromatogram>& chromatograms)))
+{
+  PeakMap exp;
+  MSChromatogram chrom1, chrom2;
+  ChromatogramPeak p1;
+  p1.setRT(0.1);
+  p1.setIntensity(10.0f);
+  chrom1.push_back(p1);
+  p1.setRT(0.2);
+  chrom2.push_back(p1);
+
+  std::vector<MSChromatogram> batch = { chrom1, chrom2 };
+  exp.addChromatograms(batch);
+  TEST_EQUAL(exp.getChromatograms().size(), 2)
+  TEST_EQUAL(batch.size(), 2)
+  TEST_EQUAL(exp.getChromatograms()[0] == chrom1, true)
+  TEST_EQUAL(exp.getChromatograms()[1] == chrom2, true)
+}
+END_SECTION
+
+START_SECTION((void addChromatograms(std::vector<MSChromatogram>&& chromatograms)))
+{
+  PeakMap exp;
+  MSChromatogram chrom1, chrom2;
+  ChromatogramPeak p1;
+  p1.setRT(0.1);
+  p1.setIntensity(10.0f);
+  chrom1.push_back(p1);
+  p1.setRT(0.2);
+  chrom2.push_back(p1);
+
+  exp.addChromatogram(chrom1);
+  std::vector<MSChromatogram> batch = { chrom2 };
+  exp.addChromatograms(std::move(batch));
+  TEST_EQUAL(exp.getChromatograms().size(), 2)
+  TEST_EQUAL(batch.empty(), true)
+  TEST_EQUAL(exp.getChromatograms()[0] == chrom1, true)
+  TEST_EQUAL(exp.getChromatograms()[1] == chrom2, true)
+}
+END_SECTION
+
 START_SECTION((const std::vector<MSChromatogram >& getChromatograms() const))
 {
   NOT_TESTABLE // tested above
@@ -277,6 +277,70 @@ START_SECTION((MSSpectrum& select(const std::vector<Size>& indices)))
 }
 END_SECTION
 
+START_SECTION((Size findFloatDataArray(const String& name) const))
+{
+  MSSpectrum s;
+  s.getFloatDataArrays().resize(2);
+  s.getFloatDataArrays()[0].setName("first");
+  s.getFloatDataArrays()[1].setName("second");
+  TEST_EQUAL(s.findFloatDataArray("first"), 0)
+  TEST_EQUAL(s.findFloatDataArray("second"), 1)
+  TEST_EQUAL(s.findFloatDataArray("does_not_exist"), Size(-1))
+}
+END_SECTION
+
+START_SECTION((Size findIntegerDataArray(const String& name) const))
+{
+  MSSpectrum s;
+  s.getIntegerDataArrays().resize(1);
+  s.getIntegerDataArrays()[0].setName("charge");
+  TEST_EQUAL(s.findIntegerDataArray("charge"), 0)
+  TEST_EQUAL(s.findIntegerDataArray("does_not_exist"), Size(-1))
+}
+END_SECTION
+
+START_SECTION((MSSpectrum& selectByFloatDataArray(Size array_index, float min_value, float max_value)))
+{
+  MSSpectrum s;
+  s.push_back(p1);
+  s.push_back(p2);
+  s.push_back(p3);
+  s.push_back(p2);
+  s.push_back(p1);
+
+  MSSpectrum::FloatDataArray afa;
+  afa.setName("column");
+  afa.assign({1.0, 2.0, 3.0, 4.0, 5.0});
+  s.getFloatDataArrays().push_back(afa);
+  MSSpectrum::IntegerDataArray aia;
+  aia.assign({1, 2, 3, 4, 5});
+  s.getIntegerDataArrays().push_back(aia);
+
+  MSSpectrum s2 = s;
+  s2.selectByFloatDataArray(s2.findFloatDataArray("column"), 2.0f, 4.0f);
+  TEST_EQUAL(s2.size(), 3)
+  TEST_REAL_SIMILAR(s2[0].getIntensity(), p2.getIntensity())
+  TEST_REAL_SIMILAR(s2[1].getIntensity(), p3.getIntensity())
+  TEST_REAL_SIMILAR(s2[2].getIntensity(), p2.getIntensity())
+  // the filter column and all other arrays are subset alongside the peaks
+  TEST_EQUAL(s2.getFloatDataArrays()[0].size(), 3)
+  TEST_REAL_SIMILAR(s2.getFloatDataArrays()[0][0], 2.0)
+  TEST_REAL_SIMILAR(s2.getFloatDataArrays()[0][2], 4.0)
+  TEST_EQUAL(s2.getIntegerDataArrays()[0].size(), 3)
+  TEST_EQUAL(s2.getIntegerDataArrays()[0][1], 3)
+
+  // empty selection is valid
+  s2 = s;
+  s2.selectByFloatDataArray(0, 100.0f, 200.0f);
+  TEST_EQUAL(s2.size(), 0)
+
+  // array size must match the spectrum
+  s2 = s;
+  s2.getFloatDataArrays()[0].resize(2);
+  TEST_EXCEPTION(Exception::Precondition, s2.selectByFloatDataArray(0, 2.0f, 4.0f))
+}
+END_SECTION
+
 /////////////////////////////////////////////////////////////
 // RangeManager
 
@@ -13,6 +13,7 @@
 #include <OpenMS/FILTERING/CALIBRATION/MZTrafoModel.h>
 ///////////////////////////
 
+#include <OpenMS/KERNEL/MSSpectrum.h>
 #include <OpenMS/MATH/MISC/MathFunctions.h>
 
 using namespace OpenMS;
@@ -124,6 +125,32 @@ START_SECTION(double predict(double mz) const)
   TEST_REAL_SIMILAR(m2.predict(mz_obs), mz_theo);
 END_SECTION
 
+START_SECTION(void applyToSpectrum(MSSpectrum& spec) const)
+  MZTrafoModel m(true);
+  m.setCoefficients(25, 0, 0);
+
+  MSSpectrum spec;
+  Peak1D p;
+  p.setMZ(100.0 + Math::ppmToMass(25.0, 100.0));
+  spec.push_back(p);
+  p.setMZ(500.0 + Math::ppmToMass(25.0, 500.0));
+  spec.push_back(p);
+
+  MSSpectrum spec2 = spec;
+  m.applyToSpectrum(spec2);
+  ABORT_IF(spec2.size() != 2)
+  // same result as per-peak predict():
+  TEST_REAL_SIMILAR(spec2[0].getMZ(), m.predict(spec[0].getMZ()));
+  TEST_REAL_SIMILAR(spec2[1].getMZ(), m.predict(spec[1].getMZ()));
+
+  MZTrafoModel m2(false);
+  m2.setCoefficients(0.25, 0, 0);
+  spec2 = spec;
+  m2.applyToSpectrum(spec2);
+  TEST_REAL_SIMILAR(spec2[0].getMZ(), m2.predict(spec[0].getMZ()));
+  TEST_REAL_SIMILAR(spec2[1].getMZ(), m2.predict(spec[1].getMZ()));
+END_SECTION
+
 
 START_SECTION(static Size findNearest(const std::vector<MZTrafoModel>& tms, double rt))
   std::vector<MZTrafoModel> tms;
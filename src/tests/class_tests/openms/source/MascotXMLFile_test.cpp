@@ -182,7 +182,7 @@ START_SECTION((void load(const String& filename, ProteinIdentification& protein_
     TEST_EQUAL(peptide_identifications[0].getHits().size(), 1);
 
     peptide_hit = peptide_identifications[0].getHits()[0];
-    vector<PeptideEvidence> pes = peptide_hit.getPeptideEvidences();
+    PeptideHit::PeptideEvidences pes = peptide_hit.getPeptideEvidences();
     TEST_EQUAL(pes.size(), 0);
     pes = peptide_identifications[34].getHits()[0].getPeptideEvidences();
     set<String> accessions = peptide_identifications[34].getHits()[0].extractProteinAccessionsSet();
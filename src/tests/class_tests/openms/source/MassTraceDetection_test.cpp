@@ -149,6 +149,28 @@ START_SECTION((void run(const PeakMap &, std::vector< MassTrace > &)))
 }
 END_SECTION
 
+START_SECTION([EXTRA] tiled execution mode reproduces the untiled results)
+{
+    MassTraceDetection mtd_tiled;
+    Param p_tiled = p_mtd;
+    p_tiled.setValue("mz_bands", 4);
+    mtd_tiled.setParameters(p_tiled);
+
+    std::vector<MassTrace> output_tiled;
+    mtd_tiled.run(input, output_tiled);
+
+    TEST_EQUAL(output_tiled.size(), 3);
+    for (Size i = 0; i < output_tiled.size(); ++i)
+    {
+        TEST_EQUAL(output_tiled[i].getSize(), exp_mt_lengths[i]);
+        TEST_REAL_SIMILAR(output_tiled[i].getCentroidRT(), exp_mt_rts[i]);
+        TEST_REAL_SIMILAR(output_tiled[i].getCentroidMZ(), exp_mt_mzs[i]);
+        TEST_REAL_SIMILAR(output_tiled[i].computePeakArea(), exp_mt_ints[i]);
+        TEST_EQUAL(output_tiled[i].getLabel(), "T" + String(i + 1));
+    }
+}
+END_SECTION
+
 std::vector<MassTrace> filt;
 
 //START_SECTION((void filterByPeakWidth(std::vector< MassTrace > &, std::vector< MassTrace > &)))
@@ -129,6 +129,25 @@ END_SECTION
 
 /////
 
+START_SECTION((MassTrace(std::vector<PeakType>&& trace_peaks)))
+{
+  std::vector<PeakType> peak_copy(peak_vec);
+  MassTrace tmp_mt(std::move(peak_copy));
+
+  TEST_EQUAL(tmp_mt.getSize(), peak_vec.size());
+
+  std::vector<PeakType>::const_iterator v_it = peak_vec.begin();
+
+  for (MassTrace::const_iterator m_it = tmp_mt.begin(); m_it != tmp_mt.end(); ++m_it)
+  {
+      TEST_EQUAL(*v_it, *m_it);
+      ++v_it;
+  }
+}
+END_SECTION
+
+/////
+
 
 
 MassTrace test_mt(peak_lst);
@@ -411,6 +430,20 @@ END_SECTION
 
 /////
 
+START_SECTION((void setSmoothedIntensities(std::vector<double>&& db_vec)))
+{
+  std::vector<double> ints_copy(smoothed_ints);
+  ints_copy.push_back(42.0);
+  TEST_EXCEPTION(Exception::InvalidValue, test_mt.setSmoothedIntensities(std::move(ints_copy)));
+
+  ints_copy = smoothed_ints;
+  test_mt.setSmoothedIntensities(std::move(ints_copy));
+  TEST_EQUAL(test_mt.getSmoothedIntensities().size(), smoothed_ints.size())
+}
+END_SECTION
+
+/////
+
 START_SECTION((std::vector<double> getSmoothedIntensities()))
 {
   std::vector<double> smoothed_vec = test_mt.getSmoothedIntensities();
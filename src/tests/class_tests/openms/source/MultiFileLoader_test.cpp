@@ -0,0 +1,101 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+#include <OpenMS/FORMAT/MultiFileLoader.h>
+///////////////////////////
+
+#include <OpenMS/FORMAT/MzMLFile.h>
+
+using namespace OpenMS;
+using namespace std;
+
+START_TEST(MultiFileLoader, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+MultiFileLoader* ptr = nullptr;
+MultiFileLoader* null_ptr = nullptr;
+
+// write a few small input files; each spectrum carries the file index as RT
+StringList filenames;
+for (Size f = 0; f < 5; ++f)
+{
+  PeakMap exp;
+  for (Size s = 0; s < 3; ++s)
+  {
+    MSSpectrum spec;
+    spec.setRT(100.0 * f + s);
+    spec.setMSLevel(1);
+    Peak1D p;
+    p.setMZ(400.0 + f);
+    p.setIntensity(1000.0f);
+    spec.push_back(p);
+    exp.addSpectrum(spec);
+  }
+  std::string tmp_filename;
+  NEW_TMP_FILE_EXT(tmp_filename, ".mzML");
+  MzMLFile().store(tmp_filename, exp);
+  filenames.push_back(tmp_filename);
+}
+
+START_SECTION((MultiFileLoader()))
+  ptr = new MultiFileLoader();
+  TEST_NOT_EQUAL(ptr, null_ptr)
+  TEST_EQUAL(ptr->getMaxFilesInFlight(), 4)
+  delete ptr;
+END_SECTION
+
+START_SECTION((void setMaxFilesInFlight(Size max_in_flight)))
+  MultiFileLoader loader;
+  loader.setMaxFilesInFlight(2);
+  TEST_EQUAL(loader.getMaxFilesInFlight(), 2)
+  loader.setMaxFilesInFlight(0); // clamped to 1
+  TEST_EQUAL(loader.getMaxFilesInFlight(), 1)
+END_SECTION
+
+START_SECTION((void load(const StringList& filenames, const std::function<void(Size, PeakMap&)>& consume, bool rewrite_source_file = false, bool compute_hash = false)))
+  MultiFileLoader loader;
+  loader.setMaxFilesInFlight(2);
+  std::vector<Size> consumed_order;
+  loader.load(filenames, [&](Size i, PeakMap& in)
+  {
+    consumed_order.push_back(i);
+    TEST_EQUAL(in.getNrSpectra(), 3)
+    TEST_REAL_SIMILAR(in[0].getRT(), 100.0 * i)
+  });
+  // consumed strictly in input order
+  TEST_EQUAL(consumed_order.size(), 5)
+  for (Size i = 0; i < consumed_order.size(); ++i)
+  {
+    TEST_EQUAL(consumed_order[i], i)
+  }
+
+  // a missing file raises the parser's exception on the calling thread
+  MultiFileLoader failing;
+  TEST_EXCEPTION(Exception::FileNotFound, failing.load({"does_not_exist.mzML"}, [](Size, PeakMap&) {}))
+END_SECTION
+
+START_SECTION((void load(const StringList& filenames, PeakMap& out)))
+  MultiFileLoader loader;
+  PeakMap out;
+  loader.load(filenames, out);
+  TEST_EQUAL(out.getNrSpectra(), 15)
+  // appended in input order
+  TEST_REAL_SIMILAR(out[0].getRT(), 0.0)
+  TEST_REAL_SIMILAR(out[3].getRT(), 100.0)
+  TEST_REAL_SIMILAR(out[14].getRT(), 402.0)
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
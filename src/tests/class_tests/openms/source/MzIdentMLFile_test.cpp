@@ -105,6 +105,45 @@ START_SECTION(void load(const String& filename, std::vector<ProteinIdentificatio
 }
 END_SECTION
 
+START_SECTION(void loadStreamed(const String& filename, std::vector<ProteinIdentification>& poid, std::vector<PeptideIdentification>& peid) )
+{
+  // the streamed path must deliver the same identifications as the DOM path
+  std::vector<ProteinIdentification> protein_ids, protein_ids2;
+  std::vector<PeptideIdentification> peptide_ids, peptide_ids2;
+  MzIdentMLFile().load(OPENMS_GET_TEST_DATA_PATH("MzIdentMLFile_msgf_mini.mzid"), protein_ids2, peptide_ids2);
+  MzIdentMLFile().loadStreamed(OPENMS_GET_TEST_DATA_PATH("MzIdentMLFile_msgf_mini.mzid"), protein_ids, peptide_ids);
+
+  ABORT_IF(protein_ids.size() != protein_ids2.size())
+  for (Size i = 0; i < protein_ids.size(); ++i)
+  {
+    TEST_EQUAL(protein_ids[i].getSearchEngine(), protein_ids2[i].getSearchEngine())
+    TEST_EQUAL(protein_ids[i].getSearchEngineVersion(), protein_ids2[i].getSearchEngineVersion())
+    TEST_EQUAL(protein_ids[i].getSearchParameters().db, protein_ids2[i].getSearchParameters().db)
+    ABORT_IF(protein_ids[i].getHits().size() != protein_ids2[i].getHits().size())
+    for (Size j = 0; j < protein_ids[i].getHits().size(); ++j)
+    {
+      TEST_EQUAL(protein_ids[i].getHits()[j].getAccession(), protein_ids2[i].getHits()[j].getAccession())
+    }
+  }
+
+  ABORT_IF(peptide_ids.size() != peptide_ids2.size())
+  for (Size i = 0; i < peptide_ids.size(); ++i)
+  {
+    TEST_EQUAL(peptide_ids[i].getScoreType(), peptide_ids2[i].getScoreType())
+    TEST_EQUAL(peptide_ids[i].isHigherScoreBetter(), peptide_ids2[i].isHigherScoreBetter())
+    TEST_EQUAL(peptide_ids[i].getSpectrumReference(), peptide_ids2[i].getSpectrumReference())
+    ABORT_IF(peptide_ids[i].getHits().size() != peptide_ids2[i].getHits().size())
+    for (Size j = 0; j < peptide_ids[i].getHits().size(); ++j)
+    {
+      TEST_EQUAL(peptide_ids[i].getHits()[j].getSequence().toString(), peptide_ids2[i].getHits()[j].getSequence().toString())
+      TEST_REAL_SIMILAR(peptide_ids[i].getHits()[j].getScore(), peptide_ids2[i].getHits()[j].getScore())
+      TEST_EQUAL(peptide_ids[i].getHits()[j].getCharge(), peptide_ids2[i].getHits()[j].getCharge())
+      TEST_EQUAL(peptide_ids[i].getHits()[j].getPeptideEvidences().size(), peptide_ids2[i].getHits()[j].getPeptideEvidences().size())
+    }
+  }
+}
+END_SECTION
+
 START_SECTION(void store(String filename, const std::vector<ProteinIdentification>& protein_ids, const std::vector<PeptideIdentification>& peptide_ids) )
 {
   //store and load data from various sources, starting with idxml, contents already checked above, so checking integrity of the data over repeated r/w
@@ -887,6 +887,33 @@ START_SECTION([EXTRA] load only meta data)
 }
 END_SECTION
 
+START_SECTION([EXTRA] load peaks only)
+{
+  MzMLFile file;
+  file.getOptions().setPeaksOnly(true);
+  PeakMap exp;
+  file.load(OPENMS_GET_TEST_DATA_PATH("MzMLFile_1.mzML"),exp);
+
+  TEST_EQUAL(exp.size(),4)
+  // peak data, RT, MS level and precursor information are retained
+  TEST_EQUAL(exp[1].size(),10)
+  TEST_REAL_SIMILAR(exp[1][0].getMZ(),0.0)
+  TEST_REAL_SIMILAR(exp[1][9].getIntensity(),2.0)
+  TEST_EQUAL(exp[1].getMSLevel(),2)
+  TEST_REAL_SIMILAR(exp[1].getRT(),5.2)
+  TEST_EQUAL(exp[1].getType(),SpectrumSettings::CENTROID)
+  TEST_EQUAL(exp[1].getPrecursors().size(),2)
+  TEST_REAL_SIMILAR(exp[1].getPrecursors()[0].getMZ(),5.55)
+  TEST_EQUAL(exp[1].getPrecursors()[0].getCharge(),2)
+  TEST_REAL_SIMILAR(exp[1].getPrecursors()[0].getIsolationWindowLowerOffset(),6.66)
+  // other spectrum meta data is not materialized
+  TEST_EQUAL(exp[1].getInstrumentSettings().getScanWindows().size(),0)
+  // file-level meta data is unaffected
+  TEST_EQUAL(exp.getIdentifier(),"document_accession");
+  TEST_EQUAL(exp.getContacts().size(),2)
+}
+END_SECTION
+
 START_SECTION([EXTRA] load with restricted MS levels)
 {
   MzMLFile file;
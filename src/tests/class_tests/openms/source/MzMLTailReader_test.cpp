@@ -0,0 +1,136 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/FORMAT/DATAACCESS/MzMLTailReader.h>
+
+///////////////////////////
+
+#include <OpenMS/FORMAT/DATAACCESS/MSDataStoringConsumer.h>
+
+#include <fstream>
+
+#define MULTI_LINE_STRING(...) #__VA_ARGS__
+
+using namespace std;
+using namespace OpenMS;
+
+// a complete spectrum with 15 peaks, as an instrument would append it
+const std::string spectrum_xml = MULTI_LINE_STRING(
+    <spectrum index="0" id="index=0" defaultArrayLength="15">
+      <binaryDataArrayList count="2">
+        <binaryDataArray encodedLength="160" >
+          <cvParam cvRef="MS" accession="MS:1000523" name="64-bit float" value=""/>
+          <cvParam cvRef="MS" accession="MS:1000576" name="no compression" value=""/>
+          <cvParam cvRef="MS" accession="MS:1000514" name="m/z array" unitAccession="MS:1000040" unitName="m/z" unitCvRef="MS"/>
+          <binary>AAAAAAAAAAAAAAAAAADwPwAAAAAAAABAAAAAAAAACEAAAAAAAAAQQAAAAAAAABRAAAAAAAAAGEAAAAAAAAAcQAAAAAAAACBAAAAAAAAAIkAAAAAAAAAkQAAAAAAAACZAAAAAAAAAKEAAAAAAAAAqQAAAAAAAACxA</binary>
+        </binaryDataArray>
+        <binaryDataArray encodedLength="160" >
+          <cvParam cvRef="MS" accession="MS:1000523" name="64-bit float" value=""/>
+          <cvParam cvRef="MS" accession="MS:1000576" name="no compression" value=""/>
+          <cvParam cvRef="MS" accession="MS:1000515" name="intensity array" value="" unitAccession="MS:1000131" unitName="number of detector counts" unitCvRef="MS"/>
+          <binary>AAAAAAAALkAAAAAAAAAsQAAAAAAAACpAAAAAAAAAKEAAAAAAAAAmQAAAAAAAACRAAAAAAAAAIkAAAAAAAAAgQAAAAAAAABxAAAAAAAAAGEAAAAAAAAAUQAAAAAAAABBAAAAAAAAACEAAAAAAAAAAQAAAAAAAAPA/</binary>
+        </binaryDataArray>
+      </binaryDataArrayList>
+    </spectrum>
+);
+
+// append a piece of "file content" to the growing file
+void appendToFile(const String& filename, const std::string& content)
+{
+  std::ofstream os(filename.c_str(), std::ios::app | std::ios::binary);
+  os << content;
+}
+
+START_TEST(MzMLTailReader, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+MzMLTailReader* ptr = nullptr;
+MzMLTailReader* nullPointer = nullptr;
+START_SECTION((MzMLTailReader(const String& filename)))
+{
+  ptr = new MzMLTailReader("growing.mzML");
+  TEST_NOT_EQUAL(ptr, nullPointer)
+  delete ptr;
+}
+END_SECTION
+
+START_SECTION((Size consumeNewSpectra(Interfaces::IMSDataConsumer* consumer)))
+{
+  String tmp_filename;
+  NEW_TMP_FILE(tmp_filename);
+  MzMLTailReader tail_reader(tmp_filename);
+  MSDataStoringConsumer consumer;
+
+  TEST_EXCEPTION(Exception::IllegalArgument, tail_reader.consumeNewSpectra(nullptr))
+  // the file was not created yet
+  TEST_EXCEPTION(Exception::FileNotFound, tail_reader.consumeNewSpectra(&consumer))
+
+  // "acquisition" starts: metadata and a first, complete spectrum appear,
+  // plus the first half of a second spectrum
+  appendToFile(tmp_filename, "<mzML><run><spectrumList count=\"2\">");
+  appendToFile(tmp_filename, spectrum_xml);
+  appendToFile(tmp_filename, spectrum_xml.substr(0, spectrum_xml.size() / 2));
+  TEST_EQUAL(tail_reader.consumeNewSpectra(&consumer), 1)
+  TEST_EQUAL(consumer.getData().getNrSpectra(), 1)
+  TEST_EQUAL(consumer.getData().getSpectra()[0].size(), 15)
+  TEST_REAL_SIMILAR(consumer.getData().getSpectra()[0][7].getMZ(), 7.0)
+  TEST_REAL_SIMILAR(consumer.getData().getSpectra()[0][7].getIntensity(), 8.0)
+
+  // nothing new yet - the second spectrum is still incomplete
+  TEST_EQUAL(tail_reader.consumeNewSpectra(&consumer), 0)
+
+  // the rest of the second spectrum and the end of the run are written
+  appendToFile(tmp_filename, spectrum_xml.substr(spectrum_xml.size() / 2));
+  appendToFile(tmp_filename, "</spectrumList></run></mzML>");
+  TEST_EQUAL(tail_reader.consumeNewSpectra(&consumer), 1)
+  TEST_EQUAL(consumer.getData().getNrSpectra(), 2)
+  TEST_EQUAL(consumer.getData().getSpectra()[1].size(), 15)
+
+  // stable once the file stops growing
+  TEST_EQUAL(tail_reader.consumeNewSpectra(&consumer), 0)
+}
+END_SECTION
+
+START_SECTION((Size getNrSpectraRead() const))
+{
+  String tmp_filename;
+  NEW_TMP_FILE(tmp_filename);
+  MzMLTailReader tail_reader(tmp_filename);
+  MSDataStoringConsumer consumer;
+
+  appendToFile(tmp_filename, spectrum_xml);
+  TEST_EQUAL(tail_reader.getNrSpectraRead(), 0)
+  tail_reader.consumeNewSpectra(&consumer);
+  TEST_EQUAL(tail_reader.getNrSpectraRead(), 1)
+}
+END_SECTION
+
+START_SECTION((void setSkipXMLChecks(bool skip)))
+{
+  String tmp_filename;
+  NEW_TMP_FILE(tmp_filename);
+  MzMLTailReader tail_reader(tmp_filename);
+  MSDataStoringConsumer consumer;
+  tail_reader.setSkipXMLChecks(true);
+
+  appendToFile(tmp_filename, spectrum_xml);
+  TEST_EQUAL(tail_reader.consumeNewSpectra(&consumer), 1)
+  TEST_EQUAL(consumer.getData().getSpectra()[0].size(), 15)
+}
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
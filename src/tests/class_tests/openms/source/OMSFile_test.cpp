@@ -220,6 +220,32 @@ START_SECTION(void load(const String& filename, ConsensusMap& consensus))
 }
 END_SECTION
 
+START_SECTION(void setFastStore(bool fast_store))
+{
+  FeatureMap features;
+  FeatureXMLFile().load(OPENMS_GET_TEST_DATA_PATH("FeatureXMLFileOMStest_1.featureXML"), features);
+  for (auto& run : features.getProteinIdentifications())
+  {
+    run.setScoreType(run.getScoreType() + "_protein");
+  }
+  IdentificationDataConverter::importFeatureIDs(features);
+
+  // bulk-ingestion mode must produce an equivalent, loadable file
+  OMSFile oms;
+  TEST_EQUAL(oms.getFastStore(), false);
+  oms.setFastStore(true);
+  TEST_EQUAL(oms.getFastStore(), true);
+  String fast_tmp;
+  NEW_TMP_FILE(fast_tmp);
+  oms.store(fast_tmp, features);
+  TEST_EQUAL(File::empty(fast_tmp), false);
+
+  FeatureMap out;
+  oms.load(fast_tmp, out);
+  TEST_EQUAL(out.size(), features.size());
+}
+END_SECTION
+
 /////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////
 END_TEST
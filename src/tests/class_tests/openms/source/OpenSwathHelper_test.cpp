@@ -107,6 +107,134 @@ START_SECTION(static void selectSwathTransitions(const OpenSwath::LightTargetedE
 }
 END_SECTION
 
+START_SECTION(static void selectSwathTransitions(const OpenSwath::LightTargetedExperiment &targeted_exp, const SwathTransitionIndex& index, OpenSwath::LightTargetedExperiment &transition_exp_used, double min_upper_edge_dist, double lower, double upper))
+{
+  LightTargetedExperiment exp1;
+
+  LightTransition tr1;
+  LightTransition tr2;
+  LightTransition tr3;
+  LightTransition tr4;
+
+  tr1.precursor_mz = 100.0;
+  tr1.peptide_ref = "pep1";
+  tr2.precursor_mz = 200.0;
+  tr2.peptide_ref = "pep1";
+  tr3.precursor_mz = 300.0;
+  tr3.peptide_ref = "pep2";
+  tr4.precursor_mz = 499.5; // too close to the upper edge
+  tr4.peptide_ref = "pep2";
+
+  exp1.transitions.push_back(tr1);
+  exp1.transitions.push_back(tr2);
+  exp1.transitions.push_back(tr3);
+  exp1.transitions.push_back(tr4);
+
+  LightCompound pep1;
+  pep1.id = "pep1";
+  pep1.protein_refs.push_back("prot1");
+  LightCompound pep2;
+  pep2.id = "pep2";
+  pep2.protein_refs.push_back("prot2");
+  exp1.compounds.push_back(pep1);
+  exp1.compounds.push_back(pep2);
+
+  LightProtein prot1;
+  prot1.id = "prot1";
+  LightProtein prot2;
+  prot2.id = "prot2";
+  exp1.proteins.push_back(prot1);
+  exp1.proteins.push_back(prot2);
+
+  SwathTransitionIndex index(exp1);
+
+  // the indexed overload must select the same entries as the linear scan
+  LightTargetedExperiment linear, indexed;
+  OpenSwathHelper::selectSwathTransitions(exp1, linear, 1.0, 199.9, 500);
+  OpenSwathHelper::selectSwathTransitions(exp1, index, indexed, 1.0, 199.9, 500);
+  ABORT_IF(indexed.transitions.size() != linear.transitions.size())
+  for (Size i = 0; i < linear.transitions.size(); i++)
+  {
+    TEST_EQUAL(indexed.transitions[i].getNativeID(), linear.transitions[i].getNativeID())
+    TEST_REAL_SIMILAR(indexed.transitions[i].precursor_mz, linear.transitions[i].precursor_mz)
+  }
+  ABORT_IF(indexed.compounds.size() != linear.compounds.size())
+  for (Size i = 0; i < linear.compounds.size(); i++)
+  {
+    TEST_EQUAL(indexed.compounds[i].id, linear.compounds[i].id)
+  }
+  ABORT_IF(indexed.proteins.size() != linear.proteins.size())
+  for (Size i = 0; i < linear.proteins.size(); i++)
+  {
+    TEST_EQUAL(indexed.proteins[i].id, linear.proteins[i].id)
+  }
+
+  // tr2 and tr3 fall into the window, tr4 is within min_upper_edge_dist of the edge
+  TEST_EQUAL(indexed.transitions.size(), 2)
+  TEST_EQUAL(indexed.compounds.size(), 2)
+  TEST_EQUAL(indexed.proteins.size(), 2)
+
+  // direct window queries on the index
+  std::vector<Size> hits = index.query(1.0, 199.9, 500);
+  ABORT_IF(hits.size() != 2)
+  TEST_EQUAL(hits[0], 1)
+  TEST_EQUAL(hits[1], 2)
+  TEST_EQUAL(index.query(1.0, 600, 700).empty(), true)
+
+  // compound / protein lookups
+  TEST_EQUAL(index.hasCompound("pep2"), true)
+  TEST_EQUAL(index.getCompoundIndex("pep2"), 1)
+  TEST_EQUAL(index.hasCompound("does_not_exist"), false)
+  TEST_EXCEPTION(Exception::ElementNotFound, index.getCompoundIndex("does_not_exist"))
+  TEST_EQUAL(index.hasProtein("prot1"), true)
+  TEST_EQUAL(index.getProteinIndex("prot1"), 0)
+  TEST_EXCEPTION(Exception::ElementNotFound, index.getProteinIndex("does_not_exist"))
+}
+END_SECTION
+
+START_SECTION(([EXTRA] SwathMapIndex))
+{
+  // an MS1 map followed by four overlapping isolation windows
+  std::vector<OpenSwath::SwathMap> swath_maps;
+  OpenSwath::SwathMap ms1_map;
+  ms1_map.ms1 = true;
+  swath_maps.push_back(ms1_map);
+  swath_maps.push_back(OpenSwath::SwathMap(400.0, 425.0, 412.5, false));
+  swath_maps.push_back(OpenSwath::SwathMap(420.0, 445.0, 432.5, false));
+  swath_maps.push_back(OpenSwath::SwathMap(440.0, 465.0, 452.5, false));
+  swath_maps.push_back(OpenSwath::SwathMap(460.0, 485.0, 472.5, false));
+
+  SwathMapIndex index(swath_maps);
+
+  // point queries select the same maps as a linear scan (lower < m/z < upper)
+  std::vector<Size> hits = index.query(422.0);
+  ABORT_IF(hits.size() != 2)
+  TEST_EQUAL(hits[0], 1)
+  TEST_EQUAL(hits[1], 2)
+  for (Size i : hits)
+  {
+    TEST_EQUAL(swath_maps[i].lower < 422.0 && 422.0 < swath_maps[i].upper, true)
+  }
+  TEST_EQUAL(index.query(425.0).size(), 1) // window edges are exclusive
+  TEST_EQUAL(index.query(390.0).empty(), true)
+
+  // interval queries select the maps containing one of the interval edges
+  hits = index.queryOverlap(430.0, 455.0);
+  ABORT_IF(hits.size() != 2)
+  TEST_EQUAL(hits[0], 2)
+  TEST_EQUAL(hits[1], 3)
+
+  // a map lying strictly inside the interval does not qualify
+  hits = index.queryOverlap(400.0, 500.0);
+  ABORT_IF(hits.size() != 1)
+  TEST_EQUAL(hits[0], 1)
+
+  // rebuilding replaces the previous content
+  index.build(std::vector<OpenSwath::SwathMap>());
+  TEST_EQUAL(index.query(422.0).empty(), true)
+}
+END_SECTION
+
 START_SECTION( (template < class TargetedExperimentT > static bool checkSwathMapAndSelectTransitions(const OpenMS::PeakMap &exp, const TargetedExperimentT &targeted_exp, TargetedExperimentT &transition_exp_used, double min_upper_edge_dist)))
 {
   // tested above already
@@ -142,12 +142,24 @@ START_TEST(ParamValue, "$Id$")
                 TEST_EQUAL(d, "test string")
         END_SECTION
 
+        START_SECTION((ParamValue(std::string&&)))
+                string s = "test string with enough characters to require heap storage";
+                ParamValue d(std::move(s));
+                TEST_EQUAL(d, "test string with enough characters to require heap storage")
+        END_SECTION
+
         START_SECTION((ParamValue(const vector<string> &)))
                 vector<string> sl = {"test string", "test String 2"};
                 ParamValue d(sl);
                 TEST_TRUE(d == sl)
         END_SECTION
 
+        START_SECTION((ParamValue(vector<string>&&)))
+                vector<string> sl = {"test string", "test String 2"};
+                ParamValue d(vector<string>(sl));
+                TEST_TRUE(d == sl)
+        END_SECTION
+
         START_SECTION((ParamValue(const vector<int> &)))
                 vector<int> il = {1, 2};
                 ParamValue d(il);
@@ -660,6 +672,24 @@ START_TEST(ParamValue, "$Id$")
                 }
         END_SECTION
 
+        START_SECTION((ParamValue& operator=(std::string&&)))
+                {
+                    std::string v = "a value with enough characters to require heap storage";
+                    ParamValue a("v");
+                    a = std::move(v);
+                    TEST_EQUAL(a, "a value with enough characters to require heap storage")
+                }
+        END_SECTION
+
+        START_SECTION((ParamValue& operator=(vector<string>&&)))
+                {
+                    vector<string> v = {"value 1", "value 2"};
+                    ParamValue a("v");
+                    a = vector<string>(v);
+                    TEST_TRUE(a == v)
+                }
+        END_SECTION
+
         START_SECTION((ParamValue& operator=(const vector<string>&)))
                 {
                     vector<string> v = {"value","value2"};
@@ -963,6 +963,28 @@ START_SECTION((Param& operator = (const Param& rhs)))
 	TEST_EQUAL(p2.getTags("test:float") == ListUtils::create<std::string>("a,b,c"), true)
 END_SECTION
 
+START_SECTION(([EXTRA] copy-on-write semantics))
+	// copies share the parameter tree; modifying one side must not affect the other
+	Param p2(p_src);
+	TEST_EQUAL(p2 == p_src, true)
+	p2.setValue("test:int", 4711);
+	TEST_EQUAL(Int(p2.getValue("test:int")), 4711)
+	TEST_EQUAL(Int(p_src.getValue("test:int")), 17)
+
+	Param p3;
+	p3 = p_src;
+	p_src.setValue("test:int", 815);
+	TEST_EQUAL(Int(p3.getValue("test:int")), 17)
+	TEST_EQUAL(Int(p_src.getValue("test:int")), 815)
+	p_src.setValue("test:int", 17, "intdesc"); // restore for the sections below
+
+	// removing from one copy leaves the other intact
+	Param p4(p_src);
+	p4.remove("test2:int");
+	TEST_EQUAL(p4.exists("test2:int"), false)
+	TEST_EQUAL(p_src.exists("test2:int"), true)
+END_SECTION
+
 START_SECTION((Param copy(const std::string &prefix, bool remove_prefix=false) const))
 	Param p2;
 
@@ -82,6 +82,17 @@ START_SECTION((bool getMetadataOnly() const))
 	TEST_EQUAL(tmp.getMetadataOnly(), false);
 END_SECTION
 
+START_SECTION((void setPeaksOnly(bool peaks_only)))
+	PeakFileOptions tmp;
+	tmp.setPeaksOnly(true);
+	TEST_EQUAL(tmp.getPeaksOnly(), true);
+END_SECTION
+
+START_SECTION((bool getPeaksOnly() const))
+	PeakFileOptions tmp;
+	TEST_EQUAL(tmp.getPeaksOnly(), false);
+END_SECTION
+
 START_SECTION((void setWriteSupplementalData(bool write)))
 	PeakFileOptions tmp;
 	tmp.setWriteSupplementalData(false);
@@ -948,6 +948,69 @@ START_SECTION(PeakShapeMetrics calculatePeakShapeMetrics(
 }
 END_SECTION
 
+START_SECTION(PeakProperties computePeakProperties(
+  const MSChromatogram& chromatogram, const double left, const double right
+) const)
+{
+  // same results as the three separate calls
+  PeakIntegrator::PeakProperties props = ptr->computePeakProperties(chromatogram, left, right);
+  const PeakIntegrator::PeakArea pa = ptr->integratePeak(chromatogram, left, right);
+  const PeakIntegrator::PeakBackground pb = ptr->estimateBackground(chromatogram, left, right, pa.apex_pos);
+  const PeakIntegrator::PeakShapeMetrics psm = ptr->calculatePeakShapeMetrics(chromatogram, left, right, pa.height, pa.apex_pos);
+  TEST_REAL_SIMILAR(props.area.area, pa.area)
+  TEST_REAL_SIMILAR(props.area.height, pa.height)
+  TEST_REAL_SIMILAR(props.area.apex_pos, pa.apex_pos)
+  TEST_EQUAL(props.area.hull_points.size(), pa.hull_points.size())
+  TEST_REAL_SIMILAR(props.background.area, pb.area)
+  TEST_REAL_SIMILAR(props.background.height, pb.height)
+  TEST_REAL_SIMILAR(props.shape_metrics.width_at_50, psm.width_at_50)
+  TEST_REAL_SIMILAR(props.shape_metrics.tailing_factor, psm.tailing_factor)
+  TEST_REAL_SIMILAR(props.shape_metrics.asymmetry_factor, psm.asymmetry_factor)
+  TEST_EQUAL(props.shape_metrics.points_across_baseline, psm.points_across_baseline)
+  TEST_EQUAL(props.shape_metrics.points_across_half_height, psm.points_across_half_height)
+}
+END_SECTION
+
+START_SECTION(PeakProperties computePeakProperties(
+  const MSSpectrum& spectrum, const double left, const double right
+) const)
+{
+  PeakIntegrator::PeakProperties props = ptr->computePeakProperties(spectrum, left, right);
+  const PeakIntegrator::PeakArea pa = ptr->integratePeak(spectrum, left, right);
+  TEST_REAL_SIMILAR(props.area.area, pa.area)
+  TEST_REAL_SIMILAR(props.area.height, pa.height)
+  TEST_REAL_SIMILAR(props.area.apex_pos, pa.apex_pos)
+}
+END_SECTION
+
+START_SECTION(std::vector<PeakProperties> computePeakProperties(
+  const std::vector<MSChromatogram>& chromatograms,
+  const std::vector<PeakBoundary>& boundaries
+) const)
+{
+  const std::vector<MSChromatogram> chromatograms { chromatogram, chromatogram_2 };
+  std::vector<PeakIntegrator::PeakBoundary> boundaries(3);
+  boundaries[0] = { 0, left, right };
+  boundaries[1] = { 1, position_2.front(), position_2.back() };
+  boundaries[2] = { 0, left_few, right_few };
+  const std::vector<PeakIntegrator::PeakProperties> results = ptr->computePeakProperties(chromatograms, boundaries);
+  ABORT_IF(results.size() != 3)
+  for (Size i = 0; i < boundaries.size(); ++i)
+  {
+    const PeakIntegrator::PeakProperties props =
+      ptr->computePeakProperties(chromatograms[boundaries[i].chromatogram_idx], boundaries[i].left, boundaries[i].right);
+    TEST_REAL_SIMILAR(results[i].area.area, props.area.area)
+    TEST_REAL_SIMILAR(results[i].area.height, props.area.height)
+    TEST_REAL_SIMILAR(results[i].background.area, props.background.area)
+    TEST_REAL_SIMILAR(results[i].shape_metrics.total_width, props.shape_metrics.total_width)
+  }
+
+  // out-of-range chromatogram index
+  boundaries[1].chromatogram_idx = 2;
+  TEST_EXCEPTION(Exception::InvalidValue, ptr->computePeakProperties(chromatograms, boundaries))
+}
+END_SECTION
+
 START_SECTION([EXTRA]  template <typename PeakContainerConstIteratorT> double findPosAtPeakHeightPercent_(...))
 {
   PeakIntegratorTest pit;
@@ -162,6 +162,42 @@ START_SECTION(void pickChromatogram(const RichPeakChromatogram &chromatogram, Ri
 }
 END_SECTION
 
+START_SECTION(void pickChromatograms(const std::vector<MSChromatogram>& chromatograms, std::vector<MSChromatogram>& picked_chroms, std::vector<MSChromatogram>& smoothed_chroms))
+{
+  PeakPickerChromatogram picker;
+  Param picker_param = picker.getDefaults();
+  picker_param.setValue("method", "corrected");
+  picker_param.setValue("peak_width", -1.0);
+  picker_param.setValue("signal_to_noise", 0.0); // without noise estimation the batch result is identical
+  picker.setParameters(picker_param);
+
+  std::vector<RichPeakChromatogram> chroms;
+  chroms.push_back(get_chrom(0));
+  chroms.push_back(get_chrom(1));
+
+  std::vector<RichPeakChromatogram> picked_chroms, smoothed_chroms;
+  picker.pickChromatograms(chroms, picked_chroms, smoothed_chroms);
+  TEST_EQUAL(picked_chroms.size(), 2);
+  TEST_EQUAL(smoothed_chroms.size(), 2);
+  ABORT_IF(picked_chroms.size() != 2);
+
+  // compare against the per-chromatogram function:
+  for (Size i = 0; i < chroms.size(); ++i)
+  {
+    RichPeakChromatogram picked_chrom, smoothed_chrom;
+    picker.pickChromatogram(chroms[i], picked_chrom, smoothed_chrom);
+    TEST_EQUAL(picked_chroms[i].size(), picked_chrom.size());
+    ABORT_IF(picked_chroms[i].size() != picked_chrom.size());
+    for (Size k = 0; k < picked_chrom.size(); ++k)
+    {
+      TEST_REAL_SIMILAR(picked_chroms[i][k].getMZ(), picked_chrom[k].getMZ());
+      TEST_REAL_SIMILAR(picked_chroms[i][k].getIntensity(), picked_chrom[k].getIntensity());
+    }
+    TEST_EQUAL(picked_chroms[i].getFloatDataArrays().size(), PeakPickerChromatogram::SIZE_OF_FLOATINDICES);
+  }
+}
+END_SECTION
+
 /////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////
 END_TEST
@@ -45,6 +45,44 @@ START_SECTION(PeakWidthEstimator(const PeakMap & exp_picked, const std::vector<s
 }
 END_SECTION
 
+START_SECTION(PeakWidthEstimator(const PeakMap & exp_picked, const std::vector<std::vector<PeakPickerHiRes::PeakBoundary> > & boundaries, Size mz_buckets))
+{
+  // synthetic peaks with width growing linearly in m/z
+  PeakMap synthetic;
+  std::vector<std::vector<PeakPickerHiRes::PeakBoundary> > synthetic_boundaries;
+  for (Size s = 0; s < 5; ++s)
+  {
+    MSSpectrum spectrum;
+    std::vector<PeakPickerHiRes::PeakBoundary> spectrum_boundaries;
+    for (double mz = 400.0; mz < 600.0; mz += 2.0)
+    {
+      spectrum.push_back(Peak1D(mz, 1000.0));
+      PeakPickerHiRes::PeakBoundary boundary;
+      boundary.mz_min = mz - mz * 1e-5;
+      boundary.mz_max = mz + mz * 1e-5;
+      spectrum_boundaries.push_back(boundary);
+    }
+    synthetic.addSpectrum(spectrum);
+    synthetic_boundaries.push_back(spectrum_boundaries);
+  }
+
+  PeakWidthEstimator exact(synthetic, synthetic_boundaries);
+  PeakWidthEstimator sketched(synthetic, synthetic_boundaries, 20);
+
+  // bucketed medians must reproduce the width trend of the exact fit
+  TOLERANCE_ABSOLUTE(0.001)
+  TEST_REAL_SIMILAR(sketched.getPeakWidth(450.0), exact.getPeakWidth(450.0))
+  TEST_REAL_SIMILAR(sketched.getPeakWidth(500.0), exact.getPeakWidth(500.0))
+  TEST_REAL_SIMILAR(sketched.getPeakWidth(550.0), exact.getPeakWidth(550.0))
+  TEST_REAL_SIMILAR(sketched.getPeakWidth(300.0), exact.getPeakWidth(300.0)) // outside m/z range
+
+  // no peaks at all
+  PeakMap empty_map;
+  std::vector<std::vector<PeakPickerHiRes::PeakBoundary> > empty_boundaries;
+  TEST_EXCEPTION(Exception::UnableToFit, PeakWidthEstimator(empty_map, empty_boundaries, 20))
+}
+END_SECTION
+
 PeakWidthEstimator estimator2(exp_picked, boundaries_exp_s);
 
 START_SECTION(double getPeakWidth(double mz))
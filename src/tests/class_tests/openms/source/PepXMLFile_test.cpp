@@ -97,7 +97,7 @@ START_SECTION(void load(const String& filename, std::vector<ProteinIdentificatio
 
   // no use checking score, because implementation may still change
   TEST_EQUAL(pep_hit.getCharge(), 3);
-  vector<PeptideEvidence> pes = pep_hit.getPeptideEvidences();
+  PeptideHit::PeptideEvidences pes = pep_hit.getPeptideEvidences();
   TEST_EQUAL(pes.size(), 3);
   TEST_EQUAL(pes[0].getProteinAccession(), "ddb000449223");
   TEST_EQUAL(pes[0].getAABefore(), 'R');
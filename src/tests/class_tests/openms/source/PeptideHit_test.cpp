@@ -170,6 +170,26 @@ START_SECTION((void setPeptideEvidences(const vector<PeptideEvidence> & peptide_
     TEST_EQUAL(hit.getPeptideEvidences()[1].getProteinAccession() == String("ACD392"), true)
 END_SECTION
 
+START_SECTION((void setPeptideEvidences(PeptideEvidences&& peptide_evidences)))
+     PeptideHit hit;
+     PeptideHit::PeptideEvidences pes(2, PeptideEvidence());
+     pes[0].setProteinAccession("ACC392");
+     pes[1].setProteinAccession("ACD392");
+     hit.setPeptideEvidences(std::move(pes));
+    TEST_EQUAL(hit.getPeptideEvidences().size(), 2)
+    TEST_EQUAL(hit.getPeptideEvidences()[0].getProteinAccession() == String("ACC392"), true)
+    TEST_EQUAL(hit.getPeptideEvidences()[1].getProteinAccession() == String("ACD392"), true)
+END_SECTION
+
+START_SECTION((void addPeptideEvidence(PeptideEvidence&& peptide_evidence)))
+     PeptideHit hit;
+     PeptideEvidence pe;
+     pe.setProteinAccession("ACC392");
+     hit.addPeptideEvidence(std::move(pe));
+    TEST_EQUAL(hit.getPeptideEvidences().size(), 1)
+    TEST_EQUAL(hit.getPeptideEvidences()[0].getProteinAccession() == String("ACC392"), true)
+END_SECTION
+
 
 START_SECTION((const std::set<String>& extractProteinAccessionsSet() const))
      PeptideHit hit;
@@ -11,6 +11,7 @@
 
 ///////////////////////////
 #include <OpenMS/FORMAT/PercolatorInfile.h>
+#include <sstream>
 ///////////////////////////
 
 using namespace OpenMS;
@@ -59,6 +60,38 @@ START_SECTION(vector<PeptideIdentification> PercolatorInfile::load(const String&
 }
 END_SECTION
 
+START_SECTION(static void store(std::ostream& os, const std::vector<PeptideIdentification>& peptide_ids, const StringList& feature_set, const std::string& enz, int min_charge, int max_charge))
+{
+  // streaming variant: rows go directly to the stream (e.g. a pipe to percolator)
+  vector<PeptideIdentification> pids(1);
+  pids[0].setRT(100.0);
+  pids[0].setMZ(500.25);
+  pids[0].setSpectrumReference("scan=42");
+  PeptideHit ph(1.5, 1, 2, AASequence::fromString("PEPTIDER"));
+  ph.setMetaValue("target_decoy", "target");
+  ph.addPeptideEvidence(PeptideEvidence("P12345"));
+  pids[0].insertHit(ph);
+
+  StringList feature_set = {"SpecId", "Label", "ScanNr", "ExpMass", "CalcMass", "score", "peplen", "enzN", "enzC", "enzInt", "dm", "absdm", "Peptide", "Proteins"};
+  std::ostringstream oss;
+  PercolatorInfile::store(oss, pids, feature_set, "trypsin", 2, 3);
+
+  StringList lines;
+  String(oss.str()).split('\n', lines);
+  TEST_EQUAL(lines.size() >= 2, true)
+  ABORT_IF(lines.size() < 2)
+  TEST_STRING_EQUAL(lines[0], ListUtils::concatenate(feature_set, '\t'))
+  StringList cols;
+  lines[1].split('\t', cols);
+  TEST_EQUAL(cols.size(), feature_set.size())
+  ABORT_IF(cols.size() != feature_set.size())
+  TEST_STRING_EQUAL(cols[0], "scan=42") // SpecId
+  TEST_STRING_EQUAL(cols[1], "1") // Label: target
+  TEST_STRING_EQUAL(cols[2], "42") // ScanNr
+  TEST_STRING_EQUAL(cols[6], "8") // peplen
+}
+END_SECTION
+
 /////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////
 END_TEST
@@ -0,0 +1,95 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/CONCEPT/PhaseProfiler.h>
+#include <OpenMS/DATASTRUCTURES/ListUtils.h>
+#include <OpenMS/FORMAT/TextFile.h>
+
+///////////////////////////
+
+using namespace OpenMS;
+using namespace std;
+
+START_TEST(PhaseProfiler, "$Id$")
+
+/////////////////////////////////////////////////////////////
+
+START_SECTION(static PhaseProfiler* getInstance())
+{
+  PhaseProfiler* profiler = PhaseProfiler::getInstance();
+  TEST_NOT_EQUAL(profiler, nullptr)
+  TEST_EQUAL(profiler, PhaseProfiler::getInstance()) // singleton
+}
+END_SECTION
+
+START_SECTION(bool isEnabled() const)
+{
+  // disabled by default (unless OPENMS_PHASE_PROFILE is set, which it is not in tests)
+  TEST_EQUAL(PhaseProfiler::getInstance()->isEnabled(), false)
+}
+END_SECTION
+
+START_SECTION(void startPhase(const String& label))
+{
+  // no-op while disabled
+  PhaseProfiler::getInstance()->startPhase("ignored");
+  TEST_EQUAL(PhaseProfiler::getInstance()->isEnabled(), false)
+}
+END_SECTION
+
+START_SECTION(void endPhase())
+{
+  // unbalanced calls must be tolerated
+  PhaseProfiler::getInstance()->endPhase();
+  NOT_TESTABLE // tested via dump() below
+}
+END_SECTION
+
+START_SECTION(void enable(const String& filename))
+{
+  String filename;
+  NEW_TMP_FILE(filename);
+  PhaseProfiler* profiler = PhaseProfiler::getInstance();
+  profiler->enable(filename);
+  TEST_EQUAL(profiler->isEnabled(), true)
+}
+END_SECTION
+
+START_SECTION(void dump() const)
+{
+  String filename;
+  NEW_TMP_FILE(filename);
+  PhaseProfiler* profiler = PhaseProfiler::getInstance();
+  profiler->enable(filename);
+
+  profiler->startPhase("outer phase");
+  profiler->startPhase("inner phase");
+  profiler->endPhase();
+  profiler->endPhase();
+  profiler->startPhase("never ended"); // must not show up in the profile
+  profiler->dump();
+
+  TextFile profile;
+  profile.load(filename);
+  String content = ListUtils::concatenate(StringList(profile.begin(), profile.end()), "\n");
+  TEST_EQUAL(content.hasSubstring("\"outer phase\""), true)
+  TEST_EQUAL(content.hasSubstring("\"inner phase\""), true)
+  TEST_EQUAL(content.hasSubstring("never ended"), false)
+  TEST_EQUAL(content.hasSubstring("\"wall_time\""), true)
+  TEST_EQUAL(content.hasSubstring("\"mem_peak_kb\""), true)
+}
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+
+END_TEST
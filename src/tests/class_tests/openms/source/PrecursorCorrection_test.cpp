@@ -297,6 +297,32 @@ TEST_REAL_SIMILAR(dmz_2[2], -0.0004);
 }
 END_SECTION
 
+START_SECTION((static bool correctToMS1Peak(const MSSpectrum& ms1, MSSpectrum& ms2, double mz_tolerance, bool ppm, bool highest_intensity, double& delta_mz)))
+{
+  double delta_mz = 47.11;
+
+  // nearest peak: 509.9999 -> 510.0000
+  MSSpectrum ms2 = ms2_spectrum_1;
+  TEST_EQUAL(PrecursorCorrection::correctToMS1Peak(ms1_spectrum_1, ms2, 1, true, false, delta_mz), true);
+  TEST_REAL_SIMILAR(ms2.getPrecursors()[0].getMZ(), 510.0000);
+  TEST_REAL_SIMILAR(delta_mz, 0.0001);
+
+  // highest intensity peak in +/- 0.0005 Da of 610.0001: 609.9998 (also corrects the precursor intensity)
+  ms2 = ms2_spectrum_2;
+  TEST_EQUAL(PrecursorCorrection::correctToMS1Peak(ms1_spectrum_2, ms2, 0.0005, false, true, delta_mz), true);
+  TEST_REAL_SIMILAR(ms2.getPrecursors()[0].getMZ(), 609.9998);
+  TEST_REAL_SIMILAR(ms2.getPrecursors()[0].getIntensity(), 250.0);
+  TEST_REAL_SIMILAR(delta_mz, -0.0003);
+
+  // no correction without a usable survey scan
+  MSSpectrum empty_ms1;
+  ms2 = ms2_spectrum_1;
+  TEST_EQUAL(PrecursorCorrection::correctToMS1Peak(empty_ms1, ms2, 1, true, false, delta_mz), false);
+  TEST_REAL_SIMILAR(ms2.getPrecursors()[0].getMZ(), 509.9999);
+  TEST_REAL_SIMILAR(delta_mz, 0.0);
+}
+END_SECTION
+
 // FeatureMap
 DPosition<2> position_1(175.0, 609.9100);
 DPosition<2> position_2(185.0, 611.9300);
@@ -0,0 +1,134 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/MATH/STATISTICS/QuantileSketch.h>
+#include <cmath>
+#include <vector>
+using namespace OpenMS;
+using namespace OpenMS::Math;
+using namespace std;
+
+///////////////////////////
+
+START_TEST(QuantileSketch, "$Id$")
+
+/////////////////////////////////////////////////////////////
+
+QuantileSketch* qs_ptr = nullptr;
+QuantileSketch* qs_null = nullptr;
+
+START_SECTION((explicit QuantileSketch(Size k=200)))
+  qs_ptr = new QuantileSketch;
+  TEST_NOT_EQUAL(qs_ptr, qs_null)
+  TEST_EQUAL(qs_ptr->count(), 0)
+END_SECTION
+
+START_SECTION(([EXTRA] ~QuantileSketch()))
+  delete qs_ptr;
+  NOT_TESTABLE
+END_SECTION
+
+START_SECTION((void add(double value)))
+  QuantileSketch qs;
+  qs.add(3.0);
+  qs.add(1.0);
+  qs.add(2.0);
+  TEST_EQUAL(qs.count(), 3)
+  TEST_REAL_SIMILAR(qs.minValue(), 1.0)
+  TEST_REAL_SIMILAR(qs.maxValue(), 3.0)
+END_SECTION
+
+START_SECTION((double quantile(double phi) const))
+  // small stream: no compaction happens, results are exact
+  QuantileSketch qs;
+  for (Size i = 1; i <= 100; ++i)
+  {
+    qs.add((double)i);
+  }
+  TEST_REAL_SIMILAR(qs.quantile(0.0), 1.0)
+  TEST_REAL_SIMILAR(qs.quantile(1.0), 100.0)
+  TEST_REAL_SIMILAR(qs.quantile(0.5), 50.0)
+  TEST_REAL_SIMILAR(qs.quantile(0.25), 25.0)
+
+  // large stream: compaction kicks in, ranks stay approximately correct
+  QuantileSketch qs_large(200);
+  for (Size i = 1; i <= 100000; ++i)
+  {
+    qs_large.add((double)i);
+  }
+  TEST_REAL_SIMILAR(qs_large.quantile(0.0), 1.0)
+  TEST_REAL_SIMILAR(qs_large.quantile(1.0), 100000.0)
+  // rank error of the sketch is ~ 1/k, allow a few percent here
+  TEST_EQUAL(std::fabs(qs_large.quantile(0.5) - 50000.0) < 5000.0, true)
+  TEST_EQUAL(std::fabs(qs_large.quantile(0.9) - 90000.0) < 5000.0, true)
+END_SECTION
+
+START_SECTION((double cdf(double value) const))
+  QuantileSketch qs;
+  for (Size i = 1; i <= 100; ++i)
+  {
+    qs.add((double)i);
+  }
+  TEST_REAL_SIMILAR(qs.cdf(0.5), 0.0)
+  TEST_REAL_SIMILAR(qs.cdf(100.0), 1.0)
+  TEST_REAL_SIMILAR(qs.cdf(50.0), 0.5)
+
+  QuantileSketch qs_large(200);
+  for (Size i = 1; i <= 100000; ++i)
+  {
+    qs_large.add((double)i);
+  }
+  TEST_EQUAL(std::fabs(qs_large.cdf(50000.0) - 0.5) < 0.05, true)
+END_SECTION
+
+START_SECTION((void getCumulative(std::vector<double>& values, std::vector<double>& cumulative_fractions) const))
+  QuantileSketch qs;
+  qs.add(10.0);
+  qs.add(30.0);
+  qs.add(20.0);
+  vector<double> values, fractions;
+  qs.getCumulative(values, fractions);
+  TEST_EQUAL(values.size(), 3)
+  ABORT_IF(values.size() != 3)
+  TEST_REAL_SIMILAR(values[0], 10.0)
+  TEST_REAL_SIMILAR(values[1], 20.0)
+  TEST_REAL_SIMILAR(values[2], 30.0)
+  TEST_REAL_SIMILAR(fractions[0], 1.0 / 3.0)
+  TEST_REAL_SIMILAR(fractions[1], 2.0 / 3.0)
+  TEST_REAL_SIMILAR(fractions[2], 1.0)
+
+  // deterministic: the same stream always yields the same summary
+  QuantileSketch qs_a(64), qs_b(64);
+  for (Size i = 0; i < 10000; ++i)
+  {
+    const double value = std::fmod((double)(i * 7919), 1000.0);
+    qs_a.add(value);
+    qs_b.add(value);
+  }
+  vector<double> values_a, fractions_a, values_b, fractions_b;
+  qs_a.getCumulative(values_a, fractions_a);
+  qs_b.getCumulative(values_b, fractions_b);
+  TEST_EQUAL(values_a == values_b, true)
+  TEST_EQUAL(fractions_a == fractions_b, true)
+END_SECTION
+
+START_SECTION((UInt64 count() const))
+  QuantileSketch qs;
+  TEST_EQUAL(qs.count(), 0)
+  qs.add(1.0);
+  TEST_EQUAL(qs.count(), 1)
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
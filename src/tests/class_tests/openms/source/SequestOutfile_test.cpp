@@ -89,7 +89,7 @@ START_SECTION(void load(const String& result_filename, std::vector< PeptideIdent
 		{
 			TEST_REAL_SIMILAR(peptide_identifications[0].getHits()[0].getScore(), 0.05)
 			TEST_STRING_EQUAL(peptide_identifications[0].getHits()[0].getSequence().toString(), "ETQAWSIATILETLYDL")
-            vector<PeptideEvidence> pes = peptide_identifications[0].getHits()[0].getPeptideEvidences();
+            PeptideHit::PeptideEvidences pes = peptide_identifications[0].getHits()[0].getPeptideEvidences();
             TEST_EQUAL(pes[0].getAABefore(), 'C')
             TEST_EQUAL(pes[0].getAAAfter(), '-')
 			TEST_EQUAL(peptide_identifications[0].getHits()[0].getRank(), 1)
@@ -200,7 +200,7 @@ START_SECTION(void load(const String& result_filename, std::vector< PeptideIdent
 		{
 			TEST_REAL_SIMILAR(peptide_identifications[0].getHits()[0].getScore(), 0.05)
 			TEST_STRING_EQUAL(peptide_identifications[0].getHits()[0].getSequence().toString(), "ETQAWSIATILETLYDL")
-            vector<PeptideEvidence> pes = peptide_identifications[0].getHits()[0].getPeptideEvidences();
+            PeptideHit::PeptideEvidences pes = peptide_identifications[0].getHits()[0].getPeptideEvidences();
             TEST_EQUAL(pes[0].getAABefore(), 'C')
             TEST_EQUAL(pes[0].getAAAfter(), '-')
 			TEST_EQUAL(peptide_identifications[0].getHits()[0].getRank(), 1)
@@ -0,0 +1,121 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg$
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/KERNEL/SoASpectrum.h>
+#include <OpenMS/KERNEL/MSSpectrum.h>
+
+///////////////////////////
+
+START_TEST(SoASpectrum, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+using namespace OpenMS;
+
+SoASpectrum* ptr = nullptr;
+SoASpectrum* null_ptr = nullptr;
+
+// a small sorted test spectrum
+MSSpectrum tmp;
+tmp.emplace_back(Peak1D::PositionType(100.0), 1.0f);
+tmp.emplace_back(Peak1D::PositionType(110.0), 2.0f);
+tmp.emplace_back(Peak1D::PositionType(120.0), 3.0f);
+tmp.emplace_back(Peak1D::PositionType(130.0), 4.0f);
+
+START_SECTION((SoASpectrum()))
+  ptr = new SoASpectrum;
+  TEST_NOT_EQUAL(ptr, null_ptr)
+  TEST_EQUAL(ptr->empty(), true)
+END_SECTION
+
+START_SECTION((~SoASpectrum()))
+  delete ptr;
+END_SECTION
+
+START_SECTION((explicit SoASpectrum(const MSSpectrum& spec)))
+  SoASpectrum s(tmp);
+  TEST_EQUAL(s.size(), 4)
+  TEST_REAL_SIMILAR(s.getMZArray()[0], 100.0)
+  TEST_REAL_SIMILAR(s.getMZArray()[3], 130.0)
+  TEST_REAL_SIMILAR(s.getIntensityArray()[2], 3.0)
+END_SECTION
+
+START_SECTION((SoASpectrum(MZArrayType&& mz, IntensityArrayType&& intensity)))
+  SoASpectrum s({100.0, 200.0}, {1.0f, 2.0f});
+  TEST_EQUAL(s.size(), 2)
+  TEST_EXCEPTION(Exception::Precondition, SoASpectrum({100.0}, {1.0f, 2.0f}))
+END_SECTION
+
+START_SECTION((MSSpectrum toSpectrum() const))
+  SoASpectrum s(tmp);
+  MSSpectrum back = s.toSpectrum();
+  TEST_EQUAL(back.size(), tmp.size())
+  for (Size i = 0; i < back.size(); ++i)
+  {
+    TEST_REAL_SIMILAR(back[i].getMZ(), tmp[i].getMZ())
+    TEST_REAL_SIMILAR(back[i].getIntensity(), tmp[i].getIntensity())
+  }
+END_SECTION
+
+START_SECTION((ConstIterator begin() const))
+  SoASpectrum s(tmp);
+  Size i = 0;
+  for (SoASpectrum::ConstIterator it = s.begin(); it != s.end(); ++it, ++i)
+  {
+    TEST_REAL_SIMILAR((*it).getMZ(), tmp[i].getMZ())
+  }
+  TEST_EQUAL(i, tmp.size())
+  TEST_EQUAL(Size(s.end() - s.begin()), s.size())
+END_SECTION
+
+START_SECTION((Size findNearest(CoordinateType mz) const))
+  SoASpectrum s(tmp);
+  TEST_EQUAL(s.findNearest(100.2), 0)
+  TEST_EQUAL(s.findNearest(109.0), 1)
+  TEST_EQUAL(s.findNearest(1000.0), 3)
+  TEST_EQUAL(s.findNearest(10.0), 0)
+  SoASpectrum empty_spec;
+  TEST_EXCEPTION(Exception::Precondition, empty_spec.findNearest(100.0))
+END_SECTION
+
+START_SECTION((Size MZBegin(CoordinateType mz) const))
+  SoASpectrum s(tmp);
+  TEST_EQUAL(s.MZBegin(105.0), 1)
+  TEST_EQUAL(s.MZBegin(110.0), 1)
+  TEST_EQUAL(s.MZBegin(1000.0), 4)
+END_SECTION
+
+START_SECTION((Size MZEnd(CoordinateType mz) const))
+  SoASpectrum s(tmp);
+  TEST_EQUAL(s.MZEnd(110.0), 2)
+  TEST_EQUAL(s.MZEnd(105.0), 1)
+END_SECTION
+
+START_SECTION((bool isSorted() const))
+  SoASpectrum s(tmp);
+  TEST_EQUAL(s.isSorted(), true)
+  s.push_back(50.0, 1.0f);
+  TEST_EQUAL(s.isSorted(), false)
+END_SECTION
+
+START_SECTION((bool operator==(const SoASpectrum& rhs) const))
+  SoASpectrum s1(tmp), s2(tmp);
+  TEST_EQUAL(s1 == s2, true)
+  s2.push_back(140.0, 5.0f);
+  TEST_EQUAL(s1 != s2, true)
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
@@ -160,6 +160,44 @@ START_SECTION((double operator()(const BinnedSpectrum &bin1, const BinnedSpectru
   TEST_REAL_SIMILAR(score, 0)
 END_SECTION
 
+START_SECTION((std::vector<std::pair<Size, double>> score(const BinnedSpectrum& query, const std::vector<BinnedSpectrum>& library, Size top_k) const))
+  PeakSpectrum s1, s2, s3;
+  PeakMap exp;
+  MSPFile msp;
+  std::vector< PeptideIdentification > ids;
+  const String filename(OPENMS_GET_TEST_DATA_PATH("SpectraSTSimilarityScore_1.msp"));
+  msp.load(filename, ids, exp);
+  for (Size k = 0; k < exp[0].size(); ++k)
+  {
+    s1.push_back(exp[0][k]);
+  }
+  for (Size k = 0; k < exp[1].size(); ++k)
+  {
+    s2.push_back(exp[1][k]);
+  }
+  for (Size k = 0; k < exp[2].size(); ++k)
+  {
+    s3.push_back(exp[2][k]);
+  }
+  std::vector<BinnedSpectrum> library;
+  library.push_back(ptr->transform(s3));
+  library.push_back(ptr->transform(s2));
+  library.push_back(ptr->transform(s1));
+
+  const BinnedSpectrum query = ptr->transform(s1);
+  std::vector<std::pair<Size, double>> hits = ptr->score(query, library, 2);
+  TEST_EQUAL(hits.size(), 2)
+  // best hit is the query itself, sorted by descending score
+  TEST_EQUAL(hits[0].first, 2)
+  TEST_EQUAL(hits[0].second >= hits[1].second, true)
+  TOLERANCE_ABSOLUTE(0.01)
+  TEST_REAL_SIMILAR(hits[0].second, 1)
+
+  // top_k larger than the library returns all entries
+  hits = ptr->score(query, library, 10);
+  TEST_EQUAL(hits.size(), 3)
+END_SECTION
+
 START_SECTION(bool preprocess(PeakSpectrum &spec, float remove_peak_intensity_threshold=2.01, UInt cut_peaks_below=1000, Size min_peak_number=5, Size max_peak_number=150))
   PeakSpectrum s1, s2, s3;
   PeakMap exp;
@@ -0,0 +1,141 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+#include <OpenMS/ANALYSIS/OPENSWATH/DATAACCESS/SimpleOpenMSSpectraAccessFactory.h>
+
+///////////////////////////
+#include <OpenMS/ANALYSIS/OPENSWATH/DATAACCESS/SpectrumAccessCaching.h>
+///////////////////////////
+
+using namespace OpenMS;
+using namespace std;
+
+// a map with several spectra at increasing RT, one peak each (m/z = 100 + index)
+boost::shared_ptr<PeakMap> getData(Size nr_spectra)
+{
+  boost::shared_ptr<PeakMap> exp(new PeakMap);
+  for (Size i = 0; i < nr_spectra; ++i)
+  {
+    MSSpectrum spec;
+    spec.setRT(10.0 * i);
+    Peak1D p;
+    p.setMZ(100.0 + i);
+    p.setIntensity(50);
+    spec.push_back(p);
+    exp->addSpectrum(spec);
+  }
+  return exp;
+}
+
+START_TEST(SpectrumAccessCaching, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+SpectrumAccessCaching* ptr = nullptr;
+SpectrumAccessCaching* nullPointer = nullptr;
+
+boost::shared_ptr<PeakMap> exp(new PeakMap);
+OpenSwath::SpectrumAccessPtr expptr = SimpleOpenMSSpectraFactory::getSpectrumAccessOpenMSPtr(exp);
+
+START_SECTION((SpectrumAccessCaching(OpenSwath::SpectrumAccessPtr sptr, Size cache_size = 512)))
+{
+  ptr = new SpectrumAccessCaching(expptr);
+  TEST_NOT_EQUAL(ptr, nullPointer)
+}
+END_SECTION
+
+START_SECTION((~SpectrumAccessCaching()))
+{
+  delete ptr;
+}
+END_SECTION
+
+START_SECTION((OpenSwath::SpectrumPtr getSpectrumById(int id)))
+{
+  OpenSwath::SpectrumAccessPtr origin = SimpleOpenMSSpectraFactory::getSpectrumAccessOpenMSPtr(getData(5));
+  SpectrumAccessCaching cached(origin, 3);
+  TEST_EQUAL(cached.getNrSpectra(), 5)
+
+  // data served from the cache is identical to the underlying data
+  OpenSwath::SpectrumPtr spec = cached.getSpectrumById(2);
+  TEST_EQUAL(spec->getMZArray()->data.size(), 1)
+  TEST_REAL_SIMILAR(spec->getMZArray()->data[0], 102.0)
+  spec = cached.getSpectrumById(2);
+  TEST_REAL_SIMILAR(spec->getMZArray()->data[0], 102.0)
+  TEST_EQUAL(cached.getCacheHits(), 1)
+  TEST_EQUAL(cached.getCacheMisses(), 1)
+
+  // a forward walk with local re-reads: the trailing spectra get evicted, the
+  // neighborhood of the current position stays cached
+  cached.clearCache();
+  for (int id = 0; id < 5; ++id)
+  {
+    cached.getSpectrumById(id); // 5 misses (cache holds 2, 3, 4 afterwards)
+  }
+  TEST_EQUAL(cached.getCacheMisses(), 6)
+  cached.getSpectrumById(4); // hit
+  cached.getSpectrumById(3); // hit
+  cached.getSpectrumById(2); // hit
+  TEST_EQUAL(cached.getCacheHits(), 4)
+  cached.getSpectrumById(0); // evicted earlier -> miss
+  TEST_EQUAL(cached.getCacheMisses(), 7)
+}
+END_SECTION
+
+START_SECTION((boost::shared_ptr<OpenSwath::ISpectrumAccess> lightClone() const))
+{
+  OpenSwath::SpectrumAccessPtr origin = SimpleOpenMSSpectraFactory::getSpectrumAccessOpenMSPtr(getData(2));
+  SpectrumAccessCaching cached(origin, 3);
+  boost::shared_ptr<OpenSwath::ISpectrumAccess> clone = cached.lightClone();
+  TEST_EQUAL(clone->getNrSpectra(), 2)
+  OpenSwath::SpectrumPtr spec = clone->getSpectrumById(1);
+  TEST_REAL_SIMILAR(spec->getMZArray()->data[0], 101.0)
+}
+END_SECTION
+
+START_SECTION((Size getCacheHits() const))
+{
+  OpenSwath::SpectrumAccessPtr origin = SimpleOpenMSSpectraFactory::getSpectrumAccessOpenMSPtr(getData(2));
+  SpectrumAccessCaching cached(origin, 3);
+  TEST_EQUAL(cached.getCacheHits(), 0)
+  cached.getSpectrumById(0);
+  cached.getSpectrumById(0);
+  TEST_EQUAL(cached.getCacheHits(), 1)
+}
+END_SECTION
+
+START_SECTION((Size getCacheMisses() const))
+{
+  OpenSwath::SpectrumAccessPtr origin = SimpleOpenMSSpectraFactory::getSpectrumAccessOpenMSPtr(getData(2));
+  SpectrumAccessCaching cached(origin, 3);
+  TEST_EQUAL(cached.getCacheMisses(), 0)
+  cached.getSpectrumById(0);
+  cached.getSpectrumById(1);
+  TEST_EQUAL(cached.getCacheMisses(), 2)
+}
+END_SECTION
+
+START_SECTION((void clearCache()))
+{
+  OpenSwath::SpectrumAccessPtr origin = SimpleOpenMSSpectraFactory::getSpectrumAccessOpenMSPtr(getData(2));
+  SpectrumAccessCaching cached(origin, 3);
+  cached.getSpectrumById(0);
+  cached.clearCache();
+  cached.getSpectrumById(0); // miss again
+  TEST_EQUAL(cached.getCacheMisses(), 2)
+  TEST_EQUAL(cached.getCacheHits(), 0)
+}
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
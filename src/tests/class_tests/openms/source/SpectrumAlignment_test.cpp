@@ -165,6 +165,43 @@ START_SECTION(template <typename SpectrumType> void getSpectrumAlignment(std::ve
 
 END_SECTION
 
+START_SECTION(template <typename SpectrumType1, typename SpectrumType2> void getSpectrumAlignments(std::vector< std::vector< std::pair< Size, Size > > > &alignments, const std::vector<SpectrumType1> &library, const SpectrumType2 &query) const)
+  PeakSpectrum s1, s2, s3;
+  DTAFile().load(OPENMS_GET_TEST_DATA_PATH("SpectrumAlignment_in1.dta"), s1);
+  DTAFile().load(OPENMS_GET_TEST_DATA_PATH("SpectrumAlignment_in2.dta"), s2);
+  DTAFile().load(OPENMS_GET_TEST_DATA_PATH("PILISSequenceDB_DFPIANGER_1.dta"), s3);
+
+  SpectrumAlignment sas1;
+  Param p;
+  p.setValue("tolerance", 1.01);
+  sas1.setParameters(p);
+
+  vector<PeakSpectrum> library;
+  library.push_back(s1);
+  library.push_back(s3);
+  library.push_back(s2);
+
+  vector<vector<pair<Size, Size> > > alignments;
+  sas1.getSpectrumAlignments(alignments, library, s2);
+
+  TEST_EQUAL(alignments.size(), 3)
+  ABORT_IF(alignments.size() != 3)
+
+  // batch results must be identical to the single-pair overload
+  for (Size k = 0; k < library.size(); ++k)
+  {
+    vector<pair<Size, Size> > alignment;
+    sas1.getSpectrumAlignment(alignment, library[k], s2);
+    TEST_EQUAL(alignments[k].size(), alignment.size())
+    ABORT_IF(alignments[k].size() != alignment.size())
+    for (Size i = 0; i < alignment.size(); ++i)
+    {
+      TEST_EQUAL(alignments[k][i].first, alignment[i].first)
+      TEST_EQUAL(alignments[k][i].second, alignment[i].second)
+    }
+  }
+END_SECTION
+
 
 /////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////
@@ -0,0 +1,90 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+#include <OpenMS/COMPARISON/CLUSTERING/SpectrumClusteringEngine.h>
+using namespace OpenMS;
+using namespace std;
+
+///////////////////////////
+
+namespace
+{
+  PeakSpectrum makeSpectrum(double precursor_mz, const vector<double>& mzs, const vector<double>& ints)
+  {
+    PeakSpectrum s;
+    s.setMSLevel(2);
+    Precursor prec;
+    prec.setMZ(precursor_mz);
+    s.getPrecursors().push_back(prec);
+    for (Size i = 0; i < mzs.size(); ++i)
+    {
+      s.emplace_back(mzs[i], ints[i]);
+    }
+    return s;
+  }
+}
+
+START_TEST(SpectrumClusteringEngine, "$Id$")
+
+SpectrumClusteringEngine* ptr = nullptr;
+SpectrumClusteringEngine* nullPointer = nullptr;
+START_SECTION((SpectrumClusteringEngine()))
+  ptr = new SpectrumClusteringEngine();
+  TEST_NOT_EQUAL(ptr, nullPointer)
+END_SECTION
+
+START_SECTION((~SpectrumClusteringEngine()))
+  delete ptr;
+END_SECTION
+
+START_SECTION((std::vector<Size> cluster(const std::vector<PeakSpectrum>& spectra) const))
+  vector<double> mzs = {100.0, 200.0, 300.0, 400.0, 500.0};
+  vector<double> ints = {10.0, 20.0, 30.0, 20.0, 10.0};
+  vector<double> other_mzs = {150.0, 250.0, 350.0, 450.0, 550.0};
+
+  vector<PeakSpectrum> spectra;
+  spectra.push_back(makeSpectrum(500.0, mzs, ints));  // cluster with the next one
+  spectra.push_back(makeSpectrum(500.2, mzs, ints));  // identical peaks, precursor within tolerance
+  spectra.push_back(makeSpectrum(500.1, other_mzs, ints)); // different peaks -> singleton
+  spectra.push_back(makeSpectrum(800.0, mzs, ints));  // identical peaks, but precursor too far -> singleton
+  spectra.push_back(PeakSpectrum()); // no precursor, no peaks -> singleton
+
+  SpectrumClusteringEngine engine;
+  vector<Size> clusters = engine.cluster(spectra);
+
+  TEST_EQUAL(clusters.size(), 5)
+  TEST_EQUAL(clusters[0], clusters[1])
+  TEST_NOT_EQUAL(clusters[2], clusters[0])
+  TEST_NOT_EQUAL(clusters[3], clusters[0])
+  TEST_NOT_EQUAL(clusters[3], clusters[2])
+  TEST_NOT_EQUAL(clusters[4], clusters[0])
+
+  // cluster indices are consecutive and start at 0
+  TEST_EQUAL(clusters[0], 0)
+  TEST_EQUAL(clusters[2], 1)
+  TEST_EQUAL(clusters[3], 2)
+  TEST_EQUAL(clusters[4], 3)
+
+  // transitive merging: a chain of similar spectra forms one component
+  vector<PeakSpectrum> chain;
+  chain.push_back(makeSpectrum(600.0, mzs, ints));
+  chain.push_back(makeSpectrum(600.8, mzs, ints)); // similar to both neighbors
+  chain.push_back(makeSpectrum(601.6, mzs, ints)); // out of tolerance to the first, linked via the second
+  clusters = engine.cluster(chain);
+  TEST_EQUAL(clusters[0], clusters[1])
+  TEST_EQUAL(clusters[1], clusters[2])
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+END_TEST
@@ -0,0 +1,142 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/KERNEL/MSExperiment.h>
+#include <OpenMS/QC/SpectrumMetricStore.h>
+
+///////////////////////////
+
+START_TEST(SpectrumMetricStore, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+using namespace OpenMS;
+using namespace std;
+
+SpectrumMetricStore* ptr = nullptr;
+SpectrumMetricStore* nullPointer = nullptr;
+START_SECTION(SpectrumMetricStore())
+ptr = new SpectrumMetricStore();
+TEST_NOT_EQUAL(ptr, nullPointer)
+END_SECTION
+
+START_SECTION(~SpectrumMetricStore())
+delete ptr;
+END_SECTION
+
+// two small spectra used throughout the test
+MSSpectrum spec_ms1;
+spec_ms1.setNativeID("scan=1");
+spec_ms1.setMSLevel(1);
+spec_ms1.setRT(100.0);
+spec_ms1.push_back({500.0, 10.0f});
+spec_ms1.push_back({600.0, 30.0f});
+spec_ms1.push_back({700.0, 20.0f});
+
+MSSpectrum spec_ms2;
+spec_ms2.setNativeID("scan=2");
+spec_ms2.setMSLevel(2);
+spec_ms2.setRT(101.0);
+spec_ms2.push_back({300.0, 5.0f});
+
+MSExperiment exp;
+exp.addSpectrum(spec_ms1);
+exp.addSpectrum(spec_ms2);
+
+SpectrumMetricStore store;
+START_SECTION(const String& getName() const override)
+TEST_EQUAL(store.getName(), "SpectrumMetricStore")
+END_SECTION
+
+START_SECTION(QCBase::Status requirements() const override)
+TEST_EQUAL((store.requirements() == QCBase::Status(QCBase::Requires::RAWMZML)), true);
+END_SECTION
+
+START_SECTION(void addSpectrum(const MSSpectrum& spec))
+store.addSpectrum(spec_ms1);
+ABORT_IF(store.getResults().size() != 1)
+const auto& m = store.getResults()[0];
+TEST_EQUAL(m.native_id, "scan=1")
+TEST_EQUAL(m.ms_level, 1)
+TEST_REAL_SIMILAR(m.rt, 100.0)
+TEST_REAL_SIMILAR(m.tic, 60.0)
+TEST_REAL_SIMILAR(m.base_peak_mz, 600.0)
+TEST_REAL_SIMILAR(m.base_peak_intensity, 30.0)
+TEST_EQUAL(m.peak_count, 3)
+END_SECTION
+
+START_SECTION(void clear())
+store.clear();
+TEST_EQUAL(store.getResults().size(), 0)
+END_SECTION
+
+START_SECTION(void compute(const MSExperiment& exp))
+store.compute(exp);
+ABORT_IF(store.getResults().size() != 2)
+TEST_EQUAL(store.getResults()[1].native_id, "scan=2")
+TEST_EQUAL(store.getResults()[1].ms_level, 2)
+TEST_REAL_SIMILAR(store.getResults()[1].tic, 5.0)
+END_SECTION
+
+START_SECTION(std::function<void(MSSpectrum&)> getSpectrumFunc())
+SpectrumMetricStore streamed;
+auto func = streamed.getSpectrumFunc();
+// same observations as compute(), but spectrum by spectrum (as a consumer would call it)
+MSSpectrum tmp1 = spec_ms1;
+MSSpectrum tmp2 = spec_ms2;
+func(tmp1);
+func(tmp2);
+ABORT_IF(streamed.getResults().size() != 2)
+TEST_EQUAL(streamed.getResults() == store.getResults(), true)
+END_SECTION
+
+START_SECTION(void store(const String& db_filename, const String& raw_filename, const String& file_hash) const)
+String db_filename;
+NEW_TMP_FILE(db_filename);
+store.store(db_filename, "raw_file.mzML", "hash_1");
+
+SpectrumMetricStore loaded;
+TEST_EQUAL(loaded.load(db_filename, "hash_1"), true)
+TEST_EQUAL(loaded.getResults() == store.getResults(), true)
+
+// storing again with the same hash replaces the run instead of duplicating it
+store.store(db_filename, "raw_file.mzML", "hash_1");
+TEST_EQUAL(loaded.load(db_filename, "hash_1"), true)
+TEST_EQUAL(loaded.getResults().size(), 2)
+END_SECTION
+
+START_SECTION(bool load(const String& db_filename, const String& file_hash))
+String db_filename;
+NEW_TMP_FILE(db_filename);
+store.store(db_filename, "raw_file.mzML", "hash_1");
+
+SpectrumMetricStore loaded;
+TEST_EQUAL(loaded.load(db_filename, "unknown_hash"), false)
+TEST_EQUAL(loaded.getResults().size(), 0)
+TEST_EQUAL(loaded.load("this_file_does_not_exist.sqlite", "hash_1"), false)
+TEST_EQUAL(loaded.load(db_filename, "hash_1"), true)
+TEST_EQUAL(loaded.getResults().size(), 2)
+END_SECTION
+
+START_SECTION(static bool contains(const String& db_filename, const String& file_hash))
+String db_filename;
+NEW_TMP_FILE(db_filename);
+TEST_EQUAL(SpectrumMetricStore::contains(db_filename, "hash_1"), false) // file does not exist yet
+store.store(db_filename, "raw_file.mzML", "hash_1");
+TEST_EQUAL(SpectrumMetricStore::contains(db_filename, "hash_1"), true)
+TEST_EQUAL(SpectrumMetricStore::contains(db_filename, "hash_2"), false)
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
@@ -127,6 +127,39 @@ START_SECTION(double SplineInterpolatedPeaks::Navigator::eval(double pos))
   TEST_REAL_SIMILAR(nav2.eval(416.81), 0.997572728799559);
 END_SECTION
 
+START_SECTION(void SplineInterpolatedPeaks::Navigator::eval(const std::vector<double>& pos, std::vector<double>& intensity))
+  // batch evaluation over the full scan pattern matches the scalar version
+  SplineInterpolatedPeaks::Navigator nav_scalar = spectrum2.getNavigator();
+  SplineInterpolatedPeaks::Navigator nav_batch = spectrum2.getNavigator();
+  std::vector<double> scan_pos;
+  double p = spectrum2.getPosMin();
+  while (p < spectrum2.getPosMax())
+  {
+    scan_pos.push_back(p);
+    p = nav_scalar.getNextPos(p);
+  }
+  scan_pos.push_back(spectrum2.getPosMax());
+  std::vector<double> batch_intensity;
+  nav_batch.eval(scan_pos, batch_intensity);
+  TEST_EQUAL(batch_intensity.size(), scan_pos.size());
+  for (size_t i = 0; i < scan_pos.size(); ++i)
+  {
+    TEST_REAL_SIMILAR(batch_intensity[i], nav_scalar.eval(scan_pos[i]));
+  }
+  // positions in gaps and outside the spectrum evaluate to zero
+  std::vector<double> sparse_pos = {400.0, 416.81, 417.8, 418.75, 500.0};
+  std::vector<double> sparse_intensity;
+  nav_batch.eval(sparse_pos, sparse_intensity);
+  TEST_EQUAL(sparse_intensity[0], 0);
+  TEST_REAL_SIMILAR(sparse_intensity[1], 0.997572728799559);
+  TEST_EQUAL(sparse_intensity[2], 0);
+  TEST_REAL_SIMILAR(sparse_intensity[3], 0.944147611428987);
+  TEST_EQUAL(sparse_intensity[4], 0);
+  // unsorted input throws
+  std::vector<double> unsorted_pos = {418.75, 416.81};
+  TEST_EXCEPTION(Exception::IllegalArgument, nav_batch.eval(unsorted_pos, sparse_intensity));
+END_SECTION
+
 START_SECTION(double SplineInterpolatedPeaks::Navigator::getNextPos(double pos))
   // advancing within package
   TEST_EQUAL(spectrum2.getNavigator().getNextPos(417.0), 417.07);
@@ -449,6 +449,75 @@ START_SECTION((static String& removeWhitespaces(String &this_s)))
 }
 END_SECTION
 
+START_SECTION((inline std::string_view trimView(std::string_view data)))
+{
+  std::string s = " \t\r\n abc \t\r\n ";
+  TEST_EQUAL(trimView(s) == std::string_view("abc"), true)
+  TEST_EQUAL(trimView("abc") == std::string_view("abc"), true)
+  TEST_EQUAL(trimView("a b") == std::string_view("a b"), true)
+  TEST_EQUAL(trimView("").empty(), true)
+  TEST_EQUAL(trimView("  \t ").empty(), true)
+  // the view references the original buffer
+  TEST_EQUAL(trimView(s).data() == s.data() + 4, true)
+}
+END_SECTION
+
+START_SECTION((inline void splitView(std::string_view data, const char splitter, std::vector<std::string_view>& substrings)))
+{
+  std::vector<std::string_view> parts;
+  splitView("a,bc,,d", ',', parts);
+  TEST_EQUAL(parts.size(), 4)
+  TEST_EQUAL(parts[0] == std::string_view("a"), true)
+  TEST_EQUAL(parts[1] == std::string_view("bc"), true)
+  TEST_EQUAL(parts[2].empty(), true)
+  TEST_EQUAL(parts[3] == std::string_view("d"), true)
+
+  // empty fields at the borders are kept
+  splitView(",a,", ',', parts);
+  TEST_EQUAL(parts.size(), 3)
+  TEST_EQUAL(parts[0].empty(), true)
+  TEST_EQUAL(parts[1] == std::string_view("a"), true)
+  TEST_EQUAL(parts[2].empty(), true)
+
+  // no splitter / empty input: a single field
+  splitView("abc", ',', parts);
+  TEST_EQUAL(parts.size(), 1)
+  TEST_EQUAL(parts[0] == std::string_view("abc"), true)
+  splitView("", ',', parts);
+  TEST_EQUAL(parts.size(), 1)
+  TEST_EQUAL(parts[0].empty(), true)
+}
+END_SECTION
+
+START_SECTION((static bool toDouble(std::string_view s, double& target)))
+{
+  double d = 0.0;
+  TEST_EQUAL(StringUtils::toDouble(std::string_view("12.3"), d), true)
+  TEST_REAL_SIMILAR(d, 12.3)
+  TEST_EQUAL(StringUtils::toDouble(std::string_view("-1e5"), d), true)
+  TEST_REAL_SIMILAR(d, -1e5)
+  // no whitespace skipping, no partial parses
+  TEST_EQUAL(StringUtils::toDouble(std::string_view(" 12.3"), d), false)
+  TEST_EQUAL(StringUtils::toDouble(std::string_view("12.3four"), d), false)
+  TEST_EQUAL(StringUtils::toDouble(std::string_view("abc"), d), false)
+  TEST_EQUAL(StringUtils::toDouble(std::string_view(""), d), false)
+}
+END_SECTION
+
+START_SECTION((static bool toInt32(std::string_view s, Int32& target)))
+{
+  Int32 i = 0;
+  TEST_EQUAL(StringUtils::toInt32(std::string_view("123"), i), true)
+  TEST_EQUAL(i, 123)
+  TEST_EQUAL(StringUtils::toInt32(std::string_view("-45"), i), true)
+  TEST_EQUAL(i, -45)
+  // no whitespace skipping, no partial parses
+  TEST_EQUAL(StringUtils::toInt32(std::string_view(" 123"), i), false)
+  TEST_EQUAL(StringUtils::toInt32(std::string_view("123.4"), i), false)
+  TEST_EQUAL(StringUtils::toInt32(std::string_view(""), i), false)
+}
+END_SECTION
+
 
 /////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////
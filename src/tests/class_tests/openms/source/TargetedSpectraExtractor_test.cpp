@@ -865,6 +865,45 @@ START_SECTION(void matchSpectrum(
 }
 END_SECTION
 
+START_SECTION(([EXTRA] BinnedSpectrumComparator precursor m/z pruning))
+{
+  // three identical peak lists, only the precursors differ
+  MSSpectrum base;
+  base.push_back(Peak1D(100.0, 10.0));
+  base.push_back(Peak1D(101.0, 20.0));
+  base.push_back(Peak1D(102.0, 30.0));
+
+  Precursor prec;
+  vector<MSSpectrum> library(3, base);
+  library[0].setName("prec_100");
+  prec.setMZ(100.0);
+  library[0].setPrecursors({prec});
+  library[1].setName("prec_200");
+  prec.setMZ(200.0);
+  library[1].setPrecursors({prec});
+  library[2].setName("no_prec"); // no precursor info: always compared
+
+  MSSpectrum query(base);
+  prec.setMZ(100.01);
+  query.setPrecursors({prec});
+
+  TargetedSpectraExtractor::BinnedSpectrumComparator cmp;
+  vector<pair<Size,double>> scores;
+
+  // without pruning all library entries are compared
+  cmp.init(library, {{"bin_size", 1.0}, {"peak_spread", 0}, {"bin_offset", 0.4}});
+  cmp.generateScores(query, scores, 0.5);
+  TEST_EQUAL(scores.size(), 3)
+
+  // with pruning only the matching precursor and the entry without precursor remain
+  cmp.init(library, {{"bin_size", 1.0}, {"peak_spread", 0}, {"bin_offset", 0.4}, {"precursor_mz_tolerance", 0.5}});
+  cmp.generateScores(query, scores, 0.5);
+  TEST_EQUAL(scores.size(), 2)
+  TEST_EQUAL(scores[0].first, 0)
+  TEST_EQUAL(scores[1].first, 2)
+}
+END_SECTION
+
 START_SECTION(void targetedMatching(
   const std::vector<MSSpectrum>& spectra,
   Comparator& cmp,
@@ -0,0 +1,119 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/CONCEPT/TaskPool.h>
+
+#include <OpenMS/CONCEPT/Exception.h>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+///////////////////////////
+
+START_TEST(TaskPool, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+using namespace OpenMS;
+using namespace std;
+
+START_SECTION(static int numberOfThreads())
+  TEST_EQUAL(TaskPool::numberOfThreads() >= 1, true)
+END_SECTION
+
+START_SECTION(static bool inParallelRegion())
+  TEST_EQUAL(TaskPool::inParallelRegion(), false)
+END_SECTION
+
+START_SECTION((template <typename Function> static void parallelFor(SignedSize begin, SignedSize end, SignedSize grain, Function&& fn)))
+  // every index is visited exactly once
+  std::vector<int> visited(1000, 0);
+  TaskPool::parallelFor(0, (SignedSize)visited.size(), 7, [&](SignedSize i)
+  {
+    ++visited[i];
+  });
+  TEST_EQUAL(std::accumulate(visited.begin(), visited.end(), 0), 1000)
+  TEST_EQUAL(*std::min_element(visited.begin(), visited.end()), 1)
+  TEST_EQUAL(*std::max_element(visited.begin(), visited.end()), 1)
+
+  // default grain (0) and empty range
+  std::atomic<int> count(0);
+  TaskPool::parallelFor(0, 100, 0, [&](SignedSize)
+  {
+    ++count;
+  });
+  TEST_EQUAL(count.load(), 100)
+  TaskPool::parallelFor(5, 5, 0, [&](SignedSize)
+  {
+    ++count;
+  });
+  TEST_EQUAL(count.load(), 100)
+
+  // the first exception of an iteration is rethrown after the loop has joined
+  TEST_EXCEPTION(Exception::IllegalArgument, TaskPool::parallelFor(0, 100, 1, [&](SignedSize i)
+  {
+    if (i == 42)
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "boom");
+    }
+  }))
+
+  // nested call runs serially instead of oversubscribing
+  std::atomic<int> inner_count(0);
+  TaskPool::parallelFor(0, 4, 1, [&](SignedSize)
+  {
+    TaskPool::parallelFor(0, 10, 1, [&](SignedSize)
+    {
+      ++inner_count;
+    });
+  });
+  TEST_EQUAL(inner_count.load(), 40)
+END_SECTION
+
+START_SECTION(static void parallelInvoke(const std::vector<std::function<void()>>& tasks))
+  std::atomic<int> a(0), b(0);
+  TaskPool::parallelInvoke({
+    [&]() { a = 1; },
+    [&]() { b = 2; }
+  });
+  TEST_EQUAL(a.load(), 1)
+  TEST_EQUAL(b.load(), 2)
+
+  TEST_EXCEPTION(Exception::Precondition, TaskPool::parallelInvoke({
+    [&]() { throw Exception::Precondition(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION, "boom"); }
+  }))
+END_SECTION
+
+START_SECTION(static int enableNestedParallelism(int outer_threads))
+  int budget = TaskPool::numberOfThreads();
+  int inner = TaskPool::enableNestedParallelism(budget);
+  TEST_EQUAL(inner >= 1, true)
+  TaskPool::disableNestedParallelism();
+  TEST_EQUAL(TaskPool::numberOfThreads(), budget)
+END_SECTION
+
+START_SECTION(static void disableNestedParallelism())
+  NOT_TESTABLE // tested above
+END_SECTION
+
+START_SECTION(static void setNumberOfThreads(int threads))
+  int budget = TaskPool::numberOfThreads();
+  TaskPool::setNumberOfThreads(budget);
+  TEST_EQUAL(TaskPool::numberOfThreads(), budget)
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
@@ -0,0 +1,114 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+
+///////////////////////////
+#include <OpenMS/CHEMISTRY/TheoreticalSpectrumCache.h>
+///////////////////////////
+
+#include <OpenMS/CHEMISTRY/AASequence.h>
+
+using namespace OpenMS;
+using namespace std;
+
+START_TEST(TheoreticalSpectrumCache, "$Id$")
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+
+TheoreticalSpectrumCache* ptr = nullptr;
+TheoreticalSpectrumCache* null_ptr = nullptr;
+
+TheoreticalSpectrumGenerator tsg;
+
+START_SECTION((TheoreticalSpectrumCache(Size capacity = 100000, Size shards = 16)))
+{
+  ptr = new TheoreticalSpectrumCache();
+  TEST_NOT_EQUAL(ptr, null_ptr)
+  TEST_EQUAL(ptr->size(), 0)
+  TEST_EQUAL(ptr->getHits(), 0)
+  TEST_EQUAL(ptr->getMisses(), 0)
+}
+END_SECTION
+
+START_SECTION((std::shared_ptr<const PeakSpectrum> getSpectrum(const TheoreticalSpectrumGenerator& generator, const AASequence& peptide, Int min_charge, Int max_charge)))
+{
+  TheoreticalSpectrumCache cache;
+  AASequence peptide = AASequence::fromString("PEPTIDE");
+
+  // first lookup generates
+  auto spec1 = cache.getSpectrum(tsg, peptide, 1, 1);
+  TEST_EQUAL(cache.getMisses(), 1)
+  TEST_EQUAL(cache.getHits(), 0)
+  TEST_EQUAL(cache.size(), 1)
+  TEST_EQUAL(spec1->empty(), false)
+
+  // identical to a directly generated spectrum
+  PeakSpectrum reference;
+  tsg.getSpectrum(reference, peptide, 1, 1);
+  reference.sortByPosition();
+  TEST_EQUAL(spec1->size(), reference.size())
+  TEST_REAL_SIMILAR((*spec1)[0].getMZ(), reference[0].getMZ())
+
+  // second lookup hits and returns the same object
+  auto spec2 = cache.getSpectrum(tsg, peptide, 1, 1);
+  TEST_EQUAL(cache.getHits(), 1)
+  TEST_EQUAL(spec1.get() == spec2.get(), true)
+
+  // different charge range and modified peptide are distinct entries
+  cache.getSpectrum(tsg, peptide, 1, 2);
+  cache.getSpectrum(tsg, AASequence::fromString("PEPTIDEM(Oxidation)"), 1, 1);
+  TEST_EQUAL(cache.getMisses(), 3)
+  TEST_EQUAL(cache.size(), 3)
+}
+END_SECTION
+
+START_SECTION((double getHitRate() const))
+{
+  TheoreticalSpectrumCache cache;
+  TEST_REAL_SIMILAR(cache.getHitRate(), 0.0)
+  AASequence peptide = AASequence::fromString("LDER");
+  cache.getSpectrum(tsg, peptide, 1, 1);
+  cache.getSpectrum(tsg, peptide, 1, 1);
+  cache.getSpectrum(tsg, peptide, 1, 1);
+  cache.getSpectrum(tsg, peptide, 1, 1);
+  TEST_REAL_SIMILAR(cache.getHitRate(), 0.75)
+}
+END_SECTION
+
+START_SECTION((void clear()))
+{
+  TheoreticalSpectrumCache cache;
+  cache.getSpectrum(tsg, AASequence::fromString("LDER"), 1, 1);
+  cache.clear();
+  TEST_EQUAL(cache.size(), 0)
+  TEST_EQUAL(cache.getHits(), 0)
+  TEST_EQUAL(cache.getMisses(), 0)
+}
+END_SECTION
+
+START_SECTION([EXTRA] LRU eviction respects the capacity)
+{
+  TheoreticalSpectrumCache cache(4, 1); // one shard, four entries
+  const char* peptides[] = {"LDER", "PEPTIDEK", "AAAR", "TESTPEPTIDER", "EDITPEPK"};
+  for (const char* p : peptides)
+  {
+    cache.getSpectrum(tsg, AASequence::fromString(p), 1, 1);
+  }
+  TEST_EQUAL(cache.size(), 4)
+  // oldest entry was evicted: looking it up again is a miss
+  const UInt64 misses = cache.getMisses();
+  cache.getSpectrum(tsg, AASequence::fromString("LDER"), 1, 1);
+  TEST_EQUAL(cache.getMisses(), misses + 1)
+}
+END_SECTION
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
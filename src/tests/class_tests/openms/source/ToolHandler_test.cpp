@@ -36,7 +36,7 @@ START_SECTION(~ToolHandler())
 }
 END_SECTION
 
-START_SECTION((static ToolListType getTOPPToolList(const bool includeGenericWrapper=false)))
+START_SECTION((static const ToolListType& getTOPPToolList(const bool includeGenericWrapper=false)))
 {
   ToolListType list = ToolHandler::getTOPPToolList();
   TEST_TRUE(list.find("FeatureFinderMRM") != list.end())
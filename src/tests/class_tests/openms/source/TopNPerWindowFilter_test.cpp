@@ -0,0 +1,171 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+//
+
+#include <OpenMS/CONCEPT/ClassTest.h>
+#include <OpenMS/test_config.h>
+
+///////////////////////////
+
+#include <OpenMS/FILTERING/TRANSFORMERS/TopNPerWindowFilter.h>
+#include <OpenMS/KERNEL/StandardTypes.h>
+#include <OpenMS/FORMAT/DTAFile.h>
+
+using namespace OpenMS;
+using namespace std;
+
+///////////////////////////
+
+START_TEST(TopNPerWindowFilter, "$Id$")
+
+/////////////////////////////////////////////////////////////
+
+TopNPerWindowFilter* e_ptr = nullptr;
+TopNPerWindowFilter* e_nullPointer = nullptr;
+START_SECTION((TopNPerWindowFilter()))
+	e_ptr = new TopNPerWindowFilter;
+	TEST_NOT_EQUAL(e_ptr, e_nullPointer)
+END_SECTION
+
+START_SECTION((~TopNPerWindowFilter()))
+	delete e_ptr;
+END_SECTION
+
+e_ptr = new TopNPerWindowFilter();
+
+START_SECTION((TopNPerWindowFilter(const TopNPerWindowFilter& source)))
+	TopNPerWindowFilter copy(*e_ptr);
+	TEST_EQUAL(copy.getParameters(), e_ptr->getParameters())
+	TEST_EQUAL(copy.getName(), e_ptr->getName())
+END_SECTION
+
+START_SECTION((TopNPerWindowFilter& operator = (const TopNPerWindowFilter& source)))
+	TopNPerWindowFilter copy;
+	copy = *e_ptr;
+	TEST_EQUAL(copy.getParameters(), e_ptr->getParameters())
+	TEST_EQUAL(copy.getName(), e_ptr->getName())
+END_SECTION
+
+START_SECTION((template<typename SpectrumType> void filterSpectrum(SpectrumType& spectrum)))
+  // "triangle" shape with apex at i=50, same data as in WindowMower_test
+  auto makeTriangle = [](PeakSpectrum& s_da)
+  {
+    s_da.clear(true);
+    s_da.getIntegerDataArrays().resize(1);
+    s_da.getStringDataArrays().resize(1);
+    for (Size i = 0; i != 50; ++i)
+    {
+      s_da.push_back(Peak1D(i, i + 0.1));
+      s_da.getIntegerDataArrays()[0].push_back(i);
+      s_da.getStringDataArrays()[0].push_back("up");
+    }
+    for (int i = 50; i != 100; ++i)
+    {
+      s_da.push_back(Peak1D(i, (100 - i) + 0.2));
+      s_da.getIntegerDataArrays()[0].push_back(i);
+      s_da.getStringDataArrays()[0].push_back("down");
+    }
+  };
+  PeakSpectrum s_da;
+  makeTriangle(s_da);
+
+  Param p(e_ptr->getParameters());
+  p.setValue("windowsize", 50.0);
+  p.setValue("peakcount", 2);
+  p.setValue("nlargest", 400); // no overall restriction
+  e_ptr->setParameters(p);
+  e_ptr->filterSpectrum(s_da);
+
+  // same result as WindowMower (jumping window): first window from m/z 0 to 49, second window from m/z 50 to 99
+  TEST_EQUAL(s_da.size(), 4)
+  ABORT_IF(s_da.size() != 4)
+  TEST_EQUAL(s_da[0].getIntensity(), 48.1)
+  TEST_EQUAL(s_da[1].getIntensity(), 49.1)
+  TEST_EQUAL(s_da[2].getIntensity(), 50.2)
+  TEST_EQUAL(s_da[3].getIntensity(), 49.2)
+  TEST_EQUAL(s_da.getIntegerDataArrays()[0][0], 48)
+  TEST_EQUAL(s_da.getIntegerDataArrays()[0][1], 49)
+  TEST_EQUAL(s_da.getIntegerDataArrays()[0][2], 50)
+  TEST_EQUAL(s_da.getIntegerDataArrays()[0][3], 51)
+  TEST_EQUAL(s_da.getStringDataArrays()[0][0], "up")
+  TEST_EQUAL(s_da.getStringDataArrays()[0][1], "up")
+  TEST_EQUAL(s_da.getStringDataArrays()[0][2], "down")
+  TEST_EQUAL(s_da.getStringDataArrays()[0][3], "down")
+
+  // overall N largest (like NLargest after the window filter), result stays sorted by m/z
+  makeTriangle(s_da);
+  p.setValue("nlargest", 3);
+  e_ptr->setParameters(p);
+  e_ptr->filterSpectrum(s_da);
+  TEST_EQUAL(s_da.size(), 3)
+  ABORT_IF(s_da.size() != 3)
+  TEST_EQUAL(s_da[0].getIntensity(), 49.1)
+  TEST_EQUAL(s_da[1].getIntensity(), 50.2)
+  TEST_EQUAL(s_da[2].getIntensity(), 49.2)
+  TEST_EQUAL(s_da.isSorted(), true)
+
+  // intensity threshold (like ThresholdMower before the window filter);
+  // survivors are m/z 40..60, which form a single window of fractional size 0.4 -> one peak is kept
+  makeTriangle(s_da);
+  p.setValue("threshold", 40.0);
+  p.setValue("nlargest", 400);
+  e_ptr->setParameters(p);
+  e_ptr->filterSpectrum(s_da);
+  TEST_EQUAL(s_da.size(), 1)
+  ABORT_IF(s_da.size() != 1)
+  TEST_EQUAL(s_da[0].getIntensity(), 50.2)
+END_SECTION
+
+START_SECTION((void filterPeakSpectrum(PeakSpectrum& spectrum)))
+  DTAFile dta_file;
+  PeakSpectrum spec;
+  dta_file.load(OPENMS_GET_TEST_DATA_PATH("Transformers_tests.dta"), spec);
+  TEST_EQUAL(spec.size(), 121)
+
+  Param p(e_ptr->getParameters());
+  p.setValue("threshold", 0.0);
+  p.setValue("windowsize", 50.0);
+  p.setValue("peakcount", 2);
+  p.setValue("nlargest", 400);
+  e_ptr->setParameters(p);
+
+  e_ptr->filterPeakSpectrum(spec);
+
+  // same peaks as WindowMower with a jumping window of the same size
+  TEST_EQUAL(spec.size(), 30)
+  TEST_EQUAL(spec.isSorted(), true)
+END_SECTION
+
+START_SECTION((void filterPeakMap(PeakMap& exp)))
+  DTAFile dta_file;
+  PeakSpectrum spec;
+  dta_file.load(OPENMS_GET_TEST_DATA_PATH("Transformers_tests.dta"), spec);
+
+  PeakMap pm;
+  pm.addSpectrum(spec);
+  pm.addSpectrum(spec);
+
+  TEST_EQUAL(pm.begin()->size(), 121)
+
+  Param p(e_ptr->getParameters());
+  p.setValue("windowsize", 50.0);
+  p.setValue("peakcount", 2);
+  p.setValue("nlargest", 400);
+  e_ptr->setParameters(p);
+
+  e_ptr->filterPeakMap(pm);
+
+  TEST_EQUAL(pm[0].size(), 30)
+  TEST_EQUAL(pm[1].size(), 30)
+END_SECTION
+
+delete e_ptr;
+
+/////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+END_TEST
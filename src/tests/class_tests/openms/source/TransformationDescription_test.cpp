@@ -117,6 +117,19 @@ START_SECTION((double apply(double value) const))
 }
 END_SECTION
 
+START_SECTION((void apply(std::vector<double>& values) const))
+{
+	TransformationDescription td(data);
+	td.fitModel("b_spline", Param());
+	std::vector<double> values = {0.0, 0.5, 1.0};
+	td.apply(values);
+	// batch version must match the per-value version:
+	TEST_REAL_SIMILAR(values[0], td.apply(0.0));
+	TEST_REAL_SIMILAR(values[1], td.apply(0.5));
+	TEST_REAL_SIMILAR(values[2], td.apply(1.0));
+}
+END_SECTION
+
 START_SECTION((const String& getModelType() const))
 {
 	TransformationDescription td;
@@ -11,7 +11,9 @@
 #include <OpenMS/DATASTRUCTURES/StringListUtils.h>
 #include <OpenMS/FORMAT/CachedMzML.h>
 #include <OpenMS/FORMAT/ConsensusXMLFile.h>
+#include <OpenMS/FORMAT/DATAACCESS/MSDataAsyncConsumer.h>
 #include <OpenMS/FORMAT/DATAACCESS/MSDataCachedConsumer.h>
+#include <OpenMS/FORMAT/DATAACCESS/MSDataSqlConsumer.h>
 #include <OpenMS/FORMAT/DATAACCESS/MSDataWritingConsumer.h>
 // TODO add handler support for other accss
 #include <OpenMS/FORMAT/DTA2DFile.h>
@@ -174,7 +176,7 @@ protected:
     registerFlag_("lossy_compression", "Use numpress compression to achieve optimally small file size using linear compression for m/z domain and slof for intensity and float data arrays (attention: may cause small loss of precision; only for mzML data).", true);
     registerDoubleOption_("lossy_mass_accuracy", "<error>", -1.0, "Desired (absolute) m/z accuracy for lossy compression (e.g. use 0.0001 for a mass accuracy of 0.2 ppm at 500 m/z, default uses -1.0 for maximal accuracy).", false, true);
 
-    registerFlag_("process_lowmemory", "Whether to process the file on the fly without loading the whole file into memory first (only for conversions of mzXML/mzML to mzML).\nNote: this flag will prevent conversion from spectra to chromatograms.", true);
+    registerFlag_("process_lowmemory", "Whether to process the file on the fly without loading the whole file into memory first (only for conversions of mzXML/mzML to mzML or sqMass).\nNote: this flag will prevent conversion from spectra to chromatograms.", true);
     registerInputFile_("NET_executable", "<executable>", "", "The .NET framework executable. Only required on linux and mac.", false, true, {"is_executable"});
     registerInputFile_("ThermoRaw_executable", "<file>", "ThermoRawFileParser.exe", "The ThermoRawFileParser executable.", false, true, {"is_executable"});
     setValidFormats_("ThermoRaw_executable", {"exe"});
@@ -410,22 +412,43 @@ protected:
         }
         consumer.addDataProcessing(getProcessingInfo_(DataProcessing::CONVERSION_MZML));
 
+        // decouple parsing from re-encoding and writing: spectra flow through
+        // a bounded queue to the writing consumer on a background thread, so
+        // only a handful of spectra are in flight at any time
+        MSDataAsyncConsumer async_consumer(&consumer);
+
         // for different input file type
         if (in_type == FileTypes::MZML)
         {
           MzMLFile mzmlfile;
           mzmlfile.setLogType(log_type_);
-          mzmlfile.transform(in, &consumer, skip_full_count);
+          mzmlfile.transform(in, &async_consumer, skip_full_count);
+          async_consumer.waitForCompletion();
           return EXECUTION_OK;
         }
         else if (in_type == FileTypes::MZXML)
         {
           MzXMLFile mzxmlfile;
           mzxmlfile.setLogType(log_type_);
-          mzxmlfile.transform(in, &consumer, skip_full_count);
+          mzxmlfile.transform(in, &async_consumer, skip_full_count);
+          async_consumer.waitForCompletion();
           return EXECUTION_OK;
         }
       }
+      else if (in_type == FileTypes::MZML && out_type == FileTypes::SQMASS)
+      {
+        // Stream mzML directly into a sqMass file; the consumer buffers and
+        // flushes batches of spectra, so memory use is independent of the
+        // input file size
+        MSDataSqlConsumer consumer(out, 0, 500, true, lossy_compression, mass_acc);
+        MSDataAsyncConsumer async_consumer(&consumer);
+
+        MzMLFile mzmlfile;
+        mzmlfile.setLogType(log_type_);
+        mzmlfile.transform(in, &async_consumer, true);
+        async_consumer.waitForCompletion();
+        return EXECUTION_OK;
+      }
       else if (in_type == FileTypes::MZML && out_type == FileTypes::CACHEDMZML)
       {
         // Determine output path for meta information (empty mzML)
@@ -447,7 +470,7 @@ protected:
       else
       {
         throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
-          "Process_lowmemory option can only be used with mzML / mzXML input and mzML output data types.");
+          "Process_lowmemory option can only be used with mzML / mzXML input and mzML / sqMass output data types.");
       }
     }
     else
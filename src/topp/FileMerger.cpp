@@ -13,6 +13,7 @@
 #include <OpenMS/DATASTRUCTURES/StringListUtils.h>
 #include <OpenMS/FORMAT/FileHandler.h>
 #include <OpenMS/FORMAT/FileTypes.h>
+#include <OpenMS/FORMAT/MultiFileLoader.h>
 #include <OpenMS/FORMAT/TextFile.h>
 #include <OpenMS/FORMAT/FASTAFile.h>
 
@@ -368,19 +369,17 @@ protected:
       PeakMap out;
       UInt rt_auto = 0;
       UInt native_id = 0;
-      for (Size i = 0; i < file_list.size(); ++i)
+      // load the input files concurrently (bounded number in flight), but merge them in input order
+      MultiFileLoader loader;
+      loader.setLogType(log_type_);
+      loader.load(file_list, [&](Size i, PeakMap& in)
       {
-        String filename = file_list[i];
-
-        // load file
-        force_type = file_handler.getType(file_list[i]);
-        PeakMap in;
-        file_handler.loadExperiment(filename, in, {force_type}, log_type_, true, true);
+        const String& filename = file_list[i];
 
         if (in.empty() && in.getChromatograms().empty())
         {
           writeLogWarn_(String("Warning: Empty file '") + filename + "'!");
-          continue;
+          return;
         }
         out.reserve(out.size() + in.size());
 
@@ -466,7 +465,7 @@ protected:
         {
           out.getSourceFiles().insert(out.getSourceFiles().end(), in.getSourceFiles().begin(), in.getSourceFiles().end()); // could be emtpty if spectrum was annotated above, but that's ok then
         }
-      }
+      }, true, true); // rewrite source files and compute hashes, as before
 
       //-------------------------------------------------------------
       // writing output
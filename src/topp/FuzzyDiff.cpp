@@ -77,6 +77,7 @@ protected:
     setMinInt_("tab_width", 1);
     registerIntOption_("first_column", "<int>", 1, "number of first column, used for calculation of column numbers", false, false);
     setMinInt_("first_column", 0);
+    registerFlag_("digest_first", "Compare streaming numeric digests of both files first and only run the line-by-line comparison if the digests disagree (much faster on large files; ignored if a whitelist is set)", true);
   }
 
   ExitCodes main_(int, const char **) override
@@ -125,6 +126,7 @@ protected:
     fsc.setVerboseLevel(verbose_level);
     fsc.setTabWidth(tab_width);
     fsc.setFirstColumn(first_column);
+    fsc.setCompareDigestFirst(getFlag_("digest_first"));
 
     if (fsc.compareFiles(in1, in2))
     {
@@ -324,7 +324,7 @@ protected:
   {
     String type = getStringOption_("type"); // this will throw() if not set in param_
     // find params for 'type'
-    Internal::ToolDescription gw = ToolHandler::getTOPPToolList(true)[toolName_()];
+    Internal::ToolDescription gw = ToolHandler::getTOPPToolList(true).at(toolName_());
     for (Size i = 0; i < gw.types.size(); ++i)
     {
       if (type == gw.types[i])
@@ -383,7 +383,7 @@ protected:
       }
     }
 
-    Internal::ToolDescription gw = ToolHandler::getTOPPToolList(true)[toolName_()];
+    Internal::ToolDescription gw = ToolHandler::getTOPPToolList(true).at(toolName_());
     for (Size i = 0; i < gw.types.size(); ++i)
     {
       if (type == gw.types[i])
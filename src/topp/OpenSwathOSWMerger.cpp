@@ -0,0 +1,94 @@
+// Copyright (c) 2002-present, The OpenMS Team -- EKU Tuebingen, ETH Zurich, and FU Berlin
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Hannes Roest $
+// $Authors: Hannes Roest $
+// --------------------------------------------------------------------------
+
+#include <OpenMS/ANALYSIS/OPENSWATH/OpenSwathOSWWriter.h>
+#include <OpenMS/DATASTRUCTURES/ListUtils.h>
+
+#include <fstream>
+
+using namespace OpenMS;
+
+// OpenMS base classes
+#include <OpenMS/APPLICATIONS/TOPPBase.h>
+
+//-------------------------------------------------------------
+// Doxygen docu
+//-------------------------------------------------------------
+
+/**
+@page TOPP_OpenSwathOSWMerger OpenSwathOSWMerger
+
+@brief A tool for merging partitioned OpenSwathWorkflow OSW output (shards) into a single OSW file.
+
+When OpenSwathWorkflow is run with -out_osw_shards, each SWATH window commits
+its results into a separate OSW shard file. This tool concatenates a set of
+such shards into a single OSW file without rescoring, e.g. after the shards
+were computed by separate OpenSwathWorkflow invocations on different cluster
+nodes or when a partitioned run was interrupted before its final merge step.
+
+The assay library (PQP file) used for the analysis needs to be provided since
+the merged OSW file contains the library tables alongside the feature tables
+(as is the case for the output of OpenSwathWorkflow itself).
+
+<B>The command line parameters of this tool are:</B>
+@verbinclude TOPP_OpenSwathOSWMerger.cli
+<B>INI file documentation of this tool:</B>
+@htmlinclude TOPP_OpenSwathOSWMerger.html
+
+*/
+
+// We do not want this class to show up in the docu:
+/// @cond TOPPCLASSES
+
+class TOPPOpenSwathOSWMerger : public TOPPBase
+{
+public:
+  TOPPOpenSwathOSWMerger() : TOPPBase("OpenSwathOSWMerger", "Merges OSW shards of a partitioned OpenSwathWorkflow run into a single OSW file.")
+  {
+  }
+
+protected:
+  void registerOptionsAndFlags_() override
+  {
+    registerInputFileList_("in", "<files>", StringList(), "OSW shard files to merge (as written by OpenSwathWorkflow -out_osw_shards)");
+    setValidFormats_("in", ListUtils::create<String>("osw"));
+
+    registerInputFile_("tr", "<file>", "", "Assay library (PQP file) the shards were generated with");
+    setValidFormats_("tr", ListUtils::create<String>("pqp"));
+
+    registerOutputFile_("out", "<file>", "", "Merged OSW output file");
+    setValidFormats_("out", ListUtils::create<String>("osw"));
+  }
+
+  ExitCodes main_(int, const char**) override
+  {
+    StringList shard_files = getStringList_("in");
+    String tr_file = getStringOption_("tr");
+    String out = getStringOption_("out");
+
+    // copy the PQP file and name it OSW file (same as OpenSwathWorkflow does),
+    // the feature tables are added by the merge below
+    std::ifstream src(tr_file.c_str(), std::ios::binary);
+    std::ofstream dst(out.c_str(), std::ios::binary | std::ios::trunc);
+    dst << src.rdbuf();
+    dst.close();
+
+    // concatenate the feature tables of all shards (no rescoring)
+    OpenSwathOSWWriter::mergeShardFiles(shard_files, out);
+
+    return EXECUTION_OK;
+  }
+};
+
+int main(int argc, const char** argv)
+{
+  TOPPOpenSwathOSWMerger tool;
+  return tool.main(argc, argv);
+}
+
+/// @endcond
@@ -436,6 +436,8 @@ protected:
     registerOutputFile_("out_osw", "<file>", "", "OSW output file (PyProphet-compatible SQLite file)", false);
     setValidFormats_("out_osw", ListUtils::create<String>("osw"));
 
+    registerFlag_("out_osw_shards", "Partitioned OSW output: commit each SWATH window to its own shard file and record it in a manifest, allowing interrupted runs to be resumed without recomputing finished windows. The shards are merged into -out_osw (without rescoring) at the end of the run; shards left behind by an interrupted run can also be merged with the OpenSwathOSWMerger tool.", true);
+
     registerOutputFile_("out_chrom", "<file>", "", "Also output all computed chromatograms output in mzML (chrom.mzML) or sqMass (SQLite format)", false, true);
     setValidFormats_("out_chrom", ListUtils::create<String>("mzML,sqMass"));
 
@@ -713,6 +715,17 @@ protected:
       throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
           "OSW output files can only be generated in combination with PQP input files (-tr).");
     }
+    bool osw_shards = getFlag_("out_osw_shards");
+    if (osw_shards && out_osw.empty())
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+          "Partitioned output (-out_osw_shards) requires -out_osw to be set.");
+    }
+    if (osw_shards && sonar)
+    {
+      throw Exception::IllegalArgument(__FILE__, __LINE__, OPENMS_PRETTY_FUNCTION,
+          "Partitioned output (-out_osw_shards) is not supported for SONAR data.");
+    }
 
     // Check swath window input
     if (!swath_windows_file.empty())
@@ -922,6 +935,7 @@ protected:
     FeatureMap out_featureFile;
     OpenSwathTSVWriter tsvwriter(out_tsv, file_list[0], use_ms1_traces, sonar); // only active if filename not empty
     OpenSwathOSWWriter oswwriter(out_osw, run_id, file_list[0], use_ms1_traces, sonar, enable_uis_scoring); // only active if filename not empty
+    oswwriter.setShardOutput(osw_shards);
 
     ///////////////////////////////////
     // Extract and score
@@ -941,6 +955,13 @@ protected:
           out_featureFile, !out.empty(), tsvwriter, oswwriter, chromatogramConsumer, batchSize, ms1_isotopes, load_into_memory);
     }
 
+    if (oswwriter.shardOutput())
+    {
+      // assemble the final OSW file from the per-window shards (pure
+      // concatenation, no rescoring) and clean up the shards and manifest
+      oswwriter.mergeShards();
+    }
+
     if (!out.empty())
     {
       addDataProcessing_(out_featureFile, getProcessingInfo_(DataProcessing::QUANTITATION));
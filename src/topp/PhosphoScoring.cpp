@@ -284,22 +284,31 @@ protected:
     SpectrumLookup lookup;
     lookup.readSpectra(exp.getSpectra());
 
+    // collect all PSMs up front so that site localization can run in parallel over them
+    vector<PeptideHit> all_hits;
+    vector<PeakSpectrum*> all_spectra;
     for (const PeptideIdentification& pep : pep_ids)
     {
       Size scan_id = lookup.findByRT(pep.getRT());
       PeakSpectrum& temp = exp.getSpectrum(scan_id);
-      
-      vector<PeptideHit> scored_peptides;
+
       for (const PeptideHit& hit : pep.getHits())
       {
         PeptideHit scored_hit = hit;
         addScoreToMetaValues_(scored_hit, pep.getScoreType()); // backup score value
-        
-        OPENMS_LOG_DEBUG << "starting to compute AScore RT=" << pep.getRT() << " SEQUENCE: " << scored_hit.getSequence().toString() << std::endl;
-        
-        PeptideHit phospho_sites = ascore.compute(scored_hit, temp);
-        scored_peptides.push_back(phospho_sites);
+        all_hits.push_back(scored_hit);
+        all_spectra.push_back(&temp);
       }
+    }
+
+    OPENMS_LOG_DEBUG << "starting to compute AScores for " << all_hits.size() << " PSMs" << std::endl;
+    vector<PeptideHit> scored_hits = ascore.compute(all_hits, all_spectra);
+
+    Size psm_index = 0;
+    for (const PeptideIdentification& pep : pep_ids)
+    {
+      vector<PeptideHit> scored_peptides(scored_hits.begin() + psm_index, scored_hits.begin() + psm_index + pep.getHits().size());
+      psm_index += pep.getHits().size();
 
       PeptideIdentification new_pep_id(pep);
       new_pep_id.setScoreType("PhosphoScore");
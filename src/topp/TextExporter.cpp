@@ -409,7 +409,7 @@ namespace OpenMS
   // TODO: output of multiple peptide evidences
   SVOutStream& operator<<(SVOutStream& out, const PeptideHit& hit)
   {
-    vector<PeptideEvidence> pes = hit.getPeptideEvidences();
+    const PeptideHit::PeptideEvidences& pes = hit.getPeptideEvidences();
 
     if (!pes.empty())
     {
@@ -461,8 +461,8 @@ namespace OpenMS
       bool printStart = false;
       String end;
       bool printEnd = false;
-      vector<PeptideEvidence> evid = hit.getPeptideEvidences();
-      for (vector<PeptideEvidence>::const_iterator evid_it = evid.begin(); evid_it != evid.end(); ++evid_it)
+      const PeptideHit::PeptideEvidences& evid = hit.getPeptideEvidences();
+      for (auto evid_it = evid.begin(); evid_it != evid.end(); ++evid_it)
       {
         if (evid_it != evid.begin())
         {
@@ -154,6 +154,7 @@ if(NOT DISABLE_OPENSWATH)
     OpenSwathMzMLFileCacher
     OpenSwathWorkflow
     OpenSwathFileSplitter
+    OpenSwathOSWMerger
     OpenSwathRewriteToFeatureXML
     MRMTransitionGroupPicker
   )